@@ -26,11 +26,12 @@ extern "C" {
 ****************************************************************/
 void *vrvToolkit_constructor()
 {
+    Toolkit *tk = new Toolkit(false);
 
-    // set the resource path in the js blob
-    Resources::SetPath("/data");
+    // use the fonts built into Verovio - no resource files are embedded in the js blob
+    tk->SetResourcePath("");
 
-    return new Toolkit();
+    return tk;
 }
 
 void vrvToolkit_destructor(Toolkit *tk)
@@ -55,6 +56,16 @@ int vrvToolkit_getPageCount(Toolkit *tk)
     return tk->GetPageCount();
 }
 
+int vrvToolkit_getTileCount(Toolkit *tk, int page_no)
+{
+    return tk->GetTileCount(page_no);
+}
+
+int vrvToolkit_getTileOffset(Toolkit *tk, int page_no, int tile_no)
+{
+    return tk->GetTileOffset(page_no, tile_no);
+}
+
 int vrvToolkit_getPageWithElement(Toolkit *tk, const char *xmlId)
 {
     return tk->GetPageWithElement(xmlId);
@@ -77,6 +88,12 @@ const char *vrvToolkit_getMEI(Toolkit *tk, int page_no, bool score_based)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getGlyphSprite(Toolkit *tk)
+{
+    tk->SetCString(tk->GetGlyphSprite(false));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getHumdrum(Toolkit *tk)
 {
     const char* buffer = tk->GetHumdrumBuffer();
@@ -90,6 +107,20 @@ const char *vrvToolkit_renderPage(Toolkit *tk, int page_no, const char *c_option
     return tk->GetCString();
 }
 
+const char *vrvToolkit_renderRegion(Toolkit *tk, int page_no, int x, int y, int width, int height)
+{
+    tk->ResetLogBuffer();
+    tk->SetCString(tk->RenderRegionToSvg(page_no, x, y, width, height, false));
+    return tk->GetCString();
+}
+
+const char *vrvToolkit_renderTile(Toolkit *tk, int page_no, int tile_no)
+{
+    tk->ResetLogBuffer();
+    tk->SetCString(tk->RenderTileToSvg(page_no, tile_no, false));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_renderToMidi(Toolkit *tk, const char *c_options)
 {
     tk->ResetLogBuffer();
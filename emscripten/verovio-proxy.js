@@ -27,6 +27,9 @@ verovio.vrvToolkit.getLog = Module.cwrap('vrvToolkit_getLog', 'string', ['number
 // char *getMEI(Toolkit *ic, int pageNo, int scoreBased )
 verovio.vrvToolkit.getMEI = Module.cwrap('vrvToolkit_getMEI', 'string', ['number', 'number', 'number']);
 
+// char *getGlyphSprite(Toolkit *ic)
+verovio.vrvToolkit.getGlyphSprite = Module.cwrap('vrvToolkit_getGlyphSprite', 'string', ['number']);
+
 // char *getHumdrum(Toolkit *ic)
 verovio.vrvToolkit.getHumdrum = Module.cwrap('vrvToolkit_getHumdrum', 'string');
 
@@ -36,6 +39,12 @@ verovio.vrvToolkit.getPageCount = Module.cwrap('vrvToolkit_getPageCount', 'numbe
 // int getPageWithElement(Toolkit *ic, const char *xmlId)
 verovio.vrvToolkit.getPageWithElement = Module.cwrap('vrvToolkit_getPageWithElement', 'number', ['number', 'string']);
 
+// int getTileCount(Toolkit *ic, int pageNo)
+verovio.vrvToolkit.getTileCount = Module.cwrap('vrvToolkit_getTileCount', 'number', ['number', 'number']);
+
+// int getTileOffset(Toolkit *ic, int pageNo, int tileNo)
+verovio.vrvToolkit.getTileOffset = Module.cwrap('vrvToolkit_getTileOffset', 'number', ['number', 'number', 'number']);
+
 // double getTimeForElement(Toolkit *ic, const char *xmlId)
 verovio.vrvToolkit.getTimeForElement = Module.cwrap('vrvToolkit_getTimeForElement', 'number', ['number', 'string']);
 
@@ -54,6 +63,12 @@ verovio.vrvToolkit.renderData = Module.cwrap('vrvToolkit_renderData', 'string',
 // char *renderPage(Toolkit *ic, int pageNo, const char *rendering_options )
 verovio.vrvToolkit.renderPage = Module.cwrap('vrvToolkit_renderPage', 'string', ['number', 'number', 'string']);
 
+// char *renderRegion(Toolkit *ic, int pageNo, int x, int y, int width, int height )
+verovio.vrvToolkit.renderRegion = Module.cwrap('vrvToolkit_renderRegion', 'string', ['number', 'number', 'number', 'number', 'number', 'number']);
+
+// char *renderTile(Toolkit *ic, int pageNo, int tileNo )
+verovio.vrvToolkit.renderTile = Module.cwrap('vrvToolkit_renderTile', 'string', ['number', 'number', 'number']);
+
 // char *renderToMidi(Toolkit *ic, const char *rendering_options )
 verovio.vrvToolkit.renderToMidi = Module.cwrap('vrvToolkit_renderToMidi', 'string', ['number', 'string']);
 
@@ -105,6 +120,10 @@ verovio.toolkit.prototype.getMEI = function (pageNo, scoreBased) {
 	return verovio.vrvToolkit.getMEI(this.ptr, pageNo, scoreBased);
 };
 
+verovio.toolkit.prototype.getGlyphSprite = function () {
+	return verovio.vrvToolkit.getGlyphSprite(this.ptr);
+};
+
 verovio.toolkit.prototype.getHumdrum = function () {
 	return verovio.vrvToolkit.getHumdrum(this.ptr);
 };
@@ -117,6 +136,14 @@ verovio.toolkit.prototype.getPageWithElement = function (xmlId) {
 	return verovio.vrvToolkit.getPageWithElement(this.ptr, xmlId);
 };
 
+verovio.toolkit.prototype.getTileCount = function (pageNo) {
+	return verovio.vrvToolkit.getTileCount(this.ptr, pageNo);
+};
+
+verovio.toolkit.prototype.getTileOffset = function (pageNo, tileNo) {
+	return verovio.vrvToolkit.getTileOffset(this.ptr, pageNo, tileNo);
+};
+
 verovio.toolkit.prototype.getTimeForElement = function (xmlId) {
 	return verovio.vrvToolkit.getTimeForElement(this.ptr, xmlId);
 };
@@ -149,6 +176,14 @@ verovio.toolkit.prototype.renderPage = function (pageNo, options) {
 	return verovio.vrvToolkit.renderPage(this.ptr, pageNo, JSON.stringify(options));
 };
 
+verovio.toolkit.prototype.renderRegion = function (pageNo, x, y, width, height) {
+	return verovio.vrvToolkit.renderRegion(this.ptr, pageNo, x, y, width, height);
+};
+
+verovio.toolkit.prototype.renderTile = function (pageNo, tileNo) {
+	return verovio.vrvToolkit.renderTile(this.ptr, pageNo, tileNo);
+};
+
 verovio.toolkit.prototype.renderToMidi = function (options) {
 	if (typeof options === 'string') {
 		console.warn("DEPRECATION WARNING: Passing a String to renderToMidi will be removed in next version of Verovio. Pass a JSON Object instead.");
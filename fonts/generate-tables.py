@@ -0,0 +1,232 @@
+#!/usr/bin/env python3
+#
+# Generate ../src/builtinfont.cpp with the fonts compiled into Verovio.
+#
+# For each built-in SMuFL font, the glyph files of ../data/<font>/ and the bounding boxes of ../data/<font>.xml
+# are merged exactly as Resources::LoadFont would do it when reading the files. The text font bounding boxes
+# (../data/text/Times.xml) and the VerovioText woff (../data/woff.xml) are included as well.
+#
+# Usage: ./generate-tables.py [data directory] [output file]
+
+import os
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+FONTS = ['Bravura', 'Leipzig', 'Gootville']
+
+NUMBER = re.compile(r'^-?(\d+\.?\d*|\.\d+)([eE][-+]?\d+)?$')
+
+HEADER = '''/////////////////////////////////////////////////////////////////////////////
+// Name:        builtinfont.cpp
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////////
+// NOTE: this file was generated by the ./fonts/generate-tables.py script and
+// should not be edited because changes will be lost.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "builtinfont.h"
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+'''
+
+FOOTER = '''
+//----------------------------------------------------------------------------
+// Access to the built-in resources
+//----------------------------------------------------------------------------
+
+const BuiltInFont *GetBuiltInFont(const std::string &fontName)
+{
+    for (int i = 0; i < BUILTIN_FONT_COUNT; ++i) {
+        if (fontName == builtInFonts[i].m_name) return &builtInFonts[i];
+    }
+    return NULL;
+}
+
+const BuiltInFont *GetBuiltInTextFont()
+{
+    return &builtInTextFont;
+}
+
+const char *GetBuiltInWoff()
+{
+    return builtInWoff;
+}
+
+} // namespace vrv
+'''
+
+
+def literal(text, indent='    '):
+    """Return text as adjacent C++ string literals, split by line and in short chunks for the compilers."""
+    out = []
+    for line in text.splitlines(True):
+        for start in range(0, len(line), 2000):
+            chunk = line[start:start + 2000]
+            escaped = ''
+            for c in chunk:
+                if c == '\\':
+                    escaped += '\\\\'
+                elif c == '"':
+                    escaped += '\\"'
+                elif c == '\n':
+                    escaped += '\\n'
+                elif c == '\r':
+                    escaped += '\\r'
+                elif c == '\t':
+                    escaped += '\\t'
+                elif c == '?':
+                    # avoid trigraphs
+                    escaped += '\\?'
+                elif ord(c) < 32 or ord(c) > 126:
+                    escaped += ''.join('\\%03o' % b for b in c.encode('utf-8'))
+                else:
+                    escaped += c
+            out.append(indent + '"' + escaped + '"')
+    if not out:
+        return indent + '""'
+    return '\n'.join(out)
+
+
+def number(value):
+    """Return the attribute value as a double literal - it is parsed by the compiler as atof would do it"""
+    if value is None:
+        return '0.0'
+    if not NUMBER.match(value):
+        sys.exit('Invalid number "%s"' % value)
+    if '.' not in value and 'e' not in value.lower():
+        value += '.0'
+    return value
+
+
+def units_per_em(xml, filename):
+    """Return the units per em from the viewBox as Glyph::Glyph does it (or the default 2048)"""
+    root = ET.fromstring(xml)
+    view_box = root.get('viewBox')
+    if view_box is None or view_box.count(' ') < 3:
+        print('Warning: no valid viewBox in %s' % filename)
+        return 2048
+    match = re.match(r'\s*(-?\d+)', view_box[view_box.rfind(' '):])
+    return int(match.group(1)) if match else 0
+
+
+def bounding_boxes(filename):
+    """Return the units per em and the bounding boxes by code of a bounding box file"""
+    root = ET.parse(filename).getroot()
+    boxes = {}
+    for g in root.findall('g'):
+        if g.get('c') is None:
+            continue
+        boxes[int(g.get('c'), 16)] = g
+    return int(root.get('units-per-em')), boxes
+
+
+def glyph_entry(code, code_str, upem, box, xml_name):
+    values = ['0.0'] * 5
+    if box is not None:
+        values = [number(box.get(a)) for a in ['x', 'y', 'w', 'h', 'h-a-x']]
+    return '    { 0x%X, "%s", %d, %s, %s },' % (code, code_str, upem, ', '.join(values), xml_name)
+
+
+def generate_font(data_dir, font, out):
+    font_dir = os.path.join(data_dir, font)
+    glyphs = {}
+    for filename in sorted(os.listdir(font_dir)):
+        if '.xml' not in filename:
+            continue
+        code = int(re.match(r'[0-9A-Fa-f]*', filename).group(0) or '0', 16)
+        if code == 0:
+            sys.exit('Invalid SMuFL code in %s' % filename)
+        if code in glyphs:
+            sys.exit('Duplicated SMuFL code in %s' % filename)
+        with open(os.path.join(font_dir, filename), encoding='utf-8') as f:
+            xml = f.read()
+        glyphs[code] = (filename[0:4], units_per_em(xml, filename), xml)
+
+    box_upem, boxes = bounding_boxes(os.path.join(data_dir, font + '.xml'))
+    for code in boxes:
+        if code not in glyphs:
+            print('Warning: %s bounding box for missing glyph %X' % (font, code))
+
+    out.append('//----------------------------------------------------------------------------')
+    out.append('// %s' % font)
+    out.append('//----------------------------------------------------------------------------')
+    out.append('')
+    names = []
+    for code in sorted(glyphs):
+        name = 'xml%s_%X' % (font, code)
+        names.append(name)
+        out.append('static const char %s[] =' % name)
+        out.append(literal(glyphs[code][2]) + ';')
+        out.append('')
+
+    out.append('static const BuiltInGlyph glyphs%s[] = {' % font)
+    for code, name in zip(sorted(glyphs), names):
+        code_str, upem, xml = glyphs[code]
+        box = boxes.get(code)
+        # As in Resources::LoadFont, the bounding box is ignored if the units per em do not match
+        if box is not None and upem != box_upem:
+            print('Warning: %s units per em mismatch for glyph %X' % (font, code))
+            box = None
+        out.append(glyph_entry(code, code_str, upem, box, name))
+    out.append('};')
+    out.append('')
+    return len(glyphs)
+
+
+def main():
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    data_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.join(script_dir, '..', 'data')
+    output = sys.argv[2] if len(sys.argv) > 2 else os.path.join(script_dir, '..', 'src', 'builtinfont.cpp')
+
+    out = [HEADER]
+    counts = []
+    for font in FONTS:
+        counts.append(generate_font(data_dir, font, out))
+
+    out.append('//----------------------------------------------------------------------------')
+    out.append('// Text font (bounding boxes only)')
+    out.append('//----------------------------------------------------------------------------')
+    out.append('')
+    text_upem, text_boxes = bounding_boxes(os.path.join(data_dir, 'text', 'Times.xml'))
+    out.append('static const BuiltInGlyph glyphsText[] = {')
+    for code in sorted(text_boxes):
+        out.append(glyph_entry(code, '', text_upem, text_boxes[code], 'NULL'))
+    out.append('};')
+    out.append('')
+
+    out.append('//----------------------------------------------------------------------------')
+    out.append('// VerovioText woff')
+    out.append('//----------------------------------------------------------------------------')
+    out.append('')
+    with open(os.path.join(data_dir, 'woff.xml'), encoding='utf-8') as f:
+        out.append('static const char builtInWoff[] =')
+        out.append(literal(f.read()) + ';')
+    out.append('')
+
+    out.append('//----------------------------------------------------------------------------')
+    out.append('// Fonts')
+    out.append('//----------------------------------------------------------------------------')
+    out.append('')
+    out.append('#define BUILTIN_FONT_COUNT %d' % len(FONTS))
+    out.append('')
+    out.append('static const BuiltInFont builtInFonts[BUILTIN_FONT_COUNT] = {')
+    for font, count in zip(FONTS, counts):
+        out.append('    { "%s", glyphs%s, %d },' % (font, font, count))
+    out.append('};')
+    out.append('')
+    out.append('static const BuiltInFont builtInTextFont = { "Times", glyphsText, %d };' % len(text_boxes))
+    out.append(FOOTER)
+
+    with open(output, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()
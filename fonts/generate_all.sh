@@ -37,4 +37,7 @@ echo "Generating Gootville files ..."
 saxon9ee Gootville.svg extract-glyphs.xsl > tmp/Gootville-bounding-boxes.svg
 phantomjs generate-bbox.js tmp/Gootville-bounding-boxes.svg ../data/Gootville.xml
 
+echo "Generating C++ font tables ..."
+./generate-tables.py ../data ../src/builtinfont.cpp
+
 echo "Done!"
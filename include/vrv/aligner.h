@@ -69,6 +69,7 @@ public:
     // constructors and destructors
     SystemAligner();
     virtual ~SystemAligner();
+    virtual std::string GetClassName() const { return "SystemAligner"; }
     virtual ClassId Is() const { return SYSTEM_ALIGNER; }
 
     int GetStaffAlignmentCount() const { return (int)m_children.size(); }
@@ -126,6 +127,7 @@ public:
     ///@{
     StaffAlignment();
     virtual ~StaffAlignment();
+    virtual std::string GetClassName() const { return "StaffAlignment"; }
     virtual ClassId Is() const { return STAFF_ALIGNMENT; }
     ///@}
 
@@ -301,6 +303,7 @@ public:
     Alignment(double time, AlignmentType type = ALIGNMENT_DEFAULT);
     virtual ~Alignment();
     virtual void Reset();
+    virtual std::string GetClassName() const { return "Alignment"; }
     virtual ClassId Is() const { return ALIGNMENT; }
     ///@}
 
@@ -352,6 +355,12 @@ public:
     // Functors //
     //----------//
 
+    /**
+     * See Object::CalcMemoryFootprint
+     * Also passes the functor to the GraceAligner.
+     */
+    virtual int CalcMemoryFootprint(FunctorParams *functorParams);
+
     /**
      * Correct the X alignment of grace notes once the content of a system has been aligned and laid out.
      * Special case that redirects the functor to the GraceAligner.
@@ -446,6 +455,7 @@ public:
     // constructors and destructors
     MeasureAligner();
     virtual ~MeasureAligner();
+    virtual std::string GetClassName() const { return "MeasureAligner"; }
     virtual ClassId Is() const { return MEASURE_ALIGNER; }
 
     int GetAlignmentCount() const { return (int)m_children.size(); }
@@ -547,6 +557,7 @@ public:
     // constructors and destructors
     GraceAligner();
     virtual ~GraceAligner();
+    virtual std::string GetClassName() const { return "GraceAligner"; }
     virtual ClassId Is() const { return GRACE_ALIGNER; }
 
     /**
@@ -601,6 +612,7 @@ public:
     // constructors and destructors
     TimestampAligner();
     virtual ~TimestampAligner();
+    virtual std::string GetClassName() const { return "TimestampAligner"; }
     virtual ClassId Is() const { return TIMESTAMP_ALIGNER; }
 
     /**
@@ -27,13 +27,15 @@ class Object;
  * This is the base class for all MEI att classes.
  * It is not an abstract class but it should not be instanciated directly.
  * The att classes are generated with the libmei parser for Verovio.
+ * They have no virtual methods (including the destructor) so they do not add a vtable pointer to
+ * every object inheriting from them. They are never deleted through a pointer to the att class.
 */
 class Att : public AttConverter {
 public:
     /** @name Constructors and destructor */
     ///@{
     Att();
-    virtual ~Att();
+    ~Att();
     ///@}
 
     /**
@@ -92,7 +94,7 @@ public:
 
 public:
     /** Dummy string converter */
-    std::string StrToStr(std::string str) const;
+    std::string StrToStr(const std::string &str) const;
 
     /** @name Basic converters for writing */
     ///@{
@@ -103,72 +105,72 @@ public:
 
     /** @name Basic converters for reading */
     ///@{
-    double StrToDbl(std::string value) const;
-    int StrToInt(std::string value) const;
-    wchar_t StrToWcharT(std::string value) const;
+    double StrToDbl(const std::string &value) const;
+    int StrToInt(const std::string &value) const;
+    wchar_t StrToWcharT(const std::string &value) const;
     ///@}
 
     /** @name Converters for writing and reading */
     ///@{
     std::string ArticulationListToStr(data_ARTICULATION_List data) const;
-    data_ARTICULATION_List StrToArticulationList(std::string value) const;
+    data_ARTICULATION_List StrToArticulationList(const std::string &value) const;
 
     std::string BeatrptRendToStr(data_BEATRPT_REND data) const;
-    data_BEATRPT_REND StrToBeatrptRend(std::string value) const;
+    data_BEATRPT_REND StrToBeatrptRend(const std::string &value) const;
 
     std::string DurationToStr(data_DURATION data) const;
-    data_DURATION StrToDuration(std::string value) const;
+    data_DURATION StrToDuration(const std::string &value) const;
 
     std::string KeysignatureToStr(data_KEYSIGNATURE data) const;
-    data_KEYSIGNATURE StrToKeysignature(std::string value) const;
+    data_KEYSIGNATURE StrToKeysignature(const std::string &value) const;
 
     std::string MeasurebeatToStr(data_MEASUREBEAT data) const;
-    data_MEASUREBEAT StrToMeasurebeat(std::string value) const;
+    data_MEASUREBEAT StrToMeasurebeat(const std::string &value) const;
 
     std::string ModusmaiorToStr(data_MODUSMAIOR data) const;
-    data_MODUSMAIOR StrToModusmaior(std::string value) const;
+    data_MODUSMAIOR StrToModusmaior(const std::string &value) const;
 
     std::string ModusminorToStr(data_MODUSMINOR data) const;
-    data_MODUSMINOR StrToModusminor(std::string value) const;
+    data_MODUSMINOR StrToModusminor(const std::string &value) const;
 
     std::string MidibpmToStr(data_MIDIBPM data) const { return IntToStr(data); }
-    data_MIDIBPM StrToMidibpm(std::string value) const { return StrToInt(value); }
+    data_MIDIBPM StrToMidibpm(const std::string &value) const { return StrToInt(value); }
 
     std::string MidichannelToStr(data_MIDICHANNEL data) const { return IntToStr(data); }
-    data_MIDICHANNEL StrToMidichannel(std::string value) const { return StrToInt(value); }
+    data_MIDICHANNEL StrToMidichannel(const std::string &value) const { return StrToInt(value); }
 
     std::string MidimspbToStr(data_MIDIMSPB data) const { return IntToStr(data); }
-    data_MIDIMSPB StrToMidimspb(std::string value) const { return StrToInt(value); }
+    data_MIDIMSPB StrToMidimspb(const std::string &value) const { return StrToInt(value); }
 
     std::string MidivalueToStr(data_MIDIVALUE data) const { return IntToStr(data); }
-    data_MIDIVALUE StrToMidivalue(std::string value) const { return StrToInt(value); }
+    data_MIDIVALUE StrToMidivalue(const std::string &value) const { return StrToInt(value); }
 
     std::string OctaveDisToStr(data_OCTAVE_DIS data) const;
-    data_OCTAVE_DIS StrToOctaveDis(std::string value) const;
+    data_OCTAVE_DIS StrToOctaveDis(const std::string &value) const;
 
     std::string OrientationToStr(data_ORIENTATION data) const;
-    data_ORIENTATION StrToOrientation(std::string value) const;
+    data_ORIENTATION StrToOrientation(const std::string &value) const;
 
     std::string PercentToStr(data_PERCENT data) const;
-    data_PERCENT StrToPercent(std::string value) const;
+    data_PERCENT StrToPercent(const std::string &value) const;
 
     std::string PitchnameToStr(data_PITCHNAME data) const;
-    data_PITCHNAME StrToPitchname(std::string value) const;
+    data_PITCHNAME StrToPitchname(const std::string &value) const;
 
     std::string ProlatioToStr(data_PROLATIO data) const;
-    data_PROLATIO StrToProlatio(std::string value) const;
+    data_PROLATIO StrToProlatio(const std::string &value) const;
 
     std::string StemdirectionToStr(data_STEMDIRECTION data) const;
-    data_STEMDIRECTION StrToStemdirection(std::string value) const;
+    data_STEMDIRECTION StrToStemdirection(const std::string &value) const;
 
     std::string TempusToStr(data_TEMPUS data) const;
-    data_TEMPUS StrToTempus(std::string value) const;
+    data_TEMPUS StrToTempus(const std::string &value) const;
 
     std::string TieToStr(data_TIE data) const;
-    data_TIE StrToTie(std::string value) const;
+    data_TIE StrToTie(const std::string &value) const;
 
     std::string XsdPositiveIntegerListToStr(xsdPositiveInteger_List data) const;
-    xsdPositiveInteger_List StrToXsdPositiveIntegerList(std::string value) const;
+    xsdPositiveInteger_List StrToXsdPositiveIntegerList(const std::string &value) const;
     ///@}
 };
 
@@ -191,19 +193,20 @@ public:
      * Reset method reset all attribute classes
      */
     ///@{
-    Interface(){};
+    Interface() { m_registeredInterfaceId = INTERFACE; }
     virtual ~Interface(){};
     ///@}
 
     /**
      * Method for registering an MEI att classes in the interface.
+     * The registration is stored once per InterfaceId and not in each interface.
      */
-    void RegisterInterfaceAttClass(AttClassId attClassId) { m_interfaceAttClasses.push_back(attClassId); }
+    void RegisterInterfaceAttClass(AttClassId attClassId);
 
     /**
-     * Method for obtaining a pointer to the attribute class vector of the interface
+     * Method for obtaining a pointer to the attribute class set of the interface
      */
-    std::vector<AttClassId> *GetAttClasses() { return &m_interfaceAttClasses; }
+    const AttClassSet *GetAttClasses() const { return &s_attClasses[m_registeredInterfaceId]; }
 
     /**
      * Virtual method returning the InterfaceId of the interface.
@@ -213,9 +216,15 @@ public:
 
 private:
     /**
-     * A vector for storing all the MEI att classes grouped in the interface
+     * The InterfaceId under which the MEI att classes of the interface are registered.
+     * For an interface inheriting from another one, the registrations of the parent interface are included.
      */
-    std::vector<AttClassId> m_interfaceAttClasses;
+    InterfaceId m_registeredInterfaceId;
+
+    /**
+     * The MEI att classes grouped in each InterfaceId
+     */
+    static AttClassSet s_attClasses[INTERFACE_max];
 };
 
 //----------------------------------------------------------------------------
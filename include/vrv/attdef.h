@@ -23,6 +23,8 @@ namespace vrv {
 
 typedef std::vector<std::pair<std::string, std::string> > ArrayOfStrAttr;
 
+typedef std::vector<std::pair<const std::string *, const std::string *> > ArrayOfPooledStrAttr;
+
 #define VRV_UNSET -0x7FFFFFFF
 
 //----------------------------------------------------------------------------
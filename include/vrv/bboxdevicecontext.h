@@ -107,7 +107,7 @@ public:
      * @name Method for starting and ending a graphic
      */
     ///@{
-    virtual void StartGraphic(Object *object, std::string gClass, std::string gId);
+    virtual void StartGraphic(Object *object, const std::string &gClass, const std::string &gId);
     virtual void EndGraphic(Object *object, View *view);
     ///@}
 
@@ -115,7 +115,7 @@ public:
      * @name Methods for re-starting and ending a graphic for objects drawn in separate steps
      */
     ///@{
-    virtual void ResumeGraphic(Object *object, std::string gId);
+    virtual void ResumeGraphic(Object *object, const std::string &gId);
     virtual void EndResumedGraphic(Object *object, View *view);
     ///@}
 
@@ -120,8 +120,6 @@ public:
 private:
     bool m_updatedBBoxX;
     bool m_updatedBBoxY;
-    /** buffer for De-Casteljau algorithm */
-    static int s_deCasteljau[4][4];
 
 protected:
     /**
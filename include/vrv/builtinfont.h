@@ -0,0 +1,66 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        builtinfont.h
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_BUILTINFONT_H__
+#define __VRV_BUILTINFONT_H__
+
+#include <string>
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// BuiltInGlyph
+//----------------------------------------------------------------------------
+
+/**
+ * A glyph of a font compiled into Verovio (see ./fonts/generate-tables.py).
+ * The values are the ones of the resource files, i.e., before they are multiplied by 10 in the Glyph.
+ */
+struct BuiltInGlyph {
+    wchar_t m_code;
+    /** The Unicode code in hexa as string (empty for the text font) */
+    const char *m_codeStr;
+    int m_unitsPerEm;
+    double m_x;
+    double m_y;
+    double m_width;
+    double m_height;
+    double m_horizAdvX;
+    /** The SVG symbol of the glyph (NULL for the text font) */
+    const char *m_xml;
+};
+
+//----------------------------------------------------------------------------
+// BuiltInFont
+//----------------------------------------------------------------------------
+
+/**
+ * A font compiled into Verovio with its glyphs sorted by code.
+ */
+struct BuiltInFont {
+    const char *m_name;
+    const BuiltInGlyph *m_glyphs;
+    int m_count;
+};
+
+/**
+ * @name Access to the resources compiled into Verovio.
+ * They are generated from the content of the data directory by ./fonts/generate-tables.py and
+ * are used by Resources when no resource path is set.
+ */
+///@{
+/** Return the SMuFL font with the name (NULL if it is not compiled in) */
+const BuiltInFont *GetBuiltInFont(const std::string &fontName);
+/** Return the text font (bounding boxes only) */
+const BuiltInFont *GetBuiltInTextFont();
+/** Return the content of the woff.xml file with the VerovioText font */
+const char *GetBuiltInWoff();
+///@}
+
+} // namespace vrv
+
+#endif
@@ -29,7 +29,7 @@ public:
      */
     ///@{
     ControlElement();
-    ControlElement(std::string classid);
+    ControlElement(const char *classid);
     virtual ~ControlElement();
     virtual void Reset();
     virtual ClassId Is() const { return CONTROL_ELEMENT; }
@@ -8,6 +8,7 @@
 #ifndef __VRV_DC_H__
 #define __VRV_DC_H__
 
+#include <assert.h>
 #include <stack>
 #include <string>
 
@@ -19,6 +20,7 @@
 namespace vrv {
 
 class Object;
+class Resources;
 class View;
 
 // ---------------------------------------------------------------------------
@@ -45,6 +47,7 @@ public:
     DeviceContext()
     {
         m_drawingBoundingBoxes = false;
+        m_resources = NULL;
         m_isDeactivatedX = false;
         m_isDeactivatedY = false;
     }
@@ -106,6 +109,12 @@ public:
     virtual void DrawBackgroundImage(int x = 0, int y = 0) = 0;
     ///@}
 
+    /**
+     * Draw n lines, each one between two consecutive points (points has 2 * n items).
+     * The default implementation calls DrawLine for each of them. It can be overridden for drawing them at once.
+     */
+    virtual void DrawLines(int n, Point points[]);
+
     /**
      * Special method for forcing bounding boxes to be updated
      * Used for invisible elements (e.g. <space>) that needs to be take into account in spacing
@@ -147,7 +156,7 @@ public:
      * For example, the method can be used for grouping shapes in <g></g> in SVG
      */
     ///@{
-    virtual void StartGraphic(Object *object, std::string gClass, std::string gId) = 0;
+    virtual void StartGraphic(Object *object, const std::string &gClass, const std::string &gId) = 0;
     virtual void EndGraphic(Object *object, View *view) = 0;
     ///@}
 
@@ -156,7 +165,7 @@ public:
      * The methods can be used to the output together, for example for a Beam
      */
     ///@{
-    virtual void ResumeGraphic(Object *object, std::string gId) = 0;
+    virtual void ResumeGraphic(Object *object, const std::string &gId) = 0;
     virtual void EndResumedGraphic(Object *object, View *view) = 0;
     ///@}
 
@@ -165,7 +174,7 @@ public:
      * For example, in SVG, a text graphic is a <tspan> (and not a <g>)
      */
     ///@{
-    virtual void StartTextGraphic(Object *object, std::string gClass, std::string gId)
+    virtual void StartTextGraphic(Object *object, const std::string &gClass, const std::string &gId)
     {
         StartGraphic(object, gClass, gId);
     }
@@ -191,9 +200,25 @@ public:
     virtual bool GetDrawBoundingBoxes() { return m_drawingBoundingBoxes; }
     ///@}
 
+    /**
+     * @name Getter and setter for the resources (fonts) used for the text extents and the glyphs.
+     * The resources are the ones of the document being drawn and need to be set before drawing.
+     */
+    ///@{
+    void SetResources(const Resources *resources) { m_resources = resources; }
+    const Resources *GetResources() const
+    {
+        assert(m_resources);
+        return m_resources;
+    }
+    ///@}
+
 protected:
     bool m_drawingBoundingBoxes;
 
+    /** The resources of the document being drawn */
+    const Resources *m_resources;
+
     std::stack<Pen> m_penStack;
     std::stack<Brush> m_brushStack;
     std::stack<FontInfo *> m_fontStack;
@@ -0,0 +1,268 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        displaylistdevicecontext.h
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_DISPLAY_LIST_DC_H__
+#define __VRV_DISPLAY_LIST_DC_H__
+
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "devicecontext.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// DisplayListDeviceContext
+//----------------------------------------------------------------------------
+
+/**
+ * This class records the drawing calls into a list that can be replayed into any other device context.
+ * It is used for keeping the drawing of a page, which can then be rendered again (e.g., with another scale) without
+ * going through the View.
+ * The pen, the brush, the font and the deactivation of the graphic are recorded as a state that is set before each
+ * call when it has changed. The objects and the view passed to the graphic methods are kept as pointers and need to
+ * remain valid until the list is replayed, but for the drawing copies of the scoreDef made by the View, which are
+ * copied.
+ */
+class DisplayListDeviceContext : public DeviceContext {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    DisplayListDeviceContext();
+    virtual ~DisplayListDeviceContext();
+    virtual ClassId Is() const { return DISPLAY_LIST_DEVICE_CONTEXT; }
+    ///@}
+
+    /**
+     * Replay the recorded calls into the device context, using the resources of the recording.
+     * The logical origin is set relatively to the current one of the device context.
+     */
+    void Replay(DeviceContext *dc);
+
+    /**
+     * Return the approximate number of bytes used by the list
+     */
+    size_t GetMemoryUsage() const;
+
+    /**
+     * @name Setters
+     */
+    ///@{
+    virtual void SetBackground(int colour, int style = AxSOLID);
+    virtual void SetBackgroundImage(void *image, double opacity = 1.0);
+    virtual void SetBackgroundMode(int mode);
+    virtual void SetTextForeground(int colour);
+    virtual void SetTextBackground(int colour);
+    virtual void SetLogicalOrigin(int x, int y);
+    ///@}
+
+    /**
+     * @name Getters
+     */
+    ///@{
+    virtual Point GetLogicalOrigin();
+    ///}
+
+    /**
+     * @name Drawing methods
+     */
+    ///@{
+    virtual void DrawComplexBezierPath(Point bezier1[4], Point bezier2[4]);
+    virtual void DrawCircle(int x, int y, int radius);
+    virtual void DrawEllipse(int x, int y, int width, int height);
+    virtual void DrawEllipticArc(int x, int y, int width, int height, double start, double end);
+    virtual void DrawLine(int x1, int y1, int x2, int y2);
+    virtual void DrawLines(int n, Point points[]);
+    virtual void DrawPolygon(int n, Point points[], int xoffset, int yoffset, int fill_style = AxODDEVEN_RULE);
+    virtual void DrawRectangle(int x, int y, int width, int height);
+    virtual void DrawRotatedText(const std::string &text, int x, int y, double angle);
+    virtual void DrawRoundedRectangle(int x, int y, int width, int height, double radius);
+    virtual void DrawText(const std::string &text, const std::wstring wtext = L"");
+    virtual void DrawMusicText(const std::wstring &text, int x, int y);
+    virtual void DrawSpline(int n, Point points[]);
+    virtual void DrawBackgroundImage(int x = 0, int y = 0);
+    virtual void DrawPlaceholder(int x, int y);
+    ///@}
+
+    /**
+     * @name Method for starting and ending a text
+     */
+    ///@{
+    virtual void StartText(int x, int y, char alignement = LEFT);
+    virtual void EndText();
+    virtual void MoveTextTo(int x, int y);
+    ///@}
+
+    /**
+     * @name Method for starting and ending a graphic
+     */
+    ///@{
+    virtual void StartGraphic(Object *object, const std::string &gClass, const std::string &gId);
+    virtual void EndGraphic(Object *object, View *view);
+    ///@}
+
+    /**
+     * @name Methods for re-starting and ending a graphic for objects drawn in separate steps
+     */
+    ///@{
+    virtual void ResumeGraphic(Object *object, const std::string &gId);
+    virtual void EndResumedGraphic(Object *object, View *view);
+    ///@}
+
+    /**
+     * @name Method for starting and ending a text graphic
+     */
+    ///@{
+    virtual void StartTextGraphic(Object *object, const std::string &gClass, const std::string &gId);
+    virtual void EndTextGraphic(Object *object, View *view);
+    ///@}
+
+    /**
+     * @name Method for starting and ending page
+     */
+    ///@{
+    virtual void StartPage();
+    virtual void EndPage();
+    ///@}
+
+private:
+    /**
+     * The recorded calls, each one followed by its integer arguments in m_ints.
+     */
+    enum Command {
+        CMD_PEN = 0,
+        CMD_BRUSH,
+        CMD_FONT,
+        CMD_DEACTIVATION,
+        CMD_BACKGROUND,
+        CMD_BACKGROUND_IMAGE,
+        CMD_BACKGROUND_MODE,
+        CMD_TEXT_FOREGROUND,
+        CMD_TEXT_BACKGROUND,
+        CMD_LOGICAL_ORIGIN,
+        CMD_COMPLEX_BEZIER_PATH,
+        CMD_CIRCLE,
+        CMD_ELLIPSE,
+        CMD_ELLIPTIC_ARC,
+        CMD_LINE,
+        CMD_LINES,
+        CMD_POLYGON,
+        CMD_RECTANGLE,
+        CMD_ROTATED_TEXT,
+        CMD_ROUNDED_RECTANGLE,
+        CMD_TEXT,
+        CMD_MUSIC_TEXT,
+        CMD_SPLINE,
+        CMD_BACKGROUND_IMAGE_DRAW,
+        CMD_PLACEHOLDER,
+        CMD_START_TEXT,
+        CMD_END_TEXT,
+        CMD_MOVE_TEXT_TO,
+        CMD_START_GRAPHIC,
+        CMD_END_GRAPHIC,
+        CMD_RESUME_GRAPHIC,
+        CMD_END_RESUMED_GRAPHIC,
+        CMD_START_TEXT_GRAPHIC,
+        CMD_END_TEXT_GRAPHIC,
+        CMD_START_PAGE,
+        CMD_END_PAGE
+    };
+
+    /**
+     * The flags of the strings stored for a graphic
+     */
+    enum GraphicString { GRAPHIC_CLASS = 1, GRAPHIC_ID = 2 };
+
+    /**
+     * Record the command after the state (pen, brush, font, deactivation) if it has changed
+     */
+    void AddCommand(Command command);
+
+    /**
+     * @name Append arguments to the command being recorded.
+     * The other arguments than integers are stored in tables in which they are read in order when replaying.
+     */
+    ///@{
+    void AddInts(int a, int b);
+    void AddInts(int a, int b, int c, int d);
+    void AddPoints(int n, Point points[]);
+    void AddDouble(double d);
+    void AddString(const std::string &string);
+    void AddWString(const std::wstring &wstring);
+    void AddView(View *view);
+    ///@}
+
+    /**
+     * Append the object of a graphic started (or ended) to the command being recorded.
+     * The drawing copies of the View are replaced by a copy kept by the list.
+     */
+    void AddObject(Object *object, bool start);
+
+    /**
+     * Return the copy of a drawing copy of the View, making it if it is not in the copy of a graphic started
+     */
+    Object *GetCopy(Object *object);
+
+    /**
+     * Append the class and the id of a graphic, after its object
+     */
+    void AddGraphicStrings(const std::string &gClass, const std::string &gId);
+
+    /**
+     * Return the points at the position in m_ints, moving it after them
+     */
+    Point *GetPoints(int n, size_t &pos);
+
+    /**
+     * Return the string of a graphic at stringPos, moving it after, or notStored if it was not stored
+     */
+    const std::string &GetGraphicString(int stored, int flag, size_t &stringPos, const std::string &notStored) const;
+
+public:
+    //
+private:
+    /** The commands with their integer arguments */
+    std::vector<int> m_ints;
+    /** @name The tables of the other arguments */
+    ///@{
+    std::vector<double> m_doubles;
+    std::vector<std::string> m_strings;
+    std::vector<std::wstring> m_wstrings;
+    std::vector<Object *> m_objects;
+    std::vector<View *> m_views;
+    std::vector<void *> m_images;
+    std::vector<Pen> m_pens;
+    std::vector<Brush> m_brushes;
+    std::vector<FontInfo> m_fonts;
+    ///@}
+
+    /** The copies of the objects that do not outlive the drawing, owned by the list */
+    std::vector<Object *> m_copies;
+    /** The objects of the graphics started and not ended yet, with the ones recorded for them */
+    std::vector<std::pair<Object *, Object *> > m_graphics;
+
+    /** The points of the command being replayed */
+    std::vector<Point> m_points;
+
+    /** @name The state as last recorded (-1 for none) */
+    ///@{
+    int m_pen;
+    int m_brush;
+    int m_font;
+    int m_deactivation;
+    ///@}
+
+    Point m_origin;
+};
+
+} // namespace vrv
+
+#endif // __VRV_DISPLAY_LIST_DC_H__
@@ -8,9 +8,16 @@
 #ifndef __VRV_DOC_H__
 #define __VRV_DOC_H__
 
+#include <random>
+#include <unordered_set>
+
+//----------------------------------------------------------------------------
+
 #include "devicecontextbase.h"
+#include "glyph.h"
 #include "scoredef.h"
 #include "style.h"
+#include "vrv.h"
 
 class MidiFile;
 
@@ -22,6 +29,40 @@ class Score;
 
 enum DocType { Raw = 0, Rendering, Transcription };
 
+//----------------------------------------------------------------------------
+// StringPool
+//----------------------------------------------------------------------------
+
+/**
+ * This class interns the strings repeated across the objects of a Doc (e.g., the unsupported attributes).
+ * Each distinct string is stored once and the objects keep a pointer to it.
+ * The pointers remain valid until the pool is cleared when the document is reset.
+ */
+class StringPool {
+public:
+    /**
+     * Return the pooled string equal to str, adding it if necessary.
+     */
+    const std::string *Intern(const std::string &str) { return &(*m_strings.insert(str).first); }
+
+    void Clear() { m_strings.clear(); }
+
+    /**
+     * @name Getters for the number of strings and the number of characters stored
+     */
+    ///@{
+    int GetCount() const { return (int)m_strings.size(); }
+    size_t GetLength() const;
+    ///@}
+
+private:
+    //
+public:
+    //
+private:
+    std::unordered_set<std::string> m_strings;
+};
+
 //----------------------------------------------------------------------------
 // Doc
 //----------------------------------------------------------------------------
@@ -35,6 +76,7 @@ public:
     // constructors and destructors
     Doc();
     virtual ~Doc();
+    virtual std::string GetClassName() const { return "Doc"; }
     virtual ClassId Is() const { return DOC; }
 
     virtual void AddChild(Object *object);
@@ -56,6 +98,43 @@ public:
     DocType GetType() const { return m_type; }
     void SetType(DocType type);
 
+    /**
+     * @name Setter and getter for allocating the objects of the document in an ObjectArena.
+     * The arena is active only when activated (e.g., when loading data in the Toolkit), and it is cleared
+     * when the document is reset. The setter resets the document.
+     */
+    ///@{
+    void SetUseArena(bool useArena);
+    ObjectArena *GetArena() const { return m_arena; }
+    ///@}
+
+    /**
+     * Getter for the pool of the strings shared by the objects of the document.
+     * It is cleared when the document is reset.
+     */
+    StringPool *GetStringPool() { return &m_stringPool; }
+
+    /**
+     * @name Getters for the resources (path and fonts) of the document.
+     * The resources are not changed when the document is reset.
+     */
+    ///@{
+    const Resources &GetResources() const { return m_resources; }
+    Resources &GetResourcesForModification()
+    {
+        m_scaledGlyphTables.clear();
+        m_scaledTextGlyphTables.clear();
+        return m_resources;
+    }
+    ///@}
+
+    /**
+     * Return a report of the memory taken by the objects of the document.
+     * For each ClassId, it gives the number of instances and the size allocated for them (sizeof).
+     * The memory held by their strings and vectors is not included.
+     */
+    std::string GetMemoryFootprint();
+
     /**
      * Check if the document has a page with the specified value
      */
@@ -194,6 +273,39 @@ public:
     double GetSpacingNonLinear() const { return m_drawingSpacingNonLinear; }
     ///@}
 
+    /**
+     * @name Methods for maintaining the uuid index of the document.
+     * The index is updated by Object::SetParent, Object::DetachChild, Object::Relinquish,
+     * Object::ClearChildren and Object::SetUuid for objects in the document tree, including when
+     * casting off or undoing it. By default, the object and its children are added / removed.
+     * Aligner objects are not part of the tree and are not indexed.
+     */
+    ///@{
+    void AddToUuidIndex(Object *object, bool recursive = true);
+    void RemoveFromUuidIndex(Object *object, bool recursive = true);
+    void ResetUuidIndex() { m_uuidIndex.clear(); }
+
+    /**
+     * Seed the generator of the uuids of the document.
+     * The generator is seeded again with the same value each time the document is reset, so the same uuids are
+     * generated for the same content. A seed of 0 uses the time.
+     */
+    void SeedUuid(unsigned int seed = 0);
+
+    /**
+     * Return the next number of the uuid generator of the document.
+     * Called by Object::GenerateUuid when the uuid of an object of the document is first needed.
+     */
+    uint64_t GenerateUuidNumber() { return m_uuidGenerator(); }
+    ///@}
+
+    /**
+     * Look for the object with the specified uuid in the index.
+     * Only objects that are (visible) descendants of the ancestor are returned (NULL if not found).
+     * See Object::FindChildByUuid
+     */
+    Object *FindInUuidIndex(const std::string &uuid, const Object *ancestor) const;
+
     /**
      * Export the document to a MIDI file.
      * Run trough all the layer and fill the midi file content.
@@ -294,6 +406,24 @@ private:
      */
     int CalcMusicFontSize();
 
+    /**
+     * @name Return the metrics of the music font or of the text font scaled for the staff or point size and the
+     * grace size. The tables are calculated on the first call and kept in m_scaledGlyphTables and
+     * m_scaledTextGlyphTables.
+     */
+    ///@{
+    const ScaledGlyphTable *GetScaledGlyphTable(int staffSize, bool graceSize) const;
+    const ScaledGlyphTable *GetScaledTextGlyphTable(int pointSize, bool graceSize) const;
+    ///@}
+
+    /**
+     * Process the Layer objects of a staff/layer partition (see Layer::PrepareProcessingLists) one after the other.
+     * This avoids processing the entire document with a filter for the staff and the layer @n.
+     * The filters are applied within the layers (e.g., for the verse @n)
+     */
+    void ProcessLayerPartition(ArrayOfObjects *layers, Functor *functor, FunctorParams *functorParams,
+        Functor *endFunctor = NULL, ArrayOfAttComparisons *filters = NULL);
+
 public:
     /**
      * A copy of the header tree stored as pugi::xml_document
@@ -375,6 +505,15 @@ private:
 
     /** Smufl font size (100 par defaut) */
     int m_drawingSmuflFontSize;
+    /**
+     * @name The glyph metrics of the current music font for each staff size and grace size used, and of the text
+     * font for each point size and grace size used. They are cleared when the font size is calculated in
+     * SetDrawingPage or when the resources are modified.
+     */
+    ///@{
+    mutable std::vector<ScaledGlyphTable> m_scaledGlyphTables;
+    mutable std::vector<ScaledGlyphTable> m_scaledTextGlyphTables;
+    ///@}
     /** Lyric font size  */
     int m_drawingLyricFontSize;
     /** Current music font */
@@ -420,6 +559,33 @@ private:
      * A score buffer for loading or creating a scoreBased MEI.
      */
     Score *m_scoreBuffer;
+
+    /**
+     * The index of the objects in the document tree by uuid.
+     * A multimap is used because we cannot assume uuids to be unique in the encoding.
+     */
+    MapOfUuidObjects m_uuidIndex;
+
+    /**
+     * The generator of the uuids and the value it is seeded with by Reset
+     */
+    std::mt19937_64 m_uuidGenerator;
+    unsigned int m_uuidSeed;
+
+    /**
+     * The strings shared by the objects of the document
+     */
+    StringPool m_stringPool;
+
+    /**
+     * The arena for the objects of the document (NULL if not used)
+     */
+    ObjectArena *m_arena;
+
+    /**
+     * The resource path and the fonts used by the document
+     */
+    Resources m_resources;
 };
 
 } // namespace vrv
@@ -45,7 +45,7 @@ public:
      */
     ///@{
     EditorialElement();
-    EditorialElement(std::string classid);
+    EditorialElement(const char *classid);
     virtual ~EditorialElement();
     virtual void Reset();
     virtual ClassId Is() const { return EDITORIAL_ELEMENT; }
@@ -32,7 +32,7 @@ public:
      */
     ///@{
     FloatingObject();
-    FloatingObject(std::string classid);
+    FloatingObject(const char *classid);
     virtual ~FloatingObject();
     virtual void Reset();
     virtual ClassId Is() const { return FLOATING_OBJECT; }
@@ -81,11 +81,6 @@ public:
      */
     virtual int FillStaffCurrentTimeSpanning(FunctorParams *functorParams);
 
-    /**
-     * See Object::PrepareTimePointing
-     */
-    virtual int PrepareTimePointing(FunctorParams *functorParams);
-
     /**
      * See Object::PrepareTimeSpanning
      */
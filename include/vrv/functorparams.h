@@ -252,6 +252,8 @@ public:
  * member 0: std::vector<double>: a stack of maximum duration filled by the functor
  * member 1: double: the duration of the current measure
  * member 2: the current bpm
+ * member 3: double: the onset of the current measure
+ * member 4: std::map<Measure *, double>: the onset of each measure
 **/
 
 class CalcMaxMeasureDurationParams : public FunctorParams {
@@ -260,10 +262,33 @@ public:
     {
         m_currentValue = 0.0;
         m_currentBpm = 120;
+        m_currentOnset = 0.0;
     }
     std::vector<double> m_maxValues;
     double m_currentValue;
     int m_currentBpm;
+    double m_currentOnset;
+    std::map<Measure *, double> m_measureOnsets;
+};
+
+//----------------------------------------------------------------------------
+// CalcMemoryFootprintParams
+//----------------------------------------------------------------------------
+
+/**
+ * member 0: std::map<ClassId, std::string>: the class name for each ClassId found
+ * member 1: std::map<ClassId, int>: the number of instances for each ClassId
+ * member 2: std::map<ClassId, size_t>: the allocated size of the instances for each ClassId
+ * member 3: a pointer to the functor for passing it to the aligners
+**/
+
+class CalcMemoryFootprintParams : public FunctorParams {
+public:
+    CalcMemoryFootprintParams(Functor *functor) { m_functor = functor; }
+    std::map<ClassId, std::string> m_classNames;
+    std::map<ClassId, int> m_counts;
+    std::map<ClassId, size_t> m_sizes;
+    Functor *m_functor;
 };
 
 //----------------------------------------------------------------------------
@@ -512,8 +537,8 @@ public:
  * member 0: MidiFile*: the MidiFile we are writing to
  * member 1: int*: the midi track number
  * member 2: int*: the current time in the measure (incremented by each element)
- * member 3: int*: the current total measure time (incremented by each measure
- * member 4: std::vector<double>: a stack of maximum duration filled by the functor
+ * member 3: int*: the current total measure time (set at each layer from the measure onsets)
+ * member 4: std::map<Measure *, double>: the onset of each measure filled by CalcMaxMeasureDuration
  * member 5: int* the semi tone transposition for the current track
  * member 6: int with the current bpm
 **/
@@ -533,7 +558,7 @@ public:
     int m_midiTrack;
     double m_currentMeasureTime;
     double m_totalTime;
-    std::vector<double> m_maxValues;
+    std::map<Measure *, double> m_measureOnsets;
     int m_transSemi;
     int m_currentBpm;
 };
@@ -732,14 +757,14 @@ public:
 
 /**
  * member 0: the IntTree* for staff/layer/verse
- * member 1: the IntTree* for staff/layer
+ * member 1: the MapOfLayerPartitions with the Layer objects of each staff/layer in document order
 **/
 
 class PrepareProcessingListsParams : public FunctorParams {
 public:
     PrepareProcessingListsParams() {}
     IntTree m_verseTree;
-    IntTree m_layerTree;
+    MapOfLayerPartitions m_layerPartitions;
 };
 
 //----------------------------------------------------------------------------
@@ -759,34 +784,20 @@ public:
     Chord *m_currentChord;
 };
 
-//----------------------------------------------------------------------------
-// PrepareTimePointingParams
-//----------------------------------------------------------------------------
-
-/**
- * member 0: std::vector< Object*>* that holds the current elements to match
- **/
-
-class PrepareTimePointingParams : public FunctorParams {
-public:
-    PrepareTimePointingParams() {}
-    ArrayOfPointingInterClassIdPairs m_timePointingInterfaces;
-};
-
 //----------------------------------------------------------------------------
 // PrepareTimeSpanningParams
 //----------------------------------------------------------------------------
 
 /**
- * member 0: std::vector< Object*>* that holds the current elements to match
- * member 1: bool* fillList for indicating whether the elements have to be stacked or not
+ * member 0: std::vector< Object*>* that holds the elements that could not be fully matched
+ * member 1: the doc in which the @startid and @endid are looked up
 **/
 
 class PrepareTimeSpanningParams : public FunctorParams {
 public:
-    PrepareTimeSpanningParams() { m_fillList = true; }
+    PrepareTimeSpanningParams(Doc *doc) { m_doc = doc; }
     ArrayOfSpanningInterClassIdPairs m_timeSpanningInterfaces;
-    bool m_fillList;
+    Doc *m_doc;
 };
 
 //----------------------------------------------------------------------------
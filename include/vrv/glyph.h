@@ -9,10 +9,17 @@
 #define __VRV_GLYPH_H__
 
 #include <algorithm>
+#include <assert.h>
 #include <string>
+#include <vector>
 
 namespace vrv {
 
+struct BuiltInGlyph;
+
+/** The value of the GlyphTable index for the codes without glyph */
+#define GLYPH_NONE -1
+
 /**
  * This class is used for storing a music font glyph.
  * All glyph values are integers. However, for keeping precision as high
@@ -32,11 +39,12 @@ public:
     Glyph();
     Glyph(std::string path, std::string codeStr);
     Glyph(int unitsPerEm);
+    Glyph(const BuiltInGlyph *builtInGlyph);
     virtual ~Glyph();
     ///@}
 
     /** Get the bounds of the glyph */
-    void GetBoundingBox(int *x, int *y, int *w, int *h);
+    void GetBoundingBox(int *x, int *y, int *w, int *h) const;
 
     /**
      * Set the bounds of the glyph
@@ -46,19 +54,22 @@ public:
     void SetBoundingBox(double x, double y, double w, double h);
 
     /** Get the units per EM */
-    int GetUnitsPerEm() { return m_unitsPerEm; }
+    int GetUnitsPerEm() const { return m_unitsPerEm; }
 
     /** Get the path */
-    std::string GetPath() { return m_path; }
+    std::string GetPath() const { return m_path; }
 
     /** Get the code string */
-    std::string GetCodeStr() { return m_codeStr; }
+    std::string GetCodeStr() const { return m_codeStr; }
+
+    /** Get the SVG symbol of a glyph compiled into Verovio (NULL when loaded from the path) */
+    const char *GetXML() const { return m_xml; }
 
     /**
      * @name Setter and getter for the horizAdvX
      */
     ///@{
-    int GetHorizAdvX() { return m_horizAdvX; }
+    int GetHorizAdvX() const { return m_horizAdvX; }
     void SetHorizAdvX(double horizAdvX) { m_horizAdvX = (int)(horizAdvX * 10.0); }
     ///@}
 
@@ -80,6 +91,136 @@ private:
     std::string m_path;
     /** The Unicode code in hexa as string */
     std::string m_codeStr;
+    /** The SVG symbol for the glyphs compiled into Verovio */
+    const char *m_xml;
+};
+
+//----------------------------------------------------------------------------
+// GlyphTable
+//----------------------------------------------------------------------------
+
+/**
+ * This class stores the glyphs of a font, keyed by their Unicode code.
+ * The glyphs are looked up through a flat array indexed by the offset of the code from the first one, which
+ * is compact since the SMuFL codes of a font (and the codes of the text font) are in a narrow range.
+ */
+class GlyphTable {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    GlyphTable();
+    virtual ~GlyphTable();
+    ///@}
+
+    /** Add the glyph for the code or replace the one already in the table */
+    void SetGlyph(wchar_t code, const Glyph &glyph);
+
+    /** Returns the glyph for the code (NULL if not in the table) */
+    const Glyph *GetGlyph(wchar_t code) const
+    {
+        int position = this->GetPosition(code);
+        return (position == GLYPH_NONE) ? NULL : &m_glyphs[position];
+    }
+    Glyph *GetGlyphForModification(wchar_t code) { return const_cast<Glyph *>(this->GetGlyph(code)); }
+
+    /**
+     * Returns the position of the glyph for the code in the table (GLYPH_NONE if not in the table).
+     * The positions go from 0 to GetCount() - 1 and can be used for indexing values stored for each glyph.
+     */
+    int GetPosition(wchar_t code) const
+    {
+        // Codes smaller than m_firstCode wrap around and are out of range too
+        unsigned int offset = (unsigned int)code - (unsigned int)m_firstCode;
+        if (offset >= m_index.size()) return GLYPH_NONE;
+        return m_index[offset];
+    }
+
+    /** Returns the glyph at a position */
+    const Glyph *GetGlyphAt(int position) const { return &m_glyphs.at(position); }
+
+    /** The number of glyphs in the table */
+    int GetCount() const { return (int)m_glyphs.size(); }
+
+private:
+    //
+public:
+    //
+private:
+    /** The code of the first entry of the index */
+    wchar_t m_firstCode;
+    /** The position in m_glyphs for each code from m_firstCode (GLYPH_NONE if none) */
+    std::vector<short> m_index;
+    /** The glyphs in the order they were added */
+    std::vector<Glyph> m_glyphs;
+};
+
+//----------------------------------------------------------------------------
+// ScaledGlyphTable
+//----------------------------------------------------------------------------
+
+/**
+ * This class stores the metrics of the glyphs of a GlyphTable scaled for a font size, a staff size and the grace
+ * size. The values are scaled in the same order and with the same integer divisions as when they are calculated
+ * for each call, so they are identical.
+ */
+class ScaledGlyphTable {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     * The grace ratio is applied only if graceSize is true.
+     */
+    ///@{
+    ScaledGlyphTable(
+        const GlyphTable *glyphTable, int fontSize, int staffSize, bool graceSize, int graceNum, int graceDen);
+    virtual ~ScaledGlyphTable();
+    ///@}
+
+    /** Check if the table holds the metrics for the font size, the staff size and the grace size */
+    bool IsScaledFor(int fontSize, int staffSize, bool graceSize) const
+    {
+        return ((m_fontSize == fontSize) && (m_staffSize == staffSize) && (m_graceSize == graceSize));
+    }
+
+    /**
+     * @name Getters for the scaled metrics of the glyph for the code.
+     * The glyph is expected to be in the table, but 0 is returned in release builds if it is not.
+     */
+    ///@{
+    int GetWidth(wchar_t code) const { return this->GetMetrics(code).m_width; }
+    int GetHeight(wchar_t code) const { return this->GetMetrics(code).m_height; }
+    int GetDescender(wchar_t code) const { return this->GetMetrics(code).m_descender; }
+    ///@}
+
+private:
+    /** The scaled metrics of a glyph */
+    struct ScaledGlyph {
+        int m_width;
+        int m_height;
+        int m_descender;
+    };
+
+    /** Return the metrics of the glyph, or zeroed ones if the glyph is missing */
+    const ScaledGlyph &GetMetrics(wchar_t code) const
+    {
+        static const ScaledGlyph none = { 0, 0, 0 };
+        int position = m_glyphTable->GetPosition(code);
+        assert(position != GLYPH_NONE);
+        if (position == GLYPH_NONE) return none;
+        return m_metrics[position];
+    }
+
+public:
+    //
+private:
+    /** The glyph table (not owned) and the values for which the metrics are scaled */
+    const GlyphTable *m_glyphTable;
+    int m_fontSize;
+    int m_staffSize;
+    bool m_graceSize;
+    /** The scaled metrics of each glyph, by position in the glyph table */
+    std::vector<ScaledGlyph> m_metrics;
 };
 
 } // namespace vrv
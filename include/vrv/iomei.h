@@ -263,7 +263,7 @@ private:
     ///@}
 
     /**
-     * Write unsupported attributes stored in Object::m_unsupported (not tested)
+     * Write unsupported attributes stored in the object (see Object::GetUnsupported) (not tested)
      */
     void WriteUnsupportedAttr(pugi::xml_node currentNode, Object *object);
 
@@ -503,7 +503,7 @@ private:
     ///@}
 
     /**
-     * Write unsupported attributes and store them in Object::m_unsupported (not tested)
+     * Read unsupported attributes and store them in the object, interned in the StringPool of the Doc (not tested)
      */
     void ReadUnsupportedAttr(pugi::xml_node element, Object *object);
 
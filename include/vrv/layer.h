@@ -154,6 +154,11 @@ public:
      */
     virtual int PrepareRpt(FunctorParams *functorParams);
 
+    /**
+     * See Object::GenerateMIDI
+     */
+    virtual int GenerateMIDI(FunctorParams *functorParams);
+
     /**
      * See Object::CalcMaxMeasureDuration
      */
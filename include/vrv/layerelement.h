@@ -36,7 +36,7 @@ public:
      */
     ///@{
     LayerElement();
-    LayerElement(std::string classid);
+    LayerElement(const char *classid);
     virtual ~LayerElement();
     virtual void Reset();
     virtual ClassId Is() const { return LAYER_ELEMENT; }
@@ -128,16 +128,6 @@ public:
      */
     virtual int AlignHorizontally(FunctorParams *functorParams);
 
-    /**
-     * See Object::PrepareTimePointing
-     */
-    virtual int PrepareTimePointing(FunctorParams *functorParams);
-
-    /**
-     * See Object::PrepareTimeSpanning
-     */
-    virtual int PrepareTimeSpanning(FunctorParams *functorParams);
-
     /**
      * See Object::SetDrawingXY
      */
@@ -155,6 +155,12 @@ public:
      */
     virtual int ConvertToPageBased(FunctorParams *functorParams);
 
+    /**
+     * See Object::CalcMemoryFootprint
+     * Also passes the functor to the measure and timestamp aligners.
+     */
+    virtual int CalcMemoryFootprint(FunctorParams *functorParams);
+
     /**
      * See Object::Save
      */
@@ -247,29 +253,11 @@ public:
      */
     virtual int PrepareFloatingGrps(FunctorParams *functoParams);
 
-    /**
-     * See Object::PrepareTimePointingEnd
-     */
-    virtual int PrepareTimePointingEnd(FunctorParams *functorParams);
-
-    /**
-     * See Object::PrepareTimeSpanningEnd
-     */
-    virtual int PrepareTimeSpanningEnd(FunctorParams *functorParams);
-
     /**
      * See Object::PrepareBoundaries
      */
     virtual int PrepareBoundaries(FunctorParams *functorParams);
 
-    /**
-     * @name See Object::GenerateMIDI
-     */
-    ///@{
-    virtual int GenerateMIDI(FunctorParams *functorParams);
-    virtual int GenerateMIDIEnd(FunctorParams *functorParams);
-    ///@}
-
     /**
      * See Object::CalcMaxMeasureDuration
      */
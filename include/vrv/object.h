@@ -27,7 +27,9 @@ class DurationInterface;
 class EditorialElement;
 class FileOutputStream;
 class Functor;
+class FunctorGroup;
 class FunctorParams;
+class ObjectArena;
 class PitchInterface;
 class PositionInterface;
 class ScoreDefInterface;
@@ -65,6 +67,40 @@ typedef std::map<int, LayerN_VerserN_t> StaffN_LayerN_VerseN_t;
 #define FORWARD true
 #define BACKWARD false
 
+/** The maximum number of functors in a FunctorGroup (bits of an unsigned int) **/
+#define MAX_FUNCTOR_GROUP_SIZE 32
+
+// The number of digits following the classid in generated uuids
+#define UUID_DIGITS 15
+
+//----------------------------------------------------------------------------
+// ObjectRareMembers
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds the members of an Object that are set only for a few objects.
+ * It is allocated when one of them is set so the other objects do not have to carry them.
+ */
+class ObjectRareMembers {
+public:
+    /**
+     * A string for storing additional classes to be added to the SVG element
+     */
+    std::string m_svgclass;
+
+    /**
+     * A string for storing a comment to be printed immediately before
+     * the object when printing an MEI element.
+     */
+    std::string m_comment;
+
+    /**
+     * The unsupported attributes kept for writing back data.
+     * The names and values are interned in the StringPool of the Doc.
+     */
+    ArrayOfPooledStrAttr m_unsupported;
+};
+
 //----------------------------------------------------------------------------
 // Object
 //----------------------------------------------------------------------------
@@ -80,12 +116,28 @@ public:
      */
     ///@{
     Object();
-    Object(std::string classid);
+    Object(const char *classid);
     virtual ~Object();
     virtual ClassId Is() const;
     virtual std::string GetClassName() const { return "[MISSING]"; }
     ///@}
 
+    /**
+     * @name Allocation of all the objects
+     * The memory is taken from the active ObjectArena (if any) or from the heap otherwise.
+     * Deleting an object allocated in an arena does not free its memory.
+     */
+    ///@{
+    static void *operator new(size_t size);
+    static void operator delete(void *ptr);
+
+    /**
+     * Return the size of the object as allocated with Object::operator new.
+     * Return 0 for an object that is a member of another one (e.g., an aligner of a Measure) or on the stack.
+     */
+    size_t GetAllocatedSize() const;
+    ///@}
+
     /**
      * Wrapper for checking if an element is a floating object (system elements and control elements)
      */
@@ -112,18 +164,13 @@ public:
 
     /**
      * @name Methods for registering a MEI att class and for registering interfaces regrouping MEI att classes.
+     * The registration is made in the constructors and is stored once per ClassId and not in each object.
      */
     ///@{
-    void RegisterAttClass(AttClassId attClassId) { m_attClasses.push_back(attClassId); }
-    bool HasAttClass(AttClassId attClassId) const
-    {
-        return std::find(m_attClasses.begin(), m_attClasses.end(), attClassId) != m_attClasses.end();
-    }
-    void RegisterInterface(std::vector<AttClassId> *attClasses, InterfaceId interfaceId);
-    bool HasInterface(InterfaceId interfaceId) const
-    {
-        return std::find(m_interfaces.begin(), m_interfaces.end(), interfaceId) != m_interfaces.end();
-    }
+    void RegisterAttClass(AttClassId attClassId);
+    bool HasAttClass(AttClassId attClassId) const { return s_attClasses[m_registeredClassId].Test(attClassId); }
+    void RegisterInterface(const AttClassSet *attClasses, InterfaceId interfaceId);
+    bool HasInterface(InterfaceId interfaceId) const { return s_interfaces[m_registeredClassId].Test(interfaceId); }
     ///@}
 
     virtual DurationInterface *GetDurationInterface() { return NULL; }
@@ -177,19 +224,43 @@ public:
      */
     virtual Object *Clone() const;
 
-    std::string GetUuid() const { return m_uuid; }
+    /**
+     * @name Getter and setters for the uuid.
+     * The uuid is generated on the first call to GetUuid if it was not set before. It is generated by the Doc
+     * the object belongs to (see Doc::SeedUuid) or by the generator of the thread if the object is not in a Doc.
+     * ResetUuid clears it so that a new one is generated.
+     */
+    ///@{
+    const std::string &GetUuid() const
+    {
+        if (m_uuid.empty()) this->GenerateUuid();
+        return m_uuid;
+    }
+    bool HasUuid() const { return !m_uuid.empty(); }
     void SetUuid(std::string uuid);
     void ResetUuid();
+    ///@}
+
+    /** Seed the uuid generator of the calling thread (with the time and the thread if seed is 0) */
     static void SeedUuid(unsigned int seed = 0);
 
     void SetSVGClass(const std::string &classcontent);
     void AddSVGClass(const std::string &classname);
-    std::string GetSVGClass(void);
-    bool HasSVGClass(void);
+    std::string GetSVGClass(void) const;
+    bool HasSVGClass(void) const;
+
+    std::string GetComment() const;
+    void SetComment(std::string comment);
+    bool HasComment(void) const;
 
-    std::string GetComment() const { return m_comment; }
-    void SetComment(std::string comment) { m_comment = comment; }
-    bool HasComment(void) { return !m_comment.empty(); }
+    /**
+     * @name Getter and setter for the unsupported attributes.
+     * The names and values have to be interned in the StringPool of the Doc (see MeiInput::ReadUnsupportedAttr).
+     */
+    ///@{
+    const ArrayOfPooledStrAttr *GetUnsupported() const;
+    void AddUnsupported(const std::string *name, const std::string *value);
+    ///@}
 
     /**
      * @name Children count, with or without a ClassId.
@@ -248,6 +319,7 @@ public:
 
     /**
      * Return the index position of the object in its parent (-1 if not found)
+     * The position is cached and is looked for in the parent only when the cached value is not valid anymore.
      */
     int GetIdx() const;
 
@@ -269,9 +341,10 @@ public:
 
     /**
      * Look for a child with the specified uuid (returns NULL if not found)
-     * This method is a wrapper for the Object::FindByUuid functor.
+     * When the object belongs to a Doc and no depth limit is given, the uuid index of the Doc is used.
+     * Otherwise, this method is a wrapper for the Object::FindByUuid functor.
      */
-    Object *FindChildByUuid(std::string uuid, int deepness = UNLIMITED_DEPTH, bool direction = FORWARD);
+    Object *FindChildByUuid(const std::string &uuid, int deepness = UNLIMITED_DEPTH, bool direction = FORWARD);
 
     /**
      * Look for a child with the specified type (returns NULL if not found)
@@ -373,10 +446,22 @@ public:
      * This is the generic way for parsing the tree, e.g., for extracting one single staff or layer.
      * Deepness specifies how many child levels should be processed. UNLIMITED_DEPTH means no
      * limit (EditorialElement objects do not count).
+     * The tree is traversed iteratively with an explicit stack, so processing it BACKWARD does not
+     * require copying the children of each object.
      */
     virtual void Process(Functor *functor, FunctorParams *functorParams, Functor *endFunctor = NULL,
         ArrayOfAttComparisons *filters = NULL, int deepness = UNLIMITED_DEPTH, bool direction = FORWARD);
 
+    /**
+     * Process all the functors of a FunctorGroup in a single traversal of the tree.
+     * For each object, the functors are called in the order they were added to the group, and so are
+     * the end functors after the children. Each functor keeps its own return code, which means that
+     * FUNCTOR_SIBLINGS and FUNCTOR_STOP only apply to the functor returning it.
+     * The functors grouped together must not depend on another one of the group having processed
+     * the entire tree. Filters are not supported.
+     */
+    void Process(FunctorGroup *functorGroup, int deepness = UNLIMITED_DEPTH, bool direction = FORWARD);
+
     //----------//
     // Functors //
     //----------//
@@ -386,6 +471,12 @@ public:
      */
     virtual int AddLayerElementToFlatList(FunctorParams *functorParams);
 
+    /**
+     * Count the instances and the allocated size of the objects for each ClassId.
+     * See Doc::GetMemoryFootprint
+     */
+    virtual int CalcMemoryFootprint(FunctorParams *functorParams);
+
     /**
      * @name Functors for finding objects
      */
@@ -611,23 +702,18 @@ public:
     ///@{
 
     /**
-     * Builds a tree of ints (IntTree) with the staff/layer/verse numbers and for staff/layer to be then processed.
+     * Builds a tree of ints (IntTree) with the staff/layer/verse numbers and the partition of the Layer objects
+     * by staff/layer to be then processed.
      */
     virtual int PrepareProcessingLists(FunctorParams *functorParams) { return FUNCTOR_CONTINUE; }
 
     /**
-     * Match start for TimePointingInterface elements (such as fermata or harm).
-     */
-    virtual int PrepareTimePointing(FunctorParams *functorParams) { return FUNCTOR_CONTINUE; }
-    virtual int PrepareTimePointingEnd(FunctorParams *functorParams) { return FUNCTOR_CONTINUE; }
-
-    /**
-     * Match start and end for TimeSpanningInterface elements (such as tie or slur).
-     * If fillList is set to false, only the remaining elements will be matched.
-     * This is used when processing a second time in the other direction
+     * Match start and end for TimeSpanningInterface elements (such as tie or slur) and start for
+     * TimePointInterface elements (such as fermata or tempo).
+     * The @startid and @endid are looked up directly in the uuid index of the Doc.
+     * The elements that could not be fully matched are kept in the list for PrepareTimestamps.
      */
     virtual int PrepareTimeSpanning(FunctorParams *functorParams) { return FUNCTOR_CONTINUE; }
-    virtual int PrepareTimeSpanningEnd(FunctorParams *functorParams) { return FUNCTOR_CONTINUE; }
 
     /**
      * Match start and end for TimeSpanningInterface elements with tstamp(2) attributes.
@@ -655,7 +741,7 @@ public:
 
     /**
      * Set wordpos and connector ends
-     * The functor is processed by staff/layer/verse using an ArrayOfAttComparisons filter.
+     * The functor is processed by staff/layer partition using an ArrayOfAttComparisons filter for the verse.
      * At the end, the functor is processed by doc at the end of a document of closing opened syl.
      */
     virtual int PrepareLyrics(FunctorParams *functorParams) { return FUNCTOR_CONTINUE; }
@@ -669,7 +755,7 @@ public:
 
     /**
      * Functor for setting mRpt drawing numbers (if required)
-     * The functor is processed by staff/layer using an ArrayOfAttComparisons filter.
+     * The functor is processed by staff/layer partition.
      */
     virtual int PrepareRpt(FunctorParams *functorParams) { return FUNCTOR_CONTINUE; }
 
@@ -757,6 +843,7 @@ public:
 
     /**
      * Export the object to a MidiFile
+     * The functor is processed by staff/layer partition.
      */
     virtual int GenerateMIDI(FunctorParams *functorParams) { return FUNCTOR_CONTINUE; }
     virtual int GenerateMIDIEnd(FunctorParams *functorParams) { return FUNCTOR_CONTINUE; }
@@ -775,64 +862,110 @@ protected:
     void ClearChildren();
 
 private:
-    void GenerateUuid();
-    void Init(std::string);
+    void GenerateUuid() const;
+    void Init(const char *classid);
+
+    /**
+     * Return the Doc at the root of the tree the object belongs to (NULL if none).
+     * This is the Doc maintaining the uuid index of the object.
+     */
+    Doc *GetUuidIndexDoc() const;
 
-public:
     /**
-     * Keep an array of unsupported attributes as pairs.
-     * This can be used for writing back data
+     * Set the cached index of all the children (see Object::GetIdx).
+     * Relinquished children are ignored since they might already be cached in another parent.
      */
-    ArrayOfStrAttr m_unsupported;
+    void UpdateChildIdxCache();
 
+    /**
+     * Set m_registeredClassId to the ClassId of the constructor being run (if necessary).
+     * The registrations made by the constructors of the parent classes are added to the ones of the ClassId.
+     */
+    void UpdateRegisteredClassId();
+
+    /**
+     * Set m_isAllocated by looking at the last memory returned by Object::operator new.
+     * Called from the constructors.
+     */
+    void InitAllocation();
+
+    /**
+     * Return the rare members of the object, creating them if necessary.
+     */
+    ObjectRareMembers *GetRareMembers();
+
+    /**
+     * Recursive method for Process(FunctorGroup *) with a bit mask of the functors processing the object.
+     */
+    void ProcessGroup(FunctorGroup *functorGroup, unsigned int active, int deepness, bool direction);
+
+public:
     Object *m_parent;
 
 protected:
     ArrayOfObjects m_children;
 
 private:
-    std::string m_uuid;
-    std::string m_classid;
-    std::string m_svgclass;
-    static unsigned long s_objectCounter;
+    /** The uuid - empty as long as it is not set or generated */
+    mutable std::string m_uuid;
+    /** The prefix of the generated uuids - a string literal given by the constructor of each class */
+    const char *m_classid;
 
     /**
-     * Indicates whether the object content is up-to-date or not.
-     * This is useful for object using sub-lists of objects when drawing.
-     * For example, Beam has a list of children notes and this value indicates if the
-     * list needs to be updated or not. Is is mostly an optimization feature.
+     * The members set only for a few objects (SVG class, comment, unsupported attributes).
+     * NULL as long as none of them is set.
      */
-    mutable bool m_isModified;
+    ObjectRareMembers *m_rareMembers;
 
     /**
-     * Members used for caching iterator values.
-     * See Object::IterGetFirst, Object::IterGetNext and Object::IterIsNotEnd
-     * Values are set when GetFirst is called (which is mandatory)
+     * The index of the object in the children of its parent when last known.
+     * It is set when the object is added or inserted and checked in Object::GetIdx.
      */
-    ArrayOfObjects::iterator m_iteratorEnd, m_iteratorCurrent;
-    ClassId m_iteratorElementType;
+    mutable int m_idxCache;
 
     /**
-     * A vector for storing the list of AttClassId (MEI att classes) implemented.
+     * Members used for caching iterator values.
+     * See Object::GetFirst and Object::GetNext
+     * Values are set when GetFirst is called (which is mandatory)
+     * The position is kept as an index in the children since it takes less space than iterators.
      */
-    std::vector<AttClassId> m_attClasses;
+    int m_iteratorIdx;
+    ClassId m_iteratorElementType;
 
     /**
-     * A vector for storing the list of InterfaceId (group of MEI att classes) implemented.
+     * The ClassId under which the MEI att classes and the interfaces of the object are registered.
+     * This is the last class in the hierarchy with a constructor registering some.
      */
-    std::vector<InterfaceId> m_interfaces;
+    ClassId m_registeredClassId;
 
     /**
-     * A string for storing a comment to be printed immediately before
-     * the object when printing an MEI element.
+     * Indicates whether the object content is up-to-date or not.
+     * This is useful for object using sub-lists of objects when drawing.
+     * For example, Beam has a list of children notes and this value indicates if the
+     * list needs to be updated or not. Is is mostly an optimization feature.
      */
-    std::string m_comment;
+    mutable bool m_isModified;
 
     /**
      * A flag indicating if the Object represents an attribute in the original MEI.
      * For example, a Artic child in Note for an original @artic
      */
     bool m_isAttribute;
+
+    /**
+     * A flag indicating if the object was created with Object::operator new.
+     * In that case its allocation header can be read (see Object::GetAllocatedSize).
+     */
+    bool m_isAllocated;
+
+    /**
+     * @name The MEI att classes (AttClassId) and the interfaces (InterfaceId) implemented by each ClassId.
+     * The registrations of the parent classes are included.
+     */
+    ///@{
+    static AttClassSet s_attClasses[UNSPECIFIED + 1];
+    static InterfaceSet s_interfaces[UNSPECIFIED + 1];
+    ///@}
 };
 
 //----------------------------------------------------------------------------
@@ -977,6 +1110,106 @@ public:
 private:
 };
 
+//----------------------------------------------------------------------------
+// FunctorGroup
+//----------------------------------------------------------------------------
+
+/**
+ * This class groups functors, with their params and end functors, for processing them in a single
+ * traversal of the tree. See Object::Process(FunctorGroup *, int, bool)
+ * A group can hold up to MAX_FUNCTOR_GROUP_SIZE functors.
+ */
+class FunctorGroup {
+public:
+    FunctorGroup() {}
+    virtual ~FunctorGroup(){};
+
+    /**
+     * Add a functor with its params and (optionally) its end functor to the group.
+     */
+    void Add(Functor *functor, FunctorParams *functorParams, Functor *endFunctor = NULL);
+
+    /**
+     * Return the number of functors in the group
+     */
+    int GetCount() const { return (int)m_functors.size(); }
+
+private:
+    //
+public:
+    /**
+     * @name The functors, their params and their end functors (NULL if none)
+     */
+    ///@{
+    std::vector<Functor *> m_functors;
+    std::vector<FunctorParams *> m_functorParams;
+    std::vector<Functor *> m_endFunctors;
+    ///@}
+
+private:
+};
+
+//----------------------------------------------------------------------------
+// ObjectArena
+//----------------------------------------------------------------------------
+
+/** The size of the blocks of memory allocated by an ObjectArena **/
+#define OBJECT_ARENA_BLOCK_SIZE 262144
+
+/**
+ * This class is an arena from which objects are allocated (see Object::operator new).
+ * The memory is taken from large blocks and is released all at once when the arena is cleared.
+ * An arena is typically owned by a Doc and cleared in Doc::Reset (see Doc::SetUseArena).
+ * All the objects allocated in the arena have to be deleted before it is cleared.
+ */
+class ObjectArena {
+public:
+    ObjectArena();
+    virtual ~ObjectArena();
+
+    /**
+     * Allocate size bytes in the arena.
+     */
+    void *Allocate(size_t size);
+
+    /**
+     * Release all the memory of the arena.
+     */
+    void Clear();
+
+    /**
+     * @name Activate (or deactivate) the arena.
+     * The objects created while an arena is active are allocated in it.
+     * Only one arena can be active at the time.
+     */
+    ///@{
+    void Activate();
+    static void Deactivate();
+    static ObjectArena *GetActive() { return s_active; }
+    ///@}
+
+    /**
+     * @name Getters for the number of allocations and the bytes allocated since the arena was cleared
+     */
+    ///@{
+    int GetAllocationCount() const { return m_allocationCount; }
+    size_t GetAllocatedSize() const { return m_allocatedSize; }
+    ///@}
+
+private:
+    //
+public:
+    //
+private:
+    std::vector<char *> m_blocks;
+    char *m_current;
+    size_t m_remaining;
+    int m_allocationCount;
+    size_t m_allocatedSize;
+
+    static thread_local ObjectArena *s_active;
+};
+
 //----------------------------------------------------------------------------
 // ObjectComparison
 //----------------------------------------------------------------------------
@@ -14,6 +14,7 @@
 namespace vrv {
 
 class DeviceContext;
+class DisplayListDeviceContext;
 class Staff;
 class System;
 
@@ -101,6 +102,16 @@ public:
      */
     int GetContentWidth() const;
 
+    /**
+     * @name Get, set and reset the display list in which the drawing of the page is kept.
+     * The page owns the display list, which is deleted when reset or when the page is laid out again.
+     */
+    ///@{
+    DisplayListDeviceContext *GetDisplayList() const { return m_displayList; }
+    void SetDisplayList(DisplayListDeviceContext *displayList);
+    void ResetDisplayList();
+    ///@}
+
     //----------//
     // Functors //
     //----------//
@@ -139,6 +150,12 @@ private:
      * the force parameter is set.
      */
     bool m_layoutDone;
+
+    /**
+     * The drawing of the page as kept by the Toolkit when caching the drawing is enabled.
+     * NULL when the page has not been drawn or has been changed since.
+     */
+    DisplayListDeviceContext *m_displayList;
 };
 
 } // namespace vrv
@@ -27,6 +27,7 @@ public:
     // constructors and destructors
     Score();
     virtual ~Score();
+    virtual std::string GetClassName() const { return "Score"; }
     virtual ClassId Is() const { return SCORE; }
 
     virtual void AddChild(Object *object);
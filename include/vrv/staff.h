@@ -103,9 +103,9 @@ public:
     virtual int SetDrawingXY(FunctorParams *functorParams);
 
     /**
-     * See Object::PrepareRpt
+     * See Object::PrepareTimeSpanning
      */
-    virtual int PrepareRpt(FunctorParams *functorParams);
+    virtual int PrepareTimeSpanning(FunctorParams *functorParams);
 
 public:
     /**
@@ -11,8 +11,13 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 //----------------------------------------------------------------------------
@@ -25,6 +30,8 @@
 
 namespace vrv {
 
+class Glyph;
+
 //----------------------------------------------------------------------------
 // BBoxDeviceContext
 //----------------------------------------------------------------------------
@@ -71,6 +78,47 @@ public:
      */
     std::string GetStringSVG(bool xml_declaration = false);
 
+    /**
+     * @name Set and get the compact output.
+     * In compact mode, the SVG is written without indentation, the size of the glyphs is set once per glyph and size
+     * in the <defs>, the staff lines are merged and the numbers and colours are written with fewer characters.
+     * It has to be set before drawing.
+     */
+    ///@{
+    void SetCompact(bool compact) { m_compact = compact; }
+    bool GetCompact() const { return m_compact; }
+    ///@}
+
+    /**
+     * @name Set and get the href of an external glyph sprite (e.g., "sprite.svg").
+     * When set, the glyphs are referenced in it (e.g., "sprite.svg#E0A4") and their <defs> are not written.
+     * It has to be set before drawing.
+     */
+    ///@{
+    void SetGlyphSprite(const std::string &href) { m_glyphSprite = href; }
+    std::string GetGlyphSprite() const { return m_glyphSprite; }
+    ///@}
+
+    /**
+     * Return the glyphs used so far, in the order of first use
+     */
+    const std::vector<const Glyph *> &GetGlyphs() const { return m_smufl_glyphs; }
+
+    /**
+     * Return an SVG document with the <defs> of the glyphs, to be used as an external glyph sprite
+     */
+    static std::string GetStringGlyphSprite(const std::vector<const Glyph *> &glyphs, bool xml_declaration = false);
+
+    /**
+     * @name Return the <defs> content of a glyph and the woff VerovioText font of a resource path.
+     * They are parsed once per process and shared read-only by all instances, so Commit does not read or parse any
+     * file. They are also used by the SvgStreamDeviceContext.
+     */
+    ///@{
+    static const pugi::xml_document *GetGlyphDefs(const Glyph *glyph);
+    static const pugi::xml_document *GetWoff(const std::string &path);
+    ///@}
+
     /**
      * @name Drawing methods
      */
@@ -88,6 +136,7 @@ public:
     virtual void DrawMusicText(const std::wstring &text, int x, int y);
     virtual void DrawSpline(int n, Point points[]);
     virtual void DrawBackgroundImage(int x = 0, int y = 0);
+    virtual void DrawLines(int n, Point points[]);
     ///@}
 
     /**
@@ -106,7 +155,7 @@ public:
      * @name Method for starting and ending a graphic
      */
     ///@{
-    virtual void StartGraphic(Object *object, std::string gClass, std::string gId);
+    virtual void StartGraphic(Object *object, const std::string &gClass, const std::string &gId);
     virtual void EndGraphic(Object *object, View *view);
     ///@}
 
@@ -114,7 +163,7 @@ public:
      * @name Methods for re-starting and ending a graphic for objects drawn in separate steps
      */
     ///@{
-    virtual void ResumeGraphic(Object *object, std::string gId);
+    virtual void ResumeGraphic(Object *object, const std::string &gId);
     virtual void EndResumedGraphic(Object *object, View *view);
     ///@}
 
@@ -122,7 +171,7 @@ public:
      * @name Method for starting and ending a text (<tspan>) text graphic.
      */
     ///@{
-    virtual void StartTextGraphic(Object *object, std::string gClass, std::string gId);
+    virtual void StartTextGraphic(Object *object, const std::string &gClass, const std::string &gId);
     virtual void EndTextGraphic(Object *object, View *view);
     ///@}
 
@@ -180,19 +229,44 @@ private:
     std::ostringstream m_outdata;
 
     bool m_committed; // did we flushed the file?
+    bool m_compact;
+    std::string m_glyphSprite;
     int m_width, m_height;
     int m_originX, m_originY;
     double m_userScaleX, m_userScaleY;
 
-    // holds the list of glyphs from the smufl font used so far
+    // holds the list of glyphs from the smufl font used so far (in the order of first use)
     // they will be added at the end of the file as <defs>
-    std::vector<std::string> m_smufl_glyphs;
+    std::vector<const Glyph *> m_smufl_glyphs;
+    // the same glyphs as a set for checking if they are already in the list
+    std::unordered_set<const Glyph *> m_smuflGlyphSet;
+    // in compact mode, the glyphs with the sizes they are used with (in the order of first use)
+    // each pair is added to the <defs> as a <use> with the size
+    std::vector<std::pair<const Glyph *, int> > m_sizedGlyphs;
+    std::set<std::pair<const Glyph *, int> > m_sizedGlyphSet;
 
     // pugixml data
     pugi::xml_document m_svgDoc;
     pugi::xml_node m_svgNode;
     pugi::xml_node m_currentNode;
     std::list<pugi::xml_node> m_svgNodeStack;
+
+    /**
+     * The first <g> started for each object with its uuid as id, for resuming it without searching the document.
+     * The keys point to the uuid of the objects, which remain unchanged while the page is drawn.
+     */
+    std::unordered_map<const std::string *, pugi::xml_node, StrPtrHash, StrPtrEqual> m_graphicNodes;
+
+    /**
+     * @name The parsed glyph <defs> (keyed by glyph) and woff fonts (keyed by resource path) shared by all instances.
+     * The glyphs of the shared glyph tables are never deleted, so they can be used as keys.
+     * Entries are never modified once inserted.
+     */
+    ///@{
+    static std::mutex s_defsMutex;
+    static std::map<const Glyph *, pugi::xml_document> s_glyphDefs;
+    static std::map<std::string, pugi::xml_document> s_woffs;
+    ///@}
 };
 
 } // namespace vrv
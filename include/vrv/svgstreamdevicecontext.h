@@ -0,0 +1,234 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        svgstreamdevicecontext.h
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_SVG_STREAM_DC_H__
+#define __VRV_SVG_STREAM_DC_H__
+
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "devicecontext.h"
+
+namespace vrv {
+
+class Glyph;
+
+//----------------------------------------------------------------------------
+// SvgStreamDeviceContext
+//----------------------------------------------------------------------------
+
+/**
+ * This class implements a drawing context writing SVG directly to a stream as the page is drawn, without building an
+ * XML document as the SvgDeviceContext does. Each element is written once it is drawn, and only the open start tag is
+ * kept until its content is known. The output is buffered and flushed to the stream by blocks.
+ * The SVG is equivalent to the one of the SvgDeviceContext with the same indentation, but:
+ *  - the <defs> with the glyphs and the VerovioText woff are written at the end of the <svg>, because they are known
+ *    only once the page is drawn;
+ *  - the elements are written in the order they are drawn;
+ *  - a resumed graphic is written as a new <g> with the same class but no id, because the original one is already
+ *    written.
+ */
+class SvgStreamDeviceContext : public DeviceContext {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     * The stream has to remain valid until Commit is called.
+     */
+    ///@{
+    SvgStreamDeviceContext(std::ostream *output, int width, int height, bool xml_declaration = false);
+    virtual ~SvgStreamDeviceContext();
+    virtual ClassId Is() const { return SVG_STREAM_DEVICE_CONTEXT; }
+    ///@}
+
+    /**
+     * @name Setters
+     */
+    ///@{
+    virtual void SetBackground(int colour, int style = AxSOLID);
+    virtual void SetBackgroundImage(void *image, double opacity = 1.0);
+    virtual void SetBackgroundMode(int mode);
+    virtual void SetTextForeground(int colour);
+    virtual void SetTextBackground(int colour);
+    virtual void SetLogicalOrigin(int x, int y);
+    virtual void SetUserScale(double xScale, double yScale);
+    ///@}
+
+    /**
+     * @name Getters
+     */
+    ///@{
+    virtual Point GetLogicalOrigin();
+    ///}
+
+    /**
+     * Write the <defs> and the end of the SVG and flush the buffer to the stream.
+     * Nothing can be drawn afterwards. Called by the destructor if necessary.
+     */
+    void Commit();
+
+    /**
+     * @name Drawing methods
+     */
+    ///@{
+    virtual void DrawComplexBezierPath(Point bezier1[4], Point bezier2[4]);
+    virtual void DrawCircle(int x, int y, int radius);
+    virtual void DrawEllipse(int x, int y, int width, int height);
+    virtual void DrawEllipticArc(int x, int y, int width, int height, double start, double end);
+    virtual void DrawLine(int x1, int y1, int x2, int y2);
+    virtual void DrawPolygon(int n, Point points[], int xoffset, int yoffset, int fill_style = AxODDEVEN_RULE);
+    virtual void DrawRectangle(int x, int y, int width, int height);
+    virtual void DrawRotatedText(const std::string &text, int x, int y, double angle);
+    virtual void DrawRoundedRectangle(int x, int y, int width, int height, double radius);
+    virtual void DrawText(const std::string &text, const std::wstring wtext = L"");
+    virtual void DrawMusicText(const std::wstring &text, int x, int y);
+    virtual void DrawSpline(int n, Point points[]);
+    virtual void DrawBackgroundImage(int x = 0, int y = 0);
+    ///@}
+
+    /**
+     * @name Method for starting and ending a text
+     */
+    ///@{
+    virtual void StartText(int x, int y, char alignement = LEFT);
+    virtual void EndText();
+
+    /**
+     * Move a text to the specified position, for example when starting a new line.
+     * This is possible only before any content of the text is drawn.
+     */
+    virtual void MoveTextTo(int x, int y);
+
+    /**
+     * @name Method for starting and ending a graphic
+     */
+    ///@{
+    virtual void StartGraphic(Object *object, const std::string &gClass, const std::string &gId);
+    virtual void EndGraphic(Object *object, View *view);
+    ///@}
+
+    /**
+     * @name Methods for re-starting and ending a graphic for objects drawn in separate steps
+     */
+    ///@{
+    virtual void ResumeGraphic(Object *object, const std::string &gId);
+    virtual void EndResumedGraphic(Object *object, View *view);
+    ///@}
+
+    /**
+     * @name Method for starting and ending a text (<tspan>) text graphic.
+     */
+    ///@{
+    virtual void StartTextGraphic(Object *object, const std::string &gClass, const std::string &gId);
+    virtual void EndTextGraphic(Object *object, View *view);
+    ///@}
+
+    /**
+     * @name Method for starting and ending page
+     */
+    ///@{
+    virtual void StartPage();
+    virtual void EndPage();
+    ///@}
+
+private:
+    /**
+     * @name Return the serialized <defs> content of a glyph and woff VerovioText font of a resource path.
+     * They are serialized once per process from the documents parsed by the SvgDeviceContext.
+     */
+    ///@{
+    static const std::string &GetGlyphDefs(const Glyph *glyph);
+    static const std::string &GetWoff(const std::string &path);
+    ///@}
+
+    /**
+     * Internal method for drawing debug SVG bounding box
+     */
+    void DrawSvgBoundingBox(Object *object, View *view);
+
+    /**
+     * Write the <svg> start tag if not done yet, with the size according to the current user scale.
+     */
+    void StartSvg();
+
+    /**
+     * @name Start and end an element.
+     * The attributes have to be appended to m_buffer after StartElement and before anything else is started.
+     * An element without content is written as an empty element.
+     */
+    ///@{
+    void StartElement(const char *name);
+    void EndElement();
+    ///@}
+
+    /**
+     * Start an element with the class of the object and the class of the graphic (<g> and <tspan>)
+     */
+    void StartObjectElement(const char *name, Object *object, const std::string &gClass, bool svgClass);
+
+    /**
+     * Write the buffer to the stream if it is full (or always with force)
+     */
+    void Flush(bool force = false);
+
+    /**
+     * Change the flag for indicating the use of the VerovioText font
+     */
+    void VrvTextFont() { m_vrvTextFont = true; }
+
+    void AppendColour(int colour);
+
+public:
+    //
+private:
+    /** The output stream and the buffer written to it */
+    std::ostream *m_output;
+    std::string m_buffer;
+
+    bool m_xmlDeclaration;
+    bool m_svgStarted;
+    bool m_committed;
+
+    /** The names of the open elements */
+    std::vector<const char *> m_elementStack;
+    /** Flag indicating that the start tag of the last open element is not closed because it has no content yet */
+    bool m_startTagOpen;
+
+    /**
+     * Flag for indicating if the VerovioText font is currently used.
+     */
+    bool m_vrvTextFont;
+
+    int m_width, m_height;
+    int m_originX, m_originY;
+    double m_userScaleX, m_userScaleY;
+
+    // holds the list of glyphs from the smufl font used so far (in the order of first use)
+    // they will be added at the end of the file as <defs>
+    std::vector<const Glyph *> m_smufl_glyphs;
+    // the same glyphs as a set for checking if they are already in the list
+    std::unordered_set<const Glyph *> m_smuflGlyphSet;
+
+    /**
+     * @name The serialized glyph <defs> (keyed by glyph) and woff fonts (keyed by resource path) shared by all
+     * instances.
+     */
+    ///@{
+    static std::mutex s_defsMutex;
+    static std::map<const Glyph *, std::string> s_glyphDefs;
+    static std::map<std::string, std::string> s_woffs;
+    ///@}
+};
+
+} // namespace vrv
+
+#endif // __VRV_SVG_STREAM_DC_H__
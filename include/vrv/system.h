@@ -90,6 +90,12 @@ public:
     // Functors //
     //----------//
 
+    /**
+     * See Object::CalcMemoryFootprint
+     * Also passes the functor to the system aligner.
+     */
+    virtual int CalcMemoryFootprint(FunctorParams *functorParams);
+
     /**
      * See Object::UnsetCurrentScoreDef
      */
@@ -29,7 +29,7 @@ public:
      */
     ///@{
     SystemElement();
-    SystemElement(std::string classid);
+    SystemElement(const char *classid);
     virtual ~SystemElement();
     virtual void Reset();
     virtual ClassId Is() const { return SYSTEM_ELEMENT; }
@@ -13,6 +13,7 @@
 
 namespace vrv {
 
+class Doc;
 class Object;
 class FunctorParams;
 class LayerElement;
@@ -49,9 +50,11 @@ public:
     ///@}
 
     /**
-     * Set first LayerElement by verifying it is the correct one.
+     * Look for the @startid in the uuid index of the doc and set the first LayerElement.
+     * If a measure is given, the LayerElement has to be in it.
+     * Return true if the start is set.
      */
-    bool SetStartOnly(LayerElement *start);
+    bool SetStartOnly(Doc *doc, Measure *measure = NULL);
 
     /**
      * Add a staff n to the AttStaffident vector (if not already there)
@@ -116,6 +119,11 @@ protected:
      */
     std::string ExtractUuidFragment(std::string refUuid);
 
+    /**
+     * Look for a visible LayerElement with the uuid in the doc (and in the measure if not NULL)
+     */
+    LayerElement *FindLinkedElement(Doc *doc, const std::string &uuid, Measure *measure);
+
 private:
     //
 public:
@@ -160,9 +168,11 @@ public:
     ///@}
 
     /**
-     *
+     * Look for the @startid and @endid in the uuid index of the doc and set the LayerElements.
+     * If a measure is given, the LayerElements have to be in it.
+     * Return true if both the start and the end are set.
      */
-    bool SetStartAndEnd(LayerElement *element);
+    bool SetStartAndEnd(Doc *doc, Measure *measure = NULL);
 
     /**
      *
@@ -8,7 +8,10 @@
 #ifndef __VRV_TOOLKIT_H__
 #define __VRV_TOOLKIT_H__
 
+#include <iostream>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 //----------------------------------------------------------------------------
 
@@ -38,7 +41,7 @@ public:
      * @name Constructors and destructors
      */
     ///@{
-    /** If initFont is set to false, Resources::InitFonts will have to be called explicitely */
+    /** If initFont is set to false, Toolkit::SetResourcePath will have to be called explicitely */
     Toolkit(bool initFont = true);
     virtual ~Toolkit();
     ///@}
@@ -49,6 +52,11 @@ public:
      */
     bool SetResourcePath(const std::string &path);
 
+    /**
+     * Get the resource path of the toolkit
+     */
+    std::string GetResourcePath() const;
+
     /**
      * Load a file with the specified type.
      */
@@ -101,6 +109,46 @@ public:
      */
     std::string RenderToSvg(int pageNo = 1, bool xml_declaration = false);
 
+    /**
+     * Render the page in SVG and write it to the stream as it is drawn.
+     * The SVG is equivalent to the one of RenderToSvg but the <defs> are at the end and the parts of the elements
+     * drawn in separate steps (e.g., slurs over systems) are in separate groups.
+     * Page number is 1-based.
+     */
+    void RenderToSvgStream(std::ostream &output, int pageNo = 1, bool xml_declaration = false);
+
+    /**
+     * Render a region of the page in SVG and returns it as a string.
+     * The region is given in pixels at the current scale, as in the SVG of RenderToSvg, and the SVG has the size of
+     * the region. Only the systems and the measures intersecting it are processed and drawn.
+     * Page number is 1-based
+     */
+    std::string RenderRegionToSvg(int pageNo, int x, int y, int width, int height, bool xml_declaration = false);
+
+    /**
+     * @name Split the page horizontally in tiles of the tile width and render them independently.
+     * This is meant for the single system of --no-layout. The tiles have the full height of the page and the elements
+     * crossing them (e.g., slurs) are drawn in each tile and clipped to it. GetTileOffset returns the x position of a
+     * tile in the page, in pixels at the current scale, where the tile has to be displayed for the tiles to join.
+     * Page and tile numbers are 1-based.
+     */
+    ///@{
+    int GetTileCount(int pageNo = 1);
+    int GetTileOffset(int pageNo, int tileNo);
+    std::string RenderTileToSvg(int pageNo, int tileNo, bool xml_declaration = false);
+    bool RenderTileToSvgFile(const std::string &filename, int pageNo, int tileNo);
+    ///@}
+
+    /**
+     * @name Get the external glyph sprite as SVG, as a string or by saving it to a file
+     * The sprite contains the <defs> of all the glyphs used by the pages rendered by RenderToSvg and RenderToSvgFile
+     * with a glyph sprite href (see SetGlyphSpriteHref) since the font was last changed.
+     */
+    ///@{
+    std::string GetGlyphSprite(bool xml_declaration = false);
+    bool GetGlyphSpriteFile(const std::string &filename);
+    ///@}
+
     /**
      * Render the page in SVG and save it to the file.
      * Page number is 1-based.
@@ -248,6 +296,21 @@ public:
     int GetIgnoreLayout() { return m_ignoreLayout; }
     ///@}
 
+    /**
+     * @name Allocate the objects of the document in an arena when loading data.
+     * Memory is then released all at once when the next data is loaded. See Doc::SetUseArena
+     */
+    ///@{
+    void SetUseArena(bool l) { m_doc.SetUseArena(l); }
+    int GetUseArena() { return (m_doc.GetArena() != NULL); }
+    ///@}
+
+    /**
+     * Return a report of the memory taken by the objects of the loaded document.
+     * See Doc::GetMemoryFootprint
+     */
+    std::string GetMemoryFootprint() { return m_doc.GetMemoryFootprint(); }
+
     /**
      * @name Crop the page height to the height of the content
      */
@@ -256,6 +319,47 @@ public:
     int GetAdjustPageHeight() { return m_adjustPageHeight; }
     ///@}
 
+    /**
+     * @name Write a compact SVG (no indentation, glyph sizes in the <defs>, merged staff lines, shorter numbers)
+     * This applies to RenderToSvg and RenderToSvgFile.
+     */
+    ///@{
+    void SetCompact(bool c) { m_compact = c; }
+    int GetCompact() { return m_compact; }
+    ///@}
+
+    /**
+     * @name Set the href of an external glyph sprite (e.g., "sprite.svg") for the pages to refer to the glyphs in it
+     * instead of including them. The sprite has to be written with GetGlyphSprite once the pages are rendered.
+     * This applies to RenderToSvg and RenderToSvgFile. An empty href (default) includes the glyphs in each page.
+     */
+    ///@{
+    void SetGlyphSpriteHref(const std::string &href) { m_glyphSpriteHref = href; }
+    std::string GetGlyphSpriteHref() { return m_glyphSpriteHref; }
+    ///@}
+
+    /**
+     * @name Set the width (in pixels at the current scale) of the tiles for RenderTileToSvg.
+     * With 0 (default), the page is one single tile. With tileMeasures, the tiles are cut at the beginning of the
+     * last measure fitting in them, unless a measure is larger than the tile width.
+     */
+    ///@{
+    void SetTileWidth(int w) { m_tileWidth = w; }
+    int GetTileWidth() { return m_tileWidth; }
+    void SetTileMeasures(bool m) { m_tileMeasures = m; }
+    int GetTileMeasures() { return m_tileMeasures; }
+    ///@}
+
+    /**
+     * @name Keep the drawing of the pages for rendering them again without going through the View.
+     * This is useful when the same pages are rendered several times (e.g., at another scale). The drawing of a page
+     * is kept until its layout changes or the document is edited. Disabled by default.
+     */
+    ///@{
+    void SetDisplayListCache(bool cache);
+    int GetDisplayListCache() { return m_displayListCache; }
+    ///@}
+
     /**
      * @name Space notes equally and close together (normally for mensural notation)
      */
@@ -346,6 +450,14 @@ public:
     bool SetFont(std::string const &font);
     ///@}
 
+    /**
+     * @name Seed the generation of the xml:ids
+     * The ids of the document are generated on demand and the same ids are generated for the same input and seed.
+     */
+    ///@{
+    void SetXmlIdSeed(int seed);
+    ///@}
+
     /**
      * @name Get the pages for a loaded file
      * The SetFormat with FileFormat does not perform any validation
@@ -367,6 +479,40 @@ private:
     bool IsUTF16(const std::string &filename);
     bool LoadUTF16File(const std::string &filename);
 
+    /**
+     * @name Render the current page of the view in SVG, with the origin and the size in page units (i.e., unscaled).
+     * The region version draws only the content intersecting the SVG.
+     */
+    ///@{
+    std::string RenderCurrentPageToSvg(int x, int y, int width, int height, bool xml_declaration);
+    std::string RenderCurrentPageRegionToSvg(int x, int y, int width, int height, bool xml_declaration);
+    ///@}
+
+    /**
+     * @name The size of the current page of the view according to the options, in page units
+     */
+    ///@{
+    int GetCurrentPageWidth();
+    int GetCurrentPageHeight();
+    ///@}
+
+    /**
+     * Draw the current page of the view, replaying its display list when the drawing of the pages is kept.
+     * The display list is recorded first if the page does not have one. The drawing regions and the bounding boxes
+     * are always drawn by the View.
+     */
+    void DrawCurrentPage(DeviceContext *dc);
+
+    /**
+     * Delete the display list of all the pages, for example after the document has been edited
+     */
+    void ResetDisplayLists();
+
+    /**
+     * Fill the x positions of the tiles of the current page of the view, in page units, followed by the page width
+     */
+    void CalcTileBoundaries(std::vector<int> &boundaries);
+
 protected:
 #ifdef USE_EMSCRIPTEN
     /**
@@ -398,6 +544,14 @@ private:
     bool m_noLayout;
     bool m_ignoreLayout;
     bool m_adjustPageHeight;
+    bool m_compact;
+    std::string m_glyphSpriteHref;
+    /** The glyphs used by the pages rendered with a glyph sprite, in the order of first use */
+    std::vector<const Glyph *> m_spriteGlyphs;
+    std::unordered_set<const Glyph *> m_spriteGlyphSet;
+    int m_tileWidth;
+    bool m_tileMeasures;
+    bool m_displayListCache;
     std::vector<std::string> m_appXPathQueries;
     std::vector<std::string> m_choiceXPathQueries;
     std::string m_mdivXPathQuery;
@@ -409,7 +563,7 @@ private:
     bool m_noJustification;
     bool m_showBoundingBoxes;
 
-    static char *m_humdrumBuffer;
+    char *m_humdrumBuffer;
     char *m_cString;
 };
 
@@ -134,6 +134,20 @@ public:
      */
     void DrawCurrentPage(DeviceContext *dc, bool background = true);
 
+    /**
+     * @name Set a region of the page to be drawn by DrawCurrentPage.
+     * Only the systems and the measures intersecting it are drawn, and the other systems are not processed at all.
+     * The coordinates are the ones of the device context without the page margins (i.e., y from top to bottom).
+     * The measures close to the region are also drawn for their content overflowing into it, which means that the
+     * device context has to clip the drawing to the region.
+     * ResetDrawingRegion sets the full page to be drawn again.
+     */
+    ///@{
+    void SetDrawingRegion(int x1, int y1, int x2, int y2);
+    void ResetDrawingRegion();
+    bool HasDrawingRegion() const { return m_hasDrawingRegion; }
+    ///@}
+
     /**
      * @name Methods for calculating drawing positions
      * Defined in view_element.cpp
@@ -171,6 +185,16 @@ protected:
     void DrawLayerList(DeviceContext *dc, Layer *layer, Staff *staff, Measure *measure, const ClassId classId);
     ///@}
 
+    /**
+     * @name Methods for checking if a vertical band (top and bottom in logical coordinates, VRV_UNSET for no limit)
+     * or a measure is intersecting the drawing region. Always true when no region is set.
+     * Defined in view_page.cpp
+     */
+    ///@{
+    bool IsInDrawingRegion(int top, int bottom);
+    bool IsInDrawingRegion(Measure *measure);
+    ///@}
+
     /**
      * @name Methods for drawing children
      * Defined in view_page.cpp
@@ -487,8 +511,16 @@ protected:
 private:
     /** @name Internal values for storing temporary values for ligatures */
     ///@{
-    static int s_drawingLigX[2], s_drawingLigY[2];
-    static bool s_drawingLigObliqua;
+    int m_drawingLigX[2], m_drawingLigY[2];
+    bool m_drawingLigObliqua;
+    ///@}
+
+    /**
+     * @name The region drawn by DrawCurrentPage (device context coordinates)
+     */
+    ///@{
+    bool m_hasDrawingRegion;
+    int m_drawingRegionX1, m_drawingRegionY1, m_drawingRegionX2, m_drawingRegionY2;
     ///@}
 };
 
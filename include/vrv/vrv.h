@@ -10,6 +10,8 @@
 
 #include <cstring>
 #include <map>
+#include <mutex>
+#include <set>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string>
@@ -24,6 +26,7 @@
 namespace vrv {
 
 class Glyph;
+class GlyphTable;
 class Object;
 
 /**
@@ -39,10 +42,11 @@ void DisableLog();
 
 /**
  * Member and functions specific to emscripten loging that uses a vector of string to buffer the logs.
+ * The buffer is per thread so toolkits running in different threads do not share their logs.
  */
 #ifdef EMSCRIPTEN
 enum consoleLogLevel { CONSOLE_LOG = 0, CONSOLE_INFO, CONSOLE_WARN, CONSOLE_ERROR };
-extern std::vector<std::string> logBuffer;
+extern thread_local std::vector<std::string> logBuffer;
 bool LogBufferContains(std::string s);
 void AppendLogBuffer(bool checkDuplicate, std::string message, consoleLogLevel level);
 #endif
@@ -87,7 +91,7 @@ std::string GetFilename(std::string fullpath);
 std::string GetVersion();
 
 /**
- *
+ * Disables the log for the whole process. To be set before any toolkit is used.
  */
 extern bool noLog;
 
@@ -102,7 +106,7 @@ extern bool noLog;
  * ... Do something
  * LogElapsedTimeEnd("name of the operation");
  */
-extern struct timeval start;
+extern thread_local struct timeval start;
 void LogElapsedTimeStart();
 void LogElapsedTimeEnd(const char *msg = "unspecified operation");
 
@@ -117,41 +121,87 @@ bool Check(Object *object);
 //----------------------------------------------------------------------------
 
 /**
- * This class provides static resource values.
- * The default values can be changed by setters.
+ * This class provides the resource path and the fonts of a document.
+ * Each Doc owns its instance, so documents in different threads can use different paths and fonts.
+ * The glyph tables are loaded only once per process and are shared read-only between the instances.
  */
 
 class Resources {
 public:
     /**
-     * @name Setters and getters for static environment variables
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    Resources();
+    virtual ~Resources(){};
+    ///@}
+
+    /**
+     * @name Setters and getters for the environment variables
      */
     ///@{
-    /** Resource path */
-    static std::string GetPath() { return m_path; }
-    static void SetPath(std::string path) { m_path = path; }
+    /**
+     * Resource path.
+     * When it is empty (the default), the fonts compiled into Verovio are used without reading any file. Other fonts
+     * are then loaded from the default path. When it is set, all the resources are loaded from the path.
+     */
+    std::string GetPath() const { return m_path; }
+    void SetPath(const std::string &path) { m_path = path; }
     /** Init the SMufL music and text fonts */
-    static bool InitFonts();
-    /** Init the text font (bounding boxes and ASCII only) */
-    static bool InitTextFont();
+    bool InitFonts();
     /** Select a particular font */
-    static bool SetFont(std::string fontName);
+    bool SetFont(const std::string &fontName);
     /** Returns the glyph (if exists) for the current SMuFL font */
-    static Glyph *GetGlyph(wchar_t smuflCode);
+    const Glyph *GetGlyph(wchar_t smuflCode) const;
     /** Returns the glyph (if exists) for the text font (bounding box and ASCII only) */
-    static Glyph *GetTextGlyph(wchar_t code);
+    const Glyph *GetTextGlyph(wchar_t code) const;
+    /** Returns the glyph table of the current SMuFL font and of the text font (NULL if not initialized) */
+    const GlyphTable *GetFont() const { return m_font; }
+    const GlyphTable *GetTextFont() const { return m_textFont; }
     ///@}
 
+    /** The default resource path - used for the fonts not compiled into Verovio if no path is set */
+#ifdef USE_EMSCRIPTEN
+    static std::string GetDefaultPath() { return "/data"; }
+#else
+    static std::string GetDefaultPath() { return "/usr/local/share/verovio"; }
+#endif
+
 private:
-    static bool LoadFont(std::string fontName);
+    /**
+     * @name Methods for loading the shared glyph tables.
+     * GetSharedFont and GetSharedTextFont return the table for the path, loading it on the first call.
+     * They return NULL if the table could not be loaded. With an empty path, the fonts compiled into Verovio are
+     * used (see LoadBuiltInFont) and the other ones are loaded from the default path.
+     */
+    ///@{
+    static const GlyphTable *GetSharedFont(const std::string &path, const std::string &fontName);
+    static const GlyphTable *GetSharedTextFont(const std::string &path);
+    static bool LoadFont(const std::string &path, const std::string &fontName, GlyphTable *font);
+    static bool LoadTextFont(const std::string &path, GlyphTable *textFont);
+    static bool LoadBuiltInFont(const std::string &fontName, GlyphTable *font);
+    ///@}
 
 private:
-    /** The path to the resources directory (e.g., for the svg/ subdirectory with fonts as XML */
-    static std::string m_path;
-    /** The loaded SMuFL font */
-    static std::map<wchar_t, Glyph> m_font;
+    /** The path to the resources directory (e.g., for the svg/ subdirectory with fonts as XML) - empty for built-in */
+    std::string m_path;
+    /** The selected SMuFL font */
+    const GlyphTable *m_font;
     /** A text font used for bounding box calculations */
-    static std::map<wchar_t, Glyph> m_textFont;
+    const GlyphTable *m_textFont;
+
+    /**
+     * @name The glyph tables shared by all instances.
+     * The fonts are keyed by path and font name, the text fonts by path. Each font is the default
+     * one (Leipzig over Bravura) overlaid with the font. Entries are never modified once inserted.
+     * The fonts that could not be loaded are kept too, so they are not looked for again.
+     */
+    ///@{
+    static std::mutex s_fontsMutex;
+    static std::map<std::string, GlyphTable> s_fonts;
+    static std::map<std::string, GlyphTable> s_textFonts;
+    static std::set<std::string> s_missingFonts;
+    ///@}
 };
 
 //----------------------------------------------------------------------------
@@ -9,12 +9,17 @@
 #define __VRV_DEF_H__
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <list>
 #include <map>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 //----------------------------------------------------------------------------
 
+#include "attclasses.h"
 #include "attdef.h"
 
 namespace vrv {
@@ -29,6 +34,22 @@ namespace vrv {
 // Adds "-dev" in the version number - should be set to false for releases
 #define VERSION_DEV false
 
+//----------------------------------------------------------------------------
+// Cast redefinition
+//----------------------------------------------------------------------------
+
+/**
+ * Cast to be used when the type is already known, e.g., the FunctorParams of a functor or an Object
+ * after checking Object::Is(). It is a dynamic_cast in debug builds, so the assert following it checks
+ * the type, and a static_cast without RTTI lookup in release builds.
+ * It can be used only for down-casting within a class hierarchy (i.e., not for getting an interface).
+ */
+#ifdef NDEBUG
+#define vrv_cast static_cast
+#else
+#define vrv_cast dynamic_cast
+#endif
+
 //----------------------------------------------------------------------------
 // Object defines
 //----------------------------------------------------------------------------
@@ -156,6 +177,8 @@ enum ClassId {
     //
     BBOX_DEVICE_CONTEXT,
     SVG_DEVICE_CONTEXT,
+    SVG_STREAM_DEVICE_CONTEXT,
+    DISPLAY_LIST_DEVICE_CONTEXT,
     //
     UNSPECIFIED
 };
@@ -173,7 +196,43 @@ enum InterfaceId {
     INTERFACE_SCOREDEF,
     INTERFACE_TEXT_DIR,
     INTERFACE_TIME_POINT,
-    INTERFACE_TIME_SPANNING
+    INTERFACE_TIME_SPANNING,
+    //
+    INTERFACE_max
+};
+
+//----------------------------------------------------------------------------
+// SharedBitSet
+//----------------------------------------------------------------------------
+
+/**
+ * A fixed-size set of bits that can be read and extended from several threads at the same time.
+ * Bits can only be added. Since the words are written only when a bit is actually missing, a set
+ * that is complete is only read. It is meant for static tables (zero-initialized).
+ */
+template <size_t N> class SharedBitSet {
+public:
+    bool Test(size_t pos) const
+    {
+        return (m_words[pos / 64].load(std::memory_order_relaxed) & ((uint64_t)1 << (pos % 64))) != 0;
+    }
+
+    void Set(size_t pos) { this->SetBits(pos / 64, (uint64_t)1 << (pos % 64)); }
+
+    void Merge(const SharedBitSet<N> &other)
+    {
+        for (size_t i = 0; i < (N + 63) / 64; ++i) this->SetBits(i, other.m_words[i].load(std::memory_order_relaxed));
+    }
+
+private:
+    void SetBits(size_t i, uint64_t bits)
+    {
+        if ((m_words[i].load(std::memory_order_relaxed) & bits) != bits) {
+            m_words[i].fetch_or(bits, std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<uint64_t> m_words[(N + 63) / 64];
 };
 
 //----------------------------------------------------------------------------
@@ -196,6 +255,24 @@ typedef std::vector<Object *> ArrayOfObjects;
 
 typedef std::list<Object *> ListOfObjects;
 
+/**
+ * Hash and equality of a pointer to a string that compare the strings pointed to.
+ * This is used for maps that refer to strings stored elsewhere (e.g., the uuid of the objects).
+ */
+struct StrPtrHash {
+    size_t operator()(const std::string *str) const { return std::hash<std::string>()(*str); }
+};
+struct StrPtrEqual {
+    bool operator()(const std::string *str1, const std::string *str2) const { return (*str1 == *str2); }
+};
+
+/**
+ * The uuid index of the Doc. The keys point to the uuid of each object, which must not change while it is indexed.
+ */
+typedef std::unordered_multimap<const std::string *, Object *, StrPtrHash, StrPtrEqual> MapOfUuidObjects;
+
+typedef std::map<std::pair<int, int>, ArrayOfObjects> MapOfLayerPartitions;
+
 typedef std::vector<AttComparison *> ArrayOfAttComparisons;
 
 typedef std::vector<Note *> ChordCluster;
@@ -216,6 +293,10 @@ typedef std::vector<FloatingPositioner *> ArrayOfFloatingPositioners;
 
 typedef std::vector<BoundingBox *> ArrayOfBoundingBoxes;
 
+typedef SharedBitSet<ATT_CLASS_max> AttClassSet;
+
+typedef SharedBitSet<INTERFACE_max> InterfaceSet;
+
 //----------------------------------------------------------------------------
 // Global defines
 //----------------------------------------------------------------------------
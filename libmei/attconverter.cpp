@@ -62,7 +62,7 @@ std::string AttConverter::AccidentalExplicitToStr(data_ACCIDENTAL_EXPLICIT data)
     return value;
 }
 
-data_ACCIDENTAL_EXPLICIT AttConverter::StrToAccidentalExplicit(std::string value) const
+data_ACCIDENTAL_EXPLICIT AttConverter::StrToAccidentalExplicit(const std::string &value) const
 {
     if (value == "s") return ACCIDENTAL_EXPLICIT_s;
     if (value == "f") return ACCIDENTAL_EXPLICIT_f;
@@ -111,7 +111,7 @@ std::string AttConverter::AccidentalImplicitToStr(data_ACCIDENTAL_IMPLICIT data)
     return value;
 }
 
-data_ACCIDENTAL_IMPLICIT AttConverter::StrToAccidentalImplicit(std::string value) const
+data_ACCIDENTAL_IMPLICIT AttConverter::StrToAccidentalImplicit(const std::string &value) const
 {
     if (value == "s") return ACCIDENTAL_IMPLICIT_s;
     if (value == "f") return ACCIDENTAL_IMPLICIT_f;
@@ -173,7 +173,7 @@ std::string AttConverter::ArticulationToStr(data_ARTICULATION data) const
     return value;
 }
 
-data_ARTICULATION AttConverter::StrToArticulation(std::string value) const
+data_ARTICULATION AttConverter::StrToArticulation(const std::string &value) const
 {
     if (value == "acc") return ARTICULATION_acc;
     if (value == "stacc") return ARTICULATION_stacc;
@@ -229,7 +229,7 @@ std::string AttConverter::BarplaceToStr(data_BARPLACE data) const
     return value;
 }
 
-data_BARPLACE AttConverter::StrToBarplace(std::string value) const
+data_BARPLACE AttConverter::StrToBarplace(const std::string &value) const
 {
     if (value == "mensur") return BARPLACE_mensur;
     if (value == "staff") return BARPLACE_staff;
@@ -261,7 +261,7 @@ std::string AttConverter::BarrenditionToStr(data_BARRENDITION data) const
     return value;
 }
 
-data_BARRENDITION AttConverter::StrToBarrendition(std::string value) const
+data_BARRENDITION AttConverter::StrToBarrendition(const std::string &value) const
 {
     if (value == "dashed") return BARRENDITION_dashed;
     if (value == "dotted") return BARRENDITION_dotted;
@@ -303,7 +303,7 @@ std::string AttConverter::BetypeToStr(data_BETYPE data) const
     return value;
 }
 
-data_BETYPE AttConverter::StrToBetype(std::string value) const
+data_BETYPE AttConverter::StrToBetype(const std::string &value) const
 {
     if (value == "byte") return BETYPE_byte;
     if (value == "smil") return BETYPE_smil;
@@ -336,7 +336,7 @@ std::string AttConverter::BooleanToStr(data_BOOLEAN data) const
     return value;
 }
 
-data_BOOLEAN AttConverter::StrToBoolean(std::string value) const
+data_BOOLEAN AttConverter::StrToBoolean(const std::string &value) const
 {
     if (value == "true") return BOOLEAN_true;
     if (value == "false") return BOOLEAN_false;
@@ -360,7 +360,7 @@ std::string AttConverter::CertaintyToStr(data_CERTAINTY data) const
     return value;
 }
 
-data_CERTAINTY AttConverter::StrToCertainty(std::string value) const
+data_CERTAINTY AttConverter::StrToCertainty(const std::string &value) const
 {
     if (value == "high") return CERTAINTY_high;
     if (value == "medium") return CERTAINTY_medium;
@@ -388,7 +388,7 @@ std::string AttConverter::ClefshapeToStr(data_CLEFSHAPE data) const
     return value;
 }
 
-data_CLEFSHAPE AttConverter::StrToClefshape(std::string value) const
+data_CLEFSHAPE AttConverter::StrToClefshape(const std::string &value) const
 {
     if (value == "G") return CLEFSHAPE_G;
     if (value == "GG") return CLEFSHAPE_GG;
@@ -415,7 +415,7 @@ std::string AttConverter::ClusterToStr(data_CLUSTER data) const
     return value;
 }
 
-data_CLUSTER AttConverter::StrToCluster(std::string value) const
+data_CLUSTER AttConverter::StrToCluster(const std::string &value) const
 {
     if (value == "white") return CLUSTER_white;
     if (value == "black") return CLUSTER_black;
@@ -452,7 +452,7 @@ std::string AttConverter::ColornamesToStr(data_COLORNAMES data) const
     return value;
 }
 
-data_COLORNAMES AttConverter::StrToColornames(std::string value) const
+data_COLORNAMES AttConverter::StrToColornames(const std::string &value) const
 {
     if (value == "aqua") return COLORNAMES_aqua;
     if (value == "black") return COLORNAMES_black;
@@ -488,7 +488,7 @@ std::string AttConverter::EnclosureToStr(data_ENCLOSURE data) const
     return value;
 }
 
-data_ENCLOSURE AttConverter::StrToEnclosure(std::string value) const
+data_ENCLOSURE AttConverter::StrToEnclosure(const std::string &value) const
 {
     if (value == "paren") return ENCLOSURE_paren;
     if (value == "brack") return ENCLOSURE_brack;
@@ -514,7 +514,7 @@ std::string AttConverter::FillToStr(data_FILL data) const
     return value;
 }
 
-data_FILL AttConverter::StrToFill(std::string value) const
+data_FILL AttConverter::StrToFill(const std::string &value) const
 {
     if (value == "void") return FILL_void;
     if (value == "solid") return FILL_solid;
@@ -547,7 +547,7 @@ std::string AttConverter::FontsizetermToStr(data_FONTSIZETERM data) const
     return value;
 }
 
-data_FONTSIZETERM AttConverter::StrToFontsizeterm(std::string value) const
+data_FONTSIZETERM AttConverter::StrToFontsizeterm(const std::string &value) const
 {
     if (value == "xx-small") return FONTSIZETERM_xx_small;
     if (value == "x-small") return FONTSIZETERM_x_small;
@@ -577,7 +577,7 @@ std::string AttConverter::FontstyleToStr(data_FONTSTYLE data) const
     return value;
 }
 
-data_FONTSTYLE AttConverter::StrToFontstyle(std::string value) const
+data_FONTSTYLE AttConverter::StrToFontstyle(const std::string &value) const
 {
     if (value == "italic") return FONTSTYLE_italic;
     if (value == "normal") return FONTSTYLE_normal;
@@ -600,7 +600,7 @@ std::string AttConverter::FontweightToStr(data_FONTWEIGHT data) const
     return value;
 }
 
-data_FONTWEIGHT AttConverter::StrToFontweight(std::string value) const
+data_FONTWEIGHT AttConverter::StrToFontweight(const std::string &value) const
 {
     if (value == "bold") return FONTWEIGHT_bold;
     if (value == "normal") return FONTWEIGHT_normal;
@@ -623,7 +623,7 @@ std::string AttConverter::GlissandoToStr(data_GLISSANDO data) const
     return value;
 }
 
-data_GLISSANDO AttConverter::StrToGlissando(std::string value) const
+data_GLISSANDO AttConverter::StrToGlissando(const std::string &value) const
 {
     if (value == "i") return GLISSANDO_i;
     if (value == "m") return GLISSANDO_m;
@@ -647,7 +647,7 @@ std::string AttConverter::GraceToStr(data_GRACE data) const
     return value;
 }
 
-data_GRACE AttConverter::StrToGrace(std::string value) const
+data_GRACE AttConverter::StrToGrace(const std::string &value) const
 {
     if (value == "acc") return GRACE_acc;
     if (value == "unacc") return GRACE_unacc;
@@ -672,7 +672,7 @@ std::string AttConverter::HorizontalalignmentToStr(data_HORIZONTALALIGNMENT data
     return value;
 }
 
-data_HORIZONTALALIGNMENT AttConverter::StrToHorizontalalignment(std::string value) const
+data_HORIZONTALALIGNMENT AttConverter::StrToHorizontalalignment(const std::string &value) const
 {
     if (value == "left") return HORIZONTALALIGNMENT_left;
     if (value == "right") return HORIZONTALALIGNMENT_right;
@@ -699,7 +699,7 @@ std::string AttConverter::IneumeformToStr(data_INEUMEFORM data) const
     return value;
 }
 
-data_INEUMEFORM AttConverter::StrToIneumeform(std::string value) const
+data_INEUMEFORM AttConverter::StrToIneumeform(const std::string &value) const
 {
     if (value == "liquescent1") return INEUMEFORM_liquescent1;
     if (value == "liquescent2") return INEUMEFORM_liquescent2;
@@ -729,7 +729,7 @@ std::string AttConverter::IneumenameToStr(data_INEUMENAME data) const
     return value;
 }
 
-data_INEUMENAME AttConverter::StrToIneumename(std::string value) const
+data_INEUMENAME AttConverter::StrToIneumename(const std::string &value) const
 {
     if (value == "pessubpunctis") return INEUMENAME_pessubpunctis;
     if (value == "climacus") return INEUMENAME_climacus;
@@ -759,7 +759,7 @@ std::string AttConverter::LayerschemeToStr(data_LAYERSCHEME data) const
     return value;
 }
 
-data_LAYERSCHEME AttConverter::StrToLayerscheme(std::string value) const
+data_LAYERSCHEME AttConverter::StrToLayerscheme(const std::string &value) const
 {
     if (value == "1") return LAYERSCHEME_1;
     if (value == "2o") return LAYERSCHEME_2o;
@@ -784,7 +784,7 @@ std::string AttConverter::LigatureformToStr(data_LIGATUREFORM data) const
     return value;
 }
 
-data_LIGATUREFORM AttConverter::StrToLigatureform(std::string value) const
+data_LIGATUREFORM AttConverter::StrToLigatureform(const std::string &value) const
 {
     if (value == "recta") return LIGATUREFORM_recta;
     if (value == "obliqua") return LIGATUREFORM_obliqua;
@@ -808,7 +808,7 @@ std::string AttConverter::LineformToStr(data_LINEFORM data) const
     return value;
 }
 
-data_LINEFORM AttConverter::StrToLineform(std::string value) const
+data_LINEFORM AttConverter::StrToLineform(const std::string &value) const
 {
     if (value == "dashed") return LINEFORM_dashed;
     if (value == "dotted") return LINEFORM_dotted;
@@ -840,7 +840,7 @@ std::string AttConverter::LinestartendsymbolToStr(data_LINESTARTENDSYMBOL data)
     return value;
 }
 
-data_LINESTARTENDSYMBOL AttConverter::StrToLinestartendsymbol(std::string value) const
+data_LINESTARTENDSYMBOL AttConverter::StrToLinestartendsymbol(const std::string &value) const
 {
     if (value == "angledown") return LINESTARTENDSYMBOL_angledown;
     if (value == "angleup") return LINESTARTENDSYMBOL_angleup;
@@ -871,7 +871,7 @@ std::string AttConverter::LinewidthtermToStr(data_LINEWIDTHTERM data) const
     return value;
 }
 
-data_LINEWIDTHTERM AttConverter::StrToLinewidthterm(std::string value) const
+data_LINEWIDTHTERM AttConverter::StrToLinewidthterm(const std::string &value) const
 {
     if (value == "narrow") return LINEWIDTHTERM_narrow;
     if (value == "medium") return LINEWIDTHTERM_medium;
@@ -920,7 +920,7 @@ std::string AttConverter::MelodicfunctionToStr(data_MELODICFUNCTION data) const
     return value;
 }
 
-data_MELODICFUNCTION AttConverter::StrToMelodicfunction(std::string value) const
+data_MELODICFUNCTION AttConverter::StrToMelodicfunction(const std::string &value) const
 {
     if (value == "aln") return MELODICFUNCTION_aln;
     if (value == "ant") return MELODICFUNCTION_ant;
@@ -968,7 +968,7 @@ std::string AttConverter::MensurationsignToStr(data_MENSURATIONSIGN data) const
     return value;
 }
 
-data_MENSURATIONSIGN AttConverter::StrToMensurationsign(std::string value) const
+data_MENSURATIONSIGN AttConverter::StrToMensurationsign(const std::string &value) const
 {
     if (value == "C") return MENSURATIONSIGN_C;
     if (value == "O") return MENSURATIONSIGN_O;
@@ -990,7 +990,7 @@ std::string AttConverter::MetersignToStr(data_METERSIGN data) const
     return value;
 }
 
-data_METERSIGN AttConverter::StrToMetersign(std::string value) const
+data_METERSIGN AttConverter::StrToMetersign(const std::string &value) const
 {
     if (value == "common") return METERSIGN_common;
     if (value == "cut") return METERSIGN_cut;
@@ -1185,7 +1185,7 @@ std::string AttConverter::MidinamesToStr(data_MIDINAMES data) const
     return value;
 }
 
-data_MIDINAMES AttConverter::StrToMidinames(std::string value) const
+data_MIDINAMES AttConverter::StrToMidinames(const std::string &value) const
 {
     if (value == "Acoustic_Grand_Piano") return MIDINAMES_Acoustic_Grand_Piano;
     if (value == "Bright_Acoustic_Piano") return MIDINAMES_Bright_Acoustic_Piano;
@@ -1386,7 +1386,7 @@ std::string AttConverter::ModeToStr(data_MODE data) const
     return value;
 }
 
-data_MODE AttConverter::StrToMode(std::string value) const
+data_MODE AttConverter::StrToMode(const std::string &value) const
 {
     if (value == "major") return MODE_major;
     if (value == "minor") return MODE_minor;
@@ -1418,7 +1418,7 @@ std::string AttConverter::NotationtypeToStr(data_NOTATIONTYPE data) const
     return value;
 }
 
-data_NOTATIONTYPE AttConverter::StrToNotationtype(std::string value) const
+data_NOTATIONTYPE AttConverter::StrToNotationtype(const std::string &value) const
 {
     if (value == "cmn") return NOTATIONTYPE_cmn;
     if (value == "mensural") return NOTATIONTYPE_mensural;
@@ -1452,7 +1452,7 @@ std::string AttConverter::NoteheadmodifierListToStr(data_NOTEHEADMODIFIER_list d
     return value;
 }
 
-data_NOTEHEADMODIFIER_list AttConverter::StrToNoteheadmodifierList(std::string value) const
+data_NOTEHEADMODIFIER_list AttConverter::StrToNoteheadmodifierList(const std::string &value) const
 {
     if (value == "slash") return NOTEHEADMODIFIER_list_slash;
     if (value == "backslash") return NOTEHEADMODIFIER_list_backslash;
@@ -1482,7 +1482,7 @@ std::string AttConverter::OtherstaffToStr(data_OTHERSTAFF data) const
     return value;
 }
 
-data_OTHERSTAFF AttConverter::StrToOtherstaff(std::string value) const
+data_OTHERSTAFF AttConverter::StrToOtherstaff(const std::string &value) const
 {
     if (value == "above") return OTHERSTAFF_above;
     if (value == "below") return OTHERSTAFF_below;
@@ -1504,7 +1504,7 @@ std::string AttConverter::PlaceToStr(data_PLACE data) const
     return value;
 }
 
-data_PLACE AttConverter::StrToPlace(std::string value) const
+data_PLACE AttConverter::StrToPlace(const std::string &value) const
 {
     if (value == "above") return PLACE_above;
     if (value == "below") return PLACE_below;
@@ -1531,7 +1531,7 @@ std::string AttConverter::RotationdirectionToStr(data_ROTATIONDIRECTION data) co
     return value;
 }
 
-data_ROTATIONDIRECTION AttConverter::StrToRotationdirection(std::string value) const
+data_ROTATIONDIRECTION AttConverter::StrToRotationdirection(const std::string &value) const
 {
     if (value == "none") return ROTATIONDIRECTION_none;
     if (value == "down") return ROTATIONDIRECTION_down;
@@ -1558,7 +1558,7 @@ std::string AttConverter::SizeToStr(data_SIZE data) const
     return value;
 }
 
-data_SIZE AttConverter::StrToSize(std::string value) const
+data_SIZE AttConverter::StrToSize(const std::string &value) const
 {
     if (value == "normal") return SIZE_normal;
     if (value == "cue") return SIZE_cue;
@@ -1581,7 +1581,7 @@ std::string AttConverter::StaffrelToStr(data_STAFFREL data) const
     return value;
 }
 
-data_STAFFREL AttConverter::StrToStaffrel(std::string value) const
+data_STAFFREL AttConverter::StrToStaffrel(const std::string &value) const
 {
     if (value == "above") return STAFFREL_above;
     if (value == "below") return STAFFREL_below;
@@ -1611,7 +1611,7 @@ std::string AttConverter::StemmodifierToStr(data_STEMMODIFIER data) const
     return value;
 }
 
-data_STEMMODIFIER AttConverter::StrToStemmodifier(std::string value) const
+data_STEMMODIFIER AttConverter::StrToStemmodifier(const std::string &value) const
 {
     if (value == "none") return STEMMODIFIER_none;
     if (value == "1slash") return STEMMODIFIER_1slash;
@@ -1641,7 +1641,7 @@ std::string AttConverter::StempositionToStr(data_STEMPOSITION data) const
     return value;
 }
 
-data_STEMPOSITION AttConverter::StrToStemposition(std::string value) const
+data_STEMPOSITION AttConverter::StrToStemposition(const std::string &value) const
 {
     if (value == "left") return STEMPOSITION_left;
     if (value == "right") return STEMPOSITION_right;
@@ -1666,7 +1666,7 @@ std::string AttConverter::TemperamentToStr(data_TEMPERAMENT data) const
     return value;
 }
 
-data_TEMPERAMENT AttConverter::StrToTemperament(std::string value) const
+data_TEMPERAMENT AttConverter::StrToTemperament(const std::string &value) const
 {
     if (value == "equal") return TEMPERAMENT_equal;
     if (value == "just") return TEMPERAMENT_just;
@@ -1712,7 +1712,7 @@ std::string AttConverter::TextrenditionlistToStr(data_TEXTRENDITIONLIST data) co
     return value;
 }
 
-data_TEXTRENDITIONLIST AttConverter::StrToTextrenditionlist(std::string value) const
+data_TEXTRENDITIONLIST AttConverter::StrToTextrenditionlist(const std::string &value) const
 {
     if (value == "italic") return TEXTRENDITIONLIST_italic;
     if (value == "oblique") return TEXTRENDITIONLIST_oblique;
@@ -1761,7 +1761,7 @@ std::string AttConverter::UneumeformToStr(data_UNEUMEFORM data) const
     return value;
 }
 
-data_UNEUMEFORM AttConverter::StrToUneumeform(std::string value) const
+data_UNEUMEFORM AttConverter::StrToUneumeform(const std::string &value) const
 {
     if (value == "liquescent1") return UNEUMEFORM_liquescent1;
     if (value == "liquescent2") return UNEUMEFORM_liquescent2;
@@ -1799,7 +1799,7 @@ std::string AttConverter::UneumenameToStr(data_UNEUMENAME data) const
     return value;
 }
 
-data_UNEUMENAME AttConverter::StrToUneumename(std::string value) const
+data_UNEUMENAME AttConverter::StrToUneumename(const std::string &value) const
 {
     if (value == "punctum") return UNEUMENAME_punctum;
     if (value == "virga") return UNEUMENAME_virga;
@@ -1832,7 +1832,7 @@ std::string AttConverter::AccidLogFuncToStr(accidLog_FUNC data) const
     return value;
 }
 
-accidLog_FUNC AttConverter::StrToAccidLogFunc(std::string value) const
+accidLog_FUNC AttConverter::StrToAccidLogFunc(const std::string &value) const
 {
     if (value == "caution") return accidLog_FUNC_caution;
     if (value == "edit") return accidLog_FUNC_edit;
@@ -1855,7 +1855,7 @@ std::string AttConverter::ArpegLogOrderToStr(arpegLog_ORDER data) const
     return value;
 }
 
-arpegLog_ORDER AttConverter::StrToArpegLogOrder(std::string value) const
+arpegLog_ORDER AttConverter::StrToArpegLogOrder(const std::string &value) const
 {
     if (value == "up") return arpegLog_ORDER_up;
     if (value == "down") return arpegLog_ORDER_down;
@@ -1878,7 +1878,7 @@ std::string AttConverter::BTremLogFormToStr(bTremLog_FORM data) const
     return value;
 }
 
-bTremLog_FORM AttConverter::StrToBTremLogForm(std::string value) const
+bTremLog_FORM AttConverter::StrToBTremLogForm(const std::string &value) const
 {
     if (value == "meas") return bTremLog_FORM_meas;
     if (value == "unmeas") return bTremLog_FORM_unmeas;
@@ -1901,7 +1901,7 @@ std::string AttConverter::BeamingVisBeamrendToStr(beamingVis_BEAMREND data) cons
     return value;
 }
 
-beamingVis_BEAMREND AttConverter::StrToBeamingVisBeamrend(std::string value) const
+beamingVis_BEAMREND AttConverter::StrToBeamingVisBeamrend(const std::string &value) const
 {
     if (value == "acc") return beamingVis_BEAMREND_acc;
     if (value == "rit") return beamingVis_BEAMREND_rit;
@@ -1926,7 +1926,7 @@ std::string AttConverter::BeamrendFormToStr(beamrend_FORM data) const
     return value;
 }
 
-beamrend_FORM AttConverter::StrToBeamrendForm(std::string value) const
+beamrend_FORM AttConverter::StrToBeamrendForm(const std::string &value) const
 {
     if (value == "acc") return beamrend_FORM_acc;
     if (value == "mixed") return beamrend_FORM_mixed;
@@ -1951,7 +1951,7 @@ std::string AttConverter::CurvatureCurvedirToStr(curvature_CURVEDIR data) const
     return value;
 }
 
-curvature_CURVEDIR AttConverter::StrToCurvatureCurvedir(std::string value) const
+curvature_CURVEDIR AttConverter::StrToCurvatureCurvedir(const std::string &value) const
 {
     if (value == "above") return curvature_CURVEDIR_above;
     if (value == "below") return curvature_CURVEDIR_below;
@@ -1973,7 +1973,7 @@ std::string AttConverter::CutoutCutoutToStr(cutout_CUTOUT data) const
     return value;
 }
 
-cutout_CUTOUT AttConverter::StrToCutoutCutout(std::string value) const
+cutout_CUTOUT AttConverter::StrToCutoutCutout(const std::string &value) const
 {
     if (value == "cutout") return cutout_CUTOUT_cutout;
     LogWarning("Unsupported value '%s' for att.cutout@cutout", value.c_str());
@@ -1994,7 +1994,7 @@ std::string AttConverter::DotLogFormToStr(dotLog_FORM data) const
     return value;
 }
 
-dotLog_FORM AttConverter::StrToDotLogForm(std::string value) const
+dotLog_FORM AttConverter::StrToDotLogForm(const std::string &value) const
 {
     if (value == "aug") return dotLog_FORM_aug;
     if (value == "div") return dotLog_FORM_div;
@@ -2017,7 +2017,7 @@ std::string AttConverter::EndingsEndingrendToStr(endings_ENDINGREND data) const
     return value;
 }
 
-endings_ENDINGREND AttConverter::StrToEndingsEndingrend(std::string value) const
+endings_ENDINGREND AttConverter::StrToEndingsEndingrend(const std::string &value) const
 {
     if (value == "top") return endings_ENDINGREND_top;
     if (value == "barred") return endings_ENDINGREND_barred;
@@ -2040,7 +2040,7 @@ std::string AttConverter::FTremLogFormToStr(fTremLog_FORM data) const
     return value;
 }
 
-fTremLog_FORM AttConverter::StrToFTremLogForm(std::string value) const
+fTremLog_FORM AttConverter::StrToFTremLogForm(const std::string &value) const
 {
     if (value == "meas") return fTremLog_FORM_meas;
     if (value == "unmeas") return fTremLog_FORM_unmeas;
@@ -2062,7 +2062,7 @@ std::string AttConverter::FermataVisFormToStr(fermataVis_FORM data) const
     return value;
 }
 
-fermataVis_FORM AttConverter::StrToFermataVisForm(std::string value) const
+fermataVis_FORM AttConverter::StrToFermataVisForm(const std::string &value) const
 {
     if (value == "inv") return fermataVis_FORM_inv;
     if (value == "norm") return fermataVis_FORM_norm;
@@ -2085,7 +2085,7 @@ std::string AttConverter::FermataVisShapeToStr(fermataVis_SHAPE data) const
     return value;
 }
 
-fermataVis_SHAPE AttConverter::StrToFermataVisShape(std::string value) const
+fermataVis_SHAPE AttConverter::StrToFermataVisShape(const std::string &value) const
 {
     if (value == "curved") return fermataVis_SHAPE_curved;
     if (value == "square") return fermataVis_SHAPE_square;
@@ -2108,7 +2108,7 @@ std::string AttConverter::HairpinLogFormToStr(hairpinLog_FORM data) const
     return value;
 }
 
-hairpinLog_FORM AttConverter::StrToHairpinLogForm(std::string value) const
+hairpinLog_FORM AttConverter::StrToHairpinLogForm(const std::string &value) const
 {
     if (value == "cres") return hairpinLog_FORM_cres;
     if (value == "dim") return hairpinLog_FORM_dim;
@@ -2131,7 +2131,7 @@ std::string AttConverter::HarmVisRendgridToStr(harmVis_RENDGRID data) const
     return value;
 }
 
-harmVis_RENDGRID AttConverter::StrToHarmVisRendgrid(std::string value) const
+harmVis_RENDGRID AttConverter::StrToHarmVisRendgrid(const std::string &value) const
 {
     if (value == "grid") return harmVis_RENDGRID_grid;
     if (value == "gridtext") return harmVis_RENDGRID_gridtext;
@@ -2155,7 +2155,7 @@ std::string AttConverter::HarpPedalLogAToStr(harpPedalLog_A data) const
     return value;
 }
 
-harpPedalLog_A AttConverter::StrToHarpPedalLogA(std::string value) const
+harpPedalLog_A AttConverter::StrToHarpPedalLogA(const std::string &value) const
 {
     if (value == "f") return harpPedalLog_A_f;
     if (value == "n") return harpPedalLog_A_n;
@@ -2179,7 +2179,7 @@ std::string AttConverter::HarpPedalLogBToStr(harpPedalLog_B data) const
     return value;
 }
 
-harpPedalLog_B AttConverter::StrToHarpPedalLogB(std::string value) const
+harpPedalLog_B AttConverter::StrToHarpPedalLogB(const std::string &value) const
 {
     if (value == "f") return harpPedalLog_B_f;
     if (value == "n") return harpPedalLog_B_n;
@@ -2203,7 +2203,7 @@ std::string AttConverter::HarpPedalLogCToStr(harpPedalLog_C data) const
     return value;
 }
 
-harpPedalLog_C AttConverter::StrToHarpPedalLogC(std::string value) const
+harpPedalLog_C AttConverter::StrToHarpPedalLogC(const std::string &value) const
 {
     if (value == "f") return harpPedalLog_C_f;
     if (value == "n") return harpPedalLog_C_n;
@@ -2227,7 +2227,7 @@ std::string AttConverter::HarpPedalLogDToStr(harpPedalLog_D data) const
     return value;
 }
 
-harpPedalLog_D AttConverter::StrToHarpPedalLogD(std::string value) const
+harpPedalLog_D AttConverter::StrToHarpPedalLogD(const std::string &value) const
 {
     if (value == "f") return harpPedalLog_D_f;
     if (value == "n") return harpPedalLog_D_n;
@@ -2251,7 +2251,7 @@ std::string AttConverter::HarpPedalLogEToStr(harpPedalLog_E data) const
     return value;
 }
 
-harpPedalLog_E AttConverter::StrToHarpPedalLogE(std::string value) const
+harpPedalLog_E AttConverter::StrToHarpPedalLogE(const std::string &value) const
 {
     if (value == "f") return harpPedalLog_E_f;
     if (value == "n") return harpPedalLog_E_n;
@@ -2275,7 +2275,7 @@ std::string AttConverter::HarpPedalLogFToStr(harpPedalLog_F data) const
     return value;
 }
 
-harpPedalLog_F AttConverter::StrToHarpPedalLogF(std::string value) const
+harpPedalLog_F AttConverter::StrToHarpPedalLogF(const std::string &value) const
 {
     if (value == "f") return harpPedalLog_F_f;
     if (value == "n") return harpPedalLog_F_n;
@@ -2299,7 +2299,7 @@ std::string AttConverter::HarpPedalLogGToStr(harpPedalLog_G data) const
     return value;
 }
 
-harpPedalLog_G AttConverter::StrToHarpPedalLogG(std::string value) const
+harpPedalLog_G AttConverter::StrToHarpPedalLogG(const std::string &value) const
 {
     if (value == "f") return harpPedalLog_G_f;
     if (value == "n") return harpPedalLog_G_n;
@@ -2321,7 +2321,7 @@ std::string AttConverter::MeiversionMeiversionToStr(meiversion_MEIVERSION data)
     return value;
 }
 
-meiversion_MEIVERSION AttConverter::StrToMeiversionMeiversion(std::string value) const
+meiversion_MEIVERSION AttConverter::StrToMeiversionMeiversion(const std::string &value) const
 {
     if (value == "3.0.0") return meiversion_MEIVERSION_3_0_0;
     LogWarning("Unsupported value '%s' for att.meiversion@meiversion", value.c_str());
@@ -2342,7 +2342,7 @@ std::string AttConverter::MensurVisFormToStr(mensurVis_FORM data) const
     return value;
 }
 
-mensurVis_FORM AttConverter::StrToMensurVisForm(std::string value) const
+mensurVis_FORM AttConverter::StrToMensurVisForm(const std::string &value) const
 {
     if (value == "horizontal") return mensurVis_FORM_horizontal;
     if (value == "vertical") return mensurVis_FORM_vertical;
@@ -2364,7 +2364,7 @@ std::string AttConverter::MensuralVisMensurformToStr(mensuralVis_MENSURFORM data
     return value;
 }
 
-mensuralVis_MENSURFORM AttConverter::StrToMensuralVisMensurform(std::string value) const
+mensuralVis_MENSURFORM AttConverter::StrToMensuralVisMensurform(const std::string &value) const
 {
     if (value == "horizontal") return mensuralVis_MENSURFORM_horizontal;
     if (value == "vertical") return mensuralVis_MENSURFORM_vertical;
@@ -2388,7 +2388,7 @@ std::string AttConverter::MeterSigVisFormToStr(meterSigVis_FORM data) const
     return value;
 }
 
-meterSigVis_FORM AttConverter::StrToMeterSigVisForm(std::string value) const
+meterSigVis_FORM AttConverter::StrToMeterSigVisForm(const std::string &value) const
 {
     if (value == "num") return meterSigVis_FORM_num;
     if (value == "denomsym") return meterSigVis_FORM_denomsym;
@@ -2414,7 +2414,7 @@ std::string AttConverter::MeterSigDefaultVisMeterrendToStr(meterSigDefaultVis_ME
     return value;
 }
 
-meterSigDefaultVis_METERREND AttConverter::StrToMeterSigDefaultVisMeterrend(std::string value) const
+meterSigDefaultVis_METERREND AttConverter::StrToMeterSigDefaultVisMeterrend(const std::string &value) const
 {
     if (value == "num") return meterSigDefaultVis_METERREND_num;
     if (value == "denomsym") return meterSigDefaultVis_METERREND_denomsym;
@@ -2439,7 +2439,7 @@ std::string AttConverter::MeterSigGrpLogFuncToStr(meterSigGrpLog_FUNC data) cons
     return value;
 }
 
-meterSigGrpLog_FUNC AttConverter::StrToMeterSigGrpLogFunc(std::string value) const
+meterSigGrpLog_FUNC AttConverter::StrToMeterSigGrpLogFunc(const std::string &value) const
 {
     if (value == "alternating") return meterSigGrpLog_FUNC_alternating;
     if (value == "interchanging") return meterSigGrpLog_FUNC_interchanging;
@@ -2463,7 +2463,7 @@ std::string AttConverter::MeterconformanceMetconToStr(meterconformance_METCON da
     return value;
 }
 
-meterconformance_METCON AttConverter::StrToMeterconformanceMetcon(std::string value) const
+meterconformance_METCON AttConverter::StrToMeterconformanceMetcon(const std::string &value) const
 {
     if (value == "c") return meterconformance_METCON_c;
     if (value == "i") return meterconformance_METCON_i;
@@ -2486,7 +2486,7 @@ std::string AttConverter::MordentLogFormToStr(mordentLog_FORM data) const
     return value;
 }
 
-mordentLog_FORM AttConverter::StrToMordentLogForm(std::string value) const
+mordentLog_FORM AttConverter::StrToMordentLogForm(const std::string &value) const
 {
     if (value == "inv") return mordentLog_FORM_inv;
     if (value == "norm") return mordentLog_FORM_norm;
@@ -2508,7 +2508,7 @@ std::string AttConverter::NoteLogMensuralLigToStr(noteLogMensural_LIG data) cons
     return value;
 }
 
-noteLogMensural_LIG AttConverter::StrToNoteLogMensuralLig(std::string value) const
+noteLogMensural_LIG AttConverter::StrToNoteLogMensuralLig(const std::string &value) const
 {
     if (value == "recta") return noteLogMensural_LIG_recta;
     if (value == "obliqua") return noteLogMensural_LIG_obliqua;
@@ -2529,7 +2529,7 @@ std::string AttConverter::OctaveLogCollToStr(octaveLog_COLL data) const
     return value;
 }
 
-octaveLog_COLL AttConverter::StrToOctaveLogColl(std::string value) const
+octaveLog_COLL AttConverter::StrToOctaveLogColl(const std::string &value) const
 {
     if (value == "coll") return octaveLog_COLL_coll;
     LogWarning("Unsupported value '%s' for att.octave.log@coll", value.c_str());
@@ -2550,7 +2550,7 @@ std::string AttConverter::PbVisFoliumToStr(pbVis_FOLIUM data) const
     return value;
 }
 
-pbVis_FOLIUM AttConverter::StrToPbVisFolium(std::string value) const
+pbVis_FOLIUM AttConverter::StrToPbVisFolium(const std::string &value) const
 {
     if (value == "verso") return pbVis_FOLIUM_verso;
     if (value == "recto") return pbVis_FOLIUM_recto;
@@ -2574,7 +2574,7 @@ std::string AttConverter::PedalLogDirToStr(pedalLog_DIR data) const
     return value;
 }
 
-pedalLog_DIR AttConverter::StrToPedalLogDir(std::string value) const
+pedalLog_DIR AttConverter::StrToPedalLogDir(const std::string &value) const
 {
     if (value == "down") return pedalLog_DIR_down;
     if (value == "up") return pedalLog_DIR_up;
@@ -2599,7 +2599,7 @@ std::string AttConverter::PedalVisFormToStr(pedalVis_FORM data) const
     return value;
 }
 
-pedalVis_FORM AttConverter::StrToPedalVisForm(std::string value) const
+pedalVis_FORM AttConverter::StrToPedalVisForm(const std::string &value) const
 {
     if (value == "line") return pedalVis_FORM_line;
     if (value == "pedstar") return pedalVis_FORM_pedstar;
@@ -2623,7 +2623,7 @@ std::string AttConverter::PianopedalsPedalstyleToStr(pianopedals_PEDALSTYLE data
     return value;
 }
 
-pianopedals_PEDALSTYLE AttConverter::StrToPianopedalsPedalstyle(std::string value) const
+pianopedals_PEDALSTYLE AttConverter::StrToPianopedalsPedalstyle(const std::string &value) const
 {
     if (value == "line") return pianopedals_PEDALSTYLE_line;
     if (value == "pedstar") return pianopedals_PEDALSTYLE_pedstar;
@@ -2648,7 +2648,7 @@ std::string AttConverter::PointingXlinkactuateToStr(pointing_XLINKACTUATE data)
     return value;
 }
 
-pointing_XLINKACTUATE AttConverter::StrToPointingXlinkactuate(std::string value) const
+pointing_XLINKACTUATE AttConverter::StrToPointingXlinkactuate(const std::string &value) const
 {
     if (value == "onLoad") return pointing_XLINKACTUATE_onLoad;
     if (value == "onRequest") return pointing_XLINKACTUATE_onRequest;
@@ -2675,7 +2675,7 @@ std::string AttConverter::PointingXlinkshowToStr(pointing_XLINKSHOW data) const
     return value;
 }
 
-pointing_XLINKSHOW AttConverter::StrToPointingXlinkshow(std::string value) const
+pointing_XLINKSHOW AttConverter::StrToPointingXlinkshow(const std::string &value) const
 {
     if (value == "new") return pointing_XLINKSHOW_new;
     if (value == "replace") return pointing_XLINKSHOW_replace;
@@ -2700,7 +2700,7 @@ std::string AttConverter::RegularmethodMethodToStr(regularmethod_METHOD data) co
     return value;
 }
 
-regularmethod_METHOD AttConverter::StrToRegularmethodMethod(std::string value) const
+regularmethod_METHOD AttConverter::StrToRegularmethodMethod(const std::string &value) const
 {
     if (value == "silent") return regularmethod_METHOD_silent;
     if (value == "tags") return regularmethod_METHOD_tags;
@@ -2723,7 +2723,7 @@ std::string AttConverter::RehearsalRehencloseToStr(rehearsal_REHENCLOSE data) co
     return value;
 }
 
-rehearsal_REHENCLOSE AttConverter::StrToRehearsalRehenclose(std::string value) const
+rehearsal_REHENCLOSE AttConverter::StrToRehearsalRehenclose(const std::string &value) const
 {
     if (value == "box") return rehearsal_REHENCLOSE_box;
     if (value == "circle") return rehearsal_REHENCLOSE_circle;
@@ -2745,7 +2745,7 @@ std::string AttConverter::SbVisFormToStr(sbVis_FORM data) const
     return value;
 }
 
-sbVis_FORM AttConverter::StrToSbVisForm(std::string value) const
+sbVis_FORM AttConverter::StrToSbVisForm(const std::string &value) const
 {
     if (value == "hash") return sbVis_FORM_hash;
     LogWarning("Unsupported value '%s' for att.sb.vis@form", value.c_str());
@@ -2769,7 +2769,7 @@ std::string AttConverter::StaffgroupingsymSymbolToStr(staffgroupingsym_SYMBOL da
     return value;
 }
 
-staffgroupingsym_SYMBOL AttConverter::StrToStaffgroupingsymSymbol(std::string value) const
+staffgroupingsym_SYMBOL AttConverter::StrToStaffgroupingsymSymbol(const std::string &value) const
 {
     if (value == "brace") return staffgroupingsym_SYMBOL_brace;
     if (value == "bracket") return staffgroupingsym_SYMBOL_bracket;
@@ -2800,7 +2800,7 @@ std::string AttConverter::SylLogConToStr(sylLog_CON data) const
     return value;
 }
 
-sylLog_CON AttConverter::StrToSylLogCon(std::string value) const
+sylLog_CON AttConverter::StrToSylLogCon(const std::string &value) const
 {
     if (value == "s") return sylLog_CON_s;
     if (value == "d") return sylLog_CON_d;
@@ -2829,7 +2829,7 @@ std::string AttConverter::SylLogWordposToStr(sylLog_WORDPOS data) const
     return value;
 }
 
-sylLog_WORDPOS AttConverter::StrToSylLogWordpos(std::string value) const
+sylLog_WORDPOS AttConverter::StrToSylLogWordpos(const std::string &value) const
 {
     if (value == "i") return sylLog_WORDPOS_i;
     if (value == "m") return sylLog_WORDPOS_m;
@@ -2853,7 +2853,7 @@ std::string AttConverter::TargetevalEvaluateToStr(targeteval_EVALUATE data) cons
     return value;
 }
 
-targeteval_EVALUATE AttConverter::StrToTargetevalEvaluate(std::string value) const
+targeteval_EVALUATE AttConverter::StrToTargetevalEvaluate(const std::string &value) const
 {
     if (value == "all") return targeteval_EVALUATE_all;
     if (value == "one") return targeteval_EVALUATE_one;
@@ -2878,7 +2878,7 @@ std::string AttConverter::TempoLogFuncToStr(tempoLog_FUNC data) const
     return value;
 }
 
-tempoLog_FUNC AttConverter::StrToTempoLogFunc(std::string value) const
+tempoLog_FUNC AttConverter::StrToTempoLogFunc(const std::string &value) const
 {
     if (value == "continuous") return tempoLog_FUNC_continuous;
     if (value == "instantaneous") return tempoLog_FUNC_instantaneous;
@@ -2902,7 +2902,7 @@ std::string AttConverter::TupletVisNumformatToStr(tupletVis_NUMFORMAT data) cons
     return value;
 }
 
-tupletVis_NUMFORMAT AttConverter::StrToTupletVisNumformat(std::string value) const
+tupletVis_NUMFORMAT AttConverter::StrToTupletVisNumformat(const std::string &value) const
 {
     if (value == "count") return tupletVis_NUMFORMAT_count;
     if (value == "ratio") return tupletVis_NUMFORMAT_ratio;
@@ -2924,7 +2924,7 @@ std::string AttConverter::TurnLogFormToStr(turnLog_FORM data) const
     return value;
 }
 
-turnLog_FORM AttConverter::StrToTurnLogForm(std::string value) const
+turnLog_FORM AttConverter::StrToTurnLogForm(const std::string &value) const
 {
     if (value == "inv") return turnLog_FORM_inv;
     if (value == "norm") return turnLog_FORM_norm;
@@ -2946,7 +2946,7 @@ std::string AttConverter::WhitespaceXmlspaceToStr(whitespace_XMLSPACE data) cons
     return value;
 }
 
-whitespace_XMLSPACE AttConverter::StrToWhitespaceXmlspace(std::string value) const
+whitespace_XMLSPACE AttConverter::StrToWhitespaceXmlspace(const std::string &value) const
 {
     if (value == "default") return whitespace_XMLSPACE_default;
     if (value == "preserve") return whitespace_XMLSPACE_preserve;
@@ -32,7 +32,7 @@ namespace vrv {
 class AttCommonAnl : public Att {
 public:
     AttCommonAnl();
-    virtual ~AttCommonAnl();
+    ~AttCommonAnl();
 
     /** Reset the default values for the attribute class **/
     void ResetCommonAnl();
@@ -104,7 +104,7 @@ private:
 class AttHarmonicfunction : public Att {
 public:
     AttHarmonicfunction();
-    virtual ~AttHarmonicfunction();
+    ~AttHarmonicfunction();
 
     /** Reset the default values for the attribute class **/
     void ResetHarmonicfunction();
@@ -146,7 +146,7 @@ private:
 class AttIntervalharmonic : public Att {
 public:
     AttIntervalharmonic();
-    virtual ~AttIntervalharmonic();
+    ~AttIntervalharmonic();
 
     /** Reset the default values for the attribute class **/
     void ResetIntervalharmonic();
@@ -182,7 +182,7 @@ private:
 class AttIntervalmelodic : public Att {
 public:
     AttIntervalmelodic();
-    virtual ~AttIntervalmelodic();
+    ~AttIntervalmelodic();
 
     /** Reset the default values for the attribute class **/
     void ResetIntervalmelodic();
@@ -223,7 +223,7 @@ private:
 class AttMelodicfunction : public Att {
 public:
     AttMelodicfunction();
-    virtual ~AttMelodicfunction();
+    ~AttMelodicfunction();
 
     /** Reset the default values for the attribute class **/
     void ResetMelodicfunction();
@@ -259,7 +259,7 @@ private:
 class AttPitchclass : public Att {
 public:
     AttPitchclass();
-    virtual ~AttPitchclass();
+    ~AttPitchclass();
 
     /** Reset the default values for the attribute class **/
     void ResetPitchclass();
@@ -295,7 +295,7 @@ private:
 class AttSolfa : public Att {
 public:
     AttSolfa();
-    virtual ~AttSolfa();
+    ~AttSolfa();
 
     /** Reset the default values for the attribute class **/
     void ResetSolfa();
@@ -32,7 +32,7 @@ namespace vrv {
 class AttArpegLog : public Att {
 public:
     AttArpegLog();
-    virtual ~AttArpegLog();
+    ~AttArpegLog();
 
     /** Reset the default values for the attribute class **/
     void ResetArpegLog();
@@ -68,7 +68,7 @@ private:
 class AttArpegVis : public Att {
 public:
     AttArpegVis();
-    virtual ~AttArpegVis();
+    ~AttArpegVis();
 
     /** Reset the default values for the attribute class **/
     void ResetArpegVis();
@@ -104,7 +104,7 @@ private:
 class AttBTremLog : public Att {
 public:
     AttBTremLog();
-    virtual ~AttBTremLog();
+    ~AttBTremLog();
 
     /** Reset the default values for the attribute class **/
     void ResetBTremLog();
@@ -140,7 +140,7 @@ private:
 class AttBeamed : public Att {
 public:
     AttBeamed();
-    virtual ~AttBeamed();
+    ~AttBeamed();
 
     /** Reset the default values for the attribute class **/
     void ResetBeamed();
@@ -176,7 +176,7 @@ private:
 class AttBeamedwith : public Att {
 public:
     AttBeamedwith();
-    virtual ~AttBeamedwith();
+    ~AttBeamedwith();
 
     /** Reset the default values for the attribute class **/
     void ResetBeamedwith();
@@ -216,7 +216,7 @@ private:
 class AttBeamingLog : public Att {
 public:
     AttBeamingLog();
-    virtual ~AttBeamingLog();
+    ~AttBeamingLog();
 
     /** Reset the default values for the attribute class **/
     void ResetBeamingLog();
@@ -264,7 +264,7 @@ private:
 class AttBeamrend : public Att {
 public:
     AttBeamrend();
-    virtual ~AttBeamrend();
+    ~AttBeamrend();
 
     /** Reset the default values for the attribute class **/
     void ResetBeamrend();
@@ -306,7 +306,7 @@ private:
 class AttBeamsecondary : public Att {
 public:
     AttBeamsecondary();
-    virtual ~AttBeamsecondary();
+    ~AttBeamsecondary();
 
     /** Reset the default values for the attribute class **/
     void ResetBeamsecondary();
@@ -347,7 +347,7 @@ private:
 class AttBeatRptLog : public Att {
 public:
     AttBeatRptLog();
-    virtual ~AttBeatRptLog();
+    ~AttBeatRptLog();
 
     /** Reset the default values for the attribute class **/
     void ResetBeatRptLog();
@@ -383,7 +383,7 @@ private:
 class AttBeatRptVis : public Att {
 public:
     AttBeatRptVis();
-    virtual ~AttBeatRptVis();
+    ~AttBeatRptVis();
 
     /** Reset the default values for the attribute class **/
     void ResetBeatRptVis();
@@ -419,7 +419,7 @@ private:
 class AttBendGes : public Att {
 public:
     AttBendGes();
-    virtual ~AttBendGes();
+    ~AttBendGes();
 
     /** Reset the default values for the attribute class **/
     void ResetBendGes();
@@ -458,7 +458,7 @@ private:
 class AttCutout : public Att {
 public:
     AttCutout();
-    virtual ~AttCutout();
+    ~AttCutout();
 
     /** Reset the default values for the attribute class **/
     void ResetCutout();
@@ -494,7 +494,7 @@ private:
 class AttExpandable : public Att {
 public:
     AttExpandable();
-    virtual ~AttExpandable();
+    ~AttExpandable();
 
     /** Reset the default values for the attribute class **/
     void ResetExpandable();
@@ -535,7 +535,7 @@ private:
 class AttFTremLog : public Att {
 public:
     AttFTremLog();
-    virtual ~AttFTremLog();
+    ~AttFTremLog();
 
     /** Reset the default values for the attribute class **/
     void ResetFTremLog();
@@ -571,7 +571,7 @@ private:
 class AttFermataVis : public Att {
 public:
     AttFermataVis();
-    virtual ~AttFermataVis();
+    ~AttFermataVis();
 
     /** Reset the default values for the attribute class **/
     void ResetFermataVis();
@@ -613,7 +613,7 @@ private:
 class AttGraced : public Att {
 public:
     AttGraced();
-    virtual ~AttGraced();
+    ~AttGraced();
 
     /** Reset the default values for the attribute class **/
     void ResetGraced();
@@ -658,7 +658,7 @@ private:
 class AttHairpinLog : public Att {
 public:
     AttHairpinLog();
-    virtual ~AttHairpinLog();
+    ~AttHairpinLog();
 
     /** Reset the default values for the attribute class **/
     void ResetHairpinLog();
@@ -704,7 +704,7 @@ private:
 class AttHairpinVis : public Att {
 public:
     AttHairpinVis();
-    virtual ~AttHairpinVis();
+    ~AttHairpinVis();
 
     /** Reset the default values for the attribute class **/
     void ResetHairpinVis();
@@ -743,7 +743,7 @@ private:
 class AttHarpPedalLog : public Att {
 public:
     AttHarpPedalLog();
-    virtual ~AttHarpPedalLog();
+    ~AttHarpPedalLog();
 
     /** Reset the default values for the attribute class **/
     void ResetHarpPedalLog();
@@ -815,7 +815,7 @@ private:
 class AttLvpresent : public Att {
 public:
     AttLvpresent();
-    virtual ~AttLvpresent();
+    ~AttLvpresent();
 
     /** Reset the default values for the attribute class **/
     void ResetLvpresent();
@@ -854,7 +854,7 @@ private:
 class AttMeterSigGrpLog : public Att {
 public:
     AttMeterSigGrpLog();
-    virtual ~AttMeterSigGrpLog();
+    ~AttMeterSigGrpLog();
 
     /** Reset the default values for the attribute class **/
     void ResetMeterSigGrpLog();
@@ -890,7 +890,7 @@ private:
 class AttMultiRestVis : public Att {
 public:
     AttMultiRestVis();
-    virtual ~AttMultiRestVis();
+    ~AttMultiRestVis();
 
     /** Reset the default values for the attribute class **/
     void ResetMultiRestVis();
@@ -930,7 +930,7 @@ private:
 class AttNoteGesCmn : public Att {
 public:
     AttNoteGesCmn();
-    virtual ~AttNoteGesCmn();
+    ~AttNoteGesCmn();
 
     /** Reset the default values for the attribute class **/
     void ResetNoteGesCmn();
@@ -966,7 +966,7 @@ private:
 class AttNumbered : public Att {
 public:
     AttNumbered();
-    virtual ~AttNumbered();
+    ~AttNumbered();
 
     /** Reset the default values for the attribute class **/
     void ResetNumbered();
@@ -1005,7 +1005,7 @@ private:
 class AttNumberplacement : public Att {
 public:
     AttNumberplacement();
-    virtual ~AttNumberplacement();
+    ~AttNumberplacement();
 
     /** Reset the default values for the attribute class **/
     void ResetNumberplacement();
@@ -1047,7 +1047,7 @@ private:
 class AttOctaveLog : public Att {
 public:
     AttOctaveLog();
-    virtual ~AttOctaveLog();
+    ~AttOctaveLog();
 
     /** Reset the default values for the attribute class **/
     void ResetOctaveLog();
@@ -1089,7 +1089,7 @@ private:
 class AttPedalLog : public Att {
 public:
     AttPedalLog();
-    virtual ~AttPedalLog();
+    ~AttPedalLog();
 
     /** Reset the default values for the attribute class **/
     void ResetPedalLog();
@@ -1125,7 +1125,7 @@ private:
 class AttPedalVis : public Att {
 public:
     AttPedalVis();
-    virtual ~AttPedalVis();
+    ~AttPedalVis();
 
     /** Reset the default values for the attribute class **/
     void ResetPedalVis();
@@ -1161,7 +1161,7 @@ private:
 class AttPianopedals : public Att {
 public:
     AttPianopedals();
-    virtual ~AttPianopedals();
+    ~AttPianopedals();
 
     /** Reset the default values for the attribute class **/
     void ResetPianopedals();
@@ -1197,7 +1197,7 @@ private:
 class AttRehearsal : public Att {
 public:
     AttRehearsal();
-    virtual ~AttRehearsal();
+    ~AttRehearsal();
 
     /** Reset the default values for the attribute class **/
     void ResetRehearsal();
@@ -1233,7 +1233,7 @@ private:
 class AttScoreDefVisCmn : public Att {
 public:
     AttScoreDefVisCmn();
-    virtual ~AttScoreDefVisCmn();
+    ~AttScoreDefVisCmn();
 
     /** Reset the default values for the attribute class **/
     void ResetScoreDefVisCmn();
@@ -1269,7 +1269,7 @@ private:
 class AttSlurrend : public Att {
 public:
     AttSlurrend();
-    virtual ~AttSlurrend();
+    ~AttSlurrend();
 
     /** Reset the default values for the attribute class **/
     void ResetSlurrend();
@@ -1311,7 +1311,7 @@ private:
 class AttStemsCmn : public Att {
 public:
     AttStemsCmn();
-    virtual ~AttStemsCmn();
+    ~AttStemsCmn();
 
     /** Reset the default values for the attribute class **/
     void ResetStemsCmn();
@@ -1351,7 +1351,7 @@ private:
 class AttTierend : public Att {
 public:
     AttTierend();
-    virtual ~AttTierend();
+    ~AttTierend();
 
     /** Reset the default values for the attribute class **/
     void ResetTierend();
@@ -1393,7 +1393,7 @@ private:
 class AttTremmeasured : public Att {
 public:
     AttTremmeasured();
-    virtual ~AttTremmeasured();
+    ~AttTremmeasured();
 
     /** Reset the default values for the attribute class **/
     void ResetTremmeasured();
@@ -1429,7 +1429,7 @@ private:
 class AttTupletVis : public Att {
 public:
     AttTupletVis();
-    virtual ~AttTupletVis();
+    ~AttTupletVis();
 
     /** Reset the default values for the attribute class **/
     void ResetTupletVis();
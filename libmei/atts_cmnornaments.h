@@ -32,7 +32,7 @@ namespace vrv {
 class AttMordentLog : public Att {
 public:
     AttMordentLog();
-    virtual ~AttMordentLog();
+    ~AttMordentLog();
 
     /** Reset the default values for the attribute class **/
     void ResetMordentLog();
@@ -77,7 +77,7 @@ private:
 class AttOrnam : public Att {
 public:
     AttOrnam();
-    virtual ~AttOrnam();
+    ~AttOrnam();
 
     /** Reset the default values for the attribute class **/
     void ResetOrnam();
@@ -117,7 +117,7 @@ private:
 class AttOrnamentaccid : public Att {
 public:
     AttOrnamentaccid();
-    virtual ~AttOrnamentaccid();
+    ~AttOrnamentaccid();
 
     /** Reset the default values for the attribute class **/
     void ResetOrnamentaccid();
@@ -159,7 +159,7 @@ private:
 class AttTurnLog : public Att {
 public:
     AttTurnLog();
-    virtual ~AttTurnLog();
+    ~AttTurnLog();
 
     /** Reset the default values for the attribute class **/
     void ResetTurnLog();
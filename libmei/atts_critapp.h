@@ -32,7 +32,7 @@ namespace vrv {
 class AttCrit : public Att {
 public:
     AttCrit();
-    virtual ~AttCrit();
+    ~AttCrit();
 
     /** Reset the default values for the attribute class **/
     void ResetCrit();
@@ -71,7 +71,7 @@ private:
 class AttSource : public Att {
 public:
     AttSource();
-    virtual ~AttSource();
+    ~AttSource();
 
     /** Reset the default values for the attribute class **/
     void ResetSource();
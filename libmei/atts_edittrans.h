@@ -32,7 +32,7 @@ namespace vrv {
 class AttAgentident : public Att {
 public:
     AttAgentident();
-    virtual ~AttAgentident();
+    ~AttAgentident();
 
     /** Reset the default values for the attribute class **/
     void ResetAgentident();
@@ -71,7 +71,7 @@ private:
 class AttEvidence : public Att {
 public:
     AttEvidence();
-    virtual ~AttEvidence();
+    ~AttEvidence();
 
     /** Reset the default values for the attribute class **/
     void ResetEvidence();
@@ -117,7 +117,7 @@ private:
 class AttExtent : public Att {
 public:
     AttExtent();
-    virtual ~AttExtent();
+    ~AttExtent();
 
     /** Reset the default values for the attribute class **/
     void ResetExtent();
@@ -153,7 +153,7 @@ private:
 class AttReasonident : public Att {
 public:
     AttReasonident();
-    virtual ~AttReasonident();
+    ~AttReasonident();
 
     /** Reset the default values for the attribute class **/
     void ResetReasonident();
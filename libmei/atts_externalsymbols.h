@@ -32,7 +32,7 @@ namespace vrv {
 class AttExtsym : public Att {
 public:
     AttExtsym();
-    virtual ~AttExtsym();
+    ~AttExtsym();
 
     /** Reset the default values for the attribute class **/
     void ResetExtsym();
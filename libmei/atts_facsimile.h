@@ -32,7 +32,7 @@ namespace vrv {
 class AttFacsimile : public Att {
 public:
     AttFacsimile();
-    virtual ~AttFacsimile();
+    ~AttFacsimile();
 
     /** Reset the default values for the attribute class **/
     void ResetFacsimile();
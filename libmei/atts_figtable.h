@@ -32,7 +32,7 @@ namespace vrv {
 class AttTabular : public Att {
 public:
     AttTabular();
-    virtual ~AttTabular();
+    ~AttTabular();
 
     /** Reset the default values for the attribute class **/
     void ResetTabular();
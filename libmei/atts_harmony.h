@@ -32,7 +32,7 @@ namespace vrv {
 class AttFretlocation : public Att {
 public:
     AttFretlocation();
-    virtual ~AttFretlocation();
+    ~AttFretlocation();
 
     /** Reset the default values for the attribute class **/
     void ResetFretlocation();
@@ -68,7 +68,7 @@ private:
 class AttHarmLog : public Att {
 public:
     AttHarmLog();
-    virtual ~AttHarmLog();
+    ~AttHarmLog();
 
     /** Reset the default values for the attribute class **/
     void ResetHarmLog();
@@ -104,7 +104,7 @@ private:
 class AttHarmVis : public Att {
 public:
     AttHarmVis();
-    virtual ~AttHarmVis();
+    ~AttHarmVis();
 
     /** Reset the default values for the attribute class **/
     void ResetHarmVis();
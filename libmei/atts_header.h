@@ -32,7 +32,7 @@ namespace vrv {
 class AttRegularmethod : public Att {
 public:
     AttRegularmethod();
-    virtual ~AttRegularmethod();
+    ~AttRegularmethod();
 
     /** Reset the default values for the attribute class **/
     void ResetRegularmethod();
@@ -32,7 +32,7 @@ namespace vrv {
 class AttVerseLog : public Att {
 public:
     AttVerseLog();
-    virtual ~AttVerseLog();
+    ~AttVerseLog();
 
     /** Reset the default values for the attribute class **/
     void ResetVerseLog();
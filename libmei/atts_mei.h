@@ -32,7 +32,7 @@ namespace vrv {
 class AttNotationtype : public Att {
 public:
     AttNotationtype();
-    virtual ~AttNotationtype();
+    ~AttNotationtype();
 
     /** Reset the default values for the attribute class **/
     void ResetNotationtype();
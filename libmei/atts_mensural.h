@@ -32,7 +32,7 @@ namespace vrv {
 class AttLigatureLog : public Att {
 public:
     AttLigatureLog();
-    virtual ~AttLigatureLog();
+    ~AttLigatureLog();
 
     /** Reset the default values for the attribute class **/
     void ResetLigatureLog();
@@ -68,7 +68,7 @@ private:
 class AttMensurVis : public Att {
 public:
     AttMensurVis();
-    virtual ~AttMensurVis();
+    ~AttMensurVis();
 
     /** Reset the default values for the attribute class **/
     void ResetMensurVis();
@@ -110,7 +110,7 @@ private:
 class AttMensuralLog : public Att {
 public:
     AttMensuralLog();
-    virtual ~AttMensuralLog();
+    ~AttMensuralLog();
 
     /** Reset the default values for the attribute class **/
     void ResetMensuralLog();
@@ -181,7 +181,7 @@ private:
 class AttMensuralShared : public Att {
 public:
     AttMensuralShared();
-    virtual ~AttMensuralShared();
+    ~AttMensuralShared();
 
     /** Reset the default values for the attribute class **/
     void ResetMensuralShared();
@@ -235,7 +235,7 @@ private:
 class AttMensuralVis : public Att {
 public:
     AttMensuralVis();
-    virtual ~AttMensuralVis();
+    ~AttMensuralVis();
 
     /** Reset the default values for the attribute class **/
     void ResetMensuralVis();
@@ -298,7 +298,7 @@ private:
 class AttNoteLogMensural : public Att {
 public:
     AttNoteLogMensural();
-    virtual ~AttNoteLogMensural();
+    ~AttNoteLogMensural();
 
     /** Reset the default values for the attribute class **/
     void ResetNoteLogMensural();
@@ -334,7 +334,7 @@ private:
 class AttRestVisMensural : public Att {
 public:
     AttRestVisMensural();
-    virtual ~AttRestVisMensural();
+    ~AttRestVisMensural();
 
     /** Reset the default values for the attribute class **/
     void ResetRestVisMensural();
@@ -32,7 +32,7 @@ namespace vrv {
 class AttChannelized : public Att {
 public:
     AttChannelized();
-    virtual ~AttChannelized();
+    ~AttChannelized();
 
     /** Reset the default values for the attribute class **/
     void ResetChannelized();
@@ -86,7 +86,7 @@ private:
 class AttMidiinstrument : public Att {
 public:
     AttMidiinstrument();
-    virtual ~AttMidiinstrument();
+    ~AttMidiinstrument();
 
     /** Reset the default values for the attribute class **/
     void ResetMidiinstrument();
@@ -143,7 +143,7 @@ private:
 class AttMidinumber : public Att {
 public:
     AttMidinumber();
-    virtual ~AttMidinumber();
+    ~AttMidinumber();
 
     /** Reset the default values for the attribute class **/
     void ResetMidinumber();
@@ -182,7 +182,7 @@ private:
 class AttMiditempo : public Att {
 public:
     AttMiditempo();
-    virtual ~AttMiditempo();
+    ~AttMiditempo();
 
     /** Reset the default values for the attribute class **/
     void ResetMiditempo();
@@ -233,7 +233,7 @@ private:
 class AttMidivalue : public Att {
 public:
     AttMidivalue();
-    virtual ~AttMidivalue();
+    ~AttMidivalue();
 
     /** Reset the default values for the attribute class **/
     void ResetMidivalue();
@@ -269,7 +269,7 @@ private:
 class AttMidivalue2 : public Att {
 public:
     AttMidivalue2();
-    virtual ~AttMidivalue2();
+    ~AttMidivalue2();
 
     /** Reset the default values for the attribute class **/
     void ResetMidivalue2();
@@ -305,7 +305,7 @@ private:
 class AttMidivelocity : public Att {
 public:
     AttMidivelocity();
-    virtual ~AttMidivelocity();
+    ~AttMidivelocity();
 
     /** Reset the default values for the attribute class **/
     void ResetMidivelocity();
@@ -341,7 +341,7 @@ private:
 class AttTimebase : public Att {
 public:
     AttTimebase();
-    virtual ~AttTimebase();
+    ~AttTimebase();
 
     /** Reset the default values for the attribute class **/
     void ResetTimebase();
@@ -32,7 +32,7 @@ namespace vrv {
 class AttIneumeLog : public Att {
 public:
     AttIneumeLog();
-    virtual ~AttIneumeLog();
+    ~AttIneumeLog();
 
     /** Reset the default values for the attribute class **/
     void ResetIneumeLog();
@@ -74,7 +74,7 @@ private:
 class AttUneumeLog : public Att {
 public:
     AttUneumeLog();
-    virtual ~AttUneumeLog();
+    ~AttUneumeLog();
 
     /** Reset the default values for the attribute class **/
     void ResetUneumeLog();
@@ -32,7 +32,7 @@ namespace vrv {
 class AttSurface : public Att {
 public:
     AttSurface();
-    virtual ~AttSurface();
+    ~AttSurface();
 
     /** Reset the default values for the attribute class **/
     void ResetSurface();
@@ -32,7 +32,7 @@ namespace vrv {
 class AttAlignment : public Att {
 public:
     AttAlignment();
-    virtual ~AttAlignment();
+    ~AttAlignment();
 
     /** Reset the default values for the attribute class **/
     void ResetAlignment();
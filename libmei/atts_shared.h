@@ -32,7 +32,7 @@ namespace vrv {
 class AttAccidLog : public Att {
 public:
     AttAccidLog();
-    virtual ~AttAccidLog();
+    ~AttAccidLog();
 
     /** Reset the default values for the attribute class **/
     void ResetAccidLog();
@@ -68,7 +68,7 @@ private:
 class AttAccidental : public Att {
 public:
     AttAccidental();
-    virtual ~AttAccidental();
+    ~AttAccidental();
 
     /** Reset the default values for the attribute class **/
     void ResetAccidental();
@@ -104,7 +104,7 @@ private:
 class AttAccidentalPerformed : public Att {
 public:
     AttAccidentalPerformed();
-    virtual ~AttAccidentalPerformed();
+    ~AttAccidentalPerformed();
 
     /** Reset the default values for the attribute class **/
     void ResetAccidentalPerformed();
@@ -140,7 +140,7 @@ private:
 class AttArticulation : public Att {
 public:
     AttArticulation();
-    virtual ~AttArticulation();
+    ~AttArticulation();
 
     /** Reset the default values for the attribute class **/
     void ResetArticulation();
@@ -182,7 +182,7 @@ private:
 class AttArticulationPerformed : public Att {
 public:
     AttArticulationPerformed();
-    virtual ~AttArticulationPerformed();
+    ~AttArticulationPerformed();
 
     /** Reset the default values for the attribute class **/
     void ResetArticulationPerformed();
@@ -218,7 +218,7 @@ private:
 class AttAugmentdots : public Att {
 public:
     AttAugmentdots();
-    virtual ~AttAugmentdots();
+    ~AttAugmentdots();
 
     /** Reset the default values for the attribute class **/
     void ResetAugmentdots();
@@ -254,7 +254,7 @@ private:
 class AttAuthorized : public Att {
 public:
     AttAuthorized();
-    virtual ~AttAuthorized();
+    ~AttAuthorized();
 
     /** Reset the default values for the attribute class **/
     void ResetAuthorized();
@@ -302,7 +302,7 @@ private:
 class AttBarLineLog : public Att {
 public:
     AttBarLineLog();
-    virtual ~AttBarLineLog();
+    ~AttBarLineLog();
 
     /** Reset the default values for the attribute class **/
     void ResetBarLineLog();
@@ -338,7 +338,7 @@ private:
 class AttBarplacement : public Att {
 public:
     AttBarplacement();
-    virtual ~AttBarplacement();
+    ~AttBarplacement();
 
     /** Reset the default values for the attribute class **/
     void ResetBarplacement();
@@ -389,7 +389,7 @@ private:
 class AttBeamingVis : public Att {
 public:
     AttBeamingVis();
-    virtual ~AttBeamingVis();
+    ~AttBeamingVis();
 
     /** Reset the default values for the attribute class **/
     void ResetBeamingVis();
@@ -437,7 +437,7 @@ private:
 class AttBibl : public Att {
 public:
     AttBibl();
-    virtual ~AttBibl();
+    ~AttBibl();
 
     /** Reset the default values for the attribute class **/
     void ResetBibl();
@@ -476,7 +476,7 @@ private:
 class AttCalendared : public Att {
 public:
     AttCalendared();
-    virtual ~AttCalendared();
+    ~AttCalendared();
 
     /** Reset the default values for the attribute class **/
     void ResetCalendared();
@@ -515,7 +515,7 @@ private:
 class AttCanonical : public Att {
 public:
     AttCanonical();
-    virtual ~AttCanonical();
+    ~AttCanonical();
 
     /** Reset the default values for the attribute class **/
     void ResetCanonical();
@@ -555,7 +555,7 @@ private:
 class AttChordVis : public Att {
 public:
     AttChordVis();
-    virtual ~AttChordVis();
+    ~AttChordVis();
 
     /** Reset the default values for the attribute class **/
     void ResetChordVis();
@@ -596,7 +596,7 @@ private:
 class AttClasscodeident : public Att {
 public:
     AttClasscodeident();
-    virtual ~AttClasscodeident();
+    ~AttClasscodeident();
 
     /** Reset the default values for the attribute class **/
     void ResetClasscodeident();
@@ -636,7 +636,7 @@ private:
 class AttClefLog : public Att {
 public:
     AttClefLog();
-    virtual ~AttClefLog();
+    ~AttClefLog();
 
     /** Reset the default values for the attribute class **/
     void ResetClefLog();
@@ -675,7 +675,7 @@ private:
 class AttCleffingLog : public Att {
 public:
     AttCleffingLog();
-    virtual ~AttCleffingLog();
+    ~AttCleffingLog();
 
     /** Reset the default values for the attribute class **/
     void ResetCleffingLog();
@@ -733,7 +733,7 @@ private:
 class AttCleffingVis : public Att {
 public:
     AttCleffingVis();
-    virtual ~AttCleffingVis();
+    ~AttCleffingVis();
 
     /** Reset the default values for the attribute class **/
     void ResetCleffingVis();
@@ -775,7 +775,7 @@ private:
 class AttClefshape : public Att {
 public:
     AttClefshape();
-    virtual ~AttClefshape();
+    ~AttClefshape();
 
     /** Reset the default values for the attribute class **/
     void ResetClefshape();
@@ -811,7 +811,7 @@ private:
 class AttColor : public Att {
 public:
     AttColor();
-    virtual ~AttColor();
+    ~AttColor();
 
     /** Reset the default values for the attribute class **/
     void ResetColor();
@@ -850,7 +850,7 @@ private:
 class AttColoration : public Att {
 public:
     AttColoration();
-    virtual ~AttColoration();
+    ~AttColoration();
 
     /** Reset the default values for the attribute class **/
     void ResetColoration();
@@ -893,7 +893,7 @@ private:
 class AttCommon : public Att {
 public:
     AttCommon();
-    virtual ~AttCommon();
+    ~AttCommon();
 
     /** Reset the default values for the attribute class **/
     void ResetCommon();
@@ -929,7 +929,7 @@ private:
 class AttCommonPart : public Att {
 public:
     AttCommonPart();
-    virtual ~AttCommonPart();
+    ~AttCommonPart();
 
     /** Reset the default values for the attribute class **/
     void ResetCommonPart();
@@ -974,7 +974,7 @@ private:
 class AttCoordinated : public Att {
 public:
     AttCoordinated();
-    virtual ~AttCoordinated();
+    ~AttCoordinated();
 
     /** Reset the default values for the attribute class **/
     void ResetCoordinated();
@@ -1028,7 +1028,7 @@ private:
 class AttCurvature : public Att {
 public:
     AttCurvature();
-    virtual ~AttCurvature();
+    ~AttCurvature();
 
     /** Reset the default values for the attribute class **/
     void ResetCurvature();
@@ -1087,7 +1087,7 @@ private:
 class AttCurverend : public Att {
 public:
     AttCurverend();
-    virtual ~AttCurverend();
+    ~AttCurverend();
 
     /** Reset the default values for the attribute class **/
     void ResetCurverend();
@@ -1129,7 +1129,7 @@ private:
 class AttCustosLog : public Att {
 public:
     AttCustosLog();
-    virtual ~AttCustosLog();
+    ~AttCustosLog();
 
     /** Reset the default values for the attribute class **/
     void ResetCustosLog();
@@ -1168,7 +1168,7 @@ private:
 class AttDatable : public Att {
 public:
     AttDatable();
-    virtual ~AttDatable();
+    ~AttDatable();
 
     /** Reset the default values for the attribute class **/
     void ResetDatable();
@@ -1228,7 +1228,7 @@ private:
 class AttDatapointing : public Att {
 public:
     AttDatapointing();
-    virtual ~AttDatapointing();
+    ~AttDatapointing();
 
     /** Reset the default values for the attribute class **/
     void ResetDatapointing();
@@ -1264,7 +1264,7 @@ private:
 class AttDeclaring : public Att {
 public:
     AttDeclaring();
-    virtual ~AttDeclaring();
+    ~AttDeclaring();
 
     /** Reset the default values for the attribute class **/
     void ResetDeclaring();
@@ -1303,7 +1303,7 @@ private:
 class AttDistances : public Att {
 public:
     AttDistances();
-    virtual ~AttDistances();
+    ~AttDistances();
 
     /** Reset the default values for the attribute class **/
     void ResetDistances();
@@ -1354,7 +1354,7 @@ private:
 class AttDotLog : public Att {
 public:
     AttDotLog();
-    virtual ~AttDotLog();
+    ~AttDotLog();
 
     /** Reset the default values for the attribute class **/
     void ResetDotLog();
@@ -1390,7 +1390,7 @@ private:
 class AttDurationAdditive : public Att {
 public:
     AttDurationAdditive();
-    virtual ~AttDurationAdditive();
+    ~AttDurationAdditive();
 
     /** Reset the default values for the attribute class **/
     void ResetDurationAdditive();
@@ -1432,7 +1432,7 @@ private:
 class AttDurationDefault : public Att {
 public:
     AttDurationDefault();
-    virtual ~AttDurationDefault();
+    ~AttDurationDefault();
 
     /** Reset the default values for the attribute class **/
     void ResetDurationDefault();
@@ -1490,7 +1490,7 @@ private:
 class AttDurationMusical : public Att {
 public:
     AttDurationMusical();
-    virtual ~AttDurationMusical();
+    ~AttDurationMusical();
 
     /** Reset the default values for the attribute class **/
     void ResetDurationMusical();
@@ -1532,7 +1532,7 @@ private:
 class AttDurationPerformed : public Att {
 public:
     AttDurationPerformed();
-    virtual ~AttDurationPerformed();
+    ~AttDurationPerformed();
 
     /** Reset the default values for the attribute class **/
     void ResetDurationPerformed();
@@ -1573,7 +1573,7 @@ private:
 class AttDurationRatio : public Att {
 public:
     AttDurationRatio();
-    virtual ~AttDurationRatio();
+    ~AttDurationRatio();
 
     /** Reset the default values for the attribute class **/
     void ResetDurationRatio();
@@ -1621,7 +1621,7 @@ private:
 class AttEnclosingchars : public Att {
 public:
     AttEnclosingchars();
-    virtual ~AttEnclosingchars();
+    ~AttEnclosingchars();
 
     /** Reset the default values for the attribute class **/
     void ResetEnclosingchars();
@@ -1662,7 +1662,7 @@ private:
 class AttEndings : public Att {
 public:
     AttEndings();
-    virtual ~AttEndings();
+    ~AttEndings();
 
     /** Reset the default values for the attribute class **/
     void ResetEndings();
@@ -1698,7 +1698,7 @@ private:
 class AttExtender : public Att {
 public:
     AttExtender();
-    virtual ~AttExtender();
+    ~AttExtender();
 
     /** Reset the default values for the attribute class **/
     void ResetExtender();
@@ -1734,7 +1734,7 @@ private:
 class AttFermatapresent : public Att {
 public:
     AttFermatapresent();
-    virtual ~AttFermatapresent();
+    ~AttFermatapresent();
 
     /** Reset the default values for the attribute class **/
     void ResetFermatapresent();
@@ -1774,7 +1774,7 @@ private:
 class AttFiling : public Att {
 public:
     AttFiling();
-    virtual ~AttFiling();
+    ~AttFiling();
 
     /** Reset the default values for the attribute class **/
     void ResetFiling();
@@ -1813,7 +1813,7 @@ private:
 class AttGrpSymLog : public Att {
 public:
     AttGrpSymLog();
-    virtual ~AttGrpSymLog();
+    ~AttGrpSymLog();
 
     /** Reset the default values for the attribute class **/
     void ResetGrpSymLog();
@@ -1849,7 +1849,7 @@ private:
 class AttHandident : public Att {
 public:
     AttHandident();
-    virtual ~AttHandident();
+    ~AttHandident();
 
     /** Reset the default values for the attribute class **/
     void ResetHandident();
@@ -1888,7 +1888,7 @@ private:
 class AttHeight : public Att {
 public:
     AttHeight();
-    virtual ~AttHeight();
+    ~AttHeight();
 
     /** Reset the default values for the attribute class **/
     void ResetHeight();
@@ -1924,7 +1924,7 @@ private:
 class AttHorizontalalign : public Att {
 public:
     AttHorizontalalign();
-    virtual ~AttHorizontalalign();
+    ~AttHorizontalalign();
 
     /** Reset the default values for the attribute class **/
     void ResetHorizontalalign();
@@ -1960,7 +1960,7 @@ private:
 class AttInstrumentident : public Att {
 public:
     AttInstrumentident();
-    virtual ~AttInstrumentident();
+    ~AttInstrumentident();
 
     /** Reset the default values for the attribute class **/
     void ResetInstrumentident();
@@ -1999,7 +1999,7 @@ private:
 class AttInternetmedia : public Att {
 public:
     AttInternetmedia();
-    virtual ~AttInternetmedia();
+    ~AttInternetmedia();
 
     /** Reset the default values for the attribute class **/
     void ResetInternetmedia();
@@ -2039,7 +2039,7 @@ private:
 class AttJoined : public Att {
 public:
     AttJoined();
-    virtual ~AttJoined();
+    ~AttJoined();
 
     /** Reset the default values for the attribute class **/
     void ResetJoined();
@@ -2082,7 +2082,7 @@ private:
 class AttKeySigLog : public Att {
 public:
     AttKeySigLog();
-    virtual ~AttKeySigLog();
+    ~AttKeySigLog();
 
     /** Reset the default values for the attribute class **/
     void ResetKeySigLog();
@@ -2140,7 +2140,7 @@ private:
 class AttKeySigVis : public Att {
 public:
     AttKeySigVis();
-    virtual ~AttKeySigVis();
+    ~AttKeySigVis();
 
     /** Reset the default values for the attribute class **/
     void ResetKeySigVis();
@@ -2176,7 +2176,7 @@ private:
 class AttKeySigDefaultLog : public Att {
 public:
     AttKeySigDefaultLog();
-    virtual ~AttKeySigDefaultLog();
+    ~AttKeySigDefaultLog();
 
     /** Reset the default values for the attribute class **/
     void ResetKeySigDefaultLog();
@@ -2252,7 +2252,7 @@ private:
 class AttKeySigDefaultVis : public Att {
 public:
     AttKeySigDefaultVis();
-    virtual ~AttKeySigDefaultVis();
+    ~AttKeySigDefaultVis();
 
     /** Reset the default values for the attribute class **/
     void ResetKeySigDefaultVis();
@@ -2294,7 +2294,7 @@ private:
 class AttLabelsAddl : public Att {
 public:
     AttLabelsAddl();
-    virtual ~AttLabelsAddl();
+    ~AttLabelsAddl();
 
     /** Reset the default values for the attribute class **/
     void ResetLabelsAddl();
@@ -2333,7 +2333,7 @@ private:
 class AttLang : public Att {
 public:
     AttLang();
-    virtual ~AttLang();
+    ~AttLang();
 
     /** Reset the default values for the attribute class **/
     void ResetLang();
@@ -2375,7 +2375,7 @@ private:
 class AttLayerLog : public Att {
 public:
     AttLayerLog();
-    virtual ~AttLayerLog();
+    ~AttLayerLog();
 
     /** Reset the default values for the attribute class **/
     void ResetLayerLog();
@@ -2411,7 +2411,7 @@ private:
 class AttLayerident : public Att {
 public:
     AttLayerident();
-    virtual ~AttLayerident();
+    ~AttLayerident();
 
     /** Reset the default values for the attribute class **/
     void ResetLayerident();
@@ -2447,7 +2447,7 @@ private:
 class AttLineVis : public Att {
 public:
     AttLineVis();
-    virtual ~AttLineVis();
+    ~AttLineVis();
 
     /** Reset the default values for the attribute class **/
     void ResetLineVis();
@@ -2513,7 +2513,7 @@ private:
 class AttLineloc : public Att {
 public:
     AttLineloc();
-    virtual ~AttLineloc();
+    ~AttLineloc();
 
     /** Reset the default values for the attribute class **/
     void ResetLineloc();
@@ -2553,7 +2553,7 @@ private:
 class AttLinerend : public Att {
 public:
     AttLinerend();
-    virtual ~AttLinerend();
+    ~AttLinerend();
 
     /** Reset the default values for the attribute class **/
     void ResetLinerend();
@@ -2607,7 +2607,7 @@ private:
 class AttLinerendBase : public Att {
 public:
     AttLinerendBase();
-    virtual ~AttLinerendBase();
+    ~AttLinerendBase();
 
     /** Reset the default values for the attribute class **/
     void ResetLinerendBase();
@@ -2649,7 +2649,7 @@ private:
 class AttLyricstyle : public Att {
 public:
     AttLyricstyle();
-    virtual ~AttLyricstyle();
+    ~AttLyricstyle();
 
     /** Reset the default values for the attribute class **/
     void ResetLyricstyle();
@@ -2715,7 +2715,7 @@ private:
 class AttMeasureLog : public Att {
 public:
     AttMeasureLog();
-    virtual ~AttMeasureLog();
+    ~AttMeasureLog();
 
     /** Reset the default values for the attribute class **/
     void ResetMeasureLog();
@@ -2761,7 +2761,7 @@ private:
 class AttMeasurement : public Att {
 public:
     AttMeasurement();
-    virtual ~AttMeasurement();
+    ~AttMeasurement();
 
     /** Reset the default values for the attribute class **/
     void ResetMeasurement();
@@ -2797,7 +2797,7 @@ private:
 class AttMeasurenumbers : public Att {
 public:
     AttMeasurenumbers();
-    virtual ~AttMeasurenumbers();
+    ~AttMeasurenumbers();
 
     /** Reset the default values for the attribute class **/
     void ResetMeasurenumbers();
@@ -2833,7 +2833,7 @@ private:
 class AttMediabounds : public Att {
 public:
     AttMediabounds();
-    virtual ~AttMediabounds();
+    ~AttMediabounds();
 
     /** Reset the default values for the attribute class **/
     void ResetMediabounds();
@@ -2894,7 +2894,7 @@ private:
 class AttMedium : public Att {
 public:
     AttMedium();
-    virtual ~AttMedium();
+    ~AttMedium();
 
     /** Reset the default values for the attribute class **/
     void ResetMedium();
@@ -2930,7 +2930,7 @@ private:
 class AttMeiversion : public Att {
 public:
     AttMeiversion();
-    virtual ~AttMeiversion();
+    ~AttMeiversion();
 
     /** Reset the default values for the attribute class **/
     void ResetMeiversion();
@@ -2966,7 +2966,7 @@ private:
 class AttMensurLog : public Att {
 public:
     AttMensurLog();
-    virtual ~AttMensurLog();
+    ~AttMensurLog();
 
     /** Reset the default values for the attribute class **/
     void ResetMensurLog();
@@ -3008,7 +3008,7 @@ private:
 class AttMeterSigLog : public Att {
 public:
     AttMeterSigLog();
-    virtual ~AttMeterSigLog();
+    ~AttMeterSigLog();
 
     /** Reset the default values for the attribute class **/
     void ResetMeterSigLog();
@@ -3064,7 +3064,7 @@ private:
 class AttMeterSigVis : public Att {
 public:
     AttMeterSigVis();
-    virtual ~AttMeterSigVis();
+    ~AttMeterSigVis();
 
     /** Reset the default values for the attribute class **/
     void ResetMeterSigVis();
@@ -3100,7 +3100,7 @@ private:
 class AttMeterSigDefaultLog : public Att {
 public:
     AttMeterSigDefaultLog();
-    virtual ~AttMeterSigDefaultLog();
+    ~AttMeterSigDefaultLog();
 
     /** Reset the default values for the attribute class **/
     void ResetMeterSigDefaultLog();
@@ -3150,7 +3150,7 @@ private:
 class AttMeterSigDefaultVis : public Att {
 public:
     AttMeterSigDefaultVis();
-    virtual ~AttMeterSigDefaultVis();
+    ~AttMeterSigDefaultVis();
 
     /** Reset the default values for the attribute class **/
     void ResetMeterSigDefaultVis();
@@ -3204,7 +3204,7 @@ private:
 class AttMeterconformance : public Att {
 public:
     AttMeterconformance();
-    virtual ~AttMeterconformance();
+    ~AttMeterconformance();
 
     /** Reset the default values for the attribute class **/
     void ResetMeterconformance();
@@ -3243,7 +3243,7 @@ private:
 class AttMeterconformanceBar : public Att {
 public:
     AttMeterconformanceBar();
-    virtual ~AttMeterconformanceBar();
+    ~AttMeterconformanceBar();
 
     /** Reset the default values for the attribute class **/
     void ResetMeterconformanceBar();
@@ -3294,7 +3294,7 @@ private:
 class AttMmtempo : public Att {
 public:
     AttMmtempo();
-    virtual ~AttMmtempo();
+    ~AttMmtempo();
 
     /** Reset the default values for the attribute class **/
     void ResetMmtempo();
@@ -3348,7 +3348,7 @@ private:
 class AttMultinummeasures : public Att {
 public:
     AttMultinummeasures();
-    virtual ~AttMultinummeasures();
+    ~AttMultinummeasures();
 
     /** Reset the default values for the attribute class **/
     void ResetMultinummeasures();
@@ -3387,7 +3387,7 @@ private:
 class AttName : public Att {
 public:
     AttName();
-    virtual ~AttName();
+    ~AttName();
 
     /** Reset the default values for the attribute class **/
     void ResetName();
@@ -3436,7 +3436,7 @@ private:
 class AttNotationstyle : public Att {
 public:
     AttNotationstyle();
-    virtual ~AttNotationstyle();
+    ~AttNotationstyle();
 
     /** Reset the default values for the attribute class **/
     void ResetNotationstyle();
@@ -3478,7 +3478,7 @@ private:
 class AttNoteGes : public Att {
 public:
     AttNoteGes();
-    virtual ~AttNoteGes();
+    ~AttNoteGes();
 
     /** Reset the default values for the attribute class **/
     void ResetNoteGes();
@@ -3526,7 +3526,7 @@ private:
 class AttNoteheads : public Att {
 public:
     AttNoteheads();
-    virtual ~AttNoteheads();
+    ~AttNoteheads();
 
     /** Reset the default values for the attribute class **/
     void ResetNoteheads();
@@ -3605,7 +3605,7 @@ private:
 class AttOctave : public Att {
 public:
     AttOctave();
-    virtual ~AttOctave();
+    ~AttOctave();
 
     /** Reset the default values for the attribute class **/
     void ResetOctave();
@@ -3641,7 +3641,7 @@ private:
 class AttOctavedefault : public Att {
 public:
     AttOctavedefault();
-    virtual ~AttOctavedefault();
+    ~AttOctavedefault();
 
     /** Reset the default values for the attribute class **/
     void ResetOctavedefault();
@@ -3681,7 +3681,7 @@ private:
 class AttOctavedisplacement : public Att {
 public:
     AttOctavedisplacement();
-    virtual ~AttOctavedisplacement();
+    ~AttOctavedisplacement();
 
     /** Reset the default values for the attribute class **/
     void ResetOctavedisplacement();
@@ -3723,7 +3723,7 @@ private:
 class AttOnelinestaff : public Att {
 public:
     AttOnelinestaff();
-    virtual ~AttOnelinestaff();
+    ~AttOnelinestaff();
 
     /** Reset the default values for the attribute class **/
     void ResetOnelinestaff();
@@ -3763,7 +3763,7 @@ private:
 class AttOptimization : public Att {
 public:
     AttOptimization();
-    virtual ~AttOptimization();
+    ~AttOptimization();
 
     /** Reset the default values for the attribute class **/
     void ResetOptimization();
@@ -3802,7 +3802,7 @@ private:
 class AttOriginLayerident : public Att {
 public:
     AttOriginLayerident();
-    virtual ~AttOriginLayerident();
+    ~AttOriginLayerident();
 
     /** Reset the default values for the attribute class **/
     void ResetOriginLayerident();
@@ -3838,7 +3838,7 @@ private:
 class AttOriginStaffident : public Att {
 public:
     AttOriginStaffident();
-    virtual ~AttOriginStaffident();
+    ~AttOriginStaffident();
 
     /** Reset the default values for the attribute class **/
     void ResetOriginStaffident();
@@ -3877,7 +3877,7 @@ private:
 class AttOriginStartendid : public Att {
 public:
     AttOriginStartendid();
-    virtual ~AttOriginStartendid();
+    ~AttOriginStartendid();
 
     /** Reset the default values for the attribute class **/
     void ResetOriginStartendid();
@@ -3919,7 +3919,7 @@ private:
 class AttOriginTimestampMusical : public Att {
 public:
     AttOriginTimestampMusical();
-    virtual ~AttOriginTimestampMusical();
+    ~AttOriginTimestampMusical();
 
     /** Reset the default values for the attribute class **/
     void ResetOriginTimestampMusical();
@@ -3968,7 +3968,7 @@ private:
 class AttPadLog : public Att {
 public:
     AttPadLog();
-    virtual ~AttPadLog();
+    ~AttPadLog();
 
     /** Reset the default values for the attribute class **/
     void ResetPadLog();
@@ -4007,7 +4007,7 @@ private:
 class AttPages : public Att {
 public:
     AttPages();
-    virtual ~AttPages();
+    ~AttPages();
 
     /** Reset the default values for the attribute class **/
     void ResetPages();
@@ -4091,7 +4091,7 @@ private:
 class AttPbVis : public Att {
 public:
     AttPbVis();
-    virtual ~AttPbVis();
+    ~AttPbVis();
 
     /** Reset the default values for the attribute class **/
     void ResetPbVis();
@@ -4130,7 +4130,7 @@ private:
 class AttPitch : public Att {
 public:
     AttPitch();
-    virtual ~AttPitch();
+    ~AttPitch();
 
     /** Reset the default values for the attribute class **/
     void ResetPitch();
@@ -4166,7 +4166,7 @@ private:
 class AttPlacement : public Att {
 public:
     AttPlacement();
-    virtual ~AttPlacement();
+    ~AttPlacement();
 
     /** Reset the default values for the attribute class **/
     void ResetPlacement();
@@ -4205,7 +4205,7 @@ private:
 class AttPlist : public Att {
 public:
     AttPlist();
-    virtual ~AttPlist();
+    ~AttPlist();
 
     /** Reset the default values for the attribute class **/
     void ResetPlist();
@@ -4245,7 +4245,7 @@ private:
 class AttPointing : public Att {
 public:
     AttPointing();
-    virtual ~AttPointing();
+    ~AttPointing();
 
     /** Reset the default values for the attribute class **/
     void ResetPointing();
@@ -4315,7 +4315,7 @@ private:
 class AttQuantity : public Att {
 public:
     AttQuantity();
-    virtual ~AttQuantity();
+    ~AttQuantity();
 
     /** Reset the default values for the attribute class **/
     void ResetQuantity();
@@ -4354,7 +4354,7 @@ private:
 class AttRelativesize : public Att {
 public:
     AttRelativesize();
-    virtual ~AttRelativesize();
+    ~AttRelativesize();
 
     /** Reset the default values for the attribute class **/
     void ResetRelativesize();
@@ -4390,7 +4390,7 @@ private:
 class AttResponsibility : public Att {
 public:
     AttResponsibility();
-    virtual ~AttResponsibility();
+    ~AttResponsibility();
 
     /** Reset the default values for the attribute class **/
     void ResetResponsibility();
@@ -4430,7 +4430,7 @@ private:
 class AttSbVis : public Att {
 public:
     AttSbVis();
-    virtual ~AttSbVis();
+    ~AttSbVis();
 
     /** Reset the default values for the attribute class **/
     void ResetSbVis();
@@ -4466,7 +4466,7 @@ private:
 class AttScalable : public Att {
 public:
     AttScalable();
-    virtual ~AttScalable();
+    ~AttScalable();
 
     /** Reset the default values for the attribute class **/
     void ResetScalable();
@@ -4502,7 +4502,7 @@ private:
 class AttScoreDefGes : public Att {
 public:
     AttScoreDefGes();
-    virtual ~AttScoreDefGes();
+    ~AttScoreDefGes();
 
     /** Reset the default values for the attribute class **/
     void ResetScoreDefGes();
@@ -4550,7 +4550,7 @@ private:
 class AttScoreDefVis : public Att {
 public:
     AttScoreDefVis();
-    virtual ~AttScoreDefVis();
+    ~AttScoreDefVis();
 
     /** Reset the default values for the attribute class **/
     void ResetScoreDefVis();
@@ -4590,7 +4590,7 @@ private:
 class AttSectionVis : public Att {
 public:
     AttSectionVis();
-    virtual ~AttSectionVis();
+    ~AttSectionVis();
 
     /** Reset the default values for the attribute class **/
     void ResetSectionVis();
@@ -4626,7 +4626,7 @@ private:
 class AttSequence : public Att {
 public:
     AttSequence();
-    virtual ~AttSequence();
+    ~AttSequence();
 
     /** Reset the default values for the attribute class **/
     void ResetSequence();
@@ -4665,7 +4665,7 @@ private:
 class AttSlashcount : public Att {
 public:
     AttSlashcount();
-    virtual ~AttSlashcount();
+    ~AttSlashcount();
 
     /** Reset the default values for the attribute class **/
     void ResetSlashcount();
@@ -4701,7 +4701,7 @@ private:
 class AttSlurpresent : public Att {
 public:
     AttSlurpresent();
-    virtual ~AttSlurpresent();
+    ~AttSlurpresent();
 
     /** Reset the default values for the attribute class **/
     void ResetSlurpresent();
@@ -4741,7 +4741,7 @@ private:
 class AttSpaceVis : public Att {
 public:
     AttSpaceVis();
-    virtual ~AttSpaceVis();
+    ~AttSpaceVis();
 
     /** Reset the default values for the attribute class **/
     void ResetSpaceVis();
@@ -4780,7 +4780,7 @@ private:
 class AttSpacing : public Att {
 public:
     AttSpacing();
-    virtual ~AttSpacing();
+    ~AttSpacing();
 
     /** Reset the default values for the attribute class **/
     void ResetSpacing();
@@ -4843,7 +4843,7 @@ private:
 class AttStaffLog : public Att {
 public:
     AttStaffLog();
-    virtual ~AttStaffLog();
+    ~AttStaffLog();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffLog();
@@ -4879,7 +4879,7 @@ private:
 class AttStaffDefVis : public Att {
 public:
     AttStaffDefVis();
-    virtual ~AttStaffDefVis();
+    ~AttStaffDefVis();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffDefVis();
@@ -4957,7 +4957,7 @@ private:
 class AttStaffGrpVis : public Att {
 public:
     AttStaffGrpVis();
-    virtual ~AttStaffGrpVis();
+    ~AttStaffGrpVis();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffGrpVis();
@@ -4996,7 +4996,7 @@ private:
 class AttStaffgroupingsym : public Att {
 public:
     AttStaffgroupingsym();
-    virtual ~AttStaffgroupingsym();
+    ~AttStaffgroupingsym();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffgroupingsym();
@@ -5032,7 +5032,7 @@ private:
 class AttStaffident : public Att {
 public:
     AttStaffident();
-    virtual ~AttStaffident();
+    ~AttStaffident();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffident();
@@ -5072,7 +5072,7 @@ private:
 class AttStaffloc : public Att {
 public:
     AttStaffloc();
-    virtual ~AttStaffloc();
+    ~AttStaffloc();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffloc();
@@ -5108,7 +5108,7 @@ private:
 class AttStafflocPitched : public Att {
 public:
     AttStafflocPitched();
-    virtual ~AttStafflocPitched();
+    ~AttStafflocPitched();
 
     /** Reset the default values for the attribute class **/
     void ResetStafflocPitched();
@@ -5150,7 +5150,7 @@ private:
 class AttStartendid : public Att {
 public:
     AttStartendid();
-    virtual ~AttStartendid();
+    ~AttStartendid();
 
     /** Reset the default values for the attribute class **/
     void ResetStartendid();
@@ -5189,7 +5189,7 @@ private:
 class AttStartid : public Att {
 public:
     AttStartid();
-    virtual ~AttStartid();
+    ~AttStartid();
 
     /** Reset the default values for the attribute class **/
     void ResetStartid();
@@ -5228,7 +5228,7 @@ private:
 class AttStems : public Att {
 public:
     AttStems();
-    virtual ~AttStems();
+    ~AttStems();
 
     /** Reset the default values for the attribute class **/
     void ResetStems();
@@ -5297,7 +5297,7 @@ private:
 class AttSylLog : public Att {
 public:
     AttSylLog();
-    virtual ~AttSylLog();
+    ~AttSylLog();
 
     /** Reset the default values for the attribute class **/
     void ResetSylLog();
@@ -5342,7 +5342,7 @@ private:
 class AttSyltext : public Att {
 public:
     AttSyltext();
-    virtual ~AttSyltext();
+    ~AttSyltext();
 
     /** Reset the default values for the attribute class **/
     void ResetSyltext();
@@ -5378,7 +5378,7 @@ private:
 class AttSystems : public Att {
 public:
     AttSystems();
-    virtual ~AttSystems();
+    ~AttSystems();
 
     /** Reset the default values for the attribute class **/
     void ResetSystems();
@@ -5445,7 +5445,7 @@ private:
 class AttTargeteval : public Att {
 public:
     AttTargeteval();
-    virtual ~AttTargeteval();
+    ~AttTargeteval();
 
     /** Reset the default values for the attribute class **/
     void ResetTargeteval();
@@ -5484,7 +5484,7 @@ private:
 class AttTempoLog : public Att {
 public:
     AttTempoLog();
-    virtual ~AttTempoLog();
+    ~AttTempoLog();
 
     /** Reset the default values for the attribute class **/
     void ResetTempoLog();
@@ -5520,7 +5520,7 @@ private:
 class AttTextstyle : public Att {
 public:
     AttTextstyle();
-    virtual ~AttTextstyle();
+    ~AttTextstyle();
 
     /** Reset the default values for the attribute class **/
     void ResetTextstyle();
@@ -5595,7 +5595,7 @@ private:
 class AttTiepresent : public Att {
 public:
     AttTiepresent();
-    virtual ~AttTiepresent();
+    ~AttTiepresent();
 
     /** Reset the default values for the attribute class **/
     void ResetTiepresent();
@@ -5635,7 +5635,7 @@ private:
 class AttTimestampMusical : public Att {
 public:
     AttTimestampMusical();
-    virtual ~AttTimestampMusical();
+    ~AttTimestampMusical();
 
     /** Reset the default values for the attribute class **/
     void ResetTimestampMusical();
@@ -5674,7 +5674,7 @@ private:
 class AttTimestampPerformed : public Att {
 public:
     AttTimestampPerformed();
-    virtual ~AttTimestampPerformed();
+    ~AttTimestampPerformed();
 
     /** Reset the default values for the attribute class **/
     void ResetTimestampPerformed();
@@ -5720,7 +5720,7 @@ private:
 class AttTimestamp2Musical : public Att {
 public:
     AttTimestamp2Musical();
-    virtual ~AttTimestamp2Musical();
+    ~AttTimestamp2Musical();
 
     /** Reset the default values for the attribute class **/
     void ResetTimestamp2Musical();
@@ -5759,7 +5759,7 @@ private:
 class AttTransposition : public Att {
 public:
     AttTransposition();
-    virtual ~AttTransposition();
+    ~AttTransposition();
 
     /** Reset the default values for the attribute class **/
     void ResetTransposition();
@@ -5807,7 +5807,7 @@ private:
 class AttTupletpresent : public Att {
 public:
     AttTupletpresent();
-    virtual ~AttTupletpresent();
+    ~AttTupletpresent();
 
     /** Reset the default values for the attribute class **/
     void ResetTupletpresent();
@@ -5847,7 +5847,7 @@ private:
 class AttTyped : public Att {
 public:
     AttTyped();
-    virtual ~AttTyped();
+    ~AttTyped();
 
     /** Reset the default values for the attribute class **/
     void ResetTyped();
@@ -5895,7 +5895,7 @@ private:
 class AttTypography : public Att {
 public:
     AttTypography();
-    virtual ~AttTypography();
+    ~AttTypography();
 
     /** Reset the default values for the attribute class **/
     void ResetTypography();
@@ -5959,7 +5959,7 @@ private:
 class AttVisibility : public Att {
 public:
     AttVisibility();
-    virtual ~AttVisibility();
+    ~AttVisibility();
 
     /** Reset the default values for the attribute class **/
     void ResetVisibility();
@@ -5998,7 +5998,7 @@ private:
 class AttVisualoffsetHo : public Att {
 public:
     AttVisualoffsetHo();
-    virtual ~AttVisualoffsetHo();
+    ~AttVisualoffsetHo();
 
     /** Reset the default values for the attribute class **/
     void ResetVisualoffsetHo();
@@ -6038,7 +6038,7 @@ private:
 class AttVisualoffsetTo : public Att {
 public:
     AttVisualoffsetTo();
-    virtual ~AttVisualoffsetTo();
+    ~AttVisualoffsetTo();
 
     /** Reset the default values for the attribute class **/
     void ResetVisualoffsetTo();
@@ -6077,7 +6077,7 @@ private:
 class AttVisualoffsetVo : public Att {
 public:
     AttVisualoffsetVo();
-    virtual ~AttVisualoffsetVo();
+    ~AttVisualoffsetVo();
 
     /** Reset the default values for the attribute class **/
     void ResetVisualoffsetVo();
@@ -6117,7 +6117,7 @@ private:
 class AttVisualoffset2Ho : public Att {
 public:
     AttVisualoffset2Ho();
-    virtual ~AttVisualoffset2Ho();
+    ~AttVisualoffset2Ho();
 
     /** Reset the default values for the attribute class **/
     void ResetVisualoffset2Ho();
@@ -6165,7 +6165,7 @@ private:
 class AttVisualoffset2To : public Att {
 public:
     AttVisualoffset2To();
-    virtual ~AttVisualoffset2To();
+    ~AttVisualoffset2To();
 
     /** Reset the default values for the attribute class **/
     void ResetVisualoffset2To();
@@ -6213,7 +6213,7 @@ private:
 class AttVisualoffset2Vo : public Att {
 public:
     AttVisualoffset2Vo();
-    virtual ~AttVisualoffset2Vo();
+    ~AttVisualoffset2Vo();
 
     /** Reset the default values for the attribute class **/
     void ResetVisualoffset2Vo();
@@ -6261,7 +6261,7 @@ private:
 class AttWhitespace : public Att {
 public:
     AttWhitespace();
-    virtual ~AttWhitespace();
+    ~AttWhitespace();
 
     /** Reset the default values for the attribute class **/
     void ResetWhitespace();
@@ -6297,7 +6297,7 @@ private:
 class AttWidth : public Att {
 public:
     AttWidth();
-    virtual ~AttWidth();
+    ~AttWidth();
 
     /** Reset the default values for the attribute class **/
     void ResetWidth();
@@ -6333,7 +6333,7 @@ private:
 class AttXy : public Att {
 public:
     AttXy();
-    virtual ~AttXy();
+    ~AttXy();
 
     /** Reset the default values for the attribute class **/
     void ResetXy();
@@ -6383,7 +6383,7 @@ private:
 class AttXy2 : public Att {
 public:
     AttXy2();
-    virtual ~AttXy2();
+    ~AttXy2();
 
     /** Reset the default values for the attribute class **/
     void ResetXy2();
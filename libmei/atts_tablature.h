@@ -32,7 +32,7 @@ namespace vrv {
 class AttNoteGesTablature : public Att {
 public:
     AttNoteGesTablature();
-    virtual ~AttNoteGesTablature();
+    ~AttNoteGesTablature();
 
     /** Reset the default values for the attribute class **/
     void ResetNoteGesTablature();
@@ -74,7 +74,7 @@ private:
 class AttStaffDefGesTablature : public Att {
 public:
     AttStaffDefGesTablature();
-    virtual ~AttStaffDefGesTablature();
+    ~AttStaffDefGesTablature();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffDefGesTablature();
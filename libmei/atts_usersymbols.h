@@ -32,7 +32,7 @@ namespace vrv {
 class AttAltsym : public Att {
 public:
     AttAltsym();
-    virtual ~AttAltsym();
+    ~AttAltsym();
 
     /** Reset the default values for the attribute class **/
     void ResetAltsym();
@@ -13,6 +13,7 @@
 %ignore vrv::Toolkit::GetCString( );
 %ignore vrv::Toolkit::GetLogString( );
 //%ignore vrv::Toolkit::ParseOptions( const std::string & );
+%ignore vrv::Toolkit::RenderToSvgStream( std::ostream &, int, bool );
 %ignore vrv::Toolkit::ResetLogBuffer( );
 %ignore vrv::Toolkit::SetShowBoundingBoxes( bool );
 %ignore vrv::Toolkit::SetCString( const std::string & );
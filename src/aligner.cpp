@@ -179,7 +179,7 @@ void StaffAlignment::SetVerseCount(int verse_count)
 int StaffAlignment::CalcOverflowAbove(BoundingBox *box)
 {
     if (box->Is() == FLOATING_POSITIONER) {
-        FloatingPositioner *positioner = dynamic_cast<FloatingPositioner *>(box);
+        FloatingPositioner *positioner = vrv_cast<FloatingPositioner *>(box);
         assert(positioner);
         return positioner->GetDrawingY() + positioner->m_contentBB_y2;
     }
@@ -189,7 +189,7 @@ int StaffAlignment::CalcOverflowAbove(BoundingBox *box)
 int StaffAlignment::CalcOverflowBelow(BoundingBox *box)
 {
     if (box->Is() == FLOATING_POSITIONER) {
-        FloatingPositioner *positioner = dynamic_cast<FloatingPositioner *>(box);
+        FloatingPositioner *positioner = vrv_cast<FloatingPositioner *>(box);
         assert(positioner);
         return -(positioner->GetDrawingY() + positioner->m_contentBB_y1 + m_staffHeight);
     }
@@ -343,7 +343,7 @@ void GraceAligner::AlignStack()
     int i;
     double time = 0.0;
     for (i = (int)m_noteStack.size(); i > 0; i--) {
-        Note *note = dynamic_cast<Note *>(m_noteStack.at(i - 1));
+        Note *note = vrv_cast<Note *>(m_noteStack.at(i - 1));
         assert(note);
         // get the duration of the event
         double duration = note->LayerElement::GetAlignmentDuration(NULL, NULL, false);
@@ -482,7 +482,7 @@ TimestampAttr *TimestampAligner::GetTimestampAtTime(double time)
 
 int StaffAlignment::CalcStaffOverlap(FunctorParams *functorParams)
 {
-    CalcStaffOverlapParams *params = dynamic_cast<CalcStaffOverlapParams *>(functorParams);
+    CalcStaffOverlapParams *params = vrv_cast<CalcStaffOverlapParams *>(functorParams);
     assert(params);
 
     // This is the bottom alignment (or something is wrong)
@@ -523,7 +523,7 @@ int StaffAlignment::CalcStaffOverlap(FunctorParams *functorParams)
 
 int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
 {
-    AdjustFloatingPostionersParams *params = dynamic_cast<AdjustFloatingPostionersParams *>(functorParams);
+    AdjustFloatingPostionersParams *params = vrv_cast<AdjustFloatingPostionersParams *>(functorParams);
     assert(params);
 
     int staffSize = this->GetStaffSize();
@@ -605,7 +605,7 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
 
 int StaffAlignment::AdjustFloatingPostionerGrps(FunctorParams *functorParams)
 {
-    AdjustFloatingPostionerGrpsParams *params = dynamic_cast<AdjustFloatingPostionerGrpsParams *>(functorParams);
+    AdjustFloatingPostionerGrpsParams *params = vrv_cast<AdjustFloatingPostionerGrpsParams *>(functorParams);
     assert(params);
 
     ArrayOfFloatingPositioners positioners;
@@ -658,7 +658,7 @@ int StaffAlignment::AdjustFloatingPostionerGrps(FunctorParams *functorParams)
 
 int StaffAlignment::SetAligmentYPos(FunctorParams *functorParams)
 {
-    SetAligmentYPosParams *params = dynamic_cast<SetAligmentYPosParams *>(functorParams);
+    SetAligmentYPosParams *params = vrv_cast<SetAligmentYPosParams *>(functorParams);
     assert(params);
 
     int maxOverlfowAbove;
@@ -692,7 +692,7 @@ int StaffAlignment::SetAligmentYPos(FunctorParams *functorParams)
 
 int StaffAlignment::IntegrateBoundingBoxYShift(FunctorParams *functorParams)
 {
-    IntegrateBoundingBoxYShiftParams *params = dynamic_cast<IntegrateBoundingBoxYShiftParams *>(functorParams);
+    IntegrateBoundingBoxYShiftParams *params = vrv_cast<IntegrateBoundingBoxYShiftParams *>(functorParams);
     assert(params);
 
     // integrates the m_yShift into the m_yRel
@@ -707,7 +707,7 @@ int StaffAlignment::IntegrateBoundingBoxYShift(FunctorParams *functorParams)
 
 int MeasureAligner::IntegrateBoundingBoxXShift(FunctorParams *functorParams)
 {
-    IntegrateBoundingBoxXShiftParams *params = dynamic_cast<IntegrateBoundingBoxXShiftParams *>(functorParams);
+    IntegrateBoundingBoxXShiftParams *params = vrv_cast<IntegrateBoundingBoxXShiftParams *>(functorParams);
     assert(params);
 
     params->m_shift = 0;
@@ -715,6 +715,18 @@ int MeasureAligner::IntegrateBoundingBoxXShift(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
+int Alignment::CalcMemoryFootprint(FunctorParams *functorParams)
+{
+    CalcMemoryFootprintParams *params = vrv_cast<CalcMemoryFootprintParams *>(functorParams);
+    assert(params);
+
+    Object::CalcMemoryFootprint(params);
+
+    if (m_graceAligner) m_graceAligner->Process(params->m_functor, params);
+
+    return FUNCTOR_CONTINUE;
+}
+
 int Alignment::IntegrateBoundingBoxGraceXShift(FunctorParams *functorParams)
 {
     if (!m_graceAligner) {
@@ -724,7 +736,7 @@ int Alignment::IntegrateBoundingBoxGraceXShift(FunctorParams *functorParams)
     int i;
     int shift = 0;
     for (i = 0; i < m_graceAligner->GetChildCount(); i++) {
-        Alignment *alignment = dynamic_cast<Alignment *>(m_graceAligner->GetChild(i));
+        Alignment *alignment = vrv_cast<Alignment *>(m_graceAligner->GetChild(i));
         assert(alignment);
         alignment->SetXRel(alignment->GetXShift() + shift);
         shift += alignment->GetXShift();
@@ -734,7 +746,7 @@ int Alignment::IntegrateBoundingBoxGraceXShift(FunctorParams *functorParams)
     if (m_graceAligner->GetChildCount() == 0) {
         return FUNCTOR_CONTINUE;
     }
-    Alignment *alignment = dynamic_cast<Alignment *>(m_graceAligner->GetLast());
+    Alignment *alignment = vrv_cast<Alignment *>(m_graceAligner->GetLast());
     assert(alignment);
     m_graceAligner->SetWidth(alignment->GetXRel() + alignment->GetMaxWidth());
 
@@ -743,7 +755,7 @@ int Alignment::IntegrateBoundingBoxGraceXShift(FunctorParams *functorParams)
 
 int Alignment::IntegrateBoundingBoxXShift(FunctorParams *functorParams)
 {
-    IntegrateBoundingBoxXShiftParams *params = dynamic_cast<IntegrateBoundingBoxXShiftParams *>(functorParams);
+    IntegrateBoundingBoxXShiftParams *params = vrv_cast<IntegrateBoundingBoxXShiftParams *>(functorParams);
     assert(params);
 
     // We move the first left position according to style but not for aligners that are empty and not
@@ -765,7 +777,7 @@ int Alignment::IntegrateBoundingBoxXShift(FunctorParams *functorParams)
 
 int Alignment::SetBoundingBoxXShift(FunctorParams *functorParams)
 {
-    SetBoundingBoxXShiftParams *params = dynamic_cast<SetBoundingBoxXShiftParams *>(functorParams);
+    SetBoundingBoxXShiftParams *params = vrv_cast<SetBoundingBoxXShiftParams *>(functorParams);
     assert(params);
 
     // Here we want to process only the left scoreDef up to the left barline
@@ -795,7 +807,7 @@ int Alignment::SetBoundingBoxXShift(FunctorParams *functorParams)
 
 int Alignment::SetBoundingBoxXShiftEnd(FunctorParams *functorParams)
 {
-    SetBoundingBoxXShiftParams *params = dynamic_cast<SetBoundingBoxXShiftParams *>(functorParams);
+    SetBoundingBoxXShiftParams *params = vrv_cast<SetBoundingBoxXShiftParams *>(functorParams);
     assert(params);
 
     // Because these do not get shifted with their bounding box because their bounding box is calculated
@@ -837,7 +849,7 @@ int Alignment::SetBoundingBoxXShiftEnd(FunctorParams *functorParams)
 
 int MeasureAligner::SetAlignmentXPos(FunctorParams *functorParams)
 {
-    SetAlignmentXPosParams *params = dynamic_cast<SetAlignmentXPosParams *>(functorParams);
+    SetAlignmentXPosParams *params = vrv_cast<SetAlignmentXPosParams *>(functorParams);
     assert(params);
 
     // We start a new MeasureAligner
@@ -875,7 +887,7 @@ int Alignment::HorizontalSpaceForDuration(
 
 int Alignment::SetAlignmentXPos(FunctorParams *functorParams)
 {
-    SetAlignmentXPosParams *params = dynamic_cast<SetAlignmentXPosParams *>(functorParams);
+    SetAlignmentXPosParams *params = vrv_cast<SetAlignmentXPosParams *>(functorParams);
     assert(params);
 
     // Do not set an x pos for anything before the barline (including it)
@@ -905,7 +917,7 @@ int Alignment::SetAlignmentXPos(FunctorParams *functorParams)
 
 int MeasureAligner::JustifyX(FunctorParams *functorParams)
 {
-    JustifyXParams *params = dynamic_cast<JustifyXParams *>(functorParams);
+    JustifyXParams *params = vrv_cast<JustifyXParams *>(functorParams);
     assert(params);
 
     params->m_leftBarLineX = GetLeftBarLineAlignment()->GetXRel();
@@ -916,7 +928,7 @@ int MeasureAligner::JustifyX(FunctorParams *functorParams)
 
 int Alignment::JustifyX(FunctorParams *functorParams)
 {
-    JustifyXParams *params = dynamic_cast<JustifyXParams *>(functorParams);
+    JustifyXParams *params = vrv_cast<JustifyXParams *>(functorParams);
     assert(params);
 
     if (m_type <= ALIGNMENT_MEASURE_LEFT_BARLINE) {
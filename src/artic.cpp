@@ -302,7 +302,7 @@ void ArticPart::AddSlurPositioner(FloatingPositioner *positioner, bool start)
 
 int Artic::AdjustArtic(FunctorParams *functorParams)
 {
-    AdjustArticParams *params = dynamic_cast<AdjustArticParams *>(functorParams);
+    AdjustArticParams *params = vrv_cast<AdjustArticParams *>(functorParams);
     assert(params);
 
     ArticPart *insidePart = this->GetInsidePart();
@@ -312,7 +312,7 @@ int Artic::AdjustArtic(FunctorParams *functorParams)
 
     if (insidePart) {
 
-        Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+        Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
         assert(staff);
         int margin = params->m_doc->GetTopMargin(insidePart->Is())
             * params->m_doc->GetDrawingUnit(staff->m_drawingStaffSize) / PARAM_DENOMINATOR;
@@ -374,7 +374,7 @@ int ArticPart::ResetVerticalAlignment(FunctorParams *functorParams)
 
 int ArticPart::AdjustArticWithSlurs(FunctorParams *functorParams)
 {
-    AdjustArticWithSlursParams *params = dynamic_cast<AdjustArticWithSlursParams *>(functorParams);
+    AdjustArticWithSlursParams *params = vrv_cast<AdjustArticWithSlursParams *>(functorParams);
     assert(params);
 
     if (m_startSlurPositioners.empty() && m_endSlurPositioners.empty()) return FUNCTOR_CONTINUE;
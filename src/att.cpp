@@ -31,7 +31,7 @@ Att::~Att()
 {
 }
 
-std::string Att::StrToStr(std::string str) const
+std::string Att::StrToStr(const std::string &str) const
 {
     return str;
 }
@@ -58,31 +58,24 @@ std::string Att::WcharTToStr(wchar_t data) const
 
 // Basic converters for reading
 
-double Att::StrToDbl(std::string value) const
+double Att::StrToDbl(const std::string &value) const
 {
     return atof(value.c_str());
 }
 
-int Att::StrToInt(std::string value) const
+int Att::StrToInt(const std::string &value) const
 {
     return atoi(value.c_str());
 }
 
-wchar_t Att::StrToWcharT(std::string value) const
+wchar_t Att::StrToWcharT(const std::string &value) const
 {
-    std::string prefix1 = "U+";
-    std::string prefix2 = "#x";
-    if (value.compare(0, prefix1.length(), prefix1) == 0) {
-        value.erase(0, 2);
-    }
-    else if (value.compare(0, prefix2.length(), prefix2) == 0) {
-        value.erase(0, 2);
-    }
-    else {
+    // Both prefixes have two characters that are skipped when parsing the code
+    if ((value.compare(0, 2, "U+") != 0) && (value.compare(0, 2, "#x") != 0)) {
         LogWarning("Unable to parse glyph code '%s'", value.c_str());
         return 0;
     }
-    wchar_t wc = (wchar_t)strtol(value.c_str(), NULL, 16);
+    wchar_t wc = (wchar_t)strtol(value.c_str() + 2, NULL, 16);
     // Check that the value is in a SMuFL private area range - this does not check that it is an
     // existing SMuFL glyph num or that it is supported by Verovio
     if ((wc >= 0xE000) && (wc <= 0xF8FF))
@@ -104,7 +97,7 @@ std::string Att::ArticulationListToStr(data_ARTICULATION_List data) const
     return ss.str();
 }
 
-data_ARTICULATION_List Att::StrToArticulationList(std::string value) const
+data_ARTICULATION_List Att::StrToArticulationList(const std::string &value) const
 {
     data_ARTICULATION_List list;
     std::istringstream iss(value);
@@ -134,7 +127,7 @@ std::string Att::BeatrptRendToStr(data_BEATRPT_REND data) const
     return value;
 }
 
-data_BEATRPT_REND Att::StrToBeatrptRend(std::string value) const
+data_BEATRPT_REND Att::StrToBeatrptRend(const std::string &value) const
 {
     if (value == "4") return BEATRPT_REND_4;
     if (value == "8") return BEATRPT_REND_8;
@@ -178,7 +171,7 @@ std::string Att::DurationToStr(data_DURATION data) const
     return value;
 }
 
-data_DURATION Att::StrToDuration(std::string value) const
+data_DURATION Att::StrToDuration(const std::string &value) const
 {
     if (value == "maxima") return DURATION_maxima;
     if (value == "longa") return DURATION_longa;
@@ -236,7 +229,7 @@ std::string Att::KeysignatureToStr(data_KEYSIGNATURE data) const
     return value;
 }
 
-data_KEYSIGNATURE Att::StrToKeysignature(std::string value) const
+data_KEYSIGNATURE Att::StrToKeysignature(const std::string &value) const
 {
     if (value == "7f") return KEYSIGNATURE_7f;
     if (value == "6f") return KEYSIGNATURE_6f;
@@ -263,24 +256,23 @@ std::string Att::MeasurebeatToStr(data_MEASUREBEAT data) const
     return StringFormat("%dm+%.1f", data.first, data.second);
 }
 
-data_MEASUREBEAT Att::StrToMeasurebeat(std::string value) const
+data_MEASUREBEAT Att::StrToMeasurebeat(const std::string &value) const
 {
+    std::string measurebeat;
+    measurebeat.reserve(value.length());
     for (size_t i = 0; i < value.length(); i++) {
-        if (iswspace(value[i])) {
-            value.erase(i, 1);
-            i--;
-        }
+        if (!iswspace(value[i])) measurebeat.push_back(value[i]);
     }
     int measure = 0;
     double timePoint = 0.0;
-    int m = (int)value.find_first_of('m');
-    int plus = (int)value.find_last_of('+');
-    if (m != -1) measure = atoi(value.substr(0, m).c_str());
+    int m = (int)measurebeat.find_first_of('m');
+    int plus = (int)measurebeat.find_last_of('+');
+    if (m != -1) measure = atoi(measurebeat.substr(0, m).c_str());
     if (plus != -1) {
-        timePoint = atof(value.substr(plus).c_str());
+        timePoint = atof(measurebeat.substr(plus).c_str());
     }
     else {
-        timePoint = atof(value.c_str());
+        timePoint = atof(measurebeat.c_str());
     }
     return std::make_pair(measure, timePoint);
 }
@@ -299,7 +291,7 @@ std::string Att::ModusmaiorToStr(data_MODUSMAIOR data) const
     return value;
 }
 
-data_MODUSMAIOR Att::StrToModusmaior(std::string value) const
+data_MODUSMAIOR Att::StrToModusmaior(const std::string &value) const
 {
     if (value == "2") return MODUSMAIOR_2;
     if (value == "3") return MODUSMAIOR_3;
@@ -321,7 +313,7 @@ std::string Att::ModusminorToStr(data_MODUSMINOR data) const
     return value;
 }
 
-data_MODUSMINOR Att::StrToModusminor(std::string value) const
+data_MODUSMINOR Att::StrToModusminor(const std::string &value) const
 {
     if (value == "2") return MODUSMINOR_2;
     if (value == "3") return MODUSMINOR_3;
@@ -334,7 +326,7 @@ std::string Att::PercentToStr(data_PERCENT data) const
     return StringFormat("%d%%", data);
 }
 
-data_PERCENT Att::StrToPercent(std::string value) const
+data_PERCENT Att::StrToPercent(const std::string &value) const
 {
     return atoi(value.substr(0, value.find("%")).c_str());
 }
@@ -358,7 +350,7 @@ std::string Att::PitchnameToStr(data_PITCHNAME data) const
     return value;
 }
 
-data_PITCHNAME Att::StrToPitchname(std::string value) const
+data_PITCHNAME Att::StrToPitchname(const std::string &value) const
 {
     if (value == "c") return PITCHNAME_c;
     if (value == "d") return PITCHNAME_d;
@@ -386,7 +378,7 @@ std::string Att::OctaveDisToStr(data_OCTAVE_DIS data) const
     return value;
 }
 
-data_OCTAVE_DIS Att::StrToOctaveDis(std::string value) const
+data_OCTAVE_DIS Att::StrToOctaveDis(const std::string &value) const
 {
     if (value == "8") return OCTAVE_DIS_8;
     if (value == "15") return OCTAVE_DIS_15;
@@ -410,7 +402,7 @@ std::string Att::OrientationToStr(data_ORIENTATION data) const
     return value;
 }
 
-data_ORIENTATION Att::StrToOrientation(std::string value) const
+data_ORIENTATION Att::StrToOrientation(const std::string &value) const
 {
     if (value == "reversed") return ORIENTATION_reversed;
     if (value == "90CW") return ORIENTATION_90CW;
@@ -433,7 +425,7 @@ std::string Att::ProlatioToStr(data_PROLATIO data) const
     return value;
 }
 
-data_PROLATIO Att::StrToProlatio(std::string value) const
+data_PROLATIO Att::StrToProlatio(const std::string &value) const
 {
     if (value == "2") return PROLATIO_2;
     if (value == "3") return PROLATIO_3;
@@ -455,7 +447,7 @@ std::string Att::StemdirectionToStr(data_STEMDIRECTION data) const
     return value;
 }
 
-data_STEMDIRECTION Att::StrToStemdirection(std::string value) const
+data_STEMDIRECTION Att::StrToStemdirection(const std::string &value) const
 {
     if (value == "up") return STEMDIRECTION_up;
     if (value == "down") return STEMDIRECTION_down;
@@ -477,7 +469,7 @@ std::string Att::TempusToStr(data_TEMPUS data) const
     return value;
 }
 
-data_TEMPUS Att::StrToTempus(std::string value) const
+data_TEMPUS Att::StrToTempus(const std::string &value) const
 {
     if (value == "2") return TEMPUS_2;
     if (value == "3") return TEMPUS_3;
@@ -500,7 +492,7 @@ std::string Att::TieToStr(data_TIE data) const
     return value;
 }
 
-data_TIE Att::StrToTie(std::string value) const
+data_TIE Att::StrToTie(const std::string &value) const
 {
     if (value == "i") return TIE_i;
     if (value == "m") return TIE_m;
@@ -519,7 +511,7 @@ std::string Att::XsdPositiveIntegerListToStr(xsdPositiveInteger_List data) const
     return ss.str();
 }
 
-xsdPositiveInteger_List Att::StrToXsdPositiveIntegerList(std::string value) const
+xsdPositiveInteger_List Att::StrToXsdPositiveIntegerList(const std::string &value) const
 {
     xsdPositiveInteger_List list;
     std::istringstream iss(value);
@@ -530,6 +522,24 @@ xsdPositiveInteger_List Att::StrToXsdPositiveIntegerList(std::string value) cons
     return list;
 }
 
+//----------------------------------------------------------------------------
+// Interface
+//----------------------------------------------------------------------------
+
+AttClassSet Interface::s_attClasses[INTERFACE_max];
+
+void Interface::RegisterInterfaceAttClass(AttClassId attClassId)
+{
+    // Like for Object, the constructors are run from the parent interface to the child one and IsInterface()
+    // returns the InterfaceId of the one being run
+    const InterfaceId interfaceId = this->IsInterface();
+    if (interfaceId != m_registeredInterfaceId) {
+        s_attClasses[interfaceId].Merge(s_attClasses[m_registeredInterfaceId]);
+        m_registeredInterfaceId = interfaceId;
+    }
+    s_attClasses[interfaceId].Set(attClassId);
+}
+
 //----------------------------------------------------------------------------
 // AttComparison
 //----------------------------------------------------------------------------
@@ -47,14 +47,14 @@ BBoxDeviceContext::~BBoxDeviceContext()
 {
 }
 
-void BBoxDeviceContext::StartGraphic(Object *object, std::string gClass, std::string gId)
+void BBoxDeviceContext::StartGraphic(Object *object, const std::string &gClass, const std::string &gId)
 {
     // add the object object
     object->BoundingBox::ResetBoundingBox();
     m_objects.push_back(object);
 }
 
-void BBoxDeviceContext::ResumeGraphic(Object *object, std::string gId)
+void BBoxDeviceContext::ResumeGraphic(Object *object, const std::string &gId)
 {
     // I am not sure we actually have to reset the bounding box here...
     object->BoundingBox::ResetBoundingBox();
@@ -287,7 +287,7 @@ void BBoxDeviceContext::DrawMusicText(const std::wstring &text, int x, int y)
 
     for (unsigned int i = 0; i < text.length(); i++) {
         wchar_t c = text[i];
-        Glyph *glyph = Resources::GetGlyph(c);
+        const Glyph *glyph = this->GetResources()->GetGlyph(c);
         if (!glyph) {
             continue;
         }
@@ -95,7 +95,7 @@ void Beam::FilterList(ListOfObjects *childList)
             // Drop notes that are signaled as grace notes
 
             if ((*iter)->Is() == NOTE) {
-                Note *n = dynamic_cast<Note *>(*iter);
+                Note *n = vrv_cast<Note *>(*iter);
                 assert(n);
                 // if we are at the beginning of the beam
                 // and the note is cueSize
@@ -130,7 +130,7 @@ int Beam::GetPosition(LayerElement *element)
     int position = this->GetListIndex(element);
     // Check if this is a note in the chord
     if ((position == -1) && (element->Is() == NOTE)) {
-        Note *note = dynamic_cast<Note *>(element);
+        Note *note = vrv_cast<Note *>(element);
         assert(note);
         Chord *chord = note->IsChordTone();
         if (chord) position = this->GetListIndex(chord);
@@ -0,0 +1,4171 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        builtinfont.cpp
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////////
+// NOTE: this file was generated by the ./fonts/generate-tables.py script and
+// should not be edited because changes will be lost.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "builtinfont.h"
+
+//----------------------------------------------------------------------------
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// Bravura
+//----------------------------------------------------------------------------
+
+static const char xmlBravura_E003[] =
+    "<symbol id=\"E003\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 0v240q0 14 16 14h207q111 8 219 43q178 58 319 165q87 65 132 113q20 29 51 29q16 -6 16 -24t-2 -25q-106 -442 -702 -555h-256z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E004[] =
+    "<symbol id=\"E004\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -240v240h256q596 -113 702 -555q10 -40 -14 -49q-31 0 -51 29q-34 39 -116 101q-83 62 -155 102t-181 75q-108 35 -218 43h-207q-16 0 -16 14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E045[] =
+    "<symbol id=\"E045\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1229 636q0 118 88 194t222 75q134 0 228 -65l66 55h55l15 -317h-64q-113 264 -303 264q-72 0 -119 -36t-47 -93q0 -76 84 -107q17 -7 41 -9q24 -3 84 -19l59 -15q160 -33 233 -103t73 -192q0 -123 -92 -205q-92 -81 -232 -81q-141 0 -254 81l-76 -71h-63v348h63 q51 -139 137 -217q87 -78 179 -78t141 40q49 41 49 107t-55 95q-29 12 -86 26l-29 6l-18 5l-76 16q-143 26 -223 102t-80 194zM2216 97q0 -48 -34 -82q-34 -33 -82 -33t-82 34t-34 81q0 48 34 82t82 34t82 -34t34 -82zM1056 213q48 0 82 -34t33 -82q1 -48 -33 -82 q-34 -33 -82 -33t-82 34t-34 81q0 48 34 82t82 34zM729 457q0 365 -252 364h-31q-45 0 -59 -14t-14 -59v-603q0 -49 14 -64t59 -15h25q137 0 198 93q60 93 60 298zM975 450q0 -255 -170 -374q-109 -76 -330 -76h-452v66h18q84 0 102 18q8 10 9 92v535q0 82 -14 96t-97 14 h-18v66h438q240 0 338 -66q176 -116 176 -371z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E046[] =
+    "<symbol id=\"E046\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M2216 97q0 -48 -34 -82q-34 -33 -82 -33t-82 34t-34 81q0 48 34 82t82 34t82 -34t34 -82zM1056 213q48 0 82 -34t33 -82q1 -48 -33 -82q-34 -33 -82 -33t-82 34t-34 81q0 48 34 82t82 34zM1155 444q0 194 131 328q131 133 334 133q117 0 225 -65l66 61h53l12 -352l-65 -6 q-80 299 -281 299q-231 0 -231 -392t246 -393q106 0 177 71t97 198l76 -19q-70 -326 -389 -325q-213 0 -332 134t-119 328zM729 457q0 365 -252 364h-31q-45 0 -59 -14t-14 -59v-603q0 -49 14 -64t59 -15h25q137 0 198 93q60 93 60 298zM975 450q0 -255 -170 -374 q-109 -76 -330 -76h-452v66h18q84 0 102 18q8 10 9 92v535q0 82 -14 96t-97 14h-18v66h438q240 0 338 -66q176 -116 176 -371z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E047[] =
+    "<symbol id=\"E047\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M104 -6q0 24 7 37q295 531 308 555t13 36t-12 17q-16 6 -90 55t-167 132t-124 154t-31 148q0 148 97 264t197 116t182 -32q81 -32 104 -98q16 -53 16 -96q0 -98 -82 -127q-29 -10 -59 -10q-104 0 -150 176l-4 14q-8 27 -33 27h-12q-111 -18 -110 -127q0 -55 30 -111 t201 -138q170 -83 199 -83q8 0 18 17l338 606q26 46 78 22q31 -16 31 -40t-9 -40q-317 -571 -324 -583t-7 -17q1 -12 29 -28t73 -46t117 -86t128 -136t63 -138q7 -59 7 -78q0 -125 -74 -220t-198 -138q-43 -14 -86 -14q-96 0 -172 72t-76 161q0 98 146 133q16 4 24 4 q43 0 76 -39t33 -96v-22q-1 -45 21 -69t52 -24q132 16 130 150q0 64 -63 126q-62 62 -148 102q-176 82 -230 89q-4 0 -24 -10l-324 -586q-16 -31 -51 -30q-14 0 -36 12q-22 13 -22 37zM287 540q0 -48 -34 -82t-82 -34t-83 34t-35 82t35 83t83 35t82 -36q34 -34 34 -82z M850 955q0 48 35 82t83 34t82 -34t34 -82t-34 -83q-34 -34 -82 -34t-83 34t-35 83z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E048[] =
+    "<symbol id=\"E048\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1036 721v-623q183 20 245 209q52 160 56 414h-301zM647 721q0 -300 47 -420q20 -51 51 -97q60 -89 193 -106v623h-291zM647 819h291v606q-114 -9 -168 -59q-30 -28 -52 -54t-41 -101q-30 -113 -30 -392zM1337 819q0 324 -47 432t-132 146q-52 23 -122 28v-606h301z M1919 819q37 0 37 -49t-37 -49h-244q-14 -285 -201 -493t-438 -228v-287q0 -37 -49 -37t-49 37v287q-250 20 -436 228t-203 493h-270q-37 0 -37 49t37 49h270q15 287 201 494t438 227v264q0 35 49 35t49 -35v-264q252 -20 438 -227t201 -494h244z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E04B[] =
+    "<symbol id=\"E04B\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M522 1741v-119q0 -25 17 -33q41 -25 67 -40q143 -81 196 -179q32 -56 17 -144q-15 -87 -75 -154q-37 -43 -37 -59q0 -17 16 -34q86 -100 86 -207t-93 -207q-24 -27 -31 -37t-7 -27q0 -16 20 -39q84 -92 84 -204v-14q-4 -110 -80 -203q-40 -49 -112 -79t-167 -30t-169 27 q-116 42 -166 140q-18 36 -18 76t26 70q27 30 74 29q70 0 123 -79q3 -5 25 -47t39 -68t51 -50t73 -24q78 0 117 45t41 103q-6 16 -15 42t-38 68q-28 42 -46 41q-18 0 -18 -8q0 -29 -30 -29q-10 0 -20 10t-9 19v49q0 10 -19 29l-32 22l-9 4q-4 0 -10 -5t-6 -11v-88 q0 -10 -17 -25t-29 0q-13 15 -13 25v125q0 14 -35 43q-291 166 -291 362q0 86 80 207q20 31 20 43t-16 31q-78 84 -78 195q0 63 41 128t65 80t25 30q0 15 -16 38q-88 96 -88 221t100 218t277 93h10q81 0 168 -34q88 -35 126 -73t38 -87q0 -129 -113 -129q-49 0 -81 22 t-56 79q-24 58 -80 88t-99 30t-95 -27q-52 -28 -52 -94t129 -160q4 -4 10 -4t11 7v12q0 31 28 31q10 0 20 -10t11 -21v-49q0 -16 10 -23q49 -33 57 -33t9 21v84q0 12 9 21t20 10q30 0 30 -31zM463 1163v168q0 23 -16 31t-41 18l-9 6q-10 0 -10 -10q-2 -4 -2 -74t1 -94 q1 -22 13 -28q39 -27 51 -27t13 10zM242 1454q-53 0 -86 -51q-8 -14 -9 -31q0 -49 97 -110q17 -13 59 -33h8q16 0 17 12v166q-1 15 -17 23l-39 18q-10 6 -30 6zM316 717q11 0 12 10v176q0 21 -20 33q-75 46 -101 45q-55 0 -88 -59q-10 -20 -10 -45q-1 -25 35 -62t71 -49 l82 -45q8 -4 19 -4zM463 659v170q-1 27 -11 33t-27 16t-24 11q-14 0 -14 -19q-2 -8 -2 -168q0 -25 12 -34l45 -23q2 -2 7 -2q14 0 14 16zM522 801v-164q0 -29 15 -35q4 -2 9 -4q4 -2 12 -7t44 -5t66 53q10 25 10 41q0 53 -41 82q-2 2 -47 28t-51 25q-17 0 -17 -14zM522 1298 v-155q0 -25 14 -30q57 -21 92 -21t58 49q10 20 10 37q0 45 -39 75q0 2 -43 33t-77 31q-15 -1 -15 -19z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E050[] =
+    "<symbol id=\"E050\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M881 516q219 0 356 -145t137 -331t-92 -314q-92 -127 -252 -191q-2 -2 -15 -7t-13 -11q0 -7 30 -179q31 -172 31 -273t-30 -178q-31 -77 -73 -120t-113 -78t-185 -36t-194 32q-135 56 -179 192q-18 54 -19 109q0 98 60 167t154 69t148 -60t54 -146q0 -85 -40 -132 q-40 -48 -102 -66t-61 -32q0 -23 43 -41q44 -19 110 -19t114 11t104 44q55 33 87 106t32 177t-55 414q-2 16 -8 19t-46 -5q-38 -8 -119 -8q-182 0 -327 58q-144 58 -234 156q-184 200 -184 489q0 290 229 577q127 156 379 364q16 14 20 22t-1 28q-29 168 -29 335 q0 414 201 637q90 98 133 99q16 0 49 -33t57 -70q133 -195 133 -477q-1 -172 -73 -347t-201 -316q-55 -61 -115 -117q-16 -16 -12 -39l51 -297q3 -29 11 -33t49 -4zM164 41q0 -215 162 -349t428 -134q59 0 99 7t43 11t1 21l-102 610q-5 16 -11 19t-30 -3q-94 -27 -150 -90 t-55 -141q0 -78 41 -138t89 -81t48 -35q0 -23 -24 -23t-56 13q-106 37 -171 132q-64 95 -64 228t81 244t216 155q29 9 31 15t-1 35l-43 262q-4 16 -8 18t-20 -10q-193 -156 -314 -291q-190 -215 -190 -475zM1206 -94q0 133 -88 228t-215 106q-18 2 -22 -4t0 -25l100 -584 q2 -18 8 -20t25 8q88 45 140 121t52 170zM963 1931q-101 0 -187 -145t-86 -371q0 -109 12 -188q6 -35 27 -17q63 55 129 121q227 227 227 432q0 82 -34 125q-35 43 -88 43z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E051[] =
+    "<symbol id=\"E051\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M881 516q219 0 356 -145t137 -331t-92 -314q-92 -127 -252 -191q-2 -2 -15 -7t-13 -11q0 -7 30 -179q31 -172 31 -276q0 -184 -87 -277t-212 -120q34 -8 78 -8q48 0 78 10t39 10t9 -12t-18 -27q-76 -72 -170 -72q-20 0 -44 3t-27 -9l-19 -57q-4 -10 0 -14t22 2t54 6 q133 0 133 -103q0 -88 -57 -143t-132 -55t-109 28t-34 64q-1 37 17 57t45 21q49 0 49 -43t-33 -58q-16 -6 -16 -14q0 -23 51 -23t84 54t33 114q0 59 -58 60q-39 0 -75 -37q-14 -14 -25 -14q-20 0 -21 20q0 4 7 23l69 204v2q-12 -2 -35 -2t-63 5l-2 -5v-4l-123 -387 q-4 -16 4 -16l43 -4q18 -2 19 -19q0 -16 -21 -16h-211q-20 0 -20 16t18 19l43 4q10 0 16 12l87 270q2 7 2 15q1 8 -7 8t-16 -12l-47 -51q-8 -12 -23 -13q-20 0 -20 19q0 6 10 20l135 152q6 10 15 10q-121 39 -174 128q-54 89 -54 185t60 165t154 69t148 -60t54 -146 q0 -85 -40 -132q-40 -48 -102 -66t-61 -32q0 -23 43 -41q44 -19 110 -19t114 11t104 44q55 33 87 106t32 177t-55 414q-2 16 -8 19t-46 -5q-38 -8 -119 -8q-182 0 -327 58q-144 58 -234 156q-184 200 -184 489q0 290 229 577q127 156 379 364q16 14 20 22t-1 28 q-29 168 -29 335q0 414 201 637q90 98 133 99q16 0 49 -33t57 -70q133 -195 133 -477q-1 -172 -73 -347t-201 -316q-55 -61 -115 -117q-16 -16 -12 -39l51 -297q3 -29 11 -33t49 -4zM164 41q0 -215 162 -349t428 -134q59 0 99 7t43 11t1 21l-102 610q-5 16 -11 19t-30 -3 q-94 -27 -150 -90t-55 -141q0 -78 41 -138t89 -81t48 -35q0 -23 -24 -23t-56 13q-106 37 -171 132q-64 95 -64 228t81 244t216 155q29 9 31 15t-1 35l-43 262q-4 16 -8 18t-20 -10q-193 -156 -314 -291q-190 -215 -190 -475zM963 1931q-101 0 -187 -145t-86 -371 q0 -109 12 -188q6 -35 27 -17q63 55 129 121q227 227 227 432q0 82 -34 125q-35 43 -88 43zM1206 -94q0 133 -88 228t-215 106q-18 2 -22 -4t0 -25l100 -584q2 -18 8 -20t25 8q88 45 140 121t52 170z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E052[] =
+    "<symbol id=\"E052\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M881 516q219 0 356 -145t137 -331t-92 -314q-92 -127 -252 -191q-2 -2 -15 -7t-13 -11q0 -7 30 -179q31 -172 31 -276q0 -307 -264 -389q63 -27 63 -95t-76 -108q-22 -11 -16 -19q2 -3 10 -14q33 -35 33 -97t-53 -100t-133 -38t-120 34t-40 87q0 84 92 121q27 9 6 34 t-20 70q0 72 57 106q-176 16 -254 116t-78 206q0 108 60 177t154 69t148 -60t54 -146q0 -85 -40 -132q-40 -48 -102 -66t-61 -32q0 -23 43 -41q44 -19 110 -19t114 11t104 44q55 33 87 106t32 177t-55 414q-2 16 -8 19t-46 -5q-38 -8 -119 -8q-182 0 -327 58 q-144 58 -234 156q-184 200 -184 489q0 290 229 577q127 156 379 364q16 14 20 22t-1 28q-29 168 -29 335q0 414 201 637q90 98 133 99q16 0 49 -33t57 -70q133 -195 133 -477q-1 -172 -73 -347t-201 -316q-55 -61 -115 -117q-16 -16 -12 -39l51 -297q3 -29 11 -33t49 -4z M164 41q0 -215 162 -349t428 -134q59 0 99 7t43 11t1 21l-102 610q-5 16 -11 19t-30 -3q-94 -27 -150 -90t-55 -141q0 -78 41 -138t89 -81t48 -35q0 -23 -24 -23t-56 13q-106 37 -171 132q-64 95 -64 228t81 244t216 155q29 9 31 15t-1 35l-43 262q-4 16 -8 18t-20 -10 q-193 -156 -314 -291q-190 -215 -190 -475zM963 1931q-101 0 -187 -145t-86 -371q0 -109 12 -188q6 -35 27 -17q63 55 129 121q227 227 227 432q0 82 -34 125q-35 43 -88 43zM1206 -94q0 133 -88 228t-215 106q-18 2 -22 -4t0 -25l100 -584q2 -18 8 -20t25 8q88 45 140 121 t52 170zM547 -1690q0 -34 19 -56q18 -22 60 -22t66 22t25 52t-15 47q-16 16 -67 58q-19 14 -31 6q-57 -35 -57 -107zM719 -1346q-35 0 -57 -19t-21 -53q0 -34 64 -83q20 -12 30 -4q49 35 49 94q1 65 -65 65z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E053[] =
+    "<symbol id=\"E053\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M881 516q219 0 356 -145t137 -331t-92 -314q-92 -127 -252 -191q-2 -2 -15 -7t-13 -11q0 -7 30 -179q31 -172 31 -273t-30 -178q-31 -77 -73 -120t-113 -78t-185 -36t-194 32q-135 56 -179 192q-18 54 -19 109q0 98 60 167t154 69t148 -60t54 -146q0 -85 -40 -132 q-40 -48 -102 -66t-61 -32q0 -23 43 -41q44 -19 110 -19t114 11t104 44q55 33 87 106t32 177t-55 414q-2 16 -8 19t-46 -5q-38 -8 -119 -8q-182 0 -327 58q-144 58 -234 156q-184 200 -184 489q0 290 229 577q127 156 379 364q16 14 20 22t-1 28q-29 168 -29 335 q0 414 201 637q41 45 80 72q-103 23 -103 112t92 126q27 9 6 34q-20 24 -20 80t48 92t124 37t111 -29t34 -77q0 -70 -75 -109q-22 -11 -17 -20q2 -4 11 -14q32 -32 32 -90t-42 -96t-105 -48q37 -33 63 -74q133 -195 133 -477q-1 -172 -73 -347t-201 -316q-55 -61 -115 -117 q-16 -16 -12 -39l51 -297q3 -29 11 -33t49 -4zM164 41q0 -215 162 -349t428 -134q59 0 99 7t43 11t1 21l-102 610q-5 16 -11 19t-30 -3q-94 -27 -150 -90t-55 -141q0 -78 41 -138t89 -81t48 -35q0 -23 -24 -23t-56 13q-106 37 -171 132q-64 95 -64 228t81 244t216 155 q29 9 31 15t-1 35l-43 262q-4 16 -8 18t-20 -10q-193 -156 -314 -291q-190 -215 -190 -475zM963 1931q-101 0 -187 -145t-86 -371q0 -109 12 -188q6 -35 27 -17q63 55 129 121q227 227 227 432q0 82 -34 125q-35 43 -88 43zM1206 -94q0 133 -88 228t-215 106q-18 2 -22 -4 t0 -25l100 -584q2 -18 8 -20t25 8q88 45 140 121t52 170zM938 2249q40 1 64 23t24 52t-15 46t-49 44t-49 19q-57 -35 -57 -107t72 -77h10zM1028 2673q-34 1 -56 -19t-22 -55t64 -82q18 -14 30 -4q50 33 50 97t-66 63z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E054[] =
+    "<symbol id=\"E054\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M881 516q219 0 356 -145t137 -331t-92 -314q-92 -127 -252 -191q-2 -2 -15 -7t-13 -11q0 -7 30 -179q31 -172 31 -273t-30 -178q-31 -77 -73 -120t-113 -78t-185 -36t-194 32q-135 56 -179 192q-18 54 -19 109q0 98 60 167t154 69t148 -60t54 -146q0 -85 -40 -132 q-40 -48 -102 -66t-61 -32q0 -23 43 -41q44 -19 110 -19t114 11t104 44q55 33 87 106t32 177t-55 414q-2 16 -8 19t-46 -5q-38 -8 -119 -8q-182 0 -327 58q-144 58 -234 156q-184 200 -184 489q0 290 229 577q127 156 379 364q16 14 20 22t-1 28q-29 168 -29 335 q0 414 201 637q90 98 133 99q16 0 49 -33t57 -70q133 -195 133 -477q-1 -172 -73 -347t-201 -316q-55 -61 -115 -117q-16 -16 -12 -39l51 -297q3 -29 11 -33t49 -4zM164 41q0 -215 162 -349t428 -134q59 0 99 7t43 11t1 21l-102 610q-5 16 -11 19t-30 -3q-94 -27 -150 -90 t-55 -141q0 -78 41 -138t89 -81t48 -35q0 -23 -24 -23t-56 13q-106 37 -171 132q-64 95 -64 228t81 244t216 155q29 9 31 15t-1 35l-43 262q-4 16 -8 18t-20 -10q-193 -156 -314 -291q-190 -215 -190 -475zM1206 -94q0 133 -88 228t-215 106q-18 2 -22 -4t0 -25l100 -584 q2 -18 8 -20t25 8q88 45 140 121t52 170zM963 1931q-101 0 -187 -145t-86 -371q0 -109 12 -188q6 -35 27 -17q63 55 129 121q227 227 227 432q0 82 -34 125q-35 43 -88 43zM1189 2681q48 0 93 10q27 10 35 10t8 -11t-18 -30q-78 -70 -170 -69q-20 0 -44 3t-28 -9l-18 -58 q-4 -10 0 -14q5 -4 27 2t48 6q133 0 133 -104q0 -87 -57 -143q-56 -56 -132 -56t-110 29q-32 29 -32 65t17 57q17 22 44 21q49 0 49 -47q0 -39 -33 -53q-16 -10 -16 -17q0 -23 51 -23t84 55q33 54 33 115t-57 60q-43 0 -76 -39q-14 -12 -25 -12q-20 0 -20 18q0 7 6 25 l70 203q6 23 26 22q10 0 37 -8t75 -8zM952 2689q0 -10 -2 -16l-123 -387q-4 -16 4 -19l43 -4q18 0 19 -16q0 -18 -21 -19h-210q-20 0 -21 19q0 16 18 16l43 4q12 2 17 14l86 269q2 6 2 14t-7 8t-16 -10l-47 -51q-10 -14 -22 -14q-20 0 -21 18q1 8 11 22l135 152q10 10 18 10 l39 -12l43 12q12 0 12 -10z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E05C[] =
+    "<symbol id=\"E05C\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M471 987v-897q0 -16 18 -12q133 37 183 299q10 51 38 51t48 -70t68 -124q48 -52 146 -52t134 94q37 94 37 304t-47 301q-47 90 -170 90q-66 -1 -120 -17t-54 -39q0 -10 55 -30q82 -29 82 -133q0 -66 -39 -104q-38 -38 -104 -38t-110 45t-44 123q0 106 92 182t264 76 q232 0 358 -135t126 -331t-114 -329q-114 -132 -314 -132q-66 0 -115 15t-71 1t-48 -55t-25 -70q0 -29 26 -70t47 -55q20 -14 70 1t116 15q200 0 314 -132q114 -133 114 -329t-125 -331t-359 -135q-172 0 -264 76t-92 182q0 78 44 123t110 45t104 -38q39 -38 39 -104 q0 -104 -82 -133q-55 -20 -55 -30q0 -23 54 -39t120 -17q123 0 170 90t47 300q0 211 -37 305t-134 94q-98 0 -146 -52t-68 -123t-48 -71t-38 51q-49 262 -183 299q-18 4 -18 -12v-897q0 -43 -43 -43h-2q-43 0 -43 43v1974q0 43 43 43h2q43 0 43 -43zM43 1030h176 q43 0 43 -43v-1974q0 -43 -43 -43h-176q-43 0 -43 43v1974q0 43 43 43z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E05D[] =
+    "<symbol id=\"E05D\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M471 987v-897q0 -16 18 -12q133 37 183 299q10 51 38 51t48 -70t68 -124q48 -52 146 -52t134 94q37 94 37 304t-47 301q-47 90 -170 90q-66 -1 -120 -17t-54 -39q0 -10 55 -30q82 -29 82 -133q0 -66 -39 -104q-38 -38 -104 -38t-110 45t-44 123q0 106 92 182t264 76 q232 0 358 -135t126 -331t-114 -329q-114 -132 -314 -132q-66 0 -115 15t-71 1t-48 -55t-25 -70q0 -29 26 -70t47 -55q20 -14 70 1t116 15q200 0 314 -132q114 -133 114 -329t-125 -331t-359 -135q-172 0 -264 76t-92 182q0 78 44 123t110 45t104 -38q39 -38 39 -104 q0 -104 -82 -133q-55 -20 -55 -30q0 -23 54 -39t120 -17q123 0 170 90t47 300q0 211 -37 305t-134 94q-98 0 -146 -52t-68 -123t-48 -71t-38 51q-49 262 -183 299q-18 4 -18 -12v-897q0 -43 -43 -43h-2q-43 0 -43 43v1974q0 43 43 43h2q43 0 43 -43zM43 1030h176 q43 0 43 -43v-1974q0 -43 -43 -43h-176q-43 0 -43 43v1974q0 43 43 43zM713 -1034q141 0 141 -107q0 -70 -76 -108q-22 -11 -16 -20q2 -3 10 -13q33 -34 33 -96t-53 -101q-54 -39 -134 -39t-120 34t-39 87q0 84 92 121q25 8 5 34t-20 80t49 91q48 37 128 37zM539 -1409 q0 -33 19 -55q18 -22 60 -23q42 0 66 22q24 23 25 53t-15 46t-67 57q-19 14 -31 6q-57 -35 -57 -106zM711 -1065q-35 0 -57 -19q-22 -20 -22 -54t64 -83q20 -12 31 -4q49 35 49 95q1 65 -65 65z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E062[] =
+    "<symbol id=\"E062\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1288 369q47 0 80 -33t33 -80t-33 -80t-80 -33t-80 33t-32 80q0 47 32 80q33 33 80 33zM1290 -145q47 0 79 -32t32 -79t-32 -79t-79 -32t-79 32t-31 79q0 47 31 79q32 32 79 32zM516 537q264 0 418 -162t153 -432q0 -403 -274 -699t-762 -534q-20 -10 -35 -10 q-27 0 -26 24q0 20 30 37q410 236 585 506t175 657q0 252 -77 393t-227 141t-244 -78q-94 -79 -95 -153q0 -37 33 -37q10 0 41 8t61 7q80 1 138 -59t59 -155q0 -95 -60 -155t-168 -61q-109 0 -175 88t-66 233t124 286q60 69 162 112t230 43z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E063[] =
+    "<symbol id=\"E063\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M561 -1048q0 -10 -2 -17l-123 -387q-4 -16 4 -18l43 -5q18 0 19 -16q0 -18 -21 -18h-211q-20 0 -20 17t18 17l43 5q12 2 17 14l86 268q2 6 2 14t-6 9q-8 0 -17 -11l-47 -51q-10 -14 -26 -14q-16 -1 -16 13t9 28l97 110q-133 -88 -359 -200q-20 -10 -35 -10q-27 0 -26 24 q0 20 30 37q410 236 585 506t175 657q0 252 -77 393t-227 141t-244 -78q-94 -79 -95 -153q0 -37 33 -37q10 0 41 8t61 7q80 1 138 -59t59 -155q0 -95 -60 -155t-168 -61q-109 0 -175 88t-66 233t124 286q60 69 162 112t230 43q264 0 418 -162t153 -432q0 -403 -284 -711 q-135 -143 -320 -274q16 -9 23 -9l43 13q12 0 12 -10zM686 -1040q10 0 37 -8t75 -9q48 0 93 10q27 11 35 11t8 -12t-19 -29q-78 -70 -170 -70q-19 0 -43 3t-28 -9l-19 -57q-4 -10 0 -14t27 1q23 6 49 6q133 0 133 -104q0 -88 -57 -143q-57 -56 -133 -56t-109 29t-33 65 t18 58t44 20q49 0 49 -47q0 -39 -33 -53q-16 -10 -16 -16q0 -23 51 -23t84 54t33 115t-57 61q-43 0 -76 -39q-13 -12 -29 -12t-16 18q0 6 6 24l69 203q6 23 27 23zM1288 369q47 0 80 -33t33 -80t-33 -80t-80 -33t-80 33t-32 80q0 47 32 80q33 33 80 33zM1290 -145 q47 0 79 -32t32 -79t-32 -79t-79 -32t-79 32t-31 79q0 47 31 79q32 32 79 32z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E064[] =
+    "<symbol id=\"E064\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M553 -1069q-35 1 -57 -19t-21 -55q0 -35 64 -82q18 -14 30 -4q49 33 49 92q1 68 -65 68zM381 -1413q0 -33 19 -57q18 -24 60 -23q42 0 66 23q24 22 25 52q0 30 -15 46t-67 57q-17 14 -31 6q-57 -35 -57 -104zM566 -1038q62 0 96 -30q35 -30 34 -77q0 -70 -75 -108 q-22 -11 -17 -21q2 -4 10 -14q33 -34 33 -96t-54 -101t-133 -39t-119 34t-40 87q0 84 92 121q27 9 6 34q-21 24 -21 72t32 84q-172 -109 -359 -198q-20 -10 -35 -10q-27 0 -26 24q0 20 30 37q410 236 585 506t175 657q0 252 -77 393t-227 141t-244 -78q-94 -79 -95 -153 q0 -37 33 -37q10 0 41 8t61 7q80 1 138 -59t59 -155q0 -95 -60 -155t-168 -61q-109 0 -175 88t-66 233t124 286q60 69 162 112t230 43q264 0 418 -162t153 -432q0 -403 -284 -711q-139 -152 -334 -285q35 15 97 15zM1288 369q47 0 80 -33t33 -80t-33 -80t-80 -33t-80 33 t-32 80q0 47 32 80q33 33 80 33zM1290 -145q47 0 79 -32t32 -79t-32 -79t-79 -32t-79 32t-31 79q0 47 31 79q32 32 79 32z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E065[] =
+    "<symbol id=\"E065\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M647 983q-35 0 -57 -19q-22 -18 -21 -54q0 -36 64 -83q18 -14 31 -4q49 33 49 92q0 68 -66 68zM475 639q-1 -33 19 -57t61 -23q41 0 66 23q25 22 25 52t-16 46q-15 16 -67 57q-17 14 -31 6q-57 -35 -57 -104zM645 1014q76 0 111 -30t35 -77q0 -70 -76 -108 q-22 -11 -17 -21q2 -4 11 -14q33 -33 33 -90t-41 -95q-40 -38 -101 -49q227 -26 357 -184t130 -403q0 -403 -274 -699t-762 -534q-20 -10 -35 -10q-27 0 -26 24q0 20 30 37q410 236 585 506t175 657q0 252 -77 393t-227 141t-244 -78q-94 -79 -95 -153q0 -37 33 -37 q10 0 41 8t61 7q80 1 138 -59t59 -155q0 -95 -60 -155t-168 -61q-109 0 -175 88t-66 217q0 164 127 305t360 152q-92 25 -92 111t92 122q26 9 11 31q-25 27 -25 83t48 93t124 37zM1288 369q47 0 80 -33t33 -80t-33 -80t-80 -33t-80 33t-32 80q0 47 32 80q33 33 80 33z M1290 -145q47 0 79 -32t32 -79t-32 -79t-79 -32t-79 32t-31 79q0 47 31 79q32 32 79 32z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E066[] =
+    "<symbol id=\"E066\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M516 537q264 0 418 -162t153 -432q0 -403 -274 -699t-762 -534q-20 -10 -35 -10q-27 0 -26 24q0 20 30 37q410 236 585 506t175 657q0 252 -77 393t-227 141t-244 -78q-94 -79 -95 -153q0 -37 33 -37q10 0 41 8t61 7q80 1 138 -59t59 -155q0 -95 -60 -155t-168 -61 q-109 0 -175 88t-66 233t124 286q60 69 162 112t230 43zM1290 -145q47 0 79 -32t32 -79t-32 -79t-79 -32t-79 32t-31 79q0 47 31 79q32 32 79 32zM1288 369q47 0 80 -33t33 -80t-33 -80t-80 -33t-80 33t-32 80q0 47 32 80q33 33 80 33zM692 1012q10 0 37 -8q72 -21 168 2 q27 10 35 10t8 -11t-18 -30q-78 -70 -170 -70q-20 0 -44 3t-28 -9l-18 -57q-4 -10 0 -14t26 1q22 6 49 7q133 0 133 -105q0 -88 -57 -143q-57 -56 -133 -56t-109 29t-33 65t18 58q17 22 44 21q49 0 49 -48q0 -39 -33 -53q-16 -10 -16 -16q0 -23 51 -23q51 1 84 55t33 114 t-57 61q-43 0 -76 -39q-16 -12 -25 -13q-20 0 -20 19q0 6 6 24l70 203q6 23 26 23zM567 1004q0 -10 -2 -17l-123 -387q-4 -16 4 -18l43 -4q18 0 19 -17q0 -18 -21 -18h-211q-20 0 -20 17t18 18l43 4q12 2 17 14l86 268q2 6 2 14t-7 9q-7 0 -16 -10l-47 -52q-10 -14 -26 -14 q-16 -1 -16 13t9 28l136 152q10 10 18 10l39 -13l43 13q12 0 12 -10z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E069[] =
+    "<symbol id=\"E069\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M782 481v-962q0 -31 -28 -31h-271q-29 0 -28 31v962q0 31 28 31h271q28 0 28 -31zM328 -481q0 -31 -29 -31h-270q-29 0 -29 31v962q0 31 29 31h270q29 0 29 -31v-962z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E06A[] =
+    "<symbol id=\"E06A\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M557 705q0 12 -9 21t-22 9h-413q-11 0 -21 -9t-10 -21v-1418q0 -12 9 -21t22 -9h413q12 0 22 9q9 9 9 21v1418zM639 -922q0 -12 -9 -21t-24 -9h-573q-14 0 -24 9q-9 9 -9 21v1835q0 11 9 21t24 10h573q14 0 24 -9t9 -22v-1835z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E080[] =
+    "<symbol id=\"E080\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M440 451q-63 0 -108 -127q-45 -126 -45 -308t45 -309t108 -127t109 127q45 127 45 307t-46 308t-108 129zM881 0q0 -212 -129 -362q-130 -150 -312 -150t-311 150t-129 362t129 364q129 150 311 150t312 -150q129 -151 129 -364z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E081[] =
+    "<symbol id=\"E081\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M504 -377q0 -25 22 -49t46 -23q26 0 26 -22l2 -8q0 -33 -33 -33h-436q-45 0 -45 32t35 32t63 22q28 23 27 55v529q0 29 -12 28q-8 0 -21 -20l-110 -180q-8 -18 -20 -18q-52 -2 -50 32l8 27l197 448q16 39 37 39l4 -2h6q45 -6 106 -6l107 8q41 -2 41 -47v-844z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E082[] =
+    "<symbol id=\"E082\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M551 272q0 197 -184 197q-80 0 -119 -25t-43 -53q0 -13 35 -31q34 -18 70 -52t36 -78t-8 -80t-43 -72q-35 -37 -90 -37t-101 32q-45 32 -69 81q-18 47 -19 88q0 78 68 160t182 104q61 14 136 14t120 -6t115 -30q211 -72 211 -275q0 -196 -238 -259q-94 -26 -182 -68 t-117 -89q35 12 76 12q98 0 221 -49q9 -5 47 -16q39 -12 59 -12q38 0 70 88l2 2v4q6 20 27 20q25 1 25 -28q-28 -249 -153 -302q-56 -24 -130 -24q-109 0 -223 83q-37 28 -79 28q-71 0 -139 -94q-24 -31 -37 -31t-20 4q-37 23 -37 63q45 195 230 314q137 84 219 192t82 225z \"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E083[] =
+    "<symbol id=\"E083\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M549 40q0 -11 3 -16t19 -10l68 -18l43 -25q31 -18 49 -43q50 -58 57 -143v-14q0 -129 -124 -207t-287 -78h-19q-344 6 -350 225q0 86 45 125q50 55 107 55q57 1 96 -23q64 -38 66 -124q-2 -31 -25 -73t-23 -62v-10q2 -27 58 -33h8q6 -2 32 -2t62 31q70 59 72 210 q0 40 -38 102q-22 37 -78 61t-122 24t-67 24q0 31 49 35q110 7 180 59t70 158v15q0 49 -24 87q-43 70 -167 70q-20 0 -52 -14t-34 -37v-8q0 -23 27 -27l14 -2l21 -6q40 -13 47 -78v-16q0 -55 -36 -94t-99 -39h-11q-86 6 -126 55t-40 111q0 81 111 153t242 72l30 -2 q89 -4 176 -43q168 -76 167 -207t-125 -186q-4 -2 -64 -19q-8 -2 -8 -13z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E084[] =
+    "<symbol id=\"E084\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M426 -152v172q0 25 18 48l195 235q16 18 41 19q25 0 25 -35v-439h149q31 0 31 -38t-31 -39h-149v-121q0 -42 20 -60t43 -18q45 0 45 -42t-41 -42h-436q-39 0 -39 41t47 41q82 0 82 72v129h-381q-41 0 -41 34q0 17 4 22t4 7l13 16q262 367 262 625q0 39 47 39l145 -4 l139 4q31 0 31 -29q-4 -22 -92 -146t-211 -276t-196 -215h276z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E085[] =
+    "<symbol id=\"E085\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M359 262q-103 0 -195 19h-8q-27 0 -31 -27l-10 -133v-8q0 -14 8 -15q6 0 10 2q100 59 273 60q139 0 238 -100t99 -240q0 -142 -101 -238q-102 -96 -284 -96t-270 62t-88 192q0 88 44 138t115 50t117 -46t48 -124q0 -78 -78 -127q-47 -26 0 -57q14 -6 57 -6t85 33 q79 62 79 217q0 154 -68 212t-145 58t-151 -83q-7 -9 -12 -17t-19 -8q-41 0 -41 30v4l22 455q4 35 49 35q174 -20 277 -21l252 19q29 0 29 -33q-1 -58 -39 -119q-25 -40 -92 -64t-170 -24z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E086[] =
+    "<symbol id=\"E086\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M412 4q-49 0 -84 -68t-35 -161q0 -94 35 -162t84 -68t85 68t35 162q0 94 -35 162q-36 67 -85 67zM418 -510q-98 0 -164 29q-111 49 -193 196q-59 109 -63 283v8q0 139 80 291q53 103 154 159t210 57t165 -21q138 -55 138 -166q0 -49 -40 -103t-111 -53q-70 0 -113 43 q-31 35 -31 76t10 57q9 16 33 44t23 44q0 31 -67 31q-164 0 -170 -389q0 -49 18 -49q8 0 12 4q83 71 183 71t186 -63q113 -84 125 -205l2 -29q0 -147 -119 -241q-92 -74 -268 -74z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E087[] =
+    "<symbol id=\"E087\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M483 125q-53 0 -153 77t-132 77t-54 -12t-44 -52q-22 -39 -41 -93t-36 -54t-23 24v346q0 25 18 25t27 -14q9 -17 25 -33t34 -15t57 42q39 42 79 54q39 13 102 13q64 0 132 -44t112 -87q46 -43 66 -43q36 0 74 96q15 41 20 49t21 13q17 6 19 6q25 0 30 -18t5 -64v-8 q0 -84 -60 -226q-59 -142 -121 -308q-62 -167 -62 -312q0 -76 -33 -76l-168 18l-133 -18q-27 0 -33 13t-6 60t40 129t94 143q54 62 130 136t117 119t41 70q-5 18 -13 18t-20 -8q-57 -43 -111 -43z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E088[] =
+    "<symbol id=\"E088\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M633 295q0 67 -49 109q-78 68 -172 67q-94 0 -160 -35t-66 -92t30 -83q55 -49 100 -67q46 -18 70 -26t68 -24t70 -23q109 63 109 174zM362 -463q104 0 154 43q51 43 51 106q-1 63 -27 91q-26 29 -42 43q-31 28 -232 112q-70 -28 -116 -80t-46 -112q0 -96 77 -150t181 -53 zM799 -166q0 -190 -124 -277t-294 -87t-282 66t-111 194q0 158 188 247q-178 100 -178 273q0 129 110 205t289 75q76 0 170 -32q187 -63 187 -205q0 -141 -123 -219q168 -86 168 -240z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E089[] =
+    "<symbol id=\"E089\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M393 -2q49 0 84 68t35 162t-35 161q-35 68 -84 68t-85 -68t-36 -162q0 -93 36 -161t85 -68zM387 512q98 0 164 -29q111 -49 192 -196q59 -109 64 -283v-8q0 -139 -80 -291q-53 -103 -155 -159t-210 -57t-164 21q-138 55 -139 166q0 52 33 94t73 53t56 11q55 0 103 -43 q30 -33 30 -76t-9 -59t-33 -44t-23 -44q0 -31 67 -31q164 0 170 389v11q0 41 -18 40q-8 0 -12 -4q-82 -71 -182 -71t-187 63q-113 84 -125 203l-2 29q0 147 119 241q92 74 268 74z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E08A[] =
+    "<symbol id=\"E08A\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M512 186q0 66 36 115t93 49q37 0 37 45q0 32 -65 57q-36 13 -84 13q-48 1 -90 -17q-177 -74 -177 -391q0 -500 254 -499q70 0 169 63q52 33 87 101t35 161q0 29 10 33t21 4q30 0 30 -35q-1 -78 -35 -154q-35 -75 -76 -123q-42 -48 -121 -83t-179 -35q-201 0 -324 149 t-123 323t74 314t205 197q92 41 200 41t226 -74q45 -29 78 -86t33 -133t-40 -120q-39 -44 -77 -50l-39 -6q-55 0 -107 38q-51 37 -51 103z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E08B[] =
+    "<symbol id=\"E08B\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M815 -82h8q31 0 32 -33q2 -72 -33 -150q-36 -77 -77 -124t-117 -83t-175 -38q-23 -10 -23 -29v-161q0 -35 -37 -35q-12 0 -23 10t-12 25v157q0 11 -13 29t-26 22q-109 29 -184 119q-135 158 -135 353q0 156 74 294t205 197l55 21q4 0 14 11t10 21v181q0 12 12 23t25 11 q15 0 25 -11t10 -23v-150q0 -9 7 -27t16 -20h10l2 2q73 0 186 -44q68 -26 115 -90t47 -149q0 -84 -39 -128t-78 -50l-39 -6q-55 0 -106 37q-51 36 -51 102t36 115t93 49q37 0 37 39t-52 57q-76 27 -133 17q-10 -1 -30 -21t-21 -30v-811q0 -27 23 -32t49 -5q111 0 209 96 q35 35 59 94q25 59 25 133q0 35 20 35zM358 -334v674q0 12 -11 27t-17 2q-78 -111 -78 -316q0 -287 84 -405q4 -6 10 -6q12 -1 12 24z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E0A2[] =
+    "<symbol id=\"E0A2\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M221 80q0 -100 72 -182q16 -24 52 -54q63 -54 140 -53q133 0 154 107q4 25 4 39q0 98 -76 186t-178 88q-135 0 -162 -82q-6 -25 -6 -49zM0 1q0 109 122 182t296 73q176 0 311 -74t135 -178q0 -260 -442 -260q-215 0 -319 74q-103 74 -103 183z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E0A3[] =
+    "<symbol id=\"E0A3\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M541 80q0 24 -19 58t-79 34t-197 -80q-186 -109 -187 -182q0 -16 13 -41q27 -47 92 -47t190 84q187 122 187 174zM393 256q99 0 155 -46t56 -126t-74 -192q-40 -62 -128 -105q-86 -43 -188 -43t-159 45q-55 45 -55 132t86 203q43 56 126 94t181 38z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E0A4[] =
+    "<symbol id=\"E0A4\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M199 -256q-86 0 -143 46q-56 46 -56 124q0 134 120 238t286 104q88 0 143 -46t55 -124q0 -126 -132 -234t-273 -108z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E0FA[] =
+    "<symbol id=\"E0FA\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 1q0 109 122 182t296 73q176 0 311 -74t135 -178q0 -260 -442 -260q-215 0 -319 74q-103 74 -103 183z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E101[] =
+    "<symbol id=\"E101\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M881 512h204l-880 -1024h-205z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E220[] =
+    "<symbol id=\"E220\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M307 -63l-614 -127v256l614 127v-256z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E221[] =
+    "<symbol id=\"E221\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M305 2v-256l-614 -129v256zM305 127l-614 -127v256l614 127v-256z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E222[] =
+    "<symbol id=\"E222\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M307 -190v-256l-614 -127v256zM307 186v-256l-614 -127v256zM307 313l-614 -129v256l614 129v-256z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E223[] =
+    "<symbol id=\"E223\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M307 510l-614 -127v256l614 127v-256zM307 -375v-256l-614 -127v256zM307 2v-256l-614 -127v256zM307 129l-614 -129v256l614 129v-256z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E224[] =
+    "<symbol id=\"E224\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M305 582v-256l-614 -129v256zM305 707l-614 -127v256l614 127v-256zM307 -559v-256l-614 -127v256zM307 -182v-256l-614 -127v256zM307 -55l-614 -129v256l614 129v-256z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E240[] =
+    "<symbol id=\"E240\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M397 -1597q0 12 6 30q49 131 49 305t-56 302t-179 285t-217 173v490q0 31 20 30q53 0 62 -45q43 -254 223 -534q236 -375 236 -703q0 -143 -41 -301l-13 -53q-6 -25 -26 -35t-31 -4q-33 23 -33 60z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E241[] =
+    "<symbol id=\"E241\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M23 -29q-23 0 -23 31v481q186 63 286 169q159 169 222 433q27 109 27 225t-43 246q-23 63 18 91t59 -23q57 -229 58 -371q0 -303 -254 -702q-99 -141 -153 -225q-115 -178 -138 -310q-6 -45 -59 -45z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E260[] =
+    "<symbol id=\"E260\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M63 899q39 0 39 -35q0 -262 -14 -577q0 -25 23 -35q4 -2 12 -2t43 29q57 34 122 32t120 -56t55 -138q0 -174 -246 -346q-18 -13 -87 -71t-83 -58t-22 9q-17 19 -23 898l-2 293q2 27 22 42t41 15zM119 -197q8 0 20 7q98 61 148 153q35 61 35 121t-33 98q-18 23 -59 23 q-41 -1 -85 -43q-45 -42 -50 -58t-5 -65l6 -205q0 -31 23 -31z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E261[] =
+    "<symbol id=\"E261\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M328 383q16 0 16 -16v-1029q0 -25 -25 -24h-26q-25 0 -25 24v306q0 22 -47 22t-190 -61l-6 -2h-5l-4 -2q-16 0 -16 18v1055q0 25 25 24h26q25 0 25 -24v-342q0 -10 38 -10t132 34l35 13h2q4 2 6 2l30 10q2 2 9 2zM76 80v-211q0 -12 34 -12q34 1 96 29t62 55v211 q0 10 -28 10t-96 -31t-68 -51z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E262[] =
+    "<symbol id=\"E262\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M164 -406v-284q0 -23 -31 -23t-31 23v252q0 10 -7 21t-14 11t-9 -2l-47 -18h-5l-4 -2q-16 0 -16 18v146q0 27 25 33q43 18 61 26t16 43v203q0 13 -8 25t-18 12h-2l-49 -23l-5 -2h-4q-16 0 -16 19v145q0 27 25 33q41 16 53 22q25 12 24 56v276q0 23 31 23t31 -23v-246 q0 -41 24 -41q70 16 129 52q23 14 27 59v266q0 23 31 23t31 -23v-250q0 -27 28 -26l51 18q4 2 11 2q14 0 14 -16v-146q0 -24 -25 -34l-53 -21q-10 -4 -18 -24t-8 -35v-191q0 -37 26 -37l53 21q4 2 11 2q14 0 14 -16v-146q0 -25 -25 -35q-43 -16 -61 -24t-18 -45v-291 q0 -23 -31 -23t-31 23v256q0 10 -8 23t-19 14l-133 -53q-20 -8 -20 -46zM352 40q0 95 -8 116q-6 12 -39 12t-86 -27t-55 -51q-6 -25 -6 -133q0 -107 5 -119t35 -12t84 26t62 56q8 37 8 132z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E263[] =
+    "<symbol id=\"E263\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M293 2q0 -15 96 -68h21q68 0 82 -16t14 -78t-17 -78q-17 -18 -75 -18t-82 20q-10 8 -10 78q-8 27 -30 61t-40 34q-27 0 -64 -87q-4 -4 -4 -38t-17 -50q-17 -18 -75 -18t-82 20q-10 6 -10 76t13 82t85 12h21q29 10 61 30t33 40q0 14 -96 68l-21 -2q-61 0 -86 20 q-10 10 -10 80t13 80t77 10t78 -14q16 -12 16 -80q8 -29 30 -63t40 -33q25 0 68 96q0 72 12 83t78 11t80 -16t14 -78t-14 -76q-25 -20 -78 -20l-25 2q-96 -35 -96 -70z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E264[] =
+    "<symbol id=\"E264\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M496 -197q6 0 18 7q107 65 150 153q32 63 32 121t-30 100q-18 20 -58 21t-87 -42q-46 -43 -50 -55t-4 -53l6 -219q0 -33 23 -33zM322 84q0 62 -26 90q-61 71 -165 -26q-31 -28 -36 -45t-5 -66l6 -201q0 -33 23 -33q8 0 18 7q103 65 152 153q33 59 33 121zM498 250 q14 0 44 24q44 35 101 35h12q76 -2 131 -55t56 -137q0 -174 -250 -348q-12 -7 -80 -67t-92 -60q-8 0 -16 8t-15 278q-66 -84 -172 -157q-6 -5 -78 -67t-89 -62t-24 9q-16 21 -22 898l-4 293q2 25 22 39t41 14q39 0 39 -33l-14 -575q0 -29 23 -35q4 -2 12 -2q9 0 53 30 q45 30 90 29h13q55 0 104 -33l-6 566q2 25 21 39t42 14q39 0 39 -33l-12 -575q0 -37 31 -37z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E265[] =
+    "<symbol id=\"E265\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M717 -406v-284q0 -23 -31 -23t-31 23v252q0 10 -7 21t-14 11t-9 -2l-47 -18h-5l-4 -2q-16 0 -16 18v146q0 27 25 33q42 18 60 26t17 43v203q0 13 -8 25t-18 12h-2l-49 -23l-5 -2h-4q-16 0 -16 19v145q0 27 25 33q41 16 53 22q25 12 24 56v276q0 23 31 23t31 -23v-246 q0 -41 24 -41q70 16 129 52q23 14 27 59v266q0 23 31 23t30 -23v-250q0 -27 29 -26l51 18q4 2 11 2q14 0 14 -16v-146q0 -24 -25 -34l-53 -21q-10 -4 -18 -24t-9 -35v-191q0 -37 27 -37l53 21q4 2 11 2q14 0 14 -16v-146q0 -25 -25 -35q-44 -16 -62 -24t-18 -45v-291 q0 -23 -30 -23t-31 23v256q0 10 -8 23t-19 14l-133 -53q-20 -8 -20 -46zM905 40q0 95 -8 116q-6 12 -39 12t-86 -27t-55 -51q-6 -25 -6 -133q0 -107 5 -119q4 -12 34 -12t84 26t63 56q8 37 8 132zM293 2q0 -15 96 -68h21q68 0 82 -16t14 -78t-17 -78q-17 -18 -75 -18t-82 20 q-10 8 -10 78q-8 27 -30 61t-40 34q-27 0 -64 -87q-4 -4 -4 -38t-17 -50q-17 -18 -75 -18t-82 20q-10 6 -10 76t13 82t85 12h21q29 10 61 30t33 40q0 14 -96 68l-21 -2q-61 0 -86 20q-10 10 -10 80t13 80t77 10t78 -14q16 -12 16 -80q8 -29 30 -63t40 -33q25 0 68 96 q0 72 12 83t78 11t80 -16t14 -78t-14 -76q-25 -20 -78 -20l-25 2q-96 -35 -96 -70z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E266[] =
+    "<symbol id=\"E266\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1079 84q0 60 -25 91q-25 30 -66 30q-41 -1 -85 -43q-45 -42 -50 -58t-5 -65l6 -205q0 -31 23 -31q8 0 20 7q98 61 147 153q35 61 35 121zM496 -197q6 0 18 7q107 65 150 153q32 63 32 121t-30 100q-18 20 -58 21t-87 -42q-46 -43 -50 -55t-4 -53l6 -219q0 -33 23 -33z M322 84q0 62 -26 90q-61 71 -165 -26q-31 -28 -36 -45t-5 -66l6 -201q0 -33 23 -33q8 0 18 7q103 65 152 153q33 59 33 121zM498 250q14 0 44 24q44 35 101 35h12q57 0 109 -37l-6 570q2 27 21 42t42 15q39 0 39 -35q0 -262 -14 -577q0 -25 22 -35q4 -2 12 -2t44 29 q57 34 122 32q64 -2 119 -56t56 -138q0 -174 -246 -346q-18 -12 -87 -70t-83 -59q-14 0 -23 10q-8 12 -12 280q-68 -86 -178 -163q-12 -7 -80 -67t-92 -60q-8 0 -16 8t-15 278q-66 -84 -172 -157q-6 -5 -78 -67t-89 -62t-24 9q-16 21 -22 898l-4 293q2 25 22 39t41 14 q39 0 39 -33l-14 -575q0 -29 23 -35q4 -2 12 -2q9 0 53 30q45 30 90 29h13q55 0 104 -33l-6 566q2 25 21 39t42 14q39 0 39 -33l-12 -575q0 -37 31 -37z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E267[] =
+    "<symbol id=\"E267\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M541 899q39 0 39 -35q0 -262 -15 -577q0 -25 23 -35q4 -2 12 -2t43 29q57 34 122 32t120 -56t55 -138q0 -174 -246 -346q-18 -13 -86 -71t-83 -58t-23 9q-17 19 -23 898l-2 293q1 27 21 42t43 15zM596 -197q8 0 20 7q98 61 148 153q35 61 35 121t-33 98q-18 23 -48 23 q-30 -1 -56 -15t-55 -42q-30 -28 -35 -44t-5 -65l6 -205q0 -31 23 -31zM328 383q16 0 16 -16v-1029q0 -25 -25 -24h-26q-25 0 -25 24v306q0 22 -47 22t-190 -61l-6 -2h-5l-4 -2q-16 0 -16 18v1055q0 25 25 24h26q25 0 25 -24v-342q0 -10 38 -10t132 34l35 13h2q4 2 6 2 l30 10q2 2 9 2zM76 80v-211q0 -12 34 -12q34 1 96 29t62 55v211q0 10 -28 10t-96 -31t-68 -51z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E268[] =
+    "<symbol id=\"E268\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M881 162v-191q0 -37 26 -37l54 21q4 2 10 2q14 0 14 -16v-146q0 -25 -24 -35q-43 -16 -62 -24t-18 -45v-291q0 -23 -31 -23t-31 23v256q0 10 -8 24t-23 13l-129 -53q-20 -8 -20 -46v-284q0 -23 -31 -23t-30 23v252q0 10 -8 21t-14 11q-7 0 -9 -2l-47 -18h-4l-4 -2 q-16 0 -17 18v146q0 27 25 33q42 18 60 26t18 43v203q0 13 -8 25t-19 12h-2l-49 -23q-2 0 -8 -2q-16 0 -17 19v145q0 27 25 33q41 16 53 22q25 12 25 56v276q0 23 30 23t31 -23v-246q0 -41 25 -41q70 16 129 52q23 14 26 59v266q0 23 31 23t31 -23v-250q0 -27 28 -26l52 18 q4 2 10 2q14 0 14 -16v-146q1 -24 -24 -34l-54 -21q-10 -4 -18 -24t-8 -35zM827 40q0 95 -8 116q-6 12 -39 12t-86 -27t-55 -51q-6 -25 -6 -133q0 -107 5 -119t35 -12t84 26t62 56q8 37 8 132zM328 383q16 0 16 -16v-1029q0 -25 -25 -24h-26q-25 0 -25 24v306q0 22 -47 22 t-190 -61l-6 -2h-5l-4 -2q-16 0 -16 18v1055q0 25 25 24h26q25 0 25 -24v-342q0 -10 38 -10t132 34l35 13h2q4 2 6 2l30 10q2 2 9 2zM76 80v-211q0 -12 34 -12q34 1 96 29t62 55v211q0 10 -28 10t-96 -31t-68 -51z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E269[] =
+    "<symbol id=\"E269\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M717 -406v-284q0 -23 -31 -23t-31 23v252q0 10 -7 21t-14 11t-9 -2l-47 -18h-5l-4 -2q-16 0 -16 18v146q0 27 25 33q42 18 60 26t17 43v203q0 13 -8 25t-18 12h-2l-49 -23l-5 -2h-4q-16 0 -16 19v145q0 27 25 33q41 16 53 22q25 12 24 56v276q0 23 31 23t31 -23v-246 q0 -41 24 -41q70 16 129 52q23 14 27 59v266q0 23 31 23t30 -23v-250q0 -27 29 -26l51 18q4 2 11 2q14 0 14 -16v-146q0 -24 -25 -34l-53 -21q-10 -4 -18 -24t-9 -35v-191q0 -37 27 -37l53 21q4 2 11 2q14 0 14 -16v-146q0 -25 -25 -35q-44 -16 -62 -24t-18 -45v-291 q0 -23 -30 -23t-31 23v256q0 10 -8 23t-19 14l-133 -53q-20 -8 -20 -46zM905 40q0 95 -8 116q-6 12 -39 12t-86 -27t-55 -51q-6 -25 -6 -133q0 -107 5 -119q4 -12 34 -12t84 26t63 56q8 37 8 132zM164 -406v-284q0 -23 -31 -23t-31 23v252q0 10 -7 21t-14 11t-9 -2l-47 -18 h-5l-4 -2q-16 0 -16 18v146q0 27 25 33q43 18 61 26t16 43v203q0 13 -8 25t-18 12h-2l-49 -23l-5 -2h-4q-16 0 -16 19v145q0 27 25 33q41 16 53 22q25 12 24 56v276q0 23 31 23t31 -23v-246q0 -41 24 -41q70 16 129 52q23 14 27 59v266q0 23 31 23t31 -23v-250q0 -27 28 -26 l51 18q4 2 11 2q14 0 14 -16v-146q0 -24 -25 -34l-53 -21q-10 -4 -18 -24t-8 -35v-191q0 -37 26 -37l53 21q4 2 11 2q14 0 14 -16v-146q0 -25 -25 -35q-43 -16 -61 -24t-18 -45v-291q0 -23 -31 -23t-31 23v256q0 10 -8 23t-19 14l-133 -53q-20 -8 -20 -46zM352 40 q0 95 -8 116q-6 12 -39 12t-86 -27t-55 -51q-6 -25 -6 -133q0 -107 5 -119t35 -12t84 26t62 56q8 37 8 132z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E26A[] =
+    "<symbol id=\"E26A\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M289 471q0 -6 -4 -10q-86 -78 -124 -186q-38 -107 -38 -277t37 -278t125 -185q4 -4 4 -8v-31q0 -4 -6 -4q-283 180 -283 508q0 158 72 294t215 212q2 0 2 -6v-29z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E26B[] =
+    "<symbol id=\"E26B\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 471v29q0 6 2 6q143 -76 215 -212t72 -294q0 -328 -283 -508q-6 0 -6 4v31q0 4 4 8q88 77 125 185t37 278t-38 278t-124 185q-4 4 -4 10z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4A0[] =
+    "<symbol id=\"E4A0\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M33 2q-17 0 -25 22t-8 27q0 18 29 31q438 150 457 156t20 14q0 12 -14 14l-463 158q-29 10 -29 29q0 5 7 27t28 22q2 0 18 -4l615 -209q27 -8 27 -38t-27 -36l-627 -211q-2 -2 -8 -2z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4A1[] =
+    "<symbol id=\"E4A1\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M33 -500q-17 0 -25 22t-8 27q0 18 29 31q438 150 457 156t20 14q0 12 -14 14l-463 158q-29 10 -29 29q0 5 7 27t28 22q2 0 18 -4l615 -209q27 -8 27 -38t-27 -36l-627 -211q-2 -2 -8 -2z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4A2[] =
+    "<symbol id=\"E4A2\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M172 86q0 -34 -26 -60t-60 -26t-60 26t-26 60t26 60t60 26t60 -26t26 -60z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4A3[] =
+    "<symbol id=\"E4A3\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M172 -86q0 -34 -26 -60t-60 -26t-60 26t-26 60t26 60t60 26t60 -26t26 -60z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4A4[] =
+    "<symbol id=\"E4A4\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M643 0h-596q-33 0 -41 12t-8 32t2 30q6 24 47 24h596q33 0 41 -12t8 -37t-8 -37t-41 -12z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4A5[] =
+    "<symbol id=\"E4A5\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M643 -98h-596q-33 0 -41 12t-8 39q0 47 49 47h596q33 0 41 -12t8 -37t-8 -37t-41 -12z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4A6[] =
+    "<symbol id=\"E4A6\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M102 600q102 0 103 -47q0 -73 -35 -315t-67 -242t-66 249q-35 249 -35 310q2 21 30 33t70 12z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4A7[] =
+    "<symbol id=\"E4A7\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M102 -604q-42 0 -70 12t-30 33q0 61 35 310t67 249t66 -242q35 -242 35 -315q-1 -47 -103 -47z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4A8[] =
+    "<symbol id=\"E4A8\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M92 586q64 0 80 8h6q4 0 4 -6q-28 -66 -50 -248t-26 -334q0 -6 -14 -6t-14 6q-4 154 -26 336t-50 246q0 6 4 6h6q16 -8 80 -8z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4A9[] =
+    "<symbol id=\"E4A9\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M94 -586q-62 0 -82 -8h-6q-4 0 -4 6q28 64 50 246t26 336q0 6 14 6t14 -6q4 -152 27 -334t49 -248q0 -6 -4 -6h-6q-16 8 -78 8z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4AA[] =
+    "<symbol id=\"E4AA\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M98 575v-557q0 -18 -18 -18h-62q-18 0 -18 18v557q0 18 18 19h62q18 -1 18 -19z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4AB[] =
+    "<symbol id=\"E4AB\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M98 -18v-557q0 -18 -18 -19h-62q-18 0 -18 19v557q0 18 18 18h62q18 0 18 -18z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4AC[] =
+    "<symbol id=\"E4AC\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M23 -2q-25 0 -25 25q0 6 2 10l217 473q5 12 19 12t22 -12l221 -473q2 -2 2 -10q0 -18 -22 -23h-140q-12 0 -22 12q-115 244 -117 252q-6 6 -11 6t-9 -6l-115 -252q-6 -14 -22 -14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4AD[] =
+    "<symbol id=\"E4AD\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M457 0q24 0 24 -25q0 -6 -2 -10l-217 -473q-6 -12 -20 -12t-21 12l-221 473q-2 2 -2 10q0 18 22 23h140q12 0 22 -12q115 -244 117 -252q6 -6 11 -6t9 6l115 252q6 14 23 14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4AE[] =
+    "<symbol id=\"E4AE\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M328 86q0 -34 -26 -60t-60 -26t-61 26q-25 26 -25 60t26 60t60 26t60 -26t26 -60zM23 387q-25 0 -25 25q0 6 2 10l217 473q5 12 19 12t22 -12l221 -473q2 -2 2 -10q0 -18 -22 -23h-140q-12 0 -22 12q-115 244 -117 252q-6 6 -11 6t-9 -6l-115 -252q-6 -14 -22 -14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4AF[] =
+    "<symbol id=\"E4AF\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M324 -86q0 -34 -26 -60t-60 -26t-61 26q-25 26 -25 60t26 60t60 26t60 -26t26 -60zM457 -408q24 0 24 -24q0 -6 -2 -10l-217 -473q-6 -13 -19 -13t-22 13l-221 473q-2 2 -2 10q-1 18 22 22h140q12 0 22 -12q115 -244 117 -252q6 -6 11 -6t9 6l115 252q6 14 23 14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4B0[] =
+    "<symbol id=\"E4B0\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M436 86q0 -34 -26 -60t-60 -26t-60 26t-26 60t26 60t60 26t60 -26t26 -60zM33 360q-17 0 -25 22t-8 28q0 18 29 30q438 150 457 156t20 14q0 12 -14 15l-463 157q-29 10 -29 29q0 5 7 27t28 22q2 0 18 -4l615 -209q27 -8 27 -38t-27 -36l-627 -211q-2 -2 -8 -2z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4B1[] =
+    "<symbol id=\"E4B1\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M434 -86q0 -34 -26 -60t-60 -26t-60 26t-26 60t26 60t60 26t60 -26t26 -60zM31 -842q-17 0 -25 22t-8 27q0 18 29 31q438 150 457 156t20 14q0 12 -15 14l-462 158q-29 10 -29 29q0 5 7 27t28 22q2 0 18 -4l615 -209q27 -8 27 -38t-27 -36l-627 -211q-2 -2 -8 -2z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4B2[] =
+    "<symbol id=\"E4B2\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M438 86q0 -34 -26 -60t-60 -26t-60 26t-26 60t26 60t60 26t60 -26t26 -60zM643 393h-596q-33 1 -41 13t-8 32t2 28q6 24 47 26h596q33 0 41 -12t8 -38q0 -25 -8 -37t-41 -12z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4B3[] =
+    "<symbol id=\"E4B3\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M428 -86q0 -34 -26 -60t-60 -26t-60 26t-26 60t26 60t60 26t60 -26t26 -60zM643 -496h-596q-33 0 -41 12t-8 34q0 20 2 28q6 23 47 25h596q33 -1 41 -13t8 -36t-8 -38q-8 -12 -41 -12z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4B4[] =
+    "<symbol id=\"E4B4\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M643 0h-596q-33 0 -41 12t-8 32t2 30q6 24 47 24h596q33 0 41 -12t8 -37t-8 -37t-41 -12zM33 207q-17 -1 -25 21t-8 28q0 18 29 31q438 149 457 155t20 15q0 12 -14 14l-463 158q-29 10 -29 28q0 4 7 27t28 23q2 0 18 -5l615 -208q27 -8 27 -38t-27 -36l-627 -211 q-2 -2 -8 -2z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4B5[] =
+    "<symbol id=\"E4B5\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M643 -98h-596q-33 0 -41 12t-8 39q0 47 49 47h596q33 0 41 -12t8 -37t-8 -37t-41 -12zM33 -707q-17 -1 -25 21t-8 29q0 18 29 30q438 150 457 156t20 14q0 12 -14 15l-463 157q-29 10 -29 29q0 4 7 26t28 23q2 0 18 -4l615 -209q27 -8 27 -38t-27 -36l-627 -211 q-2 -2 -8 -2z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4B6[] =
+    "<symbol id=\"E4B6\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 18q0 42 144 232t182 227q12 8 20 8q37 0 84 -47t47 -84q1 -12 -19 -32t-211 -166q-191 -145 -237 -146q-10 0 -10 8z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4B7[] =
+    "<symbol id=\"E4B7\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M18 0q40 0 230 -144t229 -184q6 -8 6 -20q0 -37 -47 -84t-82 -47q-14 0 -20 8q-39 39 -182 228t-144 233q0 10 10 10z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4B8[] =
+    "<symbol id=\"E4B8\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 424h66v-33q0 -135 96 -230t230 -95t230 95q95 95 95 230v33h65v-33q0 -163 -114 -277t-277 -114t-277 115t-114 276v33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4B9[] =
+    "<symbol id=\"E4B9\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M784 -424h-65v33q0 135 -95 230q-94 95 -230 95t-231 -95t-95 -230v-33h-66v33q0 163 115 277t277 114t276 -115q115 -115 114 -276v-33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4BA[] =
+    "<symbol id=\"E4BA\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M384 295q122 0 223 -76t145 -217h-11q-45 90 -143 139t-215 49t-219 -49t-154 -139h-8q48 141 154 217t228 76z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4BB[] =
+    "<symbol id=\"E4BB\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M367 -293q-123 0 -224 76q-100 76 -143 217h8q46 -90 144 -139t215 -49t219 49t153 139h9q-46 -141 -152 -217t-229 -76z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4BC[] =
+    "<symbol id=\"E4BC\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M643 0h-596q-33 0 -41 12t-8 32t2 30q6 24 47 24h596q33 0 41 -12t8 -37t-8 -37t-41 -12zM109 379q0 6 2 10l217 473q6 12 20 12t21 -12l221 -473q2 -2 2 -10q0 -18 -23 -23h-139q-12 0 -22 13q-115 244 -117 252q-6 6 -11 6t-10 -6l-114 -252q-6 -14 -23 -15 q-24 0 -24 25z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4BD[] =
+    "<symbol id=\"E4BD\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M350 -878q-14 0 -22 12l-222 473q-2 2 -2 10q0 18 23 23h139q12 0 23 -13q115 -244 117 -252q6 -6 11 -6t9 6l115 252q6 14 22 15q24 0 25 -25q0 -6 -2 -10l-217 -473q-5 -12 -19 -12zM643 -98h-596q-33 0 -41 12t-8 39q0 47 49 47h596q33 0 41 -12t8 -37t-8 -37t-41 -12 z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4C0[] =
+    "<symbol id=\"E4C0\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M733 106q0 -44 -33 -78q-32 -34 -78 -34t-79 34t-33 78t33 78q33 33 78 33t79 -33t33 -78zM618 453q-422 0 -538 -398q-15 -61 -45 -61q-29 0 -29 26q0 14 2 23q67 347 275 511q104 82 197 101q94 19 137 19t81 -4t127 -39q88 -35 159 -94q70 -59 144 -189t109 -305 q2 -8 2 -20q0 -29 -29 -29q-23 0 -43 43q-4 4 -13 50t-59 125q-49 79 -102 124t-153 81t-222 36z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4C1[] =
+    "<symbol id=\"E4C1\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M622 0q46 0 78 -33t33 -79q0 -46 -34 -78q-35 -32 -79 -33q-44 0 -77 33q-33 34 -33 78t33 78t79 34zM618 -459q122 0 222 36t153 81t94 112q41 68 53 100t18 54q5 21 9 33q20 43 43 43q29 0 29 -29q0 -12 -2 -20q-35 -176 -109 -305t-144 -189q-71 -59 -159 -94 t-127 -39q-40 -4 -70 -4q-125 0 -236 50q-48 22 -109 70q-208 164 -275 511q-2 8 -2 22q0 27 25 27q34 0 49 -61q116 -398 538 -398z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4C2[] =
+    "<symbol id=\"E4C2\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M66 0h-58q-8 4 -8 9t4 9q81 78 568 704q155 198 161 198q12 0 174 -200t345 -428t209 -253t26 -31l-6 -8h-76q-12 2 -19 6q-37 33 -342 381q-304 348 -310 348t-297 -337q-292 -337 -353 -388q-4 -2 -10 -6t-8 -4zM842 129q0 -45 -32 -78t-77 -33t-78 32t-33 78t33 78 t78 32t77 -32t32 -77zM338 0h-100q-6 2 -7 6q0 4 20 24q19 20 141 164q324 388 340 388t241 -268t245 -286t19 -22l-6 -6h-98q-11 2 -19 8t-107 97q-251 231 -273 231t-193 -156q-169 -156 -181 -166q-12 -8 -15 -11t-7 -3z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4C3[] =
+    "<symbol id=\"E4C3\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M66 0q4 0 30 -20q25 -20 186 -203q161 -182 304 -347t148 -165t308 346t344 383l19 6h76q6 -2 6 -8q1 -6 -25 -30t-210 -254q-184 -228 -345 -428q-162 -200 -174 -200q-6 0 -333 418t-396 484q-4 4 -4 8l8 10h58zM842 -129q0 -45 -32 -77t-77 -32t-78 32t-33 78t33 78 t78 32t77 -33t32 -78zM338 0q4 0 7 -3t14 -11t107 -98q242 -224 265 -224q22 0 199 161q176 161 188 171l15 4h98q6 -2 6 -6t-20 -23t-368 -430q-105 -123 -117 -123t-115 121t-225 266t-141 165t-20 24l7 6h100z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4C4[] =
+    "<symbol id=\"E4C4\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M729 132q0 -46 -33 -80t-80 -34q-48 0 -80 34t-32 80t34 79t78 33t79 -33q34 -33 34 -79zM111 0h-105q-6 2 -6 6t18 22t167 196q396 474 433 474q25 0 157 -150q131 -150 279 -327q148 -175 166 -193t17 -22l-6 -6h-103q-10 2 -21 11t-134 130q-331 326 -356 326 q-24 0 -349 -322q-121 -119 -134 -129t-16 -13t-7 -3z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4C5[] =
+    "<symbol id=\"E4C5\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M729 -132q0 -46 -34 -79t-79 -33q-44 0 -78 33t-34 79t33 80t79 34t80 -34q33 -34 33 -80zM111 0q4 0 7 -3q2 -3 16 -13t237 -230t248 -221q25 0 354 326q123 121 141 137l14 4h103q6 -2 6 -6q1 -4 -17 -22t-165 -193q-399 -477 -436 -477q-37 1 -434 474 q-149 178 -167 196t-18 22l6 6h105z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4C6[] =
+    "<symbol id=\"E4C6\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M729 111q0 -47 -33 -80t-79 -33q-47 0 -79 33t-32 79t32 78t78 33t80 -31q33 -32 33 -79zM102 682h1031q43 0 73 -16t29 -39v-600q0 -27 -50 -27t-50 27v385q1 37 -517 37t-518 -37v-385q0 -27 -50 -27t-50 27v600q0 23 30 39t72 16z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4C7[] =
+    "<symbol id=\"E4C7\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M729 -111q0 -47 -33 -79t-80 -31q-46 0 -78 33q-32 32 -32 78t33 79t79 33t78 -33q33 -33 33 -80zM1133 -682h-1031q-42 0 -72 16t-30 39v600q0 27 50 27t50 -27v-385q0 -37 517 -37t518 37v385q0 27 50 27t50 -27v-600q1 -23 -29 -39t-73 -16z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4C8[] =
+    "<symbol id=\"E4C8\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M109 836h1247q45 0 77 -18t31 -42v-745q0 -29 -53 -29t-53 29v581q0 39 -626 39t-626 -39v-581q0 -29 -53 -29t-53 29v745q0 24 32 42t77 18zM862 119q0 -49 -36 -84t-85 -35t-83 35t-33 84q0 49 33 84q34 35 84 35t85 -35t35 -84zM731 348q-428 0 -428 -39v-278 q0 -29 -53 -29t-53 29v463q0 25 31 42q32 17 77 17h854q45 0 77 -17t32 -42v-463q0 -29 -54 -29t-53 29v278q0 19 -129 29t-301 10z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4C9[] =
+    "<symbol id=\"E4C9\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1356 -836h-1247q-45 0 -77 18t-32 42v745q0 29 53 29t53 -29v-581q0 -39 626 -39t626 39v581q0 29 53 29t53 -29v-745q0 -24 -32 -42t-76 -18zM862 -119q0 -49 -35 -84t-85 -35t-84 35t-33 84q0 49 33 84q34 35 83 35t85 -35t36 -84zM1159 -553h-854q-45 0 -77 17 t-31 42v463q0 29 53 29t53 -29v-278q0 -19 128 -29t300 -10t301 10t129 29v278q0 29 53 29t54 -29v-463q0 -25 -32 -42t-77 -17z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4CE[] =
+    "<symbol id=\"E4CE\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M178 205q0 65 -61 65q-51 0 -83 32t-32 85t40 90t102 37t114 -39t53 -121v-14q0 -113 -53 -195q-30 -45 -94 -93t-111 -48q-12 0 -14 16l-2 3v4q0 10 39 33t71 66q31 42 31 79z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4E5[] =
+    "<symbol id=\"E4E5\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M236 -248q24 0 24 19q0 5 -24 45t-76 106l-101 123q-20 20 -20 50t29 59q122 129 122 253t-91 237q-33 42 -37 51t-5 26q0 43 41 43q20 0 37 -16l338 -396q8 -18 8 -36t-6 -29q-6 -10 -29 -46q-22 -35 -30 -49t-28 -48t-34 -84t-16 -78l-2 -27q0 -95 67 -192 q23 -32 74 -93q76 -82 76 -116q1 -8 -11 -8t-15 1q-3 2 -5 2q-92 35 -138 35t-54 -2q-47 -8 -72 -51t-25 -85t9 -64q4 -20 19 -48t34 -26q33 -29 33 -49q0 -3 -4 -15t-32 -12t-52 18q-238 182 -238 318q0 80 50 138t118 58l33 -6q25 -6 33 -6z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4E6[] =
+    "<symbol id=\"E4E6\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M274 219v-20q47 0 112 62q24 22 48 46l25 27q12 8 22 8q25 -12 25 -33q0 -3 -8 -31t-111 -398t-108 -374q-25 -20 -78 -20t-54 27q31 112 110 336q79 225 81 235t2 26t-8 17q-8 0 -30 -11q-72 -36 -134 -36t-113 35q-55 45 -55 103t40 98t97 40t97 -40t40 -97z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4E7[] =
+    "<symbol id=\"E4E7\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M317 -385q-80 -43 -147 -43q-68 0 -119 39t-51 99t41 100t98 40t99 -40q41 -41 41 -99q0 -12 -3 -20q25 0 57 18t44 44t64 183t53 179q2 22 -4 22q-6 -1 -59 -25q-52 -24 -117 -24t-115 39q-51 39 -51 98t40 101t98 41t99 -41t41 -99v-20q59 0 162 112l24 25q12 8 23 8 q20 -10 20 -22v-2q-2 -4 -2 -6l-55 -207q-39 -137 -92 -312l-238 -780q-16 -47 -78 -47t-63 37v2q2 2 2 4l195 580v2q2 2 2 4q0 10 -9 10z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4E8[] =
+    "<symbol id=\"E4E8\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M567 641q-5 0 -21 -8q-76 -39 -143 -39q-20 0 -55 9t-55 28q-57 43 -57 101t40 99q42 41 100 41t98 -41t40 -98v-18q58 0 162 109q23 24 30 29t17 5q20 0 20 -22l-2 -5v-4l-53 -206q-352 -1577 -358 -1597t-10 -26q-14 -22 -70 -22q-55 0 -55 33l147 598q0 12 -12 12 q-4 1 -48 -23q-44 -23 -111 -24q-68 0 -119 39q-52 39 -52 98t41 101t98 40q57 0 99 -39q41 -40 41 -100q0 -12 -3 -20q29 2 64 22t41 49l82 336q0 27 -14 27q-4 1 -51 -23q-48 -24 -90 -24q-92 0 -130 37q-57 43 -57 101t40 99t98 41t99 -41t41 -98q0 -12 -2 -18 q25 1 64 25t47 48l82 336q0 33 -23 33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4E9[] =
+    "<symbol id=\"E4E9\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -790q0 58 41 100q41 41 98 41t99 -40t41 -99q0 -12 -3 -19q25 0 55 16t37 38q7 21 44 171t39 162v6q2 6 2 23t-13 16q-6 1 -46 -23t-101 -24t-115 37q-57 43 -57 102t41 101t98 41q57 0 98 -41t41 -99v-20q79 0 109 88q18 51 48 185t30 141q0 18 -13 18q-4 0 -13 -4 q-92 -41 -160 -41q-67 0 -117 39q-51 39 -51 98t40 101t98 41q58 0 99 -41t41 -99v-20q27 1 70 27t50 48t46 175l37 151q4 16 4 21q0 23 -19 22q-6 -1 -63 -25t-114 -24t-109 40t-52 99t41 101t99 41q58 0 98 -41q41 -41 41 -99q0 -14 -2 -20q58 0 163 110q24 25 31 30t17 5 q18 -4 18 -30l-55 -209l-190 -820q-45 -203 -50 -202q-215 -920 -241 -1015t-25 -97q-13 -35 -73 -35t-60 29q0 8 2 14l148 571l2 13q0 23 -17 22q-4 0 -8 -2q-95 -48 -186 -25q-35 10 -56 29q-57 43 -57 101z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E4EA[] =
+    "<symbol id=\"E4EA\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M590 115q0 18 -12 18q-4 -1 -57 -25q-53 -25 -114 -24q-62 0 -113 40q-52 40 -52 99t41 101t98 41q57 0 98 -41t41 -99v-20q27 1 67 27t48 55l80 319q4 16 4 36t-7 20q-8 0 -48 -19t-66 -28t-78 -9q-54 0 -108 39t-54 98t41 101t99 41q58 0 98 -41q41 -41 41 -99v-20 q29 0 77 35t54 57q82 283 82 338q0 27 -25 27q-9 0 -31 -11t-53 -22l-2 -2q-3 0 -23 -7t-52 -7q-82 0 -121 36q-57 43 -57 101t40 100q42 41 100 41t98 -40t40 -99v-21q47 0 114 64t72 74q12 8 23 8q20 -10 20 -23l-2 -2v-6l-55 -207l-608 -2662q-6 -21 -20 -27t-68 -6 q-53 0 -54 33q2 6 76 303t76 300t2 11t-10 8h-2q-38 -19 -56 -25q-18 -5 -53 -18t-85 -1q-50 11 -77 32q-57 47 -57 105t41 98q41 41 98 41t99 -40t41 -99l6 -21q68 4 94 74q10 24 48 183t38 168t-12 9q-6 1 -55 -23q-49 -23 -110 -24q-61 0 -113 40t-52 99t41 101t98 41 q57 0 98 -41t41 -99l-2 -20q29 0 64 20q35 21 44 51t46 179q37 148 37 166z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E500[] =
+    "<symbol id=\"E500\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M219 -512h-203q-16 0 -16 14q0 8 6 15l817 1024q25 31 37 30h217q12 0 13 -10q-1 -6 -11 -20l-817 -1024q-25 -29 -43 -29zM127 410q53 0 91 -38t38 -91t-38 -91t-91 -36q-53 0 -90 38t-37 90t37 90t90 38zM961 -100q53 0 91 -38t38 -91t-38 -90t-90 -37t-91 37 q-38 37 -37 90q0 53 36 91q38 38 91 38z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E501[] =
+    "<symbol id=\"E501\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M219 -512h-203q-16 0 -16 14q0 8 6 15l817 1024q25 31 37 30h217q12 0 13 -10q-1 -6 -11 -20l-817 -1024q-25 -29 -43 -29zM690 -512h-203q-16 0 -16 14q0 8 6 15l817 1024q25 31 37 30h217q12 0 13 -10q-1 -6 -11 -20l-817 -1024q-25 -29 -43 -29zM127 410q53 0 91 -38 t38 -91t-38 -91t-91 -36q-53 0 -90 38t-37 90t37 90t90 38zM1432 -100q53 0 91 -38t38 -91t-38 -90t-90 -37t-91 37q-38 37 -37 90q0 53 36 91q38 38 91 38z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E502[] =
+    "<symbol id=\"E502\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M219 -512h-203q-16 0 -16 14q0 8 6 15l817 1024q25 31 37 30h217q12 0 13 -10q-1 -6 -11 -20l-817 -1024q-25 -29 -43 -29zM690 -512h-203q-16 0 -16 14q0 8 6 15l817 1024q25 31 37 30h217q12 0 13 -10q-1 -6 -11 -20l-817 -1024q-25 -29 -43 -29zM1182 -512h-203 q-16 0 -16 14q0 8 6 15l817 1024q25 31 37 30h217q12 0 12 -8t-10 -22l-817 -1024q-25 -29 -43 -29zM1653 -512h-203q-16 0 -16 14q0 8 6 15l817 1024q25 31 37 30h217q12 0 12 -8t-10 -22l-817 -1024q-25 -29 -43 -29zM127 410q53 0 91 -38t38 -91t-38 -91t-91 -36 q-53 0 -90 38t-37 90t37 90t90 38zM2394 -100q53 0 91 -38t38 -91t-38 -90t-90 -37t-90 37t-38 90t37 91t90 38z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E510[] =
+    "<symbol id=\"E510\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M635 754q1 57 -31 95t-101 38t-112 -38q-43 -37 -43 -93t27 -90t100 -91q23 -16 37 -16t25 8q98 68 98 187zM319 41q81 0 130 44q49 45 49 105t-30 93t-94 83t-74 52q-10 0 -26 -8q-115 -72 -114 -211q0 -66 39 -112t120 -46zM154 672q0 128 97 202t249 74t221 -59 q70 -59 70 -154q0 -137 -154 -217q-35 -18 -35 -28t25 -39q66 -72 65 -181q0 -135 -108 -213q-108 -77 -266 -77t-238 68t-80 173q0 168 182 242q37 15 37 27t-16 32q-49 59 -49 150z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E511[] =
+    "<symbol id=\"E511\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M154 672q0 128 97 202t249 74t221 -59q70 -59 70 -154q0 -137 -154 -217q-35 -18 -35 -28t25 -39q66 -72 65 -181q0 -135 -108 -213q-108 -77 -266 -77t-238 68t-80 173q0 168 182 242q37 15 37 27t-16 32q-49 59 -49 150zM319 41q81 0 130 44q49 45 49 105t-30 93 t-94 83t-74 52q-10 0 -26 -8q-115 -72 -114 -211q0 -66 39 -112t120 -46zM635 754q1 57 -31 95t-101 38t-112 -38q-43 -37 -43 -93t27 -90t100 -91q23 -16 37 -16t25 8q98 68 98 187zM995 924q39 0 63 -31t24 -79t-40 -134q-39 -86 -38 -123q0 -55 57 -55q51 0 101 72 t50 126q0 56 -40 84t-39 61q0 31 19 53t52 22q32 0 54 -36t22 -87q0 -147 -73 -251t-171 -104q-57 0 -97 33t-40 88t44 149t44 120t-18 26q-43 0 -82 -129q-6 -18 -23 -18q-23 0 -22 20q0 12 8 35q57 158 145 158zM1448 442q-57 0 -94 42t-37 142t75 201q75 100 171 101 q51 0 70 -31t25 -31t12 29q7 29 30 29h49q23 0 23 -15q-1 -2 -5 -18l-104 -332q-6 -14 -6 -31q0 -27 22 -26q37 0 88 127q8 18 23 18q23 0 22 -20l-10 -37q-61 -145 -139 -146q-61 0 -76 58q-6 30 -11 30q-10 -1 -24 -22q-47 -68 -104 -68zM1573 866q-61 0 -109 -100 t-47 -181q0 -81 46 -81q47 0 101 112t54 182q0 68 -45 68z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E512[] =
+    "<symbol id=\"E512\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M154 672q0 128 97 202t249 74t221 -59q70 -59 70 -154q0 -137 -154 -217q-35 -18 -35 -28t25 -39q66 -72 65 -181q0 -135 -108 -213q-108 -77 -266 -77t-238 68t-80 173q0 168 182 242q37 15 37 27t-16 32q-49 59 -49 150zM319 41q81 0 130 44q49 45 49 105t-30 93 t-94 83t-74 52q-10 0 -26 -8q-115 -72 -114 -211q0 -66 39 -112t120 -46zM635 754q1 57 -31 95t-101 38t-112 -38q-43 -37 -43 -93t27 -90t100 -91q23 -16 37 -16t25 8q98 68 98 187zM901 461q39 0 63 -31t24 -79t-40 -134q-39 -86 -39 -123q0 -55 58 -55q51 0 101 72 t50 127q0 56 -40 84t-40 60t20 54t52 21q32 0 54 -36t22 -87q0 -146 -73 -250t-171 -104q-57 0 -97 32t-40 88q0 54 44 148t44 120t-19 27q-43 0 -81 -129q-6 -18 -23 -18q-23 0 -22 20q0 12 8 35q57 158 145 158zM1569 -18q-61 0 -76 57q-6 31 -13 31t-22 -23 q-47 -67 -104 -67t-94 42t-37 142t74 201q75 100 171 100q50 0 70 -31t26 -31t12 29q7 29 30 29h49q23 0 22 -15q0 -2 -4 -18l-104 -332q-6 -16 -6 -30q0 -27 22 -27q37 0 88 127q8 18 23 18q23 0 22 -20l-10 -37q-61 -145 -139 -145zM1479 403q-61 0 -109 -100t-47 -181 q0 -81 46 -81t100 113q55 113 55 181t-45 68z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E513[] =
+    "<symbol id=\"E513\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M154 672q0 128 97 202t249 74t221 -59q70 -59 70 -154q0 -137 -154 -217q-35 -18 -35 -28t25 -39q66 -72 65 -181q0 -135 -108 -213q-108 -77 -266 -77t-238 68t-80 173q0 168 182 242q37 15 37 27t-16 32q-49 59 -49 150zM319 41q81 0 130 44q49 45 49 105t-30 93 t-94 83t-74 52q-10 0 -26 -8q-115 -72 -114 -211q0 -66 39 -112t120 -46zM635 754q1 57 -31 95t-101 38t-112 -38q-43 -37 -43 -93t27 -90t100 -91q23 -16 37 -16t25 8q98 68 98 187zM1092 672q0 -6 -5 -19l-51 -170q-4 -16 -11 -37q-7 -20 -7 -26t5 -6t21 11t37 24 q29 12 72 12t75 -40t32 -97q0 -140 -79 -242t-188 -102q-63 0 -102 40t-39 98t14 107l103 375q4 16 4 21q0 12 -27 12h-39q-31 0 -30 22q-1 25 32 27l158 10q25 0 25 -20zM1110 408q-62 0 -114 -108t-52 -206q0 -63 47 -63q66 1 116 115t50 188t-47 74zM1642 -18 q-61 0 -75 57q-6 31 -13 31t-22 -23q-46 -67 -104 -67t-95 42t-37 142t75 200t171 101q50 0 70 -31t25 -31t13 29t29 29h50q23 0 22 -15q0 -2 -4 -18l-105 -332q-6 -16 -6 -30q0 -27 23 -27q37 0 88 127q8 18 22 18q23 0 23 -20l-10 -37q-61 -145 -140 -145zM1552 403 q-61 0 -108 -100t-47 -181t46 -81t100 113t54 181t-45 68z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E514[] =
+    "<symbol id=\"E514\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M805 580q0 -16 18 -17q4 0 39 10t101 11q266 0 266 -207q0 -176 -115 -287t-291 -110q-127 0 -193 56t-67 128q0 72 35 116q35 42 83 42t76 -24t27 -69q0 -80 -63 -108q-33 -17 -33 -33t26 -30t64 -13q114 0 180 109t66 219q0 129 -117 129q-76 0 -151 -76 q-27 -27 -49 -27q-39 0 -39 39q0 16 10 47l139 408q14 43 55 43q18 0 78 -16t164 -17t194 32q23 9 33 9q25 0 25 -24t-35 -56q-154 -141 -340 -141l-117 10q-18 0 -26 -22l-39 -115q-4 -12 -4 -16zM623 915q0 -10 -7 -28l-243 -774l-6 -23q0 -10 14 -12l86 -8q35 -4 35 -37 t-39 -33h-424q-39 0 -39 33t35 37l88 8q23 2 31 26l172 539q6 17 6 31t-14 14t-33 -22l-92 -103q-40 -47 -72 -17q-32 29 6 70l268 304q19 20 37 20t41 -11t39 -11l86 22q25 0 25 -25z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E515[] =
+    "<symbol id=\"E515\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M502 33q0 -33 -39 -33h-424q-39 0 -39 33t35 37l88 8q23 2 31 26l172 539q6 17 6 31t-14 14t-33 -22l-92 -103q-40 -47 -74 -15q-12 11 -12 28t20 40l268 304q19 20 37 20t41 -11t39 -11l86 22q25 0 25 -25q0 -10 -7 -28l-243 -774l-6 -23q0 -10 14 -12l86 -8 q35 -4 35 -37zM805 580q0 -16 18 -17q4 0 39 10t101 11q266 0 266 -207q0 -176 -115 -287t-291 -110q-127 0 -193 56t-67 128q0 72 35 116q35 42 83 42t76 -24t27 -69q0 -80 -63 -108q-33 -17 -33 -33t26 -30t64 -13q114 0 180 109t66 219q0 129 -117 129q-76 0 -151 -76 q-27 -27 -49 -27q-39 0 -39 39q0 16 10 47l139 408q14 43 55 43q18 0 78 -16t164 -17t194 32q23 9 33 9q25 0 25 -24t-35 -56q-154 -141 -340 -141l-117 10q-18 0 -26 -22l-39 -115q-4 -12 -4 -16zM1863 838q5 0 45 44t92 46q52 0 75 -29t23 -78t-43 -159q-42 -110 -42 -138 q0 -27 23 -26q33 0 67 86q7 20 25 20t18 -18q0 -12 -6 -27q-45 -117 -138 -117t-93 80q0 42 40 146t40 137t-29 33q-37 0 -72 -45t-57 -111l-70 -209q-6 -18 -24 -18h-62q-18 0 -18 9t2 15l92 281q8 25 8 43q0 35 -35 35q-36 0 -70 -45t-57 -111l-69 -209q-6 -18 -25 -18 h-61q-18 0 -19 10q0 8 2 14l97 293q12 43 12 57q0 25 -21 25q-49 0 -102 -129q-8 -18 -22 -18q-23 0 -23 20q0 12 10 37q72 162 170 162q63 0 76 -60q2 -8 2 -18t5 -10t36 34q47 55 109 56q80 0 84 -80q0 -10 5 -10zM2328 442q-58 0 -94 42q-37 42 -36 124q0 119 74 219 q75 100 171 101q51 0 71 -31t24 -31t12 29t30 29h50q23 0 22 -15q0 -2 -4 -18l-104 -332q-6 -14 -6 -36t22 -21q37 0 88 127q8 18 23 18q23 0 22 -20l-10 -37q-61 -145 -139 -146q-61 0 -76 58q-6 30 -11 30q-10 -1 -24 -22q-47 -68 -105 -68zM2454 866q-60 0 -108 -100 t-48 -181t46 -81t100 112t54 182q0 68 -44 68z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E516[] =
+    "<symbol id=\"E516\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M502 33q0 -33 -39 -33h-424q-39 0 -39 33t35 37l88 8q23 2 31 26l172 539q6 17 6 31t-14 14t-33 -22l-92 -103q-40 -47 -74 -15q-12 11 -12 28t20 40l268 304q19 20 37 20t41 -11t39 -11l86 22q25 0 25 -25q0 -10 -7 -28l-243 -774l-6 -23q0 -10 14 -12l86 -8 q35 -4 35 -37zM805 580q0 -16 18 -17q4 0 39 10t101 11q266 0 266 -207q0 -176 -115 -287t-291 -110q-127 0 -193 56t-67 128q0 72 35 116q35 42 83 42t76 -24t27 -69q0 -80 -63 -108q-33 -17 -33 -33t26 -30t64 -13q114 0 180 109t66 219q0 129 -117 129q-76 0 -151 -76 q-27 -27 -49 -27q-39 0 -39 39q0 16 10 47l139 408q14 43 55 43q18 0 78 -16t164 -17t194 32q23 9 33 9q25 0 25 -24t-35 -56q-154 -141 -340 -141l-117 10q-18 0 -26 -22l-39 -115q-4 -12 -4 -16zM1940 475q96 -1 96 -107q0 -48 -42 -159t-42 -137t22 -27q33 0 68 86 q8 20 22 21q31 0 15 -46q-45 -116 -138 -116t-94 80q0 43 40 146t40 136t-29 33q-38 0 -72 -45t-57 -111l-69 -209q-6 -18 -25 -18h-61q-18 0 -19 10q0 8 2 15l93 280q8 25 8 43q0 35 -35 35t-70 -45t-57 -111l-70 -209q-6 -18 -24 -18h-62q-18 0 -18 10t2 15l96 292 q12 43 13 58q0 25 -21 24q-49 0 -102 -129q-8 -18 -23 -18q-23 0 -22 20q0 12 10 37q72 162 170 162q55 0 71 -45q7 -21 7 -32t5 -11t36 35q47 55 107 55t79 -47q6 -18 6 -30t5 -13q5 0 46 45t93 45zM2476 76q0 -27 23 -27q37 0 88 127q9 18 27 18t18 -20q0 -6 -5 -19 t-6 -18q-61 -145 -139 -145q-61 0 -76 57q-6 31 -12 31t-22 -23q-46 -67 -104 -67t-95 42t-37 142t75 201q75 100 171 100q50 0 70 -31q20 -30 25 -30t12 28t30 29h49q23 0 23 -14q0 -3 -4 -19l-105 -332q-6 -16 -6 -30zM2392 414q-61 0 -108 -100q-48 -100 -48 -182 q0 -81 46 -81t101 113q54 114 54 182t-45 68z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E517[] =
+    "<symbol id=\"E517\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M178 666q0 114 94 198t237 84q144 0 225 -58t81 -159q0 -276 -379 -362q-164 -39 -239 -123q-34 -43 -13 -43q8 0 49 16q88 35 206 -7q69 -24 106 -24q66 0 106 58q18 26 47 26t29 -28q0 -12 -8 -37q-39 -115 -90 -168t-145 -53t-189 54q-96 54 -136 54q-39 0 -59 -51 t-53 -51q-39 0 -39 39q0 10 6 39q35 131 114 222t230 152q254 102 254 324q0 109 -133 109q-59 0 -96 -22t-37 -44t29 -51t29 -78t-34 -88t-87 -39t-79 32t-26 79zM899 666q-1 114 93 198t238 84t225 -58t81 -159q0 -276 -379 -362q-164 -39 -239 -123q-34 -43 -13 -43 q8 0 49 16q88 35 206 -7q69 -24 106 -24q66 0 106 58q18 26 47 26t29 -28q0 -12 -8 -37q-39 -115 -90 -168q-50 -53 -144 -53t-190 54t-136 54t-60 -51t-52 -51q-39 0 -39 39q0 10 6 39q35 131 114 222t230 152q254 102 254 324q0 109 -133 109q-59 0 -96 -22t-37 -44 t29 -51q28 -29 28 -78t-34 -88t-86 -39q-53 0 -79 32t-26 79z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E518[] =
+    "<symbol id=\"E518\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M178 666q0 114 94 198t237 84q144 0 225 -58t81 -159q0 -276 -379 -362q-164 -39 -239 -123q-34 -43 -13 -43q8 0 49 16q88 35 206 -7q69 -24 106 -24q66 0 106 58q18 26 47 26t29 -28q0 -12 -8 -37q-39 -115 -90 -168t-145 -53t-189 54q-96 54 -136 54q-39 0 -59 -51 t-53 -51q-39 0 -39 39q0 10 6 39q35 131 114 222t230 152q254 102 254 324q0 109 -133 109q-59 0 -96 -22t-37 -44t29 -51t29 -78t-34 -88t-87 -39t-79 32t-26 79zM899 666q-1 114 93 198t238 84t225 -58t81 -159q0 -276 -379 -362q-164 -39 -239 -123q-34 -43 -13 -43 q8 0 49 16q88 35 206 -7q69 -24 106 -24q66 0 106 58q18 26 47 26t29 -28q0 -12 -8 -37q-39 -115 -90 -168q-50 -53 -144 -53t-190 54t-136 54t-60 -51t-52 -51q-39 0 -39 39q0 10 6 39q35 131 114 222t230 152q254 102 254 324q0 109 -133 109q-59 0 -96 -22t-37 -44 t29 -51q28 -29 28 -78t-34 -88t-86 -39q-53 0 -79 32t-26 79zM2089 850q0 -12 5 -12t46 44t92 46q51 0 74 -29t23 -78t-42 -159t-42 -138q0 -27 22 -26q33 0 68 86q8 20 22 20q20 0 21 -18q0 -12 -6 -27q-44 -117 -138 -117t-94 80q0 42 40 146t40 137t-29 33q-37 0 -71 -45 t-58 -111l-69 -209q-6 -18 -25 -18h-61q-18 0 -19 10q0 8 2 14l92 281q8 25 9 43q0 35 -35 35t-70 -45t-57 -111l-70 -209q-6 -18 -24 -18h-62q-18 0 -18 9t2 15l96 293q12 43 12 57q0 25 -20 25q-49 0 -103 -129q-8 -18 -22 -18q-23 0 -23 20q0 12 11 37q72 162 170 162 q62 0 75 -60q2 -8 2 -18q-1 -10 5 -10t36 34q48 56 108 56t79 -47q6 -19 6 -31zM2560 442q-57 0 -94 42t-37 142t76 201q76 100 170 101q51 0 70 -31t25 -31t12 29q7 29 30 29h49q23 0 23 -15q-1 -2 -5 -18l-104 -332q-6 -14 -6 -31q0 -27 22 -26q37 0 88 127q8 18 23 18 q23 0 23 -20l-11 -37q-61 -145 -139 -146q-61 0 -76 58q-6 30 -11 30q-6 -1 -24 -22q-47 -68 -104 -68zM2685 866q-61 0 -109 -100t-47 -181q0 -81 46 -81q47 0 101 112t54 182q0 68 -45 68z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E519[] =
+    "<symbol id=\"E519\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M178 666q0 114 94 198t237 84q144 0 225 -58t81 -159q0 -276 -379 -362q-164 -39 -239 -123q-34 -43 -13 -43q8 0 49 16q88 35 206 -7q69 -24 106 -24q66 0 106 58q18 26 47 26t29 -28q0 -12 -8 -37q-39 -115 -90 -168t-145 -53t-189 54q-96 54 -136 54q-39 0 -59 -51 t-53 -51q-39 0 -39 39q0 10 6 39q35 131 114 222t230 152q254 102 254 324q0 109 -133 109q-59 0 -96 -22t-37 -44t29 -51t29 -78t-34 -88t-87 -39t-79 32t-26 79zM899 666q-1 114 93 198t238 84t225 -58t81 -159q0 -276 -379 -362q-164 -39 -239 -123q-34 -43 -13 -43 q8 0 49 16q88 35 206 -7q69 -24 106 -24q66 0 106 58q18 26 47 26t29 -28q0 -12 -8 -37q-39 -115 -90 -168q-50 -53 -144 -53t-190 54t-136 54t-60 -51t-52 -51q-39 0 -39 39q0 10 6 39q35 131 114 222t230 152q254 102 254 324q0 109 -133 109q-59 0 -96 -22t-37 -44 t29 -51q28 -29 28 -78t-34 -88t-86 -39q-53 0 -79 32t-26 79zM2130 473q98 -1 96 -107q0 -48 -42 -159t-42 -137t23 -27q33 0 67 86q8 20 23 21q20 0 20 -19q0 -12 -6 -27q-45 -116 -138 -116t-93 80q0 43 40 146t40 136t-29 33q-37 0 -72 -45t-57 -111l-70 -209 q-6 -18 -24 -18h-62q-18 0 -18 9t2 16l92 280q8 25 8 43q0 35 -35 35t-69 -45t-58 -111l-69 -209q-6 -18 -25 -18h-61q-18 0 -19 10q0 9 2 15l97 292q12 43 12 58q0 25 -21 24q-49 0 -102 -129q-8 -18 -22 -18q-23 0 -23 20q0 12 10 37q72 162 170 162q61 0 76 -59 q2 -8 2 -18t5 -11q5 0 36 35q48 55 108 55t78 -47q7 -21 7 -32t5 -11t46 45t92 45zM2673 -10q-61 0 -76 57q-6 31 -13 31t-22 -23q-46 -67 -104 -67t-95 42t-36 124q0 119 75 219q76 100 170 100q50 0 70 -31q20 -30 25 -30t13 28t30 29h49q23 0 22 -14q0 -3 -4 -19 l-104 -332q-6 -14 -7 -30q0 -27 23 -27q37 0 88 127q8 18 23 19q23 0 22 -21l-10 -37q-61 -145 -139 -145zM2583 412q-61 0 -109 -100t-47 -182q0 -81 46 -81t100 113q55 114 55 182t-45 68z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E520[] =
+    "<symbol id=\"E520\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M506 485q-35 -1 -72 -37t-59 -92l-41 -100q-39 -98 -39 -141q0 -66 51 -66q68 0 138 137t69 218q0 81 -47 81zM252 35q-6 0 -16 -25l-93 -229q-4 -12 -4 -16t19 -5h82q25 0 24 -24q0 -27 -26 -27h-396q-25 0 -24 25q0 27 26 26h64q23 0 31 21l251 625q32 77 -10 75 q-47 0 -137 -155q-16 -31 -33 -31q-23 0 -22 22q0 11 34 75q90 166 230 167q94 0 109 -71q7 -30 20 -17q4 4 13 15q61 75 158 75t147 -47t51 -135q0 -150 -106 -275t-251 -124q-80 0 -114 34l-16 16q-5 5 -11 5z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E521[] =
+    "<symbol id=\"E521\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M740 561q122 -1 122 -119q0 -52 -59 -188t-59 -160t16 -24q35 0 104 110q16 27 32 27t17 -19q0 -12 -18 -43q-100 -166 -215 -165q-92 0 -92 81q0 45 63 189t63 177q0 32 -30 32q-70 0 -113 -103l-133 -331q-10 -25 -32 -25h-101q-23 0 -22 12q0 8 6 23l129 319 q20 47 20 76t-30 29q-70 0 -113 -103l-133 -331q-10 -25 -33 -25h-100q-23 0 -23 10t6 25l150 371q12 28 12 52t-22 23q-45 0 -140 -159q-16 -27 -30 -27q-23 0 -23 22q1 11 35 75t88 116t124 51q71 0 89 -62q2 -7 2 -17t5 -11q5 0 34 29q59 63 133 63t96 -49q8 -12 8 -28 q-1 -16 5 -15q6 0 34 29q60 63 128 63z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E522[] =
+    "<symbol id=\"E522\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-183 -61q93 1 93 -89q0 -58 -62 -81l-24 -9q-4 -2 -4 -8q0 -18 48 -18t84 56t81 210l129 449l4 20q0 8 -16 8h-119q-31 0 -31 32t33 32h119q24 0 28 4t13 26q117 338 376 338q176 0 176 -137q-1 -53 -29 -82q-28 -28 -70 -28q-93 1 -93 94q0 55 55 73q6 3 9 5t7 3t5 9 q0 16 -33 16q-72 0 -114 -70t-74 -217l-5 -19v-5q0 -10 21 -10h123q31 0 31 -32t-33 -32h-133q-6 0 -16 -9t-11 -13v-2q-2 -2 -2 -4q-72 -252 -157 -428t-167 -254t-194 -78q-68 0 -111 36t-43 92t31 89t75 33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E523[] =
+    "<symbol id=\"E523\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-41 317q-1 11 33 75t88 116t128 51q73 1 90 -75q1 -4 1 -10q0 -5 5 -5t17 13q61 79 140 79q53 0 80 -31q27 -30 27 -80t-24 -80t-60 -30q-76 0 -76 66q0 34 22 56t23 25q0 13 -27 13t-69 -45t-62 -99l-133 -331q-10 -25 -33 -25h-100q-23 0 -23 10t6 25l150 371 q12 28 12 52t-22 23q-47 0 -140 -159q-12 -27 -32 -27t-21 22z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E524[] =
+    "<symbol id=\"E524\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M96 404q0 66 56 110q56 45 142 45q85 0 130 -33t45 -77q0 -91 -76 -91q-31 0 -51 18t-20 49q0 32 13 42t29 18q3 2 3 7q-1 22 -55 22q-98 -1 -97 -68q0 -28 19 -50t79 -66q101 -74 101 -161t-67 -138t-157 -51t-140 38t-50 86t24 76t58 27t54 -19q22 -18 22 -57t-44 -58 q-8 -3 -14 -4t-6 -12q0 -10 25 -19t67 -9q42 -1 70 27q29 28 29 74q-1 46 -69 93t-94 81t-26 100z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E525[] =
+    "<symbol id=\"E525\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M281 165q0 30 19 50q19 21 49 21q29 0 51 -23t22 -79t-43 -106q-43 -48 -111 -48t-130 32q-60 32 -83 31t-51 -23t-39 -22q-27 0 -26 25q0 16 24 40l316 320q47 47 41 47t-32 -7q-28 -7 -70 -7t-60 3t-21 3q-10 0 -22 -25l-21 -43q-14 -31 -31 -30q-23 0 -22 20 q0 12 6 31l49 143q8 27 37 27l68 -8q148 -22 208 -5t64 17q27 -1 27 -21t-27 -47l-328 -323l-24 -35q28 12 58 12t74 -36t73 -36q29 -1 39 19t10 25t-6 6l-33 -11q-23 0 -39 16t-16 47z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E526[] =
+    "<symbol id=\"E526\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M458 561q122 -1 122 -119q0 -52 -60 -188t-59 -160q0 -24 16 -24q35 0 105 110q16 27 32 27q36 0 -2 -62q-100 -166 -215 -165q-92 0 -92 81q-1 45 63 189t64 177q0 32 -31 32q-70 0 -112 -103l-133 -331q-10 -25 -33 -25h-100q-23 0 -23 10t6 25l150 371q12 28 12 52 t-23 23q-45 0 -139 -159q-16 -27 -31 -27q-23 0 -22 22q1 11 35 75t88 116t118 51q66 0 89 -47q8 -16 8 -30t5 -13q5 0 34 29q60 63 128 63z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E527[] =
+    "<symbol id=\"E527\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M4114 485q-36 -1 -72 -37t-59 -92l-41 -100q-39 -98 -39 -141q0 -66 52 -66q67 0 137 137t70 218t-48 81zM3387 485q-35 -1 -71 -37t-60 -92l-41 -100q-39 -98 -39 -141q0 -66 52 -66q68 0 138 137t68 218q0 81 -47 81zM2660 485q-36 -1 -72 -37t-59 -92l-41 -100 q-39 -98 -39 -141q0 -66 52 -66q67 0 137 137t70 218t-48 81zM1933 485q-35 -1 -71 -37t-60 -92l-41 -100q-39 -98 -39 -141q0 -66 52 -66q68 0 138 137t68 218q0 81 -47 81zM1206 485q-36 -1 -72 -37t-59 -92l-41 -100q-39 -98 -39 -141q0 -66 52 -66q67 0 137 137t70 218 t-48 81zM479 485q-35 -1 -71 -37t-60 -92l-41 -100q-39 -98 -39 -141q0 -66 51 -66q68 0 138 137q69 137 69 218t-47 81zM4358 379q0 -150 -106 -275t-250 -124q-88 0 -130 50q-5 5 -11 5t-17 -25l-92 -229q-4 -12 -4 -16t18 -5h82q25 0 25 -26t-27 -25h-395q-25 0 -25 26 t27 25h63q23 0 31 21l252 625q12 28 12 52t-30 23t-78 -73q-18 -25 -33 -25q-23 0 -23 20q0 14 17 39q82 117 186 117t120 -71q5 -21 11 -21t22 19q61 75 158 75t147 -47t50 -135zM3631 379q0 -150 -106 -275t-250 -124q-88 0 -130 50q-5 5 -11 5t-17 -25l-92 -229 q-4 -12 -4 -16t18 -5h82q25 0 25 -26t-27 -25h-395q-25 0 -25 26t27 25h63q23 0 31 21l252 625q12 28 12 52t-30 23t-78 -73q-18 -25 -33 -25q-23 0 -23 20q0 14 17 39q82 117 186 117t120 -71q7 -29 19 -17q4 4 14 15q61 75 158 75t147 -47t50 -135zM2904 379 q0 -150 -106 -275t-250 -124q-88 0 -130 50q-6 5 -12 5t-16 -25l-92 -229q-4 -12 -4 -16t18 -5h82q25 0 25 -26t-27 -25h-395q-25 0 -25 26t27 25h63q23 0 31 21l252 625q12 28 12 52t-30 23t-78 -73q-18 -25 -33 -25q-23 0 -23 20q0 14 17 39q82 117 186 117t120 -71 q7 -29 19 -17q4 4 14 15q61 75 158 75t147 -47t50 -135zM2177 379q0 -150 -106 -275t-250 -124q-88 0 -130 50q-5 5 -11 5t-17 -25l-92 -229q-4 -12 -4 -16t18 -5h82q25 0 25 -26t-27 -25h-395q-25 0 -25 26t27 25h63q23 0 31 21l252 625q12 28 12 52t-30 23t-78 -73 q-18 -25 -33 -25q-23 0 -23 20q0 14 17 39q82 117 186 117t120 -71q7 -29 19 -17q4 4 14 15q61 75 158 75t147 -47t50 -135zM1450 379q0 -150 -106 -275t-250 -124q-88 0 -130 50q-6 5 -12 5t-16 -25l-92 -229q-4 -12 -4 -16t18 -5h82q25 0 25 -26t-27 -25h-395 q-25 0 -"
+    "25 26t27 25h63q23 0 31 21l252 625q12 28 12 52t-30 23t-78 -73q-18 -25 -33 -25q-23 0 -23 20q0 14 17 39q82 117 186 117t120 -71q7 -29 19 -17q4 4 14 15q61 75 158 75t147 -47t50 -135zM526 561q97 0 147 -47t50 -135q-1 -150 -107 -275t-249 -124 q-88 0 -130 50q-5 5 -11 5t-17 -25l-92 -229q-4 -12 -4 -16t18 -5h82q25 0 25 -26t-27 -25h-395q-25 0 -25 26t27 25h63q23 0 31 21l252 625q12 28 12 52t-22 23q-47 0 -138 -155q-16 -31 -32 -31q-23 0 -23 22q1 11 35 75q90 166 229 167q95 0 110 -71q7 -29 19 -17 q4 4 14 15q61 75 158 75z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E528[] =
+    "<symbol id=\"E528\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M3387 485q-35 -1 -71 -37t-60 -92l-41 -100q-39 -98 -39 -141q0 -66 52 -66q68 0 138 137t68 218q0 81 -47 81zM2660 485q-36 -1 -72 -37t-59 -92l-41 -100q-39 -98 -39 -141q0 -66 52 -66q67 0 137 137t70 218t-48 81zM1933 485q-35 -1 -71 -37t-60 -92l-41 -100 q-39 -98 -39 -141q0 -66 52 -66q68 0 138 137t68 218q0 81 -47 81zM1206 485q-36 -1 -72 -37t-59 -92l-41 -100q-39 -98 -39 -141q0 -66 52 -66q67 0 137 137t70 218t-48 81zM479 485q-35 -1 -71 -37t-60 -92l-41 -100q-39 -98 -39 -141q0 -66 51 -66q68 0 138 137 q69 137 69 218t-47 81zM3631 379q0 -150 -106 -275t-250 -124q-88 0 -130 50q-5 5 -11 5t-17 -25l-92 -229q-4 -12 -4 -16t18 -5h82q25 0 25 -26t-27 -25h-395q-25 0 -25 26t27 25h63q23 0 31 21l252 625q12 28 12 52t-30 23t-78 -73q-18 -25 -33 -25q-23 0 -23 20 q0 14 17 39q82 117 186 117t120 -71q7 -29 19 -17q4 4 14 15q61 75 158 75t147 -47t50 -135zM2904 379q0 -150 -106 -275t-250 -124q-88 0 -130 50q-6 5 -12 5t-16 -25l-92 -229q-4 -12 -4 -16t18 -5h82q25 0 25 -26t-27 -25h-395q-25 0 -25 26t27 25h63q23 0 31 21l252 625 q12 28 12 52t-30 23t-78 -73q-18 -25 -33 -25q-23 0 -23 20q0 14 17 39q82 117 186 117t120 -71q7 -29 19 -17q4 4 14 15q61 75 158 75t147 -47t50 -135zM2177 379q0 -150 -106 -275t-250 -124q-88 0 -130 50q-5 5 -11 5t-17 -25l-92 -229q-4 -12 -4 -16t18 -5h82 q25 0 25 -26t-27 -25h-395q-25 0 -25 26t27 25h63q23 0 31 21l252 625q12 28 12 52t-30 23t-78 -73q-18 -25 -33 -25q-23 0 -23 20q0 14 17 39q82 117 186 117t120 -71q7 -29 19 -17q4 4 14 15q61 75 158 75t147 -47t50 -135zM1450 379q0 -150 -106 -275t-250 -124 q-88 0 -130 50q-6 5 -12 5t-16 -25l-92 -229q-4 -12 -4 -16t18 -5h82q25 0 25 -26t-27 -25h-395q-25 0 -25 26t27 25h63q23 0 31 21l252 625q12 28 12 52t-30 23t-78 -73q-18 -25 -33 -25q-23 0 -23 20q0 14 17 39q82 117 186 117t120 -71q7 -29 19 -17q4 4 14 15 q61 75 158 75t147 -47t50 -135zM526 561q97 0 147 -47t50 -135q-1 -150 -107 -275t-249 -124q-88 0 -130 50q-5 5 -11 5t-17 -25l-92 -229q-4 -12 -4 -16t18 -5h82q25 0 25 -26t-27 -25h-395q-25 0 -25 26t27 25h63q23 0 31 21l252 625q12 28 12 52t-22 23q-47 0 -138 -155 q-16 -"
+    "31 -32 -31q-23 0 -23 22q1 11 35 75q90 166 229 167q95 0 110 -71q7 -29 19 -17q4 4 14 15q61 75 158 75z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E529[] =
+    "<symbol id=\"E529\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M2660 485q-36 -1 -72 -37t-59 -92l-41 -100q-39 -98 -39 -141q0 -66 52 -66q67 0 137 137t70 218t-48 81zM1933 485q-35 -1 -71 -37t-60 -92l-41 -100q-39 -98 -39 -141q0 -66 52 -66q68 0 138 137t68 218q0 81 -47 81zM1206 485q-36 -1 -72 -37t-59 -92l-41 -100 q-39 -98 -39 -141q0 -66 52 -66q67 0 137 137t70 218t-48 81zM479 485q-35 -1 -71 -37t-60 -92l-41 -100q-39 -98 -39 -141q0 -66 51 -66q68 0 138 137q69 137 69 218t-47 81zM2904 379q0 -150 -106 -275t-250 -124q-88 0 -130 50q-6 5 -12 5t-16 -25l-92 -229 q-4 -12 -4 -16t18 -5h82q25 0 25 -26t-27 -25h-395q-25 0 -25 26t27 25h63q23 0 31 21l252 625q12 28 12 52t-30 23t-78 -73q-18 -25 -33 -25q-23 0 -23 20q0 14 17 39q82 117 186 117t120 -71q7 -29 19 -17q4 4 14 15q61 75 158 75t147 -47t50 -135zM2177 379 q0 -150 -106 -275t-250 -124q-88 0 -130 50q-5 5 -11 5t-17 -25l-92 -229q-4 -12 -4 -16t18 -5h82q25 0 25 -26t-27 -25h-395q-25 0 -25 26t27 25h63q23 0 31 21l252 625q12 28 12 52t-30 23t-78 -73q-18 -25 -33 -25q-23 0 -23 20q0 14 17 39q82 117 186 117t120 -71 q7 -29 19 -17q4 4 14 15q61 75 158 75t147 -47t50 -135zM1450 379q0 -150 -106 -275t-250 -124q-88 0 -130 50q-6 5 -12 5t-16 -25l-92 -229q-4 -12 -4 -16t18 -5h82q25 0 25 -26t-27 -25h-395q-25 0 -25 26t27 25h63q23 0 31 21l252 625q12 28 12 52t-30 23t-78 -73 q-18 -25 -33 -25q-23 0 -23 20q0 14 17 39q82 117 186 117t120 -71q7 -29 19 -17q4 4 14 15q61 75 158 75t147 -47t50 -135zM526 561q97 0 147 -47t50 -135q-1 -150 -107 -275t-249 -124q-88 0 -130 50q-5 5 -11 5t-17 -25l-92 -229q-4 -12 -4 -16t18 -5h82q25 0 25 -26 t-27 -25h-395q-25 0 -25 26t27 25h63q23 0 31 21l252 625q12 28 12 52t-22 23q-47 0 -138 -155q-16 -31 -32 -31q-23 0 -23 22q1 11 35 75q90 166 229 167q95 0 110 -71q7 -29 19 -17q4 4 14 15q61 75 158 75z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E52A[] =
+    "<symbol id=\"E52A\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1954 485q-35 -1 -72 -37t-59 -92l-41 -100q-39 -98 -39 -141q0 -66 51 -66q68 0 138 137t69 218q0 81 -47 81zM1227 485q-35 -1 -72 -37t-59 -92l-41 -100q-39 -98 -39 -141q0 -66 51 -66q67 0 137 137t70 218t-47 81zM500 485q-35 -1 -72 -37t-59 -92l-41 -100 q-39 -98 -39 -141q0 -66 51 -66q68 0 138 137t69 218q0 81 -47 81zM1700 35q-6 0 -17 -25l-92 -229q-4 -12 -4 -16t19 -5h82q25 0 24 -24q0 -27 -26 -27h-396q-25 0 -24 25q0 27 26 26h64q23 0 30 21l252 625q32 77 -10 75q-37 0 -86 -73q-18 -25 -33 -25q-23 0 -22 20 q0 14 16 39q82 117 186 117t120 -71q7 -30 20 -17q4 4 13 15q61 75 158 75t147 -47t51 -135q0 -150 -106 -275t-251 -124q-88 0 -130 50q-5 5 -11 5zM1470 379q0 -150 -106 -275t-250 -124q-88 0 -130 50q-5 5 -11 5t-17 -25l-92 -229q-4 -12 -4 -16t19 -5h82q25 0 24 -24 q0 -27 -27 -27h-395q-25 0 -24 25q0 27 26 26h64q23 0 30 21l252 625q32 77 -10 75q-37 0 -86 -73q-18 -25 -33 -25q-23 0 -22 20q0 14 16 39q82 117 186 117t120 -71q7 -30 20 -17q4 4 13 15q61 75 158 75t147 -47t50 -135zM546 561q97 0 147 -47t50 -135q0 -150 -106 -275 t-250 -124q-88 0 -130 50q-5 5 -11 5t-17 -25l-92 -229q-4 -12 -4 -16t19 -5h81q25 0 25 -26t-27 -25h-395q-25 0 -24 25q0 27 26 26h64q23 0 30 21l252 625q32 77 -10 75q-47 0 -137 -155q-16 -31 -33 -31q-23 0 -22 22q0 11 34 75q90 166 230 167q94 0 109 -71 q7 -30 20 -17q4 4 13 15q61 75 158 75z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E52B[] =
+    "<symbol id=\"E52B\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1247 485q-35 -1 -71 -37t-60 -92l-41 -100q-39 -98 -39 -141q0 -66 51 -66q68 0 138 137q69 137 69 218t-47 81zM520 485q-36 -1 -72 -37t-59 -92l-41 -100q-39 -98 -39 -141q0 -66 51 -66q68 0 138 137t70 218t-48 81zM1491 379q-1 -150 -107 -275t-249 -124 q-88 0 -130 50q-5 5 -11 5t-17 -25l-92 -229q-4 -12 -4 -16t18 -5h82q25 0 25 -26t-27 -25h-395q-25 0 -25 26t27 25h63q23 0 31 21l252 625q12 28 12 52t-30 23t-78 -73q-18 -25 -33 -25q-23 0 -23 20q0 14 17 39q82 117 186 117t120 -71q7 -29 19 -17q4 4 14 15 q61 75 158 75t147 -47t50 -135zM567 561q97 0 147 -47t50 -135q0 -150 -106 -275t-250 -124q-88 0 -130 50q-6 5 -12 5t-16 -25l-92 -229q-4 -12 -4 -16t18 -5h82q25 0 25 -26t-27 -25h-395q-25 0 -25 26t27 25h63q23 0 31 21l252 625q12 28 12 52t-22 23q-47 0 -138 -155 q-16 -31 -32 -31q-23 0 -23 22q0 11 34 75q90 166 230 167q95 0 110 -71q7 -29 19 -17q4 4 14 15q62 75 158 75z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E52C[] =
+    "<symbol id=\"E52C\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1286 49q68 0 138 137q70 136 69 218q0 82 -47 81q-35 -1 -72 -37t-59 -92l-41 -100q-39 -98 -39 -141q0 -66 51 -66zM740 561q124 -1 122 -119q0 -52 -59 -188t-59 -160t16 -24q57 -1 149 200l15 33q84 191 170 235q43 22 115 21t93 -71q7 -29 19 -17q4 4 13 15 q61 75 158 75t147 -47t51 -135q0 -150 -106 -275t-251 -124q-80 0 -114 34l-16 16q-5 5 -11 5t-16 -25l-93 -229q-4 -12 -4 -16t19 -5h82q25 0 24 -24q0 -27 -26 -27h-396q-25 0 -24 25q0 27 26 26h64q23 0 31 21l251 625q32 77 -8 75q-61 -1 -171 -251t-271 -250 q-92 0 -92 81q0 45 63 189t63 177q0 32 -30 32q-70 0 -113 -103l-133 -331q-10 -25 -32 -25h-101q-23 0 -22 12q0 8 6 23l129 319q20 47 20 76t-30 29q-70 0 -113 -103l-133 -331q-10 -25 -33 -25h-100q-23 0 -23 10t6 25l150 371q12 28 12 52t-22 23q-45 0 -140 -159 q-16 -27 -30 -27q-23 0 -23 22q1 11 35 75t88 116t124 51q71 0 89 -62q2 -7 2 -17t5 -11q5 0 34 29q59 63 133 63t96 -49q8 -12 8 -28q-1 -16 5 -15q6 0 34 29q59 63 128 63z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E52D[] =
+    "<symbol id=\"E52D\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M747 -88q93 0 93 -90q0 -58 -62 -80q-10 -4 -19 -6t-9 -10q0 -18 48 -18t84 55q36 56 81 210l129 449l4 20q0 8 -17 9h-118q-31 -1 -31 31t33 32h118q23 0 28 4t13 27q117 338 377 338q176 0 176 -138q-1 -53 -29 -81t-70 -29q-42 1 -68 23t-25 74t55 71q6 2 9 4q3 1 7 3 t5 9q0 16 -33 17q-72 0 -117 -74q-45 -75 -76 -233v-5q0 -10 21 -10h123q31 0 30 -31q0 -33 -32 -32h-134q-6 1 -16 -9t-10 -14v-2l-2 -4q-72 -252 -157 -428t-167 -254t-194 -78q-68 0 -111 36t-43 92t31 89t75 33zM740 561q122 -1 122 -119q0 -52 -59 -188t-59 -160 t16 -24q35 0 104 110q16 27 32 27t17 -19q0 -12 -18 -43q-100 -166 -215 -165q-92 0 -92 81q0 45 63 189t63 177q0 32 -30 32q-70 0 -113 -103l-133 -331q-10 -25 -32 -25h-101q-23 0 -22 12q0 8 6 23l129 319q20 47 20 76t-30 29q-70 0 -113 -103l-133 -331 q-10 -25 -33 -25h-100q-23 0 -23 10t6 25l150 371q12 28 12 52t-22 23q-45 0 -140 -159q-16 -27 -30 -27q-23 0 -23 22q1 11 35 75t88 116t124 51q71 0 89 -62q2 -7 2 -17t5 -11q5 0 34 29q59 63 133 63t96 -49q8 -12 8 -28q-1 -16 5 -15q6 0 34 29q60 63 128 63z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E52E[] =
+    "<symbol id=\"E52E\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M981 477h-119q-31 0 -31 32t33 32h119q23 0 28 4t13 26q117 338 377 338q176 0 176 -137q0 -53 -29 -82q-28 -28 -70 -28t-68 22t-26 76q0 53 56 69q6 3 9 5t7 3t4 9q0 16 -33 16q-72 0 -115 -72t-77 -234v-5q0 -10 20 -10h123q31 0 31 -32t-33 -32h-133q-6 0 -16 -9 t-10 -13v-2q-2 -2 -3 -4q-72 -252 -156 -428t-167 -254q-82 -78 -195 -78q-68 0 -110 36t-43 92q0 56 30 89q31 33 75 33t69 -23t24 -73t-61 -74l-25 -9q-4 -2 -4 -8q0 -18 48 -18t84 56t81 210l129 449l4 20q0 8 -16 8zM45 295q-23 0 -22 22q1 11 35 75q90 167 229 167 q94 0 109 -71q7 -30 20 -17q4 4 13 15q61 75 158 75t147 -47t50 -135q0 -150 -106 -275t-250 -124q-88 0 -130 50q-5 5 -11 5t-17 -25l-92 -229q-4 -12 -4 -16t19 -5h81q25 0 25 -26t-27 -25h-395q-25 0 -24 25q0 27 26 26h64q22 1 30 21l252 625q32 77 -10 75 q-47 0 -137 -155q-16 -31 -33 -31zM330 115q0 -66 51 -66q67 0 137 137q70 136 70 218t-47 81q-35 0 -72 -36q-36 -38 -59 -93l-41 -100q-39 -98 -39 -141z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E52F[] =
+    "<symbol id=\"E52F\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M571 862q-91 0 -137 -224q-18 -85 -18 -87q0 -10 20 -10h219q23 0 28 4t13 26q117 338 377 338q176 0 176 -137q-1 -53 -29 -82q-28 -28 -70 -28t-68 22t-25 75q1 52 55 70q6 3 9 5t7 4t5 8q0 16 -33 16q-72 0 -115 -72t-78 -234v-5q0 -10 21 -10h123q31 0 30 -31 q0 -33 -32 -33h-134q-6 0 -16 -9t-10 -13v-2q-2 -2 -2 -4q-72 -252 -157 -428t-167 -254t-194 -78q-66 -1 -107 33t-41 88t27 84q27 28 69 28q41 0 65 -22t24 -64q0 -43 -33 -64q-33 -22 -33 -30t20 -8q59 0 96 56q36 56 81 210l129 449l4 20q0 8 -17 8h-229q-6 0 -16 -9 t-11 -13v-2q-2 -2 -2 -4q-73 -252 -157 -428t-166 -254t-195 -78q-69 0 -111 36t-42 92t30 89q31 33 75 33t69 -23q24 -22 24 -66q-1 -61 -77 -87q-13 -3 -13 -11q0 -18 48 -18t84 56t81 210l129 449l4 20q0 8 -16 8h-119q-31 0 -31 32t33 32h119q24 0 28 4t13 26 q55 164 139 251t225 87q80 1 119 -33t39 -79q0 -104 -90 -105q-86 0 -86 84q0 32 18 54q19 22 19 27t-17 5z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E530[] =
+    "<symbol id=\"E530\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1022 862q-92 0 -139 -226q-17 -83 -17 -89t21 -6h219q23 0 28 4t13 26q117 338 377 338q176 0 176 -137q0 -53 -29 -82q-29 -28 -71 -28q-93 1 -93 94q0 57 56 73q6 3 9 5t7 3t4 9q0 16 -33 16q-72 0 -115 -72t-77 -234v-5q0 -10 20 -10h123q31 0 31 -32t-33 -32h-133 q-6 0 -16 -9t-11 -13v-2q-2 -2 -2 -4q-73 -252 -157 -428t-166 -254t-195 -78q-67 -1 -107 33t-40 88t26 84q27 28 69 28t66 -22q23 -22 23 -64q0 -43 -33 -64q-60 -38 -12 -38q59 0 95 56t81 210l129 449l4 20q0 8 -16 8h-230q-6 0 -16 -9t-10 -13v-2q-2 -2 -2 -4 q-72 -252 -157 -428t-167 -254t-194 -78q-66 -1 -107 33t-41 88t27 84q27 28 69 28t66 -22t23 -64q0 -43 -33 -64q-33 -22 -33 -30t20 -8q59 0 96 56q36 56 81 210l129 449l4 20q0 8 -17 8h-229q-6 0 -16 -9t-11 -13v-2q-2 -2 -2 -4q-72 -252 -156 -428t-167 -254 q-82 -78 -195 -78q-68 0 -110 36t-43 92q0 56 30 89q31 33 75 33t69 -23q25 -22 25 -66q-1 -61 -78 -87q-13 -3 -13 -11q0 -18 48 -18t84 56t81 210l129 449l4 20q0 8 -16 8h-119q-31 0 -31 32t33 32h119q23 0 28 4t13 26q55 164 139 251t225 87q80 1 119 -33t39 -79 q0 -104 -90 -105q-86 0 -86 84q0 32 18 54t18 27t-16 5q-55 0 -87 -70t-50 -154q-18 -85 -18 -87q0 -10 20 -10h219q23 0 28 4t13 26q55 164 139 251t226 87q80 1 119 -33t39 -79q0 -105 -88 -105t-89 84q1 32 19 54t18 27t-16 5z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E531[] =
+    "<symbol id=\"E531\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1513 862q-91 0 -137 -224q-18 -85 -18 -87q0 -10 20 -10h219q23 0 28 4t13 26q117 338 377 338q176 0 176 -137q-1 -53 -29 -82q-28 -28 -70 -28t-68 22t-25 75q1 52 55 70q6 3 9 5t7 3t5 9q0 16 -33 16q-72 0 -115 -72t-78 -234v-5q0 -10 21 -10h123q31 0 30 -31 q0 -33 -32 -33h-133q-6 0 -16 -9t-11 -13v-2q-2 -2 -2 -4q-72 -252 -157 -428t-167 -254t-194 -78q-66 -1 -107 33t-41 88t27 84q27 28 69 28q41 0 65 -22t24 -64q0 -43 -33 -64q-33 -22 -33 -30t21 -8q59 0 95 56t81 210l129 449l4 20q0 8 -17 8h-229q-6 0 -16 -9t-11 -13 v-2q-2 -2 -2 -4q-73 -252 -157 -428t-166 -254t-195 -78q-67 -1 -107 33t-40 88t26 84q27 28 69 28t66 -22q23 -22 23 -64q0 -43 -33 -64q-60 -38 -12 -38q59 0 95 56t81 210l129 449l4 20q0 8 -16 8h-230q-6 0 -16 -9t-10 -13v-2q-2 -2 -2 -4q-72 -252 -157 -428t-167 -254 t-194 -78q-66 -1 -107 33t-41 88t27 84q27 28 69 28t66 -22t23 -64q0 -43 -33 -64q-33 -22 -33 -30t20 -8q59 0 96 56q36 56 81 210l129 449l4 20q0 8 -17 8h-229q-6 0 -16 -9t-11 -13v-2q-2 -2 -2 -4q-72 -252 -156 -428t-167 -254q-82 -78 -195 -78q-68 0 -110 36t-43 92 q0 56 30 89q31 33 75 33t69 -23q25 -22 25 -66q-1 -61 -78 -87q-13 -3 -13 -11q0 -18 48 -18t84 56t81 210l129 449l4 20q0 8 -16 8h-119q-31 0 -31 32t33 32h119q23 0 28 4t13 26q55 164 139 251t225 87q80 1 119 -33t39 -79q0 -104 -90 -105q-86 0 -86 84q0 32 18 54 t18 27t-16 5q-55 0 -87 -70t-50 -154q-18 -85 -18 -87q0 -10 20 -10h219q23 0 28 4t13 26q55 164 139 251t226 87q80 1 119 -33t39 -79q0 -105 -88 -105t-89 84q1 32 19 54t18 27t-16 5q-92 0 -139 -226q-17 -83 -17 -89t21 -6h219q23 0 28 4t13 26q55 164 139 251t225 87 q80 1 119 -33t39 -79q0 -104 -90 -105q-86 0 -86 84q0 32 18 54q19 22 19 27t-17 5z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E532[] =
+    "<symbol id=\"E532\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M2005 862q-92 0 -139 -226q-16 -83 -16 -89t20 -6h219q23 0 28 4t13 26q117 338 377 338q176 0 176 -137q0 -53 -29 -82q-28 -28 -70 -28t-68 22t-26 76q0 53 56 69q6 3 9 5t7 3t4 9q0 16 -33 16q-72 0 -115 -72t-77 -234v-5q0 -10 20 -10h123q31 0 31 -32t-33 -32h-133 q-6 0 -16 -9t-11 -13v-2q-2 -2 -2 -4q-72 -252 -156 -428t-167 -254q-82 -78 -195 -78q-66 -1 -106 33t-41 88q0 54 26 84q27 28 69 28t66 -22t24 -64q0 -43 -34 -64q-60 -38 -12 -38q59 0 95 56t81 210l129 449l4 20q0 8 -16 8h-229q-6 0 -16 -9t-11 -13v-2q-2 -2 -2 -4 q-72 -252 -157 -428t-167 -254t-194 -78q-66 -1 -107 33t-41 88t27 84q27 28 69 28q41 0 65 -22t24 -64q0 -43 -33 -64q-33 -22 -33 -30t21 -8q59 0 95 56t81 210l129 449l4 20q0 8 -17 8h-229q-6 0 -16 -9t-11 -13v-2q-2 -2 -2 -4q-73 -252 -157 -428t-166 -254t-195 -78 q-67 -1 -107 33t-40 88t26 84q27 28 69 28t66 -22q23 -22 23 -64q0 -43 -33 -64q-60 -38 -12 -38q59 0 95 56t81 210l129 449l4 20q0 8 -16 8h-230q-6 0 -16 -9t-10 -13v-2q-2 -2 -2 -4q-72 -252 -157 -428t-167 -254t-194 -78q-66 -1 -107 33t-41 88t27 84q27 28 69 28 t66 -22t23 -64q0 -43 -33 -64q-33 -22 -33 -30t20 -8q59 0 96 56q36 56 81 210l129 449l4 20q0 8 -17 8h-229q-6 0 -16 -9t-11 -13v-2q-2 -2 -2 -4q-72 -252 -156 -428t-167 -254q-82 -78 -195 -78q-68 0 -110 36t-43 92q0 56 30 89q31 33 75 33t69 -23q25 -22 25 -66 q-1 -61 -78 -87q-13 -3 -13 -11q0 -18 48 -18t84 56t81 210l129 449l4 20q0 8 -16 8h-119q-31 0 -31 32t33 32h119q23 0 28 4t13 26q55 164 139 251t225 87q80 1 119 -33t39 -79q0 -104 -90 -105q-86 0 -86 84q0 32 18 54t18 27t-16 5q-55 0 -87 -70t-50 -154 q-18 -85 -18 -87q0 -10 20 -10h219q23 0 28 4t13 26q55 164 139 251t226 87q80 1 119 -33t39 -79q0 -105 -88 -105t-89 84q1 32 19 54t18 27t-16 5q-92 0 -139 -226q-17 -83 -17 -89t21 -6h219q23 0 28 4t13 26q55 164 139 251t225 87q80 1 119 -33t39 -79q0 -104 -90 -105 q-86 0 -86 84q0 32 18 54q19 22 19 27t-17 5q-55 0 -87 -70t-50 -154q-18 -85 -18 -87q0 -10 20 -10h219q23 0 28 4t13 26q56 164 140 251t225 87q80 1 119 -33t39 -79q0 -104 -90 -105q-86 0 -86 84q0 32 18 54t18 27t-16 5z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E533[] =
+    "<symbol id=\"E533\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M2497 862q-92 0 -138 -224q-18 -85 -18 -87q0 -10 20 -10h219q23 0 28 4t13 26q117 338 377 338q176 0 176 -137q0 -53 -28 -82q-28 -28 -71 -28q-42 0 -68 22t-25 75q1 52 55 70q6 3 9 5q4 2 8 3t4 9q0 16 -33 16q-72 0 -115 -72t-78 -234v-5q0 -10 21 -10h123 q31 0 30 -31q0 -33 -32 -33h-133q-7 0 -17 -9t-10 -13v-2q-2 -2 -2 -4q-72 -252 -157 -428t-167 -254t-194 -78q-66 -1 -107 33t-41 88t27 84q27 28 69 28t66 -22t23 -64q0 -43 -33 -64q-33 -22 -33 -30t21 -8q59 0 95 56t81 210l129 449l4 20q0 8 -17 8h-229q-6 0 -16 -9 t-11 -13v-2q-2 -2 -2 -4q-72 -252 -156 -428t-167 -254q-82 -78 -195 -78q-66 -1 -106 33t-41 88q0 54 26 84q27 28 69 28t66 -22t24 -64q0 -43 -34 -64q-60 -38 -12 -38q59 0 95 56t81 210l129 449l4 20q0 8 -16 8h-229q-6 0 -16 -9t-11 -13v-2q-2 -2 -2 -4 q-72 -252 -157 -428t-167 -254t-194 -78q-66 -1 -107 33t-41 88t27 84q27 28 69 28q41 0 65 -22t24 -64q0 -43 -33 -64q-33 -22 -33 -30t21 -8q59 0 95 56t81 210l129 449l4 20q0 8 -17 8h-229q-6 0 -16 -9t-11 -13v-2q-2 -2 -2 -4q-73 -252 -157 -428t-166 -254t-195 -78 q-67 -1 -107 33t-40 88t26 84q27 28 69 28t66 -22q23 -22 23 -64q0 -43 -33 -64q-60 -38 -12 -38q59 0 95 56t81 210l129 449l4 20q0 8 -16 8h-230q-6 0 -16 -9t-10 -13v-2q-2 -2 -2 -4q-72 -252 -157 -428t-167 -254t-194 -78q-66 -1 -107 33t-41 88t27 84q27 28 69 28 t66 -22t23 -64q0 -43 -33 -64q-33 -22 -33 -30t20 -8q59 0 96 56q36 56 81 210l129 449l4 20q0 8 -17 8h-229q-6 0 -16 -9t-11 -13v-2q-2 -2 -2 -4q-72 -252 -156 -428t-167 -254q-82 -78 -195 -78q-68 0 -110 36t-43 92q0 56 30 89q31 33 75 33t69 -23q25 -22 25 -66 q-1 -61 -78 -87q-13 -3 -13 -11q0 -18 48 -18t84 56t81 210l129 449l4 20q0 8 -16 8h-119q-31 0 -31 32t33 32h119q23 0 28 4t13 26q55 164 139 251t225 87q80 1 119 -33t39 -79q0 -104 -90 -105q-86 0 -86 84q0 32 18 54t18 27t-16 5q-55 0 -87 -70t-50 -154 q-18 -85 -18 -87q0 -10 20 -10h219q23 0 28 4t13 26q55 164 139 251t226 87q80 1 119 -33t39 -79q0 -105 -88 -105t-89 84q1 32 19 54t18 27t-16 5q-92 0 -139 -226q-17 -83 -17 -89t21 -6h219q23 0 28 4t13 26q55 164 139 251t225 87q80 1 119 -33t39 -79q0 -104 -90 -105 q-86"
+    " 0 -86 84q0 32 18 54q19 22 19 27t-17 5q-55 0 -87 -70t-50 -154q-18 -85 -18 -87q0 -10 20 -10h219q23 0 28 4t13 26q56 164 140 251t225 87q80 1 119 -33t39 -79q0 -104 -90 -105q-86 0 -86 84q0 32 18 54t18 27t-16 5q-92 0 -139 -226q-17 -83 -17 -89t21 -6h219 q23 0 28 4t13 26q55 164 139 251t225 87q80 1 119 -33t39 -79q0 -104 -90 -105q-86 0 -86 84q0 32 18 54t18 27t-15 5z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E534[] =
+    "<symbol id=\"E534\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1024 485q-35 -1 -72 -37t-59 -92l-41 -100q-39 -98 -39 -141q0 -66 51 -66q68 0 138 137t69 218q0 81 -47 81zM1070 561q98 0 148 -47t50 -135q0 -150 -106 -275t-251 -124q-80 0 -114 34l-16 16q-5 5 -11 5t-16 -25l-92 -229q-4 -12 -4 -16t18 -5h82q25 0 24 -24 q0 -27 -26 -27h-396q-25 0 -24 25q0 27 26 26h64q23 0 31 21l252 625q12 28 12 52t-23 23q-47 0 -137 -155q-16 -31 -33 -31q-23 0 -22 22q0 11 34 75q90 166 230 167q90 0 110 -71q7 -29 19 -17q4 4 13 15q61 75 158 75zM-183 -61q93 1 93 -89q0 -58 -62 -81l-24 -9 q-4 -2 -4 -8q0 -18 48 -18t84 56t81 210l129 449l4 20q0 8 -16 8h-119q-31 0 -31 32t33 32h119q24 0 28 4t13 26q117 338 376 338q176 0 176 -137q-1 -53 -29 -82q-28 -28 -70 -28q-93 1 -93 94q0 55 55 73q6 3 9 5t7 3t5 9q0 16 -33 16q-72 0 -114 -70t-74 -217l-5 -19v-5 q0 -10 21 -10h123q31 0 31 -32t-33 -32h-133q-6 0 -16 -9t-11 -13v-2q-2 -2 -2 -4q-72 -252 -157 -428t-167 -254t-194 -78q-68 0 -111 36t-43 92t31 89t75 33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E535[] =
+    "<symbol id=\"E535\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M559 344q0 12 6 31l49 143q8 27 37 27l66 -8q151 -22 210 -5q60 17 64 17q27 -1 27 -21t-27 -47l-327 -323l-25 -35q28 12 58 12t74 -36t73 -36q29 -1 39 19t10 25q0 10 -25 -4t-47 9t-22 53t19 50q19 21 49 21t52 -23q21 -23 21 -79t-43 -106q-43 -48 -111 -48t-130 32 q-60 32 -83 31t-51 -23t-39 -22q-27 0 -26 25q0 16 24 40l316 320q47 47 41 47t-33 -7t-47 -7l-103 6q-10 0 -22 -25l-21 -43q-14 -31 -30 -30q-23 0 -23 20zM-183 -61q93 1 93 -89q0 -58 -62 -81l-24 -9q-4 -2 -4 -8q0 -18 48 -18t84 56t81 210l129 449l4 20q0 8 -16 8 h-119q-31 0 -31 32t33 32h119q24 0 28 4t13 26q117 338 376 338q176 0 176 -137q-1 -53 -29 -82q-28 -28 -70 -28q-93 1 -93 94q0 55 55 73q6 3 9 5t7 3t5 9q0 16 -33 16q-72 0 -114 -70t-74 -217l-5 -19v-5q0 -10 21 -10h123q31 0 31 -32t-33 -32h-133q-6 0 -16 -9t-11 -13 v-2q-2 -2 -2 -4q-72 -252 -157 -428t-167 -254t-194 -78q-68 0 -111 36t-43 92t31 89t75 33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E536[] =
+    "<symbol id=\"E536\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M641 477h-119q-31 0 -30 31q-1 33 32 33h119q23 0 28 4t13 26q117 338 377 338q176 0 176 -137q0 -53 -29 -82q-28 -28 -70 -28t-68 22t-26 76q0 53 56 69q6 3 9 5t7 3t4 9q0 16 -33 16q-72 0 -115 -72t-77 -234v-5q0 -10 20 -10h123q31 0 31 -32t-33 -32h-133 q-6 0 -16 -9t-10 -13v-2q-2 -2 -3 -4q-72 -252 -156 -428t-167 -254q-82 -78 -195 -78q-68 0 -110 36t-43 92q0 56 30 89q31 33 75 33t69 -23t24 -73t-61 -74l-25 -9q-4 -2 -4 -8q0 -18 48 -18t84 56t81 210l129 449l4 20q0 8 -16 8zM96 404q0 66 56 110q56 45 142 45 q85 0 130 -33t45 -77q0 -91 -76 -91q-31 0 -51 18t-20 49q0 32 13 42t29 18q3 2 3 7q-1 22 -55 22q-98 -1 -97 -68q0 -28 19 -50t79 -66q101 -74 101 -161t-67 -138t-157 -51t-140 38t-50 86t24 76t58 27t54 -19q22 -18 22 -57t-44 -58q-8 -3 -14 -4t-6 -12q0 -10 25 -19 t67 -9q42 -1 70 27q29 28 29 74q-1 46 -69 93t-94 81t-26 100z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E537[] =
+    "<symbol id=\"E537\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1487 485q-35 -1 -72 -37t-59 -92l-41 -100q-39 -98 -39 -141q0 -66 51 -66q67 0 137 137t70 218t-47 81zM1233 35q-6 0 -16 -25l-93 -229q-4 -12 -4 -16t19 -5h82q25 0 24 -24q0 -27 -26 -27h-396q-25 0 -24 25q0 27 26 26h64q23 0 31 21l251 625q32 77 -10 75 q-47 0 -137 -155q-16 -31 -33 -31q-23 0 -22 22q1 11 35 75q90 166 229 167q94 0 109 -71q7 -30 20 -17q4 4 13 15q61 75 158 75t147 -47t51 -135q-1 -150 -107 -275t-250 -124q-80 0 -114 34l-16 16q-5 5 -11 5zM288 -61q93 1 93 -89q0 -58 -62 -81l-24 -9q-4 -2 -4 -8 q0 -18 48 -18t84 56t81 210l129 449l4 20q0 8 -16 8h-119q-31 0 -31 32t33 32h119q23 0 27 4t14 26q117 338 376 338q176 0 177 -137q0 -53 -29 -82q-29 -28 -71 -28q-93 1 -93 94q0 55 55 73q5 3 9 5t8 3t4 9q0 16 -33 16q-72 0 -114 -70t-74 -217l-5 -28q0 -6 21 -6h123 q31 0 31 -32t-33 -32h-133q-7 0 -17 -9t-10 -13v-2q-2 -2 -2 -4q-72 -252 -157 -428t-167 -254t-194 -78q-68 0 -111 36t-43 92t31 89t75 33zM96 404q0 66 56 110q56 45 142 45q85 0 130 -33t45 -77q0 -91 -76 -91q-31 0 -51 18t-20 49q0 32 13 42t29 18q3 2 3 7 q-1 22 -55 22q-98 -1 -97 -68q0 -28 19 -50t79 -66q101 -74 101 -161t-67 -138t-157 -51t-140 38t-50 86t24 76t58 27t54 -19q22 -18 22 -57t-44 -58q-8 -3 -14 -4t-6 -12q0 -10 25 -19t67 -9q42 -1 70 27q29 28 29 74q-1 46 -69 93t-94 81t-26 100z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E538[] =
+    "<symbol id=\"E538\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1090 862q-72 0 -115 -72t-78 -234v-5q0 -10 21 -10h90q31 0 30 -31q1 -33 -32 -33h-101q-6 0 -16 -9t-10 -13l-2 -2v-4q-72 -252 -157 -428t-167 -254t-195 -78q-68 0 -110 36t-43 92q0 56 31 89q30 33 74 33t69 -23t24 -73t-61 -74l-25 -9q-4 -2 -4 -8q0 -18 48 -18 t84 56t81 210l129 449l4 20q0 8 -16 8h-119q-31 0 -30 31q0 33 32 33h119q23 0 28 4t13 26q117 338 381 338q88 0 130 -38t42 -95t-29 -86q-28 -28 -70 -28t-68 22t-25 75q1 52 55 70q6 3 9 5t7 3t4 9q0 16 -32 16zM989 295q-23 0 -22 22q1 11 35 75q90 166 229 167 q94 0 109 -71q7 -30 20 -17q4 4 13 15q61 75 158 75t147 -47t51 -135q-1 -150 -107 -275t-250 -124q-88 0 -130 50q-5 5 -11 5t-17 -25l-92 -229q-4 -12 -4 -16t19 -5h82q25 0 24 -24q0 -27 -26 -27h-396q-25 0 -24 25q0 27 26 26h64q23 1 31 21l251 625q32 77 -10 75 q-47 0 -137 -155q-16 -31 -33 -31zM1767 383q-23 0 -22 20q0 14 16 39q82 117 186 117t120 -71q7 -30 20 -17q4 4 13 15q61 75 158 75t147 -47t51 -135q0 -150 -106 -275t-251 -124q-80 0 -114 34l-16 16q-5 5 -11 5t-16 -25l-93 -229q-4 -12 -4 -16t19 -5h82q25 0 24 -24 q0 -27 -26 -27h-396q-25 0 -24 25q0 27 26 26h64q23 1 31 21l251 625q32 77 -10 75q-37 0 -86 -73q-18 -25 -33 -25zM414 169q0 -87 -67 -138t-157 -51t-140 38t-50 86t24 76t58 27t54 -19q22 -18 22 -57t-44 -58q-8 -3 -14 -4t-6 -12q0 -10 25 -19t67 -9q42 -1 70 27 q29 28 29 74q-1 46 -69 93t-94 81t-26 100t56 110q56 45 142 45q85 0 130 -33t45 -77q0 -91 -76 -91q-31 0 -51 18t-20 49q0 32 13 42t29 18q3 2 3 7q-1 22 -55 22q-98 -1 -97 -68q0 -28 19 -50t79 -66q101 -74 101 -161zM1274 115q0 -66 51 -66q67 0 137 137q70 136 70 218 t-47 81q-35 0 -72 -36q-36 -38 -59 -93l-41 -100q-39 -98 -39 -141zM2001 115q0 -66 51 -66q68 0 138 137q70 136 69 218q0 82 -47 81q-35 0 -72 -36q-36 -38 -59 -93l-41 -100q-39 -98 -39 -141z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E539[] =
+    "<symbol id=\"E539\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1042 344q0 12 7 31l49 143q8 27 37 27l65 -8q151 -22 211 -5t64 17q27 0 26 -23q0 -18 -26 -45l-328 -323l-25 -35q30 12 59 12t73 -36t73 -36q29 -1 39 19t10 25q0 10 -25 -4t-47 9t-22 53t20 50q20 21 49 21t51 -23t22 -79t-44 -106q-44 -48 -112 -48t-128 32t-83 31 t-51 -23t-39 -22q-27 0 -27 25q0 16 25 40l315 320q47 47 41 47t-33 -7t-47 -7l-102 6q-10 0 -23 -25l-20 -43q-14 -31 -31 -30q-23 0 -23 20zM631 477h-119q-31 0 -31 32t33 32h119q23 0 27 4t14 26q117 338 377 338q176 0 176 -137q0 -53 -29 -82q-29 -28 -71 -28 q-93 1 -93 94q0 57 56 73q6 3 9 5t7 3t4 9q0 16 -33 16q-72 0 -115 -72t-77 -234v-5q0 -10 20 -10h123q31 0 31 -32t-33 -32h-133q-6 0 -16 -9t-11 -13l-2 -2v-4q-72 -252 -156 -428t-167 -254q-82 -78 -195 -78q-68 0 -110 36t-43 92q0 56 30 89q31 33 75 33t69 -23 q25 -22 25 -66q-1 -61 -78 -87q-13 -3 -13 -11q0 -18 48 -18t84 56t81 210l129 449l4 20q0 8 -16 8zM96 404q0 66 56 110q56 45 142 45q85 0 130 -33t45 -77q0 -91 -76 -91q-31 0 -51 18t-20 49q0 32 13 42t29 18q3 2 3 7q-1 22 -55 22q-98 -1 -97 -68q0 -28 19 -50t79 -66 q101 -74 101 -161t-67 -138t-157 -51t-140 38t-50 86t24 76t58 27t54 -19q22 -18 22 -57t-44 -58q-8 -3 -14 -4t-6 -12q0 -10 25 -19t67 -9q42 -1 70 27q29 28 29 74q-1 46 -69 93t-94 81t-26 100z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E53A[] =
+    "<symbol id=\"E53A\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1960 485q-35 -1 -72 -37t-59 -92l-41 -100q-39 -98 -39 -141q0 -66 51 -66q68 0 138 137t69 218q0 81 -47 81zM1706 35q-6 0 -16 -25l-93 -229q-4 -12 -4 -16t19 -5h82q25 0 24 -24q0 -27 -26 -27h-396q-25 0 -24 25q0 27 26 26h64q23 0 31 21l252 625q12 28 12 52 t-23 23q-47 0 -137 -155q-16 -31 -33 -31q-23 0 -22 22q0 11 34 75q90 166 230 167q90 0 110 -71q7 -29 19 -17q4 4 13 15q61 75 158 75t147 -47t51 -135q0 -150 -106 -275t-251 -124q-80 0 -114 34l-16 16q-5 5 -11 5zM1487 549q27 0 26 -23q0 -18 -26 -45l-328 -323 l-24 -35q28 12 58 12t74 -36q45 -36 73 -36q28 -1 38 19t11 24q0 6 -7 7l-32 -11q-23 0 -39 16q-17 16 -17 47q0 30 20 50q20 21 49 21t51 -23t22 -79t-43 -106q-43 -48 -111 -48t-130 32q-60 32 -83 31t-51 -23t-39 -22q-27 0 -27 25q0 16 25 40l315 320q47 47 41 47 t-33 -7t-47 -7l-102 6q-10 0 -23 -25l-20 -43q-14 -31 -31 -30q-23 0 -22 20q0 12 6 31l49 143q8 27 37 27l65 -8q151 -22 211 -5t64 17zM641 477h-119q-31 0 -30 31q-1 33 32 33h119q23 0 28 4t13 26q117 338 377 338q176 0 176 -137q0 -53 -29 -82q-28 -28 -70 -28t-68 22 t-26 76q0 53 56 69q6 3 9 5t7 3t4 9q0 16 -33 16q-72 0 -115 -72t-77 -234v-5q0 -10 20 -10h123q31 0 31 -32t-33 -32h-133q-6 0 -16 -9t-10 -13v-2q-2 -2 -3 -4q-72 -252 -156 -428t-167 -254q-82 -78 -195 -78q-68 0 -110 36t-43 92q0 56 30 89q31 33 75 33t69 -23t24 -73 t-61 -74l-25 -9q-4 -2 -4 -8q0 -18 48 -18t84 56t81 210l129 449l4 20q0 8 -16 8zM96 404q0 66 56 110q56 45 142 45q85 0 130 -33t45 -77q0 -91 -76 -91q-31 0 -51 18t-20 49q0 32 13 42t29 18q3 2 3 7q-1 22 -55 22q-98 -1 -97 -68q0 -28 19 -50t79 -66q101 -74 101 -161 t-67 -138t-157 -51t-140 38t-50 86t24 76t58 27t54 -19q22 -18 22 -57t-44 -58q-8 -3 -14 -4t-6 -12q0 -10 25 -19t67 -9q42 -1 70 27q29 28 29 74q-1 46 -69 93t-94 81t-26 100z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E53B[] =
+    "<symbol id=\"E53B\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1581 862q-72 0 -115 -71t-77 -235v-5q0 -10 20 -10h90q31 0 31 -32t-33 -32h-100q-7 0 -17 -9t-10 -13l-2 -2v-4q-72 -252 -157 -428t-167 -254t-194 -78q-66 -1 -107 33t-41 88t27 84q27 28 69 28t66 -22t23 -64q0 -43 -33 -64q-33 -22 -33 -30t21 -8q59 0 95 56 t81 210l129 449l4 20q0 8 -16 8h-230q-6 0 -16 -9t-10 -13l-2 -2v-4q-72 -252 -157 -428t-167 -254t-195 -78q-68 0 -110 36t-43 92q0 56 31 89q30 33 74 33t69 -23t24 -73t-61 -74l-25 -9q-4 -2 -4 -8q0 -18 48 -18t84 56t81 210l129 449l4 20q0 8 -16 8h-119q-31 0 -30 31 q0 33 32 33h119q23 0 28 4t13 26q55 164 139 251t226 87q81 1 119 -33t38 -79q0 -104 -90 -105q-86 0 -86 84q0 32 18 54t19 27q0 5 -16 5q-92 0 -139 -226q-17 -83 -17 -89t21 -6h219q23 0 27 4t14 26q117 338 381 338q88 0 130 -38t42 -95t-29 -86q-29 -28 -71 -28 q-93 1 -93 94q0 55 55 73q5 3 9 5t8 3t4 9q0 16 -33 16zM414 169q0 -87 -67 -138t-157 -51t-140 38t-50 86t24 76t58 27t54 -19q22 -18 22 -57t-44 -58q-8 -3 -14 -4t-6 -12q0 -10 25 -19t67 -9q42 -1 70 27q29 28 29 74q-1 46 -69 93t-94 81t-26 100t56 110q56 45 142 45 q85 0 130 -33t45 -77q0 -91 -76 -91q-31 0 -51 18t-20 49q0 32 13 42t29 18q3 2 3 7q-1 22 -55 22q-98 -1 -97 -68q0 -28 19 -50t79 -66q101 -74 101 -161zM1654 135q29 0 73 -36t73 -36q29 -1 39 19t10 25q0 10 -25 -4t-47 9q-21 23 -21 53t18 50q20 21 50 21t52 -23 t20 -79q0 -56 -43 -106q-43 -48 -111 -48t-128 32t-84 31t-52 -23t-38 -22q-27 0 -27 25q0 16 25 40l315 320q47 47 42 47t-32 -7t-49 -7l-102 6q-10 0 -23 -25l-20 -43q-14 -31 -31 -30q-23 0 -22 20q0 12 6 31l49 143q8 27 37 27l67 -8q149 -23 223 0q45 12 50 12 q27 0 26 -23q1 -18 -26 -45l-328 -323l-25 -35q30 12 59 12z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E53C[] =
+    "<symbol id=\"E53C\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M684 477h-66q-31 0 -30 31q0 33 33 33h65q23 0 28 4t13 26q117 338 377 338q176 0 176 -137q0 -53 -29 -82q-29 -28 -71 -28t-67 22q-26 22 -26 76q0 53 56 69q6 3 9 5t7 3t4 9q0 16 -33 16q-72 0 -115 -72t-77 -234v-5q0 -10 20 -10h123q31 0 31 -32t-33 -32h-133 q-6 0 -16 -9t-10 -13l-2 -2v-4q-72 -252 -157 -428t-167 -254t-195 -78q-69 0 -111 36t-42 92t30 89q31 33 75 33t69 -23t24 -73t-61 -74l-25 -9q-4 -2 -4 -8q0 -18 48 -18t84 56t81 210l129 449l4 20q0 8 -16 8zM-41 317q-1 11 33 75t88 116t128 51q73 1 90 -75q1 -4 1 -10 q0 -5 5 -5t17 13q61 79 140 79q53 0 80 -31q27 -30 27 -80t-24 -80t-60 -30q-76 0 -76 66q0 34 22 56t23 25q0 13 -27 13t-69 -45t-62 -99l-133 -331q-10 -25 -33 -25h-100q-23 0 -23 10t6 25l150 371q12 28 12 52t-22 23q-47 0 -140 -159q-12 -27 -32 -27t-21 22z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E53D[] =
+    "<symbol id=\"E53D\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1130 862q-72 0 -115 -72t-77 -234v-5q0 -10 20 -10h91q31 0 30 -31q0 -33 -32 -33h-101q-6 0 -16 -9t-10 -13l-2 -2v-4q-72 -252 -157 -428t-167 -254t-195 -78q-69 0 -111 36t-42 92t30 89q31 33 75 33t69 -23t24 -73t-61 -74l-25 -9q-4 -2 -4 -8q0 -18 48 -18t84 56 t81 210l129 449l4 20q0 8 -16 8h-66q-31 0 -30 31q0 33 33 33h65q23 0 28 4t13 26q117 338 381 338q88 0 130 -38t42 -95t-29 -86q-29 -28 -71 -28t-67 22q-26 22 -26 76q0 53 56 69q6 3 9 5t7 3t4 9q0 16 -33 16zM-41 317q-1 11 33 75t88 116t128 51q73 1 90 -75 q1 -4 1 -10q0 -5 5 -5t17 13q61 79 140 79q53 0 80 -31q27 -30 27 -80t-24 -80t-60 -30q-76 0 -76 66q0 34 22 56t23 25q0 13 -27 13t-69 -45t-62 -99l-133 -331q-10 -25 -33 -25h-100q-23 0 -23 10t6 25l150 371q12 28 12 52t-22 23q-47 0 -140 -159q-12 -27 -32 -27 t-21 22zM1203 135q30 0 74 -36t73 -36q29 -1 39 19t10 25t-6 6l-33 -11q-23 0 -39 16t-16 47q0 30 19 50q19 21 49 21q29 0 51 -23t22 -79t-43 -106q-43 -48 -111 -48t-130 32q-60 32 -83 31t-51 -23t-39 -22q-27 0 -26 25q0 16 24 40l316 320q47 47 41 47t-32 -7t-68 -7 t-62 3q-18 3 -21 3q-10 0 -22 -25l-21 -43q-14 -31 -31 -30q-23 0 -22 20q0 12 6 31l49 143q8 27 37 27l68 -8q148 -22 208 -5t64 17q27 -1 27 -21t-27 -47l-328 -323l-24 -35q28 12 58 12z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E566[] =
+    "<symbol id=\"E566\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M386 342q-6 0 -36 -76l-55 -135q-16 -41 -16 -65t22 -23q45 0 80 52t35 120q0 18 -9 56t-10 55q-6 16 -11 16zM272 463q0 13 -32 31t-79 18q-48 0 -77 -26t-29 -58q0 -61 91 -61t110 49l8 20q8 20 8 27zM0 422q0 57 47 97t108 40t129 -34q5 -3 10 -3t15 25l74 180 q10 25 35 33l100 33q19 6 29 6q10 -1 10 -11t-6 -24l-102 -254q-10 -27 -11 -31q0 -6 7 -6t49 23q120 63 194 63t98 -45q13 -26 13 -36t5 -9q6 0 16 13q61 79 141 79q53 0 79 -31q26 -30 27 -80q0 -50 -24 -80t-62 -30q-72 0 -74 66q0 34 23 56t22 25q0 13 -26 13t-69 -45 q-42 -45 -62 -99l-133 -331q-10 -25 -33 -25h-101q-23 0 -22 12q0 8 6 23l150 371q12 30 12 60t-34 30t-153 -72q-57 -28 -57 -47q0 -4 6 -21q27 -66 27 -157q-1 -91 -63 -155t-146 -64q-55 0 -86 28t-31 73q0 44 39 140l23 55q6 14 6 20t-6 7l-64 -4q-67 0 -101 33t-34 90z \"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E567[] =
+    "<symbol id=\"E567\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M760 446q74 0 128 -54t54 -156t-57 -168t-153 -66t-168 47q-73 47 -158 141q-137 154 -222 154q-57 0 -95 -34t-38 -85q1 -51 21 -80q37 -52 93 -5q27 24 59 24t52 -20t20 -60t-31 -62q-33 -22 -95 -22t-116 54t-54 156t57 169q57 65 153 65t168 -47q73 -47 159 -141 q137 -154 221 -154q57 0 95 34t38 85q-1 51 -21 80t-44 29t-50 -24t-58 -24t-52 21q-20 20 -21 53q0 90 115 90z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E568[] =
+    "<symbol id=\"E568\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M176 446q115 0 115 -90q-1 -33 -21 -53t-53 -20q-33 -1 -59 23t-50 24q-22 0 -42 -29t-20 -80t37 -85q38 -34 95 -34q84 0 221 154q86 94 159 141t168 47t153 -65q57 -66 57 -168q0 -103 -54 -157t-116 -54q-126 0 -127 90q0 33 20 53q19 21 53 21t60 -24q53 -48 92 5 q20 29 20 80t-37 85q-38 34 -95 34q-84 0 -222 -154q-86 -94 -158 -141t-168 -47q-95 0 -153 66q-57 66 -57 168t54 156t128 54z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E56A[] =
+    "<symbol id=\"E56A\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 772q0 62 54 116t156 54t169 -57q65 -57 65 -153t-47 -168q-47 -73 -141 -158q-154 -137 -154 -222q0 -57 34 -95t85 -38q51 1 80 21t29 42t-24 51q-24 27 -24 59t21 52q20 20 59 20t62 -31q22 -33 22 -95t-54 -116t-156 -54t-168 57t-66 153t47 168q47 73 141 159 q154 137 154 221q0 57 -34 95t-85 38q-51 -1 -80 -21q-53 -38 -5 -94q24 -26 24 -58t-20 -52t-54 -21q-90 1 -90 127z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E56B[] =
+    "<symbol id=\"E56B\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-6 182q0 115 90 115q33 -1 53 -21q21 -20 21 -52t-24 -60q-48 -55 5 -92q29 -20 80 -20t85 37q34 38 34 95q0 84 -154 222q-94 86 -141 158t-47 168q0 95 65 153q66 57 168 57q103 0 157 -54t54 -128q0 -115 -90 -115q-33 1 -53 21q-21 20 -21 52t24 58t24 50t-29 44 t-80 20t-85 -37q-34 -38 -34 -95q0 -84 154 -221q94 -86 141 -159t47 -168t-65 -153q-66 -57 -168 -57t-157 54q-54 54 -54 128z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E56C[] =
+    "<symbol id=\"E56C\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M496 0q-27 0 -37 13t-92 99q-81 86 -95 102q-27 29 -69 -13q-53 -45 -92 -82t-75 -37t-36 20q0 6 25 50l247 280q6 6 32 37t61 33q37 -4 63 -39l205 -238q62 81 182 207q37 43 52 55q42 33 91 -16q12 -10 90 -102q78 -93 91 -107q14 -14 29 -14q14 0 30 14t99 114t99 113 q36 26 77 -4q12 -10 12 -19t-26 -42q-25 -33 -197 -219q-172 -185 -184 -195t-40 -10q-27 0 -39 14q-41 51 -178 189q-18 25 -32 25t-55 -36q-42 -36 -66 -61q-43 -37 -47 -39l-84 -82q-14 -10 -41 -10z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E56D[] =
+    "<symbol id=\"E56D\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1176 250q16 0 33 15t99 113t98 111q34 28 77 -4q10 -8 10 -21t-25 -38q-8 -12 -189 -208q-181 -198 -193 -208t-38 -10t-35 10t-94 101t-99 110q-13 19 -46 -4v-367h-65v312q-168 -146 -176 -154t-35 -8t-39 14l-178 191q-19 25 -31 25t-50 -30q-38 -29 -81 -73 q-43 -43 -80 -43t-37 20t27 48l73 86q117 139 172 194q53 68 93 70q29 -2 48 -22t93 -109q74 -88 131 -150q8 12 14 17l60 69v346h63v-276l49 55q39 45 55 57q16 13 36 13t42 -20t100 -112q77 -92 90 -106q12 -14 28 -14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E56E[] =
+    "<symbol id=\"E56E\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1700 248q16 0 32 14t98 114q83 100 97 111q34 29 78 -2q12 -10 12 -19t-28 -48q-23 -27 -195 -213q-172 -185 -184 -195t-38 -10t-40 14l-178 189q-18 25 -30 25t-46 -27l-205 -191q-14 -10 -41 -10t-36 10t-52 56t-83 89q-39 41 -53 57t-29 15t-40 -26q-23 -16 -45 -43 q-24 -23 -62 -60q-38 -36 -64 -60t-34 -31t-35 -7q-26 0 -38 14q-158 158 -178 189q-23 25 -32 25t-25 -12q-16 -11 -18 -13q-1 -2 -3 -2l-78 -70q-53 -49 -89 -49t-36 20q0 6 25 50l247 280q6 6 22 23t28 26q18 17 47 17t59 -35q4 -4 201 -234l178 203q6 6 32 36t59 30 q34 0 65 -35l202 -236l181 205q35 39 51 53q38 33 92 -14q10 -10 88 -102q78 -93 92 -107q13 -14 29 -14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E610[] =
+    "<symbol id=\"E610\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M53 651h533q20 0 36 -16t17 -37v-573q0 -25 -25 -25h-26q-27 0 -27 25v335q0 35 -242 35t-241 -35v-335q0 -25 -25 -25h-28q-25 0 -25 25v573q0 20 16 37q17 16 37 16z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E611[] =
+    "<symbol id=\"E611\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M586 0h-533q-20 0 -37 16q-16 16 -16 37v574q0 25 25 24h28q25 0 25 -24v-336q0 -35 242 -35t241 35v336q0 25 27 24h26q25 0 25 -24v-574q0 -20 -16 -37q-17 -16 -37 -16z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E612[] =
+    "<symbol id=\"E612\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M256 2q-31 0 -37 29l-215 940q-2 4 -2 10q0 27 29 33h8q27 0 37 -27l180 -788l182 788q6 27 35 27h8q29 -6 29 -35v-8l-217 -940q-6 -29 -37 -29z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E613[] =
+    "<symbol id=\"E613\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M256 1014q31 0 37 -29l217 -940v-8q0 -29 -29 -35h-8q-29 0 -35 27l-182 788l-180 -788q-10 -27 -37 -27h-8q-29 6 -29 33q0 6 2 10l215 940q6 29 37 29z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E614[] =
+    "<symbol id=\"E614\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M206 354q-62 0 -106 -43t-45 -105q0 -62 44 -106q45 -44 107 -45q62 0 105 44q43 45 43 107t-43 105t-105 43zM410 206q0 -86 -60 -146t-145 -60q-84 0 -145 60q-60 60 -60 146t60 144q60 60 144 60t146 -60q60 -60 60 -144z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E650[] =
+    "<symbol id=\"E650\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1999 176q39 0 63 -24t25 -64q0 -40 -25 -64q-26 -24 -64 -24t-63 25t-25 63t25 64q25 24 64 24zM1159 573q-84 0 -84 -172q0 -90 9 -91t26 12q96 78 96 164t-47 87zM600 1137q229 0 350 -131q62 -68 62 -154t-42 -134t-121 -48t-137 70t-58 107q0 38 20 38q16 1 26 -13 q41 -54 103 -55q29 1 47 19t18 51q0 70 -47 123q-66 76 -164 75q-49 1 -91 -69t-42 -128t115 -179q55 -61 71 -93q15 -32 15 -66q-1 -34 -29 -96t-58 -104t-32 -48q0 -6 3 -6q3 -1 13 -3q66 -13 128 -74q61 -61 103 -61t89 32q12 10 12 19v8q-8 43 -8 92q0 168 82 262 q63 74 172 74q61 0 97 -33t36 -90t-34 -107q-35 -50 -65 -76t-95 -73l-21 -14q-18 -12 -18 -18q0 -26 24 -66q41 -70 92 -70t125 74q31 31 38 48t7 50v37q0 236 168 328q31 16 48 16q23 0 22 -22q0 -12 -14 -27q-84 -84 -84 -276q0 -106 32 -188t80 -83q100 0 101 260 q0 305 -217 473q-145 115 -412 179q-47 9 -47 33t27 24q16 0 36 -4q252 -51 447 -154q317 -166 317 -514q0 -166 -76 -262t-176 -96q-145 0 -213 133q-14 25 -20 25t-59 -58q-104 -106 -202 -106t-155 118q-10 20 -14 21q-8 0 -25 -16l-53 -52q-154 -145 -246 44 q-52 110 -100 110q-14 0 -35 -25l-29 -34q-77 -92 -121 -131t-79 -39t-57 16t-21 41q0 57 92 128q91 71 147 91t65 28t41 50q32 43 32 81t-12 67t-40 64q-28 36 -32 42t-29 37q-84 104 -84 138q0 76 111 241q30 51 30 63t-28 12q-143 1 -260 -79t-121 -216v-8q0 -98 74 -98 t100 113q6 23 10 31t14 8q23 0 23 -80t-49 -150t-126 -70t-122 62t-45 156t78 179t196 143t314 63h12z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E655[] =
+    "<symbol id=\"E655\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M461 385q35 1 55 21t21 55q-1 35 -21 55t-55 20t-55 -20t-20 -55t20 -55t55 -21zM662 483q32 0 72 40t89 40q49 1 74 -29t25 -73t-25 -73t-74 -30t-89 40t-72 40h-11q-29 0 -40 -5t-18 -22t-7 -32t28 -41t85 -26q55 0 87 -32q32 -30 32 -72t-32 -73q-30 -31 -72 -31 t-73 31t-31 87t-28 86q-28 28 -41 28q-37 0 -47 -18q-11 -18 -11 -48v-10q0 -33 40 -73t40 -89q1 -50 -29 -74t-73 -24t-73 25t-30 73t40 89q40 40 40 73v10q0 29 -6 40q-6 10 -22 18t-28 8t-42 -28q-28 -28 -28 -86q0 -56 -32 -87q-30 -31 -72 -31t-73 31t-31 73t31 72 t87 31q56 0 85 29t29 41q0 11 -7 29t-19 23t-40 5h-10q-33 0 -73 -40t-89 -40q-50 0 -74 30t-24 73t25 73t73 30t89 -41q40 -40 73 -40h10q29 0 40 5q10 4 18 22t8 30t-28 42q-28 28 -86 28q-56 0 -87 31t-31 73t31 72t73 31q42 -1 72 -31t31 -86q0 -56 27 -86 q27 -29 41 -29q15 1 31 8t22 18t6 40v11q0 32 -40 72t-40 89t30 74t73 25t73 -25t30 -74t-41 -89q-40 -40 -40 -72v-11q0 -29 6 -40q14 -25 41 -25t54 28q26 28 26 85q0 55 31 87t73 32t72 -32q30 -30 31 -72q-1 -42 -31 -73t-86 -31t-86 -27q-29 -27 -29 -40q2 -42 20 -51 q17 -9 46 -9h11z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E880[] =
+    "<symbol id=\"E880\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M223 37q119 0 226 340q37 118 41 195q7 143 -64 143q-115 0 -223 -340q-71 -223 -31 -305q16 -33 51 -33zM414 768q121 0 179 -65t58 -157t-28 -196q-55 -172 -161 -269t-226 -97q-122 0 -179 64t-57 157q0 92 29 196q53 172 158 270q106 97 227 97z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E881[] =
+    "<symbol id=\"E881\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M524 741q0 -2 -4 -22l-198 -627q-6 -27 8 -29l69 -6q27 -1 27 -29t-31 -28h-344q-31 0 -31 27t29 30l72 6q16 2 24 21l140 436q4 20 4 25q0 12 -12 12t-25 -18l-76 -82q-18 -23 -34 -23t-25 10q-10 10 -10 22t16 34l217 245q16 16 33 17l63 -19l70 19q18 0 18 -21z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E882[] =
+    "<symbol id=\"E882\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M427 768q119 0 183 -47t64 -129q0 -223 -305 -293q-133 -31 -195 -100q-31 -35 -8 -35l33 12q35 14 75 14t96 -18t97 -18t76 45q14 23 30 22q31 0 31 -24q0 -10 -8 -29q-29 -92 -72 -136q-44 -44 -118 -44t-152 44t-111 44t-48 -41t-42 -41q-33 0 -33 31q0 8 7 32 q29 103 92 179t186 124q205 82 205 263q0 88 -107 88q-49 -1 -79 -19t-29 -36q-1 -18 23 -41t24 -63t-28 -71t-70 -31t-65 26q-22 26 -21 63q0 93 76 161t193 68z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E883[] =
+    "<symbol id=\"E883\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M250 424h22q88 0 139 51q50 51 50 135q0 39 -26 67q-25 28 -87 28t-61 -29q0 -6 24 -27q19 -23 19 -57t-27 -63q-27 -27 -63 -27t-60 24q-23 24 -20 64q2 80 70 129q69 49 167 49t164 -47t66 -115q0 -127 -156 -192q-25 -12 -25 -20t23 -17q80 -41 80 -127 q0 -119 -92 -193q-92 -73 -210 -73t-172 46q-55 46 -55 104t29 92t68 34q82 0 82 -74q0 -66 -52 -88q-27 -12 -26 -24q0 -16 21 -27q22 -10 53 -10q86 1 137 69t51 132q0 126 -113 124h-20q-41 0 -41 31t41 31z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E884[] =
+    "<symbol id=\"E884\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M348 268q14 0 21 17l37 116q6 20 22 39l131 142q25 26 51 26t25 -18q0 -6 -8 -39l-84 -266q-2 -17 10 -17h59q29 0 29 -28t-31 -29h-69q-16 0 -21 -16l-33 -103q-6 -27 9 -29l69 -6q27 -1 27 -29t-31 -28h-344q-31 0 -31 27t29 30l72 6q16 2 24 21l35 113q2 14 -10 14 h-279q-37 0 -37 27q0 14 21 34q131 131 207 241t110 226q8 23 27 23l98 -19l97 19q23 0 22 -17q0 -12 -10 -24q-74 -96 -194 -214t-185 -170t-66 -58q0 -10 17 -11h184z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E885[] =
+    "<symbol id=\"E885\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M264 758q26 0 68 -13t125 -13q82 0 143 18l51 14q19 0 19 -18t-27 -46q-123 -115 -276 -114q-13 0 -61 6t-56 -17l-31 -92q-4 -16 1 -23t40 3t84 10q215 0 215 -168q0 -143 -92 -232t-236 -89q-102 0 -156 46q-55 46 -55 104t29 92t67 34t60 -19t23 -55q0 -66 -52 -88 q-27 -12 -26 -24q0 -16 21 -27q22 -10 53 -10q90 0 144 88t54 184t-94 97q-61 0 -123 -62q-20 -20 -39 -20q-33 0 -33 30q1 12 9 39l112 330q13 35 39 35z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E886[] =
+    "<symbol id=\"E886\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M396 471q87 0 135 -50t49 -126q0 -147 -96 -229t-220 -82q-123 0 -184 66t-58 164q3 99 35 214q55 168 155 254t237 86q90 0 142 -41t52 -98t-28 -89q-27 -32 -67 -32t-66 22t-25 56q0 61 55 88q29 12 29 21q1 9 -21 17t-51 5q-152 -8 -242 -260q-8 -27 1 -34t24 5 q57 43 144 43zM338 397q-53 0 -97 -54t-61 -134q-35 -172 76 -172q61 0 110 77q48 77 48 180t-76 103z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E887[] =
+    "<symbol id=\"E887\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M428 559q-52 -1 -120 19q-67 20 -93 20q-59 0 -92 -98q-8 -27 -35 -27t-27 21q1 4 5 16l69 221q10 25 37 25t27 -19l-9 -41q0 -8 6 -8t27 23q59 51 115 51t116 -42q62 -42 100 -42t56 51q10 27 41 27t31 -23q0 -10 -4 -31q-47 -156 -166 -293t-159 -266q-15 -49 -34 -129 q-4 -23 -26 -22l-88 18l-94 -18q-31 0 -15 35q66 213 244 352q14 12 59 47t85 69t61 67q22 32 16 39t-18 -1q-63 -41 -115 -41z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E888[] =
+    "<symbol id=\"E888\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M428 719q-55 0 -90 -31t-35 -76q0 -46 22 -74t81 -71q27 -20 49 -8q80 55 80 151q-1 109 -107 109zM150 162q0 -53 32 -91t96 -38q66 0 106 36t40 84q0 49 -25 77t-108 92q-27 22 -47 10q-94 -57 -94 -170zM145 559q0 89 79 149t201 60t179 -48t58 -124q0 -111 -125 -176 q-13 -8 -21 -13q-14 -10 12 -42q54 -59 54 -157t-88 -161t-215 -63t-193 54t-66 140q0 137 148 197q29 12 31 21t-15 28q-39 45 -39 135z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E889[] =
+    "<symbol id=\"E889\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M268 281q-88 0 -136 50t-48 126q0 147 96 229t219 82t185 -66t58 -164q-3 -98 -36 -214q-55 -168 -155 -254t-236 -86q-90 0 -142 41q-53 41 -53 98t28 89t68 32t66 -22t25 -56q0 -61 -55 -88q-29 -12 -29 -22q-1 -10 21 -16q22 -7 51 -5q152 8 241 260q8 27 -1 34 t-23 -5q-56 -43 -144 -43zM326 354q53 0 97 54t60 135q35 172 -75 172q-62 0 -110 -77q-48 -76 -48 -180t76 -104z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E88A[] =
+    "<symbol id=\"E88A\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M164 381q-35 -1 -55 23q-21 24 -21 60t25 60t59 25q34 0 54 -24q22 -25 22 -59t-24 -60t-60 -25zM96 119q-35 -1 -55 23q-21 24 -21 60t25 60t59 25q34 0 55 -24q21 -25 21 -59t-24 -60q-25 -25 -60 -25z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E901[] =
+    "<symbol id=\"E901\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M469 172q0 -53 31 -131q12 12 17 15t50 3l115 -6q12 -49 12 -96q0 -125 -72 -211t-159 -92h-12q-63 0 -127 41q-63 41 -84 96q-35 95 -35 187t82 198t184 137l18 43q78 176 29 338q-27 100 -139 283q-29 -33 -117 -116t-141 -159t-58 -170q1 -74 49 -131t78 -57 q12 -8 12 -12t-10 -27t-26 -40t-27 -17q-23 10 -29 12q-5 2 -27 18q-78 55 -83 191v10q0 68 39 150q47 88 176 224t145 155l-59 100q-119 223 -119 387q0 88 22 146q22 59 50 110q66 115 199 135q10 2 30 2q135 0 135 -205q0 -141 -65 -360q-59 -176 -111 -260 q166 -293 166 -430q0 -100 -88 -291l-10 -20l25 2q66 0 122 -41q14 -14 -25 -71q-38 -58 -63 -58l-2 2h-4q-41 24 -94 26v-10zM555 1585q0 101 -43 159q-42 58 -110 58t-99 -30q-51 -52 -51 -160t30 -220t60 -162q30 -49 48 -76t32 -56l24 43q66 141 88 270t21 174zM412 37 q0 74 18 147q-78 -4 -125 -51v-39q0 -191 84 -255q68 -52 148 -52q29 0 49 4q10 0 10 52t-10 77q-2 8 -39 8l-74 -2q-20 0 -24 2q-37 35 -37 109z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E902[] =
+    "<symbol id=\"E902\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M541 338v-262q0 -6 -4 -6t-11 6q-49 49 -109 49t-96 -34t-36 -90t36 -90t94 -34t97 37q22 16 25 16l4 -6v-260q0 -39 -26 -76t-93 -41h-10q-145 0 -146 232v444q6 229 144 230h12q68 -4 94 -41t25 -74zM0 -129v221q0 8 3 22t41 44q38 29 131 12q22 -4 41 -24t20 -60v-526 q0 -33 -12 -33t-13 33v286q0 14 -18 25q-25 20 -63 20t-82 -15t-46 -15t-2 10z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E904[] =
+    "<symbol id=\"E904\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M442 369h17q25 0 24 -39v-2263q0 -25 -6 -31t-18 -6h-17q-16 0 -20 9t-4 28v1609q-16 47 -56 48h-247q-39 0 -47 -48v-36q0 -20 -25 -21h-18q-25 0 -25 21v708q0 20 25 21h18q25 0 25 -21v-20q8 -68 49 -68h239q53 0 62 80q1 29 24 29zM117 -109h239q53 0 62 76v78 q-16 47 -56 47h-247q-39 0 -47 -47v-86q8 -68 49 -68zM774 1190q0 20 21 20h26q20 0 21 -20v-631q19 -25 77 -126t69 -124t11 -36t-6 -25l-114 -195q-10 -20 2 -43q74 -133 94 -166t20 -59l-4 -25q-156 -299 -213 -344v-1585q0 -20 -20 -20h-27q-20 0 -20 20v1596 q-20 29 -81 135q-62 107 -72 118t-9 26q0 15 8 36l113 201q8 10 8 17t-8 17q-6 10 -64 112t-57 114l12 33l164 286q23 47 49 60v608zM672 276l125 -217l82 140l-127 213zM797 -422l82 139l-127 213l-80 -135z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E906[] =
+    "<symbol id=\"E906\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M150 125q-60 0 -97 -35t-37 -90t37 -90t94 -35t97 37q21 18 26 18l4 -6v-262q0 -37 -26 -74t-92 -41h-11q-145 0 -145 232v442q0 231 143 232h13q66 -4 92 -41t26 -74v-262q0 -6 -4 -6t-12 6q-48 49 -108 49z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E909[] =
+    "<symbol id=\"E909\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M51 1638q19 0 19 -34v-971q8 -68 51 -68h248q35 -1 46 19t15 57v465q0 23 6 29q7 6 21 6h18q25 0 25 -35v-2220q0 -23 -6 -29t-19 -6h-26q-19 0 -19 35v485q-8 78 -61 78h-238q-53 0 -61 -78v-975q0 -22 -6 -28t-20 -6h-26q-18 0 -18 34v3208q0 22 6 28t20 6h25z M131 -346h248q43 -1 51 67v54q-5 75 -55 75h-260q-41 -10 -45 -75v-45q8 -76 61 -76zM430 231v78q-14 47 -55 47h-256q-37 0 -49 -47v-73q8 -76 61 -76h248q37 0 47 47q4 16 4 24z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E938[] =
+    "<symbol id=\"E938\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M290 -289q-15 0 -24 8l-256 256q-10 9 -10 23t10 25l256 256q10 10 24 10t23 -10l256 -256q9 -7 9 -23t-9 -25l-256 -256q-8 -8 -23 -8z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E939[] =
+    "<symbol id=\"E939\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M291 -211l209 211l-209 209l-209 -209zM291 -289q-14 0 -23 8l-256 256q-10 7 -10 23t10 25l256 256q10 10 22 10t23 -10l256 -256q24 -24 0 -48l-256 -256q-8 -8 -22 -8z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E93C[] =
+    "<symbol id=\"E93C\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M655 0q0 -6 -4 -14l-303 -357q-6 -6 -16 -6t-17 6l-311 357q-4 8 -4 12t4 16l311 357q7 6 17 7t16 -7l303 -357q4 -8 4 -14zM379 -240l153 185l-245 297l-164 -187z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E93D[] =
+    "<symbol id=\"E93D\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M655 0q0 -6 -4 -14l-303 -357q-6 -6 -16 -6t-17 6l-311 357q-4 8 -4 15t4 13l311 357q7 6 17 7t16 -7l303 -357q4 -8 4 -14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E93E[] =
+    "<symbol id=\"E93E\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M33 0q-12 0 -23 9q-10 9 -10 24v1536q0 12 10 22q10 11 24 11t22 -10q9 -10 10 -23v-1536q0 -33 -33 -33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E93F[] =
+    "<symbol id=\"E93F\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M33 -1602q-13 0 -23 10t-10 23v1536q0 13 10 23t24 10t22 -10q9 -10 10 -23v-1536q0 -33 -33 -33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E949[] =
+    "<symbol id=\"E949\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M412 918q-16 0 -25 14l-321 520v-1419q0 -33 -33 -33q-12 0 -23 9q-10 9 -10 24v1536q0 25 25 30q2 0 8 3q18 -1 28 -17l381 -618q20 -27 -10 -45q-4 -4 -20 -4z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E94A[] =
+    "<symbol id=\"E94A\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -1569v1536q0 13 10 23t23 10q33 0 33 -33v-1419l321 520q9 14 25 14q36 0 37 -30q-1 -11 -7 -19l-381 -618q-11 -17 -32 -17l-4 3q-25 6 -25 30z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E94B[] =
+    "<symbol id=\"E94B\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M410 918q-14 0 -23 14l-321 522v-240l376 -604q19 -26 -10 -45q-6 -6 -20 -6t-25 16l-321 515v-1057q0 -33 -33 -33q-12 0 -23 9q-10 9 -10 24v1536q0 25 25 30l10 3q16 0 26 -17l381 -618q20 -27 -10 -45q-8 -4 -22 -4z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E94C[] =
+    "<symbol id=\"E94C\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M410 -918q38 0 39 -30q0 -10 -7 -19l-381 -618q-15 -24 -36 -14q-25 6 -25 30v1536q0 13 10 23t23 10q33 0 33 -33v-1057l321 515q11 16 25 16q36 0 37 -33q-1 -10 -7 -18l-376 -604v-240l321 522q9 14 23 14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E9F0[] =
+    "<symbol id=\"E9F0\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M301 991v-1982q0 -33 -33 -33h-32q-33 0 -33 33v1982q0 33 33 33h32q33 0 33 -33zM98 991v-1982q0 -33 -32 -33h-33q-33 0 -33 33v1982q0 33 33 33h33q32 0 32 -33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E9F1[] =
+    "<symbol id=\"E9F1\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M98 991v-1982q0 -33 -32 -33h-33q-33 0 -33 33v1982q0 33 33 33h33q32 0 32 -33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E9F2[] =
+    "<symbol id=\"E9F2\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M98 479v-958q0 -33 -32 -33h-33q-33 0 -33 33v958q0 33 33 33h33q32 0 32 -33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E9F3[] =
+    "<symbol id=\"E9F3\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M98 479v-446q0 -33 -32 -33h-33q-33 0 -33 33v446q0 33 33 33h33q32 0 32 -33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E9F4[] =
+    "<symbol id=\"E9F4\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M98 479v-190q0 -33 -32 -33h-33q-33 0 -33 33v190q0 33 33 33h33q32 0 32 -33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E9F5[] =
+    "<symbol id=\"E9F5\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M98 223v-190q0 -33 -32 -33h-33q-33 0 -33 33v190q0 33 33 33h33q32 0 32 -33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E9F6[] =
+    "<symbol id=\"E9F6\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M240 180q-6 0 -11 2l-131 45v-194q0 -33 -32 -33h-33q-33 0 -33 33v272q0 33 33 33h39q6 0 8 -2l182 -60q23 -6 23 -32l-2 -8l-11 -33q-8 -23 -32 -23z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E9F7[] =
+    "<symbol id=\"E9F7\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M213 338h39q33 0 33 -33v-272q0 -33 -33 -33h-33q-33 0 -33 33v194l-131 -45q-4 -2 -10 -2q-25 0 -33 23l-10 33l-2 8q0 26 23 32l182 60q2 2 8 2z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlBravura_E9F8[] =
+    "<symbol id=\"E9F8\" viewBox=\"0 0 2048 2048\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M250 338q33 0 33 -33v-272q0 -33 -33 -33h-33q-12 0 -22 9t-11 24v39l-131 -45q-5 -2 -19 -2t-22 22l-10 33q-2 4 -2 10q0 25 23 31l161 53v53l-131 -45q-4 -2 -10 -2q-23 0 -31 23l-10 33q-2 4 -2 10q0 25 23 30l180 60q2 2 14 2h33z\"/>\n"
+    "</symbol>\n";
+
+static const BuiltInGlyph glyphsBravura[] = {
+    { 0xE003, "E003", 2048, 0.0, 0.0, 960.0, 604.0, 960.0, xmlBravura_E003 },
+    { 0xE004, "E004", 2048, 0.0, -604.0, 960.9, 604.0, 960.0, xmlBravura_E004 },
+    { 0xE045, "E045", 2048, 23.0, -18.0, 2193.0, 923.0, 2215.0, xmlBravura_E045 },
+    { 0xE046, "E046", 2048, 23.0, -18.0, 2193.0, 923.0, 2217.0, xmlBravura_E046 },
+    { 0xE047, "E047", 2048, 8.0, -55.0, 1118.0, 1611.3, 1140.0, xmlBravura_E047 },
+    { 0xE048, "E048", 2048, -8.0, -324.0, 1964.0, 2163.0, 1953.0, xmlBravura_E048 },
+    { 0xE04B, "E04B", 2048, 2.0, -68.0, 821.8, 2179.0, 823.0, xmlBravura_E04B },
+    { 0xE050, "E050", 2048, 0.0, -1347.0, 1374.0, 3596.0, 1374.0, xmlBravura_E050 },
+    { 0xE051, "E051", 2048, 0.0, -1804.0, 1374.0, 4053.0, 1374.0, xmlBravura_E051 },
+    { 0xE052, "E052", 2048, 0.0, -1798.0, 1374.0, 4047.0, 1359.0, xmlBravura_E052 },
+    { 0xE053, "E053", 2048, 0.0, -1347.0, 1374.0, 4050.1, 1374.0, xmlBravura_E053 },
+    { 0xE054, "E054", 2048, 0.0, -1347.0, 1374.0, 4048.0, 1374.0, xmlBravura_E054 },
+    { 0xE05C, "E05C", 2048, 0.0, -1036.0, 1432.0, 2072.0, 1431.0, xmlBravura_E05C },
+    { 0xE05D, "E05D", 2048, 0.0, -1518.0, 1432.0, 2554.0, 1431.0, xmlBravura_E05D },
+    { 0xE062, "E062", 2048, -10.0, -1300.0, 1411.0, 1837.0, 1400.0, xmlBravura_E062 },
+    { 0xE063, "E063", 2048, -10.0, -1520.0, 1411.0, 2057.0, 1400.0, xmlBravura_E063 },
+    { 0xE064, "E064", 2048, -10.0, -1524.0, 1411.0, 2061.0, 1400.0, xmlBravura_E064 },
+    { 0xE065, "E065", 2048, -10.0, -1300.0, 1411.0, 2314.0, 1400.0, xmlBravura_E065 },
+    { 0xE066, "E066", 2048, -10.0, -1300.0, 1411.0, 2316.0, 1400.0, xmlBravura_E066 },
+    { 0xE069, "E069", 2048, 0.0, -512.0, 782.0, 1024.0, 782.0, xmlBravura_E069 },
+    { 0xE06A, "E06A", 2048, 0.0, -952.0, 639.1, 1896.0, 638.0, xmlBravura_E06A },
+    { 0xE080, "E080", 2048, 0.0, -512.0, 881.0, 1026.0, 880.0, xmlBravura_E080 },
+    { 0xE081, "E081", 2048, -2.1, -512.0, 602.1, 1026.0, 600.0, xmlBravura_E081 },
+    { 0xE082, "E082", 2048, 16.0, -526.0, 832.0, 1046.0, 851.0, xmlBravura_E082 },
+    { 0xE083, "E083", 2048, 8.0, -514.0, 780.0, 1024.0, 790.0, xmlBravura_E083 },
+    { 0xE084, "E084", 2048, 4.0, -512.0, 881.0, 1026.0, 886.0, xmlBravura_E084 },
+    { 0xE085, "E085", 2048, 0.0, -514.0, 743.0, 1018.0, 743.0, xmlBravura_E085 },
+    { 0xE086, "E086", 2048, -2.0, -510.0, 807.0, 1023.0, 804.0, xmlBravura_E086 },
+    { 0xE087, "E087", 2048, 0.0, -512.0, 821.0, 1022.0, 821.0, xmlBravura_E087 },
+    { 0xE088, "E088", 2048, -12.0, -530.0, 811.0, 1060.0, 798.0, xmlBravura_E088 },
+    { 0xE089, "E089", 2048, 0.0, -511.0, 807.0, 1023.0, 808.0, xmlBravura_E089 },
+    { 0xE08A, "E08A", 2048, 10.0, -510.0, 858.0, 1024.0, 868.0, xmlBravura_E08A },
+    { 0xE08B, "E08B", 2048, 0.0, -735.0, 855.1, 1474.0, 854.0, xmlBravura_E08B },
+    { 0xE0A2, "E0A2", 2048, 0.0, -256.0, 864.0, 512.0, 864.0, xmlBravura_E0A2 },
+    { 0xE0A3, "E0A3", 2048, 0.0, -256.0, 604.0, 512.0, 604.0, xmlBravura_E0A3 },
+    { 0xE0A4, "E0A4", 2048, 0.0, -256.0, 604.0, 512.0, 604.0, xmlBravura_E0A4 },
+    { 0xE0FA, "E0FA", 2048, 0.0, -256.0, 864.0, 512.0, 864.0, xmlBravura_E0FA },
+    { 0xE101, "E101", 2048, 0.0, -512.0, 1085.0, 1024.0, 1087.0, xmlBravura_E101 },
+    { 0xE220, "E220", 2048, -307.0, -190.0, 614.0, 383.0, 307.0, xmlBravura_E220 },
+    { 0xE221, "E221", 2048, -309.0, -383.0, 614.0, 766.0, 305.0, xmlBravura_E221 },
+    { 0xE222, "E222", 2048, -307.0, -573.0, 614.0, 1142.0, 307.0, xmlBravura_E222 },
+    { 0xE223, "E223", 2048, -307.0, -758.0, 614.0, 1524.0, 305.0, xmlBravura_E223 },
+    { 0xE224, "E224", 2048, -309.0, -942.0, 616.0, 1905.0, 305.0, xmlBravura_E224 },
+    { 0xE240, "E240", 2048, 0.0, -1659.3, 541.0, 1677.3, 540.0, xmlBravura_E240 },
+    { 0xE241, "E241", 2048, 0.0, -29.0, 627.0, 1685.9, 626.0, xmlBravura_E241 },
+    { 0xE260, "E260", 2048, 0.0, -358.0, 463.0, 1257.0, 462.0, xmlBravura_E260 },
+    { 0xE261, "E261", 2048, 0.0, -686.0, 344.0, 1384.1, 344.0, xmlBravura_E261 },
+    { 0xE262, "E262", 2048, 0.0, -713.0, 510.0, 1430.0, 509.0, xmlBravura_E262 },
+    { 0xE263, "E263", 2048, 0.0, -256.0, 506.0, 516.0, 0.0, xmlBravura_E263 },
+    { 0xE264, "E264", 2048, 0.0, -358.0, 842.0, 1253.0, 845.0, xmlBravura_E264 },
+    { 0xE265, "E265", 2048, 0.0, -713.0, 1063.0, 1430.0, 1071.0, xmlBravura_E265 },
+    { 0xE266, "E266", 2048, 0.0, -358.0, 1221.0, 1257.0, 1228.0, xmlBravura_E266 },
+    { 0xE267, "E267", 2048, 0.0, -686.0, 940.0, 1585.0, 940.0, xmlBravura_E267 },
+    { 0xE268, "E268", 2048, 0.0, -713.0, 985.0, 1430.0, 983.0, xmlBravura_E268 },
+    { 0xE269, "E269", 2048, 0.0, -713.0, 1063.0, 1430.0, 1062.0, xmlBravura_E269 },
+    { 0xE26A, "E26A", 2048, 0.0, -508.0, 289.0, 1014.0, 288.0, xmlBravura_E26A },
+    { 0xE26B, "E26B", 2048, 0.0, -508.0, 289.0, 1014.0, 288.0, xmlBravura_E26B },
+    { 0xE4A0, "E4A0", 2048, 0.0, 2.0, 695.0, 500.0, 694.0, xmlBravura_E4A0 },
+    { 0xE4A1, "E4A1", 2048, 0.0, -500.0, 695.0, 500.0, 694.0, xmlBravura_E4A1 },
+    { 0xE4A2, "E4A2", 2048, 0.0, 0.0, 172.0, 172.0, 172.0, xmlBravura_E4A2 },
+    { 0xE4A3, "E4A3", 2048, 0.0, -172.0, 172.0, 172.0, 249.0, xmlBravura_E4A3 },
+    { 0xE4A4, "E4A4", 2048, -2.0, 0.0, 694.0, 98.0, 692.0, xmlBravura_E4A4 },
+    { 0xE4A5, "E4A5", 2048, -2.0, -98.0, 694.0, 98.0, 692.0, xmlBravura_E4A5 },
+    { 0xE4A6, "E4A6", 2048, 2.0, -4.0, 203.0, 604.0, 208.0, xmlBravura_E4A6 },
+    { 0xE4A7, "E4A7", 2048, 2.0, -604.0, 203.0, 604.0, 208.0, xmlBravura_E4A7 },
+    { 0xE4A8, "E4A8", 2048, 2.0, 0.0, 180.0, 594.0, 182.0, xmlBravura_E4A8 },
+    { 0xE4A9, "E4A9", 2048, 2.0, -594.0, 180.0, 594.0, 182.0, xmlBravura_E4A9 },
+    { 0xE4AA, "E4AA", 2048, 0.0, 0.0, 98.0, 594.0, 98.0, xmlBravura_E4AA },
+    { 0xE4AB, "E4AB", 2048, 0.0, -594.0, 98.0, 594.0, 98.0, xmlBravura_E4AB },
+    { 0xE4AC, "E4AC", 2048, -2.0, -2.0, 483.0, 520.0, 483.0, xmlBravura_E4AC },
+    { 0xE4AD, "E4AD", 2048, -2.0, -520.0, 483.0, 520.0, 483.0, xmlBravura_E4AD },
+    { 0xE4AE, "E4AE", 2048, -2.0, 0.0, 483.0, 907.0, 483.0, xmlBravura_E4AE },
+    { 0xE4AF, "E4AF", 2048, -2.0, -928.0, 483.0, 928.0, 483.0, xmlBravura_E4AF },
+    { 0xE4B0, "E4B0", 2048, 0.0, 0.0, 695.0, 860.0, 696.0, xmlBravura_E4B0 },
+    { 0xE4B1, "E4B1", 2048, -2.0, -842.0, 695.0, 842.0, 694.0, xmlBravura_E4B1 },
+    { 0xE4B2, "E4B2", 2048, -2.0, 0.0, 694.0, 492.0, 694.0, xmlBravura_E4B2 },
+    { 0xE4B3, "E4B3", 2048, -2.0, -496.0, 694.0, 496.0, 692.0, xmlBravura_E4B3 },
+    { 0xE4B4, "E4B4", 2048, -2.0, 0.0, 697.0, 707.0, 694.0, xmlBravura_E4B4 },
+    { 0xE4B5, "E4B5", 2048, -2.0, -707.0, 697.0, 707.0, 694.0, xmlBravura_E4B5 },
+    { 0xE4B6, "E4B6", 2048, 0.0, 10.0, 477.0, 475.0, 481.0, xmlBravura_E4B6 },
+    { 0xE4B7, "E4B7", 2048, 8.0, -479.0, 475.0, 479.0, 487.0, xmlBravura_E4B7 },
+    { 0xE4B8, "E4B8", 2048, 0.0, 0.0, 782.0, 424.0, 782.0, xmlBravura_E4B8 },
+    { 0xE4B9, "E4B9", 2048, 2.0, -424.0, 782.0, 424.0, 784.0, xmlBravura_E4B9 },
+    { 0xE4BA, "E4BA", 2048, 2.0, 2.0, 750.0, 293.0, 751.0, xmlBravura_E4BA },
+    { 0xE4BB, "E4BB", 2048, 0.0, -293.0, 748.0, 293.0, 747.0, xmlBravura_E4BB },
+    { 0xE4BC, "E4BC", 2048, -2.0, 0.0, 694.0, 874.0, 692.0, xmlBravura_E4BC },
+    { 0xE4BD, "E4BD", 2048, -2.0, -878.0, 694.0, 878.0, 692.0, xmlBravura_E4BD },
+    { 0xE4C0, "E4C0", 2048, 6.0, -6.0, 1233.0, 680.0, 1239.0, xmlBravura_E4C0 },
+    { 0xE4C1, "E4C1", 2048, 6.0, -680.0, 1233.0, 680.0, 1239.0, xmlBravura_E4C1 },
+    { 0xE4C2, "E4C2", 2048, 0.0, 0.0, 1487.0, 920.0, 1505.0, xmlBravura_E4C2 },
+    { 0xE4C3, "E4C3", 2048, 0.0, -920.0, 1487.0, 920.0, 1505.0, xmlBravura_E4C3 },
+    { 0xE4C4, "E4C4", 2048, 0.0, 0.0, 1237.1, 698.0, 1234.0, xmlBravura_E4C4 },
+    { 0xE4C5, "E4C5", 2048, 0.0, -698.0, 1237.1, 698.0, 1234.0, xmlBravura_E4C5 },
+    { 0xE4C6, "E4C6", 2048, 0.0, -2.0, 1235.0, 684.0, 1239.0, xmlBravura_E4C6 },
+    { 0xE4C7, "E4C7", 2048, 0.0, -682.0, 1235.0, 684.0, 1239.0, xmlBravura_E4C7 },
+    { 0xE4C8, "E4C8", 2048, 0.0, 0.0, 1464.0, 836.0, 1466.0, xmlBravura_E4C8 },
+    { 0xE4C9, "E4C9", 2048, 0.0, -836.0, 1464.0, 836.0, 1466.0, xmlBravura_E4C9 },
+    { 0xE4CE, "E4CE", 2048, 2.0, 4.0, 309.0, 510.0, 313.0, xmlBravura_E4CE },
+    { 0xE4E5, "E4E5", 2048, 2.0, -768.0, 551.1, 1532.0, 552.0, xmlBravura_E4E5 },
+    { 0xE4E6, "E4E6", 2048, 0.0, -514.0, 506.0, 870.0, 0.0, xmlBravura_E4E6 },
+    { 0xE4E7, "E4E7", 2048, 0.0, -1024.0, 655.0, 1391.0, 655.0, xmlBravura_E4E7 },
+    { 0xE4E8, "E4E8", 2048, 0.0, -1024.0, 743.0, 1896.0, 743.0, xmlBravura_E4E8 },
+    { 0xE4E9, "E4E9", 2048, 0.0, -1542.0, 866.0, 2423.0, 868.0, xmlBravura_E4E9 },
+    { 0xE4EA, "E4EA", 2048, 0.0, -1536.0, 993.0, 2947.0, 993.0, xmlBravura_E4EA },
+    { 0xE500, "E500", 2048, 0.0, -512.0, 1090.0, 1083.0, 1091.0, xmlBravura_E500 },
+    { 0xE501, "E501", 2048, 0.0, -512.0, 1561.0, 1083.0, 1558.0, xmlBravura_E501 },
+    { 0xE502, "E502", 2048, 0.0, -512.0, 2523.0, 1083.0, 2525.0, xmlBravura_E502 },
+    { 0xE510, "E510", 2048, 0.0, -20.0, 791.0, 968.0, 790.0, xmlBravura_E510 },
+    { 0xE511, "E511", 2048, 0.0, -20.0, 1812.0, 968.0, 1812.0, xmlBravura_E511 },
+    { 0xE512, "E512", 2048, 0.0, -20.0, 1718.0, 968.0, 1718.0, xmlBravura_E512 },
+    { 0xE513, "E513", 2048, 0.0, -20.0, 1792.0, 968.0, 1792.0, xmlBravura_E513 },
+    { 0xE514, "E514", 2048, 0.0, -20.0, 1366.0, 964.0, 1366.0, xmlBravura_E514 },
+    { 0xE515, "E515", 2048, 0.0, -20.0, 2693.0, 964.0, 2693.0, xmlBravura_E515 },
+    { 0xE516, "E516", 2048, 0.0, -20.0, 2632.0, 964.0, 2631.0, xmlBravura_E516 },
+    { 0xE517, "E517", 2048, 8.0, -14.0, 1528.0, 962.0, 1536.0, xmlBravura_E517 },
+    { 0xE518, "E518", 2048, 8.0, -14.0, 2917.0, 962.0, 2924.0, xmlBravura_E518 },
+    { 0xE519, "E519", 2048, 8.0, -14.0, 2814.0, 962.0, 2822.0, xmlBravura_E519 },
+    { 0xE520, "E520", 2048, -182.0, -291.0, 932.0, 852.0, 747.0, xmlBravura_E520 },
+    { 0xE521, "E521", 2048, -41.0, -20.0, 954.0, 581.0, 894.0, xmlBravura_E521 },
+    { 0xE522, "E522", 2048, -289.0, -311.0, 1034.0, 1220.0, 745.0, xmlBravura_E522 },
+    { 0xE523, "E523", 2048, -41.0, 0.0, 609.0, 561.0, 567.0, xmlBravura_E523 },
+    { 0xE524, "E524", 2048, 0.0, -20.0, 469.0, 579.0, 468.0, xmlBravura_E524 },
+    { 0xE525, "E525", 2048, -61.0, -20.0, 561.0, 569.0, 499.0, xmlBravura_E525 },
+    { 0xE526, "E526", 2048, -47.0, -20.0, 678.6, 581.0, 630.0, xmlBravura_E526 },
+    { 0xE527, "E527", 2048, -209.0, -291.0, 4567.0, 852.0, 4349.0, xmlBravura_E527 },
+    { 0xE528, "E528", 2048, -209.0, -291.0, 3840.0, 852.0, 3637.0, xmlBravura_E528 },
+    { 0xE529, "E529", 2048, -209.0, -291.0, 3113.0, 852.0, 2902.0, xmlBravura_E529 },
+    { 0xE52A, "E52A", 2048, -188.0, -291.0, 2386.0, 852.0, 2195.0, xmlBravura_E52A },
+    { 0xE52B, "E52B", 2048, -168.0, -291.0, 1659.0, 852.0, 1488.0, xmlBravura_E52B },
+    { 0xE52C, "E52C", 2048, -41.0, -291.0, 1731.0, 852.0, 1691.0, xmlBravura_E52C },
+    { 0xE52D, "E52D", 2048, -41.0, -338.0, 1716.0, 1221.0, 1632.0, xmlBravura_E52D },
+    { 0xE52E, "E52E", 2048, -147.0, -311.0, 1724.0, 1220.0, 1576.0, xmlBravura_E52E },
+    { 0xE52F, "E52F", 2048, -276.0, -311.0, 1525.0, 1220.1, 1247.0, xmlBravura_E52F },
+    { 0xE530, "E530", 2048, -317.0, -311.0, 2017.0, 1220.1, 1701.0, xmlBravura_E530 },
+    { 0xE531, "E531", 2048, -317.0, -311.0, 2508.0, 1220.1, 2191.0, xmlBravura_E531 },
+    { 0xE532, "E532", 2048, -317.0, -311.0, 3000.0, 1220.1, 2682.0, xmlBravura_E532 },
+    { 0xE533, "E533", 2048, -317.0, -311.0, 3491.0, 1220.1, 3174.0, xmlBravura_E533 },
+    { 0xE534, "E534", 2048, -289.0, -311.0, 1557.0, 1220.0, 1267.0, xmlBravura_E534 },
+    { 0xE535, "E535", 2048, -289.0, -311.0, 1307.0, 1220.0, 1017.0, xmlBravura_E535 },
+    { 0xE536, "E536", 2048, 0.0, -311.0, 1237.0, 1220.0, 1236.0, xmlBravura_E536 },
+    { 0xE537, "E537", 2048, 0.0, -311.0, 1731.0, 1220.0, 1732.0, xmlBravura_E537 },
+    { 0xE538, "E538", 2048, 0.0, -311.0, 2456.0, 1220.0, 2453.0, xmlBravura_E538 },
+    { 0xE539, "E539", 2048, 0.0, -311.0, 1501.0, 1220.0, 1499.0, xmlBravura_E539 },
+    { 0xE53A, "E53A", 2048, 0.0, -311.0, 2204.0, 1220.0, 2201.0, xmlBravura_E53A },
+    { 0xE53B, "E53B", 2048, 0.0, -311.0, 1974.0, 1220.1, 1974.0, xmlBravura_E53B },
+    { 0xE53C, "E53C", 2048, -41.0, -311.0, 1321.0, 1220.0, 1280.0, xmlBravura_E53C },
+    { 0xE53D, "E53D", 2048, -41.0, -311.0, 1565.0, 1220.0, 1523.0, xmlBravura_E53D },
+    { 0xE566, "E566", 2048, 0.0, -20.0, 1067.0, 819.0, 1067.0, xmlBravura_E566 },
+    { 0xE567, "E567", 2048, 0.0, 0.0, 942.0, 446.0, 942.0, xmlBravura_E567 },
+    { 0xE568, "E568", 2048, -6.0, 0.0, 942.0, 446.0, 935.0, xmlBravura_E568 },
+    { 0xE56A, "E56A", 2048, 0.0, 0.0, 446.0, 942.0, 446.0, xmlBravura_E56A },
+    { 0xE56B, "E56B", 2048, -6.0, 0.0, 446.0, 942.0, 444.0, xmlBravura_E56B },
+    { 0xE56C, "E56C", 2048, 0.0, 0.0, 1485.0, 502.0, 1495.0, xmlBravura_E56C },
+    { 0xE56D, "E56D", 2048, 2.0, -150.0, 1491.0, 803.0, 1492.0, xmlBravura_E56D },
+    { 0xE56E, "E56E", 2048, 2.0, 0.0, 2015.0, 501.0, 2017.0, xmlBravura_E56E },
+    { 0xE610, "E610", 2048, 0.0, 0.0, 639.0, 651.0, 638.0, xmlBravura_E610 },
+    { 0xE611, "E611", 2048, 0.0, 0.0, 639.0, 651.0, 638.0, xmlBravura_E611 },
+    { 0xE612, "E612", 2048, 2.0, 2.0, 508.0, 1012.0, 0.0, xmlBravura_E612 },
+    { 0xE613, "E613", 2048, 2.0, 2.0, 508.0, 1012.0, 0.0, xmlBravura_E613 },
+    { 0xE614, "E614", 2048, 0.0, 0.0, 410.0, 410.0, 409.0, xmlBravura_E614 },
+    { 0xE650, "E650", 2048, 0.0, -16.0, 2087.0, 1153.0, 2086.0, xmlBravura_E650 },
+    { 0xE655, "E655", 2048, 0.0, 0.0, 922.0, 922.0, 921.0, xmlBravura_E655 },
+    { 0xE880, "E880", 2048, 0.0, -16.0, 651.0, 784.0, 653.0, xmlBravura_E880 },
+    { 0xE881, "E881", 2048, 20.0, 0.0, 504.0, 762.0, 503.0, xmlBravura_E881 },
+    { 0xE882, "E882", 2048, 20.0, -12.0, 654.0, 780.0, 653.0, xmlBravura_E882 },
+    { 0xE883, "E883", 2048, 20.0, -16.0, 607.0, 784.0, 606.0, xmlBravura_E883 },
+    { 0xE884, "E884", 2048, 20.0, 0.0, 621.0, 762.0, 620.0, xmlBravura_E884 },
+    { 0xE885, "E885", 2048, 20.0, -16.0, 650.0, 780.0, 649.0, xmlBravura_E885 },
+    { 0xE886, "E886", 2048, 21.9, -16.0, 621.1, 784.0, 622.0, xmlBravura_E886 },
+    { 0xE887, "E887", 2048, 61.0, -8.0, 621.0, 770.0, 620.0, xmlBravura_E887 },
+    { 0xE888, "E888", 2048, 20.0, -16.0, 642.0, 784.0, 641.0, xmlBravura_E888 },
+    { 0xE889, "E889", 2048, 20.0, -16.0, 622.2, 784.0, 622.0, xmlBravura_E889 },
+    { 0xE88A, "E88A", 2048, 20.0, 119.0, 228.0, 430.0, 227.0, xmlBravura_E88A },
+    { 0xE901, "E901", 2048, 0.0, -346.0, 694.0, 2234.0, 694.0, xmlBravura_E901 },
+    { 0xE902, "E902", 2048, 0.0, -473.0, 541.0, 926.0, 540.0, xmlBravura_E902 },
+    { 0xE904, "E904", 2048, 0.0, -2189.0, 999.0, 3399.0, 999.0, xmlBravura_E904 },
+    { 0xE906, "E906", 2048, 0.0, -453.0, 274.0, 906.0, 274.0, xmlBravura_E906 },
+    { 0xE909, "E909", 2048, 0.0, -1638.0, 500.0, 3276.0, 499.0, xmlBravura_E909 },
+    { 0xE938, "E938", 2048, 0.0, -289.0, 578.0, 578.0, 577.0, xmlBravura_E938 },
+    { 0xE939, "E939", 2048, 2.0, -289.0, 579.0, 578.0, 579.0, xmlBravura_E939 },
+    { 0xE93C, "E93C", 2048, 0.0, -377.0, 655.0, 755.1, 655.0, xmlBravura_E93C },
+    { 0xE93D, "E93D", 2048, 0.0, -377.0, 655.0, 755.1, 655.0, xmlBravura_E93D },
+    { 0xE93E, "E93E", 2048, 0.0, 0.0, 66.0, 1602.0, 65.0, xmlBravura_E93E },
+    { 0xE93F, "E93F", 2048, 0.0, -1602.0, 66.0, 1602.0, 65.0, xmlBravura_E93F },
+    { 0xE949, "E949", 2048, 0.0, 0.0, 450.0, 1602.0, 448.0, xmlBravura_E949 },
+    { 0xE94A, "E94A", 2048, 0.0, -1602.0, 449.0, 1602.0, 448.0, xmlBravura_E94A },
+    { 0xE94B, "E94B", 2048, 0.0, 0.0, 450.0, 1602.0, 448.0, xmlBravura_E94B },
+    { 0xE94C, "E94C", 2048, 0.0, -1601.9, 449.0, 1601.9, 448.0, xmlBravura_E94C },
+    { 0xE9F0, "E9F0", 2048, 0.0, -1024.0, 301.0, 2048.0, 301.0, xmlBravura_E9F0 },
+    { 0xE9F1, "E9F1", 2048, 0.0, -1024.0, 98.0, 2048.0, 98.0, xmlBravura_E9F1 },
+    { 0xE9F2, "E9F2", 2048, 0.0, -512.0, 98.0, 1024.0, 98.0, xmlBravura_E9F2 },
+    { 0xE9F3, "E9F3", 2048, 0.0, 0.0, 98.0, 512.0, 98.0, xmlBravura_E9F3 },
+    { 0xE9F4, "E9F4", 2048, 0.0, 256.0, 98.0, 256.0, 98.0, xmlBravura_E9F4 },
+    { 0xE9F5, "E9F5", 2048, 0.0, 0.0, 98.0, 256.0, 98.0, xmlBravura_E9F5 },
+    { 0xE9F6, "E9F6", 2048, 0.0, 0.0, 285.0, 338.0, 284.0, xmlBravura_E9F6 },
+    { 0xE9F7, "E9F7", 2048, 0.0, 0.0, 285.0, 338.0, 284.0, xmlBravura_E9F7 },
+    { 0xE9F8, "E9F8", 2048, 0.0, 0.0, 283.0, 338.0, 282.0, xmlBravura_E9F8 },
+};
+
+//----------------------------------------------------------------------------
+// Leipzig
+//----------------------------------------------------------------------------
+
+static const char xmlLeipzig_E003[] =
+    "<symbol id=\"E003\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -0c49 0 97.5 -2.26367 135.5 4.73633c206 95 258.5 264.264 263.5 271.264c0 1 -14 7 -15 6c-88 -154 -251 -167 -321 -170c-1 0 -63 -1 -63 -1v-111z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E004[] =
+    "<symbol id=\"E004\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 0c49 0 97.5 2.26367 135.5 -4.73633c206 -95 258.5 -264.264 263.5 -271.264c0 -1 -14 -7 -15 -6c-88 154 -251 167 -321 170c-1 0 -63 1 -63 1v111z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E045[] =
+    "<symbol id=\"E045\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M133 363c0 24 -18 26 -48 32v9h152c134 0 201 -55 201 -166c0 -48 -13 -91 -39 -128c-47 -65 -138 -110 -244 -110h-155v10c32 0 49 23 51 54l79 285l2 9zM366 249c0 90 -39 136 -128 136c-17 0 -32 -1 -38 -11l-90 -323l-2 -11c2 -15 17 -23 45 -23 c139 0 212 92 213 232zM704 384c-35 0 -64 -26 -64 -61c0 -17 5 -33 15 -47c20 -24 26 -31 48 -50c13 -16 36 -43 48 -59c12 -19 18 -38 18 -59c0 -26 -9 -46 -19 -65c-13 -19 -29 -33 -46 -42c-15 -10 -34 -15 -59 -15c-11 0 -28 4 -51 13c-16 4 -32 6 -42 11 c-7 0 -12 -3 -16 -9c-4 -1 -7 -6 -8 -14h-12l21 135h15l-3 -17c0 -15 3 -26 5 -37c4 -11 11 -21 22 -32c15 -19 35 -28 62 -28c24 0 42 8 54 24c16 15 24 34 24 55c0 20 -5 36 -14 48c-12 13 -20 25 -33 38c-5 5 -11 11 -17 18c-22 21 -38 40 -49 58c-11 13 -16 31 -16 54 c0 38 8 53 31 72c19 19 44 29 75 29c24 0 42 -2 54 -7c11 -7 21 -10 31 -10c7 0 15 6 24 17h13l-24 -119h-10c0 66 -26 99 -77 99zM430 0c-20 0 -32 12 -32 33s17 34 32 34c8 0 15 -4 21 -12c7 -4 10 -11 10 -22c0 -16 -13 -33 -31 -33zM829 -1c-20 0 -32 12 -35 29 c0 17 17 33 35 33c19 0 31 -12 31 -33c0 -18 -15 -29 -31 -29z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E046[] =
+    "<symbol id=\"E046\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M51 64l79 285l2 9l1 5c0 8 -2.667 14.333 -8 19s-18.667 9 -40 13v9h152c134 0 201 -55.333 201 -166c0 -48 -13 -90.667 -39 -128c-12.667 -17.3333 -28 -33 -46 -47s-38 -25.6667 -60 -35c-43.333 -18.6667 -89.333 -28 -138 -28h-155v10 c14.6667 0 26.3333 4.6667 35 14c4.6667 4.6667 8.3334 10.3333 11 17c2.6669 6.6667 4.3335 14.3334 5 23zM200 374l-90 -323l-2 -11c2 -15.3333 17 -23 45 -23c40 0 76.667 11.3333 110 34c16.667 10 31.333 21.6667 44 35s23.333 29 32 47c9.333 15.333 16 32.667 20 52 s6.333 40.667 7 64c0 45.333 -10.333 79.333 -31 102s-53 34 -97 34c-9.333 0 -17.333 -0.667 -24 -2s-11.333 -4.333 -14 -9zM890 404l-22 -125h-11c0 16 -2 30.667 -6 44s-10.333 25 -19 35c-18.667 17.333 -42.333 26 -71 26c-18.667 0 -36 -3 -52 -9s-31 -16 -45 -30 c-28.667 -24.667 -50 -56.334 -64 -95c-8.667 -20 -14.667 -38 -18 -54s-5.333 -34.333 -6 -55c0 -20 1.667 -37.333 5 -52c3.333 -14.6667 10 -28.6667 20 -42c16.667 -24.6667 42 -37 76 -37c28 0 54 5.6667 78 17c24 11.3333 47.667 30.3333 71 57l8 -10 c-46.667 -64 -103.667 -96 -171 -96c-30 0 -57.667 7.6667 -83 23c-10 7.33333 -19.667 16.3333 -29 27s-18 22.6667 -26 36c-12.667 26 -19 54.333 -19 85c0.002 42.667 11.335 84 34 124c24 38.667 55.333 71.333 94 98c40 23.333 81.333 35 124 35h18 c7.333 0 12.333 -0.667 15 -2l36 -7l28 -8l25 15h10zM398 33c0 11.3333 2.667 18.6667 8 22c8 8 16 12 24 12s15 -4 21 -12c6.667 -4 10 -11.3333 10 -22c0 -8.6667 -3.333 -16.3333 -10 -23c-4.667 -6.66667 -11.667 -10 -21 -10c-9.333 -4.76837e-07 -17 2.66667 -23 8 c-6 5.3333 -9 13.6667 -9 25zM871 28c0 11.3333 3.333 19 10 23c6 6.6667 13.667 10 23 10c8 0 16 -3 24 -9c4.667 -6 7 -14 7 -24c0 -8 -3 -14.6667 -9 -20c-5.34 -6 -12.674 -9 -22 -9c-10 0 -17.333 3 -22 9c-6 4.6667 -9.667 11.3333 -11 20z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E047[] =
+    "<symbol id=\"E047\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M108 474c-22 0 -38 -30 -38 -56c0 -54 73 -85 140 -116l138 205h41l-146 -221c41 -21 73 -44 96 -67c28 -29 42 -62 42 -97c0 -68 -54 -120 -124 -121c-40 0 -76 32 -76 72c0 22 21 38 43 38c23 0 34 -17 39 -38c6 -23 16 -34 31 -34c27 0 42 23 42 54c0 13 -3 23 -8 32 c-9 17 -33 36 -72 57l-60 30l-134 -208h-40l141 223c-49 23 -85 50 -109 80c-21 27 -32 55 -32 84c0 47 25 80 54 102c17 13 37 20 58 20c46 0 90 -32 91 -77c0 -22 -23 -35 -45 -36c-19 0 -30 8 -35 25l-7 23c-5 17 -15 26 -30 26zM75 192c0 -21 -16 -37 -36 -38 c-23 0 -37 13 -38 35c-1 21 14 39 35 39c22 0 38 -15 39 -36zM337 322c0 24 16 38 37 38c23 0 37 -19 37 -37c0 -23 -17 -37 -37 -37c-23 0 -37 17 -37 36z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E048[] =
+    "<symbol id=\"E048\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M537 233h-64c0 -16 -4 -40 -13 -73l-14 -39l-16 -31c-13 -17 -30 -40 -47 -53c-22 -17 -57 -27 -97 -37v-73h-35v73l-39 6c-9 1 -16 3 -23 6c-57 31 -89 74 -111 148l-11 39l-2 34h-65v40h65c0 34 2 43 12 73c6 24 18 52 30 70l23 30l24 25c21 16 30 23 61 28 c12 2 24 4 36 7v74h35v-74c21 -3 46 -4 61 -13c13 -5 25 -13 35 -22c16 -13 32 -32 48 -55c13 -23 43 -107 43 -143h64v-40zM370 273l-1 22l-2 37c0 17 -3 37 -9 58c-6 35 -38 81 -72 81v-198h84zM251 273v198c-15 0 -30 -9 -46 -26c-15 -19 -24 -36 -27 -52 c-3 -18 -5 -36 -8 -54l-1 -36c0 -13 -1 -23 -2 -30h84zM370 233h-84v-196c15 0 31 8 46 24c13 15 22 33 26 54l9 62zM251 37v196h-84v-21l2 -37c0 -42 13 -87 35 -114c15 -16 31 -24 47 -24z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E04B[] =
+    "<symbol id=\"E04B\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M187 643l66 -38v146l-66 37v-145zM320 572c29 8 60 36 60 72c0 27 -16 54 -34 63l-64 38v-148zM159 381v149l-37 22c-19 0 -28 -7 -39 -19c-15 -13 -22 -26 -22 -37c0 -36 18 -63 39 -78zM187 375l66 -36v144l-66 37v-145zM320 305c32 5 60 32 60 68c0 29 -12 51 -36 67 l-62 36v-146zM159 924v38h28v-53l66 -35v88h29v-99c33 -14 59 -28 78 -41c41 -25 79 -63 82 -126c0 -10 -2 -20 -5 -29l-6 -16c-5 -13 -11 -25 -18 -34c-6 -11 -17 -22 -26 -32l-31 -32c22 -12 39 -25 51 -39c13 -13 21 -27 25 -42c7 -13 10 -32 10 -56 c0 -56 -29 -100 -86 -131c27 -19 50 -38 67 -59s26 -45 27 -74c0 -41 -11 -69 -30 -95c-19 -29 -45 -51 -77 -67c-29 -13 -62 -22 -99 -24c-43 0 -57 4 -95 16c-47 13 -103 45 -105 96l2 13c5 25 19 37 42 37h13c15 -2 33 -17 54 -44c23 -30 38 -50 61 -65 c7 -4 26 -9 34 -12c4 -1 9 -2 16 -1c42 0 73 21 91 45c8 13 12 27 12 40l-3 22c-1 8 -4 16 -9 23c-17 31 -43 48 -75 65v-37h-29v53l-66 32v-85h-28v98l-50 26c-14 8 -43 27 -55 38c-15 12 -28 27 -37 44l-12 29c-2 8 -3 13 -3 16s0 8 -1 15l2 20c9 38 30 65 53 90l32 32 c-32 19 -55 39 -68 58c-13 21 -19 47 -19 78c0 33 8 59 23 78s37 38 66 56c-27 17 -49 37 -65 60s-24 53 -25 90c0 34 10 63 29 86c36 47 95 79 172 80c69 0 132 -21 169 -55c20 -18 30 -36 30 -54l-2 -15c-7 -29 -22 -44 -46 -44c-15 0 -27 4 -34 11c-10 10 -39 53 -54 69 c-7 7 -15 15 -25 23c-17 11 -39 18 -65 21c-31 0 -56 -8 -73 -23c-15 -15 -29 -30 -30 -57l1 -5c0 -46 51 -89 87 -105zM161 649v148l-37 23c-13 -2 -23 -6 -30 -13c-7 -10 -10 -16 -15 -28l-11 -30c0 -23 -1 -26 9 -40c7 -11 15 -20 23 -25z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E050[] =
+    "<symbol id=\"E050\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M441 -245c-23 -4 -48 -6 -76 -6c-59 0 -102 7 -130 20c-88 42 -150 93 -187 154c-26 44 -43 103 -48 176c-4 60 11 123 44 189c29 57 65 106 110 148s96 85 153 127c-3 16 -8 46 -13 92c-4 43 -5 73 -5 89c0 117 16 172 69 257c34 54 64 82 89 82c21 0 43 -30 69 -92 s39 -115 41 -159c2 -120 -19 -173 -67 -256c-13 -20 -63 -90 -98 -118c-13 -9 -25 -19 -37 -29l31 -181c8 1 18 2 28 2c58 0 102 -12 133 -35c59 -43 92 -104 98 -184c11 -135 -80 -229 -180 -270c8 -57 17 -110 25 -162c5 -31 6 -58 6 -80c0 -30 -5 -53 -14 -70 c-35 -64 -88 -99 -158 -103c-42 -3 -83 6 -124 26c-50 24 -77 59 -80 105c-2 34 5 63 20 87c18 28 45 42 79 44c51 4 99 -40 103 -87c4 -56 -30 -94 -105 -115c17 -24 51 -36 102 -36c62 0 116 43 140 85c9 16 13 41 13 74c0 20 -1 42 -5 67c-8 53 -18 106 -26 159zM461 939 c-95 0 -135 -175 -135 -286c0 -24 2 -48 5 -71c50 39 92 82 127 128c43 57 63 106 60 148c-4 54 -23 82 -57 81zM406 119l54 -326c80 27 116 88 109 184c-7 99 -62 146 -163 142zM382 117c-74 -2 -132 -50 -128 -127c2 -46 43 -99 75 -115c-3 -2 -7 -5 -10 -10 c-70 33 -116 88 -123 172c-5 73 42 135 88 170c23 17 49 29 78 36l-29 170c-21 -13 -52 -37 -92 -73c-50 -44 -86 -84 -109 -119c-49 -75 -71 -140 -67 -195c5 -68 35 -127 93 -176s125 -73 203 -73c25 0 50 3 75 9c-19 111 -36 221 -54 331z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E051[] =
+    "<symbol id=\"E051\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M220 -890c-31 4 -120 -9 -120 9c8 18 29 -7 47 30c8 16 40 97 39 97c0 0 2 5 2 9s-1 7 -7 7c-10 0 -14 -19 -34 -19c-6 0 -11 3 -11 8c0 2 0 3 2 6c6 7 80 93 87 99c1 1 3 2 4 3c-10 3 -19 8 -29 13c-50 24 -77 59 -80 105c-5 72 35 127 99 131c51 3 99 -40 103 -87 c4 -56 -30 -94 -105 -115c17 -24 51 -36 102 -36c62 0 116 43 140 85c9 16 13 41 13 74c0 20 -2 42 -5 67c-9 53 -18 106 -26 159c-23 -4 -48 -6 -76 -6c-59 0 -102 7 -130 20c-88 42 -150 93 -187 154c-26 44 -43 103 -48 176c-10 132 78 266 154 337c45 42 96 85 153 127 c-3 16 -8 46 -13 92c-4 43 -5 73 -5 89c0 117 16 172 69 257c34 54 64 81 89 82c21 0 43 -30 69 -92s39 -115 41 -159c2 -120 -19 -173 -67 -256c-13 -20 -63 -90 -98 -118c-13 -9 -25 -19 -37 -29l31 -181c8 1 18 2 28 2c58 0 102 -12 133 -35c59 -43 92 -104 98 -184 c11 -135 -80 -229 -180 -270c8 -57 17 -110 25 -162c4 -31 6 -58 6 -80c0 -30 -5 -53 -14 -70c-24 -45 -58 -75 -99 -91h9c34 0 67 1 67 -4c0 -22 -34 -34 -55 -38l-29 -6c-11 -2 -22 -4 -34 -7l-14 -3c-5 -4 -7 -19 -7 -26c0 -1 1 -3 4 -3c8 0 22 3 31 3 c24 0 31 -12 43 -12l3 -3c15 -11 23 -33 23 -55c0 -60 -58 -97 -112 -97c-31 0 -62 20 -62 58c0 13 5 23 16 29l7 2h4c14 0 24 -12 24 -26c0 -15 -14 -18 -17 -36c0 -11 17 -14 29 -14c15 1 40 10 60 67c5 14 7 24 7 32c0 28 -22 32 -33 32c-27 0 -47 -27 -57 -27 c-11 0 -11 4 -11 9c0 13 23 83 38 112c-8 0 -17 0 -25 1c-10 -26 -86 -197 -87 -205c0 -21 27 -11 27 -22c0 -5 -5 -9 -12 -9zM461 939c-95 0 -135 -175 -135 -286c0 -24 2 -48 5 -71c50 39 92 82 127 128c43 57 63 106 60 148c-4 54 -23 82 -57 81zM406 119l54 -326 c80 27 116 88 109 184c-8 99 -62 146 -163 142zM382 117c-74 -2 -132 -50 -128 -127c2 -46 43 -99 75 -115c-3 -2 -7 -5 -10 -10c-70 33 -116 88 -123 172c-5 73 42 135 88 170c23 17 49 29 78 36l-29 170c-21 -13 -52 -37 -92 -73c-50 -44 -86 -84 -109 -119 c-49 -75 -72 -140 -67 -195c5 -68 35 -127 93 -176s125 -73 203 -73c25 0 50 3 75 9c-19 111 -36 221 -54 331z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E052[] =
+    "<symbol id=\"E052\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M382 117c-74 -2 -132 -50 -128 -127c2 -46 43 -99 75 -115c-3 -2 -7 -5 -10 -10c-70 33 -116 88 -123 172c-5 73 42 135 88 170c23 17 49 29 78 36l-29 170c-21 -13 -52 -37 -92 -73c-50 -44 -86 -84 -109 -119c-49 -75 -71 -140 -67 -195c5 -68 35 -127 93 -176 s125 -73 203 -73c25 0 50 3 75 9c-19 111 -36 221 -54 331zM406 119l54 -326c80 27 116 88 109 184c-7 99 -62 146 -163 142zM461 939c-95 0 -135 -175 -135 -286c0 -24 2 -48 5 -71c50 39 92 82 127 128c43 57 63 106 60 148c-4 54 -23 82 -57 81zM441 -245 c-23 -4 -48 -6 -76 -6c-59 0 -102 7 -130 20c-88 42 -150 93 -187 154c-26 44 -43 103 -48 176c-4 60 11 123 44 189c29 57 65 106 110 148s96 85 153 127c-3 16 -8 46 -13 92c-4 43 -5 73 -5 89c0 117 16 172 69 257c34 54 64 82 89 82c21 0 43 -30 69 -92s39 -115 41 -159 c2 -120 -19 -173 -67 -256c-13 -20 -63 -90 -98 -118c-13 -9 -25 -19 -37 -29l31 -181c8 1 18 2 28 2c58 0 102 -12 133 -35c59 -43 92 -104 98 -184c11 -135 -80 -229 -180 -270c8 -57 17 -110 25 -162c5 -31 6 -58 6 -80c0 -30 -5 -53 -14 -70c-25 -46 -59 -77 -102 -92 c21 -1 85 -13 85 -60c0 -35 -22 -43 -31 -50c-6 -5 -8 -10 -8 -16s0 -11 4 -16c6 -11 9 -22 9 -34c0 -27 -18 -53 -46 -65c-11 -4 -27 -6 -41 -6c-34 0 -82 21 -90 58c-1 5 -2 8 -2 12c0 28 25 57 51 66c4 1 6 2 6 5c0 2 -1 3 -2 3c-11 13 -16 27 -16 41c0 21 11 40 30 51 h-5c-42 -3 -83 6 -124 26c-50 24 -77 59 -80 105c-2 34 5 63 20 87c18 28 45 42 79 44c51 4 99 -40 103 -87c4 -56 -30 -94 -105 -115c17 -24 51 -36 102 -36c62 0 116 43 140 85c9 16 13 41 13 74c0 20 -1 42 -5 67c-8 53 -18 106 -26 159zM315 -781c-3 -2 -6 -5 -7 -8 c-6 -8 -10 -19 -10 -30c0 -2 0 -4 1 -7c7 -32 34 -52 53 -52c20 0 37 20 37 36c0 5 -2 9 -4 14c-5 13 -14 24 -25 34c-6 5 -11 10 -17 14c-4 2 -9 6 -14 6c-6 0 -11 -3 -14 -7zM349 -685c0 -14 10 -25 18 -34c8 -8 16 -18 26 -25c5 -2 10 -4 13 -4c17 0 22 30 23 48 c0 9 -3 20 -9 26c-8 9 -23 14 -40 14c-15 -1 -29 -8 -31 -25z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E053[] =
+    "<symbol id=\"E053\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M382 117c-74 -2 -132 -50 -128 -127c2 -46 43 -99 75 -115c-3 -2 -7 -5 -10 -10c-70 33 -116 88 -123 172c-5 73 42 135 88 170c23 17 49 29 78 36l-29 170c-21 -13 -52 -37 -92 -73c-50 -44 -86 -84 -109 -119c-49 -75 -71 -140 -67 -195c5 -68 35 -127 93 -176 s125 -73 203 -73c25 0 50 3 75 9c-19 111 -36 221 -54 331zM406 119l54 -326c80 27 116 88 109 184c-7 99 -62 146 -163 142zM461 939c-95 0 -135 -175 -135 -286c0 -24 2 -48 5 -71c50 39 92 82 127 128c43 57 63 106 60 148c-4 54 -23 82 -57 81zM441 -245 c-23 -4 -48 -6 -76 -6c-59 0 -102 7 -130 20c-88 42 -150 93 -187 154c-26 44 -43 103 -48 176c-4 60 11 123 44 189c29 57 65 106 110 148s96 85 153 127c-3 16 -8 46 -13 92c-4 43 -5 73 -5 89c0 117 16 172 69 257c22 35 43 59 61 72c-29 7 -61 26 -67 55 c-1 5 -2 8 -2 12c0 28 25 57 51 66c4 1 6 2 6 5c0 2 -1 3 -2 3c-11 13 -16 27 -16 41c0 24 14 46 40 56c10 5 22 6 34 6h4c16 0 88 -10 88 -60c0 -35 -22 -43 -31 -50c-6 -5 -8 -10 -8 -16s0 -11 4 -16c6 -11 9 -22 9 -34c0 -27 -18 -53 -46 -65c-4 -1 -9 -3 -14 -4 c15 -14 30 -40 47 -81c26 -62 39 -115 41 -159c2 -120 -19 -173 -67 -256c-13 -20 -63 -90 -98 -118c-13 -9 -25 -19 -37 -29l31 -181c8 1 18 2 28 2c58 0 102 -12 133 -35c59 -43 92 -104 98 -184c11 -135 -80 -229 -180 -270c8 -57 17 -110 25 -162c5 -31 6 -58 6 -80 c0 -30 -5 -53 -14 -70c-35 -64 -88 -99 -158 -103c-42 -3 -83 6 -124 26c-50 24 -77 59 -80 105c-2 34 5 63 20 87c18 28 45 42 79 44c51 4 99 -40 103 -87c4 -56 -30 -94 -105 -115c17 -24 51 -36 102 -36c62 0 116 43 140 85c9 16 13 41 13 74c0 20 -1 42 -5 67 c-8 53 -18 106 -26 159zM405 1179c-3 -2 -6 -5 -7 -8c-6 -8 -10 -19 -10 -30c0 -2 0 -4 1 -7c7 -30 31 -50 50 -52c3 1 5 1 8 1h3c16 4 29 21 29 35c0 5 -2 9 -4 14c-5 13 -14 24 -25 34c-6 5 -11 10 -17 14c-4 2 -9 6 -14 6c-6 0 -11 -3 -14 -7zM439 1275 c0 -14 10 -25 18 -34c8 -8 16 -18 26 -25c5 -2 10 -4 13 -4c17 0 22 30 23 48c0 9 -3 20 -9 26c-8 9 -23 14 -40 14c-15 -1 -29 -8 -31 -25z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E054[] =
+    "<symbol id=\"E054\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M382 117c-74 -2 -132 -50 -128 -127c2 -46 43 -99 75 -115c-3 -2 -7 -5 -10 -10c-70 33 -116 88 -123 172c-5 73 42 135 88 170c23 17 49 29 78 36l-29 170c-21 -13 -52 -37 -92 -73c-50 -44 -86 -84 -109 -119c-49 -75 -71 -140 -67 -195c5 -68 35 -127 93 -176 s125 -73 203 -73c25 0 50 3 75 9c-19 111 -36 221 -54 331zM406 119l54 -326c80 27 116 88 109 184c-7 99 -62 146 -163 142zM461 939c-95 0 -135 -175 -135 -286c0 -24 2 -48 5 -71c50 39 92 82 127 128c43 57 63 106 60 148c-4 54 -23 82 -57 81zM441 1113 c0 16 8 27 23 31h4c14 0 24 -12 24 -26c0 -15 -14 -18 -17 -36c0 -11 17 -14 29 -14c15 1 40 10 60 67c5 14 7 24 7 32c0 28 -22 32 -33 32c-27 0 -47 -27 -57 -27c-11 0 -11 4 -11 9c0 16 36 123 48 125h65c34 0 67 1 67 -4c0 -22 -34 -34 -55 -38l-29 -6 c-11 -2 -22 -4 -34 -7l-14 -3c-5 -4 -7 -19 -7 -26c0 -1 1 -3 4 -3c8 0 22 3 31 3c24 0 31 -12 43 -12l3 -3c15 -11 23 -33 23 -55c0 -60 -58 -97 -112 -97c-7 0 -15 1 -22 3c11 -15 23 -38 35 -67c26 -62 39 -115 41 -159c2 -120 -19 -173 -67 -256 c-13 -20 -63 -90 -98 -118c-13 -9 -25 -19 -37 -29l31 -181c8 1 18 2 28 2c58 0 102 -12 133 -35c59 -43 92 -104 98 -184c11 -135 -80 -229 -180 -270c8 -57 17 -110 25 -162c5 -31 6 -58 6 -80c0 -30 -5 -53 -14 -70c-35 -64 -88 -99 -158 -103c-42 -3 -83 6 -124 26 c-50 24 -77 59 -80 105c-4 73 34 127 99 131c51 4 99 -40 103 -87c4 -56 -30 -94 -105 -115c17 -24 51 -36 102 -36c62 0 116 43 140 85c9 16 13 41 13 74c0 20 -1 42 -5 67c-8 53 -18 106 -26 159c-23 -4 -48 -6 -76 -6c-59 0 -102 7 -130 20c-88 42 -150 93 -187 154 c-26 44 -43 103 -48 176c-9 132 79 267 154 337c45 42 96 85 153 127c-3 16 -8 46 -13 92c-4 43 -5 73 -5 89c0 117 16 172 69 257c15 25 30 43 44 57c-36 1 -111 -8 -111 9c8 18 29 -7 47 30c8 16 40 97 39 97c0 0 2 5 2 9s-1 7 -7 7c-10 0 -14 -19 -34 -19 c-6 0 -11 3 -11 8c0 2 0 3 2 6c6 7 80 93 87 99s11 9 16 9c10 0 17 -11 33 -11c6 0 11 4 14 4c4 0 5 -1 5 -5v-4c-1 -7 -87 -200 -88 -208c0 -15 14 -14 22 -17c10 7 20 11 29 11h1c-5 8 -7 18 -7 30z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E05C[] =
+    "<symbol id=\"E05C\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 502h118v-502h-118v502zM175 0v-502h43v456c13 -7 25 -18 37 -29c10 -12 20 -24 27 -38c6 -14 10 -31 14 -49c3 -20 5 -41 5 -62c7 35 32 54 73 60c78 -19 99 -68 100 -165c0 -44 -9 -77 -31 -100c-18 -23 -41 -35 -69 -35c-43 0 -65 37 -66 84c7 -15 19 -18 39 -24 c6 0 10 2 16 4l17 10l10 14l7 18c-4 32 -23 48 -56 48c-56 0 -77 -39 -77 -98c10 -36 22 -65 53 -78c3 -3 22 -9 27 -11l34 -3l35 -2c120 0 190 61 190 178l3 33c0 52 -20 97 -60 134c-20 17 -45 29 -74 39c-31 9 -64 13 -101 13l-93 88v34v0l93 88c37 0 70 4 101 13 c29 10 54 22 74 39c40 37 60 82 60 134l-3 33c0 117 -70 178 -190 178l-35 -2l-34 -3c-5 -2 -24 -8 -27 -11c-9 -4 -16 -10 -23 -17c-17 -17 -22 -33 -30 -61c0 -59 21 -98 77 -98c33 0 52 16 56 48l-7 18l-10 14l-17 10c-6 2 -10 4 -16 4c-20 -6 -32 -9 -39 -24 c1 47 23 84 66 84c28 0 51 -12 69 -35c22 -23 31 -56 31 -100c-1 -97 -22 -146 -100 -165c-41 6 -66 25 -73 60c0 -21 -2 -42 -5 -62c-4 -18 -8 -35 -14 -49c-7 -14 -17 -26 -27 -38c-12 -11 -24 -22 -37 -29v456h-43v-502zM0 -502v502h118v-502h-118z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E05D[] =
+    "<symbol id=\"E05D\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M380 -545c0 27 -21 40 -49 40c-15 0 -31 -8 -31 -25c0 -14 10 -25 18 -34c8 -8 16 -18 26 -25c5 -2 10 -4 13 -4c17 0 23 30 23 48zM266 -626c-3 -2 -6 -5 -7 -8c-6 -8 -10 -19 -10 -30c0 -2 0 -4 1 -7c7 -32 34 -52 53 -52c20 0 37 20 37 36c0 5 -2 9 -4 14 c-7 19 -25 37 -42 48c-4 2 -9 6 -14 6c-6 0 -11 -3 -14 -7zM0 502h118v-1004h-118v1004zM321 -488h7c8 0 32 -3 53 -13l32 -1c120 0 190 61 190 178l3 33c0 52 -19 98 -60 134c-40 35 -101 52 -175 52l-93 88v34l93 88c74 0 135 17 175 52c41 36 60 82 60 134l-3 33 c0 117 -70 178 -190 178l-35 -2l-34 -3c-5 -2 -24 -8 -27 -11c-31 -13 -43 -42 -53 -78c0 -59 21 -98 77 -98c33 0 52 16 56 48l-7 18l-10 14l-17 10c-6 2 -10 4 -16 4c-20 -6 -32 -9 -39 -24c1 47 23 84 66 84c28 0 50 -13 69 -35c21 -24 31 -56 31 -100 c-1 -97 -22 -146 -100 -165c-41 6 -66 25 -73 60c0 -89 -26 -146 -83 -178v456h-43v-1004h43v456c57 -32 83 -89 83 -178c7 35 32 54 73 60c78 -19 99 -68 100 -165c0 -44 -10 -76 -31 -100c-19 -22 -41 -35 -69 -35c-43 0 -65 37 -66 84c7 -15 19 -18 39 -24c6 0 10 2 16 4 l17 10l10 14l7 18c-4 32 -23 48 -56 48c-56 0 -77 -39 -77 -98c10 -36 22 -65 53 -78c1 -1 2 -1 4 -2zM303 -735c-36 0 -92 24 -92 70c0 28 25 57 51 66c4 1 6 2 6 5c0 2 -1 3 -2 3c-11 13 -16 27 -16 41c0 34 29 61 71 62c6 -3 19 -8 23 -9l34 -3l3 -1c19 -9 35 -23 35 -47 c0 -35 -22 -43 -31 -50c-6 -5 -8 -10 -8 -16s1 -11 4 -16c7 -11 9 -22 9 -34c0 -27 -18 -53 -46 -65c-11 -4 -27 -6 -41 -6z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E062[] =
+    "<symbol id=\"E062\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M158 96c51 0 73 -14 88 -49l16 -39c0 -17 -2 -30 -7 -40c-3 -11 -10 -21 -19 -31c-17 -18 -49 -43 -84 -43c-55 0 -77 13 -112 44c-24 21 -35 55 -35 100c0 46 14 81 32 112c30 52 71 79 137 93l36 6l26 2c154 0 235 -68 274 -182c11 -32 18 -68 18 -107 c0 -103 -26 -182 -68 -250c-89 -145 -234 -230 -412 -288l-30 -5c-9 0 -14 3 -14 8c3 10 5 11 10 16c35 15 70 30 96 44l78 43c96 57 162 136 197 258c9 33 17 60 22 100c3 22 5 35 6 39c-7 69 -16 115 -23 140s-4 22 -16 40c-8 12 -19 23 -31 34c-24 21 -62 44 -118 44 c-48 0 -84 -8 -113 -28c-28 -19 -42 -44 -42 -73v-16c2 -5 3 -9 4 -11c24 22 52 39 84 39zM585 -118c0 32 23 58 57 58c18 0 33 -6 40 -18c9 -15 16 -18 16 -40c0 -9 -2 -16 -5 -21c-6 -19 -27 -37 -51 -37c-34 0 -57 26 -57 58zM642 177c31 0 56 -27 56 -58 c0 -30 -25 -58 -56 -58l-23 3c-19 7 -34 32 -34 55l3 23c9 20 28 35 54 35z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E063[] =
+    "<symbol id=\"E063\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M158 96c51 0 73 -14 88 -49l16 -39c0 -17 -2 -30 -7 -40c-3 -11 -10 -21 -19 -31c-17 -18 -49 -43 -84 -43c-55 0 -77 13 -112 44c-24 21 -35 55 -35 100c0 46 14 81 32 112c30 52 71 79 137 93l36 6l26 2c154 0 235 -68 274 -182c11 -32 18 -68 18 -107 c0 -103 -26 -182 -68 -250c-89 -145 -234 -230 -412 -288l-30 -5c-9 0 -14 3 -14 8c3 10 5 11 10 16c35 15 70 30 96 44l78 43c96 57 162 136 197 258c9 33 17 60 22 100c3 22 5 35 6 39c-7 69 -16 115 -23 140s-4 22 -16 40c-8 12 -19 23 -31 34c-24 21 -62 44 -118 44 c-48 0 -84 -8 -113 -28c-28 -19 -42 -44 -42 -73v-16c2 -5 3 -9 4 -11c24 22 52 39 84 39zM585 -118c0 32 23 58 57 58c18 0 33 -6 40 -18c9 -15 16 -18 16 -40c0 -9 -2 -16 -5 -21c-6 -19 -27 -37 -51 -37c-34 0 -57 26 -57 58zM642 177c31 0 56 -27 56 -58 c0 -30 -25 -58 -56 -58l-23 3c-19 7 -34 32 -34 55l3 23c9 20 28 35 54 35zM254 -752h-104c-5 0 -11 3 -11 9c2 5 3 8 11 8s18 3 18 3s9 2 17 18s36 93 36 93s2 5 2 9c0 3 -1 6 -6 6c-4 0 -8 -3 -12 -8s-11 -10 -20 -10c-7 0 -12 3 -12 8c0 2 0 3 2 5c6 7 78 90 83 95 c7 7 12 10 16 10s11 -4 16 -8c5 -3 9 -4 16 -4c5 0 10 4 13 4c4 0 5 -1 5 -4v-4c-2 -6 -83 -192 -84 -200c0 -6 4 -14 13 -14c6 0 12 -2 12 -7s-4 -9 -11 -9zM305 -669h4c13 0 23 -11 23 -25c0 -5 -2 -11 -5 -15c-5 -6 -10 -9 -12 -17v-2c0 -11 17 -14 26 -14h2 c15 0 38 10 58 65c4 13 6 22 6 31c0 26 -20 30 -32 30c-18 0 -38 -19 -46 -24c-2 -2 -5 -2 -8 -2c-4 0 -7 1 -7 1c-2 1 -3 4 -3 7c0 4 1 8 1 10c0 1 1 1 1 2c4 18 13 36 19 54c3 9 12 27 12 34c2 7 6 19 13 20h62s55 0 63 -1c1 0 1 -1 1 -2c0 -4 -5 -12 -6 -13 c-2 -4 -6 -7 -9 -9c-4 -3 -8 -6 -13 -8c-8 -3 -16 -5 -25 -7c-9 -1 -18 -3 -27 -5c-11 -3 -22 -3 -33 -7c-4 -1 -9 -2 -13 -4c-5 -3 -6 -11 -6 -17c-1 -2 -1 -4 -1 -6s0 -3 2 -4l1 -1c2 0 5 2 8 2c2 1 4 1 6 1c6 1 12 1 17 1c22 0 30 -5 41 -12l2 -2c11 -8 16 -19 20 -32 c2 -6 3 -14 3 -22s-1 -16 -2 -22c-5 -24 -25 -42 -46 -54c-17 -9 -39 -17 -59 -17c-15 0 -30 4 -41 13s-19 27 -19 43c0 12 5 23 16 28c2 1 4 1 6 2z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E064[] =
+    "<symbol id=\"E064\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M158 96c51 0 73 -14 88 -49l16 -39c0 -17 -2 -30 -7 -40c-3 -11 -10 -21 -19 -31c-17 -18 -49 -43 -84 -43c-55 0 -77 13 -112 44c-24 21 -35 55 -35 100c0 46 14 81 32 112c30 52 71 79 137 93l36 6l26 2c154 0 235 -68 274 -182c11 -32 18 -68 18 -107 c0 -103 -26 -182 -68 -250c-89 -145 -234 -230 -412 -288l-30 -5c-9 0 -14 3 -14 8c3 10 5 11 10 16c35 15 70 30 96 44l78 43c96 57 162 136 197 258c9 33 17 60 22 100c3 22 5 35 6 39c-7 69 -16 115 -23 140s-4 22 -16 40c-8 12 -19 23 -31 34c-24 21 -62 44 -118 44 c-48 0 -84 -8 -113 -28c-28 -19 -42 -44 -42 -73v-16c2 -5 3 -9 4 -11c24 22 52 39 84 39zM585 -118c0 32 23 58 57 58c18 0 33 -6 40 -18c9 -15 16 -18 16 -40c0 -9 -2 -16 -5 -21c-6 -19 -27 -37 -51 -37c-34 0 -57 26 -57 58zM642 177c31 0 56 -27 56 -58 c0 -30 -25 -58 -56 -58l-23 3c-19 7 -34 32 -34 55l3 23c9 20 28 35 54 35zM232 -572c0 33 29 59 71 59h5c15 0 84 -10 84 -57c0 -34 -21 -41 -30 -49c-6 -5 -8 -10 -8 -15s1 -10 4 -15c6 -10 8 -21 8 -32c0 -27 -16 -52 -43 -63c-12 -4 -27 -6 -39 -6c-35 0 -89 23 -89 67 c0 27 24 55 49 63c5 2 6 3 6 5s-1 3 -2 4c-11 11 -16 25 -16 39zM358 -567c0 25 -22 38 -46 38h-2c-15 -1 -28 -8 -30 -24v-2c0 -12 10 -23 17 -31c9 -9 23 -28 38 -28c17 0 22 29 23 44v3zM261 -638c-18 0 -29 -25 -29 -43v-7c7 -32 33 -50 51 -50c20 0 35 18 35 34 c0 5 -1 9 -3 13c-5 13 -13 24 -24 33c-5 5 -11 9 -16 14c-4 2 -9 6 -14 6z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E065[] =
+    "<symbol id=\"E065\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M642 177c31 0 56 -27 56 -58c0 -30 -25 -58 -56 -58l-23 3c-19 7 -34 32 -34 55l3 23c9 20 28 35 54 35zM585 -118c0 32 23 58 57 58c18 0 33 -6 40 -18c9 -15 16 -18 16 -40c0 -9 -2 -16 -5 -21c-6 -19 -27 -37 -51 -37c-34 0 -57 26 -57 58zM158 96c51 0 73 -14 88 -49 l16 -39c0 -17 -2 -30 -7 -40c-3 -11 -10 -21 -19 -31c-17 -18 -49 -43 -84 -43c-55 0 -77 13 -112 44c-24 21 -35 55 -35 100c0 46 14 81 32 112c30 52 71 79 137 93l36 6l26 2c34 0 65 -4 92 -10c-13 9 -23 22 -26 37c-1 5 -2 8 -2 12c0 28 25 57 51 66c4 1 6 2 6 5 c0 2 -1 3 -2 3c-11 13 -16 27 -16 41c0 24 14 46 40 56c10 5 22 6 34 6h4c16 0 88 -10 88 -60c0 -35 -22 -43 -31 -50c-6 -5 -8 -10 -8 -16s0 -11 4 -16c6 -11 9 -22 9 -34c0 -27 -18 -53 -46 -65c-11 -4 -27 -6 -41 -6h-5c61 -30 99 -82 123 -151c11 -32 18 -68 18 -107 c0 -103 -26 -182 -68 -250c-89 -145 -234 -230 -412 -288l-30 -5c-9 0 -14 3 -14 8c3 10 5 11 10 16c35 15 70 30 96 44l78 43c96 57 162 136 197 258c9 33 17 60 22 100c3 22 5 35 6 39c-7 69 -16 115 -23 140s-4 22 -16 40c-8 12 -19 23 -31 34c-24 21 -62 44 -118 44 c-48 0 -84 -8 -113 -28c-28 -19 -42 -44 -42 -73v-16c2 -5 3 -9 4 -11c24 22 52 39 84 39zM355 329c-3 -2 -6 -5 -7 -8c-6 -8 -10 -19 -10 -30c0 -2 0 -4 1 -7c7 -32 34 -52 53 -52c20 0 37 20 37 36c0 5 -2 9 -4 14c-5 13 -14 24 -25 34c-6 5 -11 10 -17 14 c-4 2 -9 6 -14 6c-6 0 -11 -3 -14 -7zM389 425c0 -14 10 -25 18 -34c8 -8 16 -18 26 -25c5 -2 10 -4 13 -4c17 0 22 30 23 48c0 9 -3 20 -9 26c-8 9 -23 14 -40 14c-15 -1 -29 -8 -31 -25z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E066[] =
+    "<symbol id=\"E066\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M642 177c31 0 56 -27 56 -58c0 -30 -25 -58 -56 -58l-23 3c-19 7 -34 32 -34 55l3 23c9 20 28 35 54 35zM585 -118c0 32 23 58 57 58c18 0 33 -6 40 -18c9 -15 16 -18 16 -40c0 -9 -2 -16 -5 -21c-6 -19 -27 -37 -51 -37c-34 0 -57 26 -57 58zM158 96c51 0 73 -14 88 -49 l16 -39c0 -17 -2 -30 -7 -40c-3 -11 -10 -21 -19 -31c-17 -18 -49 -43 -84 -43c-55 0 -77 13 -112 44c-24 21 -35 55 -35 100c0 46 14 81 32 112c28 49 94 81 152 96c8 17 0 -14 18 23c8 16 40 97 39 97c0 0 2 5 2 9s-1 7 -7 7c-10 0 -14 -19 -34 -19c-6 0 -11 3 -11 8 c0 2 0 3 2 6c6 7 80 93 87 99s11 9 16 9c10 0 17 -11 33 -11c6 0 11 4 14 4c4 0 5 -1 5 -5v-4c-1 -7 -87 -200 -88 -208c0 -6 2 -9 5 -11c22 -2 42 -4 61 -9c-12 10 -21 24 -21 44c0 13 5 23 16 29l7 2h4c14 0 24 -12 24 -26c0 -15 -14 -18 -17 -36c0 -11 17 -14 29 -14 c15 1 40 10 60 67c5 14 7 24 7 32c0 28 -22 32 -33 32c-27 0 -47 -27 -57 -27c-11 0 -11 4 -11 9c0 16 36 123 48 125h65c34 0 67 1 67 -4c0 -22 -34 -34 -55 -38l-29 -6c-11 -2 -22 -4 -34 -7l-14 -3c-5 -4 -7 -19 -7 -26c0 -1 1 -3 4 -3c8 0 22 3 31 3c24 0 31 -12 43 -12 l3 -3c15 -11 23 -33 23 -55c0 -60 -58 -97 -112 -97c69 -29 113 -84 138 -158c11 -32 18 -68 18 -107c0 -103 -26 -182 -68 -250c-89 -145 -234 -230 -412 -288l-30 -5c-9 0 -14 3 -14 8c3 10 5 11 10 16c35 15 70 30 96 44l78 43c96 57 162 136 197 258c9 33 17 60 22 100 c3 22 5 35 6 39c-7 69 -16 115 -23 140s-4 22 -16 40c-8 12 -19 23 -31 34c-24 21 -62 44 -118 44c-48 0 -84 -8 -113 -28c-28 -19 -42 -44 -42 -73v-16c2 -5 3 -9 4 -11c24 22 52 39 84 39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E069[] =
+    "<symbol id=\"E069\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M200 250h130v-500h-130v500zM0 250h130v-500h-130v500z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E06A[] =
+    "<symbol id=\"E06A\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 395h257v-791h-257v791zM41 311v-622h174v622h-174z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E080[] =
+    "<symbol id=\"E080\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M209 251zM210 -250c-99 0 -210 94 -210 251c0 152 93 250 209 250s205 -119 205 -250c0 -139 -103 -251 -204 -251zM119 1c0 -79 13 -215 88 -215c68 0 84 112 84 215c0 76 -15 216 -84 216c-68 0 -88 -136 -88 -216z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E081[] =
+    "<symbol id=\"E081\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M48 -250v36c23 0 40 6 49 18c8 14 12 33 12 57v250l-82 -129l-27 13l107 255h128v-394c0 -24 5 -42 14 -53s25 -17 47 -17v-36h-248z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E082[] =
+    "<symbol id=\"E082\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M104 -185c-18 0 -55 -14 -65 -65h-36l-3 29c0 25 6 46 18 64c11 19 22 30 39 43l121 82l37 29c15 11 27 29 38 54c12 24 18 47 18 70c0 40 -19 88 -94 88c-25 0 -32 0 -50 -8c-14 -5 -23 -12 -26 -22c3 -9 7 -15 10 -18l24 -17c12 -7 17 -11 27 -21c5 -7 7 -16 7 -27 c0 -12 0 -57 -79 -74c-30 0 -76 26 -76 94c0 66 80 135 196 135c72 0 182 -32 182 -150c0 -53 -32 -95 -113 -133l-91 -41c-26 -11 -45 -23 -57 -37l49 7c84 0 115 -41 148 -41c20 0 33 20 39 61h35c0 -152 -68 -168 -114 -168c-17 0 -55 0 -69 7v0l-28 17 c-49 37 -69 40 -87 42z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E083[] =
+    "<symbol id=\"E083\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M188 250c97 0 177 -52 177 -116c0 -69 -40 -111 -118 -125c56 -5 125 -44 125 -116c0 -31 -10 -57 -31 -78c-19 -21 -45 -38 -78 -49l-50 -11c-15 -3 -36 -7 -55 -7c-50 0 -86 16 -113 38c-16 10 -23 18 -34 34c-7 13 -11 25 -11 38c0 43 27 83 68 83l3 -2 c61 0 75 -42 75 -70c0 -19 -24 -42 -26 -57c7 -17 20 -25 37 -25c44 0 94 29 94 78c0 75 -34 125 -138 125v36c84 0 131 22 131 98c0 54 -37 88 -87 88c-26 0 -43 -7 -51 -22c15 -22 44 -16 44 -70c0 -37 -37 -62 -71 -62c-22 0 -69 15 -69 76c0 79 101 116 178 116z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E084[] =
+    "<symbol id=\"E084\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -78c84 97 114 180 134 329h170c-13 -32 -82 -132 -99 -151l-84 -97c-33 -36 -59 -63 -80 -81h162v102l127 123v-225h57v-39h-57v-34c0 -43 19 -65 57 -65v-34h-244v36c48 0 60 26 60 70v27h-203v39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E085[] =
+    "<symbol id=\"E085\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M141 38c-14 0 -56 -5 -92 -51h-32l5 263c55 -11 108 -18 158 -18c40 0 85 6 134 17c-8 -52 -39 -114 -159 -114l-50 2c-19 2 -31 4 -49 10l-5 -111c38 26 81 39 129 39c94 0 177 -64 177 -159c0 -100 -98 -166 -211 -166c-88 0 -146 53 -146 115c0 53 39 83 75 83 c37 0 69 -32 69 -72c0 -4 -1 -10 -4 -18l-27 -37c-2 -3 -3 -8 -3 -14c0 -15 12 -23 36 -23c74 0 92 77 92 132s-35 122 -97 122z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E086[] =
+    "<symbol id=\"E086\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M264 -91c0 37 -28 92 -67 92c-35 0 -65 -54 -65 -111c0 -52 22 -104 68 -104c47 0 64 68 64 123zM210 214c-36 0 -90 -33 -90 -184l2 -36c40 24 81 36 120 36c80 0 140 -48 140 -121c0 -99 -99 -159 -182 -159c-160 0 -200 173 -200 244c0 21 2 43 7 71l10 35 c26 85 73 115 98 126c41 19 74 24 103 24c93 0 142 -63 142 -105c0 -58 -52 -72 -73 -72c-33 0 -59 24 -65 35c-3 5 -6 14 -7 25l11 30c6 15 9 27 9 35c0 11 -9 16 -25 16z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E087[] =
+    "<symbol id=\"E087\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M330 125c-11 -9 -53 -46 -95 -46c-18 2 -33 8 -44 17c-17 19 -33 34 -48 45c-13 11 -27 17 -42 17c-23 0 -45 -22 -64 -66h-37v155h37c4 -18 11 -28 21 -30c8 1 15 3 22 8l10 5l14 10c3 2 14 6 21 7l11 2c8 1 33 1 42 1c39 0 57 -7 90 -43c11 -15 26 -23 44 -26 c27 3 45 29 54 70l38 -1c-1 -9 -11 -88 -29 -124c-5 -13 -12 -28 -21 -46l-33 -60c-55 -92 -69 -162 -69 -270h-174c0 45 11 86 33 122c23 35 59 74 106 117c99 84 113 96 113 136z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E088[] =
+    "<symbol id=\"E088\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M185 -214c76 0 88 58 90 68c0 34 -35 60 -57 73l-52 29c-21 10 -32 17 -34 20c-39 -33 -58 -54 -62 -92c5 -23 23 -98 115 -98zM291 135c0 61 -72 76 -113 76c-40 0 -77 -17 -77 -51c3 -21 15 -38 26 -50c17 -15 33 -26 48 -34l65 -28c34 27 51 56 51 87zM166 -250 c-57 0 -166 26 -166 132c0 47 30 86 89 116c-33 15 -79 60 -79 119c0 79 85 132 178 132h18c5 0 21 1 28 -1c25 0 126 -30 126 -110c0 -37 -23 -76 -69 -116c43 -25 83 -71 83 -119c0 -101 -118 -153 -208 -153z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E089[] =
+    "<symbol id=\"E089\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M119 107c0 -51 22 -104 66 -104c38 0 64 48 64 110c0 50 -31 100 -64 100c-40 0 -66 -56 -66 -106zM94 -74c40 0 72 -27 72 -65c0 -8 -3 -19 -9 -34l-7 -16l-5 -15c2 -8 12 -12 31 -12c56 0 84 73 84 219c-32 -24 -71 -36 -119 -36c-29 0 -56 6 -79 20 c-51 26 -57 78 -62 108c0 64 56 155 188 155c158 0 197 -151 197 -237c0 -145 -92 -263 -207 -263c-109 0 -155 68 -155 101c0 46 33 75 71 75z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E08A[] =
+    "<symbol id=\"E08A\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M340 179c-9 24 -56 41 -89 41c-46 0 -81 -28 -100 -58c-17 -28 -25 -78 -25 -150c0 -65 2 -111 8 -135c8 -31 18 -49 40 -67c20 -17 43 -25 70 -25c54 0 92 36 115 75c14 25 23 54 28 88h27c0 -63 -24 -105 -58 -141c-35 -38 -82 -56 -140 -56c-45 0 -83 13 -115 39 c-57 45 -101 130 -101 226c0 59 33 127 68 163c36 37 97 72 160 72c36 0 93 -21 121 -40c11 -8 23 -17 33 -30c19 -23 27 -48 27 -76c0 -51 -35 -88 -86 -88c-43 0 -76 27 -76 68c0 26 7 35 21 51c15 17 32 27 58 32c7 2 14 7 14 11z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E08B[] =
+    "<symbol id=\"E08B\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M188 200c-42 -22 -63 -69 -63 -141v-119c0 -39 7 -70 19 -94s26 -40 44 -48v402zM0 -0c0 127 80 220 186 246v72h32l-6 -72c33 0 71 0 101 -11c54 -20 102 -65 102 -135c0 -16 -4 -30 -13 -43s-20 -24 -32 -29l-20 -8l-23 -3c-22 2 -41 8 -55 21s-21 31 -26 51 c0 38 45 80 79 80c12 0 19 3 19 10c0 6 -6 12 -15 18c-19 13 -47 24 -79 24c-10 0 -20 -1 -32 -5v-431c15 -3 12 -4 30 -4c57 0 100 51 121 93l17 39c3 13 5 25 5 35h26c-6 -70 -28 -121 -66 -152s-82 -47 -133 -47v-68h-30v72c-57 10 -122 54 -153 109c-7 12 -13 26 -19 42 c-11 29 -16 61 -16 96z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E0A2[] =
+    "<symbol id=\"E0A2\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M198 133c102 0 207 -45 207 -133c0 -92 -98 -133 -207 -133c-101 0 -198 46 -198 133c0 88 93 133 198 133zM293 -21c0 14 -3 29 -8 44c-7 20 -18 38 -33 54c-20 21 -43 31 -68 31l-20 -2c-15 -5 -27 -14 -36 -28c-4 -9 -6 -17 -8 -24s-3 -16 -3 -27c0 -15 3 -34 9 -57 s18 -41 34 -55c15 -15 36 -23 62 -23c4 0 10 1 18 2c19 5 32 15 40 30s13 34 13 55z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E0A3[] =
+    "<symbol id=\"E0A3\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M96 -132zM200 138l41 -5c-2 0 -41 5 -41 5zM278 64c0 22 -17 39 -43 39c-12 0 -26 -3 -41 -10c-85 -43 -165 -94 -165 -156c5 -25 15 -32 49 -32c67 11 200 95 200 159zM0 -36c0 68 73 174 200 174c66 0 114 -39 114 -97c0 -84 -106 -173 -218 -173c-64 0 -96 32 -96 96z \"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E0A4[] =
+    "<symbol id=\"E0A4\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -39c0 68 73 172 200 172c66 0 114 -37 114 -95c0 -84 -106 -171 -218 -171c-64 0 -96 30 -96 94z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E0FA[] =
+    "<symbol id=\"E0FA\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M198 -133c-51.333 0 -95.667 10.667 -133 32c-43.3333 24 -65 57.6667 -65 101c-3.8147e-06 43.3333 21.3333 77.3333 64 102c37.333 20.667 82 31 134 31c52.667 0 98.667 -10.667 138 -32c46 -24 69 -57.6667 69 -101c0 -46 -23 -80.6667 -69 -104 c-36.667 -19.333 -82.667 -29 -138 -29z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E101[] =
+    "<symbol id=\"E101\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M508 242l-362 -484h-146l362 484h146z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E220[] =
+    "<symbol id=\"E220\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M-163 -124v83l326 166v-86z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E221[] =
+    "<symbol id=\"E221\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-163 -193v83l326 166v-86zM-163 -57v84l326 166v-83z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E222[] =
+    "<symbol id=\"E222\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M162 175l-324 -164v84l324 163v-83zM162 40l-324 -164v84l324 164v-84zM162 -95l-324 -163v83l324 164v-84z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E223[] =
+    "<symbol id=\"E223\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M162 108l-324 -164v84l324 163v-83zM162 -27l-324 -164v84l324 164v-84zM162 -162l-324 -163v83l324 164v-84zM162 242l-324 -164v84l324 164v-84z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E224[] =
+    "<symbol id=\"E224\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M162 41l-324 -164v84l324 163v-83zM162 -94l-324 -164v84l324 164v-84zM162 -229l-324 -163v83l324 164v-84zM162 310l-324 -164v84l324 163v-83zM162 175l-324 -164v84l324 164v-84z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E240[] =
+    "<symbol id=\"E240\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M206 -548c24 34 49 94 49 152c0 105 -80 173 -168 200c-18 5 -47 11 -87 18v176c16 -13 34 -28 53 -45c4 -3 38 -35 101 -94c62 -58 122 -137 122 -241c0 -37 -8 -74 -23 -111c-14 -35 -22 -53 -44 -79c-6 -5 -10 -7 -13 -7s-5 2 -5 5l4 10c1 3 5 9 11 16z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E241[] =
+    "<symbol id=\"E241\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M253 493c16 -37 23 -74 23 -111c0 -45 -12 -89 -35 -132c-20 -37 -49 -74 -87 -109c-48 -46 -104 -100 -154 -139v176c40 7 69 13 87 18c88 27 168 95 168 200c0 58 -24 118 -49 152c-5 7 -12 16 -15 26c0 3 2 5 5 5s7 -2 13 -7c19 -23 28 -43 44 -79z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E260[] =
+    "<symbol id=\"E260\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M20 110c32 16 54 27 93 27c26 0 35 -3 54 -13c13 -7 24 -20 27 -38l4 -25c0 -28 -16 -57 -45 -89c-23 -25 -39 -44 -65 -68l-88 -79v644h20v-359zM90 106c-32 0 -48 -10 -70 -29v-194c31 31 54 59 71 84c21 32 32 59 32 84c0 9 1 16 1 20c0 14 -3 21 -11 30l-8 3z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E261[] =
+    "<symbol id=\"E261\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -188v539h18v-191l139 22v-533h-17v186zM18 -100l122 17v176l-122 -19v-174z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E262[] =
+    "<symbol id=\"E262\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M136 186v169h17v-164l44 14v-91l-44 -14v-165l44 12v-91l-44 -13v-155h-17v150l-76 -22v-155h-17v149l-43 -13v90l43 14v167l-43 -14v92l43 13v169h17v-163zM60 73v-167l76 22v168z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E263[] =
+    "<symbol id=\"E263\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 120h74v-54l15 -17h79l15 16v55h74v-72h-59l-25 -28v-38l25 -32h59v-70h-75v55l-14 15h-80l-14 -15v-55h-74v72h60l26 30v38l-28 29h-58v71z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E264[] =
+    "<symbol id=\"E264\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M280 106c-32 0 -48 -10 -70 -29v-194c31 31 54 59 71 84c21 32 32 59 32 84c1 9 1 16 1 20c0 14 -3 21 -11 30l-8 3zM113 137c38 0 65 -13 77 -41v373h20v-359c32 16 54 27 93 27c26 0 35 -3 54 -13c13 -7 24 -20 27 -38l4 -25c0 -28 -16 -57 -45 -89 c-23 -25 -39 -44 -65 -68l-88 -79v199c-12 -28 -46 -63 -67 -87c-9 -11 -21 -22 -35 -33l-88 -79v644h20v-359c32 16 54 27 93 27zM90 106c-32 0 -48 -10 -70 -29v-194c31 31 54 59 71 84c21 32 32 59 32 84c1 9 1 16 1 20c0 14 -3 21 -11 30l-8 3z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E265[] =
+    "<symbol id=\"E265\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M414 186v169h17v-164l44 14v-91l-44 -14v-165l44 12v-91l-44 -13v-155h-17v150l-76 -22v-155h-17v149l-43 -13v90l43 14v167l-43 -14v92l43 13v169h17v-163zM338 73v-167l76 22v168zM0 120h74v-54l15 -17h79l15 16v55h74v-72h-59l-25 -28v-38l25 -32h59v-70h-75v55 l-14 15h-80l-14 -15v-55h-74v72h60l26 30v38l-28 29h-58v71z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E266[] =
+    "<symbol id=\"E266\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M280 106c-32 0 -48 -10 -70 -29v-194c31 31 54 59 71 84c21 32 32 59 32 84c1 9 1 16 1 20c0 14 -3 21 -11 30l-8 3zM303 137c38 0 65 -13 77 -41v373h20v-359c32 16 54 27 93 27c26 0 35 -3 54 -13c13 -7 24 -20 27 -38l4 -25c0 -28 -16 -57 -45 -89 c-23 -25 -39 -44 -65 -68l-88 -79v199c-12 -28 -46 -63 -67 -87c-9 -11 -21 -22 -35 -33l-88 -79v199c-12 -28 -46 -63 -67 -87c-9 -11 -21 -22 -35 -33l-88 -79v644h20v-359c32 16 54 27 93 27c38 0 65 -13 77 -41v373h20v-359c32 16 54 27 93 27zM470 106 c-32 0 -48 -10 -70 -29v-194c31 31 54 59 71 84c21 32 32 59 32 84c1 9 1 16 1 20c0 14 -3 21 -11 30l-8 3zM90 106c-32 0 -48 -10 -70 -29v-194c31 31 54 59 71 84c21 32 32 59 32 84c1 9 1 16 1 20c0 14 -3 21 -11 30l-8 3z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E267[] =
+    "<symbol id=\"E267\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -188v539h18v-191l139 22v-533h-17v186zM18 -100l122 17v176l-122 -19v-174zM200 110c32 16 54 27 93 27c26 0 35 -3 54 -13c13 -7 24 -20 27 -38l4 -25c0 -28 -16 -57 -45 -89c-23 -25 -39 -44 -65 -68l-88 -79v644h20v-359zM270 106c-32 0 -48 -10 -70 -29v-194 c31 31 54 59 71 84c21 32 32 59 32 84c0 9 1 16 1 20c0 14 -3 21 -11 30l-8 3z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E268[] =
+    "<symbol id=\"E268\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -188v539h18v-191l139 22v-533h-17v186zM18 -100l122 17v176l-122 -19v-174zM316 186v169h17v-164l44 14v-91l-44 -14v-165l44 12v-91l-44 -13v-155h-17v150l-76 -22v-155h-17v149l-43 -13v90l43 14v167l-43 -14v92l43 13v169h17v-163zM240 73v-167l76 22v168z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E269[] =
+    "<symbol id=\"E269\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M136 186v169h17v-164l44 14v-91l-44 -14v-165l44 12v-91l-44 -13v-155h-17v150l-76 -22v-155h-17v149l-43 -13v90l43 14v167l-43 -14v92l43 13v169h17v-163zM60 73v-167l76 22v168zM351 186v169h17v-164l44 14v-91l-44 -14v-165l44 12v-91l-44 -13v-155h-17v150l-76 -22 v-155h-17v149l-43 -13v90l43 14v167l-43 -14v92l43 13v169h17v-163zM275 73v-167l76 22v168z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E26A[] =
+    "<symbol id=\"E26A\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M163 -234v-13c0 -1 -1 -4 -1 -4c-2 0 -3 0 -3 1c-111 61 -159 149 -159 250c0 102 50 189 159 249v1c3 0 4 -2 4 -4v-11s0 -5 -3 -8c-67 -49 -101 -116 -101 -227s37 -177 100 -228c3 -1 4 -3 4 -6z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E26B[] =
+    "<symbol id=\"E26B\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -247v13c0 3 1 5 4 6c63 51 100 117 100 228s-34 178 -101 227c-3 3 -3 8 -3 8v11c0 2 1 4 4 4v-1c109 -60 159 -147 159 -249c0 -101 -48 -189 -159 -250c0 -1 -1 -1 -3 -1c0 0 -1 3 -1 4z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4A0[] =
+    "<symbol id=\"E4A0\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 236l347 -119l-347 -117v33l252 84l-252 86v33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4A1[] =
+    "<symbol id=\"E4A1\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -236l347 119l-347 117v-33l252 -84l-252 -86v-33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4A2[] =
+    "<symbol id=\"E4A2\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 45c0 13.333 4.33301 24.667 13 34s19.333 14.333 32 15c14 0 25.667 -4 35 -12s14.333 -19 15 -33c0 -13.333 -4.33301 -24.667 -13 -34s-19.333 -14.333 -32 -15c-14 0 -25.667 4 -35 12s-14.333 19 -15 33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4A3[] =
+    "<symbol id=\"E4A3\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -45c0 -13.333 4.33301 -24.667 13 -34s19.333 -14.333 32 -15c14 0 25.667 4 35 12s14.333 19 15 33c0 13.333 -4.33301 24.667 -13 34s-19.333 14.333 -32 15c-14 0 -25.667 -4 -35 -12s-14.333 -19 -15 -33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4A4[] =
+    "<symbol id=\"E4A4\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M0 0v33h347v-33h-347z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4A5[] =
+    "<symbol id=\"E4A5\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M0 0v-33h347v33h-347z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4A6[] =
+    "<symbol id=\"E4A6\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M110 224v5c3 4 -7 6 -19 10c-13.9424 4.64746 -24 4 -35 5c-13.5322 -1.54688 -27.5107 -2.65332 -42 -7c-10 -3 -11 -3 -14 -8v-5l55 -224z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4A7[] =
+    "<symbol id=\"E4A7\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M110 -224v-5c3 -4 -7 -6 -19 -10c-13.9424 -4.64746 -24 -4 -35 -5c-13.5322 1.54688 -27.5107 2.65332 -42 7c-10 3 -11 3 -14 8v5l55 224z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4A8[] =
+    "<symbol id=\"E4A8\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M153 224h-37c-10 -4 -18.667 -14 -26 -30c-3.33301 -7.33301 -8 -12 -14 -14c-4 1.33301 -10.667 10 -20 26c-4.66699 8.66699 -11.333 14.667 -20 18h-36l76 -224z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4A9[] =
+    "<symbol id=\"E4A9\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M153 -224h-37c-10 4 -18.667 14 -26 30c-3.33301 7.33301 -8 12 -14 14c-4 -1.33301 -10.667 -10 -20 -26c-4.66699 -8.66699 -11.333 -14.667 -20 -18h-36l76 224z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4AA[] =
+    "<symbol id=\"E4AA\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M0 0h33v240h-33v-240z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4AB[] =
+    "<symbol id=\"E4AB\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M0 0h33v-240h-33v240z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4AC[] =
+    "<symbol id=\"E4AC\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M273 0h-82l-84 154l-78 -154h-29l137 265z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4AD[] =
+    "<symbol id=\"E4AD\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M1 0h82l84 -154l78 154h29l-137 -265z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4AE[] =
+    "<symbol id=\"E4AE\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M273 110h-82l-84 154l-78 -154h-29l137 265zM87 45c0 13.333 4.33301 24.667 13 34c8.66699 9.33301 19.333 14.333 32 15c14 0 25.667 -4 35 -12s14.333 -19 15 -33c0 -13.333 -4.33301 -24.667 -13 -34s-19.333 -14.333 -32 -15c-14 0 -25.667 4 -35 12 c-9.33301 8 -14.333 19 -15 33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4AF[] =
+    "<symbol id=\"E4AF\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M187 -45c0 -13.333 -4.33301 -24.667 -13 -34s-19.333 -14.333 -32 -15c-14 0 -25.667 4 -35 12c-9.33301 8 -14.333 19 -15 33c0 13.333 4.33301 24.667 13 34c8.66699 9.33301 19.333 14.333 32 15c14 0 25.667 -4 35 -12s14.333 -19 15 -33zM1 -110h82l84 -154l78 154 h29l-137 -265z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4B0[] =
+    "<symbol id=\"E4B0\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M125 45c0 13.333 4.33301 24.667 13 34s19.333 14.333 32 15c14 0 25.667 -4 35 -12s14.333 -19 15 -33c0 -13.333 -4.33301 -24.667 -13 -34s-19.333 -14.333 -32 -15c-14 0 -25.667 4 -35 12s-14.333 19 -15 33zM0 346l347 -119l-347 -117v33l252 84l-252 86v33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4B1[] =
+    "<symbol id=\"E4B1\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M125 -45c0 -13.333 4.33301 -24.667 13 -34s19.333 -14.333 32 -15c14 0 25.667 4 35 12s14.333 19 15 33c0 13.333 -4.33301 24.667 -13 34s-19.333 14.333 -32 15c-14 0 -25.667 -4 -35 -12s-14.333 -19 -15 -33zM0 -346l347 119l-347 117v-33l252 -84l-252 -86v-33z \"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4B2[] =
+    "<symbol id=\"E4B2\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M125 45c0 13.333 4.33301 24.667 13 34s19.333 14.333 32 15c14 0 25.667 -4 35 -12s14.333 -19 15 -33c0 -13.333 -4.33301 -24.667 -13 -34s-19.333 -14.333 -32 -15c-14 0 -25.667 4 -35 12s-14.333 19 -15 33zM0 140v33h347v-33h-347z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4B3[] =
+    "<symbol id=\"E4B3\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M125 -45c0 -13.333 4.33301 -24.667 13 -34s19.333 -14.333 32 -15c14 0 25.667 4 35 12s14.333 19 15 33c0 13.333 -4.33301 24.667 -13 34s-19.333 14.333 -32 15c-14 0 -25.667 -4 -35 -12s-14.333 -19 -15 -33zM0 -140v-33h347v33h-347z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4B4[] =
+    "<symbol id=\"E4B4\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 308l347 -119l-347 -117v33l252 84l-252 86v33zM0 0v33h347v-33h-347z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4B5[] =
+    "<symbol id=\"E4B5\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -308l347 119l-347 117v-33l252 -84l-252 -86v-33zM0 0v-33h347v33h-347z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4B6[] =
+    "<symbol id=\"E4B6\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M190.212 112.43l3.53516 3.53613c4.9502 0.707031 -0.707031 9.19238 -6.36426 20.5059c-6.57227 13.1445 -14.1416 19.7988 -21.2129 28.2842c-10.6621 8.47461 -21.3291 17.5771 -34.6484 24.749c-9.19238 4.94922 -9.89941 5.65625 -15.5557 4.24219 l-3.53613 -3.53516l-112.43 -190.212z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4B7[] =
+    "<symbol id=\"E4B7\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M190.212 -112.43l3.53516 -3.53613c4.9502 -0.707031 -0.707031 -9.19238 -6.36426 -20.5059c-6.57227 -13.1445 -14.1416 -19.7988 -21.2129 -28.2842c-10.6621 -8.47461 -21.3291 -17.5771 -34.6484 -24.749c-9.19238 -4.94922 -9.89941 -5.65625 -15.5557 -4.24219 l-3.53613 3.53516l-112.43 190.212z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4B8[] =
+    "<symbol id=\"E4B8\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M5 166c10.667 -44 21.333 -74 32 -90c22 -34 54.667 -51 98 -51c42.667 0 75 17 97 51c12 18 22.667 48 32 90c0.666992 0 1.33301 0.333008 2 1c2.66699 -4.66699 4 -12 4 -22c0 -34 -8 -63.667 -24 -89c-24 -37.333 -61 -56 -111 -56s-86.667 18.667 -110 56 c-16.667 26.667 -25 57 -25 91c0 10.667 0.666992 17.333 2 20c1.33301 -0.666992 2.33301 -1 3 -1z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4B9[] =
+    "<symbol id=\"E4B9\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M5 -166c10.667 44 21.333 74 32 90c22 34 54.667 51 98 51c42.667 0 75 -17 97 -51c12 -18 22.667 -48 32 -90c0.666992 0 1.33301 -0.333008 2 -1c2.66699 4.66699 4 12 4 22c0 34 -8 63.667 -24 89c-24 37.333 -61 56 -111 56s-86.667 -18.667 -110 -56 c-16.667 -26.667 -25 -57 -25 -91c0 -10.667 0.666992 -17.333 2 -20c1.33301 0.666992 2.33301 1 3 1z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4BA[] =
+    "<symbol id=\"E4BA\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M15 77c23 -27 17.8555 -23.3115 36 -38c21 -17 28.6699 -13.5117 72 -14c17.1377 -0.193359 44.9053 -0.0791016 61 11c18.5107 12.7412 14 10 36 40c0.394531 0.537109 12.333 19.333 13 20c2.66699 -4.66699 -0.771484 -24.9385 -5 -34c-14 -30 4.20312 4.2041 -12 -21 c-24 -37.333 -43 -41 -93 -41s-77 3 -99 37c-16.3066 25.2012 0 0 -16 30c-6.7373 12.6328 -9.33301 26.333 -8 29c1.33301 -0.666992 14.5674 -18.4922 15 -19z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4BB[] =
+    "<symbol id=\"E4BB\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M15 -77c23 27 17.8555 23.3115 36 38c21 17 28.6699 13.5117 72 14c17.1377 0.193359 44.9053 0.0791016 61 -11c18.5107 -12.7412 14 -10 36 -40c0.394531 -0.537109 12.333 -19.333 13 -20c2.66699 4.66699 -0.771484 24.9385 -5 34c-14 30 4.20312 -4.2041 -12 21 c-24 37.333 -43 41 -93 41s-77 -3 -99 -37c-16.3066 -25.2012 0 0 -16 -30c-6.7373 -12.6328 -9.33301 -26.333 -8 -29c1.33301 0.666992 14.5674 18.4922 15 19z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4BC[] =
+    "<symbol id=\"E4BC\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 0v33h347v-33h-347zM310 85h-82l-84 154l-78 -154h-29l137 265z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4BD[] =
+    "<symbol id=\"E4BD\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M347 0v-33h-347v33h347zM37 -85h82l84 -154l78 154h29l-137 -265z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4C0[] =
+    "<symbol id=\"E4C0\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M605 21zM0 0c0 3 3 17 4 21c61 306 268 299 300 299c29 0 238 7 300 -299c1 -4 1 -18 1 -21h-32c-1 1 -4 22 -5 25c-10 38 -52 202 -265 202c-208 0 -252 -159 -264 -200c-1 -4 -6 -26 -6 -27h-33zM358 52c0 -30 -25 -55 -55 -55c-29 0 -54 25 -54 55c0 29 25 54 54 54 c30 0 55 -25 55 -54z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4C1[] =
+    "<symbol id=\"E4C1\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M605 -21zM0 0c0 -3 3 -17 4 -21c61 -306 268 -299 300 -299c29 0 238 -7 300 299c1 4 1 18 1 21h-32c-1 -1 -4 -22 -5 -25c-10 -38 -52 -202 -265 -202c-208 0 -252 159 -264 200c-1 4 -6 26 -6 27h-33zM358 -52c0 30 -25 55 -55 55c-29 0 -54 -25 -54 -55 c0 -29 25 -54 54 -54c30 0 55 25 55 54z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4C2[] =
+    "<symbol id=\"E4C2\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M389.65 288.425c0 0 -164.45 -171.5 -247 -253.399c-6.55859 -6.50684 -9.7002 -25.0537 -3.25 -29.9004c8.16504 -6.13574 7.14941 -4.5498 13.6494 -4.5498c8.24512 0 8.4502 1.9502 16.25 8.4502c6.13867 5.11426 26.6504 26 26.6504 26l194.35 179.399l-0.649414 -1 l200.85 -186.5c6.95898 -6.66113 19.9248 -20.6768 27.2998 -23.75c7.7998 -3.25 3.68359 -2.59961 12.3506 -2.59961c0 0 5.84961 3.25 8.44922 6.5c5.09082 6.36328 6.31934 22.8984 -3.25 31.8496c-20.1494 18.8506 -245.699 249.5 -245.699 249.5zM390 449 c0 0 -253 -270 -380 -396c-10.0894 -10.01 -14.9231 -38.5437 -5 -46c12.5624 -9.43948 11 -7 21 -7c12.6846 0 12.9998 3.00024 25 13c9.44336 7.86914 41 40 41 40l299 276h-1l309 -290c10.7061 -10.248 30.6533 -30.2725 42 -35c12 -5 5.66699 -4 19 -4c0 0 9 5 13 10 c7.83203 9.79004 9.72095 35.2288 -5 49c-31 29 -378 390 -378 390zM456 104c0 -16 -6 -29.667 -18 -41s-27.667 -17 -47 -17c-16 0 -30 5.66699 -42 17s-18.333 25 -19 41c0 14 5.66699 26.667 17 38s25 17.333 43 18c20 0 36.667 -5.66699 48 -17s17.333 -24.333 18 -39z \"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4C3[] =
+    "<symbol id=\"E4C3\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M389.65 -288.425c0 0 -164.45 171.5 -247 253.399c-6.55859 6.50684 -9.7002 25.0537 -3.25 29.9004c8.16504 6.13574 7.14941 4.5498 13.6494 4.5498c8.24512 0 8.4502 -1.9502 16.25 -8.4502c6.13867 -5.11426 26.6504 -26 26.6504 -26l194.35 -179.399l-0.649414 1 l200.85 186.5c6.95898 6.66113 19.9248 20.6768 27.2998 23.75c7.7998 3.25 3.68359 2.59961 12.3506 2.59961c0 0 5.84961 -3.25 8.44922 -6.5c5.09082 -6.36328 6.31934 -22.8984 -3.25 -31.8496c-20.1494 -18.8506 -245.699 -249.5 -245.699 -249.5zM390 -449 c0 0 -253 270 -380 396c-10.0898 10.0098 -14.9229 38.5439 -5 46c12.5625 9.43945 11 7 21 7c12.6846 0 13 -3 25 -13c9.44336 -7.86914 41 -40 41 -40l299 -276h-1l309 290c10.7061 10.248 30.6533 30.2725 42 35c12 5 5.66699 4 19 4c0 0 9 -5 13 -10 c7.83203 -9.79004 9.7207 -35.2285 -5 -49c-31 -29 -378 -390 -378 -390zM456 -104c0 16 -6 29.667 -18 41s-27.667 17 -47 17c-16 0 -30 -5.66699 -42 -17s-18.333 -25 -19 -41c0 -14 5.66699 -26.667 17 -38s25 -17.333 43 -18c20 0 36.667 5.66699 48 17 s17.333 24.333 18 39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4C4[] =
+    "<symbol id=\"E4C4\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M390 449c0 0 -253 -270 -380 -396c-10.0894 -10.01 -14.9231 -38.5437 -5 -46c12.5624 -9.43948 11 -7 21 -7c12.6846 0 12.9998 3.00024 25 13c9.44336 7.86914 41 40 41 40l299 276h-1l309 -290c10.7061 -10.248 30.6533 -30.2725 42 -35c12 -5 5.66699 -4 19 -4 c0 0 9 5 13 10c7.83203 9.79004 9.72095 35.2288 -5 49c-31 29 -378 390 -378 390zM456 104c0 -16 -6 -29.667 -18 -41s-27.667 -17 -47 -17c-16 0 -30 5.66699 -42 17s-18.333 25 -19 41c0 14 5.66699 26.667 17 38s25 17.333 43 18c20 0 36.667 -5.66699 48 -17 s17.333 -24.333 18 -39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4C5[] =
+    "<symbol id=\"E4C5\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M390 -449c0 0 -253 270 -380 396c-10.0898 10.0098 -14.9229 38.5439 -5 46c12.5625 9.43945 11 7 21 7c12.6846 0 13 -3 25 -13c9.44336 -7.86914 41 -40 41 -40l299 -276h-1l309 290c10.7061 10.248 30.6533 30.2725 42 35c12 5 5.66699 4 19 4c0 0 9 -5 13 -10 c7.83203 -9.79004 9.7207 -35.2285 -5 -49c-31 -29 -378 -390 -378 -390zM456 -104c0 16 -6 29.667 -18 41s-27.667 17 -47 17c-16 0 -30 -5.66699 -42 -17s-18.333 -25 -19 -41c0 -14 5.66699 -26.667 17 -38s25 -17.333 43 -18c20 0 36.667 5.66699 48 17 s17.333 24.333 18 39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4C6[] =
+    "<symbol id=\"E4C6\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M96 47c0 -14.667 -4.66699 -26 -14 -34s-20.333 -12.333 -33 -13c-13.333 0 -24.667 4 -34 12s-14 19.667 -14 35v344v1c0 14.1016 4.31445 25.1211 12.9414 33.0605c7.96387 8.65137 19.3164 13.2979 34.0586 13.9395h1h692 c0.296875 0 0.592773 -0.00585938 0.886719 -0.00585938c0.0380859 0 0.0751953 0.00585938 0.113281 0.00585938c3.54492 0 6.97363 -0.348633 10.2861 -1.04688c5.29297 -1.05273 10.0195 -2.89648 14.1797 -5.53418c2.60156 -1.53711 5.1123 -3.34277 7.53418 -5.41895 c9.33301 -8 14.333 -19.667 15 -35v-345c0 -14.667 -4.66699 -26 -14 -34s-20.333 -12.333 -33 -13c-13.333 0 -24.667 4 -34 12s-14 19.667 -14 35v297h-598v-297zM456 148c0 -16 -6 -29.667 -18 -41c-12 -11.333 -27.667 -17 -47 -17c-16 0 -30 5.66699 -42 17 c-12 11.333 -18.333 25 -19 41c0 14 5.66699 26.667 17 38s26 17.333 44 18c20 0 35.667 -5.66699 47 -17s17.333 -24.333 18 -39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4C7[] =
+    "<symbol id=\"E4C7\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M96 -47c0 14.667 -4.66699 26 -14 34s-20.333 12.333 -33 13c-13.333 0 -24.667 -4 -34 -12s-14 -19.667 -14 -35v-344v-1c0 -14.1016 4.31445 -25.1211 12.9414 -33.0605c7.96387 -8.65137 19.3164 -13.2979 34.0586 -13.9395h1h692 c0.296875 0 0.592773 0.00585938 0.886719 0.00585938c0.0380859 0 0.0751953 -0.00585938 0.113281 -0.00585938c3.54492 0 6.97363 0.348633 10.2861 1.04688c5.29297 1.05273 10.0195 2.89648 14.1797 5.53418c2.60156 1.53711 5.1123 3.34277 7.53418 5.41895 c9.33301 8 14.333 19.667 15 35v345c0 14.667 -4.66699 26 -14 34s-20.333 12.333 -33 13c-13.333 0 -24.667 -4 -34 -12s-14 -19.667 -14 -35v-297h-598v297zM456 -148c0 16 -6 29.667 -18 41c-12 11.333 -27.667 17 -47 17c-16 0 -30 -5.66699 -42 -17 c-12 -11.333 -18.333 -25 -19 -41c0 -14 5.66699 -26.667 17 -38s26 -17.333 44 -18c20 0 35.667 5.66699 47 17s17.333 24.333 18 39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4C8[] =
+    "<symbol id=\"E4C8\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M620.55 301.175c0.0488281 0.00390625 -0.0488281 -0.00390625 -0.0732422 -0.00390625c-0.191406 0 -0.383789 0.00390625 -0.576172 0.00390625h-449.801h-0.649414c-9.58301 -0.416992 -16.9619 -3.4375 -22.1387 -9.06055 c-5.60742 -5.16016 -8.41113 -12.3232 -8.41113 -21.4893v-0.650391v-237.6c0 -9.9668 3.0332 -17.5498 9.09961 -22.75s13.4336 -7.7998 22.0996 -7.7998c8.23438 0.433594 15.3838 3.25 21.4502 8.4502c6.06641 5.19922 9.10059 12.5664 9.10059 22.0996v207.05h388.699 v-207.05c0 -9.9668 3.03418 -17.5498 9.10059 -22.75s13.4336 -7.7998 22.0996 -7.7998c8.2334 0.433594 15.3838 3.25 21.4502 8.4502c6.06641 5.19922 9.09961 12.5664 9.09961 22.0996v238.25c0 9.9668 -2.09961 25.375 -15.0996 29.375 c-1.98186 0.609802 -17.4075 1.01822 -15.4502 1.1748zM96 47c0 -14.667 -4.66699 -26 -14 -34s-20.333 -12.333 -33 -13c-13.333 0 -24.667 4 -34 12s-14 19.667 -14 35v344v1c0 14.1016 4.31445 25.1211 12.9414 33.0605c7.96387 8.65137 19.3164 13.2979 34.0586 13.9395 h1h692c0.296875 0 0.592773 -0.00585938 0.886719 -0.00585938c0.0380859 0 0.0751953 0.00585938 0.113281 0.00585938c3.54492 0 6.97363 -0.348633 10.2861 -1.04688c5.29297 -1.05273 10.0195 -2.89648 14.1797 -5.53418 c2.60156 -1.53711 5.1123 -3.34277 7.53418 -5.41895c9.33301 -8 14.333 -19.667 15 -35v-345c0 -14.667 -4.66699 -26 -14 -34s-20.333 -12.333 -33 -13c-13.333 0 -24.667 4 -34 12s-14 19.667 -14 35v297h-598v-297zM456 148c0 -16 -6 -29.667 -18 -41 c-12 -11.333 -27.667 -17 -47 -17c-16 0 -30 5.66699 -42 17c-12 11.333 -18.333 25 -19 41c0 14 5.66699 26.667 17 38s26 17.333 44 18c20 0 35.667 -5.66699 47 -17s17.333 -24.333 18 -39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4C9[] =
+    "<symbol id=\"E4C9\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M620.55 -301.175c0.0488281 -0.00390625 -0.0488281 0.00390625 -0.0732422 0.00390625c-0.191406 0 -0.383789 -0.00390625 -0.576172 -0.00390625h-449.801h-0.649414c-9.58301 0.416992 -16.9619 3.4375 -22.1387 9.06055 c-5.60742 5.16016 -8.41113 12.3232 -8.41113 21.4893v0.650391v237.6c0 9.9668 3.0332 17.5498 9.09961 22.75s13.4336 7.7998 22.0996 7.7998c8.23438 -0.433594 15.3838 -3.25 21.4502 -8.4502c6.06641 -5.19922 9.10059 -12.5664 9.10059 -22.0996v-207.05h388.699 v207.05c0 9.9668 3.03418 17.5498 9.10059 22.75s13.4336 7.7998 22.0996 7.7998c8.2334 -0.433594 15.3838 -3.25 21.4502 -8.4502c6.06641 -5.19922 9.09961 -12.5664 9.09961 -22.0996v-238.25c0 -9.9668 -2.09961 -25.375 -15.0996 -29.375 c-1.98145 -0.609375 -17.4072 -1.01855 -15.4502 -1.1748zM96 -47c0 14.667 -4.66699 26 -14 34s-20.333 12.333 -33 13c-13.333 0 -24.667 -4 -34 -12s-14 -19.667 -14 -35v-344v-1c0 -14.1016 4.31445 -25.1211 12.9414 -33.0605 c7.96387 -8.65137 19.3164 -13.2979 34.0586 -13.9395h1h692c0.296875 0 0.592773 0.00585938 0.886719 0.00585938c0.0380859 0 0.0751953 -0.00585938 0.113281 -0.00585938c3.54492 0 6.97363 0.348633 10.2861 1.04688c5.29297 1.05273 10.0195 2.89648 14.1797 5.53418 c2.60156 1.53711 5.1123 3.34277 7.53418 5.41895c9.33301 8 14.333 19.667 15 35v345c0 14.667 -4.66699 26 -14 34s-20.333 12.333 -33 13c-13.333 0 -24.667 -4 -34 -12s-14 -19.667 -14 -35v-297h-598v297zM456 -148c0 16 -6 29.667 -18 41 c-12 11.333 -27.667 17 -47 17c-16 0 -30 -5.66699 -42 -17c-12 -11.333 -18.333 -25 -19 -41c0 -14 5.66699 -26.667 17 -38s26 -17.333 44 -18c20 0 35.667 5.66699 47 17s17.333 24.333 18 39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4CE[] =
+    "<symbol id=\"E4CE\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M90 166l-12 -2h-8c-20.6667 0 -37.3333 6.66667 -50 20c-12.6667 13.3333 -19.3333 28.6667 -20 46c0 19.3333 7.66667 35.6667 23 49c14 14 35 21 63 21c29.3333 0 52.3333 -10.3333 69 -31c16.6667 -20.6667 25 -46 25 -76c0 -20 -3 -39.3333 -9 -58 c-6 -18.6667 -15.6667 -37.6667 -29 -57c-24 -35.3333 -59.6667 -61.3333 -107 -78l-4 17c24 9.33333 42.6667 24 56 44c13.3333 20 20 40.6667 20 62c0 20 -5.66667 34.3333 -17 43z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4E5[] =
+    "<symbol id=\"E4E5\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M107 292c-13 24 -30 49 -52 71c-1 1 0 2 0 3l-2 2c3 3 4 4 6 4c12 0 26 -7 40 -20s44 -40 89 -81c26 -24 28 -29 46 -47c4 -4 8 -9 10 -14c6 -8 8 -16 8 -27c0 -19 -12 -40 -36 -61c-28 -23 -49 -38 -61 -73c-4 -11 -7 -27 -10 -50c13 -43 34 -83 59 -121 c31 -47 59 -79 101 -129c-8 0 -26 7 -54 20l-62 29l-21 6l-23 1c-25 0 -45 -10 -60 -30l-4 -14l-1 -12c0 -33 20 -56 39 -78c8 -9 17 -18 26 -26c17 -15 27 -24 28 -30l-3 -3c-11 5 -19 10 -25 15c-9 3 -37 21 -45 26c-24 14 -45 32 -63 51c-19 21 -37 44 -37 71 c0 63 27 95 80 95c41 0 86 -18 136 -52c-19 26 -37 48 -55 66c-23 23 -48 44 -73 65c-28 23 -47 40 -58 53s-17 26 -18 39c75 64 113 125 113 183c0 27 -7 48 -18 68z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4E6[] =
+    "<symbol id=\"E4E6\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 123c7 34 33 56 69 60c29 -3 43 -9 53 -29c4 -8 7 -15 10 -22c0 -21 -1 -25 -11 -35c-5 -8 -18 -14 -40 -20l12 -3l15 -1c44 0 97 26 122 56c10 11 18 26 24 42c7 1 15 2 22 3l-140 -424h-36l111 330c-10 -6 -27 -12 -53 -16l-52 -8h-10l-20 1c-1 0 -8 3 -21 6 c-37 9 -55 28 -55 60z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4E7[] =
+    "<symbol id=\"E4E7\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M133 -111c-16 38 -21 43 -64 51c-37 -4 -60 -25 -68 -60c0 -32 18 -52 55 -58c8 -6 22 -10 43 -10c31 0 62 7 82 20l-108 -324h37c72 220 143 439 215 659h-4l-10 -2l-7 -1c-15 -35 -27 -52 -59 -71c-26 -15 -56 -27 -88 -29c-11 0 -20 2 -26 6c29 3 56 25 51 56 c-15 35 -19 42 -64 48c-38 -4 -60 -23 -68 -58c0 -32 18 -52 55 -59c7 -5 22 -8 45 -8c48 0 76 7 112 25l-66 -197c-21 -23 -50 -47 -90 -47c-7 0 -15 1 -25 4c31 5 52 22 52 55z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4E8[] =
+    "<symbol id=\"E4E8\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M148 179c-37 0 -60 -24 -68 -58c0 -32 18 -52 54 -61c12 -6 28 -9 46 -9c33 0 59 9 81 21l-61 -187c-3 -6 -12 -14 -30 -26c-22 -15 -43 -22 -61 -22c-10 0 -19 1 -25 4c24 6 40 15 47 26c3 5 4 15 4 29c-7 20 -15 34 -25 40c-5 3 -18 6 -38 10c-37 -4 -60 -23 -68 -58 c0 -38 20 -53 55 -61c12 -6 30 -9 52 -9c30 0 54 6 71 17l18 50l-123 -370h37l288 889l-4 1l-18 -2c-12 -49 -54 -77 -101 -92c-16 -5 -31 -8 -45 -8c-11 0 -19 2 -24 6c34 8 51 18 51 55c-8 28 -28 49 -61 49c-39 0 -63 -26 -72 -59c0 -33 19 -52 56 -59c6 -3 13 -5 23 -6 l28 -2h15c6 0 17 4 35 8c22 5 43 6 55 17l-66 -198c-17 -20 -53 -45 -88 -45c-8 0 -16 2 -24 5c23 6 35 13 39 18c6 9 10 19 10 30c0 33 -29 57 -63 57z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4E9[] =
+    "<symbol id=\"E4E9\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M191 -247l61 184zM273 652c-33 0 -66 -25 -66 -58c0 -32 18 -52 54 -60c11 -7 27 -8 45 -8c31 0 93 14 112 24l-62 -191c-24 -25 -50 -50 -91 -50c-8 0 -15 1 -23 3c33 11 48 18 48 55c-13 38 -19 45 -64 50c-36 -4 -59 -23 -69 -58c0 -34 19 -54 56 -61 c9 -4 23 -7 41 -7c28 0 56 6 84 18l-61 -187c-24 -24 -50 -44 -89 -46c-9 0 -17 0 -25 3c23 8 39 16 45 25c4 5 5 15 5 30c-12 37 -22 43 -63 51c-39 -5 -68 -25 -68 -60c0 -31 19 -49 53 -58c15 -4 28 -9 49 -9c35 0 52 5 78 19l-63 -189c-30 -31 -60 -46 -90 -46 c-7 0 -15 2 -23 5c35 11 51 17 51 56c-13 36 -23 41 -64 49c-39 -4 -68 -24 -68 -61c0 -34 25 -52 55 -58c9 -5 23 -7 43 -7c37 0 57 5 84 19c-38 -106 -72 -216 -108 -324h34c47 139 93 277 139 416c77 236 153 473 231 708l-7 1l-7 -4h-6c-14 -32 -35 -57 -63 -73 s-57 -25 -85 -26l-14 1c-2 1 -4 2 -6 2s-4 1 -7 2c37 8 49 18 50 57c-9 32 -25 47 -65 47z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E4EA[] =
+    "<symbol id=\"E4EA\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M379 567c29 5 52 22 52 54c0 36 -31 53 -66 56c-39 -6 -63 -27 -71 -63c0 -32 19 -52 56 -61c14 -7 22 -7 44 -7c37 0 93 13 119 24l-65 -198c-24 -27 -51 -52 -92 -52c-9 0 -18 1 -29 5c38 8 54 17 54 57c-13 36 -26 45 -66 53c-39 -7 -63 -28 -71 -62 c0 -32 19 -53 57 -62l18 -7c5 -1 17 -1 33 -1c39 0 57 4 79 20l-64 -194c-17 -22 -57 -49 -94 -50c-8 0 -17 2 -25 5c36 7 53 20 53 58c-13 38 -22 43 -65 51c-42 -5 -60 -25 -71 -61c0 -32 19 -53 57 -62c9 -4 36 -7 49 -8c37 0 56 5 79 21l-62 -197 c-27 -26 -53 -46 -93 -48c-9 0 -19 4 -26 6c35 9 53 18 53 57c-15 38 -20 47 -66 52c-38 -5 -60 -28 -68 -63c0 -32 18 -52 54 -60c13 -7 29 -9 52 -9c32 0 57 8 78 22l-65 -196c-24 -26 -51 -46 -91 -48c-10 0 -18 0 -25 3c36 12 51 18 53 57c-10 38 -26 47 -67 53 c-39 -6 -62 -27 -70 -62c0 -33 19 -54 58 -62l17 -6c2 -1 8 0 18 0c34 0 71 6 93 19c-37 -111 -73 -223 -109 -335h35c126 384 253 768 378 1153l82 247h-6l-9 -2h-8c-9 -34 -33 -58 -61 -74c-32 -18 -61 -28 -89 -28c-12 0 -14 2 -27 5z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E500[] =
+    "<symbol id=\"E500\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M508 242l-362 -484h-146l362 484h146zM52 118c0 13.333 4.333 24.667 13 34s19.333 14.333 32 15c14 0 25.667 -4 35 -12s14.333 -19 15 -33c0 -13.333 -4.333 -24.667 -13 -34s-19.333 -14.333 -32 -15c-14 0 -25.667 4 -35 12s-14.333 19 -15 33zM361 -121 c0 13.333 4.333 24.667 13 34s19.334 14.333 32 15c14 0 25.667 -4 35 -12s14.333 -19 15 -33c0 -13.333 -4.333 -24.667 -13 -34s-19.333 -14.333 -32 -15c-14 0 -25.667 4 -35 12s-14.333 19 -15 33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E501[] =
+    "<symbol id=\"E501\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M750 242l-362 -484h-146l362 484h146zM508 242l-362 -484h-146l362 484h146zM52 118c0 13.333 4.333 24.667 13 34s19.333 14.333 32 15c14 0 25.667 -4 35 -12s14.333 -19 15 -33c0 -13.333 -4.333 -24.667 -13 -34s-19.333 -14.333 -32 -15c-14 0 -25.667 4 -35 12 s-14.333 19 -15 33zM603 -121c0 13.333 4.333 24.667 13 34s19.334 14.333 32 15c14 0 25.667 -4 35 -12s14.333 -19 15 -33c0 -13.333 -4.333 -24.667 -13 -34s-19.333 -14.333 -32 -15c-14 0 -25.667 4 -35 12s-14.333 19 -15 33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E502[] =
+    "<symbol id=\"E502\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1234 242l-362 -484h-146l362 484h146zM992 242l-362 -484h-146l362 484h146zM750 242l-362 -484h-146l362 484h146zM508 242l-362 -484h-146l362 484h146zM52 118c0 13.333 4.333 24.667 13 34s19.333 14.333 32 15c14 0 25.667 -4 35 -12s14.333 -19 15 -33 c0 -13.333 -4.333 -24.667 -13 -34s-19.333 -14.333 -32 -15c-14 0 -25.667 4 -35 12s-14.333 19 -15 33zM1087 -121c0 13.333 4.33 24.667 13 34s19.33 14.333 32 15c14 0 25.67 -4 35 -12s14.33 -19 15 -33c0 -13.333 -4.33 -24.667 -13 -34s-19.33 -14.333 -32 -15 c-14 0 -25.67 4 -35 12s-14.33 19 -15 33z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E510[] =
+    "<symbol id=\"E510\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M86 180c-15.333 17.333 -24.667 39.667 -28 67c0 10.667 2.667 21.667 8 33s13 21 23 29c21.333 15.333 47.333 23 78 23c29.333 0 53 -9 71 -27s27.333 -37.333 28 -58c0 -16.667 -5.667 -31.667 -17 -45c-11.333 -13.333 -28.333 -25.333 -51 -36 c21.333 -25.333 32 -52 32 -80c0 -23.333 -10 -43.667 -30 -61c-21.333 -16 -51.333 -24 -90 -24c-34 0 -60.667 8.33301 -80 25c-19.333 16.667 -29.333 36.667 -30 60c0 18 7.33301 36.333 22 55c12.667 16 34 29 64 39zM98 168c-19.333 -12 -33.667 -24.667 -43 -38 s-14.333 -28 -15 -44c2 -22.667 9 -38.333 21 -47s30.333 -14.667 55 -18c16.667 0 29.334 4 38 12c8.667 8 13.334 20.667 14 38c-2.667 21.333 -26 53.667 -70 97zM187 180c26 20 39 43.667 39 71c0 16.667 -5.333 31.333 -16 44s-24.667 19.333 -42 20 c-28 0 -43.667 -14.667 -47 -44l2 -12c7.333 -22 28.667 -48.333 64 -79z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E511[] =
+    "<symbol id=\"E511\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M584 213c-8.667 -19.333 -18 -33.333 -28 -42s-22.333 -13 -37 -13c-14 0 -24.333 4.667 -31 14s-10.333 21.667 -11 37c0 10.667 0.333 18.667 1 24s3.667 14 9 26s14 25.333 26 40c25.333 30 49 45 71 45c15.333 0 26 -8.667 32 -26l2 10l3 10c2 2 4.667 3 8 3h7 c4 0 6 -2 6 -6l-1 -8l-33 -117l-3 -14l-2 -13c0 -8.667 2.667 -13 8 -13c4 0 10 4.333 18 13c4.667 6.667 8.334 13 11 19c2.667 6 6.334 14.667 11 26l6 -3c-3.335 -14 -5.668 -22.333 -7 -25c-1.335 -2.667 -3.668 -6.667 -7 -12c-3.335 -5.333 -6.668 -10 -10 -14 c-3.334 -4 -6.668 -7 -10 -9c-5.333 -4.667 -12.333 -7 -21 -7c-14.667 0 -22 8.333 -22 25l1 12zM528 167c10 0 19.667 5 29 15l18 28l21 45l9 30c2.667 8 4 15.667 4 23c0 10 -2.333 17 -7 21c-2.667 4 -7.667 6.667 -15 8c-19.333 0 -40.333 -23.333 -63 -70l-7 -18 l-4 -9l-3 -9c-2 -7.333 -3.667 -13.667 -5 -19c-1.333 -5.334 -2 -10.668 -2 -16c0 -8 1.667 -14.667 5 -20s10 -8.333 20 -9zM352 316c-10.667 -8.667 -21.333 -13 -32 -13l-6 1l-6 1l-17 4c-4 0 -6 -3.667 -6 -11c0 -3.333 -1.333 -5.333 -4 -6l-4 3l-2 2l-1 11l1 8l5 8 c3.333 6 8.667 9 16 9h6h4l4 -1l6 -4l10 -5l13 -4c4.667 0 9 1.333 13 4l1 3l4 11c2.667 7.336 6.333 11.67 11 13c3.333 -3.333 5 -6 5 -8l-2 -9c-5.333 -7.333 -9.333 -14 -12 -20s-7.334 -17.333 -14 -34l-9 -36l-3 -34l1 -15l4 -14c5.333 -10 13.333 -15 24 -15 c11.333 0 22.667 5.667 34 17s22 31.667 32 61l4 24l2 24l-3 16l-1 20l2 16c2 4 5.667 6.333 11 7c4.667 0 8.667 -3 12 -9c0.668 -2 1.335 -5 2 -9c0.667 -4 1.667 -8.667 3 -14l-2 -24l-2 -11l-3 -11c-4 -18 -9 -33.333 -15 -46s-15 -26 -27 -40 c-7.333 -10 -16.667 -18 -28 -24s-23.333 -9 -36 -9c-14 0 -25 4 -33 12s-12.333 19.333 -13 34c0 10.667 5.333 27 16 49zM86 180c-15.333 17.333 -24.667 39.667 -28 67c0 10.667 2.667 21.667 8 33s13 21 23 29c21.333 15.333 47.333 23 78 23c29.333 0 53 -9 71 -27 s27.333 -37.333 28 -58c0 -16.667 -5.667 -31.667 -17 -45c-11.333 -13.333 -28.333 -25.333 -51 -36c21.333 -25.333 32 -52 32 -80c0 -23.333 -10 -43.667 -30 -61c-21.333 -16 -51.333 -24 -90 -24c-34 0 -60.667 8.33301 -80 25c-19.333 16.667 -29.333 36.667 -30 60 c0 18 7.33"
+    "301 36.333 22 55c12.667 16 34 29 64 39zM98 168c-19.333 -12 -33.667 -24.667 -43 -38s-14.333 -28 -15 -44c2 -22.667 9 -38.333 21 -47s30.333 -14.667 55 -18c16.667 0 29.334 4 38 12c8.667 8 13.334 20.667 14 38c-2.667 21.333 -26 53.667 -70 97zM187 180 c26 20 39 43.667 39 71c0 16.667 -5.333 31.333 -16 44s-24.667 19.333 -42 20c-28 0 -43.667 -14.667 -47 -44l2 -12c7.333 -22 28.667 -48.333 64 -79z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E512[] =
+    "<symbol id=\"E512\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M577 55c-8.667 -19.333 -18 -33.333 -28 -42c-10 -8.66699 -22.333 -13 -37 -13c-14 0 -24.333 4.66699 -31 14c-6.667 9.333 -10.333 21.667 -11 37c0 10.667 0.333 18.667 1 24s3.667 14 9 26s14 25.333 26 40c25.333 30 49 45 71 45c15.333 0 26 -8.667 32 -26l2 10 l3 10c2 2 4.667 3 8 3h7c4 0 6 -2 6 -6l-1 -8l-33 -117l-3 -14l-2 -13c0 -8.667 2.667 -13 8 -13c4 0 10 4.333 18 13c4.667 6.667 8.334 13 11 19c2.667 6 6.334 14.667 11 26l6 -3c-3.335 -14 -5.668 -22.333 -7 -25c-1.335 -2.667 -3.668 -6.667 -7 -12 c-3.335 -5.333 -6.668 -10 -10 -14c-3.334 -4 -6.668 -7 -10 -9c-5.333 -4.66699 -12.333 -7 -21 -7c-14.667 0 -22 8.33301 -22 25l1 12zM521 9c10 0 19.667 5 29 15l18 28l21 45l9 30c2.667 8 4 15.667 4 23c0 10 -2.333 17 -7 21c-2.667 4 -7.667 6.667 -15 8 c-19.333 0 -40.333 -23.333 -63 -70l-7 -18l-4 -9l-3 -9c-2 -7.333 -3.667 -13.667 -5 -19c-1.333 -5.334 -2 -10.668 -2 -16c0 -8 1.667 -14.667 5 -20c3.333 -5.333 10 -8.33301 20 -9zM345 163c-10.667 -8.667 -21.333 -13 -32 -13l-6 1l-6 1l-17 4 c-4 0 -6 -3.667 -6 -11c0 -3.333 -1.333 -5.333 -4 -6l-4 3l-2 2l-1 11l1 8l5 8c3.333 6 8.667 9 16 9h6h4l4 -1l6 -4l10 -5l13 -4c4.667 0 9 1.333 13 4l1 3l4 11c2.667 7.336 6.333 11.67 11 13c3.333 -3.333 5 -6 5 -8l-2 -9c-5.333 -7.333 -9.333 -14 -12 -20 s-7.334 -17.333 -14 -34l-9 -36l-3 -34l1 -15l4 -14c5.333 -10 13.333 -15 24 -15c11.333 0 22.667 5.667 34 17s22 31.667 32 61l4 24l2 24l-3 16l-1 20l2 16c2 4 5.667 6.333 11 7c4.667 0 8.667 -3 12 -9c0.668 -2 1.335 -5 2 -9c0.667 -4 1.667 -8.667 3 -14l-2 -24 l-2 -11l-3 -11c-4 -18 -9 -33.333 -15 -46s-15 -26 -27 -40c-7.333 -10 -16.667 -18 -28 -24s-23.333 -9 -36 -9c-14 0 -25 4 -33 12s-12.333 19.333 -13 34c0 10.667 5.333 27 16 49zM86 180c-15.333 17.333 -24.667 39.667 -28 67c0 10.667 2.667 21.667 8 33s13 21 23 29 c21.333 15.333 47.333 23 78 23c29.333 0 53 -9 71 -27s27.333 -37.333 28 -58c0 -16.667 -5.667 -31.667 -17 -45c-11.333 -13.333 -28.333 -25.333 -51 -36c21.333 -25.333 32 -52 32 -80c0 -23.333 -10 -43.667 -30 -61c-21.333 -16 -51.333 -24 -90 -24 c-34 0 -60.667 8.33301 -80 25c-1"
+    "9.333 16.667 -29.333 36.667 -30 60c0 18 7.33301 36.333 22 55c12.667 16 34 29 64 39zM98 168c-19.333 -12 -33.667 -24.667 -43 -38s-14.333 -28 -15 -44c2 -22.667 9 -38.333 21 -47s30.333 -14.667 55 -18c16.667 0 29.334 4 38 12 c8.667 8 13.334 20.667 14 38c-2.667 21.333 -26 53.667 -70 97zM187 180c26 20 39 43.667 39 71c0 16.667 -5.333 31.333 -16 44s-24.667 19.333 -42 20c-28 0 -43.667 -14.667 -47 -44l2 -12c7.333 -22 28.667 -48.333 64 -79z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E513[] =
+    "<symbol id=\"E513\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M314 8l7 -1c18 0 35.667 19 53 57c14 32 21 59.667 21 83c0 19.333 -6.667 29 -20 29c-15.333 0 -32 -16.333 -50 -49c-8 -16 -14.667 -32 -20 -48c-4.667 -17.334 -7 -31.667 -7 -43c0 -15.334 5.333 -24.667 16 -28zM283 90l45 169l1 6l-2 9c-3.333 2 -7.667 3 -13 3 h-11l3 9l61 8l-45 -156c10.667 17.335 21 29.668 31 37c10 7.333 19.667 11.333 29 12c10.667 0 20 -4.667 28 -14s12 -23.667 12 -43c0 -5.333 -0.333 -11.333 -1 -18c-0.667 -6.668 -2.667 -14.334 -6 -23c-5.333 -15.333 -13 -29.333 -23 -42 c-22 -31.333 -48 -47 -78 -47l-13 2c-9.333 2.66699 -15.667 6.66699 -19 12c-4.667 5.333 -7 14.667 -7 28v11l2 10c0.667 6 1.333 9.667 2 11zM551 55c-8.667 -19.333 -18 -33.333 -28 -42c-10 -8.66699 -22.333 -13 -37 -13c-14 0 -24.333 4.66699 -31 14 c-6.667 9.333 -10.333 21.667 -11 37c0 10.667 0.333 18.667 1 24s3.667 14 9 26s14 25.333 26 40c25.333 30 49 45 71 45c15.333 0 26 -8.667 32 -26l2 10l3 10c2 2 4.667 3 8 3h7c4 0 6 -2 6 -6l-1 -8l-33 -117l-3 -14l-2 -13c0 -8.667 2.667 -13 8 -13 c4 0 10 4.333 18 13c4.667 6.667 8.334 13 11 19c2.667 6 6.334 14.667 11 26l6 -3c-3.335 -14 -5.668 -22.333 -7 -25c-1.335 -2.667 -3.668 -6.667 -7 -12c-3.335 -5.333 -6.668 -10 -10 -14c-3.334 -4 -6.668 -7 -10 -9c-5.333 -4.66699 -12.333 -7 -21 -7 c-14.667 0 -22 8.33301 -22 25l1 12zM495 9c10 0 19.667 5 29 15l18 28l21 45l9 30c2.667 8 4 15.667 4 23c0 10 -2.333 17 -7 21c-2.667 4 -7.667 6.667 -15 8c-19.333 0 -40.333 -23.333 -63 -70l-7 -18l-4 -9l-3 -9c-2 -7.333 -3.667 -13.667 -5 -19 c-1.333 -5.334 -2 -10.668 -2 -16c0 -8 1.667 -14.667 5 -20c3.333 -5.333 10 -8.33301 20 -9zM86 180c-15.333 17.333 -24.667 39.667 -28 67c0 10.667 2.667 21.667 8 33s13 21 23 29c21.333 15.333 47.333 23 78 23c29.333 0 53 -9 71 -27s27.333 -37.333 28 -58 c0 -16.667 -5.667 -31.667 -17 -45c-11.333 -13.333 -28.333 -25.333 -51 -36c21.333 -25.333 32 -52 32 -80c0 -23.333 -10 -43.667 -30 -61c-21.333 -16 -51.333 -24 -90 -24c-34 0 -60.667 8.33301 -80 25c-19.333 16.667 -29.333 36.667 -30 60 c0 18 7.33301 36.333 22 55c12.667 16 34 29 64 39zM98 168c-19.333 -12 -33.667 -2"
+    "4.667 -43 -38s-14.333 -28 -15 -44c2 -22.667 9 -38.333 21 -47s30.333 -14.667 55 -18c16.667 0 29.334 4 38 12c8.667 8 13.334 20.667 14 38c-2.667 21.333 -26 53.667 -70 97zM187 180 c26 20 39 43.667 39 71c0 16.667 -5.333 31.333 -16 44s-24.667 19.333 -42 20c-28 0 -43.667 -14.667 -47 -44l2 -12c7.333 -22 28.667 -48.333 64 -79z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E514[] =
+    "<symbol id=\"E514\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M108 41c0 -18 15 -22 33 -24l12 1l14 2l-5 -20h-159l5 20h19c15 0 25 1 29 3c5 4 9 11 12 21l52 211l1 5c-4 4 -7 6 -9 6l-53 1l5 20c17 0 34 3 51 9c19 5 35 12 50 22h12l-67 -266l-2 -6v-5zM224 137c-9 2 -11 2 -13 13c0 7 5 15 16 24c9 28 17 57 25 85l16 61l47 -9 c5 -1 13 -2 25 -2c5 -1 9 -1 14 -1c26 0 48 4 66 13l6 -4c-18 -32 -41 -51 -89 -51c-11 0 -49 6 -58 7l-26 -86c20 11 32 14 59 16c51 0 81 -33 81 -84c0 -31 -12 -60 -37 -87s-56 -40 -93 -40c-44 0 -83 24 -83 70c0 24 11 41 34 41c14 0 26 -13 26 -28c0 -7 -1 -11 -3 -13 l-16 -13l-8 -5l-2 -4c0 -18 25 -29 47 -29c21 0 40 10 59 30s28 47 29 81c0 37 -21 57 -55 57c-26 0 -33 -5 -46 -17c-3 -13 -7 -25 -21 -25z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E515[] =
+    "<symbol id=\"E515\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M444.507 144.677l39.997 121.692c1.806 6.319 5.396 17.855 5.396 25.781c0 7.871 -4.518 16.95 -15.25 16.95c-23.797 0 -40.731 -38.506 -48.75 -57.752c-1.448 -3.618 -1.732 -3.448 -3.1 -3.448c-2.15 0 -2.6 0.687 -2.6 1.75c0 3.448 1.161 6.708 3.687 12.598 c13.724 30.884 32.95 63.102 64.363 63.102c12.879 0 20.209 -5.947 23.45 -14.374c1.672 -4.348 -0.186 -22.176 12.25 -22.176c7.886 0 12.95 10.309 18.673 16.748c10.509 12.125 22.105 20.652 39.977 20.652c14.135 0 22.056 -5.366 26.015 -15.263 c1.644 -4.273 -0.196 -22.137 12.235 -22.137c7.861 0 13.021 10.388 18.598 16.662c10.562 11.374 22.4 20.738 40.052 20.738c21.638 0 30.65 -15.752 30.65 -34.9c0 -38.804 -34.85 -96.415 -34.85 -125.8c0 -9.234 5.726 -17.8 16.1 -17.8 c19.14 0 28.088 24.369 34.344 40.009c2.033 5.423 2.406 4.191 3.056 4.191c1.982 0 1.75 -0.572 1.75 -0.9c0 -2.274 -0.498 -4.621 -2.089 -8.599c-9.247 -24.376 -21.883 -44.151 -48.961 -44.151c-21.845 0 -31.05 7.997 -31.05 26.4 c0 30.764 33.15 85.646 33.15 117.3c0 10.712 -9.852 20.35 -21.65 20.35c-27.975 0 -52.901 -36.057 -63.954 -69.215l-28.899 -86.7c-0.545 -1.636 -0.52 -3.035 -0.52 -3.035h-24.777s-0.712 0.371 -0.388 1.344l38.241 116.421c2.686 8.055 3.747 14.069 3.747 19.985 c0 12.487 -8.222 21.2 -20.35 21.2c-28.004 0 -51.919 -36.111 -62.953 -69.216l-28.901 -86.7c-0.477 -1.431 -0.78 -2.63 -0.88 -2.985c-1.011 -0.063 -1.54 -0.049 -2.916 -0.049h-22.5s-0.704 0.393 -0.393 1.327zM853 196c-8.667 -19.333 -18 -33.333 -28 -42 s-22.333 -13 -37 -13c-14 0 -24.333 4.667 -31 14s-10.333 21.667 -11 37c0 10.667 0.333 18.667 1 24s3.667 14 9 26s14 25.333 26 40c25.333 30 49 45 71 45c15.333 0 26 -8.667 32 -26l2 10l3 10c2 2 4.667 3 8 3h7c4 0 6 -2 6 -6l-1 -8l-33 -117l-3 -14l-2 -13 c0 -8.667 2.667 -13 8 -13c4 0 10 4.333 18 13c4.667 6.667 8.334 13 11 19c2.667 6 6.334 14.667 11 26l6 -3c-3.335 -14 -5.668 -22.333 -7 -25c-1.335 -2.667 -3.668 -6.667 -7 -12c-3.335 -5.333 -6.668 -10 -10 -14c-3.334 -4 -6.668 -7 -10 -9 c-5.333 -4.667 -12.333 -7 -21 -7c-14.667 0 -22 8.333 -22 25l1 12zM797 150c10 0 1"
+    "9.667 5 29 15l18 28l21 45l9 30c2.667 8 4 15.667 4 23c0 10 -2.333 17 -7 21c-2.667 4 -7.667 6.667 -15 8c-19.333 0 -40.333 -23.333 -63 -70l-7 -18l-4 -9l-3 -9 c-2 -7.333 -3.667 -13.667 -5 -19c-1.333 -5.334 -2 -10.668 -2 -16c0 -8 1.667 -14.667 5 -20s10 -8.333 20 -9zM108 41c0 -18 15 -22 33 -24l12 1l14 2l-5 -20h-159l5 20h19c15 0 25 1 29 3c5 4 9 11 12 21l52 211l1 5c-4 4 -7 6 -9 6l-53 1l5 20c17 0 34 3 51 9 c19 5 35 12 50 22h12l-67 -266l-2 -6v-5zM224 137c-9 2 -11 2 -13 13c0 7 5 15 16 24c9 28 17 57 25 85l16 61l47 -9c5 -1 13 -2 25 -2c5 -1 9 -1 14 -1c26 0 48 4 66 13l6 -4c-18 -32 -41 -51 -89 -51c-11 0 -49 6 -58 7l-26 -86c20 11 32 14 59 16c51 0 81 -33 81 -84 c0 -31 -12 -60 -37 -87s-56 -40 -93 -40c-44 0 -83 24 -83 70c0 24 11 41 34 41c14 0 26 -13 26 -28c0 -7 -1 -11 -3 -13l-16 -13l-8 -5l-2 -4c0 -18 25 -29 47 -29c21 0 40 10 59 30s28 47 29 81c0 37 -21 57 -55 57c-26 0 -33 -5 -46 -17c-3 -13 -7 -25 -21 -25z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E516[] =
+    "<symbol id=\"E516\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M434.506 1.67285l39.998 121.696c1.807 6.319 5.396 17.856 5.396 25.781c0 7.871 -4.518 16.95 -15.25 16.95c-23.796 0 -40.731 -38.506 -48.75 -57.751c-1.449 -3.62 -1.732 -3.449 -3.1 -3.449c-2.15 0 -2.6 0.688 -2.6 1.75c0 3.449 1.161 6.708 3.687 12.598 c13.724 30.884 32.95 63.102 64.363 63.102c12.879 0 20.209 -5.947 23.449 -14.373c1.673 -4.348 -0.184 -22.177 12.251 -22.177c7.886 0 12.95 10.309 18.672 16.748c10.51 12.126 22.106 20.652 39.978 20.652c14.135 0 22.055 -5.365 26.015 -15.263 c1.644 -4.272 -0.196 -22.137 12.235 -22.137c7.861 0 13.021 10.388 18.597 16.662c10.563 11.374 22.401 20.738 40.053 20.738c21.639 0 30.65 -15.753 30.65 -34.9c0 -38.804 -34.85 -96.4152 -34.85 -125.8c0 -9.2334 5.726 -17.7998 16.1 -17.7998 c19.14 0 28.087 24.3691 34.344 40.0098c2.032 5.4218 2.405 4.1904 3.056 4.1904c1.981 0 1.75 -0.5723 1.75 -0.9004c0 -2.2734 -0.497 -4.6201 -2.089 -8.5986c-9.247 -24.377 -21.883 -44.1514 -48.961 -44.1514c-21.845 0 -31.05 7.99609 -31.05 26.4004 c0 30.7646 33.15 85.6456 33.15 117.3c0 10.712 -9.852 20.35 -21.65 20.35c-28.004 0 -51.919 -36.111 -62.954 -69.216l-28.898 -86.6992c-0.478 -1.43165 -0.782 -2.62989 -0.882 -2.98633c-1.01 -0.063477 -1.539 -0.048829 -2.916 -0.048829h-22.5 s-0.712 0.371094 -0.388 1.34375l38.24 116.422c2.687 8.055 3.748 14.069 3.748 19.985c0 12.487 -8.222 21.2 -20.35 21.2c-28.004 0 -51.918 -36.111 -62.952 -69.215l-28.902 -86.7012c-0.546 -1.63672 -0.519 -3.03418 -0.519 -3.03418h-25.777 s-0.705 0.392579 -0.394 1.32324zM843 56c-8.667 -19.333 -18 -33.333 -28 -42c-10 -8.66699 -22.333 -13 -37 -13c-14 0 -24.333 4.66699 -31 14c-6.667 9.333 -10.333 21.667 -11 37c0 10.667 0.333 18.667 1 24s3.667 14 9 26s14 25.333 26 40c25.333 30 49 45 71 45 c15.333 0 26 -8.667 32 -26l2 10l3 10c2 2 4.667 3 8 3h7c4 0 6 -2 6 -6l-1 -8l-33 -117l-3 -14l-2 -13c0 -8.667 2.667 -13 8 -13c4 0 10 4.333 18 13c4.667 6.667 8.334 13 11 19c2.667 6 6.334 14.667 11 26l6 -3c-3.335 -14 -5.668 -22.333 -7 -25 c-1.335 -2.667 -3.668 -6.667 -7 -12c-3.335 -5.333 -6.668 -10 -10 -14c-3.334 "
+    "-4 -6.668 -7 -10 -9c-5.333 -4.66699 -12.333 -7 -21 -7c-14.667 0 -22 8.33301 -22 25l1 12zM787 10c10 0 19.667 5 29 15l18 28l21 45l9 30c2.667 8 4 15.667 4 23c0 10 -2.333 17 -7 21 c-2.667 4 -7.667 6.667 -15 8c-19.333 0 -40.333 -23.333 -63 -70l-7 -18l-4 -9l-3 -9c-2 -7.333 -3.667 -13.667 -5 -19c-1.333 -5.334 -2 -10.668 -2 -16c0 -8 1.667 -14.667 5 -20c3.333 -5.333 10 -8.333 20 -9zM108 41c0 -18 15 -22 33 -24l12 1l14 2l-5 -20h-159l5 20 h19c15 0 25 1 29 3c5 4 9 11 12 21l52 211l1 5c-4 4 -7 6 -9 6l-53 1l5 20c17 0 34 3 51 9c19 5 35 12 50 22h12l-67 -266l-2 -6v-5zM224 137c-9 2 -11 2 -13 13c0 7 5 15 16 24c9 28 17 57 25 85l16 61l47 -9c5 -1 13 -2 25 -2c5 -1 9 -1 14 -1c26 0 48 4 66 13l6 -4 c-18 -32 -41 -51 -89 -51c-11 0 -49 6 -58 7l-26 -86c20 11 32 14 59 16c51 0 81 -33 81 -84c0 -31 -12 -60 -37 -87s-56 -40 -93 -40c-44 0 -83 24 -83 70c0 24 11 41 34 41c14 0 26 -13 26 -28c0 -7 -1 -11 -3 -13l-16 -13l-8 -5l-2 -4c0 -18 25 -29 47 -29 c21 0 40 10 59 30s28 47 29 81c0 37 -21 57 -55 57c-26 0 -33 -5 -46 -17c-3 -13 -7 -25 -21 -25z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E517[] =
+    "<symbol id=\"E517\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M166 311c60 0 94 -21 94 -80c0 -27 -12 -51 -40 -64l-70 -32c-37 -10 -69 -30 -96 -60h21l26 -2l12 -6c14 -6 28 -11 42 -17c6 -3 13 -4 21 -4l15 4l11 8c5 5 11 13 19 26l17 -9l-16 -28c-2 -4 -16 -28 -20 -31c-19 -21 -38 -31 -57 -31h-10c-13 6 -25 12 -36 20l-15 11 c-12 7 -23 10 -32 10c-10 -3 -19 -8 -24 -17l-5 -9h-23c0 27 6 51 20 72c7 10 14 16 19 21l28 25c20 11 40 22 59 33l19 9c26.668 11.667 58 42.434 58 75l1 12c0 13 -4 24 -12 31c-6 9 -15 14 -28 14c-29 0 -46 -15 -52 -44l3 -12l2 -16c0 -20 -8 -29 -25 -29 c-14 0 -26 13 -26 28c0 48 52 92 100 92zM410 311c60 0 94 -21 94 -80c0 -27 -12 -51 -40 -64l-70 -32c-37 -10 -69 -30 -96 -60h21l26 -2l12 -6c14 -6 28 -11 42 -17c6 -3 13 -4 21 -4l15 4l11 8c5 5 11 13 19 26l17 -9l-16 -28c-2 -4 -16 -28 -20 -31 c-19 -21 -38 -31 -57 -31h-10c-13 6 -25 12 -36 20l-15 11c-12 7 -23 10 -32 10c-10 -3 -19 -8 -24 -17l-5 -9h-23c0 27 6 51 20 72c7 10 14 16 19 21l28 25c20 11 40 22 59 33l19 9c26.668 11.667 58 42.434 58 75l1 12c0 13 -4 24 -12 31c-6 9 -15 14 -28 14 c-29 0 -46 -15 -52 -44l3 -12l2 -16c0 -20 -8 -29 -25 -29c-14 0 -26 13 -26 28c0 48 52 92 100 92z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E518[] =
+    "<symbol id=\"E518\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M539.507 134.677l39.998 121.693c1.805 6.317 5.395 17.855 5.395 25.78c0 7.871 -4.518 16.95 -15.25 16.95c-23.797 0 -40.731 -38.507 -48.749 -57.75c-1.45 -3.621 -1.732 -3.45 -3.101 -3.45c-2.15 0 -2.6 0.687 -2.6 1.75c0 3.45 1.16 6.705 3.688 12.601 c13.723 30.879 32.949 63.099 64.362 63.099c12.879 0 20.209 -5.947 23.45 -14.374c1.672 -4.348 -0.186 -22.176 12.25 -22.176c7.886 0 12.95 10.309 18.673 16.748c10.509 12.125 22.105 20.652 39.977 20.652c14.135 0 22.056 -5.366 26.015 -15.263 c1.644 -4.273 -0.196 -22.137 12.235 -22.137c7.861 0 13.021 10.388 18.598 16.662c10.562 11.374 22.4 20.738 40.052 20.738c21.638 0 30.65 -15.752 30.65 -34.9c0 -38.804 -34.85 -96.415 -34.85 -125.8c0 -9.234 5.726 -17.8 16.1 -17.8 c19.14 0 28.088 24.369 34.344 40.009c2.033 5.423 2.406 4.191 3.056 4.191c1.982 0 1.75 -0.572 1.75 -0.9c0 -2.274 -0.498 -4.621 -2.089 -8.599c-9.247 -24.376 -21.883 -44.151 -48.961 -44.151c-21.845 0 -31.05 7.997 -31.05 26.4 c0 30.764 33.15 85.646 33.15 117.3c0 10.712 -9.852 20.35 -21.65 20.35c-28.004 0 -51.919 -36.111 -62.954 -69.215l-28.899 -86.7c-0.477 -1.431 -0.781 -2.63 -0.881 -2.986c-1.01 -0.063 -1.54 -0.049 -2.916 -0.049h-22.5s-0.712 0.371 -0.388 1.344l38.241 116.421 c2.686 8.055 3.747 14.069 3.747 19.985c0 12.487 -8.222 21.2 -20.35 21.2c-28.004 0 -51.918 -36.111 -62.953 -69.215l-28.901 -86.701c-0.477 -1.431 -0.78 -2.63 -0.88 -2.985c-1.011 -0.063 -1.54 -0.049 -2.916 -0.049h-22.5s-0.704 0.393 -0.393 1.327zM948 186 c-8.667 -19.333 -18 -33.333 -28 -42s-22.333 -13 -37 -13c-14 0 -24.333 4.667 -31 14s-10.333 21.667 -11 37c0 10.667 0.333 18.667 1 24s3.667 14 9 26s14 25.333 26 40c25.333 30 49 45 71 45c15.333 0 26 -8.667 32 -26l2 10l3 10c2 2 4.667 3 8 3h7c4 0 6 -2 6 -6 l-1 -8l-33 -117l-3 -14l-2 -13c0 -8.667 2.667 -13 8 -13c4 0 10 4.333 18 13c4.667 6.667 8.33 13 11 19s6.33 14.667 11 26l6 -3c-3.33 -14 -5.67 -22.333 -7 -25s-3.67 -6.667 -7 -12s-6.67 -10 -10 -14c-3.334 -4 -6.668 -7 -10 -9c-5.333 -4.667 -12.333 -7 -21 -7 c-14.667 0 -22 8.333 -22 25l1 12zM892 140c10 0 19.66"
+    "7 5 29 15l18 28l21 45l9 30c2.667 8 4 15.667 4 23c0 10 -2.333 17 -7 21c-2.667 4 -7.667 6.667 -15 8c-19.333 0 -40.333 -23.333 -63 -70l-7 -18l-4 -9l-3 -9c-2 -7.333 -3.667 -13.667 -5 -19 c-1.333 -5.334 -2 -10.668 -2 -16c0 -8 1.667 -14.667 5 -20s10 -8.333 20 -9zM166 311c60 0 94 -21 94 -80c0 -27 -12 -51 -40 -64l-70 -32c-37 -10 -69 -30 -96 -60h21l26 -2l12 -6c14 -6 28 -11 42 -17c6 -3 13 -4 21 -4l15 4l11 8c5 5 11 13 19 26l17 -9l-16 -28 c-2 -4 -16 -28 -20 -31c-19 -21 -38 -31 -57 -31h-10c-13 6 -25 12 -36 20l-15 11c-12 7 -23 10 -32 10c-10 -3 -19 -8 -24 -17l-5 -9h-23c0 27 6 51 20 72c7 10 14 16 19 21l28 25c20 11 40 22 59 33l19 9c26.668 11.667 58 42.434 58 75l1 12c0 13 -4 24 -12 31 c-6 9 -15 14 -28 14c-29 0 -46 -15 -52 -44l3 -12l2 -16c0 -20 -8 -29 -25 -29c-14 0 -26 13 -26 28c0 48 52 92 100 92zM410 311c60 0 94 -21 94 -80c0 -27 -12 -51 -40 -64l-70 -32c-37 -10 -69 -30 -96 -60h21l26 -2l12 -6c14 -6 28 -11 42 -17c6 -3 13 -4 21 -4l15 4 l11 8c5 5 11 13 19 26l17 -9l-16 -28c-2 -4 -16 -28 -20 -31c-19 -21 -38 -31 -57 -31h-10c-13 6 -25 12 -36 20l-15 11c-12 7 -23 10 -32 10c-10 -3 -19 -8 -24 -17l-5 -9h-23c0 27 6 51 20 72c7 10 14 16 19 21l28 25c20 11 40 22 59 33l19 9 c26.668 11.667 58 42.434 58 75l1 12c0 13 -4 24 -12 31c-6 9 -15 14 -28 14c-29 0 -46 -15 -52 -44l3 -12l2 -16c0 -20 -8 -29 -25 -29c-14 0 -26 13 -26 28c0 48 52 92 100 92z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E519[] =
+    "<symbol id=\"E519\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M509.506 1.67285l39.999 121.697c1.805 6.318 5.395 17.855 5.395 25.78c0 7.871 -4.518 16.95 -15.25 16.95c-23.796 0 -40.731 -38.506 -48.75 -57.751c-1.449 -3.62 -1.732 -3.449 -3.1 -3.449c-2.15 0 -2.6 0.688 -2.6 1.75c0 3.449 1.161 6.708 3.687 12.598 c13.724 30.884 32.95 63.102 64.363 63.102c12.879 0 20.209 -5.947 23.449 -14.373c1.673 -4.348 -0.184 -22.177 12.251 -22.177c7.886 0 12.95 10.309 18.672 16.748c10.51 12.126 22.106 20.652 39.978 20.652c14.135 0 22.055 -5.365 26.015 -15.263 c1.644 -4.272 -0.196 -22.137 12.235 -22.137c7.861 0 13.021 10.388 18.597 16.662c10.563 11.374 22.401 20.738 40.053 20.738c21.639 0 30.65 -15.753 30.65 -34.9c0 -38.804 -34.85 -96.4152 -34.85 -125.8c0 -9.2334 5.726 -17.7998 16.1 -17.7998 c19.14 0 28.087 24.3691 34.344 40.0098c2.032 5.4218 2.405 4.1904 3.056 4.1904c1.981 0 1.75 -0.5723 1.75 -0.9004c0 -2.2734 -0.497 -4.6201 -2.089 -8.5986c-9.247 -24.377 -21.883 -44.1514 -48.961 -44.1514c-21.845 0 -31.05 7.99609 -31.05 26.4004 c0 30.7646 33.15 85.6456 33.15 117.3c0 10.712 -9.852 20.35 -21.65 20.35c-28.004 0 -51.919 -36.111 -62.954 -69.216l-28.898 -86.6992c-0.478 -1.43165 -0.782 -2.62989 -0.882 -2.98633c-1.01 -0.063477 -1.539 -0.048829 -2.916 -0.048829h-22.5 s-0.712 0.371094 -0.388 1.34375l38.24 116.422c2.687 8.055 3.748 14.069 3.748 19.985c0 12.487 -8.222 21.2 -20.35 21.2c-28.004 0 -51.918 -36.111 -62.952 -69.215l-28.902 -86.7012c-0.476 -1.43067 -0.78 -2.62988 -0.881 -2.98535 c-1.009 -0.063477 -1.539 -0.048829 -2.915 -0.048829h-22.5s-0.705 0.392579 -0.394 1.32324zM918 56c-8.667 -19.333 -18 -33.333 -28 -42c-10 -8.66699 -22.333 -13 -37 -13c-14 0 -24.333 4.66699 -31 14c-6.667 9.333 -10.333 21.667 -11 37 c0 10.667 0.333 18.667 1 24s3.667 14 9 26s14 25.333 26 40c25.333 30 49 45 71 45c15.333 0 26 -8.667 32 -26l2 10l3 10c2 2 4.667 3 8 3h7c4 0 6 -2 6 -6l-1 -8l-33 -117l-3 -14l-2 -13c0 -8.667 2.667 -13 8 -13c4 0 10 4.333 18 13c4.667 6.667 8.334 13 11 19 c2.667 6 6.334 14.667 11 26l6 -3c-3.335 -14 -5.668 -22.333 -7 -25c-1.335 -2.667 -3.668 -6.667 "
+    "-7 -12c-3.335 -5.333 -6.668 -10 -10 -14c-3.334 -4 -6.668 -7 -10 -9c-5.333 -4.66699 -12.333 -7 -21 -7c-14.667 0 -22 8.33301 -22 25l1 12zM862 10 c10 0 19.667 5 29 15l18 28l21 45l9 30c2.667 8 4 15.667 4 23c0 10 -2.333 17 -7 21c-2.667 4 -7.667 6.667 -15 8c-19.333 0 -40.333 -23.333 -63 -70l-7 -18l-4 -9l-3 -9c-2 -7.333 -3.667 -13.667 -5 -19c-1.333 -5.334 -2 -10.668 -2 -16c0 -8 1.667 -14.667 5 -20 c3.333 -5.333 10 -8.333 20 -9zM166 311c60 0 94 -21 94 -80c0 -27 -12 -51 -40 -64l-70 -32c-37 -10 -69 -30 -96 -60h21l26 -2l12 -6c14 -6 28 -11 42 -17c6 -3 13 -4 21 -4l15 4l11 8c5 5 11 13 19 26l17 -9l-16 -28c-2 -4 -16 -28 -20 -31c-19 -21 -38 -31 -57 -31h-10 c-13 6 -25 12 -36 20l-15 11c-12 7 -23 10 -32 10c-10 -3 -19 -8 -24 -17l-5 -9h-23c0 27 6 51 20 72c7 10 14 16 19 21l28 25c20 11 40 22 59 33l19 9c26.668 11.667 58 42.434 58 75l1 12c0 13 -4 24 -12 31c-6 9 -15 14 -28 14c-29 0 -46 -15 -52 -44l3 -12l2 -16 c0 -20 -8 -29 -25 -29c-14 0 -26 13 -26 28c0 48 52 92 100 92zM410 311c60 0 94 -21 94 -80c0 -27 -12 -51 -40 -64l-70 -32c-37 -10 -69 -30 -96 -60h21l26 -2l12 -6c14 -6 28 -11 42 -17c6 -3 13 -4 21 -4l15 4l11 8c5 5 11 13 19 26l17 -9l-16 -28 c-2 -4 -16 -28 -20 -31c-19 -21 -38 -31 -57 -31h-10c-13 6 -25 12 -36 20l-15 11c-12 7 -23 10 -32 10c-10 -3 -19 -8 -24 -17l-5 -9h-23c0 27 6 51 20 72c7 10 14 16 19 21l28 25c20 11 40 22 59 33l19 9c26.668 11.667 58 42.434 58 75l1 12c0 13 -4 24 -12 31 c-6 9 -15 14 -28 14c-29 0 -46 -15 -52 -44l3 -12l2 -16c0 -20 -8 -29 -25 -29c-14 0 -26 13 -26 28c0 48 52 92 100 92z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E520[] =
+    "<symbol id=\"E520\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M23 124h-23c22 42.667 42.667 76.333 62 101s44.667 37.333 76 38c6 0 12 -4.333 18 -13c6.667 -6.667 10 -15.667 10 -27l24 14l25 13c12 4.667 24.333 7 37 7c24 0 43.333 -9.333 58 -28s22.333 -44.333 23 -77c0 -14 -1 -26.667 -3 -38s-5.333 -21 -10 -29 s-11 -17 -19 -27c-14 -18 -29.667 -32 -47 -42c-17.333 -10 -35.333 -15 -54 -15c-8.667 0 -19.667 3.33301 -33 10c-5.333 3.333 -10.333 6.667 -15 10s-9 8 -13 14l-56 -158l-3 -4c2.667 -6.667 6.667 -10.333 12 -11h32v-29h-173v29h21c4 0 8.667 1.667 14 5 c4 4 7 8.667 9 14l119 331v6l-3 10l-6 3c-8.667 0 -17 -4 -25 -12s-15.667 -18.333 -23 -31l-11 -17l-10 -20zM197 201c-12 -20.667 -21.667 -44.667 -29 -72c-6.667 -30 -10 -50.667 -10 -62c0 -24 7.333 -36 22 -36c12.667 0 23 2.333 31 7s15 11.333 21 20 c10 16.667 15.333 26 16 28c4.667 11.333 8 26 10 44s3.333 31 4 39c0 7.333 -0.667 13.333 -2 18s-3.333 9.334 -6 14c-5.333 9.333 -14.667 14 -28 14c-14 0 -23.667 -4.667 -29 -14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E521[] =
+    "<symbol id=\"E521\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M337 262c21 0 43 -14 43 -35v-7l-63 -183c0 -13 4 -20 12 -21c8 0 17 5 26 15s15 16 16 17c4 7 18.633 31.6631 20 35l14 41h23l-24 -63c-8.304 -21.7969 -31 -45 -44 -58s-29 -20 -46 -21c-18 0 -34 5 -49 14l-16 15c-3 7 -5 12 -5 17c20 63 44 124 65 186 c0 7 -5 12 -15 13c-16 0 -31 -15 -44 -45l-64 -182h-71l77 214c0 9 -6 13 -17 13c-9 0 -17 -4 -22 -11s-12 -19 -20 -34l-64 -182h-69l77 210v4c0 10 -5 12 -12 16c-25 0 -52 -47 -66 -73c-5 -9 -12 -23 -21 -42h-22c19 39 40 76 64 107c21 27 47 40 79 40 c21 0 31 -19 34 -41c19 17 34 27 45 32c11 6 24 9 39 9c21 0 32 -19 35 -41c22 17 49 41 85 41z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E522[] =
+    "<symbol id=\"E522\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-91 -179c-2 -2.667 -2.667 -5 -2 -7s4.333 -3.333 11 -4c18.667 0 34.333 13.667 47 41c6.667 14 13.333 30 20 48c6.66699 18 11.667 35.333 15 52l14 61l44 208h-58v38h70c7.333 20.667 13.333 36.333 18 47c7.333 18 14.667 32.667 22 44c20.666 30 42.333 53 65 69 s47.667 24 75 24c9.333 0 17 -1 23 -3s12.333 -7.333 19 -16c4.667 -6.667 7.667 -13 9 -19l4 -16c0 -14.667 -0.667 -25.334 -2 -32c-1.333 -6.667 -5 -16 -11 -28c-2.667 -6 -8.667 -13 -18 -21c-4 -3.333 -8.333 -5.333 -13 -6s-10.333 -0.667 -17 0 c-6 1.333 -10.333 5 -13 11s-4.667 12.667 -6 20c0 12 2.333 22.667 7 32s12 17.333 22 24l14 10c0 8.667 -6 14 -18 16c-13.333 1.33 -24.667 -1.337 -34 -8c-9.333 -6.667 -19 -21 -29 -43c-4.667 -12 -10.333 -29.667 -17 -53s-11.333 -40 -14 -50h77v-40h-85 c-12 -68.667 -29 -137.333 -51 -206c-18 -55.333 -35.333 -99 -52 -131c-13.333 -26 -27 -47 -41 -63c-24.667 -28.667 -50 -43 -76 -43c-24.666 0 -43.333 9.667 -56 29c-10 15.333 -15 33.333 -15 54c0 16.667 4 32.667 12 48c4.667 7.333 10.333 13 17 17s13.333 6 20 6 c8.667 0 15.667 -4 21 -12s9 -15.333 11 -22s3 -12.333 3 -17c0 -9.333 -2.333 -17.333 -7 -24c-4.6641 -6.667 -9.3301 -13.667 -14 -21c-4.6641 -7.333 -8.3301 -12 -11 -14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E523[] =
+    "<symbol id=\"E523\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M194 174c-14 0 -23 12 -23 29l1 11l3 12c0 5 -3 7 -8 7c-13 0 -26 -10 -38 -31l-16 -32c-21 -54 -35 -113 -53 -170h-60l57 194v5c0 11 -3 16 -8 16c-15 0 -20 -9 -30 -21c-9 -11 -17 -23 -25 -36l-14 8c6 15 16 25 28 38c19 19 50 48 83 48c15 0 22 -9 22 -28 c-1 -7 -1 -14 -2 -21c16 24 39 56 74 56c21 0 40 -19 40 -40c0 -30 -10 -45 -31 -45z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E524[] =
+    "<symbol id=\"E524\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M81 33c21 0 38 15 40 34c0 7 -3 15 -8 22c-3 5 -9 11 -19 18c-22 13 -38 26 -47 38s-14 26 -15 43c0 50 40 82 87 82l28 -3c9 -3 17 -7 24 -13c15 -9 23 -24 23 -43l-1 -10l-6 -10c-3 -5 -8 -9 -17 -10c-17 0 -26 8 -29 24l4 19c0 10 -14 16 -24 18 c-19 3 -32 -16 -35 -36c0 -7 4 -15 11 -22c9 -7 18 -14 26 -21c28 -23 43 -37 44 -40c8 -10 12 -23 12 -39v-10c0 -21 -10 -39 -29 -54c-16 -10 -38 -18 -61 -20c-47 0 -89 26 -89 67l1 15l5 13l10 9l13 4c16 0 24 -10 24 -31c0 -13 -5 -16 -8 -28c0 -8 11 -16 23 -16h13z \"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E525[] =
+    "<symbol id=\"E525\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M173 115c21 0 34 -23 34 -48c0 -23 -8 -42 -24 -58c-15 -17 -39 -25 -73 -25c-12 0 -21 1 -27 4l-12 6l-17 10c-15 7 -24 10 -29 10c-9 0 -19 -5 -30 -14h-31v16l209 177l-64 -1c-23 -3 -32 -15 -44 -30h-24l30 87h189v-32l-211 -163c13 6 26 9 39 9c14 0 53 -18 63 -20 c9 1 14 8 14 19c-13 0 -20 8 -22 23c0 17 13 30 30 30z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E526[] =
+    "<symbol id=\"E526\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-39 115c2.374 2.341 18.6816 35.814 24 43l41 70c19 17 14 17 25 22c11 6 36 12 51 12c21 0 32 -19 35 -41c22 17 49 41 85 41c21 0 43 -14 43 -35v-7l-63 -183c0 -13 4 -20 12 -21c8 0 17 5 26 15s15 16 16 17c4 7 18.633 31.6631 20 35l14 41h23l-24 -63 c-8.304 -21.7969 -31 -45 -44 -58s-29 -20 -46 -21c-18 0 -34 5 -49 14l-16 15c-3 7 -5 12 -5 17c20 63 44 124 65 186c0 7 -5 12 -15 13c-16 0 -31 -15 -44 -45l-64 -182h-71l77 214c0 9 -6 13 -17 13c-9 0 -17 -4 -22 -11s-47 -86 -55 -101h-22z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E527[] =
+    "<symbol id=\"E527\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1762 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39zM1700 1c-22 0 -50 18 -61 34l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29h-173v29h21 c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-4.57 -8.565 -8.81 -17.457 -13.1 -26.488c-1.13 -41.825 -12.05 -61.9349 -31.9 -86.512c-23 -29 -55 -57 -101 -57c-22 0 -50 18 -61 34l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29h-173 v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-4.57 -8.565 -8.81 -17.457 -13.1 -26.488c-1.13 -41.825 -12.05 -61.9349 -31.9 -86.512c-23 -29 -55 -57 -101 -57c-22 0 -50 18 -61 34l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29 h-173v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-4.568 -8.565 -8.81 -17.457 -13.099 -26.488c-1.135 -41.825 -12.05 -61.9349 -31.901 -86.512c-23 -29 -55 -57 -101 -57c-22 0 -50 18 -61 34l-56 -158l-3 -4 c3 -7 7 -10 12 -11h32v-29h-173v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-4.568 -8.565 -8.81 -17.457 -13.099 -26.488c-1.135 -41.825 -12.05 -61.9349 -31.901 -86.512c-23 -29 -55 -57 -101 -57c-22 0 -50 18 -61 34 l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29h-173v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-4.568 -8.565 -8.81 -17.457 -13.099 -26.488c-1.135 -41.825 -12.05 -61.9349 -31.901 -86.512c-23 -29 -55 -57 -101 -57 c-22 0 -50 18 -61 34l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29h-173v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-8 -15 -15 -31 -23 -47h-23c22 43 43 76 62 101s45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7 c45.295 0 70.889 -33.771 78.555 -78.298c10.936 17.832 21.467 33.168 31.445 46.298c19 25 45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7c45.295 0 70.889 -33.771 78.555 -78.298c10.937 17.832 21.467 33.168 31.445 46.298c19 25 45 37 76 38 c14"
+    " 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7c45.295 0 70.889 -33.771 78.555 -78.298c10.937 17.832 21.467 33.168 31.445 46.298c19 25 45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7c45.29 0 70.89 -33.771 78.55 -78.298 c10.94 17.832 21.47 33.168 31.45 46.298c19 25 45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7c45.29 0 70.89 -33.771 78.55 -78.298c10.94 17.832 21.47 33.168 31.45 46.298c19 25 45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7 c54 0 80 -48 81 -105c0 -47 -11 -68 -32 -94c-23 -29 -55 -57 -101 -57zM1462 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39zM1162 169 c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39zM862 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62 c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39zM562 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39zM262 169 c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E528[] =
+    "<symbol id=\"E528\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1462 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39zM1400 1c-22 0 -50 18 -61 34l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29h-173v29h21 c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-4.57 -8.565 -8.81 -17.457 -13.1 -26.488c-1.13 -41.825 -12.05 -61.9349 -31.9 -86.512c-23 -29 -55 -57 -101 -57c-22 0 -50 18 -61 34l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29h-173 v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-4.568 -8.565 -8.81 -17.457 -13.099 -26.488c-1.135 -41.825 -12.05 -61.9349 -31.901 -86.512c-23 -29 -55 -57 -101 -57c-22 0 -50 18 -61 34l-56 -158l-3 -4c3 -7 7 -10 12 -11 h32v-29h-173v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-4.568 -8.565 -8.81 -17.457 -13.099 -26.488c-1.135 -41.825 -12.05 -61.9349 -31.901 -86.512c-23 -29 -55 -57 -101 -57c-22 0 -50 18 -61 34l-56 -158l-3 -4 c3 -7 7 -10 12 -11h32v-29h-173v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-4.568 -8.565 -8.81 -17.457 -13.099 -26.488c-1.135 -41.825 -12.05 -61.9349 -31.901 -86.512c-23 -29 -55 -57 -101 -57c-22 0 -50 18 -61 34 l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29h-173v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-8 -15 -15 -31 -23 -47h-23c22 43 43 76 62 101s45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7 c45.295 0 70.889 -33.771 78.555 -78.298c10.936 17.832 21.467 33.168 31.445 46.298c19 25 45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7c45.295 0 70.889 -33.771 78.555 -78.298c10.937 17.832 21.467 33.168 31.445 46.298c19 25 45 37 76 38 c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7c45.295 0 70.889 -33.771 78.555 -78.298c10.937 17.832 21.467 33.168 31.445 46.298c19 25 45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7c45.29 0 70.89 -33.771 78.55 -78.298 c10.94 17.832 21.47 33.168 31.45 4"
+    "6.298c19 25 45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7c54 0 80 -48 81 -105c0 -47 -11 -68 -32 -94c-23 -29 -55 -57 -101 -57zM1162 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72 c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39zM862 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72 c2 18 3 31 4 39zM562 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39zM262 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72 c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E529[] =
+    "<symbol id=\"E529\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M1162 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39zM1100 1c-22 0 -50 18 -61 34l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29h-173v29h21 c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-4.568 -8.565 -8.81 -17.457 -13.099 -26.488c-1.135 -41.825 -12.05 -61.9349 -31.901 -86.512c-23 -29 -55 -57 -101 -57c-22 0 -50 18 -61 34l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29 h-173v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-4.568 -8.565 -8.81 -17.457 -13.099 -26.488c-1.135 -41.825 -12.05 -61.9349 -31.901 -86.512c-23 -29 -55 -57 -101 -57c-22 0 -50 18 -61 34l-56 -158l-3 -4 c3 -7 7 -10 12 -11h32v-29h-173v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-4.568 -8.565 -8.81 -17.457 -13.099 -26.488c-1.135 -41.825 -12.05 -61.9349 -31.901 -86.512c-23 -29 -55 -57 -101 -57c-22 0 -50 18 -61 34 l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29h-173v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-8 -15 -15 -31 -23 -47h-23c22 43 43 76 62 101s45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7 c45.295 0 70.889 -33.771 78.555 -78.298c10.936 17.832 21.467 33.168 31.445 46.298c19 25 45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7c45.295 0 70.889 -33.771 78.555 -78.298c10.937 17.832 21.467 33.168 31.445 46.298c19 25 45 37 76 38 c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7c45.295 0 70.889 -33.771 78.555 -78.298c10.937 17.832 21.467 33.168 31.445 46.298c19 25 45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7c54 0 80 -48 81 -105c0 -47 -11 -68 -32 -94 c-23 -29 -55 -57 -101 -57zM862 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39zM562 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14 c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62"
+    "c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39zM262 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27 c20 33 22 32 26 72c2 18 3 31 4 39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E52A[] =
+    "<symbol id=\"E52A\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M262 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39zM200 1c-22 0 -50 18 -61 34l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29h-173v29h21 c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-8 -15 -15 -31 -23 -47h-23c22 43 43 76 62 101s45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7c45.295 0 70.889 -33.771 78.555 -78.298 c10.936 17.832 21.467 33.168 31.445 46.298c19 25 45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7c45.295 0 70.889 -33.771 78.555 -78.298c10.937 17.832 21.467 33.168 31.445 46.298c19 25 45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7 c54 0 80 -48 81 -105c0 -47 -11 -68 -32 -94c-23 -29 -55 -57 -101 -57c-22 0 -50 18 -61 34l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29h-173v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17 c-4.568 -8.565 -8.81 -17.457 -13.099 -26.488c-1.135 -41.825 -12.05 -61.9349 -31.901 -86.512c-23 -29 -55 -57 -101 -57c-22 0 -50 18 -61 34l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29h-173v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3 c-23 0 -38 -25 -48 -43l-11 -17c-4.568 -8.565 -8.81 -17.457 -13.099 -26.488c-1.135 -41.825 -12.05 -61.9349 -31.901 -86.512c-23 -29 -55 -57 -101 -57zM858 130c2 18 3 31 4 39c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72 c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72zM558 130c2 18 3 31 4 39c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E52B[] =
+    "<symbol id=\"E52B\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M497 201c-12 -20.667 -21.667 -44.667 -29 -72c-6.667 -30 -10 -50.667 -10 -62c0 -24 7.333 -36 22 -36c12.667 0 23 2.333 31 7s15 11.333 21 20c10 16.667 15.333 26 16 28c4.667 11.333 8 26 10 44s3.333 31 4 39c0 7.333 -0.667 13.333 -2 18s-3.333 9.334 -6 14 c-5.333 9.333 -14.667 14 -28 14c-14 0 -23.667 -4.667 -29 -14zM197 201c-12 -20.667 -21.667 -44.667 -29 -72c-6.667 -30 -10 -50.667 -10 -62c0 -24 7.333 -36 22 -36c12.667 0 23 2.333 31 7s15 11.333 21 20c10 16.667 15.333 26 16 28c4.667 11.333 8 26 10 44 s3.333 31 4 39c0 7.333 -0.667 13.333 -2 18s-3.333 9.334 -6 14c-5.333 9.333 -14.667 14 -28 14c-14 0 -23.667 -4.667 -29 -14zM23 124h-23c22 42.667 42.667 76.333 62 101s44.667 37.333 76 38c6 0 12 -4.333 18 -13c6.667 -6.667 10 -15.667 10 -27l24 14l25 13 c12 4.667 24.333 7 37 7c24 0 43.333 -9.333 58 -28c10.361 -13.186 17.228 -29.865 20.603 -50.037c10.83 17.803 21.296 33.148 31.397 46.037c19.333 24.667 44.667 37.333 76 38c6 0 12 -4.333 18 -13c6.667 -6.667 10 -15.667 10 -27l24 14l25 13 c12 4.667 24.333 7 37 7c24 0 43.333 -9.333 58 -28s22.333 -44.333 23 -77c0 -14 -1 -26.667 -3 -38s-5.333 -21 -10 -29s-11 -17 -19 -27c-14 -18 -29.667 -32 -47 -42s-35.333 -15 -54 -15c-8.667 0 -19.667 3.33301 -33 10c-5.333 3.333 -10.333 6.667 -15 10 s-9 8 -13 14l-56 -158l-3 -4c2.667 -6.667 6.667 -10.333 12 -11h32v-29h-173v29h21c4 0 8.667 1.667 14 5c4 4 7 8.667 9 14l119 331v6l-3 10l-6 3c-8.667 0 -17 -4 -25 -12s-15.667 -18.333 -23 -31l-11 -17l-10 -20l-3.097 -6.433 c-0.296 -11.085 -1.263 -21.275 -2.903 -30.567c-2 -11.333 -5.333 -21 -10 -29s-11 -17 -19 -27c-14 -18 -29.667 -32 -47 -42c-17.333 -10 -35.333 -15 -54 -15c-8.667 0 -19.667 3.33301 -33 10c-5.333 3.333 -10.333 6.667 -15 10s-9 8 -13 14l-56 -158l-3 -4 c2.667 -6.667 6.667 -10.333 12 -11h32v-29h-173v29h21c4 0 8.667 1.667 14 5c4 4 7 8.667 9 14l119 331v6l-3 10l-6 3c-8.667 0 -17 -4 -25 -12s-15.667 -18.333 -23 -31l-11 -17l-10 -20z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E52C[] =
+    "<symbol id=\"E52C\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M605 1c-21.921 0 -50.348 18.0217 -61 34l-56 -158l-3 -4c2.667 -6.667 6.667 -10.333 12 -11h32v-29h-173v29h21c4 0 8.667 1.667 14 5c4 4 7 8.667 9 14l119 331v6l-3 10l-6 3c-22.568 0 -37.849 -25.466 -48 -43l-11 -17l-10 -20 c-12.629 -29.705 -24.742 -59.9244 -37 -90c-8.789 -21.6064 -31 -45 -44 -58s-29 -20 -46 -21c-18 0 -34 5 -49 14l-16 15c-3 7 -5 12 -5 17c20 63 44 124 65 186c0 7 -5 12 -15 13c-16 0 -31 -15 -44 -45l-64 -182h-71l77 214c0 9 -6 13 -17 13c-9 0 -17 -4 -22 -11 s-12 -19 -20 -34l-64 -182h-69l77 210v4c0 10 -5 12 -12 16c-25 0 -52 -47 -66 -73c-5 -9 -12 -23 -21 -42h-22c19 39 40 76 64 107c21 27 47 40 79 40c21 0 31 -19 34 -41c19 17 34 27 45 32c11 6 24 9 39 9c21 0 32 -19 35 -41c22 17 49 41 85 41c21 0 43 -14 43 -35v-7 l-63 -183c0 -13 4 -20 12 -21c8 0 17 5 26 15s15 16 16 17c4 7 18.617 31.6699 20 35l27 65c22 42.667 29.667 52.333 49 77s44.667 37.333 76 38c13.906 0 28 -23.105 28 -40l24 14l25 13c12 4.667 24.333 7 37 7c54.154 0 79.836 -47.991 81 -105 c0 -46.58 -11.173 -67.9667 -32 -94c-22.505 -28.9356 -55.456 -57 -101 -57zM667 169c0 26.223 -10.093 46 -36 46c-14 0 -23.667 -4.667 -29 -14c-12 -20.667 -21.667 -44.667 -29 -72c-6.667 -30 -10 -50.667 -10 -62c0 -24 7.333 -36 22 -36 c26.798 0 40.652 10.6075 52 27c19.524 32.5408 21.559 32.0317 26 72c2 18 3.333 31 4 39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E52D[] =
+    "<symbol id=\"E52D\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M311 -69c21.386 0 35 -30.9216 35 -51c0 -20.113 -12.603 -31.814 -21 -45c-4.664 -7.333 -8.33 -12 -11 -14c-5.521 -7.363 -1.338 -9.966 9 -11c35.076 0 54.222 54.5 67 89c6.667 18 11.667 35.333 15 52c20.706 88.2938 38.664 179.336 58 269h-58v38h70 c13.429 37.847 22.957 64.661 40 91c20.666 30 42.333 53 65 69s47.667 24 75 24c28.318 0 45.595 -13.674 51 -38l4 -16c0 -33.139 -1.003 -36.007 -13 -60c-3.138 -7.06 -17.383 -25.054 -31 -27c-4.667 -0.667 -10.333 -0.667 -17 0c-12.606 2.801 -16.566 17.612 -19 31 c0 27.28 11.325 44.216 29 56l14 10c0 8.667 -6 14 -18 16c-13.333 1.33 -24.667 -1.337 -34 -8c-9.333 -6.667 -19 -21 -29 -43c-6.914 -17.778 -25.9 -83.879 -31 -103h77v-40h-85c-19.014 -108.805 -60.061 -254.558 -103 -337c-23.657 -46.132 -64.302 -106 -117 -106 c-44.617 0 -71 36.683 -71 83c0 31.822 15.311 71 49 71zM337 262c21 0 43 -14 43 -35v-7l-63 -183c0 -13 4 -20 12 -21c8 0 17 5 26 15s15 16 16 17c4 7 18.633 31.6631 20 35l14 41h23l-24 -63c-8.304 -21.7969 -31 -45 -44 -58s-29 -20 -46 -21c-18 0 -34 5 -49 14 l-16 15c-3 7 -5 12 -5 17c20 63 44 124 65 186c0 7 -5 12 -15 13c-16 0 -31 -15 -44 -45l-64 -182h-71l77 214c0 9 -6 13 -17 13c-9 0 -17 -4 -22 -11s-12 -19 -20 -34l-64 -182h-69l77 210v4c0 10 -5 12 -12 16c-25 0 -52 -47 -66 -73c-5 -9 -12 -23 -21 -42h-22 c19 39 40 76 64 107c21 27 47 40 79 40c21 0 31 -19 34 -41c19 17 34 27 45 32c11 6 24 9 39 9c21 0 32 -19 35 -41c22 17 49 41 85 41z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E52E[] =
+    "<symbol id=\"E52E\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M239 -69c21.386 0 35 -30.9216 35 -51c0 -20.113 -12.603 -31.814 -21 -45c-4.664 -7.333 -8.33 -12 -11 -14c-5.521 -7.362 -1.338 -9.966 9 -11c35.076 0 54.222 54.5 67 89c6.667 18 11.667 35.333 15 52c20.706 88.2938 38.664 179.336 58 269h-58v38h70 c13.429 37.847 22.957 64.66 40 91c20.666 30 42.333 53 65 69c22.667 16 47.667 24 75 24c28.318 0 45.595 -13.674 51 -38l4 -16c0 -33.139 -1.003 -36.007 -13 -60c-3.138 -7.06 -17.383 -25.054 -31 -27c-4.667 -0.667 -10.333 -0.667 -17 0 c-12.606 2.801 -16.566 17.612 -19 31c0 27.28 11.325 44.216 29 56l14 10c0 8.667 -6 14 -18 16c-13.333 1.33 -24.667 -1.337 -34 -8c-9.333 -6.667 -19 -21 -29 -43c-6.914 -17.778 -25.9 -83.879 -31 -103h77v-40h-85c-19.014 -108.805 -60.061 -254.558 -103 -337 c-23.657 -46.132 -64.302 -106 -117 -106c-44.617 0 -71 36.683 -71 83c0 31.822 15.311 71 49 71zM200 1c-21.921 0 -50.348 18.0218 -61 34l-56 -158l-3 -4c2.667 -6.667 6.667 -10.333 12 -11h32v-29h-173v29h21c4 0 8.667 1.667 14 5c4 4 7 8.667 9 14l119 331v6l-3 10 l-6 3c-22.5687 0 -37.8494 -25.466 -48 -43l-11 -17c-7.8548 -15.479 -15.4422 -31.224 -23 -47h-23c22 42.667 42.667 76.333 62 101s44.667 37.333 76 38c13.906 0 28 -23.105 28 -40l24 14l25 13c12 4.667 24.333 7 37 7c54.154 0 79.836 -47.992 81 -105 c0 -46.58 -11.173 -67.9667 -32 -94c-22.505 -28.9356 -55.456 -57 -101 -57zM262 169c0 26.223 -10.092 46 -36 46c-14 0 -23.667 -4.667 -29 -14c-12 -20.667 -21.667 -44.667 -29 -72c-6.667 -30 -10 -50.667 -10 -62c0 -24 7.333 -36 22 -36 c26.799 0 40.652 10.6075 52 27c19.524 32.5412 21.559 32.0315 26 72c2 18 3.333 31 4 39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E52F[] =
+    "<symbol id=\"E52F\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M555 376c0 -38.167 -18.975 -68.244 -50 -76c-18 0 -28 10.667 -30 32c0 28.991 17.859 51.367 37 62c3.333 2.667 5 4.667 5 6l-6 9c-4.667 3.333 -10.333 5 -17 5c-37.333 0 -66.667 -52 -88 -156h75v-38h-83c-14.582 -93.098 -58.591 -249.73 -92 -318 c-15.333 -31.333 -32 -58 -50 -80c-16 -21.333 -37 -35.666 -63 -43l-19 -2c-43.276 0 -66 40.393 -66 87c0 38.8545 18.371 52.9045 44 67c23.954 0 38 -25.1264 38 -49c0 -14.667 -10.667 -36.333 -32 -65c0 -4.667 3 -7 9 -7c34 0 61.333 46.333 82 139 c7.329 29.0043 13.475 59.1919 20 89c13.093 60.574 26.152 121.181 39 182h-161c-14.168 -94.452 -55.7115 -241.428 -94 -318c-32.667 -72 -69.333 -113 -110 -123l-18 -2c-21.3311 0 -37.664 8.667 -49 26c-5.333 6 -10.333 15.333 -15 28 c-1.561 12.481 -2.738 19.127 -4 33c2.548 21.661 2.789 32.872 13 46c6.667 8.667 17.667 15.667 33 21c22.9336 0 35.7952 -26.418 37 -49c0 -11.389 -2.0371 -17.074 -5 -23l-14 -23l-15 -19c0 -4.667 3.333 -7 10 -7c27.0567 0 43.5807 29.161 54 50l14 36l15 53 c14.2142 63.1191 27.7116 126.955 41 191l17 80h-57v38h70c19.8959 66.797 51.192 121.091 103 159c24.667 16.667 52.333 25 83 25c32.81 0 49 -31.967 49 -66c0 -37.577 -18.199 -70.755 -51 -76c-16.667 0 -26 10.667 -28 32c0 11.335 3.333 23.668 10 37 c6.667 11.335 15.667 19.668 27 25c3.333 2.667 5 4.667 5 6c-6.889 9.646 -10.635 14 -25 14c-22 0 -40 -15.667 -54 -47s-25 -67 -33 -107h164c22.448 83.061 87.109 182 186 182c35.726 0 46.923 -30.706 49 -66z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E530[] =
+    "<symbol id=\"E530\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M363 -69c23 0 35 -23 36 -47c0 -8 -4 -23 -9 -31l-10 -15c-7 -10 -8 -12 -13 -21c0 -5 3 -7 10 -7c19 0 35 14 48 42c13 32 23 60 33 97c14 62 27 123 41 185l18 86h-140c-14 -89 -60 -256 -93 -318c-15 -31 -30 -57 -47 -79s-38 -37 -65 -44l-18 -2c-44 0 -67 40 -67 87 c0 39 18 53 45 67c6 0 11 -1 14 -4c14.846 -5.9384 23 -25.0512 23 -45c0 -15 -11 -36 -32 -65c0 -5 3 -7 9 -7c34 0 61 46 82 139c21.424 88.7557 39.772 180.774 59 271h-141c-13 -85 -62 -255 -93 -318c-33 -72 -70 -113 -110 -123l-19 -2c-35 0 -51 24 -63 54l-5 33 c5 39 13 55 46 67c23 0 38 -26 38 -49c0 -8 -2 -16 -6 -23l-14 -23l-14 -19c0 -5 3 -7 10 -7c11 0 21 5 30 15c18 15 26 46 37 71l15 53c17 77 34 155 50 233c3 13 6 26 9 38h-57v38h69c9 33 23 62 40 89c17 28 38 51 63 70c25 17 53 25 83 25c33 0 49 -30 49 -66 c0 -38 -19 -70 -50 -76c-17 0 -27 11 -29 32c0 27 17 53 37 62c3 0 5 2 5 6l-6 9c-5 3 -11 5 -18 5c-23 0 -41 -16 -55 -48s-25 -67 -32 -106h144c23 84 85 182 185 182c36 0 47 -31 49 -66c0 -18 -4 -35 -13 -51c-8 -12 -20 -20 -37 -25c-18 0 -28 11 -30 32 c0 29 18 51 37 62c3 0 5 2 5 6c-4 10 -11 14 -23 14c-37 0 -67 -52 -88 -156h144c15 49 39 93 72 132c31 36 69 54 114 54c34 0 49 -36 49 -70c0 -37 -19 -68 -51 -74c-16 0 -25 11 -27 32c0 26 18 52 35 62c4 0 6 2 6 6c-5 9 -11 14 -24 14c-37 0 -67 -52 -88 -156h76v-38 h-85c-7 -44 -15 -84 -26 -121c-18 -75 -39 -141 -66 -197c-15 -28 -31 -55 -50 -79c-16 -21 -36 -36 -61 -44l-18 -2c-35 0 -53 23 -62 54c-4 10 -6 21 -6 33c4 37 15 57 46 67z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E531[] =
+    "<symbol id=\"E531\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M132 -69c24.763 0 37 -24.374 37 -49c0 -15 -11 -36 -32 -65c0 -5 3 -7 9 -7c34 0 61 46 82 139c21.424 88.7559 39.772 180.774 59 271h-141c-13 -85 -62 -255 -93 -318c-33 -72 -70 -113 -110 -123l-19 -2c-35 0 -51 24 -63 54l-5 33c5 39 13 55 46 67 c23 0 38 -26 38 -49c0 -8 -2 -16 -6 -23l-14 -23l-14 -19c0 -5 3 -7 10 -7c11 0 21 5 30 15c18 15 26 46 37 71l15 53c17 77 34 155 50 233c3 13 6 26 9 38h-57v38h69c17.8976 65.624 55.166 122.646 103 159c25 17 53 25 83 25c33 0 49 -30 49 -66c0 -38 -19 -70 -50 -76 c-17 0 -27 11 -29 32c0 27 17 53 37 62c3 0 5 2 5 6l-6 9c-5 3 -11 5 -18 5c-23 0 -41 -16 -55 -48s-25 -67 -32 -106h144c23 84 85 182 185 182c36 0 47 -31 49 -66c0 -18 -4 -35 -13 -51c-8 -12 -20 -20 -37 -25c-18 0 -28 11 -30 32c0 29 18 51 37 62c3 0 5 2 5 6 c-4 10 -11 14 -23 14c-37 0 -67 -52 -88 -156h144c15 49 39 93 72 132c31 36 69 54 114 54c34 0 49 -36 49 -70c0 -37 -19 -68 -51 -74c-16 0 -25 11 -27 32c0 26 18 52 35 62c4 0 6 2 6 6c-5 9 -11 14 -24 14c-37 0 -67 -52 -88 -156h146 c13.429 37.847 22.957 64.661 40 91c20.666 30 42.333 53 65 69s47.667 24 75 24c28.318 0 45.6 -13.674 51 -38l4 -16c0 -33.139 -1 -36.007 -13 -60c-3.138 -7.06 -17.383 -25.054 -31 -27c-26.209 -3.746 -32.29 10.593 -36 31c0 27.28 11.325 44.216 29 56l14 10 c0 22.554 -39.004 17.278 -52 8c-9.333 -6.667 -19 -21 -29 -43c-6.914 -17.778 -25.9 -83.879 -31 -103h77v-40h-85c-19.014 -108.805 -60.061 -254.559 -103 -337c-23.657 -46.132 -64.302 -106 -117 -106c-44.617 0 -71 36.683 -71 83c0 31.822 15.31 71 49 71 c21.386 0 35 -30.9219 35 -51c0 -20.113 -12.602 -31.813 -21 -45c-6.9 -10.849 -24.139 -22.786 -2 -25c35.075 0 54.221 54.5 67 89c6.667 18 11.667 35.333 15 52c20.706 88.2939 38.664 179.336 58 269h-143c-7 -44 -15 -84 -26 -121c-18 -75 -39 -141 -66 -197 c-15 -28 -31 -55 -50 -79c-16 -21 -36 -36 -61 -44l-18 -2c-35 0 -53 23 -62 54c-4 10 -6 21 -6 33c4 37 15 57 46 67c23 0 35 -23 36 -47c0 -8 -4 -23 -9 -31l-10 -15c-7 -10 -8 -12 -13 -21c0 -5 3 -7 10 -7c19 0 35 14 48 42c13 32 23 60 33 97c14 62 27 123 41 185 l18 86h-140c-14 -89 -60 -256 -93 -318c-"
+    "15 -31 -30 -57 -47 -79s-38 -37 -65 -44l-18 -2c-44 0 -67 40 -67 87c0 39 18 53 45 67z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E532[] =
+    "<symbol id=\"E532\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M782 -140c0 -46.313 26.384 -83 71 -83c52.613 0 93.408 59.995 117 106c42.82 82.2051 84.03 228.455 103 337h85v40h-77c5.09 19.062 24.12 85.319 31 103c10 22 19.67 36.333 29 43c9.33 6.663 20.67 9.33 34 8c12 -2 18 -7.333 18 -16l-14 -10 c-17.69 -11.792 -29 -28.703 -29 -56c3.7 -20.397 9.71 -34.755 36 -31c13.61 1.944 27.87 19.96 31 27c11.99 23.987 13 26.851 13 60l-4 16c-2.98 13.46 -17.42 31.473 -28 35c-6 2 -13.67 3 -23 3c-27.33 0 -52.33 -8 -75 -24c-34.34 -24.233 -67.25 -64.511 -87 -113 c-4.67 -10.667 -10.67 -26.333 -18 -47h-148c5.1 19.121 24.086 87.222 31 105c10 22 19.667 36.333 29 43c13.029 9.302 52 14.565 52 -8l-14 -10c-17.675 -11.784 -29 -28.72 -29 -56c3.707 -20.387 9.706 -34.758 36 -31c13.617 1.946 27.862 19.94 31 27 c12 23.993 13 26.861 13 60l-4 16c-5.4 24.326 -22.682 38 -51 38c-27.333 0 -52.333 -8 -75 -24s-44.334 -39 -65 -69c-17.043 -26.339 -26.571 -53.153 -40 -91h-146c21 104 51 156 88 156c13 0 19 -5 24 -14c0 -4 -2 -6 -6 -6c-17 -10 -35 -36 -35 -62 c2 -21 11 -32 27 -32c32 6 51 37 51 74c0 34 -15 70 -49 70c-45 0 -83 -18 -114 -54c-33 -39 -57 -83 -72 -132h-144c21 104 51 156 88 156c12 0 19 -4 23 -14c0 -4 -2 -6 -5 -6c-19 -11 -37 -33 -37 -62c2 -21 12 -32 30 -32c17 5 29 13 37 25c9 16 13 33 13 51 c-2 35 -13 66 -49 66c-100 0 -162 -98 -185 -182h-144c7 39 18 74 32 106s32 48 55 48c7 0 13 -2 18 -5l6 -9c0 -4 -2 -6 -5 -6c-20 -9 -37 -35 -37 -62c2 -21 12 -32 29 -32c31 6 50 38 50 76c0 36 -16 66 -49 66c-30 0 -58 -8 -83 -25 c-47.847 -36.364 -85.1035 -93.38 -103 -159h-69v-38h57c-3 -12 -6 -25 -9 -38c-16 -78 -33 -156 -50 -233l-15 -53c-11 -25 -19 -56 -37 -71c-9 -10 -19 -15 -30 -15c-7 0 -10 2 -10 7l14 19l14 23c4 7 6 15 6 23c0 23 -15 49 -38 49c-33 -12 -41 -28 -46 -67l5 -33 c12 -30 28 -54 63 -54l19 2c40 10 77 51 110 123c31 63 80 233 93 318h141c-19.228 -90.226 -37.576 -182.244 -59 -271c-21 -93 -48 -139 -82 -139c-6 0 -9 2 -9 7c21 29 32 50 32 65c0 19.9492 -8.154 39.0615 -23 45c-3 3 -8 4 -14 4c-27 -14 -45 -28 -45 -67 c0 -47 23 -87 67 -87l18 2c27 7 48 22 65 44s32 48 47 79c33 62 79 229 93 31"
+    "8h140l-18 -86c-14 -62 -27 -123 -41 -185c-10 -37 -20 -65 -33 -97c-13 -28 -29 -42 -48 -42c-7 0 -10 2 -10 7c5 9 6 11 13 21l10 15c5 8 9 23 9 31c-1 24 -13 47 -36 47 c-31 -10 -42 -30 -46 -67c0 -12 2 -23 6 -33c9 -31 27 -54 62 -54l18 2c55.296 17.695 85.052 74.564 111 123c27 56 48 122 66 197c11 37 19 77 26 121h143c-19.336 -89.664 -37.294 -180.706 -58 -269c-3.333 -16.667 -8.333 -34 -15 -52 c-12.779 -34.5 -31.925 -89 -67 -89c-22.142 2.215 -4.876 14.189 2 25c8.398 13.187 21 24.887 21 45c0 20.0781 -13.614 51 -35 51c-33.69 0 -49 -39.178 -49 -71c0 -46.317 26.383 -83 71 -83c52.698 0 93.343 59.868 117 106c42.939 82.4414 83.986 228.195 103 337h144 l-44 -208l-14 -61c-6.58 -32.9016 -22.229 -73.182 -35 -100c-12.667 -27.333 -28.333 -41 -47 -41c-22.144 2.215 -4.877 14.187 2 25c8.404 13.196 21 24.878 21 45c0 20.0793 -13.618 51 -35 51c-33.679 0 -49 -39.183 -49 -71z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E533[] =
+    "<symbol id=\"E533\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-94 -69c21.3858 0 35 -30.9216 35 -51c0 -20.113 -12.6027 -31.814 -21 -45c-4.6641 -7.333 -8.3301 -12 -11 -14c-5.5211 -7.362 -1.3376 -9.966 9 -11c35.0757 0 54.2215 54.5 67 89c6.66699 18 11.667 35.333 15 52c20.7062 88.2938 38.6638 179.336 58 269h-58v38 h70c13.4288 37.847 22.9568 64.66 40 91c20.666 30 42.333 53 65 69s47.667 24 75 24c28.318 0 45.595 -13.674 51 -38l4 -16c0 -33.139 -1.003 -36.007 -13 -60c-3.138 -7.06 -17.383 -25.054 -31 -27c-25.54 -3.65 -32.191 10.048 -36 31c0 27.279 11.326 44.217 29 56 l14 10c0 22.553 -39.004 17.278 -52 8c-30.032 -21.453 -48.084 -103.32 -60 -148l77.5 -0.5l-4.5 -37.5h-81c-19.014 -108.805 -60.0609 -254.559 -103 -337c-23.6569 -46.132 -64.3023 -106 -117 -106c-44.617 0 -71 36.683 -71 83c0 31.822 15.311 71 49 71zM1014 -140 c0 -46.313 26.38 -83 71 -83c52.61 0 93.41 59.995 117 106c42.82 82.2052 84.03 228.455 103 337h85v40h-77c5.09 19.062 24.12 85.319 31 103c10 22 19.67 36.333 29 43c13.03 9.304 52 14.563 52 -8l-14 -10c-17.69 -11.792 -29 -28.703 -29 -56 c3.7 -20.397 9.71 -34.755 36 -31c13.61 1.945 27.87 19.96 31 27c11.99 23.987 13 26.851 13 60l-4 16c-2.98 13.46 -17.42 31.473 -28 35c-6 2 -13.67 3 -23 3c-27.33 0 -52.33 -8 -75 -24c-34.34 -24.233 -67.25 -64.511 -87 -113c-4.67 -10.667 -10.67 -26.333 -18 -47 h-148c5.1 19.121 24.09 87.222 31 105c10 22 19.67 36.333 29 43c13.03 9.302 52 14.565 52 -8l-14 -10c-17.67 -11.784 -29 -28.72 -29 -56c3.71 -20.387 9.71 -34.758 36 -31c13.62 1.946 27.86 19.94 31 27c12 23.993 13 26.861 13 60l-4 16 c-5.4 24.326 -22.68 38 -51 38c-27.33 0 -52.33 -8 -75 -24s-44.33 -39 -65 -69c-17.04 -26.339 -26.57 -53.153 -40 -91h-146c21 104 51 156 88 156c13 0 19 -5 24 -14c0 -4 -2 -6 -6 -6c-17 -10 -35 -36 -35 -62c2 -21 11 -32 27 -32c32 6 51 37 51 74c0 34 -15 70 -49 70 c-45 0 -83 -18 -114 -54c-33 -39 -57 -83 -72 -132h-144c21 104 51 156 88 156c12 0 19 -4 23 -14c0 -4 -2 -6 -5 -6c-19 -11 -37 -33 -37 -62c2 -21 12 -32 30 -32c17 5 29 13 37 25c9 16 13 33 13 51c-2 35 -13 66 -49 66c-100 0 -162 -98 -185 -182h-144 c7 39 18 74 32 106s32 48 55"
+    " 48c7 0 13 -2 18 -5l6 -9c0 -4 -2 -6 -5 -6c-20 -9 -37 -35 -37 -62c2 -21 12 -32 29 -32c31 6 50 38 50 76c0 36 -16 66 -49 66c-30 0 -58 -8 -83 -25c-25 -19 -46 -42 -63 -70c-17 -27 -26 -56 -35 -89h-80l2.5 -37.5l60.5 -0.5 c-3 -12 -6 -25 -9 -38c-16 -78 -33 -156 -50 -233l-15 -53c-11 -25 -19 -56 -37 -71c-9 -10 -19 -15 -30 -15c-7 0 -10 2 -10 7l14 19l14 23c4 7 6 15 6 23c0 23 -15 49 -38 49c-33 -12 -41 -28 -46 -67l5 -33c12 -30 28 -54 63 -54l19 2c40 10 77 51 110 123 c31 63 80 233 93 318h141c-19.228 -90.226 -37.576 -182.244 -59 -271c-21 -93 -48 -139 -82 -139c-6 0 -9 2 -9 7c21 29 32 50 32 65c0 19.9492 -8.154 39.0615 -23 45c-3 3 -8 4 -14 4c-27 -14 -45 -28 -45 -67c0 -47 23 -87 67 -87l18 2c27 7 48 22 65 44s32 48 47 79 c33 62 79 229 93 318h140l-18 -86c-14 -62 -27 -123 -41 -185c-10 -37 -20 -65 -33 -97c-13 -28 -29 -42 -48 -42c-7 0 -10 2 -10 7c5 9 6 11 13 21l10 15c5 8 9 23 9 31c-1 24 -13 47 -36 47c-31 -10 -42 -30 -46 -67c0 -12 2 -23 6 -33c9 -31 27 -54 62 -54l18 2 c55.296 17.695 85.052 74.564 111 123c27 56 48 122 66 197c11 37 19 77 26 121h143c-19.336 -89.664 -37.294 -180.706 -58 -269c-3.333 -16.667 -8.333 -34 -15 -52c-12.779 -34.5 -31.925 -89 -67 -89c-22.142 2.215 -4.876 14.189 2 25c8.398 13.187 21 24.887 21 45 c0 20.0781 -13.614 51 -35 51c-33.69 0 -49 -39.178 -49 -71c0 -46.317 26.383 -83 71 -83c52.698 0 93.343 59.868 117 106c42.94 82.4414 83.99 228.195 103 337h144l-44 -208l-14 -61c-6.58 -32.9016 -22.23 -73.182 -35 -100c-12.67 -27.333 -28.33 -41 -47 -41 c-22.14 2.215 -4.88 14.187 2 25c8.4 13.196 21 24.878 21 45c0 20.0793 -13.62 51 -35 51c-33.68 0 -49 -39.183 -49 -71z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E534[] =
+    "<symbol id=\"E534\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M432 1c-21.921 0 -50.348 18.0217 -61 34l-56 -158l-3 -4c2.667 -6.667 6.667 -10.333 12 -11h32v-29h-173v29h21c4 0 8.667 1.667 14 5c4 4 7 8.667 9 14l119 331v6l-3 10l-6 3c-22.568 0 -37.849 -25.466 -48 -43l-11 -17c-7.855 -15.479 -15.442 -31.224 -23 -47h-23 c22 42.667 42.667 76.333 62 101s44.667 37.333 76 38c13.906 0 28 -23.105 28 -40l24 14l25 13c12 4.667 24.333 7 37 7c54.154 0 79.836 -47.991 81 -105c0 -46.58 -11.173 -67.9667 -32 -94c-22.505 -28.9356 -55.456 -57 -101 -57zM494 169c0 26.223 -10.092 46 -36 46 c-14 0 -23.667 -4.667 -29 -14c-12 -20.667 -21.667 -44.667 -29 -72c-6.667 -30 -10 -50.667 -10 -62c0 -24 7.333 -36 22 -36c26.798 0 40.652 10.6075 52 27c19.524 32.5408 21.559 32.0317 26 72c2 18 3.333 31 4 39zM-94 -69c21.3858 0 35 -30.9216 35 -51 c0 -20.113 -12.6027 -31.814 -21 -45c-4.6641 -7.333 -8.3301 -12 -11 -14c-5.5211 -7.362 -1.3376 -9.966 9 -11c35.0757 0 54.2215 54.5 67 89c6.66699 18 11.667 35.333 15 52c20.7062 88.2938 38.6638 179.336 58 269h-58v38h70c13.4288 37.847 22.9568 64.66 40 91 c20.666 30 42.333 53 65 69s47.667 24 75 24c28.318 0 45.595 -13.674 51 -38l4 -16c0 -33.139 -1.003 -36.007 -13 -60c-3.138 -7.06 -17.383 -25.054 -31 -27c-4.667 -0.667 -10.333 -0.667 -17 0c-12.607 2.801 -16.566 17.612 -19 31c0 27.279 11.326 44.217 29 56 l14 10c0 8.667 -6 14 -18 16c-13.333 1.33 -24.667 -1.337 -34 -8c-9.333 -6.667 -19 -21 -29 -43c-6.914 -17.779 -25.9 -83.878 -31 -103h77v-40h-85c-19.014 -108.805 -60.0609 -254.559 -103 -337c-23.6569 -46.132 -64.3023 -106 -117 -106 c-44.617 0 -71 36.683 -71 83c0 31.822 15.311 71 49 71z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E535[] =
+    "<symbol id=\"E535\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M405 115c21 0 34 -23 34 -48c0 -23 -8 -42 -24 -58c-15 -17 -39 -25 -73 -25c-12 0 -21 1 -27 4l-12 6l-17 10c-15 7 -24 10 -29 10c-9 0 -19 -5 -30 -14h-31v16l209 177l-64 -1c-23 -3 -32 -15 -44 -30h-24l30 87h189v-32l-211 -163c13 6 26 9 39 9c14 0 53 -18 63 -20 c9 1 14 8 14 19c-13 0 -20 8 -22 23c0 17 13 30 30 30zM-94 -69c21.3858 0 35 -30.9216 35 -51c0 -20.113 -12.6027 -31.814 -21 -45c-4.6641 -7.333 -8.3301 -12 -11 -14c-5.5211 -7.362 -1.3376 -9.966 9 -11c35.0757 0 54.2215 54.5 67 89 c6.66699 18 11.667 35.333 15 52c20.7062 88.2938 38.6638 179.336 58 269h-58v38h70c13.4288 37.847 22.9568 64.66 40 91c20.666 30 42.333 53 65 69s47.667 24 75 24c28.318 0 45.595 -13.674 51 -38l4 -16c0 -33.139 -1.003 -36.007 -13 -60 c-3.138 -7.06 -17.383 -25.054 -31 -27c-4.667 -0.667 -10.333 -0.667 -17 0c-12.607 2.801 -16.566 17.612 -19 31c0 27.279 11.326 44.217 29 56l14 10c0 8.667 -6 14 -18 16c-13.333 1.33 -24.667 -1.337 -34 -8c-9.333 -6.667 -19 -21 -29 -43 c-6.914 -17.779 -25.9 -83.878 -31 -103h77v-40h-85c-19.014 -108.805 -60.0609 -254.559 -103 -337c-23.6569 -46.132 -64.3023 -106 -117 -106c-44.617 0 -71 36.683 -71 83c0 31.822 15.311 71 49 71z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E536[] =
+    "<symbol id=\"E536\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M100 -69c21.386 0 35 -30.9216 35 -51c0 -20.113 -12.603 -31.814 -21 -45c-4.664 -7.333 -8.33 -12 -11 -14c-5.5211 -7.362 -1.338 -9.966 9 -11c35.076 0 54.222 54.5 67 89c6.667 18 11.667 35.333 15 52c20.706 88.2938 38.664 179.336 58 269h-58v38h70 c13.429 37.847 22.957 64.66 40 91c20.666 30 42.333 53 65 69s47.667 24 75 24c28.318 0 45.595 -13.674 51 -38l4 -16c0 -33.139 -1.003 -36.007 -13 -60c-3.138 -7.06 -17.383 -25.054 -31 -27c-25.54 -3.65 -32.191 10.048 -36 31c0 27.28 11.325 44.216 29 56l14 10 c0 22.553 -39.004 17.278 -52 8c-29.305 -20.934 -48.347 -102.305 -60 -146h77v-40h-85c-19.014 -108.805 -60.061 -254.558 -103 -337c-23.657 -46.132 -64.302 -106 -117 -106c-44.6166 0 -71 36.683 -71 83c0 31.822 15.3106 71 49 71zM81 33c21 0 38 15 40 34 c0 18.3072 -12.1 29.5701 -27 40c-22 13 -38 26 -47 38s-14 26 -15 43c0 50 40 82 87 82l28 -3c9 -3 17 -7 24 -13c15 -9 23 -24 23 -43l-1 -10l-6 -10c-3 -5 -8 -9 -17 -10c-17 0 -26 8 -29 24l4 19c0 10 -14 16 -24 18c-19 3 -32 -16 -35 -36c0 -7 4 -15 11 -22 c9 -7 18 -14 26 -21c28 -23 43 -37 44 -40c8 -10 12 -23 12 -39v-10c0 -21 -10 -39 -29 -54c-16 -10 -38 -18 -61 -20c-47 0 -89 26 -89 67l1 15l5 13l10 9l13 4c16 0 24 -10 24 -31c0 -13 -5 -16 -8 -28c0 -8 11 -16 23 -16h13z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E537[] =
+    "<symbol id=\"E537\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M628 1c-21.921 0 -50.348 18.0217 -61 34l-56 -158l-3 -4c2.667 -6.667 6.667 -10.333 12 -11h32v-29h-173v29h21c4 0 8.667 1.667 14 5c4 4 7 8.667 9 14l119 331v6l-3 10l-6 3c-22.568 0 -37.849 -25.466 -48 -43l-11 -17c-7.855 -15.479 -15.442 -31.224 -23 -47h-23 c22 42.667 42.667 76.333 62 101s44.667 37.333 76 38c13.906 0 28 -23.105 28 -40l24 14l25 13c12 4.667 24.333 7 37 7c54.154 0 79.836 -47.991 81 -105c0 -46.58 -11.173 -67.9667 -32 -94c-22.505 -28.9356 -55.456 -57 -101 -57zM690 169c0 26.223 -10.093 46 -36 46 c-14 0 -23.667 -4.667 -29 -14c-12 -20.667 -21.667 -44.667 -29 -72c-6.667 -30 -10 -50.667 -10 -62c0 -24 7.333 -36 22 -36c26.798 0 40.652 10.6075 52 27c19.524 32.5408 21.559 32.0317 26 72c2 18 3.333 31 4 39zM100 -69c21.386 0 35 -30.9216 35 -51 c0 -20.113 -12.603 -31.814 -21 -45c-4.664 -7.333 -8.33 -12 -11 -14c-5.5211 -7.362 -1.338 -9.966 9 -11c35.076 0 54.222 54.5 67 89c6.667 18 11.667 35.333 15 52c20.706 88.2938 38.664 179.336 58 269h-58v38h70c13.429 37.847 22.957 64.66 40 91 c20.666 30 42.333 53 65 69s47.667 24 75 24c28.318 0 45.595 -13.674 51 -38l4 -16c0 -33.139 -1.003 -36.007 -13 -60c-3.138 -7.06 -17.383 -25.054 -31 -27c-25.54 -3.65 -32.191 10.048 -36 31c0 27.28 11.325 44.216 29 56l14 10c0 22.553 -39.004 17.278 -52 8 c-29.305 -20.934 -48.347 -102.305 -60 -146h77v-40h-85c-19.014 -108.805 -60.061 -254.558 -103 -337c-23.657 -46.132 -64.302 -106 -117 -106c-44.6166 0 -71 36.683 -71 83c0 31.822 15.3106 71 49 71zM81 33c21 0 38 15 40 34c0 18.3072 -12.1 29.5701 -27 40 c-22 13 -38 26 -47 38s-14 26 -15 43c0 50 40 82 87 82l28 -3c9 -3 17 -7 24 -13c15 -9 23 -24 23 -43l-1 -10l-6 -10c-3 -5 -8 -9 -17 -10c-17 0 -26 8 -29 24l4 19c0 10 -14 16 -24 18c-19 3 -32 -16 -35 -36c0 -7 4 -15 11 -22c9 -7 18 -14 26 -21c28 -23 43 -37 44 -40 c8 -10 12 -23 12 -39v-10c0 -21 -10 -39 -29 -54c-16 -10 -38 -18 -61 -20c-47 0 -89 26 -89 67l1 15l5 13l10 9l13 4c16 0 24 -10 24 -31c0 -13 -5 -16 -8 -28c0 -8 11 -16 23 -16h13z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E538[] =
+    "<symbol id=\"E538\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M990 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39zM690 169c0 26 -10 46 -36 46c-14 0 -24 -5 -29 -14c-12 -21 -22 -45 -29 -72 c-7 -30 -10 -51 -10 -62c0 -24 7 -36 22 -36c27 0 41 11 52 27c20 33 22 32 26 72c2 18 3 31 4 39zM628 1c-22 0 -50 18 -61 34l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29h-173v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17 c-8 -15 -15 -31 -23 -47h-23c22 43 43 76 62 101s45 37 76 38c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7c45 0 72 -35 79 -78c25 41 51 83 107 84c14 0 28 -23 28 -40l24 14l25 13c12 5 24 7 37 7c54 0 80 -48 81 -105c0 -47 -11 -68 -32 -94 c-23 -29 -55 -57 -101 -57c-22 0 -50 18 -61 34l-56 -158l-3 -4c3 -7 7 -10 12 -11h32v-29h-173v29h21c4 0 9 2 14 5c4 4 7 9 9 14l119 331v6l-3 10l-6 3c-23 0 -38 -25 -48 -43l-11 -17c-4 -9 -9 -17 -13 -26c-1 -43 -12 -62 -32 -87c-23 -29 -55 -57 -101 -57zM100 -69 c21 0 35 -31 35 -51s-13 -32 -21 -45c-5 -7 -8 -12 -11 -14c-6 -7 -1 -10 9 -11c35 0 54 54 67 89c7 18 12 35 15 52c21 88 39 179 58 269h-58v38h70c13 38 23 65 40 91c21 30 42 53 65 69s48 24 75 24c28 0 46 -14 51 -38l4 -16c0 -33 -1 -36 -13 -60 c-3 -7 -17 -25 -31 -27c-26 -4 -32 10 -36 31c0 27 11 44 29 56l14 10c0 23 -39 17 -52 8c-29 -21 -48 -102 -60 -146h77v-40h-85c-19 -109 -60 -255 -103 -337c-24 -46 -64 -106 -117 -106c-45 0 -71 37 -71 83c0 32 15 71 49 71zM81 33c21 0 38 15 40 34 c0 18 -12 30 -27 40c-22 13 -38 26 -47 38s-14 26 -15 43c0 50 40 82 87 82l28 -3c9 -3 17 -7 24 -13c15 -9 23 -24 23 -43l-1 -10l-6 -10c-3 -5 -8 -9 -17 -10c-17 0 -26 8 -29 24l4 19c0 10 -14 16 -24 18c-19 3 -32 -16 -35 -36c0 -7 4 -15 11 -22c9 -7 18 -14 26 -21 c28 -23 43 -37 44 -40c8 -10 12 -23 12 -39v-10c0 -21 -10 -39 -29 -54c-16 -10 -38 -18 -61 -20c-47 0 -89 26 -89 67l1 15l5 13l10 9l13 4c16 0 24 -10 24 -31c0 -13 -5 -16 -8 -28c0 -8 11 -16 23 -16h13z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E539[] =
+    "<symbol id=\"E539\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M601 115c21 0 34 -23 34 -48c0 -23 -8 -42 -24 -58c-15 -17 -39 -25 -73 -25c-12 0 -21 1 -27 4l-12 6l-17 10c-15 7 -24 10 -29 10c-9 0 -19 -5 -30 -14h-31v16l209 177l-64 -1c-23 -3 -32 -15 -44 -30h-24l30 87h189v-32l-211 -163c13 6 26 9 39 9c14 0 53 -18 63 -20 c9 1 14 8 14 19c-13 0 -20 8 -22 23c0 17 13 30 30 30zM100 -69c21.386 0 35 -30.9216 35 -51c0 -20.113 -12.603 -31.814 -21 -45c-4.664 -7.333 -8.33 -12 -11 -14c-5.5211 -7.362 -1.338 -9.966 9 -11c35.076 0 54.222 54.5 67 89c6.667 18 11.667 35.333 15 52 c20.706 88.2938 38.664 179.336 58 269h-58v38h70c13.429 37.847 22.957 64.66 40 91c20.666 30 42.333 53 65 69s47.667 24 75 24c28.318 0 45.595 -13.674 51 -38l4 -16c0 -33.139 -1.003 -36.007 -13 -60c-3.138 -7.06 -17.383 -25.054 -31 -27 c-25.54 -3.65 -32.191 10.048 -36 31c0 27.28 11.325 44.216 29 56l14 10c0 22.553 -39.004 17.278 -52 8c-29.305 -20.934 -48.347 -102.305 -60 -146h77v-40h-85c-19.014 -108.805 -60.061 -254.558 -103 -337c-23.657 -46.132 -64.302 -106 -117 -106 c-44.6166 0 -71 36.683 -71 83c0 31.822 15.3106 71 49 71zM81 33c21 0 38 15 40 34c0 18.3072 -12.1 29.5701 -27 40c-22 13 -38 26 -47 38s-14 26 -15 43c0 50 40 82 87 82l28 -3c9 -3 17 -7 24 -13c15 -9 23 -24 23 -43l-1 -10l-6 -10c-3 -5 -8 -9 -17 -10 c-17 0 -26 8 -29 24l4 19c0 10 -14 16 -24 18c-19 3 -32 -16 -35 -36c0 -7 4 -15 11 -22c9 -7 18 -14 26 -21c28 -23 43 -37 44 -40c8 -10 12 -23 12 -39v-10c0 -21 -10 -39 -29 -54c-16 -10 -38 -18 -61 -20c-47 0 -89 26 -89 67l1 15l5 13l10 9l13 4c16 0 24 -10 24 -31 c0 -13 -5 -16 -8 -28c0 -8 11 -16 23 -16h13z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E53A[] =
+    "<symbol id=\"E53A\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M888 1c-21.921 0 -50.348 18.0217 -61 34l-56 -158l-3 -4c2.667 -6.667 6.667 -10.333 12 -11h32v-29h-173v29h21c4 0 8.667 1.667 14 5c4 4 7 8.667 9 14l119 331v6l-3 10l-6 3c-22.568 0 -37.849 -25.466 -48 -43l-11 -17c-7.855 -15.479 -15.442 -31.224 -23 -47h-23 c22 42.667 42.667 76.333 62 101s44.667 37.333 76 38c13.906 0 28 -23.105 28 -40l24 14l25 13c12 4.667 24.333 7 37 7c54.154 0 79.84 -47.991 81 -105c0 -46.58 -11.17 -67.9667 -32 -94c-22.505 -28.9356 -55.456 -57 -101 -57zM950 169c0 26.223 -10.093 46 -36 46 c-14 0 -23.667 -4.667 -29 -14c-12 -20.667 -21.667 -44.667 -29 -72c-6.667 -30 -10 -50.667 -10 -62c0 -24 7.333 -36 22 -36c26.798 0 40.652 10.6075 52 27c19.524 32.5408 21.559 32.0317 26 72c2 18 3.333 31 4 39zM601 115c21 0 34 -23 34 -48c0 -23 -8 -42 -24 -58 c-15 -17 -39 -25 -73 -25c-12 0 -21 1 -27 4l-12 6l-17 10c-15 7 -24 10 -29 10c-9 0 -19 -5 -30 -14h-31v16l209 177l-64 -1c-23 -3 -32 -15 -44 -30h-24l30 87h189v-32l-211 -163c13 6 26 9 39 9c14 0 53 -18 63 -20c9 1 14 8 14 19c-13 0 -20 8 -22 23c0 17 13 30 30 30z M100 -69c21.386 0 35 -30.9216 35 -51c0 -20.113 -12.603 -31.814 -21 -45c-4.664 -7.333 -8.33 -12 -11 -14c-5.5211 -7.362 -1.338 -9.966 9 -11c35.076 0 54.222 54.5 67 89c6.667 18 11.667 35.333 15 52c20.706 88.2938 38.664 179.336 58 269h-58v38h70 c13.429 37.847 22.957 64.66 40 91c20.666 30 42.333 53 65 69s47.667 24 75 24c28.318 0 45.595 -13.674 51 -38l4 -16c0 -33.139 -1.003 -36.007 -13 -60c-3.138 -7.06 -17.383 -25.054 -31 -27c-25.54 -3.65 -32.191 10.048 -36 31c0 27.28 11.325 44.216 29 56l14 10 c0 22.553 -39.004 17.278 -52 8c-29.305 -20.934 -48.347 -102.305 -60 -146h77v-40h-85c-19.014 -108.805 -60.061 -254.558 -103 -337c-23.657 -46.132 -64.302 -106 -117 -106c-44.6166 0 -71 36.683 -71 83c0 31.822 15.3106 71 49 71zM81 33c21 0 38 15 40 34 c0 18.3072 -12.1 29.5701 -27 40c-22 13 -38 26 -47 38s-14 26 -15 43c0 50 40 82 87 82l28 -3c9 -3 17 -7 24 -13c15 -9 23 -24 23 -43l-1 -10l-6 -10c-3 -5 -8 -9 -17 -10c-17 0 -26 8 -29 24l4 19c0 10 -14 16 -24 18c-19 3 -32 -16 -35 -36c0 -7 4 -15"
+    " 11 -22 c9 -7 18 -14 26 -21c28 -23 43 -37 44 -40c8 -10 12 -23 12 -39v-10c0 -21 -10 -39 -29 -54c-16 -10 -38 -18 -61 -20c-47 0 -89 26 -89 67l1 15l5 13l10 9l13 4c16 0 24 -10 24 -31c0 -13 -5 -16 -8 -28c0 -8 11 -16 23 -16h13z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E53B[] =
+    "<symbol id=\"E53B\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M833 115c21 0 34 -23 34 -48c0 -23 -8 -42 -24 -58c-15 -17 -39 -25 -73 -25c-12 0 -21 1 -27 4l-12 6l-17 10c-15 7 -24 10 -29 10c-9 0 -19 -5 -30 -14h-31v16l209 177l-64 -1c-23 -3 -32 -15 -44 -30h-24l30 87h189v-32l-211 -163c13 6 26 9 39 9c14 0 53 -18 63 -20 c9 1 14 8 14 19c-13 0 -20 8 -22 23c0 17 13 30 30 30zM334 -69c21.386 0 35 -30.9216 35 -51c0 -20.113 -12.603 -31.814 -21 -45c-4.664 -7.333 -8.33 -12 -11 -14c-5.521 -7.363 -1.338 -9.966 9 -11c35.076 0 54.222 54.5 67 89c6.667 18 11.667 35.333 15 52 c20.706 88.2938 38.664 179.336 58 269h-58v38h70c13.429 37.847 22.957 64.661 40 91c20.666 30 42.333 53 65 69s47.667 24 75 24c28.318 0 45.595 -13.674 51 -38l4 -16c0 -33.139 -1.003 -36.007 -13 -60c-3.138 -7.06 -17.383 -25.054 -31 -27 c-4.667 -0.667 -10.333 -0.667 -17 0c-12.606 2.801 -16.566 17.612 -19 31c0 27.28 11.325 44.216 29 56l14 10c0 8.667 -6 14 -18 16c-13.333 1.33 -24.667 -1.337 -34 -8c-9.333 -6.667 -19 -21 -29 -43c-6.914 -17.778 -25.9 -83.879 -31 -103h77v-40h-85 c-19.014 -108.805 -60.061 -254.558 -103 -337c-23.657 -46.132 -64.302 -106 -117 -106c-44.617 0 -71 36.683 -71 83c0 31.822 15.311 71 49 71zM100 -69c21.386 0 35 -30.9216 35 -51c0 -20.113 -12.603 -31.814 -21 -45c-4.664 -7.333 -8.33 -12 -11 -14 c-5.5211 -7.362 -1.338 -9.966 9 -11c35.076 0 54.222 54.5 67 89c6.667 18 11.667 35.333 15 52c20.706 88.2938 38.664 179.336 58 269h-58v38h70c13.429 37.847 22.957 64.66 40 91c20.666 30 42.333 53 65 69s47.667 24 75 24c28.318 0 45.595 -13.674 51 -38l4 -16 c0 -33.139 -1.003 -36.007 -13 -60c-3.138 -7.06 -17.383 -25.054 -31 -27c-25.54 -3.65 -32.191 10.048 -36 31c0 27.28 11.325 44.216 29 56l14 10c0 22.553 -39.004 17.278 -52 8c-29.305 -20.934 -48.347 -102.305 -60 -146h77v-40h-85 c-19.014 -108.805 -60.061 -254.558 -103 -337c-23.657 -46.132 -64.302 -106 -117 -106c-44.6166 0 -71 36.683 -71 83c0 31.822 15.3106 71 49 71zM81 33c21 0 38 15 40 34c0 18.3072 -12.1 29.5701 -27 40c-22 13 -38 26 -47 38s-14 26 -15 43c0 50 40 82 87 82l28 -3 c9 -3 17 -7 24 -13c15 -9 23 -24 23 -43l-1 -10l-6 -10c-"
+    "3 -5 -8 -9 -17 -10c-17 0 -26 8 -29 24l4 19c0 10 -14 16 -24 18c-19 3 -32 -16 -35 -36c0 -7 4 -15 11 -22c9 -7 18 -14 26 -21c28 -23 43 -37 44 -40c8 -10 12 -23 12 -39v-10c0 -21 -10 -39 -29 -54 c-16 -10 -38 -18 -61 -20c-47 0 -89 26 -89 67l1 15l5 13l10 9l13 4c16 0 24 -10 24 -31c0 -13 -5 -16 -8 -28c0 -8 11 -16 23 -16h13z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E53C[] =
+    "<symbol id=\"E53C\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M131 -69c21.386 0 35 -30.9216 35 -51c0 -20.113 -12.603 -31.814 -21 -45c-4.664 -7.333 -8.33 -12 -11 -14c-5.521 -7.362 -1.338 -9.966 9 -11c35.076 0 54.222 54.5 67 89c6.667 18 11.667 35.333 15 52c20.706 88.2938 38.664 179.336 58 269h-58v38h70 c13.429 37.847 22.957 64.66 40 91c20.666 30 42.333 53 65 69s47.667 24 75 24c28.318 0 45.595 -13.674 51 -38l4 -16c0 -33.139 -1.003 -36.007 -13 -60c-3.138 -7.06 -17.383 -25.054 -31 -27c-4.667 -0.667 -10.333 -0.667 -17 0c-12.606 2.801 -16.566 17.612 -19 31 c0 27.28 11.325 44.216 29 56l14 10c0 8.667 -6 14 -18 16c-13.333 1.33 -24.667 -1.337 -34 -8c-9.333 -6.667 -19 -21 -29 -43c-6.914 -17.779 -25.9 -83.878 -31 -103h77v-40h-85c-19.014 -108.805 -60.061 -254.558 -103 -337c-23.657 -46.132 -64.302 -106 -117 -106 c-44.617 0 -71 36.683 -71 83c0 31.822 15.3106 71 49 71zM194 174c-14 0 -23 12 -23 29l1 11l3 12c0 5 -3 7 -8 7c-13 0 -26 -10 -38 -31l-16 -32c-21 -54 -35 -113 -53 -170h-60l57 194v5c0 11 -3 16 -8 16c-15 0 -20 -9 -30 -21c-9 -11 -17 -23 -25 -36l-14 8 c6 15 16 25 28 38c19 19 50 48 83 48c15 0 22 -9 22 -28c-1 -7 -1 -14 -2 -21c16 24 39 56 74 56c21 0 40 -19 40 -40c0 -30 -10 -45 -31 -45z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E53D[] =
+    "<symbol id=\"E53D\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M630 115c21 0 34 -23 34 -48c0 -23 -8 -42 -24 -58c-15 -17 -39 -25 -73 -25c-12 0 -21 1 -27 4l-12 6l-17 10c-15 7 -24 10 -29 10c-9 0 -19 -5 -30 -14h-31v16l209 177l-64 -1c-23 -3 -32 -15 -44 -30h-24l30 87h189v-32l-211 -163c13 6 26 9 39 9c14 0 53 -18 63 -20 c9 1 14 8 14 19c-13 0 -20 8 -22 23c0 17 13 30 30 30zM131 -69c21.386 0 35 -30.9216 35 -51c0 -20.113 -12.603 -31.814 -21 -45c-4.664 -7.333 -8.33 -12 -11 -14c-5.521 -7.362 -1.338 -9.966 9 -11c35.076 0 54.222 54.5 67 89c6.667 18 11.667 35.333 15 52 c20.706 88.2938 38.664 179.336 58 269h-58v38h70c13.429 37.847 22.957 64.66 40 91c20.666 30 42.333 53 65 69s47.667 24 75 24c28.318 0 45.595 -13.674 51 -38l4 -16c0 -33.139 -1.003 -36.007 -13 -60c-3.138 -7.06 -17.383 -25.054 -31 -27 c-4.667 -0.667 -10.333 -0.667 -17 0c-12.606 2.801 -16.566 17.612 -19 31c0 27.28 11.325 44.216 29 56l14 10c0 8.667 -6 14 -18 16c-13.333 1.33 -24.667 -1.337 -34 -8c-9.333 -6.667 -19 -21 -29 -43c-6.914 -17.779 -25.9 -83.878 -31 -103h77v-40h-85 c-19.014 -108.805 -60.061 -254.558 -103 -337c-23.657 -46.132 -64.302 -106 -117 -106c-44.617 0 -71 36.683 -71 83c0 31.822 15.3106 71 49 71zM194 174c-14 0 -23 12 -23 29l1 11l3 12c0 5 -3 7 -8 7c-13 0 -26 -10 -38 -31l-16 -32c-21 -54 -35 -113 -53 -170h-60 l57 194v5c0 11 -3 16 -8 16c-15 0 -20 -9 -30 -21c-9 -11 -17 -23 -25 -36l-14 8c6 15 16 25 28 38c19 19 50 48 83 48c15 0 22 -9 22 -28c-1 -7 -1 -14 -2 -21c16 24 39 56 74 56c21 0 40 -19 40 -40c0 -30 -10 -45 -31 -45z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E566[] =
+    "<symbol id=\"E566\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M18 208c0 -27 17 -47 45 -47l3 -2l13 4l23 9l14 55c-17 15 -35 22 -55 22c-26 0 -43 -17 -43 -41zM432 225c0 -21 -11 -36 -31 -37c-15 0 -20 10 -23 25l3 14l2 11l1 9l-4 4c-1 -1 -2 -1 -3 -1c-23 -13 -36 -24 -47 -48l-12 -27c-18 -50 -31 -105 -47 -157h-60l58 214 c0 7 -3 5 -5 9c-7 0 -25 -8 -51 -28l-43 -33l5 6c21 -35 32 -68 32 -98c0 -12 -1 -21 -4 -28l-6 -15c-1 -3 -5 -10 -12 -19c-14 -18 -30 -26 -49 -26c-30 0 -67 18 -67 52c1 1 1 6 3 15l20 84c-9 -5 -21 -8 -36 -8c-21 0 -29 7 -40 19c-10 12 -16 27 -16 47c0 23 6 33 17 45 s25 18 46 18c19 0 39 -8 60 -25l34 117h63l-46 -158l38 31l32 20c21 10 35 13 62 15c16 0 24 -7 24 -21l-1 -10l-6 -24c21 37 44 55 70 55c23 0 39 -23 39 -47zM162 167l-36 -115l-1 -10c0 -10 5 -16 16 -19c32 18 48 43 48 75c0 20 -9 43 -27 69z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E567[] =
+    "<symbol id=\"E567\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M468 118c0 -69.3555 -37.514 -116.042 -106 -118c-22.667 0 -43.667 5 -63 15c-20.603 12.6768 -44.791 32.0508 -64 49c-22.562 23.7725 -45.813 46.854 -69 70c-16 14 -31 25 -45 33s-26.333 12.333 -37 13c-19.7578 0 -27.7188 -13.562 -37 -28l-12 -26 c-3.333 -9.333 -5 -15.667 -5 -19v-8c0 -28.667 13.333 -43 40 -43l9 2l11 9l7 7c6.447 4.0293 14.151 8 24 8c17.333 0 28.333 -9.333 33 -28c0 -34.1875 -26.771 -52.5801 -58 -54c-22.8301 0 -25.7109 -0.339844 -41 8c-32.9814 13.582 -55 53.5781 -55 97 c0 50.451 20.6279 86.763 49 114c18 14.667 36.333 23 55 25c26 0 51 -7 75 -21c8.667 -5.333 14.667 -9 18 -11l18 -15c8.638 -7.197 25.24 -22.133 33 -31l65 -67l10 -9l22 -16c13.333 -7.333 25.667 -11 37 -11c37.102 0 55 35.8711 55 70c0 27.96 -11.971 55 -39 55 c-6.354 -2.119 -10.691 -4.794 -17 -9l-18 -13c-3.333 -2.667 -9.333 -4 -18 -4c-19.451 0 -29.676 17.24 -32 37c0 28.051 28.285 41.713 58 44c43.493 0 69.732 -31.468 85 -62c8.667 -17.333 12.667 -38.333 12 -63z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E568[] =
+    "<symbol id=\"E568\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M468 126c0 69.355 -37.514 116.042 -106 118c-22.667 0 -43.667 -5 -63 -15c-20.602 -12.677 -44.791 -32.051 -64 -49c-22.561 -23.772 -45.814 -46.853 -69 -70c-16 -14 -31 -25 -45 -33s-26.333 -12.333 -37 -13c-19.7583 0 -27.7186 13.5628 -37 28l-12 26 c-3.333 9.333 -5 15.667 -5 19v8c0 28.667 13.333 43 40 43l9 -2l11 -9l7 -7c6.447 -4.03 14.151 -8 24 -8c17.333 0 28.333 9.333 33 28c0 34.187 -26.771 52.58 -58 54c-22.8296 0 -25.7106 0.34 -41 -8c-32.9816 -13.582 -55 -53.578 -55 -97 c0 -50.4509 20.6276 -86.763 49 -114c18 -14.667 36.333 -23 55 -25c26 0 51 7 75 21c8.667 5.333 14.667 9 18 11l18 15c8.638 7.1975 25.24 22.1328 33 31l65 67l10 9l22 16c13.333 7.333 25.667 11 37 11c37.101 0 55 -35.871 55 -70c0 -27.9599 -11.97 -55 -39 -55 c-6.353 2.1187 -10.691 4.7935 -17 9l-18 13c-3.333 2.667 -9.333 4 -18 4c-19.451 0 -29.676 -17.2405 -32 -37c0 -28.051 28.285 -41.7132 58 -44c43.494 0 69.733 31.4674 85 62c8.667 17.333 12.667 38.333 12 63z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E56A[] =
+    "<symbol id=\"E56A\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M126 468c69.355 0 116.042 -37.514 118 -106c0 -22.667 -5 -43.667 -15 -63c-12.677 -20.603 -32.051 -44.791 -49 -64c-23.772 -22.562 -46.854 -45.813 -70 -69c-14 -16 -25 -31 -33 -45s-12.333 -26.333 -13 -37c0 -19.7578 13.5625 -27.7188 28 -37l26 -12 c9.333 -3.333 15.667 -5 19 -5h8c28.667 0 43 13.333 43 40l-2 9l-9 11l-7 7c-4.029 6.447 -8 14.151 -8 24c0 17.333 9.333 28.333 28 33c34.188 0 52.58 -26.771 54 -58c0 -22.8301 0.34 -25.7109 -8 -41c-13.582 -32.9814 -53.578 -55 -97 -55 c-50.4512 0 -86.7627 20.6279 -114 49c-14.667 18 -23 36.333 -25 55c0 26 7 51 21 75c5.333 8.667 9 14.667 11 18l15 18c7.1973 8.638 22.1328 25.24 31 33l67 65l9 10l16 22c7.333 13.333 11 25.667 11 37c0 37.102 -35.871 55 -70 55c-27.96 0 -55 -11.971 -55 -39 c2.1191 -6.354 4.7939 -10.691 9 -17l13 -18c2.667 -3.333 4 -9.333 4 -18c0 -19.451 -17.2402 -29.676 -37 -32c-28.0508 0 -41.7129 28.285 -44 58c0 43.493 31.4678 69.732 62 85c17.333 8.667 38.333 12.667 63 12z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E56B[] =
+    "<symbol id=\"E56B\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M118 468c-69.3555 0 -116.042 -37.514 -118 -106c0 -22.667 5 -43.667 15 -63c12.6768 -20.603 32.0508 -44.791 49 -64c23.7725 -22.562 46.854 -45.813 70 -69c14 -16 25 -31 33 -45s12.333 -26.333 13 -37c0 -19.7578 -13.562 -27.7188 -28 -37l-26 -12 c-9.333 -3.333 -15.667 -5 -19 -5h-8c-28.667 0 -43 13.333 -43 40l2 9l9 11l7 7c4.0293 6.447 8 14.151 8 24c0 17.333 -9.333 28.333 -28 33c-34.1875 0 -52.5801 -26.771 -54 -58c0 -22.8301 -0.339844 -25.7109 8 -41c13.582 -32.9814 53.5781 -55 97 -55 c50.451 0 86.763 20.6279 114 49c14.667 18 23 36.333 25 55c0 26 -7 51 -21 75c-5.333 8.667 -9 14.667 -11 18l-15 18c-7.197 8.638 -22.133 25.24 -31 33l-67 65l-9 10l-16 22c-7.333 13.333 -11 25.667 -11 37c0 37.102 35.8711 55 70 55c27.96 0 55 -11.971 55 -39 c-2.119 -6.354 -4.794 -10.691 -9 -17l-13 -18c-2.667 -3.333 -4 -9.333 -4 -18c0 -19.451 17.24 -29.676 37 -32c28.051 0 41.713 28.285 44 58c0 43.493 -31.468 69.732 -62 85c-17.333 8.667 -38.333 12.667 -63 12z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E56C[] =
+    "<symbol id=\"E56C\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 21v59l129 150l17 10c7 0 11 -2 12 -6l106 -93l17 -10l12 6l80 93l18 10c5 0 9 -2 12 -6l105 -93l9 -7l8 -5c5 1 9 4 12 8l68 80v-59l-128 -150c-9 -7 -16 -10 -20 -10c-3 0 -7 2 -10 6l-105 94c-6 5 -13 7 -20 7c-4 0 -7 -1 -9 -3l-81 -94c-7 -7 -14 -10 -19 -10 c-3 0 -7 2 -10 6l-105 94c-6 6 -13 9 -20 9c-3 0 -7 -2 -10 -5z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E56D[] =
+    "<symbol id=\"E56D\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 21v59l121 143c4 4 8 7 11 9s7 3 11 4c5 0 13 -6 25 -17l107 -94v184h30v-159l58 69c11 13 19 20 23 20l24 -16l84 -75l31 -25c3 1 7 5 13 12l14 15l34 44v-55l-106 -125c-8 -11 -16 -16 -23 -16c-3 1 -5 3 -7 4c-6 4 -12 9 -18 14l-78 70c-14 14 -25 21 -34 21l-5 -2 l-5 -5l-5 -6v-184h-30v149l-36 -45c-10 -11 -18 -16 -24 -16l-7 2l-10 8l-10 8l-88 80c-7 7 -14 11 -20 13c-3 0 -9 -4 -17 -13z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E56E[] =
+    "<symbol id=\"E56E\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M710 134l-109 -127c-2.667 -3.33333 -5 -5.33333 -7 -6l-6 -2c-5.351 2 -8.684 3.66667 -10 5l-89 78c-4.67 4.6667 -10.337 7.3333 -17 8c-4 -1.3333 -6.667 -2.6667 -8 -4l-66 -79c-3.333 -5.33333 -7.667 -8 -13 -8l-11 5l-89 78c-6 4.6667 -11.333 7.3333 -16 8 c-4 -1.3333 -6.667 -2.6667 -8 -4l-67 -79c-5.333 -5.33333 -10 -8 -14 -8c-2 0 -5.333 1.66667 -10 5l-88 78c-5.3333 4.6667 -11 7.3333 -17 8c-4.6667 -1.3333 -7.3333 -2.6667 -8 -4l-57 -68v49l108 127l10 4c0.667 0 2 -0.333 4 -1s6 -3 12 -7l88 -78l10 -5 c4 0 8.667 2.667 14 8l67 79c3.333 2.667 6 4 8 4c4.667 0 10 -2.667 16 -8l89 -78l11 -5l6 1l7 7l67 79c3.333 2.667 5.667 4 7 4c4 -1.334 6.667 -2.667 8 -4l7 -6l89 -77c3.333 -3.333 7 -5 11 -5s8.333 2.667 13 8l58 67v-47z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E610[] =
+    "<symbol id=\"E610\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M0 230h240v-230h-28v116h-184v-116h-28v230z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E611[] =
+    "<symbol id=\"E611\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M0 0h240v230h-28v-116h-184v116h-28v-230z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E612[] =
+    "<symbol id=\"E612\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M218 260l-109 -260l-109 260h24l85 -196l85 196h24z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E613[] =
+    "<symbol id=\"E613\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M218 0l-109 260l-109 -260h24l85 196l85 -196h24z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E614[] =
+    "<symbol id=\"E614\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 103c0 57 46 103 103 103s103 -46 103 -103s-46 -103 -103 -103s-103 46 -103 103zM28 103c0 -41 34 -75 75 -75s75 34 75 75s-34 75 -75 75s-75 -34 -75 -75z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E650[] =
+    "<symbol id=\"E650\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M657 134c0 -34.667 -12.333 -65.667 -37 -93s-53.667 -41 -87 -41h-14c-6 8 -10.667 13.667 -14 17c-11.333 12 -21 18 -29 18c-14.667 0 -27.333 -3.333 -38 -10c-13.333 -10.667 -24 -19 -32 -25h-66l-40 47l-33 -47h-77c-5.333 19.333 -9.667 33.333 -13 42 c-6 16 -15 23.333 -27 22c-16.667 -2 -33 -12 -49 -30c-9.333 -11.333 -19 -22.667 -29 -34h-34c0 29.333 34.333 67 103 113c32.667 22 49 46 49 72c0.002 17.333 -10.665 41 -32 71c-21.333 30 -32.333 65.333 -33 106c0 14.667 1 30.333 3 47s5.667 37 11 61 c-1.316 4 -3.649 7 -7 9c-3.333 2 -9.333 3 -18 3c-18.667 -5.333 -32.667 -11.333 -42 -18c-28 -21.333 -42 -53.667 -42 -97c0 -11.333 1.667 -20.333 5 -27s7.667 -11.667 13 -15c16 -4.667 30 9 42 41c3.333 2.667 6.333 5.333 9 8c0.667 -2 1 -5.667 1 -11 c0 -14.667 -4 -28 -12 -40c-11.333 -16 -28 -26.333 -50 -31c-8.667 0 -16.667 5 -24 15c-9.33301 13.334 -14 31.667 -14 55c0 45.333 15 82 45 110s67.667 42 113 42c52 0 91.667 -10 119 -30c27.333 -20 41.333 -47.667 42 -83c0 -14 -2.333 -28 -7 -42 c-12 -20.667 -26.667 -31 -44 -31c-18 0 -35.667 9.333 -53 28s-26 34.333 -26 47c0 6 2.333 9.333 7 10c4 -11.333 8 -19.667 12 -25c12 -17.333 27.333 -26 46 -26c14.667 0 24.667 4 30 12s8 18.667 8 32c0 20.667 -7.667 36.333 -23 47 c-15.333 10.667 -35.333 18.667 -60 24c-10 2 -16.667 3 -20 3c-4 0 -12.667 -1 -26 -3c-5.333 -15.333 -9 -30.667 -11 -46s-3 -34.333 -3 -57c0 -20.667 7 -43.334 21 -68l54 -90c2.667 -12.667 4 -25 4 -37c0 -22 -8.333 -42.333 -25 -61 c-8.667 -9.333 -13 -16.667 -13 -22c9.333 -8.667 15.333 -19.667 18 -33s14.667 -22.667 36 -28c17.333 4.667 29.333 9.667 36 15s10 12.333 10 21c0 6.667 -4 19.333 -12 38c-5.333 12.667 -9 22.667 -11 30c-0.667 6 -1 10.667 -1 14c0 28 8 53.333 24 76 s38.333 34 67 34c21.333 0 36 -4 44 -12s13.667 -23.333 17 -46c2.667 -22 -4.333 -41.333 -21 -58c-22.666 -20.667 -45.333 -41 -68 -61c6 -10.667 13 -21 21 -31c16.667 -20.667 33.333 -31 50 -31c12 0 25 5 39 15c4 3.333 9.667 8.333 17 15c-1.333 12 -2 22.333 -2 31 c0 36.667 6.667 68.333 20 95c18.667 38 51 67 97 87c-20.667 46.667 -52.667 88 -9"
+    "6 124c-40.667 28.667 -81.667 57.333 -123 86c29.333 -2.668 66.333 -17.334 111 -44c54.667 -32 98.333 -70.333 131 -115c42 -56.667 63 -118 63 -184zM379 227 c-10 0 -20.333 -0.667 -31 -2s-18 -6.333 -22 -15s-6.667 -17 -8 -25s-2 -16.667 -2 -26v-20c28 0 46.333 9.333 55 28c5.333 11.333 8 31.333 8 60zM513 54c6 -12.667 16 -19 30 -19c16 0 30.333 8 43 24s19.333 39.333 20 70c0 25.333 -3.333 52 -10 80s-15 42.333 -25 43 c-21.333 -8.667 -38 -26 -50 -52s-18 -55 -18 -87c0 -23.333 3.333 -43 10 -59zM671 50c6.667 0 12.333 -2.667 17 -8s7 -11.333 7 -18s-2.667 -12.333 -8 -17c-5.333 -4.66699 -11.667 -7 -19 -7c-6.667 -0 -12.333 2.66699 -17 8c-4.667 5.333 -7 11.667 -7 19 c0 15.333 9 23 27 23z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E655[] =
+    "<symbol id=\"E655\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M216.75 244.8c-22.1 0 -38.25 -15.3 -38.25 -36.55c0 -17.85 20.4 -34.85 38.25 -35.7c20.4 0 34.85 18.7 34.85 37.4c0 21.25 -14.45 34 -34.85 34.85zM44.2002 317.9c3.3994 25.5 24.6494 51 51.8496 51c16.1502 0 27.2002 -4.25 31.4502 -11.9 c11.05 -13.6 13.6 -55.25 22.1 -75.65c5.95 -7.65 14.45 -12.75 25.5 -14.45l16.15 5.1c9.35 5.1 13.6 10.2 14.45 24.65c0 6.8 -1.7 12.75 -4.25 17l-11.9 17.85l-16.15 17.85l-9.35 22.1c0 28.05 24.65 46.75 52.7 46.75s50.15 -22.95 50.15 -46.75 c0 -20.4 -6.8 -25.5 -20.4 -39.95l-15.3 -19.55c-4.25 -6.8 -5.95 -12.75 -6.8 -17.85c0.85 -4.25 4.25 -11.05 4.25 -14.45l11.05 -10.2l14.45 -7.65c20.4 1.7 30.6 22.1 33.15 46.75c0 39.1 16.15 58.65 48.45 58.65c25.5 0 46.75 -21.25 46.75 -46.75 c0 -28.9 -23.8 -46.75 -54.4 -46.75c-29.75 0 -45.9 -11.05 -48.45 -34l5.1 -11.9c0.85 -2.55 3.4 -5.1 6.8 -7.65c0.85 -1.7 5.95 -3.4 14.45 -5.1c10.2 1.7 17 5.95 22.95 11.9c7.65 3.4 5.95 4.25 16.15 11.9l21.25 15.3c4.25 3.4 11.05 5.1 20.4 5.1 c22.95 0 43.35 -26.35 44.2 -49.3c0 -20.4 -15.3 -40.8 -29.75 -49.3c-2.55 -0.85 -9.35 -2.55 -18.7 -3.4c-6.8 0.85 -17 6.8 -30.6 17.85l-25.5 18.7c-4.25 2.55 -11.05 4.25 -20.4 4.25c-7.65 0 -13.6 -1.7 -17 -4.25l-9.35 -18.7c1.7 -12.75 6.8 -20.4 14.45 -23.8 l11.05 -4.25l26.35 -5.1c16.15 0 28.05 -4.25 37.4 -11.9c9.35 -5.95 13.6 -17 13.6 -34.0002c0 -12.75 -5.1 -24.6494 -14.45 -34c-9.35 -7.6494 -22.1 -12.75 -36.55 -16.1494c-11.05 1.6992 -22.1 8.5 -33.15 19.5498c-7.65 11.0498 -11.05 27.2002 -11.05 46.7498 c0 11.05 -5.1 20.4 -7.65 26.35c-5.1 8.5 -13.6 12.75 -25.5 12.75c-18.7 0 -28.9 -15.3 -32.3 -31.45c2.55 -6.8 7.65 -13.6 11.05 -20.3998c4.25 -7.6504 8.5 -14.4502 13.6 -21.25l7.65 -8.5l5.1 -10.2002c3.4 -5.0996 4.25 -11.9004 5.1 -20.4004 c0 -25.5 -26.35 -39.0996 -51.85 -39.0996c-24.65 0 -45.9 15.2998 -48.45 39.0996c0.85 5.9502 5.1 17.8506 6.8 21.25c11.05 14.4502 22.1 28.9004 33.15 42.5004c1.7 4.25 3.4 10.2 4.25 19.55c0 17 -8.5 26.35 -24.65 28.9c-31.45 0 -39.95 -19.55 -39.95 -51 c0 -31.4504 -16.15 -49.3 -47.6002 -54.3996c-33.1494 6.7998 -42.5 19.5498 -50."
+    "1494 51.8496c3.3994 30.6 25.5 45.9 66.2996 45.9c18.7 0 36.55 12.75 36.55 31.45c0 7.65 -2.55 12.75 -7.65 16.15c-3.4 4.25 -8.5 6.8 -16.15 6.8c-10.2 0 -23.8 -5.95 -39.95 -17.85 c-13.5996 -9.35 -24.6504 -16.15 -39.0996 -21.25c-28.0508 3.4 -45.0508 20.4 -45.9004 51c0 25.5 18.7002 46.75 44.2002 46.75c18.7002 0 31.4502 -8.5 44.2002 -18.7l17.8496 -13.6l18.7 -7.65c17.85 4.25 26.35 11.9 26.35 22.95c0 22.95 -15.3 34 -46.75 34 c-36.55 0 -56.0998 14.45 -60.3498 44.2z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E880[] =
+    "<symbol id=\"E880\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M166 326c47 0 77 -43 77 -90c0 -112 -68 -236 -164 -236c-50 0 -79 43 -79 93c0 52 14 102 43 149c28 46 61 84 123 84zM191 268c0 21 -10 34 -25 39c-33 0 -61 -36 -85 -107c-19 -57 -29 -104 -29 -143l2 -14c3 -5 3 -8 7 -12c5 -7 11 -12 20 -12c30 0 62 34 82 107 l21 78c5 21 7 43 7 64z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E881[] =
+    "<symbol id=\"E881\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M207 311l-85 -275c-4 -6 7 -11 13 -13l18 -2h11l-6 -21h-158l6 21h15c7 0 14 2 21 5c9 1 16 8 20 20l55 176l-71 -56l-10 10l109 135h62z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E882[] =
+    "<symbol id=\"E882\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M166 311c60 0 94 -21 94 -80c0 -27 -12 -51 -40 -64l-70 -32c-37 -10 -69 -30 -96 -60h21l26 -2l12 -6c14 -6 28 -11 42 -17c6 -3 13 -4 21 -4l15 4l11 8c5 5 11 13 19 26l17 -9l-16 -28c-2 -4 -16 -28 -20 -31c-19 -21 -38 -31 -57 -31h-10c-13 6 -25 12 -36 20l-15 11 c-12 7 -23 10 -32 10c-10 -3 -19 -8 -24 -17l-5 -9h-23c0 27 6 51 20 72c7 10 14 16 19 21l28 25c20 11 40 22 59 33l19 9c16 7 29 18 39 30c12 15 19 30 19 45l1 12c0 13 -4 24 -12 31c-6 9 -15 14 -28 14c-29 0 -46 -15 -52 -44l3 -12l2 -16c0 -20 -8 -29 -25 -29 c-14 0 -26 13 -26 28c0 48 52 92 100 92z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E883[] =
+    "<symbol id=\"E883\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M161 326c52 0 94 -17 94 -68c0 -50 -40 -76 -82 -94c26 -21 39 -42 39 -64c0 -52 -56 -100 -118 -100h-12c-40 0 -82 23 -82 56c0 30 12 49 37 49c17 0 31 -16 34 -31c0 -5 -4 -12 -11 -21c-7 -5 -13 -10 -13 -21l11 -9l17 -4c21 0 40 12 56 37c13 21 19 45 19 70 c-9 30 -28 35 -66 35l6 23c34 0 60 4 77 13c20 11 30 35 30 70c0 28 -12 38 -39 40l-20 -3c-8 -3 -12 -9 -12 -16c2 -7 4 -11 5 -14l4 -11l3 -10l-3 -12c-5 -6 -11 -11 -20 -13c-18 -4 -36 10 -36 27c0 39 43 71 82 71z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E884[] =
+    "<symbol id=\"E884\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M259 110l-6 -21h-59l-16 -52c-3 -6 0 -11 9 -14l34 -2l-6 -21h-155l6 21l18 1l15 4c9 3 16 11 20 23l13 40h-132l5 21c12 10 26 22 39 39l33 43c13 18 27 41 40 68l21 51h97l-36 -49c-13 -16 -33 -34 -49 -49c-36 -35 -76 -67 -115 -100l108 -3l20 72l80 77h5l-44 -149 h55z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E885[] =
+    "<symbol id=\"E885\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M84 0c-49 0 -84 18 -84 66l1 14c2 5 4 9 7 14c7 7 16 11 27 14c7 0 13 -3 19 -9l4 -9l2 -11l-4 -13c-3 -5 -3 -6 -8 -11l-7 -16c0 -8 3 -13 10 -16l13 -4h15c22 0 42 15 59 45c15 27 23 52 23 75l-3 13c-2 8 -13 17 -21 20l-15 4l-17 -1l-16 -3l-17 -10l-23 -18h-21 l62 182c9 -3 25 -6 35 -9l33 -3h10l23 3l49 9c-19 -27 -53 -58 -89 -58h-10l-22 2c-9 3 -17 7 -26 11l-36 -108l18 12l20 9l22 5l26 3c9 0 19 -1 30 -5c14 -5 14 -6 24 -17c14 -15 22 -33 22 -58c0 -32 -13 -62 -41 -87c-28 -24 -60 -35 -94 -35z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E886[] =
+    "<symbol id=\"E886\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M154 326c35 0 57 -16 60 -49c0 -7 -1 -13 -2 -16l-8 -14c-4 -7 -13 -12 -28 -15l-13 1l-12 7c-4 4 -7 11 -6 20l1 11l8 10l17 16c-2 7 -9 10 -20 10c-30 0 -53 -25 -69 -74l-9 -31l-6 -36c25 21 42 34 83 34c28 0 56 -29 56 -61c0 -65 -45 -139 -118 -139 c-69 0 -88 38 -88 108v18c0 6 1 13 3 20c0 21 2 20 9 39c17 50 45 95 83 120c20 13 39 21 59 21zM58 58c0 -24 5 -39 27 -39c18 0 35 15 48 47c10 25 16 42 16 72l-3 10l-6 12c-6 7 -14 12 -26 12c-11 0 -24 -11 -37 -33l-14 -40c-3 -15 -5 -28 -5 -41z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E887[] =
+    "<symbol id=\"E887\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M243 311c-3 -25 -10 -47 -18 -67c-9 -23 -28 -58 -57 -105l-17 -35l-13 -35c-5 -19 -10 -45 -10 -69h-100c2 15 10 33 24 54c19 30 57 76 86 105c30 31 53 62 70 104l-2 2c-16 -16 -31 -26 -43 -32c-7 -3 -12 -5 -23 -5h-8l-27 16c-9 5 -19 8 -30 8c-5 0 -12 -1 -17 -6 l-16 -14c-7 -11 -14 -25 -21 -42h-21l38 121h20c-5 -9 -8 -16 -8 -21c0 -4 1 -7 2 -8l9 -6l24 20c10 8 24 15 40 15c11 0 29 -12 33 -21c11 -9 22 -15 33 -14l13 1l9 7c4 4 8 19 11 27h19z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E888[] =
+    "<symbol id=\"E888\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M61 247c0 51 57 79 108 79c33 0 52 -12 72 -27c11 -9 19 -20 24 -31c5 -12 9 -24 9 -37c0 -11 -4 -21 -13 -32s-27 -23 -56 -37l14 -20l10 -16c4 -8 6 -14 7 -18l3 -19c0 -62 -58 -89 -124 -89c-58 0 -115 33 -115 87c0 48 48 72 89 88c-10 14 -15 18 -21 35l-6 18z M192 174c27 16 40 39 44 73c0 7 -2 13 -4 19c-3 7 -7 13 -12 19c-12 14 -26 22 -44 22c-27 0 -50 -13 -50 -37c0 -21 11 -44 34 -66zM175 62c0 17 -9 26 -19 42c-1 1 -3 4 -7 8c-16 16 -32 33 -48 50l-25 -17l-18 -16l-12 -21c-3 -7 -4 -17 -4 -28c0 -17 8 -32 23 -45 l24 -12c7 -3 16 -4 26 -4c21 0 35 5 46 12c9 6 15 14 15 25z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E889[] =
+    "<symbol id=\"E889\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M131 326c61 0 94 -45 94 -111c0 -25 -4 -47 -11 -69s-18 -44 -32 -66c-32 -48 -70 -81 -120 -81c-32 0 -60 25 -62 60v8c4 13 13 22 27 22c7 0 13 -3 18 -8c3 -1 6 -8 8 -19c-3 -15 -14 -43 8 -43c20 0 40 18 61 54l14 35c5 9 12 34 15 44l-24 -13l-13 -8 c-13 -5 -21 -8 -37 -8c-43 0 -69 29 -69 72c0 33 11 63 32 90s52 41 91 41zM167 264c0 22 -9 38 -27 43c-21 0 -38 -12 -52 -36s-21 -48 -22 -71c0 -29 6 -43 31 -48c26 -5 54 38 64 72c3 12 5 25 6 40z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E88A[] =
+    "<symbol id=\"E88A\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M17 87c0 11 3 19 10 26s16 10 27 10s19 -3 26 -10s11 -16 11 -26s-4 -19 -11 -27c-7 -7 -17 -10 -27 -10s-19 3 -26 10s-10 16 -10 27zM53 207c0 11 4 20 11 27s17 10 27 10s19 -4 26 -11s10 -16 10 -26s-4 -19 -11 -26s-16 -10 -26 -10s-19 3 -26 10s-11 15 -11 26z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E901[] =
+    "<symbol id=\"E901\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M183 747c13.334 7.333 27.667 11.333 43 12c15.334 0.667 29.667 -1.333 43 -6c13.333 -4.667 24.333 -12.667 33 -24c8.667 -11.339 14.333 -23.672 17 -37c2.667 -16 -1.667 -36 -13 -60s-25 -42 -41 -54c-8.667 -6.667 -14.667 -12.667 -18 -18s-5.333 -12 -6 -20 c0 -5.333 1 -10 3 -14s4.333 -6.667 7 -8c2.667 -1.337 7.667 -6.004 15 -14c7.335 -8 14.668 -17 22 -27c13.333 -16.668 21.333 -29.334 24 -38c2.667 -8.667 5.333 -24.667 8 -48c2 -30.667 1.333 -52.334 -2 -65c-3.333 -12.667 -12.667 -27.334 -28 -44 c-8.668 -10 -14.335 -18.333 -17 -25c-2.667 -6.667 -4 -13.333 -4 -20c1.333 -12.667 8.333 -21.667 21 -27s34.667 -8 66 -8c22 0 37.333 1 46 3c8.667 1.333 17.667 5 27 11l20 14l-12 -17c-8 -11.333 -10.667 -22.667 -8 -34l3 -17h-136 c-32.667 0 -57.667 -0.333 -75 -1s-33.667 -1.333 -49 -2s-27.333 -3 -36 -7c-8.668 -4 -16.334 -8 -23 -12c-6.668 -4 -14.334 -10.667 -23 -20c-21.333 -20 -35.333 -45.667 -42 -77s-5.667 -63 3 -95c4.667 -17.333 13.334 -33.333 26 -48 c12.667 -14.667 27.333 -26.667 44 -36s35 -17 55 -23s40.333 -8 61 -6c20.667 2 40.333 6.667 59 14c20.667 8.666 35.333 19.333 44 32s14.667 32 18 58c2 18 2.333 31.333 1 40c-1.333 8.667 -5 19.667 -11 33c-8 16 -17.667 28.667 -29 38s-21 12.667 -29 10 c-4 -2 -6.333 -5.333 -7 -10s-0.667 -12.333 0 -23c2.667 -17.333 0.333 -35.333 -7 -54c-7.333 -18.667 -17.333 -32.333 -30 -41c-12.667 -8.667 -26 -13 -40 -13c-12 0 -27.333 5 -46 15s-31.667 22 -39 36c-12 24 -12.667 47.667 -2 71s30.333 41.667 59 55 c16 8 32 12 48 12s38.667 -3.333 68 -10c26.667 -6 47 -15 61 -27s26 -31.667 36 -59c5.333 -13.333 8.333 -24 9 -32c0.658 -8 -0.675 -21 -4 -39c-3.333 -18 -7 -30.667 -11 -38s-11.333 -15.667 -22 -25c-16.667 -14.667 -36.667 -27.667 -60 -39 c-16 -8 -29 -12.667 -39 -14c-10 -1.331 -28 -1.664 -54 -1c-51.333 2.667 -93.333 13 -126 31s-58.667 46 -78 84c-11.333 22.667 -17.333 43.667 -18 63s4 42.333 14 69c13.333 35.333 29.333 62 48 80s46 32.667 82 44c16.667 5.333 34.333 13.333 53 24s32 21 40 31 c10 10.667 22 28 36 52c10 16.667 16 29 18 37s2.333 23.333 1 46c-2 30.667 -8.333 5"
+    "4 -19 70c-9.333 14 -21.667 26.333 -37 37s-29 16 -41 16s-26 -9.333 -42 -28s-27 -37.667 -33 -57c-4 -14.667 -5.333 -27.667 -4 -39c1.333 -15.333 6.333 -34 15 -56 c0.667 -2.667 0 -6.667 -2 -12s-4.667 -10.333 -8 -15c-8.668 -10 -16.668 -13.333 -24 -10c-7.334 3.333 -16.667 15 -28 35c-16.667 28.667 -19.333 57.667 -8 87c4 10 16 24.667 36 44s37.333 33 52 41c6.667 4 11.333 8.333 14 13c2.667 4.667 4 11.333 4 20 c0 14.671 -2 23.338 -6 26c-6 3.333 -13 15.667 -21 37s-12.333 38 -13 50c0 22.667 5.333 42.334 16 59c10.667 16.67 28 31.336 52 44zM277 715c-8.667 8.667 -21.667 13.667 -39 15s-33.333 -0.333 -48 -5c-11.333 -5.333 -20.667 -13.333 -28 -24s-11.333 -22 -12 -34 s0 -24 2 -36s7.333 -22.333 16 -31s19 -14 31 -16c17.334 -3.315 31.667 -2.649 43 2c11.333 4.667 22.333 14.667 33 30c8.667 12 14 21.333 16 28c2 6.672 2.333 16.338 1 29c-0.681 8.667 -2.347 17 -5 25c-2.667 8 -6 13.667 -10 17zM233 59 c-7.333 5.333 -19 8.333 -35 9s-27.333 -0.667 -34 -4c-6.667 -4.667 -12 -12.667 -16 -24s-6 -24 -6 -38c0 -11.333 1.333 -20 4 -26c0.667 -2.667 6 -9.667 16 -21c8.667 -10 20.667 -16.333 36 -19c12.667 -2 24 0.333 34 7s16.667 16.667 20 30c3.333 14 3 30.333 -1 49 c-4 18.667 -10 31 -18 37z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E902[] =
+    "<symbol id=\"E902\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-33 -230c1 -32 1 -38 13 -38c15.1328 0 10 8 12 38l1 66v0c-0.310064 0.575834 -0.333333 13 -1 37v41c0 13.3333 0.333333 26.3333 1 39c0 48 -5.33333 79.3333 -16 94c-14 18.6667 -44.6667 28 -92 28c-32 0 -53.3333 -8 -64 -24c-6.66667 -10 -10 -25.6667 -10 -47 c0 -28 -2.33301 -70.333 15 -81c13.333 -8 43.6667 11 69 11h23c7.33333 0 14.3333 0.333333 21 1c17.3333 0 26 -3.66667 26 -11v-51l1 -94zM181 -131c0 -20.6667 -3.33333 -36 -10 -46c-11.3333 -16.6667 -32.6667 -25 -64 -25c-46.6667 0 -77 9.33333 -91 28 c-11.3333 15.3333 -17 46.6667 -17 94v43c0 13.3333 0.333333 25.6667 1 37v41c0 13.3333 -0.333333 26.3333 -1 39c0 48 5.33333 79.3333 16 94c14 18.6667 44.6667 28 92 28c32 0 53.3333 -8 64 -24c6.66667 -10 10 -25.6667 10 -47c0 -28 -8.66667 -47.3333 -26 -58 c-13.3333 -8 -32.6667 -12 -58 -12h-23c-7.33333 0 -14.3333 0.333333 -21 1c-17.3333 0 -26 -3.66667 -26 -11v-51v-51c0 -8 8 -12 24 -12c4 0 11.3333 0.333333 22 1c10.6667 0.666667 19 1 25 1c25.3333 0 44 -3.66667 56 -11c18 -10.6667 27 -30.3333 27 -59z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E904[] =
+    "<symbol id=\"E904\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M337 -808h-25v693h-287v-93h-25v417h25v-86h287v86h25v-1017zM312 -50v108h-287v-108h287zM518 -290l30 10v-603h-30v593zM535 325l142 -178l-142 -178l-144 178zM508 249l-54 -67l112 -138l52 66zM535 37l142 -178l-142 -178l-144 178zM508 -39l-54 -67l112 -138l52 66z \"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E906[] =
+    "<symbol id=\"E906\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M181 -131c0 -20.6667 -3.33333 -36 -10 -46c-11.3333 -16.6667 -32.6667 -25 -64 -25c-46.6667 0 -77 9.33333 -91 28c-11.3333 15.3333 -17 46.6667 -17 94v43c0 13.3333 0.333333 25.6667 1 37v41c0 13.3333 -0.333333 26.3333 -1 39c0 48 5.33333 79.3333 16 94 c14 18.6667 44.6667 28 92 28c32 0 53.3333 -8 64 -24c6.66667 -10 10 -25.6667 10 -47c0 -28 -8.66667 -47.3333 -26 -58c-13.3333 -8 -32.6667 -12 -58 -12h-23c-7.33333 0 -14.3333 0.333333 -21 1c-17.3333 0 -26 -3.66667 -26 -11v-51v-51c0 -8 8 -12 24 -12 c4 0 11.3333 0.333333 22 1c10.6667 0.666667 19 1 25 1c25.3333 0 44 -3.66667 56 -11c18 -10.6667 27 -30.3333 27 -59z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E909[] =
+    "<symbol id=\"E909\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 595h28v-242h252v242h29v-531h-281v-128h281v-538h-29v247h-252v-247h-28v1197zM280 255h-252v-91h252v91zM280 -172h-252v-91h252v91z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E938[] =
+    "<symbol id=\"E938\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M155 194l157 -194l-157 -192l-155 192z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E939[] =
+    "<symbol id=\"E939\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M155 194l157 -194l-157 -192l-155 192zM125 111l-57 -73l122 -149l56 71z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E93C[] =
+    "<symbol id=\"E93C\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M155 194l157 -194l-157 -192l-155 192zM125 111l-57 -73l122 -149l56 71z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E93D[] =
+    "<symbol id=\"E93D\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M155 194l157 -194l-157 -192l-155 192z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E93E[] =
+    "<symbol id=\"E93E\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M0 760h30v-760h-30v760z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E93F[] =
+    "<symbol id=\"E93F\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M0 -760h30v760h-30v-760z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E949[] =
+    "<symbol id=\"E949\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 760h30l156 -227h-30zM0 760h30v-760h-30v760z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E94A[] =
+    "<symbol id=\"E94A\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -760h30l156 227h-30zM0 -760h30v760h-30v-760z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E94B[] =
+    "<symbol id=\"E94B\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 643h30l156 -227h-30zM0 760h30l156 -227h-30zM0 760h30v-760h-30v760z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E94C[] =
+    "<symbol id=\"E94C\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -643h30l156 227h-30zM0 -760h30l156 227h-30zM0 -760h30v760h-30v-760z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E9F0[] =
+    "<symbol id=\"E9F0\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 500h40v-1000h-40v1000zM90 500h40v-1000h-40v1000z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E9F1[] =
+    "<symbol id=\"E9F1\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M0 500h40v-1000h-40v1000z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E9F2[] =
+    "<symbol id=\"E9F2\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M0 250h40v-500h-40v500z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E9F3[] =
+    "<symbol id=\"E9F3\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M0 250h40v-250h-40v250z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E9F4[] =
+    "<symbol id=\"E9F4\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M0 250h40v-250h-40v250z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E9F5[] =
+    "<symbol id=\"E9F5\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M0 250h40v-140h-40v140z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E9F6[] =
+    "<symbol id=\"E9F6\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M0 140h40v-140h-40v140z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E9F7[] =
+    "<symbol id=\"E9F7\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M40 96v-96h-40v140h40l78 -69h-48z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlLeipzig_E9F8[] =
+    "<symbol id=\"E9F8\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\" d=\"M78 96v-96h40v140h-40l-78 -69h48z\"/>\n"
+    "</symbol>\n";
+
+static const BuiltInGlyph glyphsLeipzig[] = {
+    { 0xE003, "E003", 1000, 0.0, -0.3, 399.0, 282.5, 399.0, xmlLeipzig_E003 },
+    { 0xE004, "E004", 1000, 0.0, -282.1, 399.0, 282.5, 399.0, xmlLeipzig_E004 },
+    { 0xE045, "E045", 1000, 0.0, -14.0, 860.0, 418.0, 860.0, xmlLeipzig_E045 },
+    { 0xE046, "E046", 1000, 0.0, -22.0, 935.0, 428.0, 935.0, xmlLeipzig_E046 },
+    { 0xE047, "E047", 1000, 1.0, 1.0, 410.0, 512.0, 410.0, xmlLeipzig_E047 },
+    { 0xE048, "E048", 1000, 0.0, -73.0, 537.0, 653.0, 536.0, xmlLeipzig_E048 },
+    { 0xE04B, "E04B", 1000, 0.0, -34.0, 450.0, 1192.0, 477.0, xmlLeipzig_E04B },
+    { 0xE050, "E050", 1000, -0.6, -654.6, 646.5, 1737.6, 646.0, xmlLeipzig_E050 },
+    { 0xE051, "E051", 1000, -0.8, -893.0, 646.7, 1976.0, 650.0, xmlLeipzig_E051 },
+    { 0xE052, "E052", 1000, -0.6, -890.0, 646.5, 1973.0, 646.0, xmlLeipzig_E052 },
+    { 0xE053, "E053", 1000, -0.6, -654.6, 646.5, 1971.6, 646.0, xmlLeipzig_E053 },
+    { 0xE054, "E054", 1000, -0.6, -654.6, 650.6, 1967.6, 646.0, xmlLeipzig_E054 },
+    { 0xE05C, "E05C", 1000, 0.0, -502.0, 606.0, 1004.0, 656.0, xmlLeipzig_E05C },
+    { 0xE05D, "E05D", 1000, 0.0, -735.0, 606.0, 1237.0, 616.0, xmlLeipzig_E05D },
+    { 0xE062, "E062", 1000, 4.0, -581.0, 694.0, 832.0, 698.0, xmlLeipzig_E062 },
+    { 0xE063, "E063", 1000, 4.0, -755.0, 694.0, 1006.0, 698.0, xmlLeipzig_E063 },
+    { 0xE064, "E064", 1000, 4.0, -750.0, 694.0, 1001.0, 698.0, xmlLeipzig_E064 },
+    { 0xE065, "E065", 1000, 4.0, -581.0, 694.0, 1048.0, 698.0, xmlLeipzig_E065 },
+    { 0xE066, "E066", 1000, 4.0, -581.0, 694.0, 1066.0, 698.0, xmlLeipzig_E066 },
+    { 0xE069, "E069", 1000, 0.0, -250.0, 330.0, 500.0, 330.0, xmlLeipzig_E069 },
+    { 0xE06A, "E06A", 1000, 0.0, -396.0, 257.0, 791.0, 257.0, xmlLeipzig_E06A },
+    { 0xE080, "E080", 1000, 0.0, -250.0, 414.0, 501.0, 427.0, xmlLeipzig_E080 },
+    { 0xE081, "E081", 1000, 0.0, -250.0, 296.0, 500.0, 296.0, xmlLeipzig_E081 },
+    { 0xE082, "E082", 1000, 0.0, -251.0, 402.0, 502.0, 402.0, xmlLeipzig_E082 },
+    { 0xE083, "E083", 1000, 0.0, -252.0, 372.0, 502.0, 383.0, xmlLeipzig_E083 },
+    { 0xE084, "E084", 1000, 0.0, -250.0, 387.0, 501.0, 387.0, xmlLeipzig_E084 },
+    { 0xE085, "E085", 1000, 0.0, -250.0, 357.0, 500.0, 354.0, xmlLeipzig_E085 },
+    { 0xE086, "E086", 1000, 0.0, -250.0, 382.0, 500.0, 394.0, xmlLeipzig_E086 },
+    { 0xE087, "E087", 1000, 0.0, -250.0, 404.0, 501.0, 404.0, xmlLeipzig_E087 },
+    { 0xE088, "E088", 1000, 0.0, -250.0, 374.0, 499.3, 386.0, xmlLeipzig_E088 },
+    { 0xE089, "E089", 1000, 0.0, -250.0, 385.0, 500.0, 397.0, xmlLeipzig_E089 },
+    { 0xE08A, "E08A", 1000, 0.0, -249.0, 414.0, 500.0, 422.0, xmlLeipzig_E08A },
+    { 0xE08B, "E08B", 1000, 0.0, -319.0, 417.0, 637.0, 2048.0, xmlLeipzig_E08B },
+    { 0xE0A2, "E0A2", 1000, 0.0, -133.0, 405.0, 266.0, 405.0, xmlLeipzig_E0A2 },
+    { 0xE0A3, "E0A3", 1000, 0.0, -132.0, 314.0, 270.0, 314.0, xmlLeipzig_E0A3 },
+    { 0xE0A4, "E0A4", 1000, 0.0, -133.0, 314.0, 266.0, 314.0, xmlLeipzig_E0A4 },
+    { 0xE0FA, "E0FA", 1000, -0.0, -133.0, 405.0, 266.0, 405.0, xmlLeipzig_E0FA },
+    { 0xE101, "E101", 1000, 0.0, -242.0, 508.0, 484.0, 508.0, xmlLeipzig_E101 },
+    { 0xE220, "E220", 1000, -163.0, -124.0, 326.0, 249.0, 163.0, xmlLeipzig_E220 },
+    { 0xE221, "E221", 1000, -163.0, -193.0, 326.0, 386.0, 164.0, xmlLeipzig_E221 },
+    { 0xE222, "E222", 1000, -162.0, -258.0, 324.0, 516.0, 162.0, xmlLeipzig_E222 },
+    { 0xE223, "E223", 1000, -162.0, -325.0, 324.0, 651.0, 162.0, xmlLeipzig_E223 },
+    { 0xE224, "E224", 1000, -162.0, -392.0, 324.0, 785.0, 162.0, xmlLeipzig_E224 },
+    { 0xE240, "E240", 1000, 0.0, -579.0, 276.0, 577.0, 274.0, xmlLeipzig_E240 },
+    { 0xE241, "E241", 1000, 0.0, 2.0, 276.0, 577.0, 274.0, xmlLeipzig_E241 },
+    { 0xE260, "E260", 1000, 0.0, -175.0, 198.0, 644.0, 200.0, xmlLeipzig_E260 },
+    { 0xE261, "E261", 1000, 0.0, -351.0, 157.0, 702.0, 157.0, xmlLeipzig_E261 },
+    { 0xE262, "E262", 1000, 0.0, -339.0, 197.0, 694.0, 280.0, xmlLeipzig_E262 },
+    { 0xE263, "E263", 1000, 0.0, -120.0, 257.0, 240.0, 258.0, xmlLeipzig_E263 },
+    { 0xE264, "E264", 1000, 0.0, -175.0, 388.0, 644.0, 388.0, xmlLeipzig_E264 },
+    { 0xE265, "E265", 1000, 0.0, -339.0, 475.0, 694.0, 258.0, xmlLeipzig_E265 },
+    { 0xE266, "E266", 1000, 0.0, -175.0, 578.0, 644.0, 578.0, xmlLeipzig_E266 },
+    { 0xE267, "E267", 1000, 0.0, -351.0, 378.0, 820.0, 368.0, xmlLeipzig_E267 },
+    { 0xE268, "E268", 1000, 0.0, -351.0, 377.0, 706.0, 368.0, xmlLeipzig_E268 },
+    { 0xE269, "E269", 1000, 0.0, -339.0, 412.0, 694.0, 414.0, xmlLeipzig_E269 },
+    { 0xE26A, "E26A", 1000, 0.0, -251.0, 163.0, 501.0, 163.0, xmlLeipzig_E26A },
+    { 0xE26B, "E26B", 1000, 0.0, -251.0, 163.0, 501.0, 163.0, xmlLeipzig_E26B },
+    { 0xE4A0, "E4A0", 1000, 0.0, 0.0, 347.0, 236.0, 0.0, xmlLeipzig_E4A0 },
+    { 0xE4A1, "E4A1", 1000, 0.0, -236.0, 347.0, 236.0, 0.0, xmlLeipzig_E4A1 },
+    { 0xE4A2, "E4A2", 1000, 0.0, 0.0, 95.0, 94.0, 96.0, xmlLeipzig_E4A2 },
+    { 0xE4A3, "E4A3", 1000, 0.0, -94.0, 95.0, 94.0, 96.0, xmlLeipzig_E4A3 },
+    { 0xE4A4, "E4A4", 1000, 0.0, 0.0, 347.0, 33.0, 0.0, xmlLeipzig_E4A4 },
+    { 0xE4A5, "E4A5", 1000, 0.0, -33.0, 347.0, 33.0, 0.0, xmlLeipzig_E4A5 },
+    { 0xE4A6, "E4A6", 1000, 0.0, 0.0, 110.5, 244.0, 110.0, xmlLeipzig_E4A6 },
+    { 0xE4A7, "E4A7", 1000, 0.0, -244.0, 110.5, 244.0, 110.0, xmlLeipzig_E4A7 },
+    { 0xE4A8, "E4A8", 1000, 0.0, 0.0, 153.0, 224.0, 153.0, xmlLeipzig_E4A8 },
+    { 0xE4A9, "E4A9", 1000, 0.0, -224.0, 153.0, 224.0, 153.0, xmlLeipzig_E4A9 },
+    { 0xE4AA, "E4AA", 1000, 0.0, 0.0, 33.0, 240.0, 1000.0, xmlLeipzig_E4AA },
+    { 0xE4AB, "E4AB", 1000, 0.0, -240.0, 33.0, 240.0, 34.0, xmlLeipzig_E4AB },
+    { 0xE4AC, "E4AC", 1000, 0.0, 0.0, 273.0, 265.0, 274.0, xmlLeipzig_E4AC },
+    { 0xE4AD, "E4AD", 1000, 1.0, -265.0, 273.0, 265.0, 274.0, xmlLeipzig_E4AD },
+    { 0xE4AE, "E4AE", 1000, 0.0, 0.0, 273.0, 375.0, 274.0, xmlLeipzig_E4AE },
+    { 0xE4AF, "E4AF", 1000, 1.0, -375.0, 273.0, 375.0, 274.0, xmlLeipzig_E4AF },
+    { 0xE4B0, "E4B0", 1000, 0.0, 0.0, 347.0, 346.0, 0.0, xmlLeipzig_E4B0 },
+    { 0xE4B1, "E4B1", 1000, 0.0, -346.0, 347.0, 346.0, 0.0, xmlLeipzig_E4B1 },
+    { 0xE4B2, "E4B2", 1000, 0.0, 0.0, 347.0, 173.0, 0.0, xmlLeipzig_E4B2 },
+    { 0xE4B3, "E4B3", 1000, 0.0, -173.0, 347.0, 173.0, 0.0, xmlLeipzig_E4B3 },
+    { 0xE4B4, "E4B4", 1000, 0.0, 0.0, 347.0, 308.0, 0.0, xmlLeipzig_E4B4 },
+    { 0xE4B5, "E4B5", 1000, 0.0, -308.0, 347.0, 308.0, 0.0, xmlLeipzig_E4B5 },
+    { 0xE4B6, "E4B6", 1000, -0.0, 0.0, 195.6, 194.4, 196.0, xmlLeipzig_E4B6 },
+    { 0xE4B7, "E4B7", 1000, -0.0, -194.4, 195.6, 194.4, 196.0, xmlLeipzig_E4B7 },
+    { 0xE4B8, "E4B8", 1000, 0.0, 0.0, 270.0, 167.0, 270.0, xmlLeipzig_E4B8 },
+    { 0xE4B9, "E4B9", 1000, 0.0, -167.0, 270.0, 167.0, 270.0, xmlLeipzig_E4B9 },
+    { 0xE4BA, "E4BA", 1000, -0.3, 0.0, 234.3, 96.0, 234.0, xmlLeipzig_E4BA },
+    { 0xE4BB, "E4BB", 1000, -0.3, -96.0, 234.3, 96.0, 234.0, xmlLeipzig_E4BB },
+    { 0xE4BC, "E4BC", 1000, 0.0, 0.0, 347.0, 350.0, 0.0, xmlLeipzig_E4BC },
+    { 0xE4BD, "E4BD", 1000, 0.0, -350.0, 347.0, 350.0, 0.0, xmlLeipzig_E4BD },
+    { 0xE4C0, "E4C0", 1000, 0.0, -3.0, 605.0, 323.0, 605.0, xmlLeipzig_E4C0 },
+    { 0xE4C1, "E4C1", 1000, 0.0, -320.0, 605.0, 323.0, 605.0, xmlLeipzig_E4C1 },
+    { 0xE4C2, "E4C2", 1000, -0.4, -0.3, 779.4, 449.3, 779.0, xmlLeipzig_E4C2 },
+    { 0xE4C3, "E4C3", 1000, -0.4, -449.0, 779.4, 449.3, 779.0, xmlLeipzig_E4C3 },
+    { 0xE4C4, "E4C4", 1000, -0.4, -0.3, 779.4, 449.3, 779.0, xmlLeipzig_E4C4 },
+    { 0xE4C5, "E4C5", 1000, -0.4, -449.0, 779.4, 449.3, 779.0, xmlLeipzig_E4C5 },
+    { 0xE4C6, "E4C6", 1000, 1.0, 0.0, 788.0, 439.0, 790.0, xmlLeipzig_E4C6 },
+    { 0xE4C7, "E4C7", 1000, 1.0, -439.0, 788.0, 439.0, 790.0, xmlLeipzig_E4C7 },
+    { 0xE4C8, "E4C8", 1000, 1.0, 0.0, 788.0, 439.0, 790.0, xmlLeipzig_E4C8 },
+    { 0xE4C9, "E4C9", 1000, 1.0, -439.0, 788.0, 439.0, 790.0, xmlLeipzig_E4C9 },
+    { 0xE4CE, "E4CE", 1000, 0.0, 0.0, 180.0, 300.0, 180.0, xmlLeipzig_E4CE },
+    { 0xE4E5, "E4E5", 1000, 0.0, -388.0, 305.0, 760.0, 324.0, xmlLeipzig_E4E5 },
+    { 0xE4E6, "E4E6", 1000, 0.0, -250.0, 276.0, 433.0, 290.0, xmlLeipzig_E4E6 },
+    { 0xE4E7, "E4E7", 1000, 1.0, -492.0, 324.0, 666.0, 376.0, xmlLeipzig_E4E7 },
+    { 0xE4E8, "E4E8", 1000, 4.0, -485.0, 398.0, 898.0, 466.0, xmlLeipzig_E4E8 },
+    { 0xE4E9, "E4E9", 1000, 5.0, -479.0, 478.0, 1131.0, 553.0, xmlLeipzig_E4E9 },
+    { 0xE4EA, "E4EA", 1000, 7.0, -734.0, 572.0, 1411.0, 663.0, xmlLeipzig_E4EA },
+    { 0xE500, "E500", 1000, 0.0, -242.0, 508.0, 484.0, 508.0, xmlLeipzig_E500 },
+    { 0xE501, "E501", 1000, 0.0, -242.0, 750.0, 484.0, 751.0, xmlLeipzig_E501 },
+    { 0xE502, "E502", 1000, 0.0, -242.0, 1234.0, 484.0, 1234.0, xmlLeipzig_E502 },
+    { 0xE510, "E510", 1000, 0.0, 1.0, 266.0, 331.0, 266.0, xmlLeipzig_E510 },
+    { 0xE511, "E511", 1000, 0.0, 1.0, 657.0, 349.0, 657.0, xmlLeipzig_E511 },
+    { 0xE512, "E512", 1000, 0.0, 0.0, 650.0, 332.0, 266.0, xmlLeipzig_E512 },
+    { 0xE513, "E513", 1000, 0.0, 0.0, 624.0, 332.0, 624.0, xmlLeipzig_E513 },
+    { 0xE514, "E514", 1000, 3.0, -8.0, 423.0, 329.0, 426.0, xmlLeipzig_E514 },
+    { 0xE515, "E515", 1000, 3.0, -8.0, 923.0, 335.0, 926.0, xmlLeipzig_E515 },
+    { 0xE516, "E516", 1000, 3.0, -8.0, 913.0, 329.0, 916.0, xmlLeipzig_E516 },
+    { 0xE517, "E517", 1000, 0.0, -15.0, 504.0, 326.0, 504.0, xmlLeipzig_E517 },
+    { 0xE518, "E518", 1000, 0.0, -15.0, 1021.0, 332.0, 1021.0, xmlLeipzig_E518 },
+    { 0xE519, "E519", 1000, 0.0, -15.0, 991.0, 326.0, 991.0, xmlLeipzig_E519 },
+    { 0xE520, "E520", 1000, -49.0, -167.0, 382.0, 430.0, 306.0, xmlLeipzig_E520 },
+    { 0xE521, "E521", 1000, -44.0, -18.0, 472.0, 280.0, 405.0, xmlLeipzig_E521 },
+    { 0xE522, "E522", 1000, -143.0, -223.0, 448.0, 665.0, 232.0, xmlLeipzig_E522 },
+    { 0xE523, "E523", 1000, -20.0, 0.0, 245.0, 259.0, 225.0, xmlLeipzig_E523 },
+    { 0xE524, "E524", 1000, 0.0, 0.0, 194.0, 270.0, 194.0, xmlLeipzig_E524 },
+    { 0xE525, "E525", 1000, -36.0, -16.0, 296.0, 265.0, 260.0, xmlLeipzig_E525 },
+    { 0xE526, "E526", 1000, -39.0, -18.0, 352.0, 280.0, 290.0, xmlLeipzig_E526 },
+    { 0xE527, "E527", 1000, -49.0, -167.0, 1882.0, 430.0, 1800.0, xmlLeipzig_E527 },
+    { 0xE528, "E528", 1000, -49.0, -167.0, 1582.0, 430.0, 1500.0, xmlLeipzig_E528 },
+    { 0xE529, "E529", 1000, -49.0, -167.0, 1282.0, 430.0, 1200.0, xmlLeipzig_E529 },
+    { 0xE52A, "E52A", 1000, -49.0, -167.0, 982.0, 430.0, 900.0, xmlLeipzig_E52A },
+    { 0xE52B, "E52B", 1000, -49.0, -167.0, 682.0, 430.0, 600.0, xmlLeipzig_E52B },
+    { 0xE52C, "E52C", 1000, -44.0, -167.0, 782.0, 430.0, 711.0, xmlLeipzig_E52C },
+    { 0xE52D, "E52D", 1000, -44.0, -223.0, 754.0, 665.0, 637.0, xmlLeipzig_E52D },
+    { 0xE52E, "E52E", 1000, -49.0, -223.0, 687.0, 665.0, 306.0, xmlLeipzig_E52E },
+    { 0xE52F, "E52F", 1000, -143.0, -223.0, 698.0, 665.0, 479.0, xmlLeipzig_E52F },
+    { 0xE530, "E530", 1000, -144.0, -223.0, 908.0, 667.0, 692.0, xmlLeipzig_E530 },
+    { 0xE531, "E531", 1000, -144.0, -223.0, 1140.0, 667.0, 925.0, xmlLeipzig_E531 },
+    { 0xE532, "E532", 1000, -144.0, -223.0, 1374.0, 667.0, 1158.0, xmlLeipzig_E532 },
+    { 0xE533, "E533", 1000, -143.0, -223.0, 1605.0, 667.0, 1390.0, xmlLeipzig_E533 },
+    { 0xE534, "E534", 1000, -143.0, -223.0, 708.0, 665.0, 532.0, xmlLeipzig_E534 },
+    { 0xE535, "E535", 1000, -143.0, -223.0, 635.0, 665.0, 492.0, xmlLeipzig_E535 },
+    { 0xE536, "E536", 1000, 0.0, -223.0, 499.0, 665.0, 428.0, xmlLeipzig_E536 },
+    { 0xE537, "E537", 1000, 0.0, -223.0, 761.0, 665.0, 728.0, xmlLeipzig_E537 },
+    { 0xE538, "E538", 1000, 0.0, -223.0, 1061.0, 665.0, 1028.0, xmlLeipzig_E538 },
+    { 0xE539, "E539", 1000, 0.0, -223.0, 688.0, 665.0, 688.0, xmlLeipzig_E539 },
+    { 0xE53A, "E53A", 1000, 0.0, -223.0, 1021.0, 665.0, 988.0, xmlLeipzig_E53A },
+    { 0xE53B, "E53B", 1000, 0.0, -223.0, 920.0, 665.0, 920.0, xmlLeipzig_E53B },
+    { 0xE53C, "E53C", 1000, -20.0, -223.0, 550.0, 665.0, 457.0, xmlLeipzig_E53C },
+    { 0xE53D, "E53D", 1000, -20.0, -223.0, 737.0, 665.0, 717.0, xmlLeipzig_E53D },
+    { 0xE566, "E566", 1000, 0.0, 0.0, 432.0, 364.0, 240.0, xmlLeipzig_E566 },
+    { 0xE567, "E567", 1000, 0.0, -0.0, 468.1, 244.0, 468.0, xmlLeipzig_E567 },
+    { 0xE568, "E568", 1000, 0.0, 0.0, 468.1, 244.0, 468.0, xmlLeipzig_E568 },
+    { 0xE56A, "E56A", 1000, 0.0, 0.0, 244.0, 468.1, 248.0, xmlLeipzig_E56A },
+    { 0xE56B, "E56B", 1000, -0.0, 0.0, 244.0, 468.1, 248.0, xmlLeipzig_E56B },
+    { 0xE56C, "E56C", 1000, 0.0, -2.0, 605.0, 242.0, 605.0, xmlLeipzig_E56C },
+    { 0xE56D, "E56D", 1000, 0.0, -90.0, 586.0, 399.0, 587.0, xmlLeipzig_E56D },
+    { 0xE56E, "E56E", 1000, 0.0, -1.0, 710.0, 199.0, 711.0, xmlLeipzig_E56E },
+    { 0xE610, "E610", 1000, 0.0, 0.0, 240.0, 230.0, 240.0, xmlLeipzig_E610 },
+    { 0xE611, "E611", 1000, 0.0, 0.0, 240.0, 230.0, 240.0, xmlLeipzig_E611 },
+    { 0xE612, "E612", 1000, 0.0, 0.0, 218.0, 260.0, 218.0, xmlLeipzig_E612 },
+    { 0xE613, "E613", 1000, 0.0, 0.0, 218.0, 260.0, 218.0, xmlLeipzig_E613 },
+    { 0xE614, "E614", 1000, 0.0, 0.0, 206.0, 206.0, 206.0, xmlLeipzig_E614 },
+    { 0xE650, "E650", 1000, 0.0, 0.0, 695.0, 514.0, 695.0, xmlLeipzig_E650 },
+    { 0xE655, "E655", 1000, 0.0, -0.0, 430.9, 418.2, 431.0, xmlLeipzig_E655 },
+    { 0xE880, "E880", 1000, 0.0, 0.0, 243.0, 326.0, 243.0, xmlLeipzig_E880 },
+    { 0xE881, "E881", 1000, 0.0, 0.0, 207.0, 311.0, 207.0, xmlLeipzig_E881 },
+    { 0xE882, "E882", 1000, 0.0, -15.0, 260.0, 326.0, 260.0, xmlLeipzig_E882 },
+    { 0xE883, "E883", 1000, 0.0, 0.0, 255.0, 326.0, 255.0, xmlLeipzig_E883 },
+    { 0xE884, "E884", 1000, 0.0, 0.0, 259.0, 311.0, 259.0, xmlLeipzig_E884 },
+    { 0xE885, "E885", 1000, 0.0, 0.0, 240.0, 326.0, 240.0, xmlLeipzig_E885 },
+    { 0xE886, "E886", 1000, 0.0, 0.0, 214.0, 326.0, 214.0, xmlLeipzig_E886 },
+    { 0xE887, "E887", 1000, 0.0, 0.0, 243.0, 311.0, 243.0, xmlLeipzig_E887 },
+    { 0xE888, "E888", 1000, 0.0, 0.0, 274.0, 326.0, 274.0, xmlLeipzig_E888 },
+    { 0xE889, "E889", 1000, 0.0, -1.0, 225.0, 327.0, 225.0, xmlLeipzig_E889 },
+    { 0xE88A, "E88A", 1000, 17.0, 50.0, 110.0, 194.0, 144.0, xmlLeipzig_E88A },
+    { 0xE901, "E901", 1000, -12.1, -176.3, 461.1, 935.5, 596.0, xmlLeipzig_E901 },
+    { 0xE902, "E902", 1000, -189.1, -268.0, 370.1, 470.0, 181.0, xmlLeipzig_E902 },
+    { 0xE904, "E904", 1000, 0.0, -883.0, 677.0, 1208.0, 677.0, xmlLeipzig_E904 },
+    { 0xE906, "E906", 1000, -1.0, -202.0, 182.0, 404.0, 181.0, xmlLeipzig_E906 },
+    { 0xE909, "E909", 1000, 0.0, -602.0, 309.0, 1197.0, 309.0, xmlLeipzig_E909 },
+    { 0xE938, "E938", 1000, 0.0, -192.0, 312.0, 386.0, 312.0, xmlLeipzig_E938 },
+    { 0xE939, "E939", 1000, 0.0, -192.0, 312.0, 386.0, 312.0, xmlLeipzig_E939 },
+    { 0xE93C, "E93C", 1000, 0.0, -192.0, 312.0, 386.0, 312.0, xmlLeipzig_E93C },
+    { 0xE93D, "E93D", 1000, 0.0, -192.0, 312.0, 386.0, 312.0, xmlLeipzig_E93D },
+    { 0xE93E, "E93E", 1000, 0.0, 0.0, 30.0, 760.0, 30.0, xmlLeipzig_E93E },
+    { 0xE93F, "E93F", 1000, 0.0, -760.0, 30.0, 760.0, 30.0, xmlLeipzig_E93F },
+    { 0xE949, "E949", 1000, 0.0, 0.0, 186.0, 760.0, 186.0, xmlLeipzig_E949 },
+    { 0xE94A, "E94A", 1000, 0.0, -760.0, 186.0, 760.0, 186.0, xmlLeipzig_E94A },
+    { 0xE94B, "E94B", 1000, 0.0, 0.0, 186.0, 760.0, 186.0, xmlLeipzig_E94B },
+    { 0xE94C, "E94C", 1000, 0.0, -760.0, 186.0, 760.0, 186.0, xmlLeipzig_E94C },
+    { 0xE9F0, "E9F0", 1000, 0.0, -500.0, 130.0, 1000.0, 1000.0, xmlLeipzig_E9F0 },
+    { 0xE9F1, "E9F1", 1000, 0.0, -500.0, 40.0, 1000.0, 1000.0, xmlLeipzig_E9F1 },
+    { 0xE9F2, "E9F2", 1000, 0.0, -250.0, 40.0, 500.0, 1000.0, xmlLeipzig_E9F2 },
+    { 0xE9F3, "E9F3", 1000, 0.0, 0.0, 40.0, 250.0, 1000.0, xmlLeipzig_E9F3 },
+    { 0xE9F4, "E9F4", 1000, 0.0, 0.0, 40.0, 250.0, 1000.0, xmlLeipzig_E9F4 },
+    { 0xE9F5, "E9F5", 1000, 0.0, 110.0, 40.0, 140.0, 1000.0, xmlLeipzig_E9F5 },
+    { 0xE9F6, "E9F6", 1000, 0.0, 0.0, 40.0, 140.0, 1000.0, xmlLeipzig_E9F6 },
+    { 0xE9F7, "E9F7", 1000, 0.0, 0.0, 118.0, 140.0, 1000.0, xmlLeipzig_E9F7 },
+    { 0xE9F8, "E9F8", 1000, 0.0, 0.0, 118.0, 140.0, 1000.0, xmlLeipzig_E9F8 },
+};
+
+//----------------------------------------------------------------------------
+// Gootville
+//----------------------------------------------------------------------------
+
+static const char xmlGootville_E003[] =
+    "<symbol id=\"E003\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 0c0 11 12 21 24 21c158 0 289 71 379 139c0 0 4 3 6 3c3 0 5 -2 5 -7c0 -31 -171 -233 -414 -233v77z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E004[] =
+    "<symbol id=\"E004\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 0v77c243 0 414 -202 414 -233c0 -5 -2 -7 -5 -7c-2 0 -6 3 -6 3c-90 68 -221 139 -379 139c-12 0 -24 10 -24 21z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E045[] =
+    "<symbol id=\"E045\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E046[] =
+    "<symbol id=\"E046\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E047[] =
+    "<symbol id=\"E047\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -84c0 25 21 46 46 46s46 -21 46 -46s-21 -46 -46 -46s-46 21 -46 46zM25 -330c0 7 4 14 8 20l168 279c-80 46 -165 131 -165 236c0 75 42 143 121 143c47 0 112 -36 112 -96c0 -26 -18 -45 -45 -45c-22 0 -37 11 -46 38s-34 46 -58 46c-26 0 -44 -19 -44 -45 c0 -79 91 -153 174 -196l169 280c8 13 13 18 22 18c12 0 20 -7 20 -18c0 -7 -4 -14 -8 -20l-168 -279c80 -46 165 -131 165 -236c0 -75 -42 -143 -121 -143c-47 0 -112 36 -112 96c0 26 18 45 45 45c22 0 37 -11 46 -38s34 -46 58 -46c26 0 44 19 44 45 c0 79 -91 153 -174 196l-169 -280c-8 -13 -13 -18 -22 -18c-12 0 -20 7 -20 18zM394 84c0 25 21 46 46 46s46 -21 46 -46s-21 -46 -46 -46s-46 21 -46 46z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E048[] =
+    "<symbol id=\"E048\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 0c0 20 20 20 20 20h35c6 109 57 218 157 231v45s0 20 20 20s20 -20 20 -20v-45c100 -13 151 -122 157 -231h35s20 0 20 -20s-20 -20 -20 -20h-35c-6 -109 -57 -218 -157 -231v-45s0 -20 -20 -20s-20 20 -20 20v45c-100 13 -151 122 -157 231h-35s-20 0 -20 20zM144 20 h68v194c-47 -20 -66 -110 -68 -194zM144 -20c2 -84 21 -174 68 -194v194h-68zM252 20h68c-2 84 -21 174 -68 194v-194zM252 -20v-194c47 20 66 110 68 194h-68z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E04B[] =
+    "<symbol id=\"E04B\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E050[] =
+    "<symbol id=\"E050\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 102c0 177 136 324 260 434c0 0 -43 178 -43 246c0 88 33 172 69 220s66 78 78 78c9 0 22 -8 37 -26c65 -78 98 -183 98 -279c0 -150 -83 -254 -181 -348l37 -174c11 2 22 2 33 2c138 0 238 -114 238 -240c0 -105 -68 -199 -170 -240c0 0 32 -146 32 -191 c0 -121 -82 -217 -204 -217c-73 0 -182 41 -182 151c0 56 45 101 101 101s101 -45 101 -101c0 -53 -40 -97 -92 -101c14 -12 49 -17 72 -17c97 0 171 74 171 184c0 49 -31 180 -31 180c-25 -7 -52 -10 -80 -10c-187 0 -344 162 -344 348zM94 49c0 -157 121 -269 250 -269 c26 0 51 3 74 10l-74 351c-58 -20 -96 -72 -96 -124c0 -41 19 -87 57 -110c5 -3 9 -8 9 -14c0 -8 -7 -15 -15 -15c-3 0 -8 2 -8 2c-66 29 -113 87 -113 173c0 81 55 164 144 192l-33 155c-153 -148 -195 -273 -195 -351zM262 723c0 -44 27 -160 27 -160 c80 78 159 190 159 296c0 43 -8 77 -49 77c-81 0 -137 -123 -137 -213zM377 149l73 -346c63 30 112 105 112 182c0 90 -62 165 -165 165c-7 0 -13 0 -20 -1z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E051[] =
+    "<symbol id=\"E051\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 102c0 177 136 324 260 434c0 0 -43 178 -43 246c0 88 33 172 69 220s66 78 78 78c9 0 22 -8 37 -26c65 -78 98 -183 98 -279c0 -150 -83 -254 -181 -348l37 -174c11 2 22 2 33 2c138 0 238 -114 238 -240c0 -105 -68 -199 -170 -240c0 0 32 -146 32 -191 c0 -121 -82 -217 -204 -217c-73 0 -182 41 -182 151c0 56 45 101 101 101s101 -45 101 -101c0 -53 -40 -97 -92 -101c14 -12 49 -17 72 -17c97 0 171 74 171 184c0 49 -31 180 -31 180c-25 -7 -52 -10 -80 -10c-187 0 -344 162 -344 348zM94 49c0 -157 121 -269 250 -269 c26 0 51 3 74 10l-74 351c-58 -20 -96 -72 -96 -124c0 -41 19 -87 57 -110c5 -3 9 -8 9 -14c0 -8 -7 -15 -15 -15c-3 0 -8 2 -8 2c-66 29 -113 87 -113 173c0 81 55 164 144 192l-33 155c-153 -148 -195 -273 -195 -351zM153 -737c0 2 1 3 1 3l49 96s3 5 5 5h51 c2 0 3 -2 3 -4v-192c0 -18 11 -30 21 -30c4 0 12 0 12 -8c0 -7 -6 -10 -12 -10h-101c-6 0 -12 3 -12 10c0 8 8 8 12 8c10 0 20 12 20 30v142l-34 -54c-2 -4 -3 -4 -6 -4c-4 0 -9 4 -9 8zM262 723c0 -44 27 -160 27 -160c80 78 159 190 159 296c0 43 -8 77 -49 77 c-81 0 -137 -123 -137 -213zM304 -825c0 18 14 32 32 32s31 -14 31 -32c0 -12 -7 -23 -18 -28c2 -2 10 -8 22 -8c26 0 43 29 43 65s-23 59 -49 59c-20 0 -27 -3 -35 -9c-6 -4 -8 -5 -10 -5c-7 0 -7 2 -7 8c0 1 1 25 3 46s3 51 3 52c0 7 2 12 6 12c5 0 12 -2 22 -5 s26 -6 44 -6s39 3 49 6s18 5 24 5c3 0 5 -3 5 -7s0 -12 -9 -23s-35 -28 -69 -28c-21 0 -43 4 -61 10l-3 -50c20 13 37 14 53 14c48 0 93 -31 93 -79s-42 -81 -86 -81c-42 0 -83 17 -83 52zM377 149l73 -346c63 30 112 105 112 182c0 90 -62 165 -165 165c-7 0 -13 0 -20 -1z \"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E052[] =
+    "<symbol id=\"E052\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 102c0 177 136 324 260 434c0 0 -43 178 -43 246c0 88 33 172 69 220s66 78 78 78c9 0 22 -8 37 -26c65 -78 98 -183 98 -279c0 -150 -83 -254 -181 -348l37 -174c11 2 22 2 33 2c138 0 238 -114 238 -240c0 -105 -68 -199 -170 -240c0 0 32 -146 32 -191 c0 -121 -82 -217 -204 -217c-73 0 -182 41 -182 151c0 56 45 101 101 101s101 -45 101 -101c0 -53 -40 -97 -92 -101c14 -12 49 -17 72 -17c97 0 171 74 171 184c0 49 -31 180 -31 180c-25 -7 -52 -10 -80 -10c-187 0 -344 162 -344 348zM94 49c0 -157 121 -269 250 -269 c26 0 51 3 74 10l-74 351c-58 -20 -96 -72 -96 -124c0 -41 19 -87 57 -110c5 -3 9 -8 9 -14c0 -8 -7 -15 -15 -15c-3 0 -8 2 -8 2c-66 29 -113 87 -113 173c0 81 55 164 144 192l-33 155c-153 -148 -195 -273 -195 -351zM213 -801c0 20 10 44 32 55c-14 9 -20 25 -20 43 c0 43 36 70 88 70s88 -27 88 -70c0 -18 -10 -31 -20 -43c22 -16 32 -31 32 -55c0 -50 -54 -76 -100 -76s-100 31 -100 76zM248 -801c0 -30 27 -58 65 -58c24 0 42 12 42 28c0 26 -44 48 -88 70c-8 -10 -19 -24 -19 -40zM262 723c0 -44 27 -160 27 -160 c80 78 159 190 159 296c0 43 -8 77 -49 77c-81 0 -137 -123 -137 -213zM278 -672c0 -25 42 -45 73 -59c6 6 8 20 8 28c0 26 -16 52 -46 52c-23 0 -35 -10 -35 -21zM377 149l73 -346c63 30 112 105 112 182c0 90 -62 165 -165 165c-7 0 -13 0 -20 -1z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E053[] =
+    "<symbol id=\"E053\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 102c0 177 136 324 260 434c0 0 -43 178 -43 246c0 88 33 172 69 220s66 78 78 78c9 0 22 -8 37 -26c65 -78 98 -183 98 -279c0 -150 -83 -254 -181 -348l37 -174c11 2 22 2 33 2c138 0 238 -114 238 -240c0 -105 -68 -199 -170 -240c0 0 32 -146 32 -191 c0 -121 -82 -217 -204 -217c-73 0 -182 41 -182 151c0 56 45 101 101 101s101 -45 101 -101c0 -53 -40 -97 -92 -101c14 -12 49 -17 72 -17c97 0 171 74 171 184c0 49 -31 180 -31 180c-25 -7 -52 -10 -80 -10c-187 0 -344 162 -344 348zM94 49c0 -157 121 -269 250 -269 c26 0 51 3 74 10l-74 351c-58 -20 -96 -72 -96 -124c0 -41 19 -87 57 -110c5 -3 9 -8 9 -14c0 -8 -7 -15 -15 -15c-3 0 -8 2 -8 2c-66 29 -113 87 -113 173c0 81 55 164 144 192l-33 155c-153 -148 -195 -273 -195 -351zM213 1156c0 20 10 44 32 55c-14 9 -20 25 -20 43 c0 43 36 70 88 70s88 -27 88 -70c0 -18 -10 -31 -20 -43c22 -16 32 -31 32 -55c0 -50 -54 -76 -100 -76s-100 31 -100 76zM248 1156c0 -30 27 -58 65 -58c24 0 42 12 42 28c0 26 -44 48 -88 70c-8 -10 -19 -24 -19 -40zM262 723c0 -44 27 -160 27 -160 c80 78 159 190 159 296c0 43 -8 77 -49 77c-81 0 -137 -123 -137 -213zM278 1285c0 -25 42 -45 73 -59c6 6 8 20 8 28c0 26 -16 52 -46 52c-23 0 -35 -10 -35 -21zM377 149l73 -346c63 30 112 105 112 182c0 90 -62 165 -165 165c-7 0 -13 0 -20 -1z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E054[] =
+    "<symbol id=\"E054\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 102c0 177 136 324 260 434c0 0 -43 178 -43 246c0 88 33 172 69 220s66 78 78 78c9 0 22 -8 37 -26c65 -78 98 -183 98 -279c0 -150 -83 -254 -181 -348l37 -174c11 2 22 2 33 2c138 0 238 -114 238 -240c0 -105 -68 -199 -170 -240c0 0 32 -146 32 -191 c0 -121 -82 -217 -204 -217c-73 0 -182 41 -182 151c0 56 45 101 101 101s101 -45 101 -101c0 -53 -40 -97 -92 -101c14 -12 49 -17 72 -17c97 0 171 74 171 184c0 49 -31 180 -31 180c-25 -7 -52 -10 -80 -10c-187 0 -344 162 -344 348zM94 49c0 -157 121 -269 250 -269 c26 0 51 3 74 10l-74 351c-58 -20 -96 -72 -96 -124c0 -41 19 -87 57 -110c5 -3 9 -8 9 -14c0 -8 -7 -15 -15 -15c-3 0 -8 2 -8 2c-66 29 -113 87 -113 173c0 81 55 164 144 192l-33 155c-153 -148 -195 -273 -195 -351zM153 1220c0 2 1 3 1 3l49 96s3 5 5 5h51 c2 0 3 -2 3 -4v-192c0 -18 11 -30 21 -30c4 0 12 0 12 -8c0 -7 -6 -10 -12 -10h-101c-6 0 -12 3 -12 10c0 8 8 8 12 8c10 0 20 12 20 30v142l-34 -54c-2 -4 -3 -4 -6 -4c-4 0 -9 4 -9 8zM262 723c0 -44 27 -160 27 -160c80 78 159 190 159 296c0 43 -8 77 -49 77 c-81 0 -137 -123 -137 -213zM304 1132c0 18 14 32 32 32s31 -14 31 -32c0 -12 -7 -23 -18 -28c2 -2 10 -8 22 -8c26 0 43 29 43 65s-23 59 -49 59c-20 0 -27 -3 -35 -9c-6 -4 -8 -5 -10 -5c-7 0 -7 2 -7 8c0 1 1 25 3 46s3 51 3 52c0 7 2 12 6 12c5 0 12 -2 22 -5 s26 -6 44 -6s39 3 49 6s18 5 24 5c3 0 5 -3 5 -7s0 -12 -9 -23s-35 -28 -69 -28c-21 0 -43 4 -61 10l-3 -50c20 13 37 14 53 14c48 0 93 -31 93 -79s-42 -81 -86 -81c-42 0 -83 17 -83 52zM377 149l73 -346c63 30 112 105 112 182c0 90 -62 165 -165 165c-7 0 -13 0 -20 -1z \"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E05C[] =
+    "<symbol id=\"E05C\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -490v980c0 6 4 10 10 10h101c6 0 10 -4 10 -10v-980c0 -6 -4 -10 -10 -10h-101c-6 0 -10 4 -10 10zM167 -490v980c0 6 4 10 10 10h10c6 0 10 -4 10 -10v-468c54 43 108 116 108 198c0 11 5 17 13 17s13 -6 13 -17c0 -82 59 -136 119 -136c83 0 86 84 86 198 c0 134 -11 195 -108 195c-24 0 -53 -6 -73 -15c26 -7 45 -30 45 -58c0 -33 -27 -60 -60 -60s-60 27 -60 60c0 60 81 96 148 96c111 0 214 -87 214 -218c0 -122 -84 -222 -192 -222c-31 0 -53 13 -78 28l-53 -88l53 -88c25 15 47 28 78 28c108 0 192 -100 192 -222 c0 -131 -103 -218 -214 -218c-67 0 -148 36 -148 96c0 33 27 60 60 60s60 -27 60 -60c0 -28 -19 -51 -45 -58c20 -9 49 -15 73 -15c97 0 108 61 108 195c0 114 -3 198 -86 198c-60 0 -119 -54 -119 -136c0 -11 -5 -17 -13 -17s-13 6 -13 17c0 82 -54 155 -108 198v-468 c0 -6 -4 -10 -10 -10h-10c-6 0 -10 4 -10 10z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E05D[] =
+    "<symbol id=\"E05D\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -490v980c0 6 4 10 10 10h101c6 0 10 -4 10 -10v-980c0 -6 -4 -10 -10 -10h-101c-6 0 -10 4 -10 10zM167 -490v980c0 6 4 10 10 10h10c6 0 10 -4 10 -10v-468c54 43 108 116 108 198c0 11 5 17 13 17s13 -6 13 -17c0 -82 59 -136 119 -136c83 0 86 84 86 198 c0 134 -11 195 -108 195c-24 0 -53 -6 -73 -15c26 -7 45 -30 45 -58c0 -33 -27 -60 -60 -60s-60 27 -60 60c0 60 81 96 148 96c111 0 214 -87 214 -218c0 -122 -84 -222 -192 -222c-31 0 -53 13 -78 28l-53 -88l53 -88c25 15 47 28 78 28c108 0 192 -100 192 -222 c0 -131 -103 -218 -214 -218c-67 0 -148 36 -148 96c0 33 27 60 60 60s60 -27 60 -60c0 -28 -19 -51 -45 -58c20 -9 49 -15 73 -15c97 0 108 61 108 195c0 114 -3 198 -86 198c-60 0 -119 -54 -119 -136c0 -11 -5 -17 -13 -17s-13 6 -13 17c0 82 -54 155 -108 198v-468 c0 -6 -4 -10 -10 -10h-10c-6 0 -10 4 -10 10zM221 -668c0 20 10 44 32 55c-14 9 -20 25 -20 43c0 43 36 70 88 70s88 -27 88 -70c0 -18 -10 -31 -20 -43c22 -16 32 -31 32 -55c0 -50 -54 -76 -100 -76s-100 31 -100 76zM256 -668c0 -30 27 -58 65 -58c24 0 42 12 42 28 c0 26 -44 48 -88 70c-8 -10 -19 -24 -19 -40zM286 -539c0 -25 42 -45 73 -59c6 6 8 20 8 28c0 26 -16 52 -46 52c-23 0 -35 -10 -35 -21z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E062[] =
+    "<symbol id=\"E062\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -531c0 6 3 10 9 13c236 101 410 282 410 516c0 128 -53 224 -177 224c-67 0 -130 -22 -169 -73c11 4 22 6 34 6c56 0 101 -45 101 -101s-45 -101 -101 -101s-101 45 -101 101c0 110 103 200 236 200c173 0 306 -101 306 -256c0 -297 -274 -491 -525 -543 c0 0 -5 -1 -8 -1c-8 0 -15 7 -15 15zM588 119c0 21 17 38 38 38s38 -17 38 -38s-17 -38 -38 -38s-38 17 -38 38zM588 -119c0 21 17 38 38 38s38 -17 38 -38s-17 -38 -38 -38s-38 17 -38 38z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E063[] =
+    "<symbol id=\"E063\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -531c0 6 3 10 9 13c236 101 410 282 410 516c0 128 -53 224 -177 224c-67 0 -130 -22 -169 -73c11 4 22 6 34 6c56 0 101 -45 101 -101s-45 -101 -101 -101s-101 45 -101 101c0 110 103 200 236 200c173 0 306 -101 306 -256c0 -297 -274 -491 -525 -543 c0 0 -5 -1 -8 -1c-8 0 -15 7 -15 15zM172 -650c0 2 1 3 1 3l49 96s3 5 5 5h51c2 0 3 -2 3 -4v-192c0 -18 11 -30 21 -30c4 0 12 0 12 -8c0 -7 -6 -10 -12 -10h-101c-6 0 -12 3 -12 10c0 8 8 8 12 8c10 0 20 12 20 30v142l-34 -54c-2 -4 -3 -4 -6 -4c-4 0 -9 4 -9 8z M323 -738c0 18 14 32 32 32s31 -14 31 -32c0 -12 -7 -23 -18 -28c2 -2 10 -8 22 -8c26 0 43 29 43 65s-23 59 -49 59c-20 0 -27 -3 -35 -9c-6 -4 -8 -5 -10 -5c-7 0 -7 2 -7 8c0 1 1 25 3 46s3 51 3 52c0 7 2 12 6 12c5 0 12 -2 22 -5s26 -6 44 -6s39 3 49 6s18 5 24 5 c3 0 5 -3 5 -7s0 -12 -9 -23s-35 -28 -69 -28c-21 0 -43 4 -61 10l-3 -50c20 13 37 14 53 14c48 0 93 -31 93 -79s-42 -81 -86 -81c-42 0 -83 17 -83 52zM588 119c0 21 17 38 38 38s38 -17 38 -38s-17 -38 -38 -38s-38 17 -38 38zM588 -119c0 21 17 38 38 38s38 -17 38 -38 s-17 -38 -38 -38s-38 17 -38 38z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E064[] =
+    "<symbol id=\"E064\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -531c0 6 3 10 9 13c236 101 410 282 410 516c0 128 -53 224 -177 224c-67 0 -130 -22 -169 -73c11 4 22 6 34 6c56 0 101 -45 101 -101s-45 -101 -101 -101s-101 45 -101 101c0 110 103 200 236 200c173 0 306 -101 306 -256c0 -297 -274 -491 -525 -543 c0 0 -5 -1 -8 -1c-8 0 -15 7 -15 15zM232 -714c0 20 10 44 32 55c-14 9 -20 25 -20 43c0 43 36 70 88 70s88 -27 88 -70c0 -18 -10 -31 -20 -43c22 -16 32 -31 32 -55c0 -50 -54 -76 -100 -76s-100 31 -100 76zM267 -714c0 -30 27 -58 65 -58c24 0 42 12 42 28 c0 26 -44 48 -88 70c-8 -10 -19 -24 -19 -40zM297 -585c0 -25 42 -45 73 -59c6 6 8 20 8 28c0 26 -16 52 -46 52c-23 0 -35 -10 -35 -21zM588 119c0 21 17 38 38 38s38 -17 38 -38s-17 -38 -38 -38s-38 17 -38 38zM588 -119c0 21 17 38 38 38s38 -17 38 -38s-17 -38 -38 -38 s-38 17 -38 38z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E065[] =
+    "<symbol id=\"E065\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -531c0 6 3 10 9 13c236 101 410 282 410 516c0 128 -53 224 -177 224c-67 0 -130 -22 -169 -73c11 4 22 6 34 6c56 0 101 -45 101 -101s-45 -101 -101 -101s-101 45 -101 101c0 110 103 200 236 200c173 0 306 -101 306 -256c0 -297 -274 -491 -525 -543 c0 0 -5 -1 -8 -1c-8 0 -15 7 -15 15zM232 330c0 20 10 44 32 55c-14 9 -20 25 -20 43c0 43 36 70 88 70s88 -27 88 -70c0 -18 -10 -31 -20 -43c22 -16 32 -31 32 -55c0 -50 -54 -76 -100 -76s-100 31 -100 76zM267 330c0 -30 27 -58 65 -58c24 0 42 12 42 28 c0 26 -44 48 -88 70c-8 -10 -19 -24 -19 -40zM297 459c0 -25 42 -45 73 -59c6 6 8 20 8 28c0 26 -16 52 -46 52c-23 0 -35 -10 -35 -21zM588 119c0 21 17 38 38 38s38 -17 38 -38s-17 -38 -38 -38s-38 17 -38 38zM588 -119c0 21 17 38 38 38s38 -17 38 -38s-17 -38 -38 -38 s-38 17 -38 38z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E066[] =
+    "<symbol id=\"E066\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -531c0 6 3 10 9 13c236 101 410 282 410 516c0 128 -53 224 -177 224c-67 0 -130 -22 -169 -73c11 4 22 6 34 6c56 0 101 -45 101 -101s-45 -101 -101 -101s-101 45 -101 101c0 110 103 200 236 200h-41c-6 0 -12 3 -12 10c0 8 8 8 12 8c10 0 20 12 20 30v142l-34 -54 c-2 -4 -3 -4 -6 -4c-4 0 -9 4 -9 8c0 2 1 3 1 3l49 96s3 5 5 5h51c2 0 3 -2 3 -4v-192c0 -18 11 -30 21 -30c4 0 12 0 12 -8c0 -7 -6 -10 -12 -10h-60c173 0 306 -101 306 -256c0 -297 -274 -491 -525 -543c0 0 -5 -1 -8 -1c-8 0 -15 7 -15 15zM323 306c0 18 14 32 32 32 s31 -14 31 -32c0 -12 -7 -23 -18 -28c2 -2 10 -8 22 -8c26 0 43 29 43 65s-23 59 -49 59c-20 0 -27 -3 -35 -9c-6 -4 -8 -5 -10 -5c-7 0 -7 2 -7 8c0 1 1 25 3 46s3 51 3 52c0 7 2 12 6 12c5 0 12 -2 22 -5s26 -6 44 -6s39 3 49 6s18 5 24 5c3 0 5 -3 5 -7s0 -12 -9 -23 s-35 -28 -69 -28c-21 0 -43 4 -61 10l-3 -50c20 13 37 14 53 14c48 0 93 -31 93 -79s-42 -81 -86 -81c-42 0 -83 17 -83 52zM588 119c0 21 17 38 38 38s38 -17 38 -38s-17 -38 -38 -38s-38 17 -38 38zM588 -119c0 21 17 38 38 38s38 -17 38 -38s-17 -38 -38 -38 s-38 17 -38 38z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E069[] =
+    "<symbol id=\"E069\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 240c0 6 4 10 10 10h94c6 0 10 -4 10 -10v-480c0 -6 -4 -10 -10 -10h-94c-6 0 -10 4 -10 10v480zM226 240c0 6 4 10 10 10h94c6 0 10 -4 10 -10v-480c0 -6 -4 -10 -10 -10h-94c-6 0 -10 4 -10 10v480z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E06A[] =
+    "<symbol id=\"E06A\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 410c0 6 4 10 10 10h250c6 0 10 -4 10 -10v-820c0 -6 -4 -10 -10 -10h-250c-6 0 -10 4 -10 10v820zM45 330v-660h180v660h-180z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E080[] =
+    "<symbol id=\"E080\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 0c0 132 100 243 212 243s212 -111 212 -243s-100 -243 -212 -243s-212 111 -212 243zM132 0c0 -96 0 -217 80 -217s80 121 80 217s0 217 -80 217s-80 -121 -80 -217z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E081[] =
+    "<symbol id=\"E081\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 35c0 4 2 7 2 7l98 192s5 9 9 9h103c4 0 7 -4 7 -8v-384c0 -35 22 -58 41 -58c8 0 24 -1 24 -18c0 -14 -11 -18 -24 -18h-202c-13 0 -24 4 -24 18c0 17 16 18 24 18c19 0 41 23 41 58v285l-68 -107c-4 -7 -7 -10 -13 -10c-9 0 -18 7 -18 16z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E082[] =
+    "<symbol id=\"E082\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -214c0 83 70 142 126 181s110 81 110 147c0 61 -22 98 -78 98c-33 0 -48 -9 -55 -14c21 -10 36 -32 36 -57c0 -35 -28 -63 -63 -63s-63 28 -63 63c0 70 80 102 165 102c91 0 177 -40 177 -129c0 -93 -95 -150 -159 -171s-111 -50 -142 -88c33 26 78 45 120 45 c30 0 52 -6 76 -18s40 -20 56 -20c20 0 32 12 38 18s16 12 22 12s10 -4 10 -12c0 -50 -64 -123 -116 -123c-32 0 -56 7 -80 23s-48 26 -72 26s-36 -4 -54 -18s-26 -20 -34 -20s-20 5 -20 18z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E083[] =
+    "<symbol id=\"E083\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -140c0 35 28 63 63 63s63 -28 63 -63c0 -25 -15 -47 -37 -57c6 -5 21 -15 45 -15c54 0 83 47 83 98c0 67 -47 121 -97 121c-12 0 -16 7 -16 13s4 13 16 13c50 0 101 38 101 92c0 56 -31 87 -76 87c-33 0 -48 -9 -55 -14c21 -10 36 -32 36 -57c0 -35 -28 -63 -63 -63 s-63 28 -63 63c0 70 80 102 165 102c91 0 167 -30 167 -118c0 -59 -60 -83 -120 -105c85 -18 125 -51 125 -134c0 -70 -85 -129 -172 -129c-85 0 -165 33 -165 103z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E084[] =
+    "<symbol id=\"E084\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -106c0 3 0 9 9 19c72 78 126 214 126 308c0 14 1 22 9 22h174c7 0 9 -6 9 -12c0 -3 -2 -8 -5 -11l-272 -307h149v104c0 12 12 25 36 51l59 66s8 10 16 10c3 0 9 -1 9 -10v-221h39s13 -1 13 -17s-13 -17 -13 -17h-39v-28c0 -35 22 -58 41 -58c8 0 24 -1 24 -18 c0 -14 -11 -18 -24 -18h-202c-13 0 -24 4 -24 18c0 17 16 18 24 18c19 0 41 23 41 58v28h-180c-9 0 -19 6 -19 15z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E085[] =
+    "<symbol id=\"E085\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -140c0 35 28 63 63 63s63 -28 63 -63c0 -25 -15 -47 -37 -57c6 -5 21 -15 45 -15c51 0 85 58 85 130s-45 118 -97 118c-40 0 -54 -7 -70 -18s-18 -11 -25 -11c-10 0 -10 10 -10 18c0 2 3 50 6 92s7 102 7 104c0 14 3 22 11 22c12 0 25 -3 45 -9s52 -12 88 -12 s77 6 97 12s37 9 49 9c6 0 10 -6 10 -13s0 -25 -18 -47s-70 -55 -138 -55c-42 0 -88 9 -123 20l-6 -99c39 26 75 27 107 27c95 0 185 -63 185 -158s-84 -161 -172 -161c-85 0 -165 33 -165 103z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E086[] =
+    "<symbol id=\"E086\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 2c0 136 103 241 226 241c74 0 147 -38 147 -98c0 -35 -28 -63 -63 -63s-63 28 -63 63c0 28 17 51 42 60c-7 5 -22 12 -51 12c-81 0 -105 -99 -105 -199c31 18 54 22 80 22c89 0 177 -27 177 -141c0 -75 -87 -142 -177 -142c-127 0 -213 127 -213 245zM154 -101 c0 -60 10 -116 59 -116s59 56 59 116s-10 116 -59 116s-59 -56 -59 -116z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E087[] =
+    "<symbol id=\"E087\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 109v115c0 8 7 10 13 10s11 -2 15 -5s7 -5 13 -5c12 0 29 5 45 10s33 9 51 9c42 0 87 -15 108 -32s31 -18 42 -18c21 0 34 11 51 33c4 6 7 8 13 8s12 -4 12 -11c0 -61 -54 -173 -83 -221s-56 -128 -56 -220c0 -20 0 -25 -10 -25h-132c-9 0 -10 5 -10 25 c0 98 82 206 134 254s81 83 107 126c-35 -26 -76 -42 -116 -42c-33 0 -65 11 -90 32c-17 14 -28 20 -38 20c-21 0 -29 -22 -39 -58c-3 -12 -10 -15 -17 -15s-13 3 -13 10z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E088[] =
+    "<symbol id=\"E088\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -91c0 39 22 87 65 109c-28 18 -40 51 -40 87c0 86 70 138 175 138s175 -52 175 -138c0 -36 -20 -64 -40 -87c45 -31 65 -61 65 -109c0 -101 -109 -152 -200 -152s-200 62 -200 152zM70 -91c0 -61 54 -118 130 -118c47 0 83 26 83 57c0 51 -87 98 -176 141 c-17 -20 -37 -47 -37 -80zM130 166c0 -50 84 -90 146 -119c13 13 17 41 17 58c0 52 -34 104 -93 104c-46 0 -70 -21 -70 -43z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E089[] =
+    "<symbol id=\"E089\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 101c0 75 87 142 177 142c127 0 213 -127 213 -245c0 -136 -103 -241 -226 -241c-74 0 -147 38 -147 98c0 35 28 63 63 63s63 -28 63 -63c0 -28 -17 -51 -42 -60c7 -5 22 -12 51 -12c81 0 105 99 105 199c-31 -18 -54 -22 -80 -22c-89 0 -177 27 -177 141zM118 101 c0 -60 10 -116 59 -116s59 56 59 116s-10 116 -59 116s-59 -56 -59 -116z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E08A[] =
+    "<symbol id=\"E08A\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 0c0 124 97 243 244 243c75 0 173 -41 173 -120c0 -39 -32 -71 -71 -71s-71 32 -71 71c0 37 28 68 64 71c-17 10 -47 25 -95 25c-108 0 -132 -59 -132 -219s35 -219 132 -219c108 0 158 83 158 142c0 12 8 14 12 14s12 -2 12 -14c0 -98 -89 -166 -182 -166 c-147 0 -244 119 -244 243z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E08B[] =
+    "<symbol id=\"E08B\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 0c0 115 84 226 214 241v157s0 14 15 14s15 -14 15 -14v-155c75 0 173 -41 173 -120c0 -39 -32 -71 -71 -71s-71 32 -71 71c0 37 28 68 64 71c-17 10 -47 25 -95 25v-438c108 0 158 83 158 142c0 12 8 14 12 14s12 -2 12 -14c0 -98 -89 -166 -182 -166v-155 s0 -14 -15 -14s-15 14 -15 14v157c-130 15 -214 126 -214 241zM112 0c0 -142 28 -205 102 -217v434c-83 -11 -102 -73 -102 -217z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E0A2[] =
+    "<symbol id=\"E0A2\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 0c0 75 102 135 226 135s228 -60 228 -135s-104 -135 -228 -135s-226 60 -226 135zM125 30c0 -73 69 -148 128 -148c41 0 76 39 76 88c0 73 -69 148 -128 148c-41 0 -76 -39 -76 -88z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E0A3[] =
+    "<symbol id=\"E0A3\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -37c0 92 97 172 201 172c67 0 115 -40 115 -98c0 -92 -97 -172 -201 -172c-67 0 -115 40 -115 98zM35 -80c0 -11 8 -18 22 -18c62 0 224 129 224 178c0 11 -8 18 -22 18c-62 0 -224 -129 -224 -178z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E0A4[] =
+    "<symbol id=\"E0A4\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -37c0 92 97 172 201 172c67 0 115 -40 115 -98c0 -92 -97 -172 -201 -172c-67 0 -115 40 -115 98z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E0FA[] =
+    "<symbol id=\"E0FA\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E101[] =
+    "<symbol id=\"E101\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -224c0 6 79 394 90 448c3 13 9 22 19 22h87c10 0 16 -11 16 -22c0 -6 -79 -394 -90 -448c-3 -13 -9 -22 -19 -22h-87c-10 0 -16 11 -16 22z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E220[] =
+    "<symbol id=\"E220\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E221[] =
+    "<symbol id=\"E221\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E222[] =
+    "<symbol id=\"E222\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E223[] =
+    "<symbol id=\"E223\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E224[] =
+    "<symbol id=\"E224\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E240[] =
+    "<symbol id=\"E240\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 0c0 0 0 14 15 14s15 -14 15 -14c24 -66 58 -116 119 -191s135 -166 135 -282c0 -88 -33 -184 -101 -264c-11 -13 -18 -19 -24 -19s-12 5 -12 12s4 13 22 37s76 112 76 210c0 159 -91 230 -215 273h-30v224z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E241[] =
+    "<symbol id=\"E241\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 0v224h30c156 0 245 121 245 273c0 98 -58 186 -76 210s-22 30 -22 37s6 12 12 12s13 -6 24 -19c68 -80 101 -176 101 -264c0 -143 -77 -226 -143 -291s-117 -116 -141 -182c0 0 0 -14 -15 -14s-15 14 -15 14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E260[] =
+    "<symbol id=\"E260\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-15 -153v599s0 14 15 14s15 -14 15 -14v-338c31 25 52 36 87 36c53 0 83 -36 83 -82c0 -87 -76 -150 -153 -208c-12 -9 -26 -19 -32 -19c-8 0 -15 5 -15 12zM15 58v-170c34 30 93 84 93 174c0 21 -11 35 -37 35c-24 0 -43 -20 -56 -39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E261[] =
+    "<symbol id=\"E261\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -169v492s0 14 15 14s15 -14 15 -14v-175l131 32c12 0 15 -11 15 -11v-492s0 -14 -15 -14s-15 14 -15 14v175l-131 -32c-12 0 -15 11 -15 11zM30 56v-140l116 28v140z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E262[] =
+    "<symbol id=\"E262\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 64v65c0 13 15 18 15 18l39 10v181s0 14 15 14s15 -14 15 -14v-174l68 17v181s0 14 15 14s15 -14 15 -14v-174s36 10 39 10c6 0 12 -1 15 -10v-65c0 -13 -15 -18 -15 -18l-39 -10v-159s36 10 39 10c6 0 12 -1 15 -10v-65c0 -13 -15 -18 -15 -18l-39 -10v-181 s0 -14 -15 -14s-15 14 -15 14v174l-68 -17v-181s0 -14 -15 -14s-15 14 -15 14v174s-36 -10 -39 -10c-6 0 -12 1 -15 10v65c0 13 15 18 15 18l39 10v159s-36 -10 -39 -10c-6 0 -12 1 -15 10zM84 71v-159l68 17v159z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E263[] =
+    "<symbol id=\"E263\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -55c0 6 4 10 10 10h58s45 20 45 45s-45 45 -45 45h-58c-6 0 -10 4 -10 10v70c0 6 4 10 10 10h70c6 0 10 -4 10 -10v-58s20 -45 45 -45s45 45 45 45v58c0 6 4 10 10 10h70c6 0 10 -4 10 -10v-70c0 -6 -4 -10 -10 -10h-58s-45 -20 -45 -45s45 -45 45 -45h58 c6 0 10 -4 10 -10v-70c0 -6 -4 -10 -10 -10h-70c-6 0 -10 4 -10 10v58s-20 45 -45 45s-45 -45 -45 -45v-58c0 -6 -4 -10 -10 -10h-70c-6 0 -10 4 -10 10v70z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E264[] =
+    "<symbol id=\"E264\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-15 -153v599s0 14 15 14s15 -14 15 -14v-338c31 25 52 36 87 36c22 0 39 -6 53 -16v318s0 14 15 14s15 -14 15 -14v-338c31 25 52 36 87 36c53 0 83 -36 83 -82c0 -87 -76 -150 -153 -208c-12 -9 -26 -19 -32 -19c-8 0 -15 5 -15 12v123c-29 -44 -76 -81 -105 -103 s-44 -32 -50 -32c-8 0 -15 5 -15 12zM15 58v-170c34 30 93 84 93 174c0 21 -11 35 -37 35c-24 0 -43 -20 -56 -39zM185 58v-170c34 30 93 84 93 174c0 21 -11 35 -37 35c-24 0 -43 -20 -56 -39z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E265[] =
+    "<symbol id=\"E265\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E266[] =
+    "<symbol id=\"E266\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E267[] =
+    "<symbol id=\"E267\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E268[] =
+    "<symbol id=\"E268\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E269[] =
+    "<symbol id=\"E269\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E26A[] =
+    "<symbol id=\"E26A\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 0c0 102 27 175 77 255c7 11 12 12 15 12c7 0 12 -4 12 -9c0 -3 -1 -6 -5 -15c-30 -73 -45 -145 -45 -243s15 -170 45 -243c4 -9 5 -12 5 -15c0 -5 -5 -9 -12 -9c-3 0 -8 1 -15 12c-50 80 -77 153 -77 255z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E26B[] =
+    "<symbol id=\"E26B\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -258c0 3 1 6 5 15c30 73 45 145 45 243s-15 170 -45 243c-4 9 -5 12 -5 15c0 5 5 9 12 9c3 0 8 -1 15 -12c50 -80 77 -153 77 -255s-27 -175 -77 -255c-7 -11 -12 -12 -15 -12c-7 0 -12 4 -12 9z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4A0[] =
+    "<symbol id=\"E4A0\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 19c0 9 7 17 16 19l330 89l-330 89c-9 2 -16 10 -16 19c0 10 9 19 19 19c6 0 11 -2 11 -2l401 -109s11 -3 11 -16s-11 -16 -11 -16l-401 -109s-5 -2 -11 -2c-10 0 -19 9 -19 19z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4A1[] =
+    "<symbol id=\"E4A1\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -19c0 10 9 19 19 19c6 0 11 -2 11 -2l401 -109s11 -3 11 -16s-11 -16 -11 -16l-401 -109s-5 -2 -11 -2c-10 0 -19 9 -19 19c0 9 7 17 16 19l330 89l-330 89c-9 2 -16 10 -16 19z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4A2[] =
+    "<symbol id=\"E4A2\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 50c0 28 22 50 50 50s50 -22 50 -50s-22 -50 -50 -50s-50 22 -50 50z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4A3[] =
+    "<symbol id=\"E4A3\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -50c0 28 22 50 50 50s50 -22 50 -50s-22 -50 -50 -50s-50 22 -50 50z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4A4[] =
+    "<symbol id=\"E4A4\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M14 0c0 0 -14 0 -14 15s14 15 14 15h276s14 0 14 -15s-14 -15 -14 -15h-276z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4A5[] =
+    "<symbol id=\"E4A5\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M14 -30c0 0 -14 0 -14 15s14 15 14 15h276s14 0 14 -15s-14 -15 -14 -15h-276z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4A6[] =
+    "<symbol id=\"E4A6\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 185c0 9 7 13 14 13c9 0 18 -4 27 -8s28 -10 41 -10s32 6 41 10s18 8 27 8c7 0 14 -4 14 -13c0 -6 -4 -11 -4 -11c-19 -32 -48 -97 -57 -133s-11 -41 -21 -41s-12 5 -21 41s-38 101 -57 133c0 0 -4 5 -4 11z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4A7[] =
+    "<symbol id=\"E4A7\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -185c0 6 4 11 4 11c19 32 48 97 57 133s11 41 21 41s12 -5 21 -41s38 -101 57 -133c0 0 4 -5 4 -11c0 -9 -7 -13 -14 -13c-9 0 -18 4 -27 8s-28 10 -41 10s-32 -6 -41 -10s-18 -8 -27 -8c-7 0 -14 4 -14 13z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4A8[] =
+    "<symbol id=\"E4A8\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 185c0 9 7 13 14 13c9 0 18 -4 27 -8s28 -10 41 -10s32 6 41 10s18 8 27 8c7 0 14 -4 14 -13c0 -6 -4 -11 -4 -11c-19 -32 -48 -97 -57 -133s-11 -41 -21 -41s-12 5 -21 41s-38 101 -57 133c0 0 -4 5 -4 11z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4A9[] =
+    "<symbol id=\"E4A9\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -185c0 6 4 11 4 11c19 32 48 97 57 133s11 41 21 41s12 -5 21 -41s38 -101 57 -133c0 0 4 -5 4 -11c0 -9 -7 -13 -14 -13c-9 0 -18 4 -27 8s-28 10 -41 10s-32 -6 -41 -10s-18 -8 -27 -8c-7 0 -14 4 -14 13z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4AC[] =
+    "<symbol id=\"E4AC\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 3c0 2 2 8 2 8l115 391s1 10 9 10s9 -10 9 -10l116 -391s1 -3 1 -5c0 -3 -2 -6 -10 -6h-51c-7 0 -10 11 -10 11l-79 266l-78 -266s-3 -11 -10 -11h-8c-4 0 -6 1 -6 3z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4AD[] =
+    "<symbol id=\"E4AD\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -6c0 3 2 6 10 6h51c7 0 10 -11 10 -11l79 -266l78 266s3 11 10 11h8c4 0 6 -1 6 -3s-2 -8 -2 -8l-115 -391s-1 -10 -9 -10s-9 10 -9 10l-116 391s-1 3 -1 5z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4B2[] =
+    "<symbol id=\"E4B2\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M14 165c0 0 -14 0 -14 15s14 15 14 15h276s14 0 14 -15s-14 -15 -14 -15h-276zM102 50c0 28 22 50 50 50s50 -22 50 -50s-22 -50 -50 -50s-50 22 -50 50z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4B3[] =
+    "<symbol id=\"E4B3\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M14 -195c0 0 -14 0 -14 15s14 15 14 15h276s14 0 14 -15s-14 -15 -14 -15h-276zM102 -50c0 28 22 50 50 50s50 -22 50 -50s-22 -50 -50 -50s-50 22 -50 50z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4B6[] =
+    "<symbol id=\"E4B6\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 8c0 3 3 17 3 17s45 222 49 233s15 21 33 21s33 -15 33 -38c0 -13 -95 -216 -95 -216s-10 -25 -17 -25c-2 0 -6 0 -6 8z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4B7[] =
+    "<symbol id=\"E4B7\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -8c0 8 4 8 6 8c7 0 17 -25 17 -25s95 -203 95 -216c0 -23 -15 -38 -33 -38s-29 10 -33 21s-49 233 -49 233s-3 14 -3 17z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4C0[] =
+    "<symbol id=\"E4C0\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 22c0 192 148 332 325 332s325 -140 325 -332c0 -14 -3 -22 -15 -22s-15 8 -15 22c0 127 -131 232 -295 232s-295 -105 -295 -232c0 -14 -3 -22 -15 -22s-15 8 -15 22zM279 46c0 25 21 46 46 46s46 -21 46 -46s-21 -46 -46 -46s-46 21 -46 46z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4C1[] =
+    "<symbol id=\"E4C1\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -22c0 14 3 22 15 22s15 -8 15 -22c0 -127 131 -232 295 -232s295 105 295 232c0 14 3 22 15 22s15 -8 15 -22c0 -192 -148 -332 -325 -332s-325 140 -325 332zM279 -46c0 25 21 46 46 46s46 -21 46 -46s-21 -46 -46 -46s-46 21 -46 46z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4C4[] =
+    "<symbol id=\"E4C4\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 8c0 5 3 10 3 10l274 444s4 8 14 8s14 -8 14 -8l269 -436s7 -10 7 -18c0 -4 -3 -8 -9 -8h-49c-14 0 -21 11 -21 11l-234 379l-229 -372s-10 -18 -17 -18h-13c-6 0 -9 4 -9 8zM245 46c0 25 21 46 46 46s46 -21 46 -46s-21 -46 -46 -46s-46 21 -46 46z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4C5[] =
+    "<symbol id=\"E4C5\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -8c0 4 3 8 9 8h13c7 0 17 -18 17 -18l229 -372l234 379s7 11 21 11h49c6 0 9 -4 9 -8c0 -8 -7 -18 -7 -18l-269 -436s-4 -8 -14 -8s-14 8 -14 8l-274 444s-3 5 -3 10zM245 -46c0 25 21 46 46 46s46 -21 46 -46s-21 -46 -46 -46s-46 21 -46 46z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4C6[] =
+    "<symbol id=\"E4C6\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 14v339c0 6 6 11 12 11h548c6 0 12 -5 12 -11v-339s0 -14 -15 -14s-15 14 -15 14v230h-512v-230s0 -14 -15 -14s-15 14 -15 14zM240 46c0 25 21 46 46 46s46 -21 46 -46s-21 -46 -46 -46s-46 21 -46 46z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4C7[] =
+    "<symbol id=\"E4C7\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -14c0 0 0 14 15 14s15 -14 15 -14v-230h512v230s0 14 15 14s15 -14 15 -14v-339c0 -6 -6 -11 -12 -11h-548c-6 0 -12 5 -12 11v339zM240 -46c0 25 21 46 46 46s46 -21 46 -46s-21 -46 -46 -46s-46 21 -46 46z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4C8[] =
+    "<symbol id=\"E4C8\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 14v391c0 6 6 11 12 11h548c6 0 12 -5 12 -11v-391s0 -14 -15 -14s-15 14 -15 14v280h-512v-280s0 -14 -15 -14s-15 14 -15 14zM76 14v221c0 6 6 11 12 11h396c6 0 12 -5 12 -11v-221s0 -14 -15 -14s-15 14 -15 14v132h-360v-132s0 -14 -15 -14s-15 14 -15 14zM240 46 c0 25 21 46 46 46s46 -21 46 -46s-21 -46 -46 -46s-46 21 -46 46z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4C9[] =
+    "<symbol id=\"E4C9\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -14c0 0 0 14 15 14s15 -14 15 -14v-280h512v280s0 14 15 14s15 -14 15 -14v-391c0 -6 -6 -11 -12 -11h-548c-6 0 -12 5 -12 11v391zM76 -14c0 0 0 14 15 14s15 -14 15 -14v-132h360v132s0 14 15 14s15 -14 15 -14v-221c0 -6 -6 -11 -12 -11h-396c-6 0 -12 5 -12 11 v221zM240 -46c0 25 21 46 46 46s46 -21 46 -46s-21 -46 -46 -46s-46 21 -46 46z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4CE[] =
+    "<symbol id=\"E4CE\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 199c0 35 28 63 63 63c49 0 79 -49 79 -99c0 -57 -39 -117 -103 -155c-10 -6 -17 -8 -20 -8s-5 2 -5 5s2 5 7 8c34 23 52 56 52 87c0 14 -3 24 -10 37c-35 0 -63 27 -63 62z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4E5[] =
+    "<symbol id=\"E4E5\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -188c0 58 52 87 110 87c14 0 48 -6 48 -6s-145 124 -145 135c0 4 0 6 7 13c46 50 61 117 61 175c0 50 -15 95 -47 127c-4 4 -6 8 -6 12c0 5 4 10 12 10c12 0 176 -110 176 -155c0 -19 -12 -52 -29 -85s-32 -71 -32 -98c0 -58 20 -115 43 -135s24 -24 24 -29 c0 -7 -5 -13 -13 -13c-5 0 -13 2 -16 3s-11 2 -17 2c-18 0 -32 -5 -46 -14c-31 -21 -45 -52 -45 -85s14 -67 43 -96c6 -6 8 -9 8 -14s-5 -9 -10 -9s-8 1 -14 5c-69 46 -112 106 -112 170z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4E6[] =
+    "<symbol id=\"E4E6\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 124c0 42 34 76 76 76s76 -34 76 -76c0 -19 -7 -37 -19 -50c43 12 75 42 93 86c3 8 9 11 16 11s14 -6 14 -15c0 0 0 -3 -1 -6l-107 -363c-3 -8 -9 -11 -16 -11s-14 6 -14 15c0 0 0 3 1 6l82 278c-31 -20 -62 -36 -97 -36c-56 0 -104 34 -104 85z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4E7[] =
+    "<symbol id=\"E4E7\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -120c0 42 34 76 76 76s76 -34 76 -76c0 -19 -7 -37 -19 -50c43 12 75 42 93 86l47 159c-31 -20 -62 -36 -97 -36c-56 0 -104 34 -104 85c0 42 34 76 76 76s76 -34 76 -76c0 -19 -7 -37 -19 -50c43 12 75 42 93 86c3 8 9 11 16 11s14 -6 14 -15c0 0 0 -3 -1 -6 l-179 -607c-3 -8 -9 -11 -16 -11s-14 6 -14 15c0 0 0 3 1 6l82 278c-31 -20 -62 -36 -97 -36c-56 0 -104 34 -104 85z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4E8[] =
+    "<symbol id=\"E4E8\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -120c0 42 34 76 76 76s76 -34 76 -76c0 -19 -7 -37 -19 -50c43 12 75 42 93 86l47 159c-31 -20 -62 -36 -97 -36c-56 0 -104 34 -104 85c0 42 34 76 76 76s76 -34 76 -76c0 -19 -7 -37 -19 -50c43 12 75 42 93 86l47 159c-31 -20 -62 -36 -97 -36 c-56 0 -104 34 -104 85c0 42 34 76 76 76s76 -34 76 -76c0 -19 -7 -37 -19 -50c43 12 75 42 93 86c3 8 9 11 16 11s14 -6 14 -15c0 0 0 -3 -1 -6l-251 -851c-3 -8 -9 -11 -16 -11s-14 6 -14 15c0 0 0 3 1 6l82 278c-31 -20 -62 -36 -97 -36c-56 0 -104 34 -104 85z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4E9[] =
+    "<symbol id=\"E4E9\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -364c0 42 34 76 76 76s76 -34 76 -76c0 -19 -7 -37 -19 -50c43 12 75 42 93 86l47 159c-31 -20 -62 -36 -97 -36c-56 0 -104 34 -104 85c0 42 34 76 76 76s76 -34 76 -76c0 -19 -7 -37 -19 -50c43 12 75 42 93 86l47 159c-31 -20 -62 -36 -97 -36 c-56 0 -104 34 -104 85c0 42 34 76 76 76s76 -34 76 -76c0 -19 -7 -37 -19 -50c43 12 75 42 93 86l47 159c-31 -20 -62 -36 -97 -36c-56 0 -104 34 -104 85c0 42 34 76 76 76s76 -34 76 -76c0 -19 -7 -37 -19 -50c43 12 75 42 93 86c3 8 9 11 16 11s14 -6 14 -15 c0 0 0 -3 -1 -6l-323 -1095c-3 -8 -9 -11 -16 -11s-14 6 -14 15c0 0 0 3 1 6l82 278c-31 -20 -62 -36 -97 -36c-56 0 -104 34 -104 85z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E4EA[] =
+    "<symbol id=\"E4EA\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -364c0 42 34 76 76 76s76 -34 76 -76c0 -19 -7 -37 -19 -50c43 12 75 42 93 86l47 159c-31 -20 -62 -36 -97 -36c-56 0 -104 34 -104 85c0 42 34 76 76 76s76 -34 76 -76c0 -19 -7 -37 -19 -50c43 12 75 42 93 86l47 159c-31 -20 -62 -36 -97 -36 c-56 0 -104 34 -104 85c0 42 34 76 76 76s76 -34 76 -76c0 -19 -7 -37 -19 -50c43 12 75 42 93 86l47 159c-31 -20 -62 -36 -97 -36c-56 0 -104 34 -104 85c0 42 34 76 76 76s76 -34 76 -76c0 -19 -7 -37 -19 -50c43 12 75 42 93 86l47 159c-31 -20 -62 -36 -97 -36 c-56 0 -104 34 -104 85c0 42 34 76 76 76s76 -34 76 -76c0 -19 -7 -37 -19 -50c43 12 75 42 93 86c3 8 9 11 16 11s14 -6 14 -15c0 0 0 -3 -1 -6l-395 -1339c-3 -8 -9 -11 -16 -11s-14 6 -14 15c0 0 0 3 1 6l82 278c-31 -20 -62 -36 -97 -36c-56 0 -104 34 -104 85z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E500[] =
+    "<symbol id=\"E500\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E501[] =
+    "<symbol id=\"E501\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E502[] =
+    "<symbol id=\"E502\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E510[] =
+    "<symbol id=\"E510\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 133c0 53 35 104 86 128c-19 14 -27 36 -27 62c0 105 92 163 202 163c94 0 153 -42 153 -113c0 -53 -28 -84 -58 -112c32 -25 48 -51 48 -85c0 -120 -134 -176 -229 -176c-84 0 -175 53 -175 133zM70 134c0 -54 43 -100 111 -100c49 0 94 27 94 65 c0 48 -75 92 -152 133c-24 -23 -53 -53 -53 -98zM176 401c0 -46 72 -84 126 -111c20 17 29 50 29 79c0 44 -25 83 -76 83c-49 0 -79 -22 -79 -51z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E514[] =
+    "<symbol id=\"E514\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 18c0 18 21 18 28 18c19 0 45 23 51 58l50 285l-87 -107c-5 -7 -9 -10 -15 -10c-8 0 -15 6 -15 14c0 4 3 9 3 9l132 192s7 9 11 9h103c5 0 5 -4 5 -8l-67 -384c-1 -5 -2 -10 -2 -14c0 -27 10 -44 26 -44c7 0 28 0 28 -18s-21 -18 -28 -18h-195c-7 0 -28 0 -28 18z M264 88c0 45 36 78 75 78c31 0 53 -22 53 -52c0 -32 -22 -57 -48 -68c5 -5 18 -15 42 -15c55 0 111 74 111 158c0 56 -34 90 -79 90c-40 0 -55 -7 -73 -18s-20 -11 -27 -11c-6 0 -8 4 -8 9c0 3 0 6 1 9c0 2 11 50 21 92s24 102 24 104c2 14 10 22 18 22c12 0 24 -3 43 -9 s50 -12 86 -12s78 6 99 12s39 9 51 9c5 0 8 -4 8 -10c0 -10 -4 -27 -27 -50c-22 -22 -80 -55 -148 -55c-42 0 -86 9 -119 20l-24 -99c44 26 80 27 112 27c86 0 160 -52 160 -133c0 -112 -112 -186 -203 -186c-79 0 -148 28 -148 88z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E517[] =
+    "<symbol id=\"E517\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 26c0 82 103 150 158 184c72 45 139 87 139 180c0 41 -19 65 -64 65c-33 0 -49 -9 -57 -14c16 -9 27 -26 27 -46c0 -42 -38 -74 -75 -74c-31 0 -53 22 -53 52c0 80 100 113 184 113c83 0 156 -33 156 -107c0 -109 -122 -171 -191 -193c-68 -21 -120 -50 -158 -88 c38 26 84 46 127 46c31 0 52 -6 73 -18s38 -20 54 -20c20 0 35 10 42 16s16 13 22 13c5 0 10 -3 10 -9c0 -52 -94 -126 -140 -126c-32 0 -53 6 -75 22s-38 26 -68 26s-41 -4 -60 -18s-26 -18 -34 -18c-7 0 -17 4 -17 14zM377 26c0 82 103 150 158 184c72 45 139 87 139 180 c0 41 -19 65 -64 65c-33 0 -49 -9 -57 -14c16 -9 27 -26 27 -46c0 -42 -38 -74 -75 -74c-31 0 -53 22 -53 52c0 80 100 113 184 113c83 0 156 -33 156 -107c0 -109 -122 -171 -191 -193c-68 -21 -120 -50 -158 -88c38 26 84 46 127 46c31 0 52 -6 73 -18s38 -20 54 -20 c20 0 35 10 42 16s16 13 22 13c5 0 10 -3 10 -9c0 -52 -94 -126 -140 -126c-32 0 -53 6 -75 22s-38 26 -68 26s-41 -4 -60 -18s-26 -18 -34 -18c-7 0 -17 4 -17 14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E520[] =
+    "<symbol id=\"E520\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-72 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47 c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM139 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E521[] =
+    "<symbol id=\"E521\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-41 161c0 5 2 15 13 38s48 73 94 73s60 -42 60 -42s29 42 60 42c46 0 60 -42 60 -42s29 42 60 42c38 0 64 -30 64 -66c0 -15 -23 -80 -23 -80s-25 -74 -25 -93c0 -8 2 -15 10 -15c25 0 54 35 62 58s12 26 17 26s8 -3 8 -8c0 -45 -56 -114 -110 -114c-30 0 -58 26 -58 63 c0 19 25 93 25 93s23 65 23 80c0 9 -7 20 -16 20c-21 0 -34 -48 -34 -48l-58 -184c0 -3 -14 -5 -32 -5s-39 2 -39 7c0 0 59 183 59 210c0 9 -7 20 -16 20c-21 0 -34 -48 -34 -48l-58 -184c0 -3 -14 -5 -32 -5s-39 2 -39 7c0 0 59 183 59 210c0 9 -7 20 -16 20 c-30 0 -54 -41 -61 -62s-10 -21 -15 -21s-8 3 -8 8z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E522[] =
+    "<symbol id=\"E522\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-144 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19 s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E523[] =
+    "<symbol id=\"E523\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-17 218c0 5 3 12 16 25s33 27 71 27s51 -30 51 -30s33 32 81 32c44 0 91 -25 91 -60c0 -19 -16 -35 -35 -35s-35 16 -35 35c0 7 2 13 5 18c-1 1 -11 7 -26 7c-38 0 -59 -19 -72 -42s-59 -191 -59 -191c0 -3 -14 -5 -32 -5s-39 2 -39 7c0 0 60 170 60 212 c0 13 -7 21 -19 21c-15 0 -25 -5 -33 -15s-12 -14 -17 -14s-8 3 -8 8z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E524[] =
+    "<symbol id=\"E524\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 40c0 19 16 35 35 35s35 -16 35 -35c0 -7 -2 -14 -6 -20c2 -2 12 -9 33 -9c25 0 41 19 41 36c0 19 -20 33 -40 44c-42 24 -66 61 -66 95c0 52 54 86 103 86c44 0 91 -25 91 -60c0 -19 -16 -35 -35 -35s-35 16 -35 35c0 7 2 13 5 18c-1 1 -11 7 -26 7 c-26 0 -36 -19 -36 -32c0 -24 17 -34 38 -46c38 -21 69 -56 69 -93c0 -56 -61 -88 -109 -88c-38 0 -97 24 -97 62z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E525[] =
+    "<symbol id=\"E525\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-24 21c0 7 8 14 30 30c5 4 173 146 173 146h-117c-15 0 -22 -6 -35 -19c-4 -4 -8 -5 -12 -5s-15 0 -15 8l36 82s5 9 9 9h237c7 0 8 -3 8 -8c0 -3 -1 -8 -4 -11l-192 -161s7 2 12 2c18 0 33 -8 45 -17c15 -13 27 -18 49 -18c-16 3 -28 17 -28 34c0 19 16 35 35 35 s35 -16 35 -35c0 -49 -58 -93 -109 -93c-20 0 -33 6 -45 13c-15 9 -32 14 -48 14c-13 0 -26 -2 -33 -9s-11 -10 -18 -10s-13 6 -13 13z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E526[] =
+    "<symbol id=\"E526\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-41 161c0 5 2 15 13 38s48 73 94 73s60 -42 60 -42s29 42 60 42c38 0 64 -30 64 -66c0 -15 -23 -80 -23 -80s-25 -74 -25 -93c0 -8 2 -15 10 -15c25 0 54 35 62 58s12 26 17 26s8 -3 8 -8c0 -45 -56 -114 -110 -114c-30 0 -58 26 -58 63c0 19 25 93 25 93s23 65 23 80 c0 9 -7 20 -16 20c-21 0 -34 -48 -34 -48l-58 -184c0 -3 -14 -5 -32 -5s-39 2 -39 7c0 0 59 183 59 210c0 9 -7 20 -16 20c-30 0 -54 -41 -61 -62s-10 -21 -15 -21s-8 3 -8 8z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E527[] =
+    "<symbol id=\"E527\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-72 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47 c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM139 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35zM274 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338 s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10 c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM485 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35zM620 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59 s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13z M831 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35zM966 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47 s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM1177 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44 c-15 0 -36 -1 -61 -35zM1312 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192 c-37 0 -60 17 -71 47"
+    "c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM1523 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35zM1658 -167c0 8 7 13 31 13 c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5 c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM1869 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E528[] =
+    "<symbol id=\"E528\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-72 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47 c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM139 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35zM274 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338 s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10 c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM485 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35zM620 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59 s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13z M831 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35zM966 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47 s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM1177 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44 c-15 0 -36 -1 -61 -35zM1312 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192 c-37 0 -60 17 -71 47"
+    "c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM1523 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E529[] =
+    "<symbol id=\"E529\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-72 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47 c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM139 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35zM274 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338 s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10 c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM485 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35zM620 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59 s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13z M831 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35zM966 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47 s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM1177 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44 c-15 0 -36 -1 -61 -35z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E52A[] =
+    "<symbol id=\"E52A\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-72 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47 c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM139 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35zM274 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338 s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10 c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM485 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35zM620 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59 s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13z M831 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E52B[] =
+    "<symbol id=\"E52B\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-72 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47 c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM139 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35zM274 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338 s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10 c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM485 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E52C[] =
+    "<symbol id=\"E52C\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-41 161c0 5 2 15 13 38s48 73 94 73s60 -42 60 -42s29 42 60 42c46 0 60 -42 60 -42s29 42 60 42c38 0 64 -30 64 -66c0 -15 -23 -80 -23 -80s-25 -74 -25 -93c0 -8 2 -15 10 -15c25 0 54 35 62 58s12 26 17 26s8 -3 8 -8c0 -45 -56 -114 -110 -114c-30 0 -58 26 -58 63 c0 19 25 93 25 93s23 65 23 80c0 9 -7 20 -16 20c-21 0 -34 -48 -34 -48l-58 -184c0 -3 -14 -5 -32 -5s-39 2 -39 7c0 0 59 183 59 210c0 9 -7 20 -16 20c-21 0 -34 -48 -34 -48l-58 -184c0 -3 -14 -5 -32 -5s-39 2 -39 7c0 0 59 183 59 210c0 9 -7 20 -16 20 c-30 0 -54 -41 -61 -62s-10 -21 -15 -21s-8 3 -8 8zM322 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96 c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM533 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E52D[] =
+    "<symbol id=\"E52D\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-41 161c0 5 2 15 13 38s48 73 94 73s60 -42 60 -42s29 42 60 42c46 0 60 -42 60 -42s29 42 60 42c38 0 64 -30 64 -66c0 -15 -23 -80 -23 -80s-25 -74 -25 -93c0 -8 2 -15 10 -15c25 0 54 35 62 58s12 26 17 26s8 -3 8 -8c0 -45 -56 -114 -110 -114c-30 0 -58 26 -58 63 c0 19 25 93 25 93s23 65 23 80c0 9 -7 20 -16 20c-21 0 -34 -48 -34 -48l-58 -184c0 -3 -14 -5 -32 -5s-39 2 -39 7c0 0 59 183 59 210c0 9 -7 20 -16 20c-21 0 -34 -48 -34 -48l-58 -184c0 -3 -14 -5 -32 -5s-39 2 -39 7c0 0 59 183 59 210c0 9 -7 20 -16 20 c-30 0 -54 -41 -61 -62s-10 -21 -15 -21s-8 3 -8 8zM250 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50 c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E52E[] =
+    "<symbol id=\"E52E\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-72 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47 c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM139 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35zM202 -77c0 28 22 50 50 50s50 -22 50 -50 c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69 c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E52F[] =
+    "<symbol id=\"E52F\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-144 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19 s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM133 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50 s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E530[] =
+    "<symbol id=\"E530\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-144 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19 s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM133 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50 s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM410 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69 c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E531[] =
+    "<symbol id=\"E531\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-144 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19 s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM133 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50 s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM410 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69 c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM687 -77c0 28 22 50 50 50s50 -22 50 -50 c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69 c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E532[] =
+    "<symbol id=\"E532\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-144 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19 s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM133 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50 s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM410 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69 c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM687 -77c0 28 22 50 50 50s50 -22 50 -50 c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69 c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM964 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50 c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E533[] =
+    "<symbol id=\"E533\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-144 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19 s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM133 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50 s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM410 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69 c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM687 -77c0 28 22 50 50 50s50 -22 50 -50 c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69 c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM964 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50 c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM1241 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69 c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E534[] =
+    "<symbol id=\"E534\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-144 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19 s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM205 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43 c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM416 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44 c-15 0 -36 -1 -61 -35z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E535[] =
+    "<symbol id=\"E535\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-144 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19 s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM253 21c0 7 8 14 30 30c5 4 173 146 173 146h-117c-15 0 -22 -6 -35 -19c-4 -4 -8 -5 -12 -5s-15 0 -15 8l36 82s5 9 9 9h237c7 0 8 -3 8 -8c0 -3 -1 -8 -4 -11l-192 -161s7 2 12 2 c18 0 33 -8 45 -17c15 -13 27 -18 49 -18c-16 3 -28 17 -28 34c0 19 16 35 35 35s35 -16 35 -35c0 -49 -58 -93 -109 -93c-20 0 -33 6 -45 13c-15 9 -32 14 -48 14c-13 0 -26 -2 -33 -9s-11 -10 -18 -10s-13 6 -13 13z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E536[] =
+    "<symbol id=\"E536\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 40c0 19 16 35 35 35s35 -16 35 -35c0 -7 -2 -14 -6 -20c2 -2 12 -9 33 -9c25 0 41 19 41 36c0 19 -20 33 -40 44c-42 24 -66 61 -66 95c0 52 54 86 103 86c44 0 91 -25 91 -60c0 -19 -16 -35 -35 -35s-35 16 -35 35c0 7 2 13 5 18c-1 1 -11 7 -26 7 c-26 0 -36 -19 -36 -32c0 -24 17 -34 38 -46c38 -21 69 -56 69 -93c0 -56 -61 -88 -109 -88c-38 0 -97 24 -97 62zM82 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178 c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E537[] =
+    "<symbol id=\"E537\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 40c0 19 16 35 35 35s35 -16 35 -35c0 -7 -2 -14 -6 -20c2 -2 12 -9 33 -9c25 0 41 19 41 36c0 19 -20 33 -40 44c-42 24 -66 61 -66 95c0 52 54 86 103 86c44 0 91 -25 91 -60c0 -19 -16 -35 -35 -35s-35 16 -35 35c0 7 2 13 5 18c-1 1 -11 7 -26 7 c-26 0 -36 -19 -36 -32c0 -24 17 -34 38 -46c38 -21 69 -56 69 -93c0 -56 -61 -88 -109 -88c-38 0 -97 24 -97 62zM82 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178 c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM431 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23 c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13 s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM642 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E538[] =
+    "<symbol id=\"E538\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 40c0 19 16 35 35 35s35 -16 35 -35c0 -7 -2 -14 -6 -20c2 -2 12 -9 33 -9c25 0 41 19 41 36c0 19 -20 33 -40 44c-42 24 -66 61 -66 95c0 52 54 86 103 86c44 0 91 -25 91 -60c0 -19 -16 -35 -35 -35s-35 16 -35 35c0 7 2 13 5 18c-1 1 -11 7 -26 7 c-26 0 -36 -19 -36 -32c0 -24 17 -34 38 -46c38 -21 69 -56 69 -93c0 -56 -61 -88 -109 -88c-38 0 -97 24 -97 62zM82 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178 c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM431 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23 c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13 s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM642 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35zM777 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8 s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM988 61c0 -21 15 -34 33 -34 c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E539[] =
+    "<symbol id=\"E539\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 40c0 19 16 35 35 35s35 -16 35 -35c0 -7 -2 -14 -6 -20c2 -2 12 -9 33 -9c25 0 41 19 41 36c0 19 -20 33 -40 44c-42 24 -66 61 -66 95c0 52 54 86 103 86c44 0 91 -25 91 -60c0 -19 -16 -35 -35 -35s-35 16 -35 35c0 7 2 13 5 18c-1 1 -11 7 -26 7 c-26 0 -36 -19 -36 -32c0 -24 17 -34 38 -46c38 -21 69 -56 69 -93c0 -56 -61 -88 -109 -88c-38 0 -97 24 -97 62zM82 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178 c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM479 21c0 7 8 14 30 30c5 4 173 146 173 146h-117c-15 0 -22 -6 -35 -19 c-4 -4 -8 -5 -12 -5s-15 0 -15 8l36 82s5 9 9 9h237c7 0 8 -3 8 -8c0 -3 -1 -8 -4 -11l-192 -161s7 2 12 2c18 0 33 -8 45 -17c15 -13 27 -18 49 -18c-16 3 -28 17 -28 34c0 19 16 35 35 35s35 -16 35 -35c0 -49 -58 -93 -109 -93c-20 0 -33 6 -45 13c-15 9 -32 14 -48 14 c-13 0 -26 -2 -33 -9s-11 -10 -18 -10s-13 6 -13 13z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E53A[] =
+    "<symbol id=\"E53A\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 40c0 19 16 35 35 35s35 -16 35 -35c0 -7 -2 -14 -6 -20c2 -2 12 -9 33 -9c25 0 41 19 41 36c0 19 -20 33 -40 44c-42 24 -66 61 -66 95c0 52 54 86 103 86c44 0 91 -25 91 -60c0 -19 -16 -35 -35 -35s-35 16 -35 35c0 7 2 13 5 18c-1 1 -11 7 -26 7 c-26 0 -36 -19 -36 -32c0 -24 17 -34 38 -46c38 -21 69 -56 69 -93c0 -56 -61 -88 -109 -88c-38 0 -97 24 -97 62zM82 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178 c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM479 21c0 7 8 14 30 30c5 4 173 146 173 146h-117c-15 0 -22 -6 -35 -19 c-4 -4 -8 -5 -12 -5s-15 0 -15 8l36 82s5 9 9 9h237c7 0 8 -3 8 -8c0 -3 -1 -8 -4 -11l-192 -161s7 2 12 2c18 0 33 -8 45 -17c15 -13 27 -18 49 -18c-16 3 -28 17 -28 34c0 19 16 35 35 35s35 -16 35 -35c0 -49 -58 -93 -109 -93c-20 0 -33 6 -45 13c-15 9 -32 14 -48 14 c-13 0 -26 -2 -33 -9s-11 -10 -18 -10s-13 6 -13 13zM721 -167c0 8 7 13 31 13c22 0 28 19 28 19l102 338s5 17 5 23c0 7 -3 11 -11 11c-22 0 -47 -37 -57 -59s-13 -24 -18 -24s-8 3 -8 8s1 10 13 35s41 75 99 75s66 -47 66 -47s33 43 88 43c43 0 80 -40 80 -96 c0 -104 -63 -192 -146 -192c-37 0 -60 17 -71 47c0 -1 -50 -166 -50 -166s-1 -3 -1 -5c0 -4 5 -10 23 -10c24 0 31 -5 31 -13s-7 -13 -31 -13h-142c-24 0 -31 5 -31 13zM932 61c0 -21 15 -34 33 -34c71 0 98 90 98 151c0 23 -12 44 -32 44c-15 0 -36 -1 -61 -35z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E53B[] =
+    "<symbol id=\"E53B\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 40c0 19 16 35 35 35s35 -16 35 -35c0 -7 -2 -14 -6 -20c2 -2 12 -9 33 -9c25 0 41 19 41 36c0 19 -20 33 -40 44c-42 24 -66 61 -66 95c0 52 54 86 103 86c44 0 91 -25 91 -60c0 -19 -16 -35 -35 -35s-35 16 -35 35c0 7 2 13 5 18c-1 1 -11 7 -26 7 c-26 0 -36 -19 -36 -32c0 -24 17 -34 38 -46c38 -21 69 -56 69 -93c0 -56 -61 -88 -109 -88c-38 0 -97 24 -97 62zM82 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178 c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM359 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38 c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381 c-38 0 -72 28 -72 70zM756 21c0 7 8 14 30 30c5 4 173 146 173 146h-117c-15 0 -22 -6 -35 -19c-4 -4 -8 -5 -12 -5s-15 0 -15 8l36 82s5 9 9 9h237c7 0 8 -3 8 -8c0 -3 -1 -8 -4 -11l-192 -161s7 2 12 2c18 0 33 -8 45 -17c15 -13 27 -18 49 -18c-16 3 -28 17 -28 34 c0 19 16 35 35 35s35 -16 35 -35c0 -49 -58 -93 -109 -93c-20 0 -33 6 -45 13c-15 9 -32 14 -48 14c-13 0 -26 -2 -33 -9s-11 -10 -18 -10s-13 6 -13 13z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E53C[] =
+    "<symbol id=\"E53C\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-17 218c0 5 3 12 16 25s33 27 71 27s51 -30 51 -30s33 32 81 32c44 0 91 -25 91 -60c0 -19 -16 -35 -35 -35s-35 16 -35 35c0 7 2 13 5 18c-1 1 -11 7 -26 7c-38 0 -59 -19 -72 -42s-59 -191 -59 -191c0 -3 -14 -5 -32 -5s-39 2 -39 7c0 0 60 170 60 212 c0 13 -7 21 -19 21c-15 0 -25 -5 -33 -15s-12 -14 -17 -14s-8 3 -8 8zM149 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50 s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E53D[] =
+    "<symbol id=\"E53D\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M-17 218c0 5 3 12 16 25s33 27 71 27s51 -30 51 -30s33 32 81 32c44 0 91 -25 91 -60c0 -19 -16 -35 -35 -35s-35 16 -35 35c0 7 2 13 5 18c-1 1 -11 7 -26 7c-38 0 -59 -19 -72 -42s-59 -191 -59 -191c0 -3 -14 -5 -32 -5s-39 2 -39 7c0 0 60 170 60 212 c0 13 -7 21 -19 21c-15 0 -25 -5 -33 -15s-12 -14 -17 -14s-8 3 -8 8zM149 -77c0 28 22 50 50 50s50 -22 50 -50c0 -15 -7 -29 -17 -38c77 11 112 197 140 349h-59s-20 0 -20 19s20 19 20 19h69c36 97 108 178 196 178c47 0 101 -22 101 -67c0 -28 -22 -50 -50 -50 s-50 22 -50 50c0 13 5 25 13 34c-48 0 -86 -65 -101 -145h59s20 0 20 -19s-20 -19 -20 -19h-69c-27 -137 -88 -381 -260 -381c-38 0 -72 28 -72 70zM546 21c0 7 8 14 30 30c5 4 173 146 173 146h-117c-15 0 -22 -6 -35 -19c-4 -4 -8 -5 -12 -5s-15 0 -15 8l36 82s5 9 9 9 h237c7 0 8 -3 8 -8c0 -3 -1 -8 -4 -11l-192 -161s7 2 12 2c18 0 33 -8 45 -17c15 -13 27 -18 49 -18c-16 3 -28 17 -28 34c0 19 16 35 35 35s35 -16 35 -35c0 -49 -58 -93 -109 -93c-20 0 -33 6 -45 13c-15 9 -32 14 -48 14c-13 0 -26 -2 -33 -9s-11 -10 -18 -10 s-13 6 -13 13z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E566[] =
+    "<symbol id=\"E566\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 222c0 16 24 19 36 19c20 0 85 2 85 2l21 68c14 45 87 56 90 56s6 -2 6 -5c0 -7 -34 -111 -34 -111s99 19 131 19c24 0 24 -30 24 -30s33 32 81 32c44 0 91 -25 91 -60c0 -19 -16 -35 -35 -35s-35 16 -35 35c0 7 2 13 5 18c-1 1 -11 7 -26 7c-38 0 -59 -19 -72 -42 s-59 -191 -59 -191c0 -3 -14 -5 -32 -5s-39 2 -39 7l9 33s-70 -48 -125 -48c-37 0 -49 27 -49 62c0 54 39 163 39 163s-43 -6 -82 -6c-15 0 -30 0 -30 12zM149 54c0 -15 5 -26 16 -26c51 0 95 55 95 55s42 118 42 140c0 6 -7 10 -15 10c-31 0 -91 -9 -91 -9 s-47 -133 -47 -170z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E567[] =
+    "<symbol id=\"E567\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 0c0 74 56 141 125 141c88 0 165 -56 217 -108s117 -99 186 -99c44 0 61 33 61 66s-28 59 -61 59c-12 0 -24 -4 -38 -11c-8 -4 -17 -6 -25 -6c-24 0 -44 21 -44 45c0 37 36 54 74 54c70 0 125 -67 125 -141s-56 -141 -125 -141c-88 0 -165 56 -217 108s-117 99 -186 99 c-44 0 -61 -33 -61 -66s28 -59 61 -59c12 0 24 4 38 11c8 4 17 6 25 6c24 0 44 -21 44 -45c0 -37 -36 -54 -74 -54c-70 0 -125 67 -125 141z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E568[] =
+    "<symbol id=\"E568\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 0c0 74 55 141 125 141c38 0 74 -17 74 -54c0 -24 -20 -45 -44 -45c-8 0 -17 2 -25 6c-14 7 -26 11 -38 11c-33 0 -61 -26 -61 -59s17 -66 61 -66c69 0 134 47 186 99s129 108 217 108c69 0 125 -67 125 -141s-55 -141 -125 -141c-38 0 -74 17 -74 54c0 24 20 45 44 45 c8 0 17 -2 25 -6c14 -7 26 -11 38 -11c33 0 61 26 61 59s-17 66 -61 66c-69 0 -134 -47 -186 -99s-129 -108 -217 -108c-69 0 -125 67 -125 141z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E56A[] =
+    "<symbol id=\"E56A\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E56B[] =
+    "<symbol id=\"E56B\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E56C[] =
+    "<symbol id=\"E56C\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -50c0 6 2 9 7 15l135 159s3 4 8 4s8 -4 8 -4l125 -124l105 124s3 4 8 4s8 -4 8 -4l125 -124l45 53c5 6 10 11 17 11s15 -5 15 -14c0 -6 -2 -9 -7 -15l-135 -159s-3 -4 -8 -4s-8 4 -8 4l-125 124l-105 -124s-3 -4 -8 -4s-8 4 -8 4l-125 124l-45 -53 c-5 -6 -10 -11 -17 -11s-15 5 -15 14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E56D[] =
+    "<symbol id=\"E56D\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -50c0 6 2 9 7 15l135 159s3 4 8 4s8 -4 8 -4l125 -124l5 6v180s0 14 15 14s15 -14 15 -14v-145l70 83s3 4 8 4s8 -4 8 -4l125 -124l45 53c5 6 10 11 17 11s15 -5 15 -14c0 -6 -2 -9 -7 -15l-135 -159s-3 -4 -8 -4s-8 4 -8 4l-125 124l-5 -6v-180s0 -14 -15 -14 s-15 14 -15 14v145l-70 -83s-3 -4 -8 -4s-8 4 -8 4l-125 124l-45 -53c-5 -6 -10 -11 -17 -11s-15 5 -15 14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E56E[] =
+    "<symbol id=\"E56E\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 -50c0 6 2 9 7 15l135 159s3 4 8 4s8 -4 8 -4l125 -124l105 124s3 4 8 4s8 -4 8 -4l125 -124l105 124s3 4 8 4s8 -4 8 -4l125 -124l45 53c5 6 10 11 17 11s15 -5 15 -14c0 -6 -2 -9 -7 -15l-135 -159s-3 -4 -8 -4s-8 4 -8 4l-125 124l-105 -124s-3 -4 -8 -4s-8 4 -8 4 l-125 124l-105 -124s-3 -4 -8 -4s-8 4 -8 4l-125 124l-45 -53c-5 -6 -10 -11 -17 -11s-15 5 -15 14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E610[] =
+    "<symbol id=\"E610\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 14v327c0 6 6 11 12 11h312c6 0 12 -5 12 -11v-327s0 -14 -15 -14s-15 14 -15 14v176h-276v-176s0 -14 -15 -14s-15 14 -15 14z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E611[] =
+    "<symbol id=\"E611\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 11v327s0 14 15 14s15 -14 15 -14v-176h276v176s0 14 15 14s15 -14 15 -14v-327c0 -6 -6 -11 -12 -11h-312c-6 0 -12 5 -12 11z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E612[] =
+    "<symbol id=\"E612\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 406c0 3 2 6 10 6h51c7 0 10 -11 10 -11l79 -266l78 266s3 11 10 11h8c4 0 6 -1 6 -3s-2 -8 -2 -8l-115 -391s-1 -10 -9 -10s-9 10 -9 10l-116 391s-1 3 -1 5z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E613[] =
+    "<symbol id=\"E613\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 6c0 2 1 5 1 5l116 391s1 10 9 10s9 -10 9 -10l115 -391s2 -6 2 -8s-2 -3 -6 -3h-8c-7 0 -10 11 -10 11l-78 266l-79 -266s-3 -11 -10 -11h-51c-8 0 -10 3 -10 6z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E650[] =
+    "<symbol id=\"E650\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 307c0 108 113 193 231 193c98 0 173 -66 173 -141c0 -47 -33 -73 -68 -73c-33 0 -69 28 -69 73c0 8 3 13 10 13c6 0 10 -6 15 -16s15 -13 27 -13c23 0 42 15 42 39c0 55 -59 95 -122 95c-21 -38 -40 -74 -40 -98c0 -23 12 -41 34 -63s34 -38 34 -68 c0 -48 -31 -98 -60 -137c0 0 18 1 28 1c38 0 78 -13 107 -42l29 24s-3 18 -3 36c0 61 44 145 108 145c34 0 56 -27 56 -57c0 -16 -2 -31 -18 -44l-83 -68s10 -53 56 -53c25 0 52 9 70 35c-3 11 -4 22 -4 34c0 64 40 127 108 161c-48 61 -119 103 -202 123c0 0 -17 3 -17 14 c0 8 4 12 13 12c4 0 40 -4 109 -29s218 -119 218 -264c0 -75 -46 -139 -118 -139c-43 0 -77 22 -96 58c-26 -33 -71 -58 -107 -58c-40 0 -69 25 -83 63l-45 -37c-22 -18 -39 -26 -47 -26c-7 0 -8 0 -17 21s-37 55 -71 55c-8 0 -19 -2 -19 -2c-22 -29 -57 -74 -70 -74 c-7 0 -12 5 -12 12c0 36 44 73 74 88c36 46 51 77 51 101c0 15 -4 22 -28 43s-39 49 -39 85s23 89 56 148c-85 0 -170 -72 -170 -146c0 -26 8 -39 29 -39s43 19 43 46c0 10 4 14 11 14s12 -4 12 -19c0 -52 -27 -101 -78 -101c-39 0 -58 34 -58 75zM420 160 c0 -10 2 -24 2 -24l50 41c14 11 16 14 16 24c0 17 -12 35 -32 35c-27 0 -36 -43 -36 -76zM606 122c0 -43 23 -98 53 -98s55 69 55 115s-12 83 -35 118c-46 -23 -73 -86 -73 -135z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E655[] =
+    "<symbol id=\"E655\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <path transform=\"scale(1,-1)\"\n"
+    "         d=\"M0 283c0 30 23 46 46 46c12 0 25 -6 35 -16c10 -12 22 -19 31 -19c18 0 33 15 33 31c0 24 -17 33 -44 33c-34 0 -53 18 -53 46c0 26 21 46 47 46c30 0 45 -24 45 -51s9 -44 33 -44c16 0 31 15 31 33c0 9 -7 21 -19 31c-10 10 -16 23 -16 35c0 23 16 46 46 46 s46 -23 46 -46c0 -12 -6 -25 -16 -35c-12 -10 -19 -22 -19 -31c0 -18 15 -33 31 -33c24 0 33 17 33 44s15 51 45 51c26 0 47 -20 47 -46c0 -28 -19 -46 -53 -46c-27 0 -44 -9 -44 -33c0 -16 15 -31 33 -31c9 0 21 7 31 19c10 10 23 16 35 16c23 0 46 -16 46 -46 s-23 -46 -46 -46c-12 0 -25 6 -35 16c-10 12 -22 19 -31 19c-18 0 -33 -15 -33 -31c0 -24 17 -33 44 -33c34 0 53 -18 53 -46c0 -26 -21 -46 -47 -46c-30 0 -45 24 -45 51s-9 44 -33 44c-16 0 -31 -15 -31 -33c0 -9 7 -21 19 -31c10 -10 16 -23 16 -35 c0 -23 -16 -46 -46 -46s-46 23 -46 46c0 12 6 25 16 35c12 10 19 22 19 31c0 18 -15 33 -31 33c-24 0 -33 -17 -33 -44s-15 -51 -45 -51c-26 0 -47 20 -47 46c0 28 19 46 53 46c27 0 44 9 44 33c0 16 -15 31 -33 31c-9 0 -21 -7 -31 -19c-10 -10 -23 -16 -35 -16 c-23 0 -46 16 -46 46zM167 283c0 -26 22 -48 48 -48s48 22 48 48s-22 48 -48 48s-48 -22 -48 -48z\"/>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E880[] =
+    "<symbol id=\"E880\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E881[] =
+    "<symbol id=\"E881\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E882[] =
+    "<symbol id=\"E882\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E883[] =
+    "<symbol id=\"E883\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E884[] =
+    "<symbol id=\"E884\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E885[] =
+    "<symbol id=\"E885\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E886[] =
+    "<symbol id=\"E886\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E887[] =
+    "<symbol id=\"E887\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E888[] =
+    "<symbol id=\"E888\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E889[] =
+    "<symbol id=\"E889\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E88A[] =
+    "<symbol id=\"E88A\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E901[] =
+    "<symbol id=\"E901\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E904[] =
+    "<symbol id=\"E904\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E909[] =
+    "<symbol id=\"E909\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E938[] =
+    "<symbol id=\"E938\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E939[] =
+    "<symbol id=\"E939\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E93C[] =
+    "<symbol id=\"E93C\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const char xmlGootville_E93D[] =
+    "<symbol id=\"E93D\" viewBox=\"0 0 1000 1000\" overflow=\"inherit\">\n"
+    "   <g transform=\"scale(1,-1)\">\n"
+    "      <path d=\"M0 0v400h200v-400h-200zM10 10h180v380h-180v-380z\"/>\n"
+    "   </g>\n"
+    "</symbol>\n";
+
+static const BuiltInGlyph glyphsGootville[] = {
+    { 0xE003, "E003", 1000, 0.0, -77.0, 414.0, 240.0, 414.0, xmlGootville_E003 },
+    { 0xE004, "E004", 1000, 0.0, -163.0, 414.0, 240.0, 414.0, xmlGootville_E004 },
+    { 0xE045, "E045", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E045 },
+    { 0xE046, "E046", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E046 },
+    { 0xE047, "E047", 1000, 0.0, -348.0, 486.0, 696.0, 486.0, xmlGootville_E047 },
+    { 0xE048, "E048", 1000, 0.0, -316.0, 464.0, 632.0, 464.0, xmlGootville_E048 },
+    { 0xE04B, "E04B", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E04B },
+    { 0xE050, "E050", 1000, 0.0, -633.0, 626.0, 1713.0, 626.0, xmlGootville_E050 },
+    { 0xE051, "E051", 1000, 0.0, -877.0, 626.0, 1957.0, 626.0, xmlGootville_E051 },
+    { 0xE052, "E052", 1000, 0.0, -877.0, 626.0, 1957.0, 626.0, xmlGootville_E052 },
+    { 0xE053, "E053", 1000, 0.0, -633.0, 626.0, 1957.0, 626.0, xmlGootville_E053 },
+    { 0xE054, "E054", 1000, 0.0, -633.0, 626.0, 1957.0, 626.0, xmlGootville_E054 },
+    { 0xE05C, "E05C", 1000, 0.0, -500.0, 642.0, 1000.0, 642.0, xmlGootville_E05C },
+    { 0xE05D, "E05D", 1000, 0.0, -744.0, 642.0, 1244.0, 642.0, xmlGootville_E05D },
+    { 0xE062, "E062", 1000, 0.0, -546.0, 664.0, 800.0, 664.0, xmlGootville_E062 },
+    { 0xE063, "E063", 1000, 0.0, -790.0, 664.0, 1044.0, 664.0, xmlGootville_E063 },
+    { 0xE064, "E064", 1000, 0.0, -790.0, 664.0, 1044.0, 664.0, xmlGootville_E064 },
+    { 0xE065, "E065", 1000, 0.0, -546.0, 664.0, 1044.0, 664.0, xmlGootville_E065 },
+    { 0xE066, "E066", 1000, 0.0, -546.0, 664.0, 1044.0, 664.0, xmlGootville_E066 },
+    { 0xE069, "E069", 1000, 0.0, -250.0, 340.0, 500.0, 340.0, xmlGootville_E069 },
+    { 0xE06A, "E06A", 1000, 0.0, -420.0, 270.0, 840.0, 270.0, xmlGootville_E06A },
+    { 0xE080, "E080", 1000, 0.0, -243.0, 424.0, 486.0, 424.0, xmlGootville_E080 },
+    { 0xE081, "E081", 1000, 0.0, -243.0, 284.0, 486.0, 284.0, xmlGootville_E081 },
+    { 0xE082, "E082", 1000, 0.0, -243.0, 376.0, 486.0, 376.0, xmlGootville_E082 },
+    { 0xE083, "E083", 1000, 0.0, -243.0, 337.0, 486.0, 337.0, xmlGootville_E083 },
+    { 0xE084, "E084", 1000, 0.0, -243.0, 384.0, 486.0, 384.0, xmlGootville_E084 },
+    { 0xE085, "E085", 1000, 0.0, -243.0, 337.0, 486.0, 337.0, xmlGootville_E085 },
+    { 0xE086, "E086", 1000, 0.0, -243.0, 390.0, 486.0, 390.0, xmlGootville_E086 },
+    { 0xE087, "E087", 1000, 0.0, -243.0, 363.0, 486.0, 363.0, xmlGootville_E087 },
+    { 0xE088, "E088", 1000, 0.0, -243.0, 400.0, 486.0, 400.0, xmlGootville_E088 },
+    { 0xE089, "E089", 1000, 0.0, -243.0, 390.0, 486.0, 390.0, xmlGootville_E089 },
+    { 0xE08A, "E08A", 1000, 0.0, -243.0, 426.0, 486.0, 426.0, xmlGootville_E08A },
+    { 0xE08B, "E08B", 1000, 0.0, -412.0, 426.0, 824.0, 426.0, xmlGootville_E08B },
+    { 0xE0A2, "E0A2", 1000, 0.0, -135.0, 454.0, 270.0, 454.0, xmlGootville_E0A2 },
+    { 0xE0A3, "E0A3", 1000, 0.0, -135.0, 316.0, 270.0, 316.0, xmlGootville_E0A3 },
+    { 0xE0A4, "E0A4", 1000, 0.0, -135.0, 316.0, 270.0, 316.0, xmlGootville_E0A4 },
+    { 0xE0FA, "E0FA", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E0FA },
+    { 0xE101, "E101", 1000, 0.0, -246.0, 212.0, 492.0, 212.0, xmlGootville_E101 },
+    { 0xE220, "E220", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E220 },
+    { 0xE221, "E221", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E221 },
+    { 0xE222, "E222", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E222 },
+    { 0xE223, "E223", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E223 },
+    { 0xE224, "E224", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E224 },
+    { 0xE240, "E240", 1000, 0.0, -756.0, 284.0, 770.0, 284.0, xmlGootville_E240 },
+    { 0xE241, "E241", 1000, 0.0, -14.0, 314.0, 770.0, 314.0, xmlGootville_E241 },
+    { 0xE260, "E260", 1000, -15.0, -165.0, 200.0, 625.0, 185.0, xmlGootville_E260 },
+    { 0xE261, "E261", 1000, 0.0, -337.0, 176.0, 674.0, 176.0, xmlGootville_E261 },
+    { 0xE262, "E262", 1000, 0.0, -376.0, 236.0, 752.0, 236.0, xmlGootville_E262 },
+    { 0xE263, "E263", 1000, 0.0, -135.0, 270.0, 270.0, 270.0, xmlGootville_E263 },
+    { 0xE264, "E264", 1000, -15.0, -165.0, 370.0, 625.0, 355.0, xmlGootville_E264 },
+    { 0xE265, "E265", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E265 },
+    { 0xE266, "E266", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E266 },
+    { 0xE267, "E267", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E267 },
+    { 0xE268, "E268", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E268 },
+    { 0xE269, "E269", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E269 },
+    { 0xE26A, "E26A", 1000, 0.0, -267.0, 104.0, 534.0, 104.0, xmlGootville_E26A },
+    { 0xE26B, "E26B", 1000, 0.0, -267.0, 104.0, 534.0, 104.0, xmlGootville_E26B },
+    { 0xE4A0, "E4A0", 1000, 0.0, 0.0, 442.0, 254.0, 442.0, xmlGootville_E4A0 },
+    { 0xE4A1, "E4A1", 1000, 0.0, -254.0, 442.0, 254.0, 442.0, xmlGootville_E4A1 },
+    { 0xE4A2, "E4A2", 1000, 0.0, 0.0, 100.0, 100.0, 100.0, xmlGootville_E4A2 },
+    { 0xE4A3, "E4A3", 1000, 0.0, -100.0, 100.0, 100.0, 100.0, xmlGootville_E4A3 },
+    { 0xE4A4, "E4A4", 1000, 0.0, 0.0, 304.0, 30.0, 304.0, xmlGootville_E4A4 },
+    { 0xE4A5, "E4A5", 1000, 0.0, -30.0, 304.0, 30.0, 304.0, xmlGootville_E4A5 },
+    { 0xE4A6, "E4A6", 1000, 0.0, 0.0, 164.0, 198.0, 164.0, xmlGootville_E4A6 },
+    { 0xE4A7, "E4A7", 1000, 0.0, -198.0, 164.0, 198.0, 164.0, xmlGootville_E4A7 },
+    { 0xE4A8, "E4A8", 1000, 0.0, 0.0, 164.0, 198.0, 164.0, xmlGootville_E4A8 },
+    { 0xE4A9, "E4A9", 1000, 0.0, -198.0, 164.0, 198.0, 164.0, xmlGootville_E4A9 },
+    { 0xE4AC, "E4AC", 1000, 0.0, 0.0, 252.0, 412.0, 252.0, xmlGootville_E4AC },
+    { 0xE4AD, "E4AD", 1000, 0.0, -412.0, 252.0, 412.0, 252.0, xmlGootville_E4AD },
+    { 0xE4B2, "E4B2", 1000, 0.0, 0.0, 304.0, 195.0, 304.0, xmlGootville_E4B2 },
+    { 0xE4B3, "E4B3", 1000, 0.0, -195.0, 304.0, 195.0, 304.0, xmlGootville_E4B3 },
+    { 0xE4B6, "E4B6", 1000, 0.0, 0.0, 118.0, 279.0, 118.0, xmlGootville_E4B6 },
+    { 0xE4B7, "E4B7", 1000, 0.0, -279.0, 118.0, 279.0, 118.0, xmlGootville_E4B7 },
+    { 0xE4C0, "E4C0", 1000, 0.0, 0.0, 650.0, 354.0, 650.0, xmlGootville_E4C0 },
+    { 0xE4C1, "E4C1", 1000, 0.0, -354.0, 650.0, 354.0, 650.0, xmlGootville_E4C1 },
+    { 0xE4C4, "E4C4", 1000, 0.0, 0.0, 581.0, 470.0, 581.0, xmlGootville_E4C4 },
+    { 0xE4C5, "E4C5", 1000, 0.0, -470.0, 581.0, 470.0, 581.0, xmlGootville_E4C5 },
+    { 0xE4C6, "E4C6", 1000, 0.0, 0.0, 572.0, 364.0, 572.0, xmlGootville_E4C6 },
+    { 0xE4C7, "E4C7", 1000, 0.0, -364.0, 572.0, 364.0, 572.0, xmlGootville_E4C7 },
+    { 0xE4C8, "E4C8", 1000, 0.0, 0.0, 572.0, 416.0, 572.0, xmlGootville_E4C8 },
+    { 0xE4C9, "E4C9", 1000, 0.0, -416.0, 572.0, 416.0, 572.0, xmlGootville_E4C9 },
+    { 0xE4CE, "E4CE", 1000, 0.0, 0.0, 142.0, 262.0, 142.0, xmlGootville_E4CE },
+    { 0xE4E5, "E4E5", 1000, 0.0, -363.0, 222.0, 728.0, 222.0, xmlGootville_E4E5 },
+    { 0xE4E6, "E4E6", 1000, 0.0, -224.0, 256.0, 424.0, 256.0, xmlGootville_E4E6 },
+    { 0xE4E7, "E4E7", 1000, 0.0, -468.0, 328.0, 668.0, 328.0, xmlGootville_E4E7 },
+    { 0xE4E8, "E4E8", 1000, 0.0, -468.0, 400.0, 912.0, 400.0, xmlGootville_E4E8 },
+    { 0xE4E9, "E4E9", 1000, 0.0, -712.0, 472.0, 1156.0, 472.0, xmlGootville_E4E9 },
+    { 0xE4EA, "E4EA", 1000, 0.0, -712.0, 544.0, 1400.0, 544.0, xmlGootville_E4EA },
+    { 0xE500, "E500", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E500 },
+    { 0xE501, "E501", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E501 },
+    { 0xE502, "E502", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E502 },
+    { 0xE510, "E510", 1000, 0.0, 0.0, 414.0, 486.0, 414.0, xmlGootville_E510 },
+    { 0xE514, "E514", 1000, 0.0, 0.0, 661.0, 486.0, 661.0, xmlGootville_E514 },
+    { 0xE517, "E517", 1000, 0.0, 0.0, 792.0, 486.0, 792.0, xmlGootville_E517 },
+    { 0xE520, "E520", 1000, -72.0, -180.0, 418.0, 452.0, 346.0, xmlGootville_E520 },
+    { 0xE521, "E521", 1000, -41.0, -20.0, 460.0, 292.0, 394.0, xmlGootville_E521 },
+    { 0xE522, "E522", 1000, -144.0, -147.0, 530.0, 597.0, 277.0, xmlGootville_E522 },
+    { 0xE523, "E523", 1000, -17.0, -1.0, 310.0, 273.0, 293.0, xmlGootville_E523 },
+    { 0xE524, "E524", 1000, 0.0, -22.0, 226.0, 294.0, 226.0, xmlGootville_E524 },
+    { 0xE525, "E525", 1000, -24.0, 0.0, 314.0, 272.0, 290.0, xmlGootville_E525 },
+    { 0xE526, "E526", 1000, -41.0, -20.0, 340.0, 292.0, 274.0, xmlGootville_E526 },
+    { 0xE527, "E527", 1000, -72.0, -180.0, 2148.0, 452.0, 2076.0, xmlGootville_E527 },
+    { 0xE528, "E528", 1000, -72.0, -180.0, 1802.0, 452.0, 1730.0, xmlGootville_E528 },
+    { 0xE529, "E529", 1000, -72.0, -180.0, 1456.0, 452.0, 1384.0, xmlGootville_E529 },
+    { 0xE52A, "E52A", 1000, -72.0, -180.0, 1110.0, 452.0, 1038.0, xmlGootville_E52A },
+    { 0xE52B, "E52B", 1000, -72.0, -180.0, 764.0, 452.0, 692.0, xmlGootville_E52B },
+    { 0xE52C, "E52C", 1000, -41.0, -180.0, 781.0, 452.0, 740.0, xmlGootville_E52C },
+    { 0xE52D, "E52D", 1000, -41.0, -147.0, 821.0, 597.0, 671.0, xmlGootville_E52D },
+    { 0xE52E, "E52E", 1000, -72.0, -180.0, 804.0, 630.0, 623.0, xmlGootville_E52E },
+    { 0xE52F, "E52F", 1000, -144.0, -147.0, 807.0, 597.0, 554.0, xmlGootville_E52F },
+    { 0xE530, "E530", 1000, -144.0, -147.0, 1084.0, 597.0, 831.0, xmlGootville_E530 },
+    { 0xE531, "E531", 1000, -144.0, -147.0, 1361.0, 597.0, 1108.0, xmlGootville_E531 },
+    { 0xE532, "E532", 1000, -144.0, -147.0, 1638.0, 597.0, 1385.0, xmlGootville_E532 },
+    { 0xE533, "E533", 1000, -144.0, -147.0, 1915.0, 597.0, 1662.0, xmlGootville_E533 },
+    { 0xE534, "E534", 1000, -144.0, -180.0, 767.0, 630.0, 623.0, xmlGootville_E534 },
+    { 0xE535, "E535", 1000, -144.0, -147.0, 711.0, 597.0, 567.0, xmlGootville_E535 },
+    { 0xE536, "E536", 1000, 0.0, -147.0, 612.0, 597.0, 503.0, xmlGootville_E536 },
+    { 0xE537, "E537", 1000, 0.0, -180.0, 849.0, 630.0, 849.0, xmlGootville_E537 },
+    { 0xE538, "E538", 1000, 0.0, -180.0, 1195.0, 630.0, 1195.0, xmlGootville_E538 },
+    { 0xE539, "E539", 1000, 0.0, -147.0, 793.0, 597.0, 793.0, xmlGootville_E539 },
+    { 0xE53A, "E53A", 1000, 0.0, -180.0, 1139.0, 630.0, 1139.0, xmlGootville_E53A },
+    { 0xE53B, "E53B", 1000, 0.0, -147.0, 1070.0, 597.0, 1070.0, xmlGootville_E53B },
+    { 0xE53C, "E53C", 1000, -17.0, -147.0, 696.0, 597.0, 570.0, xmlGootville_E53C },
+    { 0xE53D, "E53D", 1000, -17.0, -147.0, 877.0, 597.0, 860.0, xmlGootville_E53D },
+    { 0xE566, "E566", 1000, 0.0, -9.0, 531.0, 376.0, 600.0, xmlGootville_E566 },
+    { 0xE567, "E567", 1000, 0.0, -141.0, 620.0, 282.0, 620.0, xmlGootville_E567 },
+    { 0xE568, "E568", 1000, 0.0, -141.0, 620.0, 282.0, 620.0, xmlGootville_E568 },
+    { 0xE56A, "E56A", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E56A },
+    { 0xE56B, "E56B", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E56B },
+    { 0xE56C, "E56C", 1000, 0.0, -128.0, 606.0, 256.0, 606.0, xmlGootville_E56C },
+    { 0xE56D, "E56D", 1000, 0.0, -200.0, 606.0, 400.0, 606.0, xmlGootville_E56D },
+    { 0xE56E, "E56E", 1000, 0.0, -128.0, 852.0, 256.0, 852.0, xmlGootville_E56E },
+    { 0xE610, "E610", 1000, 0.0, 0.0, 336.0, 352.0, 336.0, xmlGootville_E610 },
+    { 0xE611, "E611", 1000, 0.0, 0.0, 336.0, 352.0, 336.0, xmlGootville_E611 },
+    { 0xE612, "E612", 1000, 0.0, 0.0, 252.0, 412.0, 252.0, xmlGootville_E612 },
+    { 0xE613, "E613", 1000, 0.0, 0.0, 252.0, 412.0, 252.0, xmlGootville_E613 },
+    { 0xE650, "E650", 1000, 0.0, 0.0, 782.0, 500.0, 782.0, xmlGootville_E650 },
+    { 0xE655, "E655", 1000, 0.0, 66.0, 430.0, 434.0, 430.0, xmlGootville_E655 },
+    { 0xE880, "E880", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E880 },
+    { 0xE881, "E881", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E881 },
+    { 0xE882, "E882", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E882 },
+    { 0xE883, "E883", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E883 },
+    { 0xE884, "E884", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E884 },
+    { 0xE885, "E885", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E885 },
+    { 0xE886, "E886", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E886 },
+    { 0xE887, "E887", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E887 },
+    { 0xE888, "E888", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E888 },
+    { 0xE889, "E889", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E889 },
+    { 0xE88A, "E88A", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E88A },
+    { 0xE901, "E901", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E901 },
+    { 0xE904, "E904", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E904 },
+    { 0xE909, "E909", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E909 },
+    { 0xE938, "E938", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E938 },
+    { 0xE939, "E939", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E939 },
+    { 0xE93C, "E93C", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E93C },
+    { 0xE93D, "E93D", 1000, 0.0, 0.0, 0.0, 0.0, 0.0, xmlGootville_E93D },
+};
+
+//----------------------------------------------------------------------------
+// Text font (bounding boxes only)
+//----------------------------------------------------------------------------
+
+static const BuiltInGlyph glyphsText[] = {
+    { 0x21, "", 2048, 265.0, -22.0, 223.0, 1406.0, 682.0, NULL },
+    { 0x22, "", 2048, 188.0, 794.0, 459.0, 590.0, 836.0, NULL },
+    { 0x23, "", 2048, 0.0, 0.0, 1021.0, 1353.0, 1024.0, NULL },
+    { 0x24, "", 2048, 90.0, -181.0, 845.0, 1669.0, 1024.0, NULL },
+    { 0x25, "", 2048, 125.0, -29.0, 1457.0, 1413.0, 1706.0, NULL },
+    { 0x26, "", 2048, 82.0, -30.0, 1453.0, 1414.0, 1593.0, NULL },
+    { 0x27, "", 2048, 103.0, 794.0, 150.0, 590.0, 369.0, NULL },
+    { 0x28, "", 2048, 94.0, -365.0, 529.0, 1749.0, 682.0, NULL },
+    { 0x29, "", 2048, 54.0, -365.0, 529.0, 1749.0, 682.0, NULL },
+    { 0x2A, "", 2048, 135.0, 542.0, 744.0, 842.0, 1024.0, NULL },
+    { 0x2B, "", 2048, 61.0, 0.0, 1034.0, 1035.0, 1155.0, NULL },
+    { 0x2C, "", 2048, 215.0, -292.0, 287.0, 500.0, 512.0, NULL },
+    { 0x2D, "", 2048, 80.0, 398.0, 503.0, 128.0, 682.0, NULL },
+    { 0x2E, "", 2048, 220.0, -24.0, 227.0, 227.0, 512.0, NULL },
+    { 0x2F, "", 2048, 4.0, -34.0, 555.0, 1418.0, 569.0, NULL },
+    { 0x30, "", 2048, 18.0, -19.0, 927.0, 1395.0, 1024.0, NULL },
+    { 0x31, "", 2048, 227.0, 0.0, 578.0, 1374.0, 1024.0, NULL },
+    { 0x32, "", 2048, 61.0, 0.0, 910.0, 1380.0, 1024.0, NULL },
+    { 0x33, "", 2048, 89.0, -15.0, 797.0, 1401.0, 1024.0, NULL },
+    { 0x34, "", 2048, 23.0, 0.0, 944.0, 1374.0, 1024.0, NULL },
+    { 0x35, "", 2048, 65.0, -22.0, 830.0, 1429.0, 1024.0, NULL },
+    { 0x36, "", 2048, 70.0, -22.0, 888.0, 1422.0, 1024.0, NULL },
+    { 0x37, "", 2048, 40.0, -19.0, 879.0, 1374.0, 1024.0, NULL },
+    { 0x38, "", 2048, 109.0, -22.0, 795.0, 1401.0, 1024.0, NULL },
+    { 0x39, "", 2048, 61.0, -48.0, 882.0, 1427.0, 1024.0, NULL },
+    { 0x3A, "", 2048, 165.0, -17.0, 228.0, 958.0, 569.0, NULL },
+    { 0x3B, "", 2048, 170.0, -292.0, 287.0, 1233.0, 569.0, NULL },
+    { 0x3C, "", 2048, 61.0, -17.0, 1034.0, 1069.0, 1155.0, NULL },
+    { 0x3D, "", 2048, 61.0, 241.0, 1034.0, 553.0, 1155.0, NULL },
+    { 0x3E, "", 2048, 18.0, -17.0, 1115.0, 1069.0, 1155.0, NULL },
+    { 0x3F, "", 2048, 135.0, -19.0, 714.0, 1402.0, 909.0, NULL },
+    { 0x40, "", 2048, 184.0, -29.0, 1501.0, 1413.0, 1886.0, NULL },
+    { 0x41, "", 2048, 30.0, 0.0, 1415.0, 1379.0, 0.0, NULL },
+    { 0x42, "", 2048, 35.0, 0.0, 1178.0, 1355.0, 1366.0, NULL },
+    { 0x43, "", 2048, 51.0, -34.0, 1245.0, 1413.0, 1366.0, NULL },
+    { 0x44, "", 2048, 33.0, 0.0, 1372.0, 1355.0, 0.0, NULL },
+    { 0x45, "", 2048, 23.0, 0.0, 1200.0, 1355.0, 1251.0, NULL },
+    { 0x46, "", 2048, 23.0, 0.0, 1098.0, 1355.0, 1139.0, NULL },
+    { 0x47, "", 2048, 49.0, -29.0, 1392.0, 1408.0, 0.0, NULL },
+    { 0x48, "", 2048, 33.0, 0.0, 1398.0, 1355.0, 0.0, NULL },
+    { 0x49, "", 2048, 33.0, 0.0, 606.0, 1355.0, 682.0, NULL },
+    { 0x4A, "", 2048, 21.0, -24.0, 737.0, 1379.0, 797.0, NULL },
+    { 0x4B, "", 2048, 37.0, 0.0, 1413.0, 1355.0, 0.0, NULL },
+    { 0x4C, "", 2048, 23.0, 0.0, 1202.0, 1355.0, 1251.0, NULL },
+    { 0x4D, "", 2048, 23.0, 0.0, 1745.0, 1355.0, 1821.0, NULL },
+    { 0x4E, "", 2048, 23.0, -24.0, 1425.0, 1379.0, 0.0, NULL },
+    { 0x4F, "", 2048, 61.0, -29.0, 1342.0, 1413.0, 0.0, NULL },
+    { 0x50, "", 2048, 33.0, 0.0, 1076.0, 1355.0, 1139.0, NULL },
+    { 0x51, "", 2048, 61.0, -365.0, 1368.0, 1749.0, 0.0, NULL },
+    { 0x52, "", 2048, 23.0, 0.0, 1316.0, 1355.0, 1366.0, NULL },
+    { 0x53, "", 2048, 85.0, -27.0, 920.0, 1411.0, 1139.0, NULL },
+    { 0x54, "", 2048, 28.0, 0.0, 1180.0, 1355.0, 1251.0, NULL },
+    { 0x55, "", 2048, 28.0, -29.0, 1415.0, 1384.0, 0.0, NULL },
+    { 0x56, "", 2048, 33.0, -24.0, 1393.0, 1379.0, 0.0, NULL },
+    { 0x57, "", 2048, 9.0, -24.0, 1899.0, 1379.0, 1933.0, NULL },
+    { 0x58, "", 2048, 21.0, 0.0, 1420.0, 1355.0, 0.0, NULL },
+    { 0x59, "", 2048, 45.0, 0.0, 1393.0, 1355.0, 0.0, NULL },
+    { 0x5A, "", 2048, 14.0, 0.0, 1209.0, 1355.0, 1251.0, NULL },
+    { 0x5B, "", 2048, 180.0, -323.0, 431.0, 1678.0, 682.0, NULL },
+    { 0x5C, "", 2048, -64.0, 0.0, 696.0, 1384.0, 569.0, NULL },
+    { 0x5D, "", 2048, 68.0, -323.0, 432.0, 1678.0, 682.0, NULL },
+    { 0x5E, "", 2048, 66.0, 519.0, 827.0, 865.0, 961.0, NULL },
+    { 0x5F, "", 2048, 0.0, -256.0, 1023.0, 101.0, 1024.0, NULL },
+    { 0x60, "", 2048, -20.0, 938.0, 460.0, 452.0, 682.0, NULL },
+    { 0x61, "", 2048, 75.0, -15.0, 830.0, 963.0, 909.0, NULL },
+    { 0x62, "", 2048, 7.0, -19.0, 950.0, 1415.0, 1024.0, NULL },
+    { 0x63, "", 2048, 47.0, -19.0, 796.0, 962.0, 909.0, NULL },
+    { 0x64, "", 2048, 49.0, -19.0, 956.0, 1417.0, 1024.0, NULL },
+    { 0x65, "", 2048, 40.0, -24.0, 822.0, 962.0, 909.0, NULL },
+    { 0x66, "", 2048, 40.0, 0.0, 744.0, 1398.0, 682.0, NULL },
+    { 0x67, "", 2048, 54.0, -446.0, 908.0, 1389.0, 1024.0, NULL },
+    { 0x68, "", 2048, 18.0, 0.0, 979.0, 1396.0, 1024.0, NULL },
+    { 0x69, "", 2048, 40.0, 0.0, 486.0, 1396.0, 569.0, NULL },
+    { 0x6A, "", 2048, -118.0, -448.0, 551.0, 1844.0, 569.0, NULL },
+    { 0x6B, "", 2048, 4.0, 0.0, 1019.0, 1393.0, 1024.0, NULL },
+    { 0x6C, "", 2048, 37.0, 0.0, 489.0, 1404.0, 569.0, NULL },
+    { 0x6D, "", 2048, 33.0, 0.0, 1555.0, 936.0, 1593.0, NULL },
+    { 0x6E, "", 2048, 33.0, 0.0, 962.0, 942.0, 1024.0, NULL },
+    { 0x6F, "", 2048, 52.0, -31.0, 910.0, 969.0, 1024.0, NULL },
+    { 0x70, "", 2048, 9.0, -446.0, 953.0, 1391.0, 1024.0, NULL },
+    { 0x71, "", 2048, 49.0, -446.0, 951.0, 1389.0, 1024.0, NULL },
+    { 0x72, "", 2048, 9.0, 0.0, 680.0, 943.0, 682.0, NULL },
+    { 0x73, "", 2048, 104.0, -19.0, 609.0, 964.0, 797.0, NULL },
+    { 0x74, "", 2048, 25.0, -19.0, 546.0, 1204.0, 569.0, NULL },
+    { 0x75, "", 2048, 18.0, -19.0, 963.0, 957.0, 1024.0, NULL },
+    { 0x76, "", 2048, 37.0, -19.0, 939.0, 948.0, 1024.0, NULL },
+    { 0x77, "", 2048, 42.0, -20.0, 1380.0, 949.0, 0.0, NULL },
+    { 0x78, "", 2048, 35.0, 0.0, 946.0, 919.0, 1024.0, NULL },
+    { 0x79, "", 2048, 28.0, -448.0, 943.0, 1386.0, 1024.0, NULL },
+    { 0x7A, "", 2048, 52.0, 0.0, 803.0, 938.0, 909.0, NULL },
+    { 0x7B, "", 2048, 127.0, -365.0, 728.0, 1749.0, 983.0, NULL },
+    { 0x7C, "", 2048, 135.0, 0.0, 139.0, 1398.0, 410.0, NULL },
+    { 0x7D, "", 2048, 127.0, -365.0, 728.0, 1749.0, 983.0, NULL },
+    { 0xC2A1, "", 2048, 187.0, -460.0, 223.0, 1405.0, 682.0, NULL },
+    { 0xC2A2, "", 2048, 109.0, -285.0, 808.0, 1470.0, 1024.0, NULL },
+    { 0xC2A3, "", 2048, 22.0, -20.0, 983.0, 1404.0, 1024.0, NULL },
+    { 0xC2A4, "", 2048, 66.0, 263.0, 832.0, 832.0, 1024.0, NULL },
+    { 0xC2A5, "", 2048, 14.0, 0.0, 1017.0, 1355.0, 1024.0, NULL },
+    { 0xC2A6, "", 2048, 135.0, 0.0, 139.0, 1398.0, 410.0, NULL },
+    { 0xC2A7, "", 2048, 146.0, -301.0, 725.0, 1690.0, 1024.0, NULL },
+    { 0xC2A8, "", 2048, -19.0, 938.0, 611.0, 337.0, 682.0, NULL },
+    { 0xC2A9, "", 2048, 66.0, -24.0, 1408.0, 1408.0, 1556.0, NULL },
+    { 0xC2AA, "", 2048, 23.0, 798.0, 541.0, 586.0, 565.0, NULL },
+    { 0xC2AB, "", 2048, 87.0, 73.0, 846.0, 785.0, 1024.0, NULL },
+    { 0xC2AC, "", 2048, 61.0, 241.0, 1034.0, 553.0, 1155.0, NULL },
+    { 0xC2AE, "", 2048, 66.0, -24.0, 1408.0, 1408.0, 1556.0, NULL },
+    { 0xC2AF, "", 2048, -34.0, 1121.0, 640.0, 109.0, 682.0, NULL },
+    { 0xC2B0, "", 2048, 87.0, 791.0, 583.0, 583.0, 819.0, NULL },
+    { 0xC2B1, "", 2048, 47.0, 0.0, 1033.0, 1035.0, 1124.0, NULL },
+    { 0xC2B2, "", 2048, 7.0, 528.0, 587.0, 846.0, 614.0, NULL },
+    { 0xC2B3, "", 2048, 22.0, 517.0, 516.0, 857.0, 614.0, NULL },
+    { 0xC2B4, "", 2048, 132.0, 938.0, 461.0, 453.0, 682.0, NULL },
+    { 0xC2B5, "", 2048, -157.0, -422.0, 1128.0, 1329.2, 1180.0, NULL },
+    { 0xC2B6, "", 2048, -43.0, -299.0, 927.0, 1654.0, 928.0, NULL },
+    { 0xC2B7, "", 2048, 106.0, 561.0, 237.0, 235.0, 512.0, NULL },
+    { 0xC2B8, "", 2048, 52.0, -444.0, 426.0, 444.0, 682.0, NULL },
+    { 0xC2B9, "", 2048, 135.0, 538.0, 374.0, 837.0, 614.0, NULL },
+    { 0xC2BA, "", 2048, 33.0, 798.0, 590.0, 587.0, 635.0, NULL },
+    { 0xC2BB, "", 2048, 90.0, 73.0, 846.0, 785.0, 1024.0, NULL },
+    { 0xC2BC, "", 2048, 109.0, -15.0, 1256.0, 1394.0, 1536.0, NULL },
+    { 0xC2BD, "", 2048, 109.0, -15.0, 1287.0, 1394.0, 1536.0, NULL },
+    { 0xC2BE, "", 2048, 53.0, -15.0, 1326.0, 1394.0, 1536.0, NULL },
+    { 0xC2BF, "", 2048, 43.0, -457.0, 715.0, 1402.0, 909.0, NULL },
+    { 0xC380, "", 2048, 30.0, 0.0, 1415.0, 1831.0, 0.0, NULL },
+    { 0xC381, "", 2048, 30.0, 0.0, 1415.0, 1832.0, 0.0, NULL },
+    { 0xC382, "", 2048, 30.0, 0.0, 1415.0, 1820.0, 0.0, NULL },
+    { 0xC383, "", 2048, 30.0, 0.0, 1415.0, 1747.0, 0.0, NULL },
+    { 0xC384, "", 2048, 30.0, 0.0, 1415.0, 1716.0, 0.0, NULL },
+    { 0xC385, "", 2048, 30.0, 0.0, 1415.0, 1834.0, 0.0, NULL },
+    { 0xC386, "", 2048, 9.0, 0.0, 1771.0, 1355.0, 1821.0, NULL },
+    { 0xC387, "", 2048, 51.0, -444.0, 1245.0, 1823.0, 1366.0, NULL },
+    { 0xC388, "", 2048, 23.0, 0.0, 1200.0, 1807.0, 1251.0, NULL },
+    { 0xC389, "", 2048, 23.0, 0.0, 1200.0, 1808.0, 1251.0, NULL },
+    { 0xC38A, "", 2048, 23.0, 0.0, 1200.0, 1796.0, 1251.0, NULL },
+    { 0xC38B, "", 2048, 23.0, 0.0, 1200.0, 1692.0, 1251.0, NULL },
+    { 0xC38C, "", 2048, 33.0, 0.0, 606.0, 1807.0, 682.0, NULL },
+    { 0xC38D, "", 2048, 33.0, 0.0, 619.0, 1808.0, 682.0, NULL },
+    { 0xC38E, "", 2048, 16.0, 0.0, 640.0, 1796.0, 682.0, NULL },
+    { 0xC38F, "", 2048, 31.0, 0.0, 611.0, 1692.0, 682.0, NULL },
+    { 0xC390, "", 2048, 33.0, 0.0, 1370.0, 1355.0, 0.0, NULL },
+    { 0xC391, "", 2048, 23.0, -24.0, 1425.0, 1747.0, 0.0, NULL },
+    { 0xC392, "", 2048, 61.0, -29.0, 1342.0, 1865.0, 0.0, NULL },
+    { 0xC393, "", 2048, 61.0, -29.0, 1342.0, 1866.0, 0.0, NULL },
+    { 0xC394, "", 2048, 61.0, -29.0, 1342.0, 1854.0, 0.0, NULL },
+    { 0xC395, "", 2048, 61.0, -29.0, 1342.0, 1781.0, 0.0, NULL },
+    { 0xC396, "", 2048, 61.0, -29.0, 1342.0, 1750.0, 0.0, NULL },
+    { 0xC397, "", 2048, 85.0, 26.0, 984.0, 983.0, 1155.0, NULL },
+    { 0xC398, "", 2048, 61.0, -166.0, 1342.0, 1668.0, 0.0, NULL },
+    { 0xC399, "", 2048, 28.0, -29.0, 1415.0, 1836.0, 0.0, NULL },
+    { 0xC39A, "", 2048, 28.0, -29.0, 1415.0, 1837.0, 0.0, NULL },
+    { 0xC39B, "", 2048, 28.0, -29.0, 1415.0, 1825.0, 0.0, NULL },
+    { 0xC39C, "", 2048, 28.0, -29.0, 1415.0, 1721.0, 0.0, NULL },
+    { 0xC39D, "", 2048, 45.0, 0.0, 1393.0, 1808.0, 0.0, NULL },
+    { 0xC39E, "", 2048, 33.0, 0.0, 1073.0, 1355.0, 1139.0, NULL },
+    { 0xC39F, "", 2048, 23.0, -22.0, 936.0, 1423.0, 1024.0, NULL },
+    { 0xC3A0, "", 2048, 75.0, -15.0, 830.0, 1415.0, 909.0, NULL },
+    { 0xC3A1, "", 2048, 75.0, -15.0, 830.0, 1416.0, 909.0, NULL },
+    { 0xC3A2, "", 2048, 75.0, -15.0, 830.0, 1404.0, 909.0, NULL },
+    { 0xC3A3, "", 2048, 75.0, -15.0, 830.0, 1331.0, 909.0, NULL },
+    { 0xC3A4, "", 2048, 75.0, -15.0, 830.0, 1300.0, 909.0, NULL },
+    { 0xC3A5, "", 2048, 75.0, -15.0, 830.0, 1489.0, 909.0, NULL },
+    { 0xC3A6, "", 2048, 77.0, -16.0, 1217.0, 969.0, 1366.0, NULL },
+    { 0xC3A7, "", 2048, 47.0, -444.0, 796.0, 1387.0, 909.0, NULL },
+    { 0xC3A8, "", 2048, 40.0, -24.0, 822.0, 1414.0, 909.0, NULL },
+    { 0xC3A9, "", 2048, 40.0, -24.0, 822.0, 1415.0, 909.0, NULL },
+    { 0xC3AA, "", 2048, 40.0, -24.0, 822.0, 1403.0, 909.0, NULL },
+    { 0xC3AB, "", 2048, 40.0, -24.0, 822.0, 1299.0, 909.0, NULL },
+    { 0xC3AC, "", 2048, -12.0, 0.0, 538.0, 1390.0, 569.0, NULL },
+    { 0xC3AD, "", 2048, 40.0, 0.0, 562.0, 1391.0, 569.0, NULL },
+    { 0xC3AE, "", 2048, -34.0, 0.0, 640.0, 1379.0, 569.0, NULL },
+    { 0xC3AF, "", 2048, -19.0, 0.0, 611.0, 1275.0, 569.0, NULL },
+    { 0xC3B0, "", 2048, 54.0, -31.0, 907.0, 1422.0, 1024.0, NULL },
+    { 0xC3B1, "", 2048, 33.0, 0.0, 962.0, 1310.0, 1024.0, NULL },
+    { 0xC3B2, "", 2048, 52.0, -31.0, 910.0, 1421.0, 1024.0, NULL },
+    { 0xC3B3, "", 2048, 52.0, -31.0, 910.0, 1422.0, 1024.0, NULL },
+    { 0xC3B4, "", 2048, 52.0, -31.0, 910.0, 1410.0, 1024.0, NULL },
+    { 0xC3B5, "", 2048, 52.0, -31.0, 910.0, 1337.0, 1024.0, NULL },
+    { 0xC3B6, "", 2048, 52.0, -31.0, 910.0, 1306.0, 1024.0, NULL },
+    { 0xC3B7, "", 2048, 47.0, 37.0, 1033.0, 960.0, 1124.0, NULL },
+    { 0xC3B8, "", 2048, 52.0, -228.0, 910.0, 1361.0, 1024.0, NULL },
+    { 0xC3B9, "", 2048, 18.0, -19.0, 963.0, 1409.0, 1024.0, NULL },
+    { 0xC3BA, "", 2048, 18.0, -19.0, 963.0, 1410.0, 1024.0, NULL },
+    { 0xC3BB, "", 2048, 18.0, -19.0, 963.0, 1398.0, 1024.0, NULL },
+    { 0xC3BC, "", 2048, 18.0, -19.0, 963.0, 1294.0, 1024.0, NULL },
+};
+
+//----------------------------------------------------------------------------
+// VerovioText woff
+//----------------------------------------------------------------------------
+
+static const char builtInWoff[] =
+    "<style type=\"text/css\">\n"
+    "@font-face {\n"
+    "    font-family: 'VerovioText';\n"
+    "    src: url(data:application/x-font-woff;charset=utf-8;base64,d09GRk9UVE8AABPoAAsAAAAAMrQAAQAAAAAAAAAAAAAAAAAAAAAAAAAAAABDRkYgAAABCAAAEHIAAC0xR7huRUZGVE0AABF8AAAAHAAAABxvSsNdR0RFRgAAEZgAAAAiAAAAKABMACRPUy8yAAARvAAAAEgAAABgStZbn2NtYXAAABIEAAAAPwAAAVLiE+geaGVhZAAAEkQAAAAxAAAANgkrNPBoaGVhAAASeAAAACAAAAAkDMMDRWhtdHgAABKYAAAARwAAAHReIv8GbWF4cAAAEuAAAAAGAAAABgAdUABuYW1lAAAS6AAAAOwAAAHUU3fPU3Bvc3QAABPUAAAAEwAAACD/agBmeJzlWn+QVVUdP/ft23235bGxPHctee2iQoAwupAQUOkN2URHLclEy0qHocGYTdvAVXrKfWVX6miuPx7m03gIOyljOCk1Ov7IO84YRM2Qk8OMMBmNMYUzQgpxd3kLp+/3e77n3vt+7LIZ/zU7c++5Z+8553u+Pz6f7/fcZ4lkUliWlb52Re8tt918yzUrbl8trISwxJLBT4vB+dbggsTgwobBjyWnphveTyc7mkVy/fROKcNGOlVuLX+QbbwoO3FeY9byPpoVYkLWerU1K+ZkZ35vopiMs9nio6JdfEJMETPFHLFAOOJScZX4irhBLBffFt8Vt4t1whP3iYfFY2Kz2Cp+JZ4XvxWvi53w92fx9prv3Nw9e3GXvs3Wtzn69il9u1Df5urbPH37tL7N17cF+vZ5fVukb5fo22J969a3L9CtW6/Xrdfr1ut16/W69Xrder1uvV63Xq+b1ps7t0vfZuvbnNnnd8WUHNe3ENY91nrrx9ZPLGnda91n/dS63+q3HrAetB6yHrYK1gbrEetn1qNW0XrMetz6ubXRKlmbrCeszeITqNxk4oqG5xpTTfObPtNUatpkX2w7zSeaT7YsaFnYurD1c2cMnXH8rBfPeunsC87umn7n9Lum753+lxkTZlwy47bhFS3BE8EtSnzKEYNfU2KuLyZKJRb7QomFeFniChncraydDjx84MIl4epuelmJy3yR+QePeNIXbSqxwRUpJVLwhhrE12z4lzriig6l3nFEE7X1v1Tg6FanOnEzjtIDYKinRBpHiKwPI7BN3f107cwESvzQEe2Tm5X1N5gisdyBhU/uwSmXOKLcqtS3cOYeFGqdK8qTgreVtQqf1ri6S4lH8XGjL8o/DdJKdaEQKgOPk9sGlLgCt/tlXxRoZ6CRRxy8roW5LpRK9UFfDu4f4ConXL2/vFI7cKtvY+dbeIHHXJ+n1Lu+ee0gqLMPBr7naE329dtK7UFJYIsrS0rtxzZsOqc3rV+cyBpUotUVduYwD0H9q32+2AOSXUrytYYGwiHYKtqqQUD75HSwDegL994es1G+xj55NlB924BQXiFulwLbpKWoxG8cEdykxLALNwvEWeSI49cocbEvGo6/oJJpsFIfK+0wLnqIlL6FZn8DO/4KGiEpOtTw0y76yiEU5R1Uwudgh51K3ESSw0ZBQxMcwW/QheY0E8MMi2hi/Be+mWP1wKVYpFvHHpipE+eGy1Yl2qFr6G+wrbNReZNwyj+CoTvnmVnGg11KPA1snWdRDa8YmdhKRi6QoQOaJz+OcYEbUOKTZmrcSIdKPA163P9aj1JvOqJzFiz0uiOu6Z3XoU58g2JlC066yxHPKNHlg5bLH1fWOBwOActRCS1U9vvY8Xv8F7QadGA0LKwIDKV+hC2KjVU41EVlrQWrQXh8B24p3RXGhlJJEzQcIWdicw3OiuriQFmKrXHY0m4YBcsC8PXvg8/nyP/1NV8bKLvQPBgcECz/xI5hpzpYGnwdLPs4WJTai6u24YsQNAO5orY9mbpE+tRKQqcimNK4JkuSoyNlAqplGOLiHXz6GqDgDDKNxSiYmO9r32sI1tJLbcq62"
+    "xf7gt1KXAUGUSmBsrwGbw3d76C/UWhOwYXBlCDIC7CmrU4+BtCSKD9JJii3Hqb+oL1TR7H1EHkIgRMEzR4lzkLxu0jomXAd6CvSNgvsYU0cQ4RCu/FhNwOOUtfj5WHXXF7Ax+exdcBnjzbXv7ugN4plOwpvHfmoIlmUWoX6sggvW3zxLihsQ8vwpCFWzJAYurctvm+UQkfDK7R3lcDeudixGDZ/QzlNKtYqaEXEOIEjXgUHXBZTaKql5XdD7GJqO5tBWbdi62pHZDapxAuOyH7kiTYWHsM2dBYKQFz8iBvnHNnXmblRDV3uVppqFJG7ca6FILeRGnQZk/pln6RuXEoYsMyAkXjI1R7AfWlstRtXEWf6YhYY4FEXzfCsw8ChfumYsID9enmpRc7LXhbucOj8tGFEeuIVxHBJz9JGo6XDgITWQOTqSsxwdHjDS7eC6xcNrr+FU21B4NYgIZ520Ck2YnM9CoRCivt9wREIfmC3tByotA9mDNYPDCKol12dKWQmqOSV0Nu4Dbxc9kumqIThc5aXRFsN0BGk7cyNktQlSVUetfuUuNtlT9fc14uLAticQ5spJzSaaw7dDWBS0mii9XQEldOTHbqoqSpGWbe+MybDK7ELhY3bPrkEA1+sYrsE6eUkjwZLcb6jNcvLbEZsZMPvwK3hNa/dAm3pQf8Q2MeTvUVypQKbOBUam7wbERL7QGZUnyR20mQeGb1A1yAh37VJvynJpjmI81wVWhNg25b9PH0ToTeMs1l9vwe49xBoII/JawwHsY/GPJT6pMdCkv67fAO9SHla40YVR5XaGj7Tf4Br7IwRIOEaZ6arzU4yntIxnRa2YlAjXsqjGuYwyZjFEADgViLLSm1VbfuqbA28d18d773H4Zz2RpV0XZFNvtjmsabAFvt4c5fyTOjLqK7+aq9OhF59Hl5upb2guAO8x3a25gDH3/kGA8TUEEJgM3aJXL20X5IQIXnh0BKbcS0OwPRJzHc0OSvxML7zKC+t1EOO4NgAc2OI6+FICJpBj4RYmaduyLSCnbV09r+HCryZOsp7prSC/I+EzLIeZvMq4ChymmRSo3IBJMjTVYuakr0FAvwi/R9N0OBHhtFRgSlqkfTdX6DweFcesOcp69/o1Jokcl7cqYn/8tKTNSAbOfdMfO3vrtEMIjaGl50vNGY2zYb9Pck9kXsb/8DcEKUpyKAdnZeMBMRmnHd3qOUdxNHajQ+RAx/m3eVsmmxwfpvXl6coy2tF6kyZAg7zKu1L5BrA4NOChFI/x1RSC/x65Jl3oKR/4ufyUnZPEh023SNpYtATxZDMjSF2LoeOxs2YLhlzNPgMKxzb/f3pqTWB8l3fBEoUIkQBYwmWUWKFVUqjCZmOMDL1kQltZkfQ0gBlgXK/rqYkx0c0xUHybK1UIiGKt0ccHW+oYgo2smUUbDz4ACFTLNh6IdCOgUCnP9CQk04RaHFa2kIOttHQUk3A5YA6cO8VARfxkawKuFI/W5UCjnIgm7wkFUNTJa4MI+oyykGp+SZ4zdnNmU3nNGv3sH4BHedCqf+IK5I67FDVjeztUxyzuQpvD82xOTTH21ieGu/TlBUgI97mi+tZNYtdcQrnZ/Ioz6oOAUpO7/b/D0KAppiJWYuYHC4+xTgtzlDaJ0k1JIAZfQq+ssdGWLXxc3T76U7mY8EDJbGGUgTGNf9HYVPyRwkb458fInKUtdYXSY+PbEAdPXkueSq4a3s8z6cqhNLrIs49meEsWGr46/v+f8tfxzB4SaNU2FDwrsX3r3Y07u7LfIkyQGVfR5mCVthRXj/HB0fk8HQOSkcKy0iaKxwRVi/tWIZ4vC8arQ/3otEYBHr0dX71aAgdr2SPung0/GoaCOm9iTqsfw5pa/7B1SRdTkBxtZLEaeTEmax3v5mK9HqDzSvSCQPnzORAQwwcHerIN0971F0SRV2aj3fQnOsok5pd0rVTZUYY1k52ZjLLqeuRYXI43SbUgbDCMxRTYER1M73bL"
+    "+Nlc2GgUOBSCsSFfDEzQZZ4RJs5aPUY/HVZQBkVRqNGXFloNKGMuSK5KZa1kw2oU/k2yeXSlucmwCN0neSaVrtba+krjZvZ1RwB3qLUNng4mXWYeEzy+B5Pnov0xPkutEwh55FyvH7GFACEHs5jCQQxx81smsXBSEnu+SGOPE4kYuCrWOygh6YgHdZomCVq8CSP2UXnY1GaayQzaa4BjLsIwDDv9fpYbjRpDDD2GkVj7UeamqbEt1wDHQRj5KlbfAoHUpfL72PHYpfqz0rcIJ832MECGJnudFgmUm9e60vL9g7VJxRRdzmikdJuEoPglSbfZnyCoYugjgLxYmPzGHr1SkZLWg4QzIMCwFrnjyjBfv9DS1BexsuTvUkJB/xKJZCBRlJET7USgtYxrR+Cd+36sBtQQXztnDl6IrB+xjcAvg5b0dETtAAVkksdkW28p01WlXJUtPfL9NT+Ip89RZnXgKQTWB2cHgcmHYtmjZLxP3bmS0X+ToZJDmGvPmqOoUVN5hRRQV0sp5mujbCcx9dL4+qwgknjjFBhJvg/CqS5KT5TPYFmhAKFLFdPoFH2dYj94BpNVylKF20+SYL9NuoEJYX/IW8ivuIZSB90ynPSZ9yzZY921U71/hH/dDNWlxtnLFNhIWNV5YkDfshc3hcrGcuT+Ncb/96XZj+NncjF/LbivC885AWOih35KXGjg8S1IxWjKU4ciaqucDhxDG5t8/rM2cLI9ODVoQa2ytQwXGfSKd6sozXUgMd7ETWQ6IYeTCoJjHKOOQgh6+hTPM0Or/mcPo7AEJhS5ohQGlk88OnlcUoweeTRaZw/ksBb8F+rQlQgRtjlGCzGL2bVjMBgJA0QaRz2GPzympQ0MxHrADNt5+y6i04oYWYQ4cJw1m1IQJKAmkU1PDBAb/Rr6O0ND4E0/g+2JensZz8lQNGipLqqRYPEh1sxJyv5zosxTd2dMgCYWkIvXIH5oy/co5O1qq1WqNgsTmRXseP44uGux7J4nWqhWghzYlyPdO50RLxqmJBNrj/+x7b62WENB1WcBlScIEe5I9JSbe4Y0lOUO+Zr6SkOvpQ6jkxRpeoygzGjlg0OjMYEsVpnazRDNQvQjytGYwKvipZGFGY0aiqNPItdM42u3cayr/oCRVsbeaZSBcEtAKpIBa12D01Yj9n0wV4lucmQ2KJyrDP7r2OG2igYdxB41qO12OfXOKcFS5HQGrbRlyzKnCNSA5nWkS+ak/lYHUZshicdVfUXnRJU1V/0AWmEGoxOyIqyUP3Z0nToOqy2CoPtPeWKwWtrap18To65xiEi2x6vcdzaGodi+PHIc0gsLBZr65wRWGy0GgfxNUcvxhisXmHDmTSZiM7LKtgsXtzETmYoOThFbVOb1lcd0hDe72cXW7k9fma0EU8ZRiaZ3fjTkjCzj0SIEVtFcQPkRl7zGS5i1lF0mFOgU6xTD9NPVcnFdlrBbrRbsOPKKmarEGZkjhlNmOqKxhR0VNk+h5ewfov0W3ep60fUbYzI6hSPXEz3VG/W5A/0Cxo6KR51+ah2q9psYXQfa2k5MUVZq2Hql6ygVVnn4m9sWlWiCX8Ko4/UL3FFtz6l05dFjniDf3JER3eAb2/wzyfo8jK+j82OlvLXW4YPlD94zxp8f1rb6qal08oXLSuPl+VxsvzZV7962F7d9GJ5TnDGBcESGSyWwScP+kGX3VJ+FYccP5OHDCwrL5Tl82T5WRyyhoY8eEHwTRmskMEGPeQpHJFN/kEPGR6/rLxGlu+Qw03RkL0XBC/JYLcM/qSHDP76jOOvt3U0N2yYqtIf+UW6Obip+bf3PfvAvccOpNM7x+18sP/BYO4r6fEdzU0qPTEr5mREEn/leZV4zLItt+IXlkRHgKD5jh785Z75flnnl3sAVV6hY2uTRlT+1d44LzfGz58GLgkL63/6HDebcYlAk1CrztfPUoHa+PVTJ/xcJ5lP98wxu5yRvn7Ssz2u7qdPkkkfH1d/9mSkx"
+    "NPsG+p+96wfq5zwh0fH4/4DlsG8lgAAAAAAAQAAAADMPaLPAAAAANBnMXoAAAAA0qXvE3icY2BkYGDgA2IJBgUgycTACIQyQMwC5jEwMEIwAAugAHEAAHicY2BmdmOcwMDKwMFqzDqLgYFRHkIzX2dIYRJgYGBlY0ACAkjsgDTXFAaHhxeeBrGl/UtjnMXJzbQEKMwIV6AAhIwAJYMMEnicY2BgYGaAYBkGRgYQ8AHyGMF8FgYDIM0BhEwgiYcvngb9/w9mXXgaAGLJGUqdguoCA0Y2BmTuiAQAaRIL9AB4nGNgZGBgAGKmXY/k4/ltvjJwczCAwKWl7/tg9P/mf4tYbYVMgVwOBiaQKABdIg0PAAAAeJxjYGRgYEv7l8Y4i9Xuf/P/ZlZbBqAICpAFAJcMBhR4nGNKYGBgtWNgYHFgYGBew8DAtBuI9YF4FRArAMVzoHQ3lG5E0Mwzkfhz0NRBacaFDLXMGUD6wf9mZrb/zSx+/5sBx+oQdwAAAFAAAB0AAHicjZA9CsJAEIXfxqiIYJlCm+20SdgNQsDGzlpE7C2WEJAsxB+8hhfxAB7DA3gMa1/MCBYWBjL7ze6Xt0MADHCFwucJhBX6GAkH6CITbmGCi3BI5y7cJj+FO+irIU0V9iS1YYWI1HDAe8fCLSwxFw7p3ITb5IdwB5EK6qgNHCp4nFCwrtmdceC2q/yp8Gt3ZrPibo4jdtjSxcrlx92WsOAXJe16rWg4aKRIYLjO+P7Obs4sf0HMalhTVospA315WPgqdzpNjJ7prynY2Sy2Jk6Nnf43duPs30b5vrIerXb2hS+1TcxfOS+eY0a4eJxjYGYAg//pDGkMWAAAKgQB0AA=\n"
+    ") format('woff');\n"
+    "    font-weight: normal;\n"
+    "    font-style: normal;\n"
+    "}\n"
+    "</style>\n";
+
+//----------------------------------------------------------------------------
+// Fonts
+//----------------------------------------------------------------------------
+
+#define BUILTIN_FONT_COUNT 3
+
+static const BuiltInFont builtInFonts[BUILTIN_FONT_COUNT] = {
+    { "Bravura", glyphsBravura, 197 },
+    { "Leipzig", glyphsLeipzig, 197 },
+    { "Gootville", glyphsGootville, 156 },
+};
+
+static const BuiltInFont builtInTextFont = { "Times", glyphsText, 184 };
+
+//----------------------------------------------------------------------------
+// Access to the built-in resources
+//----------------------------------------------------------------------------
+
+const BuiltInFont *GetBuiltInFont(const std::string &fontName)
+{
+    for (int i = 0; i < BUILTIN_FONT_COUNT; ++i) {
+        if (fontName == builtInFonts[i].m_name) return &builtInFonts[i];
+    }
+    return NULL;
+}
+
+const BuiltInFont *GetBuiltInTextFont()
+{
+    return &builtInTextFont;
+}
+
+const char *GetBuiltInWoff()
+{
+    return builtInWoff;
+}
+
+} // namespace vrv
@@ -183,7 +183,7 @@ void Chord::ResetAccidList()
     m_accidList.clear();
     ListOfObjects *childList = this->GetList(this); // make sure it's initialized
     for (ListOfObjects::reverse_iterator it = childList->rbegin(); it != childList->rend(); it++) {
-        Note *note = dynamic_cast<Note *>(*it);
+        Note *note = vrv_cast<Note *>(*it);
         assert(note);
         if (note->m_drawingAccid != NULL) {
             m_accidList.push_back(note);
@@ -283,7 +283,7 @@ void Chord::SetDrawingStemDir(data_STEMDIRECTION stemDir)
     ListOfObjects *childList = this->GetList(this); // make sure it's initialized
     for (ListOfObjects::iterator it = childList->begin(); it != childList->end(); it++) {
         if ((*it)->Is() != NOTE) continue;
-        Note *note = dynamic_cast<Note *>(*it);
+        Note *note = vrv_cast<Note *>(*it);
         assert(note);
         note->SetDrawingStemDir(stemDir);
     }
@@ -295,7 +295,7 @@ void Chord::SetDrawingStemStart(Point stemStart)
     ListOfObjects *childList = this->GetList(this); // make sure it's initialized
     for (ListOfObjects::iterator it = childList->begin(); it != childList->end(); it++) {
         if ((*it)->Is() != NOTE) continue;
-        Note *note = dynamic_cast<Note *>(*it);
+        Note *note = vrv_cast<Note *>(*it);
         assert(note);
         note->SetDrawingStemStart(stemStart);
     }
@@ -307,7 +307,7 @@ void Chord::SetDrawingStemEnd(Point stemEnd)
     ListOfObjects *childList = this->GetList(this); // make sure it's initialized
     for (ListOfObjects::iterator it = childList->begin(); it != childList->end(); it++) {
         if ((*it)->Is() != NOTE) continue;
-        Note *note = dynamic_cast<Note *>(*it);
+        Note *note = vrv_cast<Note *>(*it);
         assert(note);
         note->SetDrawingStemEnd(stemEnd);
     }
@@ -319,7 +319,7 @@ void Chord::SetDrawingStemEnd(Point stemEnd)
 
 int Chord::PrepareTieAttr(FunctorParams *functorParams)
 {
-    PrepareTieAttrParams *params = dynamic_cast<PrepareTieAttrParams *>(functorParams);
+    PrepareTieAttrParams *params = vrv_cast<PrepareTieAttrParams *>(functorParams);
     assert(params);
 
     assert(!params->m_currentChord);
@@ -330,7 +330,7 @@ int Chord::PrepareTieAttr(FunctorParams *functorParams)
 
 int Chord::PrepareTieAttrEnd(FunctorParams *functorParams)
 {
-    PrepareTieAttrParams *params = dynamic_cast<PrepareTieAttrParams *>(functorParams);
+    PrepareTieAttrParams *params = vrv_cast<PrepareTieAttrParams *>(functorParams);
     assert(params);
 
     assert(params->m_currentChord);
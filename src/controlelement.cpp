@@ -24,7 +24,7 @@ ControlElement::ControlElement() : FloatingObject("me")
     Reset();
 }
 
-ControlElement::ControlElement(std::string classid) : FloatingObject(classid)
+ControlElement::ControlElement(const char *classid) : FloatingObject(classid)
 {
     Reset();
 }
@@ -110,6 +110,13 @@ void DeviceContext::ReactivateGraphic()
     m_isDeactivatedX = false;
 }
 
+void DeviceContext::DrawLines(int n, Point points[])
+{
+    for (int i = 0; i < n; ++i) {
+        DrawLine(points[2 * i].x, points[2 * i].y, points[2 * i + 1].x, points[2 * i + 1].y);
+    }
+}
+
 void DeviceContext::GetTextExtent(const std::string &string, TextExtend *extend)
 {
     std::wstring wtext(string.begin(), string.end());
@@ -125,13 +132,14 @@ void DeviceContext::GetTextExtent(const std::wstring &string, TextExtend *extend
     extend->m_width = 0;
     extend->m_height = 0;
 
-    Glyph *unkown = Resources::GetTextGlyph(L'o');
+    const Resources *resources = this->GetResources();
+    const Glyph *unkown = resources->GetTextGlyph(L'o');
 
     for (unsigned int i = 0; i < string.length(); i++) {
         wchar_t c = string[i];
-        Glyph *glyph = Resources::GetTextGlyph(c);
+        const Glyph *glyph = resources->GetTextGlyph(c);
         if (!glyph) {
-            glyph = Resources::GetGlyph(c);
+            glyph = resources->GetGlyph(c);
         }
         if (!glyph) {
             glyph = unkown;
@@ -169,7 +177,7 @@ void DeviceContext::GetSmuflTextExtent(const std::wstring &string, int *w, int *
 
     for (unsigned int i = 0; i < string.length(); i++) {
         wchar_t c = string[i];
-        Glyph *glyph = Resources::GetGlyph(c);
+        const Glyph *glyph = this->GetResources()->GetGlyph(c);
         if (!glyph) {
             continue;
         }
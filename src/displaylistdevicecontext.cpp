@@ -0,0 +1,696 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        displaylistdevicecontext.cpp
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "displaylistdevicecontext.h"
+
+//----------------------------------------------------------------------------
+
+#include <assert.h>
+
+//----------------------------------------------------------------------------
+
+#include "object.h"
+#include "vrv.h"
+
+namespace vrv {
+
+static const std::string s_empty = "";
+
+static bool IsSamePen(const Pen &pen1, const Pen &pen2)
+{
+    return ((pen1.m_penColour == pen2.m_penColour) && (pen1.m_penWidth == pen2.m_penWidth)
+        && (pen1.m_dashLength == pen2.m_dashLength) && (pen1.m_penOpacity == pen2.m_penOpacity));
+}
+
+static bool IsSameBrush(const Brush &brush1, const Brush &brush2)
+{
+    return ((brush1.m_brushColour == brush2.m_brushColour) && (brush1.m_brushOpacity == brush2.m_brushOpacity));
+}
+
+static bool IsSameFont(const FontInfo &font1, const FontInfo &font2)
+{
+    return ((font1.pointSize == font2.pointSize) && (font1.family == font2.family) && (font1.style == font2.style)
+        && (font1.weight == font2.weight) && (font1.underlined == font2.underlined)
+        && (font1.faceName == font2.faceName) && (font1.encoding == font2.encoding));
+}
+
+/**
+ * The View draws copies of the scoreDef (and of the staffDefs) that are deleted once the page is drawn
+ */
+static bool IsDrawingCopy(Object *object)
+{
+    switch (object->Is()) {
+        case SCOREDEF:
+        case STAFFGRP:
+        case STAFFDEF:
+        case CLEF:
+        case KEYSIG:
+        case MENSUR:
+        case METERSIG:
+        case PROPORT: break;
+        default: return false;
+    }
+    return (object->GetFirstParent(DOC) == NULL);
+}
+
+//----------------------------------------------------------------------------
+// DisplayListDeviceContext
+//----------------------------------------------------------------------------
+
+DisplayListDeviceContext::DisplayListDeviceContext() : DeviceContext()
+{
+    m_pen = -1;
+    m_brush = -1;
+    m_font = -1;
+    m_deactivation = 0;
+}
+
+DisplayListDeviceContext::~DisplayListDeviceContext()
+{
+    std::vector<Object *>::iterator iter;
+    for (iter = m_copies.begin(); iter != m_copies.end(); ++iter) {
+        delete *iter;
+    }
+}
+
+size_t DisplayListDeviceContext::GetMemoryUsage() const
+{
+    size_t size = sizeof(DisplayListDeviceContext);
+    size += m_ints.capacity() * sizeof(int) + m_doubles.capacity() * sizeof(double);
+    size += (m_objects.capacity() + m_views.capacity() + m_images.capacity()) * sizeof(void *);
+    size += m_pens.capacity() * sizeof(Pen) + m_brushes.capacity() * sizeof(Brush);
+    size += m_fonts.capacity() * sizeof(FontInfo);
+    std::vector<std::string>::const_iterator iter;
+    for (iter = m_strings.begin(); iter != m_strings.end(); ++iter) {
+        size += sizeof(std::string) + iter->capacity();
+    }
+    std::vector<std::wstring>::const_iterator witer;
+    for (witer = m_wstrings.begin(); witer != m_wstrings.end(); ++witer) {
+        size += sizeof(std::wstring) + witer->capacity() * sizeof(wchar_t);
+    }
+    return size;
+}
+
+void DisplayListDeviceContext::AddCommand(Command command)
+{
+    // The pen, the brush and the font are looked for in the tables because a few of them are used in alternation
+    int pen = -1;
+    if (!m_penStack.empty()) {
+        for (pen = 0; pen < (int)m_pens.size(); ++pen) {
+            if (IsSamePen(m_pens.at(pen), m_penStack.top())) break;
+        }
+        if (pen == (int)m_pens.size()) m_pens.push_back(m_penStack.top());
+    }
+    if (pen != m_pen) {
+        AddInts(CMD_PEN, pen);
+        m_pen = pen;
+    }
+
+    int brush = -1;
+    if (!m_brushStack.empty()) {
+        for (brush = 0; brush < (int)m_brushes.size(); ++brush) {
+            if (IsSameBrush(m_brushes.at(brush), m_brushStack.top())) break;
+        }
+        if (brush == (int)m_brushes.size()) m_brushes.push_back(m_brushStack.top());
+    }
+    if (brush != m_brush) {
+        AddInts(CMD_BRUSH, brush);
+        m_brush = brush;
+    }
+
+    int font = -1;
+    if (!m_fontStack.empty()) {
+        assert(m_fontStack.top());
+        for (font = 0; font < (int)m_fonts.size(); ++font) {
+            if (IsSameFont(m_fonts.at(font), *m_fontStack.top())) break;
+        }
+        if (font == (int)m_fonts.size()) m_fonts.push_back(*m_fontStack.top());
+    }
+    if (font != m_font) {
+        AddInts(CMD_FONT, font);
+        m_font = font;
+    }
+
+    int deactivation = (m_isDeactivatedX ? 1 : 0) | (m_isDeactivatedY ? 2 : 0);
+    if (deactivation != m_deactivation) {
+        AddInts(CMD_DEACTIVATION, deactivation);
+        m_deactivation = deactivation;
+    }
+
+    m_ints.push_back(command);
+}
+
+void DisplayListDeviceContext::AddInts(int a, int b)
+{
+    m_ints.push_back(a);
+    m_ints.push_back(b);
+}
+
+void DisplayListDeviceContext::AddInts(int a, int b, int c, int d)
+{
+    AddInts(a, b);
+    AddInts(c, d);
+}
+
+void DisplayListDeviceContext::AddPoints(int n, Point points[])
+{
+    m_ints.push_back(n);
+    for (int i = 0; i < n; ++i) {
+        AddInts(points[i].x, points[i].y);
+    }
+}
+
+void DisplayListDeviceContext::AddDouble(double d)
+{
+    m_doubles.push_back(d);
+}
+
+void DisplayListDeviceContext::AddString(const std::string &string)
+{
+    m_strings.push_back(string);
+}
+
+void DisplayListDeviceContext::AddWString(const std::wstring &wstring)
+{
+    m_wstrings.push_back(wstring);
+}
+
+void DisplayListDeviceContext::AddObject(Object *object, bool start)
+{
+    Object *recorded = object;
+    if (start) {
+        if (IsDrawingCopy(object)) recorded = GetCopy(object);
+        m_graphics.push_back(std::make_pair(object, recorded));
+    }
+    // The graphics are ended with the object they were started with
+    else if (!m_graphics.empty() && (m_graphics.back().first == object)) {
+        recorded = m_graphics.back().second;
+        m_graphics.pop_back();
+    }
+    m_objects.push_back(recorded);
+}
+
+Object *DisplayListDeviceContext::GetCopy(Object *object)
+{
+    // The object can be in the copy of a graphic in which it is drawn (e.g., a staffDef in a scoreDef)
+    std::vector<std::pair<Object *, Object *> >::reverse_iterator iter;
+    for (iter = m_graphics.rbegin(); iter != m_graphics.rend(); ++iter) {
+        if (iter->first == iter->second) continue;
+        Object *copy = iter->second->FindChildByUuid(object->GetUuid());
+        if (copy) return copy;
+    }
+
+    Object *copy = object->Clone();
+    m_copies.push_back(copy);
+    return copy;
+}
+
+void DisplayListDeviceContext::AddGraphicStrings(const std::string &gClass, const std::string &gId)
+{
+    // The class is usually empty and the id the one of the object, in which case they are not stored
+    int stored = 0;
+    if (!gClass.empty()) {
+        AddString(gClass);
+        stored |= GRAPHIC_CLASS;
+    }
+    if (gId != m_objects.back()->GetUuid()) {
+        AddString(gId);
+        stored |= GRAPHIC_ID;
+    }
+    m_ints.push_back(stored);
+}
+
+void DisplayListDeviceContext::AddView(View *view)
+{
+    m_views.push_back(view);
+}
+
+const std::string &DisplayListDeviceContext::GetGraphicString(
+    int stored, int flag, size_t &stringPos, const std::string &notStored) const
+{
+    if (stored & flag) return m_strings[stringPos++];
+    return notStored;
+}
+
+Point *DisplayListDeviceContext::GetPoints(int n, size_t &pos)
+{
+    if ((int)m_points.size() < n) m_points.resize(n);
+    for (int i = 0; i < n; ++i) {
+        m_points[i].x = m_ints[pos++];
+        m_points[i].y = m_ints[pos++];
+    }
+    return m_points.data();
+}
+
+void DisplayListDeviceContext::Replay(DeviceContext *dc)
+{
+    assert(dc);
+
+    dc->SetResources(this->GetResources());
+
+    // The state set in the device context
+    int pen = -1;
+    int brush = -1;
+    int font = -1;
+    int deactivation = 0;
+
+    // The position in each table
+    size_t pos = 0;
+    size_t doublePos = 0;
+    size_t stringPos = 0;
+    size_t wstringPos = 0;
+    size_t objectPos = 0;
+    size_t viewPos = 0;
+    size_t imagePos = 0;
+
+    int n, x, y, w, h;
+    Point *points;
+    Point bezier[4];
+    Point origin;
+    Object *object;
+    const std::string *gClass, *gId;
+    while (pos < m_ints.size()) {
+        switch (m_ints[pos++]) {
+            case CMD_PEN:
+                if (pen != -1) dc->ResetPen();
+                pen = m_ints[pos++];
+                if (pen != -1) {
+                    const Pen &current = m_pens.at(pen);
+                    dc->SetPen(current.GetColour(), current.GetWidth(),
+                        (current.GetOpacity() > 0.0) ? AxSOLID : AxTRANSPARENT, current.GetDashLenght());
+                }
+                break;
+            case CMD_BRUSH:
+                if (brush != -1) dc->ResetBrush();
+                brush = m_ints[pos++];
+                if (brush != -1) {
+                    const Brush &current = m_brushes.at(brush);
+                    dc->SetBrush(current.GetColour(), (current.GetOpacity() > 0.0) ? AxSOLID : AxTRANSPARENT);
+                }
+                break;
+            case CMD_FONT:
+                if (font != -1) dc->ResetFont();
+                font = m_ints[pos++];
+                if (font != -1) dc->SetFont(&m_fonts.at(font));
+                break;
+            case CMD_DEACTIVATION:
+                if (deactivation) dc->ReactivateGraphic();
+                deactivation = m_ints[pos++];
+                if (deactivation == 3)
+                    dc->DeactivateGraphic();
+                else if (deactivation == 1)
+                    dc->DeactivateGraphicX();
+                else if (deactivation == 2)
+                    dc->DeactivateGraphicY();
+                break;
+            case CMD_BACKGROUND:
+                x = m_ints[pos++];
+                dc->SetBackground(x, m_ints[pos++]);
+                break;
+            case CMD_BACKGROUND_IMAGE: dc->SetBackgroundImage(m_images[imagePos++], m_doubles[doublePos++]); break;
+            case CMD_BACKGROUND_MODE: dc->SetBackgroundMode(m_ints[pos++]); break;
+            case CMD_TEXT_FOREGROUND: dc->SetTextForeground(m_ints[pos++]); break;
+            case CMD_TEXT_BACKGROUND: dc->SetTextBackground(m_ints[pos++]); break;
+            case CMD_LOGICAL_ORIGIN:
+                origin = dc->GetLogicalOrigin();
+                x = m_ints[pos++];
+                y = m_ints[pos++];
+                dc->SetLogicalOrigin(origin.x + x, origin.y + y);
+                break;
+            case CMD_COMPLEX_BEZIER_PATH:
+                n = m_ints[pos++];
+                assert(n == 4);
+                points = GetPoints(4, pos);
+                std::copy(points, points + 4, bezier);
+                n = m_ints[pos++];
+                assert(n == 4);
+                dc->DrawComplexBezierPath(bezier, GetPoints(4, pos));
+                break;
+            case CMD_CIRCLE:
+                x = m_ints[pos++];
+                y = m_ints[pos++];
+                dc->DrawCircle(x, y, m_ints[pos++]);
+                break;
+            case CMD_ELLIPSE:
+                x = m_ints[pos++];
+                y = m_ints[pos++];
+                w = m_ints[pos++];
+                dc->DrawEllipse(x, y, w, m_ints[pos++]);
+                break;
+            case CMD_ELLIPTIC_ARC:
+                x = m_ints[pos++];
+                y = m_ints[pos++];
+                w = m_ints[pos++];
+                h = m_ints[pos++];
+                dc->DrawEllipticArc(x, y, w, h, m_doubles[doublePos], m_doubles[doublePos + 1]);
+                doublePos += 2;
+                break;
+            case CMD_LINE:
+                x = m_ints[pos++];
+                y = m_ints[pos++];
+                w = m_ints[pos++];
+                dc->DrawLine(x, y, w, m_ints[pos++]);
+                break;
+            case CMD_LINES:
+                n = m_ints[pos++];
+                dc->DrawLines(n / 2, GetPoints(n, pos));
+                break;
+            case CMD_POLYGON:
+                n = m_ints[pos++];
+                points = GetPoints(n, pos);
+                x = m_ints[pos++];
+                y = m_ints[pos++];
+                dc->DrawPolygon(n, points, x, y, m_ints[pos++]);
+                break;
+            case CMD_RECTANGLE:
+                x = m_ints[pos++];
+                y = m_ints[pos++];
+                w = m_ints[pos++];
+                dc->DrawRectangle(x, y, w, m_ints[pos++]);
+                break;
+            case CMD_ROTATED_TEXT:
+                x = m_ints[pos++];
+                y = m_ints[pos++];
+                dc->DrawRotatedText(m_strings[stringPos++], x, y, m_doubles[doublePos++]);
+                break;
+            case CMD_ROUNDED_RECTANGLE:
+                x = m_ints[pos++];
+                y = m_ints[pos++];
+                w = m_ints[pos++];
+                h = m_ints[pos++];
+                dc->DrawRoundedRectangle(x, y, w, h, m_doubles[doublePos++]);
+                break;
+            case CMD_TEXT:
+                dc->DrawText(m_strings[stringPos], m_wstrings[wstringPos]);
+                stringPos++;
+                wstringPos++;
+                break;
+            case CMD_MUSIC_TEXT:
+                x = m_ints[pos++];
+                y = m_ints[pos++];
+                dc->DrawMusicText(m_wstrings[wstringPos++], x, y);
+                break;
+            case CMD_SPLINE:
+                n = m_ints[pos++];
+                dc->DrawSpline(n, GetPoints(n, pos));
+                break;
+            case CMD_BACKGROUND_IMAGE_DRAW:
+                x = m_ints[pos++];
+                dc->DrawBackgroundImage(x, m_ints[pos++]);
+                break;
+            case CMD_PLACEHOLDER:
+                x = m_ints[pos++];
+                dc->DrawPlaceholder(x, m_ints[pos++]);
+                break;
+            case CMD_START_TEXT:
+                x = m_ints[pos++];
+                y = m_ints[pos++];
+                dc->StartText(x, y, (char)m_ints[pos++]);
+                break;
+            case CMD_END_TEXT: dc->EndText(); break;
+            case CMD_MOVE_TEXT_TO:
+                x = m_ints[pos++];
+                dc->MoveTextTo(x, m_ints[pos++]);
+                break;
+            case CMD_START_GRAPHIC:
+                object = m_objects[objectPos++];
+                gClass = &GetGraphicString(m_ints[pos], GRAPHIC_CLASS, stringPos, s_empty);
+                gId = &GetGraphicString(m_ints[pos++], GRAPHIC_ID, stringPos, object->GetUuid());
+                dc->StartGraphic(object, *gClass, *gId);
+                break;
+            case CMD_END_GRAPHIC:
+                dc->EndGraphic(m_objects[objectPos], m_views[viewPos++]);
+                objectPos++;
+                break;
+            case CMD_RESUME_GRAPHIC:
+                object = m_objects[objectPos++];
+                gId = &GetGraphicString(m_ints[pos++], GRAPHIC_ID, stringPos, object->GetUuid());
+                dc->ResumeGraphic(object, *gId);
+                break;
+            case CMD_END_RESUMED_GRAPHIC:
+                dc->EndResumedGraphic(m_objects[objectPos], m_views[viewPos++]);
+                objectPos++;
+                break;
+            case CMD_START_TEXT_GRAPHIC:
+                object = m_objects[objectPos++];
+                gClass = &GetGraphicString(m_ints[pos], GRAPHIC_CLASS, stringPos, s_empty);
+                gId = &GetGraphicString(m_ints[pos++], GRAPHIC_ID, stringPos, object->GetUuid());
+                dc->StartTextGraphic(object, *gClass, *gId);
+                break;
+            case CMD_END_TEXT_GRAPHIC:
+                dc->EndTextGraphic(m_objects[objectPos], m_views[viewPos++]);
+                objectPos++;
+                break;
+            case CMD_START_PAGE: dc->StartPage(); break;
+            case CMD_END_PAGE: dc->EndPage(); break;
+            default: LogError("Unknown command in the display list"); assert(false);
+        }
+    }
+
+    // Leave the state of the device context as it was
+    if (pen != -1) dc->ResetPen();
+    if (brush != -1) dc->ResetBrush();
+    if (font != -1) dc->ResetFont();
+    if (deactivation) dc->ReactivateGraphic();
+}
+
+//----------------------------------------------------------------------------
+// Setters
+//----------------------------------------------------------------------------
+
+void DisplayListDeviceContext::SetBackground(int colour, int style)
+{
+    AddCommand(CMD_BACKGROUND);
+    AddInts(colour, style);
+}
+
+void DisplayListDeviceContext::SetBackgroundImage(void *image, double opacity)
+{
+    AddCommand(CMD_BACKGROUND_IMAGE);
+    m_images.push_back(image);
+    AddDouble(opacity);
+}
+
+void DisplayListDeviceContext::SetBackgroundMode(int mode)
+{
+    AddCommand(CMD_BACKGROUND_MODE);
+    m_ints.push_back(mode);
+}
+
+void DisplayListDeviceContext::SetTextForeground(int colour)
+{
+    AddCommand(CMD_TEXT_FOREGROUND);
+    m_ints.push_back(colour);
+}
+
+void DisplayListDeviceContext::SetTextBackground(int colour)
+{
+    AddCommand(CMD_TEXT_BACKGROUND);
+    m_ints.push_back(colour);
+}
+
+void DisplayListDeviceContext::SetLogicalOrigin(int x, int y)
+{
+    // Recorded as a change of the origin because the one of the device context replayed to is not known
+    AddCommand(CMD_LOGICAL_ORIGIN);
+    AddInts(x - m_origin.x, y - m_origin.y);
+    m_origin = Point(x, y);
+}
+
+Point DisplayListDeviceContext::GetLogicalOrigin()
+{
+    return m_origin;
+}
+
+//----------------------------------------------------------------------------
+// Drawing methods
+//----------------------------------------------------------------------------
+
+void DisplayListDeviceContext::DrawComplexBezierPath(Point bezier1[4], Point bezier2[4])
+{
+    AddCommand(CMD_COMPLEX_BEZIER_PATH);
+    AddPoints(4, bezier1);
+    AddPoints(4, bezier2);
+}
+
+void DisplayListDeviceContext::DrawCircle(int x, int y, int radius)
+{
+    AddCommand(CMD_CIRCLE);
+    AddInts(x, y);
+    m_ints.push_back(radius);
+}
+
+void DisplayListDeviceContext::DrawEllipse(int x, int y, int width, int height)
+{
+    AddCommand(CMD_ELLIPSE);
+    AddInts(x, y, width, height);
+}
+
+void DisplayListDeviceContext::DrawEllipticArc(int x, int y, int width, int height, double start, double end)
+{
+    AddCommand(CMD_ELLIPTIC_ARC);
+    AddInts(x, y, width, height);
+    AddDouble(start);
+    AddDouble(end);
+}
+
+void DisplayListDeviceContext::DrawLine(int x1, int y1, int x2, int y2)
+{
+    AddCommand(CMD_LINE);
+    AddInts(x1, y1, x2, y2);
+}
+
+void DisplayListDeviceContext::DrawLines(int n, Point points[])
+{
+    AddCommand(CMD_LINES);
+    AddPoints(2 * n, points);
+}
+
+void DisplayListDeviceContext::DrawPolygon(int n, Point points[], int xoffset, int yoffset, int fill_style)
+{
+    AddCommand(CMD_POLYGON);
+    AddPoints(n, points);
+    AddInts(xoffset, yoffset);
+    m_ints.push_back(fill_style);
+}
+
+void DisplayListDeviceContext::DrawRectangle(int x, int y, int width, int height)
+{
+    AddCommand(CMD_RECTANGLE);
+    AddInts(x, y, width, height);
+}
+
+void DisplayListDeviceContext::DrawRotatedText(const std::string &text, int x, int y, double angle)
+{
+    AddCommand(CMD_ROTATED_TEXT);
+    AddInts(x, y);
+    AddString(text);
+    AddDouble(angle);
+}
+
+void DisplayListDeviceContext::DrawRoundedRectangle(int x, int y, int width, int height, double radius)
+{
+    AddCommand(CMD_ROUNDED_RECTANGLE);
+    AddInts(x, y, width, height);
+    AddDouble(radius);
+}
+
+void DisplayListDeviceContext::DrawText(const std::string &text, const std::wstring wtext)
+{
+    AddCommand(CMD_TEXT);
+    AddString(text);
+    AddWString(wtext);
+}
+
+void DisplayListDeviceContext::DrawMusicText(const std::wstring &text, int x, int y)
+{
+    AddCommand(CMD_MUSIC_TEXT);
+    AddInts(x, y);
+    AddWString(text);
+}
+
+void DisplayListDeviceContext::DrawSpline(int n, Point points[])
+{
+    AddCommand(CMD_SPLINE);
+    AddPoints(n, points);
+}
+
+void DisplayListDeviceContext::DrawBackgroundImage(int x, int y)
+{
+    AddCommand(CMD_BACKGROUND_IMAGE_DRAW);
+    AddInts(x, y);
+}
+
+void DisplayListDeviceContext::DrawPlaceholder(int x, int y)
+{
+    AddCommand(CMD_PLACEHOLDER);
+    AddInts(x, y);
+}
+
+//----------------------------------------------------------------------------
+// Text and graphic methods
+//----------------------------------------------------------------------------
+
+void DisplayListDeviceContext::StartText(int x, int y, char alignement)
+{
+    AddCommand(CMD_START_TEXT);
+    AddInts(x, y);
+    m_ints.push_back(alignement);
+}
+
+void DisplayListDeviceContext::EndText()
+{
+    AddCommand(CMD_END_TEXT);
+}
+
+void DisplayListDeviceContext::MoveTextTo(int x, int y)
+{
+    AddCommand(CMD_MOVE_TEXT_TO);
+    AddInts(x, y);
+}
+
+void DisplayListDeviceContext::StartGraphic(Object *object, const std::string &gClass, const std::string &gId)
+{
+    AddCommand(CMD_START_GRAPHIC);
+    AddObject(object, true);
+    AddGraphicStrings(gClass, gId);
+}
+
+void DisplayListDeviceContext::EndGraphic(Object *object, View *view)
+{
+    AddCommand(CMD_END_GRAPHIC);
+    AddObject(object, false);
+    AddView(view);
+}
+
+void DisplayListDeviceContext::ResumeGraphic(Object *object, const std::string &gId)
+{
+    AddCommand(CMD_RESUME_GRAPHIC);
+    AddObject(object, true);
+    AddGraphicStrings("", gId);
+}
+
+void DisplayListDeviceContext::EndResumedGraphic(Object *object, View *view)
+{
+    AddCommand(CMD_END_RESUMED_GRAPHIC);
+    AddObject(object, false);
+    AddView(view);
+}
+
+void DisplayListDeviceContext::StartTextGraphic(Object *object, const std::string &gClass, const std::string &gId)
+{
+    AddCommand(CMD_START_TEXT_GRAPHIC);
+    AddObject(object, true);
+    AddGraphicStrings(gClass, gId);
+}
+
+void DisplayListDeviceContext::EndTextGraphic(Object *object, View *view)
+{
+    AddCommand(CMD_END_TEXT_GRAPHIC);
+    AddObject(object, false);
+    AddView(view);
+}
+
+void DisplayListDeviceContext::StartPage()
+{
+    AddCommand(CMD_START_PAGE);
+}
+
+void DisplayListDeviceContext::EndPage()
+{
+    AddCommand(CMD_END_PAGE);
+
+    // The page is complete and nothing else is expected to be recorded
+    m_ints.shrink_to_fit();
+    m_doubles.shrink_to_fit();
+    m_strings.shrink_to_fit();
+    m_wstrings.shrink_to_fit();
+    m_objects.shrink_to_fit();
+    m_views.shrink_to_fit();
+}
+
+} // namespace vrv
@@ -10,6 +10,7 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <ctime>
 #include <math.h>
 
 //----------------------------------------------------------------------------
@@ -17,6 +18,7 @@
 #include "attcomparison.h"
 #include "barline.h"
 #include "chord.h"
+#include "editorial.h"
 #include "functorparams.h"
 #include "glyph.h"
 #include "keysig.h"
@@ -53,11 +55,18 @@ Doc::Doc() : Object("doc-")
 
     // owned pointers need to be set to NULL;
     m_scoreBuffer = NULL;
+    m_arena = NULL;
+    m_uuidSeed = 0;
     Reset();
 }
 
 Doc::~Doc()
 {
+    if (m_arena) {
+        // The objects allocated in the arena have to be deleted before it is
+        Reset();
+        delete m_arena;
+    }
     delete m_style;
     if (m_scoreBuffer) {
         delete m_scoreBuffer;
@@ -68,6 +77,8 @@ void Doc::Reset()
 {
     Object::Reset();
 
+    this->SeedUuid(m_uuidSeed);
+
     m_type = Raw;
     m_pageWidth = -1;
     m_pageHeight = -1;
@@ -96,6 +107,12 @@ void Doc::Reset()
 
     m_drawingSmuflFontSize = 0;
     m_drawingLyricFontSize = 0;
+    m_scaledGlyphTables.clear();
+    m_scaledTextGlyphTables.clear();
+
+    // All the objects of the document have been deleted - but not the ones being loaded if the arena is active
+    if (m_arena && (ObjectArena::GetActive() != m_arena)) m_arena->Clear();
+    m_stringPool.Clear();
 }
 
 void Doc::SetType(DocType type)
@@ -104,6 +121,20 @@ void Doc::SetType(DocType type)
     m_type = type;
 }
 
+void Doc::SetUseArena(bool useArena)
+{
+    if (useArena == (m_arena != NULL)) return;
+
+    Reset();
+    if (useArena) {
+        m_arena = new ObjectArena();
+    }
+    else {
+        delete m_arena;
+        m_arena = NULL;
+    }
+}
+
 void Doc::AddChild(Object *child)
 {
     assert(!m_scoreBuffer); // Children cannot be added if a score buffer was created;
@@ -137,6 +168,96 @@ void Doc::Refresh()
     RefreshViews();
 }
 
+void Doc::SeedUuid(unsigned int seed)
+{
+    m_uuidSeed = seed;
+    if (seed == 0) {
+        // Combine the time with the document for documents seeded at the same time
+        m_uuidGenerator.seed((uint64_t)std::time(0) ^ (uint64_t)std::hash<const void *>()(this));
+    }
+    else {
+        m_uuidGenerator.seed(seed);
+    }
+}
+
+void Doc::AddToUuidIndex(Object *object, bool recursive)
+{
+    assert(object);
+
+    switch (object->Is()) {
+        case ALIGNMENT:
+        case GRACE_ALIGNER:
+        case MEASURE_ALIGNER:
+        case STAFF_ALIGNMENT:
+        case SYSTEM_ALIGNER:
+        case TIMESTAMP_ALIGNER:
+        case TIMESTAMP_ATTR: return;
+        default: break;
+    }
+
+    // Objects without uuid are added when it is generated
+    if (object->HasUuid()) m_uuidIndex.insert(std::make_pair(&object->GetUuid(), object));
+
+    if (!recursive) return;
+    int i;
+    for (i = 0; i < object->GetChildCount(); i++) {
+        // Skip relinquished children
+        if (object->GetChild(i)->m_parent != object) continue;
+        this->AddToUuidIndex(object->GetChild(i));
+    }
+}
+
+void Doc::RemoveFromUuidIndex(Object *object, bool recursive)
+{
+    assert(object);
+
+    if (object->HasUuid()) {
+        std::pair<MapOfUuidObjects::iterator, MapOfUuidObjects::iterator> range
+            = m_uuidIndex.equal_range(&object->GetUuid());
+        MapOfUuidObjects::iterator iter;
+        for (iter = range.first; iter != range.second; ++iter) {
+            if (iter->second == object) {
+                m_uuidIndex.erase(iter);
+                break;
+            }
+        }
+    }
+
+    if (!recursive) return;
+    int i;
+    for (i = 0; i < object->GetChildCount(); i++) {
+        // Skip relinquished children (they are not in the index anymore)
+        if (object->GetChild(i)->m_parent != object) continue;
+        this->RemoveFromUuidIndex(object->GetChild(i));
+    }
+}
+
+Object *Doc::FindInUuidIndex(const std::string &uuid, const Object *ancestor) const
+{
+    assert(ancestor);
+
+    std::pair<MapOfUuidObjects::const_iterator, MapOfUuidObjects::const_iterator> range
+        = m_uuidIndex.equal_range(&uuid);
+    MapOfUuidObjects::const_iterator iter;
+    for (iter = range.first; iter != range.second; ++iter) {
+        Object *object = iter->second;
+        // Check that the object is a descendant of the ancestor and that it is not within a hidden
+        // editorial element, as the Object::FindByUuid functor would do.
+        bool visible = true;
+        const Object *current = object;
+        while (current && (current != ancestor)) {
+            current = current->m_parent;
+            if (current && current->IsEditorialElement()) {
+                EditorialElement const *editorialElement = dynamic_cast<EditorialElement const *>(current);
+                assert(editorialElement);
+                if (editorialElement->m_visibility == Hidden) visible = false;
+            }
+        }
+        if (current && visible) return object;
+    }
+    return NULL;
+}
+
 void Doc::ExportMIDI(MidiFile *midiFile)
 {
     CalcMaxMeasureDurationParams calcMaxMeasureDurationParams;
@@ -151,16 +272,12 @@ void Doc::ExportMIDI(MidiFile *midiFile)
     // StaffN_LayerN_VerseN_t staffLayerVerseTree;
     // params.push_back(&staffLayerVerseTree);
 
-    // We first fill a tree of int with [staff/layer] and [staff/layer/verse] numbers (@n) to be process
+    // We first fill the Layer partitions for each staff/layer (@n) to be processed
     Functor prepareProcessingLists(&Object::PrepareProcessingLists);
     this->Process(&prepareProcessingLists, &prepareProcessingListsParams);
 
-    // The tree is used to process each staff/layer/verse separatly
-    // For this, we use a array of AttCommmonNComparison that looks for each object if it is of the type
-    // and with @n specified
-
-    IntTree_t::iterator staves;
-    IntTree_t::iterator layers;
+    // The partitions are used to process each staff/layer separately
+    MapOfLayerPartitions::iterator layers;
 
     // Set tempo
     if (m_scoreDef.HasMidiBpm()) {
@@ -171,36 +288,27 @@ void Doc::ExportMIDI(MidiFile *midiFile)
     // Process notes and chords, rests, spaces layer by layer
     // track 0 (included by default) is reserved for meta messages common to all tracks
     int midiTrack = 1;
-    std::vector<AttComparison *> filters;
-    for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
-         staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
+    for (layers = prepareProcessingListsParams.m_layerPartitions.begin();
+         layers != prepareProcessingListsParams.m_layerPartitions.end(); ++layers) {
 
         int transSemi = 0;
         // Get the transposition (semi-tone) value for the staff
-        if (StaffDef *staffDef = this->m_scoreDef.GetStaffDef(staves->first)) {
+        if (StaffDef *staffDef = this->m_scoreDef.GetStaffDef(layers->first.first)) {
             if (staffDef->HasTransSemi()) transSemi = staffDef->GetTransSemi();
         }
 
-        for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            midiFile->addTrack(1);
-            filters.clear();
-            // Create ad comparison object for each type / @n
-            AttCommonNComparison matchStaff(STAFF, staves->first);
-            AttCommonNComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
-
-            GenerateMIDIParams generateMIDIParams(midiFile);
-            generateMIDIParams.m_maxValues = calcMaxMeasureDurationParams.m_maxValues;
-            generateMIDIParams.m_transSemi = transSemi;
-            Functor generateMIDI(&Object::GenerateMIDI);
-            Functor generateMIDIEnd(&Object::GenerateMIDIEnd);
-
-            // LogDebug("Exporting track %d ----------------", midiTrack);
-            this->Process(&generateMIDI, &generateMIDIParams, &generateMIDIEnd, &filters);
-
-            midiTrack++;
-        }
+        midiFile->addTrack(1);
+
+        GenerateMIDIParams generateMIDIParams(midiFile);
+        generateMIDIParams.m_measureOnsets = calcMaxMeasureDurationParams.m_measureOnsets;
+        generateMIDIParams.m_transSemi = transSemi;
+        Functor generateMIDI(&Object::GenerateMIDI);
+        Functor generateMIDIEnd(&Object::GenerateMIDIEnd);
+
+        // LogDebug("Exporting track %d ----------------", midiTrack);
+        this->ProcessLayerPartition(&layers->second, &generateMIDI, &generateMIDIParams, &generateMIDIEnd);
+
+        midiTrack++;
     }
 
     m_midiExportDone = true;
@@ -209,35 +317,20 @@ void Doc::ExportMIDI(MidiFile *midiFile)
 void Doc::PrepareDrawing()
 {
     FunctorParams params;
+    FunctorGroup functorGroup;
 
+    // Reset the drawing values (if necessary) and then, in the same traversal, try to match all spanning
+    // elements (slur, tie, etc) and time pointing elements (tempo, fermata, etc) by looking up their @startid
+    // and @endid in the uuid index. Unmatched spanning elements remain in the list and we will try to match
+    // them with their timestamps
+    Functor resetDrawing(&Object::ResetDrawing);
     if (m_drawingPreparationDone) {
-        Functor resetDrawing(&Object::ResetDrawing);
-        this->Process(&resetDrawing, &params);
+        functorGroup.Add(&resetDrawing, &params);
     }
-
-    // Try to match all spanning elements (slur, tie, etc) by processing backwards
-    PrepareTimeSpanningParams prepareTimeSpanningParams;
+    PrepareTimeSpanningParams prepareTimeSpanningParams(this);
     Functor prepareTimeSpanning(&Object::PrepareTimeSpanning);
-    Functor prepareTimeSpanningEnd(&Object::PrepareTimeSpanningEnd);
-    this->Process(
-        &prepareTimeSpanning, &prepareTimeSpanningParams, &prepareTimeSpanningEnd, NULL, UNLIMITED_DEPTH, BACKWARD);
-
-    // First we try backwards because normally the spanning elements are at the end of
-    // the measure. However, in some case, one (or both) end points will appear afterwards
-    // in the encoding. For these, the previous iteration will not have resolved the link and
-    // the spanning elements will remain in the timeSpanningElements array. We try again forwards
-    // but this time without filling the list (that is only will the remaining elements)
-    if (!prepareTimeSpanningParams.m_timeSpanningInterfaces.empty()) {
-        prepareTimeSpanningParams.m_fillList = false;
-        this->Process(&prepareTimeSpanning, &prepareTimeSpanningParams);
-    }
-
-    // Try to match all time pointing elements (tempo, fermata, etc) by processing backwards
-    PrepareTimePointingParams prepareTimePointingParams;
-    Functor prepareTimePointing(&Object::PrepareTimePointing);
-    Functor prepareTimePointingEnd(&Object::PrepareTimePointingEnd);
-    this->Process(
-        &prepareTimePointing, &prepareTimePointingParams, &prepareTimePointingEnd, NULL, UNLIMITED_DEPTH, BACKWARD);
+    functorGroup.Add(&prepareTimeSpanning, &prepareTimeSpanningParams);
+    this->Process(&functorGroup);
 
     // Now try to match the @tstamp and @tstamp2 attributes.
     PrepareTimestampsParams prepareTimestampsParams;
@@ -259,79 +352,61 @@ void Doc::PrepareDrawing()
     // StaffN_LayerN_VerseN_t staffLayerVerseTree;
     // params.push_back(&staffLayerVerseTree);
 
-    // We first fill a tree of ints with [staff/layer] and [staff/layer/verse] numbers (@n) to be processed
+    // We first fill a tree of ints with [staff/layer/verse] numbers (@n) and the Layer partitions for each
+    // [staff/layer] to be processed
     // LogElapsedTimeStart();
     Functor prepareProcessingLists(&Object::PrepareProcessingLists);
     this->Process(&prepareProcessingLists, &prepareProcessingListsParams);
 
-    // The tree is used to process each staff/layer/verse separately
-    // For this, we use an array of AttCommmonNComparison that looks for each object if it is of the type
+    // The partitions are used to process each staff/layer/verse separately
+    // For the verses, we use an array of AttCommmonNComparison that looks for each object if it is of the type
     // and with @n specified
 
+    MapOfLayerPartitions::iterator layers;
     IntTree_t::iterator staves;
-    IntTree_t::iterator layers;
+    IntTree_t::iterator layerNs;
     IntTree_t::iterator verses;
 
     // Process by layer for matching @tie attribute - we process notes and chords, looking at
     // GetTie values and pitch and oct for matching notes
-    std::vector<AttComparison *> filters;
-    for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
-         staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
-        for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
-            // Create ad comparison object for each type / @n
-            AttCommonNComparison matchStaff(STAFF, staves->first);
-            AttCommonNComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
-
-            PrepareTieAttrParams prepareTieAttrParams;
-            Functor prepareTieAttr(&Object::PrepareTieAttr);
-            Functor prepareTieAttrEnd(&Object::PrepareTieAttrEnd);
-            this->Process(&prepareTieAttr, &prepareTieAttrParams, &prepareTieAttrEnd, &filters);
-
-            // After having processed one layer, we check if we have open ties - if yes, we
-            // must reset them and they will be ignored.
-            if (!prepareTieAttrParams.m_currentNotes.empty()) {
-                std::vector<Note *>::iterator iter;
-                for (iter = prepareTieAttrParams.m_currentNotes.begin();
-                     iter != prepareTieAttrParams.m_currentNotes.end(); iter++) {
-                    LogWarning("Unable to match @tie of note '%s', skipping it", (*iter)->GetUuid().c_str());
-                    (*iter)->ResetDrawingTieAttr();
-                }
+    for (layers = prepareProcessingListsParams.m_layerPartitions.begin();
+         layers != prepareProcessingListsParams.m_layerPartitions.end(); ++layers) {
+        PrepareTieAttrParams prepareTieAttrParams;
+        Functor prepareTieAttr(&Object::PrepareTieAttr);
+        Functor prepareTieAttrEnd(&Object::PrepareTieAttrEnd);
+        this->ProcessLayerPartition(&layers->second, &prepareTieAttr, &prepareTieAttrParams, &prepareTieAttrEnd);
+
+        // After having processed one layer, we check if we have open ties - if yes, we
+        // must reset them and they will be ignored.
+        if (!prepareTieAttrParams.m_currentNotes.empty()) {
+            std::vector<Note *>::iterator iter;
+            for (iter = prepareTieAttrParams.m_currentNotes.begin(); iter != prepareTieAttrParams.m_currentNotes.end();
+                 iter++) {
+                LogWarning("Unable to match @tie of note '%s', skipping it", (*iter)->GetUuid().c_str());
+                (*iter)->ResetDrawingTieAttr();
             }
         }
     }
 
-    for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
-         staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
-        for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
-            // Create ad comparison object for each type / @n
-            AttCommonNComparison matchStaff(STAFF, staves->first);
-            AttCommonNComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
-
-            PreparePointersByLayerParams preparePointersByLayerParams;
-            Functor preparePointersByLayer(&Object::PreparePointersByLayer);
-            this->Process(&preparePointersByLayer, &preparePointersByLayerParams, NULL, &filters);
-        }
+    for (layers = prepareProcessingListsParams.m_layerPartitions.begin();
+         layers != prepareProcessingListsParams.m_layerPartitions.end(); ++layers) {
+        PreparePointersByLayerParams preparePointersByLayerParams;
+        Functor preparePointersByLayer(&Object::PreparePointersByLayer);
+        this->ProcessLayerPartition(&layers->second, &preparePointersByLayer, &preparePointersByLayerParams);
     }
 
     // Same for the lyrics, but Verse by Verse since Syl are TimeSpanningInterface elements for handling connectors
+    std::vector<AttComparison *> filters;
     for (staves = prepareProcessingListsParams.m_verseTree.child.begin();
          staves != prepareProcessingListsParams.m_verseTree.child.end(); ++staves) {
-        for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            for (verses = layers->second.child.begin(); verses != layers->second.child.end(); ++verses) {
-                // std::cout << staves->first << " => " << layers->first << " => " << verses->first << '\n';
+        for (layerNs = staves->second.child.begin(); layerNs != staves->second.child.end(); ++layerNs) {
+            ArrayOfObjects *partition
+                = &prepareProcessingListsParams.m_layerPartitions[std::make_pair(staves->first, layerNs->first)];
+            for (verses = layerNs->second.child.begin(); verses != layerNs->second.child.end(); ++verses) {
+                // std::cout << staves->first << " => " << layerNs->first << " => " << verses->first << '\n';
                 filters.clear();
-                // Create ad comparison object for each type / @n
-                AttCommonNComparison matchStaff(STAFF, staves->first);
-                AttCommonNComparison matchLayer(LAYER, layers->first);
+                // Create ad comparison object for the verse @n
                 AttCommonNComparison matchVerse(VERSE, verses->first);
-                filters.push_back(&matchStaff);
-                filters.push_back(&matchLayer);
                 filters.push_back(&matchVerse);
 
                 // The first pass sets m_drawingFirstNote and m_drawingLastNote for each syl
@@ -339,7 +414,10 @@ void Doc::PrepareDrawing()
                 PrepareLyricsParams prepareLyricsParams;
                 Functor prepareLyrics(&Object::PrepareLyrics);
                 Functor prepareLyricsEnd(&Object::PrepareLyricsEnd);
-                this->Process(&prepareLyrics, &prepareLyricsParams, &prepareLyricsEnd, &filters);
+                this->ProcessLayerPartition(
+                    partition, &prepareLyrics, &prepareLyricsParams, &prepareLyricsEnd, &filters);
+                // Close the syl that remains open at the end of the document
+                prepareLyricsEnd.Call(this, &prepareLyricsParams);
             }
         }
     }
@@ -359,36 +437,32 @@ void Doc::PrepareDrawing()
     }
 
     // Process by staff for matching mRpt elements and setting the drawing number
-    for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
-         staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
-        for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
-            // Create ad comparison object for each type / @n
-            AttCommonNComparison matchStaff(STAFF, staves->first);
-            AttCommonNComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
-
-            // We set multiNumber to NONE for indicated we need to look at the staffDef when reaching the first staff
-            PrepareRptParams prepareRptParams(&m_scoreDef);
-            Functor prepareRpt(&Object::PrepareRpt);
-            this->Process(&prepareRpt, &prepareRptParams, NULL, &filters);
-        }
+    for (layers = prepareProcessingListsParams.m_layerPartitions.begin();
+         layers != prepareProcessingListsParams.m_layerPartitions.end(); ++layers) {
+        // We set multiNumber to NONE for indicated we need to look at the staffDef when reaching the first layer
+        PrepareRptParams prepareRptParams(&m_scoreDef);
+        Functor prepareRpt(&Object::PrepareRpt);
+        this->ProcessLayerPartition(&layers->second, &prepareRpt, &prepareRptParams);
     }
 
+    // The following functors are independent and are processed in a single traversal
+    FunctorGroup prepareGroup;
+
     // Prepare the endings (pointers to the measure after and before the boundaries
     PrepareBoundariesParams prepareEndingsParams;
     Functor prepareEndings(&Object::PrepareBoundaries);
-    this->Process(&prepareEndings, &prepareEndingsParams);
+    prepareGroup.Add(&prepareEndings, &prepareEndingsParams);
 
     // Prepare the floating drawing groups
     PrepareFloatingGrpsParams prepareFloatingGrpsParams;
     Functor prepareFloatingGrps(&Object::PrepareFloatingGrps);
-    this->Process(&prepareFloatingGrps, &prepareFloatingGrpsParams);
+    prepareGroup.Add(&prepareFloatingGrps, &prepareFloatingGrpsParams);
 
     FunctorParams prepareArticParams;
     Functor prepareArtic(&Object::PrepareArtic);
-    this->Process(&prepareArtic, &prepareArticParams);
+    prepareGroup.Add(&prepareArtic, &prepareArticParams);
+
+    this->Process(&prepareGroup);
 
     /*
     // Alternate solution with StaffN_LayerN_VerseN_t
@@ -455,7 +529,7 @@ void Doc::CastOffDoc()
     assert(contentPage);
     contentPage->LayOutHorizontally();
 
-    System *contentSystem = dynamic_cast<System *>(contentPage->DetachChild(0));
+    System *contentSystem = vrv_cast<System *>(contentPage->DetachChild(0));
     assert(contentSystem);
 
     System *currentSystem = new System();
@@ -527,7 +601,7 @@ void Doc::CastOffEncodingDoc()
     Page *contentPage = this->SetDrawingPage(0);
     assert(contentPage);
 
-    System *contentSystem = dynamic_cast<System *>(contentPage->FindChildByType(SYSTEM));
+    System *contentSystem = vrv_cast<System *>(contentPage->FindChildByType(SYSTEM));
     assert(contentSystem);
 
     // Detach the contentPage
@@ -580,6 +654,40 @@ bool Doc::HasPage(int pageIdx) const
     return ((pageIdx >= 0) && (pageIdx < GetChildCount()));
 }
 
+std::string Doc::GetMemoryFootprint()
+{
+    Functor calcMemoryFootprint(&Object::CalcMemoryFootprint);
+    // The hidden editorial content takes memory too
+    calcMemoryFootprint.m_visibleOnly = false;
+    CalcMemoryFootprintParams calcMemoryFootprintParams(&calcMemoryFootprint);
+    this->Process(&calcMemoryFootprint, &calcMemoryFootprintParams);
+    m_scoreDef.Process(&calcMemoryFootprint, &calcMemoryFootprintParams);
+
+    std::string report = StringFormat("%-24s %10s %10s %14s\n", "Class", "Count", "Size", "Total");
+    int totalCount = 0;
+    size_t totalSize = 0;
+    std::map<ClassId, int>::iterator iter;
+    for (iter = calcMemoryFootprintParams.m_counts.begin(); iter != calcMemoryFootprintParams.m_counts.end();
+         iter++) {
+        const int count = iter->second;
+        const size_t size = calcMemoryFootprintParams.m_sizes[iter->first];
+        // Objects that are members of other objects are counted but their size is included in their owner
+        report += StringFormat("%-24s %10d %10lu %14lu\n", calcMemoryFootprintParams.m_classNames[iter->first].c_str(),
+            count, (unsigned long)(size / count), (unsigned long)size);
+        totalCount += count;
+        totalSize += size;
+    }
+    report += StringFormat("%-24s %10d %10s %14lu\n", "All", totalCount, "", (unsigned long)totalSize);
+    if (m_arena) {
+        report += StringFormat("%-24s %10d %10s %14lu\n", "Arena", m_arena->GetAllocationCount(), "",
+            (unsigned long)m_arena->GetAllocatedSize());
+    }
+    report += StringFormat("%-24s %10d %10s %14lu\n", "String pool", m_stringPool.GetCount(), "",
+        (unsigned long)m_stringPool.GetLength());
+
+    return report;
+}
+
 int Doc::GetPageCount() const
 {
     return GetChildCount();
@@ -592,77 +700,64 @@ bool Doc::GetMidiExportDone() const
 
 int Doc::GetGlyphHeight(wchar_t code, int staffSize, bool graceSize) const
 {
-    int x, y, w, h;
-    Glyph *glyph = Resources::GetGlyph(code);
-    assert(glyph);
-    glyph->GetBoundingBox(&x, &y, &w, &h);
-    h = h * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
-    if (graceSize) h = h * this->m_style->m_graceNum / this->m_style->m_graceDen;
-    h = h * staffSize / 100;
-    return h;
+    return this->GetScaledGlyphTable(staffSize, graceSize)->GetHeight(code);
 }
 
 int Doc::GetGlyphWidth(wchar_t code, int staffSize, bool graceSize) const
 {
-    int x, y, w, h;
-    Glyph *glyph = Resources::GetGlyph(code);
-    assert(glyph);
-    glyph->GetBoundingBox(&x, &y, &w, &h);
-    w = w * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
-    if (graceSize) w = w * this->m_style->m_graceNum / this->m_style->m_graceDen;
-    w = w * staffSize / 100;
-    return w;
+    return this->GetScaledGlyphTable(staffSize, graceSize)->GetWidth(code);
 }
 
 int Doc::GetGlyphDescender(wchar_t code, int staffSize, bool graceSize) const
 {
-    int x, y, w, h;
-    Glyph *glyph = Resources::GetGlyph(code);
-    assert(glyph);
-    glyph->GetBoundingBox(&x, &y, &w, &h);
-    y = y * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
-    if (graceSize) y = y * this->m_style->m_graceNum / this->m_style->m_graceDen;
-    y = y * staffSize / 100;
-    return y;
+    return this->GetScaledGlyphTable(staffSize, graceSize)->GetDescender(code);
 }
 
 int Doc::GetTextGlyphHeight(wchar_t code, FontInfo *font, bool graceSize) const
 {
     assert(font);
 
-    int x, y, w, h;
-    Glyph *glyph = Resources::GetTextGlyph(code);
-    assert(glyph);
-    glyph->GetBoundingBox(&x, &y, &w, &h);
-    h = h * font->GetPointSize() / glyph->GetUnitsPerEm();
-    if (graceSize) h = h * this->m_style->m_graceNum / this->m_style->m_graceDen;
-    return h;
+    return this->GetScaledTextGlyphTable(font->GetPointSize(), graceSize)->GetHeight(code);
 }
 
 int Doc::GetTextGlyphWidth(wchar_t code, FontInfo *font, bool graceSize) const
 {
     assert(font);
 
-    int x, y, w, h;
-    Glyph *glyph = Resources::GetTextGlyph(code);
-    assert(glyph);
-    glyph->GetBoundingBox(&x, &y, &w, &h);
-    w = w * font->GetPointSize() / glyph->GetUnitsPerEm();
-    if (graceSize) w = w * this->m_style->m_graceNum / this->m_style->m_graceDen;
-    return w;
+    return this->GetScaledTextGlyphTable(font->GetPointSize(), graceSize)->GetWidth(code);
 }
 
 int Doc::GetTextGlyphDescender(wchar_t code, FontInfo *font, bool graceSize) const
 {
     assert(font);
 
-    int x, y, w, h;
-    Glyph *glyph = Resources::GetTextGlyph(code);
-    assert(glyph);
-    glyph->GetBoundingBox(&x, &y, &w, &h);
-    y = y * font->GetPointSize() / glyph->GetUnitsPerEm();
-    if (graceSize) y = y * this->m_style->m_graceNum / this->m_style->m_graceDen;
-    return y;
+    return this->GetScaledTextGlyphTable(font->GetPointSize(), graceSize)->GetDescender(code);
+}
+
+const ScaledGlyphTable *Doc::GetScaledGlyphTable(int staffSize, bool graceSize) const
+{
+    // The tables are cleared when the font changes, so the glyph table does not need to be checked
+    std::vector<ScaledGlyphTable>::const_iterator iter;
+    for (iter = m_scaledGlyphTables.begin(); iter != m_scaledGlyphTables.end(); ++iter) {
+        if (iter->IsScaledFor(m_drawingSmuflFontSize, staffSize, graceSize)) return &(*iter);
+    }
+    assert(m_resources.GetFont());
+    m_scaledGlyphTables.push_back(ScaledGlyphTable(m_resources.GetFont(), m_drawingSmuflFontSize, staffSize, graceSize,
+        m_style->m_graceNum, m_style->m_graceDen));
+    return &m_scaledGlyphTables.back();
+}
+
+const ScaledGlyphTable *Doc::GetScaledTextGlyphTable(int pointSize, bool graceSize) const
+{
+    // The point size of the text font already takes the staff size into account
+    std::vector<ScaledGlyphTable>::const_iterator iter;
+    for (iter = m_scaledTextGlyphTables.begin(); iter != m_scaledTextGlyphTables.end(); ++iter) {
+        if (iter->IsScaledFor(pointSize, 100, graceSize)) return &(*iter);
+    }
+    assert(m_resources.GetTextFont());
+    m_scaledTextGlyphTables.push_back(ScaledGlyphTable(
+        m_resources.GetTextFont(), pointSize, 100, graceSize, m_style->m_graceNum, m_style->m_graceDen));
+    return &m_scaledTextGlyphTables.back();
 }
 
 int Doc::GetDrawingUnit(int staffSize) const
@@ -928,6 +1023,14 @@ Page *Doc::SetDrawingPage(int pageIdx)
     m_drawingSmuflFontSize = CalcMusicFontSize();
     m_drawingLyricFontSize = m_drawingUnit * m_style->m_lyricSize / PARAM_DENOMINATOR;
 
+    // the glyph metrics for the normal staff size are precalculated, the other ones when first used
+    m_scaledGlyphTables.clear();
+    m_scaledTextGlyphTables.clear();
+    if (m_resources.GetFont()) {
+        this->GetScaledGlyphTable(100, false);
+        this->GetScaledGlyphTable(100, true);
+    }
+
     glyph_size = GetGlyphWidth(SMUFL_E0A3_noteheadHalf, 100, 0);
     m_drawingLedgerLine = glyph_size * 72 / 100;
 
@@ -958,13 +1061,25 @@ int Doc::GetAdjustedDrawingPageWidth() const
     ;
 }
 
+void Doc::ProcessLayerPartition(ArrayOfObjects *layers, Functor *functor, FunctorParams *functorParams,
+    Functor *endFunctor, ArrayOfAttComparisons *filters)
+{
+    assert(layers);
+
+    ArrayOfObjects::iterator iter;
+    for (iter = layers->begin(); iter != layers->end(); ++iter) {
+        (*iter)->Process(functor, functorParams, endFunctor, filters);
+        if (functor->m_returnCode == FUNCTOR_STOP) break;
+    }
+}
+
 //----------------------------------------------------------------------------
 // Doc functors methods
 //----------------------------------------------------------------------------
 
 int Doc::PrepareLyricsEnd(FunctorParams *functorParams)
 {
-    PrepareLyricsParams *params = dynamic_cast<PrepareLyricsParams *>(functorParams);
+    PrepareLyricsParams *params = vrv_cast<PrepareLyricsParams *>(functorParams);
     assert(params);
 
     if ((params->m_currentSyl && params->m_lastNote) && (params->m_currentSyl->GetStart() != params->m_lastNote)) {
@@ -974,4 +1089,18 @@ int Doc::PrepareLyricsEnd(FunctorParams *functorParams)
     return FUNCTOR_STOP;
 }
 
+//----------------------------------------------------------------------------
+// StringPool
+//----------------------------------------------------------------------------
+
+size_t StringPool::GetLength() const
+{
+    size_t length = 0;
+    std::unordered_set<std::string>::const_iterator iter;
+    for (iter = m_strings.begin(); iter != m_strings.end(); ++iter) {
+        length += iter->length();
+    }
+    return length;
+}
+
 } // namespace vrv
@@ -9,6 +9,10 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
+
+//----------------------------------------------------------------------------
+
 #include "layerelement.h"
 
 namespace vrv {
@@ -33,9 +37,10 @@ void DrawingListInterface::Reset()
 
 void DrawingListInterface::AddToDrawingList(Object *object)
 {
+    // Keep the order in which the objects are added and not the one of their addresses, which depends on the
+    // memory previously used in the process
+    if (std::find(m_drawingList.begin(), m_drawingList.end(), object) != m_drawingList.end()) return;
     m_drawingList.push_back(object);
-    m_drawingList.sort();
-    m_drawingList.unique();
 }
 
 ListOfObjects *DrawingListInterface::GetDrawingList()
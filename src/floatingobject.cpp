@@ -39,7 +39,7 @@ FloatingObject::FloatingObject() : Object("fe")
     Reset();
 }
 
-FloatingObject::FloatingObject(std::string classid) : Object(classid)
+FloatingObject::FloatingObject(const char *classid) : Object(classid)
 {
     Reset();
 
@@ -108,13 +108,13 @@ FloatingPositioner::FloatingPositioner(FloatingObject *object) : BoundingBox()
 
     m_object = object;
     if (object->Is() == DIR) {
-        Dir *dir = dynamic_cast<Dir *>(object);
+        Dir *dir = vrv_cast<Dir *>(object);
         assert(dir);
         // dir below by default
         m_place = dir->HasPlace() ? dir->GetPlace() : STAFFREL_below;
     }
     else if (object->Is() == DYNAM) {
-        Dynam *dynam = dynamic_cast<Dynam *>(object);
+        Dynam *dynam = vrv_cast<Dynam *>(object);
         assert(dynam);
         // dynam below by default
         m_place = dynam->HasPlace() ? dynam->GetPlace() : STAFFREL_below;
@@ -124,43 +124,43 @@ FloatingPositioner::FloatingPositioner(FloatingObject *object) : BoundingBox()
         m_place = STAFFREL_above;
     }
     else if (object->Is() == FERMATA) {
-        Fermata *fermata = dynamic_cast<Fermata *>(object);
+        Fermata *fermata = vrv_cast<Fermata *>(object);
         assert(fermata);
         // fermata above by default
         m_place = fermata->HasPlace() ? fermata->GetPlace() : STAFFREL_above;
     }
     else if (object->Is() == HAIRPIN) {
-        Hairpin *hairpin = dynamic_cast<Hairpin *>(object);
+        Hairpin *hairpin = vrv_cast<Hairpin *>(object);
         assert(hairpin);
         // haripin below by default;
         m_place = hairpin->HasPlace() ? hairpin->GetPlace() : STAFFREL_below;
     }
     else if (object->Is() == HARM) {
-        Harm *harm = dynamic_cast<Harm *>(object);
+        Harm *harm = vrv_cast<Harm *>(object);
         assert(harm);
         // harm above by default
         m_place = harm->HasPlace() ? harm->GetPlace() : STAFFREL_above;
     }
     else if (object->Is() == OCTAVE) {
-        Octave *octave = dynamic_cast<Octave *>(object);
+        Octave *octave = vrv_cast<Octave *>(object);
         assert(octave);
         // octave below by default (won't draw without @dis.place anyway);
         m_place = (octave->GetDisPlace() == PLACE_above) ? STAFFREL_above : STAFFREL_below;
     }
     else if (object->Is() == PEDAL) {
-        Pedal *pedal = dynamic_cast<Pedal *>(object);
+        Pedal *pedal = vrv_cast<Pedal *>(object);
         assert(pedal);
         // pedal below by default
         m_place = pedal->HasPlace() ? pedal->GetPlace() : STAFFREL_below;
     }
     else if (object->Is() == TEMPO) {
-        Tempo *tempo = dynamic_cast<Tempo *>(object);
+        Tempo *tempo = vrv_cast<Tempo *>(object);
         assert(tempo);
         // tempo above by default;
         m_place = tempo->HasPlace() ? tempo->GetPlace() : STAFFREL_above;
     }
     else if (object->Is() == TRILL) {
-        Trill *trill = dynamic_cast<Trill *>(object);
+        Trill *trill = vrv_cast<Trill *>(object);
         assert(trill);
         // trill above by default;
         m_place = trill->HasPlace() ? trill->GetPlace() : STAFFREL_above;
@@ -313,7 +313,7 @@ int FloatingObject::ResetVerticalAlignment(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
-int FloatingObject::PrepareTimePointing(FunctorParams *functorParams)
+int FloatingObject::PrepareTimeSpanning(FunctorParams *functorParams)
 {
     // Pass it to the pseudo functor of the interface
     if (this->HasInterface(INTERFACE_TIME_POINT)) {
@@ -321,13 +321,7 @@ int FloatingObject::PrepareTimePointing(FunctorParams *functorParams)
         assert(interface);
         return interface->InterfacePrepareTimePointing(functorParams, this);
     }
-    return FUNCTOR_CONTINUE;
-}
-
-int FloatingObject::PrepareTimeSpanning(FunctorParams *functorParams)
-{
-    // Pass it to the pseudo functor of the interface
-    if (this->HasInterface(INTERFACE_TIME_SPANNING)) {
+    else if (this->HasInterface(INTERFACE_TIME_SPANNING)) {
         TimeSpanningInterface *interface = this->GetTimeSpanningInterface();
         assert(interface);
         return interface->InterfacePrepareTimeSpanning(functorParams, this);
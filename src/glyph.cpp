@@ -14,6 +14,7 @@
 
 //----------------------------------------------------------------------------
 
+#include "builtinfont.h"
 #include "vrv.h"
 
 //----------------------------------------------------------------------------
@@ -36,6 +37,7 @@ Glyph::Glyph()
     m_unitsPerEm = 20480;
     m_path = "[unset]";
     m_codeStr = "[unset]";
+    m_xml = NULL;
 }
 
 Glyph::Glyph(std::string path, std::string codeStr)
@@ -48,6 +50,7 @@ Glyph::Glyph(std::string path, std::string codeStr)
     m_unitsPerEm = 20480;
     m_path = path;
     m_codeStr = codeStr;
+    m_xml = NULL;
 
     pugi::xml_document doc;
     pugi::xml_parse_result result = doc.load_file(path.c_str());
@@ -84,6 +87,20 @@ Glyph::Glyph(int unitsPerEm)
     m_unitsPerEm = unitsPerEm * 10;
     m_path = "[unset]";
     m_codeStr = "[unset]";
+    m_xml = NULL;
+}
+
+Glyph::Glyph(const BuiltInGlyph *builtInGlyph)
+{
+    assert(builtInGlyph);
+
+    m_unitsPerEm = builtInGlyph->m_unitsPerEm * 10;
+    this->SetBoundingBox(builtInGlyph->m_x, builtInGlyph->m_y, builtInGlyph->m_width, builtInGlyph->m_height);
+    this->SetHorizAdvX(builtInGlyph->m_horizAdvX);
+    // There is no file for the glyphs compiled in
+    m_path = "[unset]";
+    m_codeStr = (builtInGlyph->m_codeStr[0] != '\0') ? builtInGlyph->m_codeStr : "[unset]";
+    m_xml = builtInGlyph->m_xml;
 }
 
 Glyph::~Glyph()
@@ -98,7 +115,7 @@ void Glyph::SetBoundingBox(double x, double y, double w, double h)
     m_height = (int)(10.0 * h);
 }
 
-void Glyph::GetBoundingBox(int *x, int *y, int *w, int *h)
+void Glyph::GetBoundingBox(int *x, int *y, int *w, int *h) const
 {
     (*x) = m_x;
     (*y) = m_y;
@@ -106,4 +123,77 @@ void Glyph::GetBoundingBox(int *x, int *y, int *w, int *h)
     (*h) = m_height;
 }
 
+//----------------------------------------------------------------------------
+// GlyphTable
+//----------------------------------------------------------------------------
+
+GlyphTable::GlyphTable()
+{
+    m_firstCode = 0;
+}
+
+GlyphTable::~GlyphTable()
+{
+}
+
+void GlyphTable::SetGlyph(wchar_t code, const Glyph &glyph)
+{
+    if (m_index.empty()) {
+        m_firstCode = code;
+    }
+    // Extend the index at the front or at the back for a code out of range
+    else if (code < m_firstCode) {
+        m_index.insert(m_index.begin(), m_firstCode - code, GLYPH_NONE);
+        m_firstCode = code;
+    }
+    size_t offset = code - m_firstCode;
+    if (offset >= m_index.size()) m_index.resize(offset + 1, GLYPH_NONE);
+
+    if (m_index[offset] != GLYPH_NONE) {
+        m_glyphs[m_index[offset]] = glyph;
+        return;
+    }
+    assert(m_glyphs.size() < 0x7FFF);
+    m_index[offset] = (short)m_glyphs.size();
+    m_glyphs.push_back(glyph);
+}
+
+//----------------------------------------------------------------------------
+// ScaledGlyphTable
+//----------------------------------------------------------------------------
+
+ScaledGlyphTable::ScaledGlyphTable(
+    const GlyphTable *glyphTable, int fontSize, int staffSize, bool graceSize, int graceNum, int graceDen)
+{
+    assert(glyphTable);
+
+    m_glyphTable = glyphTable;
+    m_fontSize = fontSize;
+    m_staffSize = staffSize;
+    m_graceSize = graceSize;
+
+    m_metrics.resize(glyphTable->GetCount());
+    int x, y, w, h;
+    for (int i = 0; i < glyphTable->GetCount(); ++i) {
+        const Glyph *glyph = glyphTable->GetGlyphAt(i);
+        glyph->GetBoundingBox(&x, &y, &w, &h);
+        // Scaled to the font size, then to the grace size and the staff size, with integer divisions at each step
+        w = w * fontSize / glyph->GetUnitsPerEm();
+        h = h * fontSize / glyph->GetUnitsPerEm();
+        y = y * fontSize / glyph->GetUnitsPerEm();
+        if (graceSize) {
+            w = w * graceNum / graceDen;
+            h = h * graceNum / graceDen;
+            y = y * graceNum / graceDen;
+        }
+        m_metrics[i].m_width = w * staffSize / 100;
+        m_metrics[i].m_height = h * staffSize / 100;
+        m_metrics[i].m_descender = y * staffSize / 100;
+    }
+}
+
+ScaledGlyphTable::~ScaledGlyphTable()
+{
+}
+
 } // namespace vrv
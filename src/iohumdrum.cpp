@@ -5130,7 +5130,19 @@ static const EntityNameEntry StaticEntityNames[] = {
 
 typedef std::map<std::string, unsigned int> EntityNameMap;
 typedef std::pair<std::string, unsigned int> EntityNamePair;
-static EntityNameMap EntityNames;
+
+static EntityNameMap LoadEntityNames()
+{
+    EntityNameMap entityNames;
+    const EntityNameEntry *ThisEntry;
+    ThisEntry = StaticEntityNames;
+    for (;;) {
+        if (ThisEntry->Name == NULL) break;
+        entityNames.insert(EntityNamePair(std::string(ThisEntry->Name), ThisEntry->Value));
+        ++ThisEntry;
+    }
+    return entityNames;
+}
 
 //////////////////////////////
 //
@@ -5216,16 +5228,8 @@ void HumdrumInput::UnquoteHTML(std::istream &In, std::ostream &Out)
                     ProcessedChar = true;
                 }
                 else if (ThisCh == ';') {
-                    if (EntityNames.empty()) {
-                        /* first use, load EntityNames from StaticEntityNames */
-                        const EntityNameEntry *ThisEntry;
-                        ThisEntry = StaticEntityNames;
-                        for (;;) {
-                            if (ThisEntry->Name == NULL) break;
-                            EntityNames.insert(EntityNamePair(std::string(ThisEntry->Name), ThisEntry->Value));
-                            ++ThisEntry;
-                        }
-                    }
+                    /* first use, load EntityNames from StaticEntityNames (the initialization is thread-safe) */
+                    static const EntityNameMap EntityNames = LoadEntityNames();
                     const EntityNameMap::const_iterator NameEntry = EntityNames.find(MatchingName);
                     if (NameEntry != EntityNames.end()) {
                         CharCode = NameEntry->second;
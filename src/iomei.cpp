@@ -1200,9 +1200,11 @@ void MeiOutput::WriteTimeSpanningInterface(pugi::xml_node element, TimeSpanningI
 
 void MeiOutput::WriteUnsupportedAttr(pugi::xml_node element, Object *object)
 {
-    ArrayOfStrAttr::iterator iter;
-    for (iter = object->m_unsupported.begin(); iter != object->m_unsupported.end(); iter++) {
-        element.append_attribute((*iter).first.c_str()) = (*iter).second.c_str();
+    const ArrayOfPooledStrAttr *unsupported = object->GetUnsupported();
+    if (!unsupported) return;
+    ArrayOfPooledStrAttr::const_iterator iter;
+    for (iter = unsupported->begin(); iter != unsupported->end(); iter++) {
+        element.append_attribute((*iter).first->c_str()) = (*iter).second->c_str();
     }
 }
 
@@ -2975,7 +2977,9 @@ bool MeiInput::ReadTimeSpanningInterface(pugi::xml_node element, TimeSpanningInt
 void MeiInput::ReadUnsupportedAttr(pugi::xml_node element, Object *object)
 {
     for (pugi::xml_attribute_iterator ait = element.attributes_begin(); ait != element.attributes_end(); ++ait) {
-        object->m_unsupported.push_back(std::make_pair(ait->name(), ait->value()));
+        // The names (and often the values) are repeated across the elements, so they are stored only once
+        StringPool *pool = m_doc->GetStringPool();
+        object->AddUnsupported(pool->Intern(ait->name()), pool->Intern(ait->value()));
     }
 }
 
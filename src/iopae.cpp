@@ -54,11 +54,7 @@ char hum2abc[1024] = { 0 }; // used with -a option
 int quietQ = 0; // used with -q option
 int quiet2Q = 0; // used with -Q option
 
-// Global variables:
-char data_line[10001] = { 0 };
 #define MAX_DATA_LEN 1024 // One line of the pae file would not be that long!
-char data_key[MAX_DATA_LEN];
-char data_value[MAX_DATA_LEN]; // ditto as above
 
 //----------------------------------------------------------------------------
 // PaeInput
@@ -123,6 +119,9 @@ void PaeInput::parsePlainAndEasy(std::istream &infile)
     char c_timesig[1024] = { 0 };
     char c_alttimesig[1024] = { 0 };
     char incipit[10001] = { 0 };
+    char data_line[10001] = { 0 };
+    char data_key[MAX_DATA_LEN] = { 0 };
+    char data_value[MAX_DATA_LEN] = { 0 };
     int in_beam = 0;
 
     std::string s_key;
@@ -1376,7 +1375,8 @@ void PaeInput::getAtRecordKeyValue(char *key, char *value, const char *input)
 
     strcpy(value, &input[index]);
 
-    // Truncate string to first space
+    // Truncate string to first space - nothing to do for shorter values (and this would underflow)
+    if (strlen(value) < 2) return;
     size_t i;
     for (i = strlen(value) - 2; i > 0; i--) {
         if (isspace(value[i])) {
@@ -138,14 +138,14 @@ LayerElement *Layer::GetAtPos(int x)
     Object *first = this->GetFirst();
     if (!first || !first->IsLayerElement()) return NULL;
 
-    LayerElement *element = dynamic_cast<LayerElement *>(first);
+    LayerElement *element = vrv_cast<LayerElement *>(first);
     assert(element);
     if (element->GetDrawingX() > x) return NULL;
 
     Object *next;
     while ((next = this->GetNext())) {
         if (!next->IsLayerElement()) continue;
-        LayerElement *nextLayerElement = dynamic_cast<LayerElement *>(next);
+        LayerElement *nextLayerElement = vrv_cast<LayerElement *>(next);
         assert(nextLayerElement);
         if (nextLayerElement->GetDrawingX() > x) return element;
         element = nextLayerElement;
@@ -168,7 +168,7 @@ Clef *Layer::GetClef(LayerElement *test)
     }
 
     if (testObject && testObject->Is() == CLEF) {
-        Clef *clef = dynamic_cast<Clef *>(testObject);
+        Clef *clef = vrv_cast<Clef *>(testObject);
         assert(clef);
         return clef;
     }
@@ -268,7 +268,7 @@ int Layer::UnsetCurrentScoreDef(FunctorParams *functorParams)
 
 int Layer::AlignHorizontally(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     params->m_currentMensur = GetCurrentMensur();
@@ -306,7 +306,7 @@ int Layer::AlignHorizontally(FunctorParams *functorParams)
 
 int Layer::AlignHorizontallyEnd(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     params->m_scoreDefRole = CAUTIONARY_SCOREDEF;
@@ -328,7 +328,7 @@ int Layer::AlignHorizontallyEnd(FunctorParams *functorParams)
 
     int i;
     for (i = 0; i < params->m_measureAligner->GetChildCount(); i++) {
-        Alignment *alignment = dynamic_cast<Alignment *>(params->m_measureAligner->GetChild(i));
+        Alignment *alignment = vrv_cast<Alignment *>(params->m_measureAligner->GetChild(i));
         assert(alignment);
         if (alignment->HasGraceAligner()) {
             alignment->GetGraceAligner()->AlignStack();
@@ -340,22 +340,22 @@ int Layer::AlignHorizontallyEnd(FunctorParams *functorParams)
 
 int Layer::PrepareProcessingLists(FunctorParams *functorParams)
 {
-    PrepareProcessingListsParams *params = dynamic_cast<PrepareProcessingListsParams *>(functorParams);
+    PrepareProcessingListsParams *params = vrv_cast<PrepareProcessingListsParams *>(functorParams);
     assert(params);
 
     // Alternate solution with StaffN_LayerN_VerseN_t
     // StaffN_LayerN_VerseN_t *tree = static_cast<StaffN_LayerN_VerseN_t*>((*params).at(0));
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff);
-    params->m_layerTree.child[staff->GetN()].child[this->GetN()];
+    params->m_layerPartitions[std::make_pair(staff->GetN(), this->GetN())].push_back(this);
 
     return FUNCTOR_CONTINUE;
 }
 
 int Layer::SetDrawingXY(FunctorParams *functorParams)
 {
-    SetDrawingXYParams *params = dynamic_cast<SetDrawingXYParams *>(functorParams);
+    SetDrawingXYParams *params = vrv_cast<SetDrawingXYParams *>(functorParams);
     assert(params);
 
     params->m_currentLayer = this;
@@ -407,9 +407,23 @@ int Layer::SetDrawingXY(FunctorParams *functorParams)
 
 int Layer::PrepareRpt(FunctorParams *functorParams)
 {
-    PrepareRptParams *params = dynamic_cast<PrepareRptParams *>(functorParams);
+    PrepareRptParams *params = vrv_cast<PrepareRptParams *>(functorParams);
     assert(params);
 
+    // This is happening only for the first layer of the staff @n since multiNumber is then set
+    // Futhermore, if @multi.number is false, the functor should have stopped (see below)
+    if (params->m_multiNumber == BOOLEAN_NONE) {
+        Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
+        assert(staff);
+        StaffDef *staffDef = params->m_currentScoreDef->GetStaffDef(staff->GetN());
+        if (staffDef && (staffDef->HasMultiNumber()) && (staffDef->GetMultiNumber() == BOOLEAN_false)) {
+            // Set it just in case, but stopping the functor should do it for this staff @n
+            params->m_multiNumber = BOOLEAN_false;
+            return FUNCTOR_STOP;
+        }
+        params->m_multiNumber = BOOLEAN_true;
+    }
+
     // If we have encountered a mRpt before and there is none is this layer, reset it to NULL
     if (params->m_currentMRpt && !this->FindChildByType(MRPT)) {
         params->m_currentMRpt = NULL;
@@ -417,9 +431,26 @@ int Layer::PrepareRpt(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
+int Layer::GenerateMIDI(FunctorParams *functorParams)
+{
+    GenerateMIDIParams *params = vrv_cast<GenerateMIDIParams *>(functorParams);
+    assert(params);
+
+    // The layers are processed staff/layer partition by partition (see Doc::ExportMIDI), so
+    // we start from the onset of the measure and reset the currentMeasureTime
+    Measure *measure = vrv_cast<Measure *>(this->GetFirstParent(MEASURE));
+    assert(measure);
+    std::map<Measure *, double>::iterator iter = params->m_measureOnsets.find(measure);
+    assert(iter != params->m_measureOnsets.end());
+    params->m_totalTime = iter->second;
+    params->m_currentMeasureTime = 0;
+
+    return FUNCTOR_CONTINUE;
+}
+
 int Layer::CalcMaxMeasureDuration(FunctorParams *functorParams)
 {
-    CalcMaxMeasureDurationParams *params = dynamic_cast<CalcMaxMeasureDurationParams *>(functorParams);
+    CalcMaxMeasureDurationParams *params = vrv_cast<CalcMaxMeasureDurationParams *>(functorParams);
     assert(params);
 
     // reset it
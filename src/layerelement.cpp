@@ -58,7 +58,7 @@ LayerElement::LayerElement() : Object("le-")
     Reset();
 }
 
-LayerElement::LayerElement(std::string classid) : Object(classid)
+LayerElement::LayerElement(const char *classid) : Object(classid)
 {
     Reset();
 }
@@ -185,7 +185,7 @@ int LayerElement::GetDrawingTop(Doc *doc, int staffSize, bool withArtic, ArticPa
         if (durationInterface->GetNoteOrChordDur(this) < DUR_2) {
             if (this->Is() == CHORD) {
                 int yChordMax = 0, yChordMin = 0;
-                Chord *chord = dynamic_cast<Chord *>(this);
+                Chord *chord = vrv_cast<Chord *>(this);
                 assert(chord);
                 chord->GetYExtremes(&yChordMax, &yChordMin);
                 return yChordMax + doc->GetDrawingUnit(staffSize);
@@ -218,7 +218,7 @@ int LayerElement::GetDrawingBottom(Doc *doc, int staffSize, bool withArtic, Arti
         if (durationInterface->GetNoteOrChordDur(this) < DUR_2) {
             if (this->Is() == CHORD) {
                 int yChordMax = 0, yChordMin = 0;
-                Chord *chord = dynamic_cast<Chord *>(this);
+                Chord *chord = vrv_cast<Chord *>(this);
                 assert(chord);
                 chord->GetYExtremes(&yChordMax, &yChordMin);
                 return yChordMin - doc->GetDrawingUnit(staffSize);
@@ -290,14 +290,14 @@ double LayerElement::GetAlignmentDuration(Mensur *mensur, MeterSig *meterSig, bo
         return durationValue;
     }
     else if (this->Is() == BEATRPT) {
-        BeatRpt *beatRpt = dynamic_cast<BeatRpt *>(this);
+        BeatRpt *beatRpt = vrv_cast<BeatRpt *>(this);
         assert(beatRpt);
         int meterUnit = 4;
         if (meterSig && meterSig->HasUnit()) meterSig->GetUnit();
         return beatRpt->GetBeatRptAlignmentDuration(meterUnit);
     }
     else if (this->Is() == TIMESTAMP_ATTR) {
-        TimestampAttr *timestampAttr = dynamic_cast<TimestampAttr *>(this);
+        TimestampAttr *timestampAttr = vrv_cast<TimestampAttr *>(this);
         assert(timestampAttr);
         int meterUnit = 4;
         if (meterSig && meterSig->HasUnit()) meterUnit = meterSig->GetUnit();
@@ -325,7 +325,7 @@ int LayerElement::ResetHorizontalAlignment(FunctorParams *functorParams)
     m_drawingX = 0;
     m_alignment = NULL;
     if (this->Is() == NOTE) {
-        Note *note = dynamic_cast<Note *>(this);
+        Note *note = vrv_cast<Note *>(this);
         assert(note);
         note->ResetGraceAlignment();
     }
@@ -342,7 +342,7 @@ int LayerElement::ResetVerticalAlignment(FunctorParams *functorParams)
 
 int LayerElement::AlignHorizontally(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     this->SetScoreDefRole(params->m_scoreDefRole);
@@ -385,7 +385,7 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
             type = ALIGNMENT_SCOREDEF_CAUTION_MENSUR;
         else {
             // replace the current mensur
-            params->m_currentMensur = dynamic_cast<Mensur *>(this);
+            params->m_currentMensur = vrv_cast<Mensur *>(this);
             assert(params->m_currentMensur);
             type = ALIGNMENT_MENSUR;
         }
@@ -397,7 +397,7 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
             type = ALIGNMENT_SCOREDEF_CAUTION_METERSIG;
         else {
             // replace the current meter signature
-            params->m_currentMeterSig = dynamic_cast<MeterSig *>(this);
+            params->m_currentMeterSig = vrv_cast<MeterSig *>(this);
             assert(params->m_currentMeterSig);
             // type = ALIGNMENT_METERSIG
             // We force this because they should appear only at the beginning of a measure and should be non-justifiable
@@ -425,14 +425,14 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
     }
     else if ((this->Is() == SYL) || (this->Is() == ARTIC) || (this->Is() == ARTIC_PART)) {
         // Refer to the note parent
-        Note *note = dynamic_cast<Note *>(this->GetFirstParent(NOTE));
+        Note *note = vrv_cast<Note *>(this->GetFirstParent(NOTE));
         assert(note);
         m_alignment = note->GetAlignment();
         return FUNCTOR_CONTINUE;
     }
     else if (this->Is() == VERSE) {
         // Idem
-        Note *note = dynamic_cast<Note *>(this->GetFirstParent(NOTE));
+        Note *note = vrv_cast<Note *>(this->GetFirstParent(NOTE));
         assert(note);
         m_alignment = note->GetAlignment();
         return FUNCTOR_CONTINUE;
@@ -468,47 +468,9 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
-int LayerElement::PrepareTimePointing(FunctorParams *functorParams)
-{
-    PrepareTimePointingParams *params = dynamic_cast<PrepareTimePointingParams *>(functorParams);
-    assert(params);
-
-    ArrayOfPointingInterClassIdPairs::iterator iter = params->m_timePointingInterfaces.begin();
-    while (iter != params->m_timePointingInterfaces.end()) {
-        if (iter->first->SetStartOnly(this)) {
-            // We have both the start and the end that are matched
-            iter = params->m_timePointingInterfaces.erase(iter);
-        }
-        else {
-            iter++;
-        }
-    }
-
-    return FUNCTOR_CONTINUE;
-}
-
-int LayerElement::PrepareTimeSpanning(FunctorParams *functorParams)
-{
-    PrepareTimeSpanningParams *params = dynamic_cast<PrepareTimeSpanningParams *>(functorParams);
-    assert(params);
-
-    ArrayOfSpanningInterClassIdPairs::iterator iter = params->m_timeSpanningInterfaces.begin();
-    while (iter != params->m_timeSpanningInterfaces.end()) {
-        if (iter->first->SetStartAndEnd(this)) {
-            // We have both the start and the end that are matched
-            iter = params->m_timeSpanningInterfaces.erase(iter);
-        }
-        else {
-            iter++;
-        }
-    }
-
-    return FUNCTOR_CONTINUE;
-}
-
 int LayerElement::SetDrawingXY(FunctorParams *functorParams)
 {
-    SetDrawingXYParams *params = dynamic_cast<SetDrawingXYParams *>(functorParams);
+    SetDrawingXYParams *params = vrv_cast<SetDrawingXYParams *>(functorParams);
     assert(params);
 
     // First pass, only set the X position
@@ -521,7 +483,7 @@ int LayerElement::SetDrawingXY(FunctorParams *functorParams)
             this->SetDrawingX(this->GetXRel() + params->m_currentMeasure->GetDrawingX());
             // Grace notes, also take into account the GraceAlignment
             if (this->Is() == NOTE) {
-                Note *note = dynamic_cast<Note *>(this);
+                Note *note = vrv_cast<Note *>(this);
                 assert(note);
                 if (note->HasGraceAlignment()) {
                     this->SetDrawingX(this->GetDrawingX() - note->GetAlignment()->GetGraceAligner()->GetWidth()
@@ -591,20 +553,20 @@ int LayerElement::SetDrawingXY(FunctorParams *functorParams)
 
     // Finally, adjust Y for notes and rests
     if (this->Is() == NOTE) {
-        Note *note = dynamic_cast<Note *>(this);
+        Note *note = vrv_cast<Note *>(this);
         this->SetDrawingY(this->GetDrawingY()
             + params->m_view->CalculatePitchPosY(
                   staffY, note->GetPname(), layerY->GetClefOffset(layerElementY), note->GetOct()));
     }
     else if (this->Is() == REST) {
-        Rest *rest = dynamic_cast<Rest *>(this);
+        Rest *rest = vrv_cast<Rest *>(this);
         assert(rest);
         // Automatically calculate rest position, if so requested
         if (rest->GetPloc() == PITCHNAME_NONE) {
             bool hasMultipleLayer = (staffY->GetLayerCount() > 1);
             bool isFirstLayer = false;
             if (hasMultipleLayer) {
-                Layer *firstLayer = dynamic_cast<Layer *>(staffY->FindChildByType(LAYER));
+                Layer *firstLayer = vrv_cast<Layer *>(staffY->FindChildByType(LAYER));
                 assert(firstLayer);
                 if (firstLayer->GetN() == layerY->GetN()) isFirstLayer = true;
             }
@@ -623,7 +585,7 @@ int LayerElement::SetDrawingXY(FunctorParams *functorParams)
 
 int LayerElement::FindTimeSpanningLayerElements(FunctorParams *functorParams)
 {
-    FindTimeSpanningLayerElementsParams *params = dynamic_cast<FindTimeSpanningLayerElementsParams *>(functorParams);
+    FindTimeSpanningLayerElementsParams *params = vrv_cast<FindTimeSpanningLayerElementsParams *>(functorParams);
     assert(params);
 
     if ((this->GetDrawingX() > params->m_minPos) && (this->GetDrawingX() < params->m_maxPos)) {
@@ -638,7 +600,7 @@ int LayerElement::FindTimeSpanningLayerElements(FunctorParams *functorParams)
 
 int LayerElement::GenerateMIDI(FunctorParams *functorParams)
 {
-    GenerateMIDIParams *params = dynamic_cast<GenerateMIDIParams *>(functorParams);
+    GenerateMIDIParams *params = vrv_cast<GenerateMIDIParams *>(functorParams);
     assert(params);
 
     // Here we need to check if the LayerElement as a duration, otherwise we can continue
@@ -653,7 +615,7 @@ int LayerElement::GenerateMIDI(FunctorParams *functorParams)
         params->m_currentMeasureTime += GetAlignmentDuration() * params->m_currentBpm / (DUR_MAX / DURATION_4);
     }
     else if (this->Is() == NOTE) {
-        Note *note = dynamic_cast<Note *>(this);
+        Note *note = vrv_cast<Note *>(this);
         assert(note);
 
         // Fow just ignore grace notes
@@ -747,7 +709,7 @@ int LayerElement::GenerateMIDI(FunctorParams *functorParams)
 
 int LayerElement::GenerateMIDIEnd(FunctorParams *functorParams)
 {
-    GenerateMIDIParams *params = dynamic_cast<GenerateMIDIParams *>(functorParams);
+    GenerateMIDIParams *params = vrv_cast<GenerateMIDIParams *>(functorParams);
     assert(params);
 
     if (this->Is() == CHORD) {
@@ -763,14 +725,14 @@ int LayerElement::GenerateMIDIEnd(FunctorParams *functorParams)
 
 int LayerElement::CalcMaxMeasureDuration(FunctorParams *functorParams)
 {
-    CalcMaxMeasureDurationParams *params = dynamic_cast<CalcMaxMeasureDurationParams *>(functorParams);
+    CalcMaxMeasureDurationParams *params = vrv_cast<CalcMaxMeasureDurationParams *>(functorParams);
     assert(params);
 
     // Here we need to check if the LayerElement as a duration, otherwise we can continue
     if (!this->HasInterface(INTERFACE_DURATION)) return FUNCTOR_CONTINUE;
 
     if (this->Is() == NOTE) {
-        Note *note = dynamic_cast<Note *>(this);
+        Note *note = vrv_cast<Note *>(this);
         assert(note);
 
         // Fow just ignore grace notes
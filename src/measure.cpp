@@ -99,7 +99,7 @@ void Measure::AddChild(Object *child)
         assert(dynamic_cast<EditorialElement *>(child));
     }
     else if (child->Is() == STAFF) {
-        Staff *staff = dynamic_cast<Staff *>(child);
+        Staff *staff = vrv_cast<Staff *>(child);
         assert(staff);
         if (staff && (staff->GetN() < 1)) {
             // This is not 100% safe if we have a <app> and <rdg> with more than
@@ -224,9 +224,22 @@ std::vector<Staff *> Measure::GetFirstStaffGrpStaves(ScoreDef *scoreDef)
 // Measure functor methods
 //----------------------------------------------------------------------------
 
+int Measure::CalcMemoryFootprint(FunctorParams *functorParams)
+{
+    CalcMemoryFootprintParams *params = vrv_cast<CalcMemoryFootprintParams *>(functorParams);
+    assert(params);
+
+    Object::CalcMemoryFootprint(params);
+
+    m_measureAligner.Process(params->m_functor, params);
+    m_timestampAligner.Process(params->m_functor, params);
+
+    return FUNCTOR_CONTINUE;
+}
+
 int Measure::ConvertToPageBased(FunctorParams *functorParams)
 {
-    ConvertToPageBasedParams *params = dynamic_cast<ConvertToPageBasedParams *>(functorParams);
+    ConvertToPageBasedParams *params = vrv_cast<ConvertToPageBasedParams *>(functorParams);
     assert(params);
 
     // Move itself to the pageBasedSystem - do not process children
@@ -331,7 +344,7 @@ int Measure::ResetHorizontalAlignment(FunctorParams *functorParams)
 
 int Measure::AlignHorizontally(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     // clear the content of the measureAligner
@@ -357,7 +370,7 @@ int Measure::AlignHorizontally(FunctorParams *functorParams)
 
 int Measure::AlignHorizontallyEnd(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     // We also need to align the timestamps - we do it at the end since we need the *meterSig to be initialized by a
@@ -374,7 +387,7 @@ int Measure::AlignHorizontallyEnd(FunctorParams *functorParams)
 
 int Measure::AlignVertically(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     // we also need to reset the staffNb
@@ -385,7 +398,7 @@ int Measure::AlignVertically(FunctorParams *functorParams)
 
 int Measure::SetBoundingBoxXShift(FunctorParams *functorParams)
 {
-    SetBoundingBoxXShiftParams *params = dynamic_cast<SetBoundingBoxXShiftParams *>(functorParams);
+    SetBoundingBoxXShiftParams *params = vrv_cast<SetBoundingBoxXShiftParams *>(functorParams);
     assert(params);
 
     // we reset the measure width and the minimum position
@@ -403,7 +416,7 @@ int Measure::SetBoundingBoxXShift(FunctorParams *functorParams)
 
 int Measure::SetBoundingBoxXShiftEnd(FunctorParams *functorParams)
 {
-    SetBoundingBoxXShiftParams *params = dynamic_cast<SetBoundingBoxXShiftParams *>(functorParams);
+    SetBoundingBoxXShiftParams *params = vrv_cast<SetBoundingBoxXShiftParams *>(functorParams);
     assert(params);
 
     // use the measure width as minimum position of the barLine
@@ -418,7 +431,7 @@ int Measure::SetBoundingBoxXShiftEnd(FunctorParams *functorParams)
 int Measure::IntegrateBoundingBoxGraceXShift(FunctorParams *functorParams)
 {
     IntegrateBoundingBoxGraceXShiftParams *params
-        = dynamic_cast<IntegrateBoundingBoxGraceXShiftParams *>(functorParams);
+        = vrv_cast<IntegrateBoundingBoxGraceXShiftParams *>(functorParams);
     assert(params);
 
     m_measureAligner.Process(params->m_functor, params);
@@ -428,7 +441,7 @@ int Measure::IntegrateBoundingBoxGraceXShift(FunctorParams *functorParams)
 
 int Measure::IntegrateBoundingBoxXShift(FunctorParams *functorParams)
 {
-    IntegrateBoundingBoxXShiftParams *params = dynamic_cast<IntegrateBoundingBoxXShiftParams *>(functorParams);
+    IntegrateBoundingBoxXShiftParams *params = vrv_cast<IntegrateBoundingBoxXShiftParams *>(functorParams);
     assert(params);
 
     m_measureAligner.Process(params->m_functor, params);
@@ -438,7 +451,7 @@ int Measure::IntegrateBoundingBoxXShift(FunctorParams *functorParams)
 
 int Measure::SetAlignmentXPos(FunctorParams *functorParams)
 {
-    SetAlignmentXPosParams *params = dynamic_cast<SetAlignmentXPosParams *>(functorParams);
+    SetAlignmentXPosParams *params = vrv_cast<SetAlignmentXPosParams *>(functorParams);
     assert(params);
 
     m_measureAligner.Process(params->m_functor, params);
@@ -448,7 +461,7 @@ int Measure::SetAlignmentXPos(FunctorParams *functorParams)
 
 int Measure::JustifyX(FunctorParams *functorParams)
 {
-    JustifyXParams *params = dynamic_cast<JustifyXParams *>(functorParams);
+    JustifyXParams *params = vrv_cast<JustifyXParams *>(functorParams);
     assert(params);
 
     if (params->m_measureXRel > 0) {
@@ -465,7 +478,7 @@ int Measure::JustifyX(FunctorParams *functorParams)
 
 int Measure::AlignMeasures(FunctorParams *functorParams)
 {
-    AlignMeasuresParams *params = dynamic_cast<AlignMeasuresParams *>(functorParams);
+    AlignMeasuresParams *params = vrv_cast<AlignMeasuresParams *>(functorParams);
     assert(params);
 
     this->m_drawingXRel = params->m_shift;
@@ -487,7 +500,7 @@ int Measure::ResetDrawing(FunctorParams *functorParams)
 
 int Measure::CastOffSystems(FunctorParams *functorParams)
 {
-    CastOffSystemsParams *params = dynamic_cast<CastOffSystemsParams *>(functorParams);
+    CastOffSystemsParams *params = vrv_cast<CastOffSystemsParams *>(functorParams);
     assert(params);
 
     if ((params->m_currentSystem->GetChildCount() > 0)
@@ -509,7 +522,7 @@ int Measure::CastOffSystems(FunctorParams *functorParams)
     // We want to move the measure to the currentSystem. However, we cannot use DetachChild
     // from the content System because this screws up the iterator. Relinquish gives up
     // the ownership of the Measure - the contentSystem will be deleted afterwards.
-    Measure *measure = dynamic_cast<Measure *>(params->m_contentSystem->Relinquish(this->GetIdx()));
+    Measure *measure = vrv_cast<Measure *>(params->m_contentSystem->Relinquish(this->GetIdx()));
     assert(measure);
     params->m_currentSystem->AddChild(measure);
 
@@ -518,7 +531,7 @@ int Measure::CastOffSystems(FunctorParams *functorParams)
 
 int Measure::CastOffEncoding(FunctorParams *functorParams)
 {
-    CastOffEncodingParams *params = dynamic_cast<CastOffEncodingParams *>(functorParams);
+    CastOffEncodingParams *params = vrv_cast<CastOffEncodingParams *>(functorParams);
     assert(params);
 
     MoveItselfTo(params->m_currentSystem);
@@ -528,7 +541,7 @@ int Measure::CastOffEncoding(FunctorParams *functorParams)
 
 int Measure::SetDrawingXY(FunctorParams *functorParams)
 {
-    SetDrawingXYParams *params = dynamic_cast<SetDrawingXYParams *>(functorParams);
+    SetDrawingXYParams *params = vrv_cast<SetDrawingXYParams *>(functorParams);
     assert(params);
 
     params->m_currentMeasure = this;
@@ -561,14 +574,14 @@ int Measure::SetDrawingXY(FunctorParams *functorParams)
 
 int Measure::FillStaffCurrentTimeSpanningEnd(FunctorParams *functorParams)
 {
-    FillStaffCurrentTimeSpanningParams *params = dynamic_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
+    FillStaffCurrentTimeSpanningParams *params = vrv_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
     assert(params);
 
     std::vector<Object *>::iterator iter = params->m_timeSpanningElements.begin();
     while (iter != params->m_timeSpanningElements.end()) {
         TimeSpanningInterface *interface = (*iter)->GetTimeSpanningInterface();
         assert(interface);
-        Measure *endParent = dynamic_cast<Measure *>(interface->GetEnd()->GetFirstParent(MEASURE));
+        Measure *endParent = vrv_cast<Measure *>(interface->GetEnd()->GetFirstParent(MEASURE));
         assert(endParent);
         // We have reached the end of the spanning - remove it from the list of running elements
         if (endParent == this) {
@@ -583,7 +596,7 @@ int Measure::FillStaffCurrentTimeSpanningEnd(FunctorParams *functorParams)
 
 int Measure::PrepareBoundaries(FunctorParams *functorParams)
 {
-    PrepareBoundariesParams *params = dynamic_cast<PrepareBoundariesParams *>(functorParams);
+    PrepareBoundariesParams *params = vrv_cast<PrepareBoundariesParams *>(functorParams);
     assert(params);
 
     std::vector<BoundaryStartInterface *>::iterator iter;
@@ -605,7 +618,7 @@ int Measure::PrepareBoundaries(FunctorParams *functorParams)
 
 int Measure::PrepareFloatingGrps(FunctorParams *functorParams)
 {
-    PrepareFloatingGrpsParams *params = dynamic_cast<PrepareFloatingGrpsParams *>(functorParams);
+    PrepareFloatingGrpsParams *params = vrv_cast<PrepareFloatingGrpsParams *>(functorParams);
     assert(params);
 
     if (params->m_previousEnding) {
@@ -617,45 +630,9 @@ int Measure::PrepareFloatingGrps(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
-int Measure::PrepareTimePointingEnd(FunctorParams *functorParams)
-{
-    PrepareTimePointingParams *params = dynamic_cast<PrepareTimePointingParams *>(functorParams);
-    assert(params);
-
-    ArrayOfPointingInterClassIdPairs::iterator iter = params->m_timePointingInterfaces.begin();
-    while (iter != params->m_timePointingInterfaces.end()) {
-        iter = params->m_timePointingInterfaces.erase(iter);
-    }
-
-    return FUNCTOR_CONTINUE;
-}
-
-int Measure::PrepareTimeSpanningEnd(FunctorParams *functorParams)
-{
-    PrepareTimeSpanningParams *params = dynamic_cast<PrepareTimeSpanningParams *>(functorParams);
-    assert(params);
-
-    ArrayOfSpanningInterClassIdPairs::iterator iter = params->m_timeSpanningInterfaces.begin();
-    while (iter != params->m_timeSpanningInterfaces.end()) {
-        // At the end of the measure (going backward) we remove element for which we do not need to match the end
-        // (for
-        // now). Eventually, we could consider them, for example if we want to display their spanning or for
-        // improved
-        // midi output
-        if ((iter->second == DIR) || (iter->second == DYNAM) || (iter->second == HARM)) {
-            iter = params->m_timeSpanningInterfaces.erase(iter);
-        }
-        else {
-            iter++;
-        }
-    }
-
-    return FUNCTOR_CONTINUE;
-}
-
 int Measure::PrepareTimestampsEnd(FunctorParams *functorParams)
 {
-    PrepareTimestampsParams *params = dynamic_cast<PrepareTimestampsParams *>(functorParams);
+    PrepareTimestampsParams *params = vrv_cast<PrepareTimestampsParams *>(functorParams);
     assert(params);
 
     ArrayOfObjectBeatPairs::iterator iter = params->m_tstamps.begin();
@@ -716,37 +693,15 @@ int Measure::PrepareTimestampsEnd(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 };
 
-int Measure::GenerateMIDI(FunctorParams *functorParams)
-{
-    GenerateMIDIParams *params = dynamic_cast<GenerateMIDIParams *>(functorParams);
-    assert(params);
-
-    // Here we need to reset the currentMeasureTime because we are starting a new measure
-    params->m_currentMeasureTime = 0;
-
-    return FUNCTOR_CONTINUE;
-}
-
-int Measure::GenerateMIDIEnd(FunctorParams *functorParams)
-{
-    GenerateMIDIParams *params = dynamic_cast<GenerateMIDIParams *>(functorParams);
-    assert(params);
-
-    // We a to the total time the maximum duration of the measure so if there is no layer, if the layer is not full
-    // or
-    // if there is an encoding error in the measure, the next one will be properly aligned
-    assert(!params->m_maxValues.empty());
-    params->m_totalTime += params->m_maxValues.front();
-    params->m_maxValues.erase(params->m_maxValues.begin());
-
-    return FUNCTOR_CONTINUE;
-}
-
 int Measure::CalcMaxMeasureDuration(FunctorParams *functorParams)
 {
-    CalcMaxMeasureDurationParams *params = dynamic_cast<CalcMaxMeasureDurationParams *>(functorParams);
+    CalcMaxMeasureDurationParams *params = vrv_cast<CalcMaxMeasureDurationParams *>(functorParams);
     assert(params);
 
+    // The onset of the measure is the one of the previous measure plus its maximum duration
+    if (!params->m_maxValues.empty()) params->m_currentOnset += params->m_maxValues.back();
+    params->m_measureOnsets[this] = params->m_currentOnset;
+
     // We just need to add a value to the stack
     params->m_maxValues.push_back(0.0);
 
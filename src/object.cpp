@@ -12,7 +12,10 @@
 #include <assert.h>
 #include <iostream>
 #include <math.h>
+#include <random>
 #include <sstream>
+#include <string.h>
+#include <thread>
 
 //----------------------------------------------------------------------------
 
@@ -41,26 +44,161 @@
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// ProcessStack
+//----------------------------------------------------------------------------
+
+/** The number of frames of a ProcessStack that are not allocated on the heap **/
+#define PROCESS_STACK_SIZE 64
+
+/**
+ * A frame of the stack used in Object::Process, i.e., an Object whose children are being processed
+ */
+struct ProcessFrame {
+    Object *m_object;
+    int m_deepness;
+    // The index of the next child (FORWARD) or of the last child processed (BACKWARD)
+    int m_childIdx;
+    bool m_processChildren;
+};
+
+/**
+ * The explicit stack used in Object::Process.
+ * The frames are kept in a fixed size buffer and are moved to the heap only beyond PROCESS_STACK_SIZE levels,
+ * which means that no memory is allocated in practice. Since the frames can be moved, a reference
+ * returned by Top() is not valid anymore after a Push().
+ */
+class ProcessStack {
+public:
+    ProcessStack()
+    {
+        m_frames = m_buffer;
+        m_size = 0;
+        m_capacity = PROCESS_STACK_SIZE;
+    }
+
+    bool IsEmpty() const { return (m_size == 0); }
+
+    ProcessFrame &Top() { return m_frames[m_size - 1]; }
+
+    void Push(Object *object, int deepness, int childIdx, bool processChildren)
+    {
+        if (m_size == m_capacity) this->Grow();
+        ProcessFrame *frame = &m_frames[m_size++];
+        frame->m_object = object;
+        frame->m_deepness = deepness;
+        frame->m_childIdx = childIdx;
+        frame->m_processChildren = processChildren;
+    }
+
+    void Pop()
+    {
+        assert(m_size > 0);
+        m_size--;
+    }
+
+private:
+    void Grow()
+    {
+        std::vector<ProcessFrame> frames(m_frames, m_frames + m_size);
+        m_capacity *= 2;
+        frames.resize(m_capacity);
+        m_heap.swap(frames);
+        m_frames = &m_heap[0];
+    }
+
+    ProcessFrame m_buffer[PROCESS_STACK_SIZE];
+    std::vector<ProcessFrame> m_heap;
+    ProcessFrame *m_frames;
+    int m_size;
+    int m_capacity;
+};
+
 //----------------------------------------------------------------------------
 // Object
 //----------------------------------------------------------------------------
 
-unsigned long Object::s_objectCounter = 0;
+/**
+ * The size of the header preceding each object in memory. It holds the ObjectArena the object was
+ * allocated in (or NULL) and the size of the object, and keeps the object aligned as with the default
+ * operator new.
+ */
+#define OBJECT_ALLOCATION_HEADER 16
+
+struct ObjectAllocationHeader {
+    ObjectArena *m_arena;
+    size_t m_size;
+};
+
+/**
+ * The memory returned by the last call to Object::operator new and not claimed yet by an object constructor.
+ */
+static thread_local char *s_pendingAllocation = NULL;
+
+/**
+ * The generator for the uuids of the objects that are not in a Doc. There is one per thread, so toolkits running in
+ * different threads do not share it. It is seeded on its first use if Object::SeedUuid has not been called before in
+ * the thread.
+ */
+static thread_local std::mt19937_64 s_uuidGenerator;
+static thread_local bool s_uuidGeneratorSeeded = false;
+
+AttClassSet Object::s_attClasses[UNSPECIFIED + 1];
+
+InterfaceSet Object::s_interfaces[UNSPECIFIED + 1];
+
+void *Object::operator new(size_t size)
+{
+    static_assert(sizeof(ObjectAllocationHeader) <= OBJECT_ALLOCATION_HEADER, "Allocation header too large");
+
+    ObjectArena *arena = ObjectArena::GetActive();
+    char *memory = NULL;
+    if (arena) {
+        memory = static_cast<char *>(arena->Allocate(size + OBJECT_ALLOCATION_HEADER));
+    }
+    else {
+        memory = static_cast<char *>(::operator new(size + OBJECT_ALLOCATION_HEADER));
+    }
+    ObjectAllocationHeader *header = reinterpret_cast<ObjectAllocationHeader *>(memory);
+    header->m_arena = arena;
+    header->m_size = size;
+    s_pendingAllocation = memory + OBJECT_ALLOCATION_HEADER;
+    return memory + OBJECT_ALLOCATION_HEADER;
+}
+
+void Object::operator delete(void *ptr)
+{
+    if (!ptr) return;
+    char *memory = static_cast<char *>(ptr) - OBJECT_ALLOCATION_HEADER;
+    // The memory of objects allocated in an arena is released with the arena
+    if (reinterpret_cast<ObjectAllocationHeader *>(memory)->m_arena) return;
+    ::operator delete(memory);
+}
+
+void Object::InitAllocation()
+{
+    // The Object part is constructed first and is at the beginning of the memory, so an object created
+    // with Object::operator new is at the address it last returned. Members that are objects themselves
+    // are constructed after and do not match anymore.
+    m_isAllocated = (reinterpret_cast<char *>(this) == s_pendingAllocation);
+    if (m_isAllocated) s_pendingAllocation = NULL;
+}
+
+size_t Object::GetAllocatedSize() const
+{
+    if (!m_isAllocated) return 0;
+    const char *memory = reinterpret_cast<const char *>(this) - OBJECT_ALLOCATION_HEADER;
+    return reinterpret_cast<const ObjectAllocationHeader *>(memory)->m_size;
+}
 
 Object::Object() : BoundingBox()
 {
     Init("m-");
-    if (s_objectCounter++ == 0) {
-        SeedUuid();
-    }
 }
 
-Object::Object(std::string classid) : BoundingBox()
+Object::Object(const char *classid) : BoundingBox()
 {
     Init(classid);
-    if (s_objectCounter++ == 0) {
-        SeedUuid();
-    }
 }
 
 Object *Object::Clone() const
@@ -75,10 +213,16 @@ Object::Object(const Object &object) : BoundingBox(object)
     ClearChildren();
     ResetBoundingBox(); // It does not make sense to keep the values of the BBox
     m_parent = NULL;
+    this->InitAllocation();
     m_classid = object.m_classid;
-    m_svgclass = object.m_svgclass;
-    m_uuid = object.m_uuid; // for now copy the uuid - to be decided
+    m_rareMembers = NULL;
+    if (object.HasSVGClass()) this->SetSVGClass(object.GetSVGClass());
+    // The constructors of the copy do not register anything
+    m_registeredClassId = object.m_registeredClassId;
+    m_uuid = object.GetUuid(); // for now copy the uuid - to be decided
     m_isModified = true;
+    m_idxCache = -1;
+    m_iteratorIdx = -1;
 
     int i;
     for (i = 0; i < (int)object.m_children.size(); i++) {
@@ -96,11 +240,16 @@ Object &Object::operator=(const Object &object)
     if (this != &object) {
         ClearChildren();
         ResetBoundingBox(); // It does not make sense to keep the values of the BBox
+        // The uuid index refers to the uuid string of the object, which is about to change
+        Doc *doc = this->GetUuidIndexDoc();
+        if (doc && (doc != this)) doc->RemoveFromUuidIndex(this, false);
         m_parent = NULL;
         m_classid = object.m_classid;
-        m_svgclass = object.m_svgclass;
-        m_uuid = object.m_uuid; // for now copy the uuid - to be decided
+        if (m_rareMembers || object.HasSVGClass()) this->SetSVGClass(object.GetSVGClass());
+        m_uuid = object.GetUuid(); // for now copy the uuid - to be decided
         m_isModified = true;
+        m_idxCache = -1;
+        m_iteratorIdx = -1;
 
         int i;
         for (i = 0; i < (int)object.m_children.size(); i++) {
@@ -117,15 +266,20 @@ Object &Object::operator=(const Object &object)
 Object::~Object()
 {
     ClearChildren();
+    if (m_rareMembers) delete m_rareMembers;
 }
 
-void Object::Init(std::string classid)
+void Object::Init(const char *classid)
 {
+    this->InitAllocation();
     m_parent = NULL;
+    m_rareMembers = NULL;
+    m_registeredClassId = UNSPECIFIED;
     m_isAttribute = false;
     m_isModified = true;
+    m_idxCache = -1;
+    m_iteratorIdx = -1;
     m_classid = classid;
-    this->GenerateUuid();
 
     Reset();
 }
@@ -143,10 +297,28 @@ void Object::Reset()
     ResetBoundingBox();
 };
 
-void Object::RegisterInterface(std::vector<AttClassId> *attClasses, InterfaceId interfaceId)
+void Object::UpdateRegisteredClassId()
+{
+    // The constructors are run from the base class to the child class and Is() returns the ClassId of the one
+    // being run. The registrations of the previous constructors are added to the new ClassId
+    const ClassId classId = this->Is();
+    if (classId == m_registeredClassId) return;
+    s_attClasses[classId].Merge(s_attClasses[m_registeredClassId]);
+    s_interfaces[classId].Merge(s_interfaces[m_registeredClassId]);
+    m_registeredClassId = classId;
+}
+
+void Object::RegisterAttClass(AttClassId attClassId)
 {
-    m_attClasses.insert(m_attClasses.end(), attClasses->begin(), attClasses->end());
-    m_interfaces.push_back(interfaceId);
+    this->UpdateRegisteredClassId();
+    s_attClasses[m_registeredClassId].Set(attClassId);
+}
+
+void Object::RegisterInterface(const AttClassSet *attClasses, InterfaceId interfaceId)
+{
+    this->UpdateRegisteredClassId();
+    s_attClasses[m_registeredClassId].Merge(*attClasses);
+    s_interfaces[m_registeredClassId].Set(interfaceId);
 }
 
 bool Object::IsBoundaryElement()
@@ -195,39 +367,89 @@ void Object::MoveItselfTo(Object *targetParent)
 
 void Object::SetUuid(std::string uuid)
 {
+    if (m_uuid == uuid) return;
+
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc) doc->RemoveFromUuidIndex(this, false);
     m_uuid = uuid;
+    if (doc) doc->AddToUuidIndex(this, false);
 };
 
-std::string Object::GetSVGClass(void)
+ObjectRareMembers *Object::GetRareMembers()
+{
+    if (!m_rareMembers) m_rareMembers = new ObjectRareMembers();
+    return m_rareMembers;
+}
+
+std::string Object::GetSVGClass(void) const
 {
-    return m_svgclass;
+    return (m_rareMembers) ? m_rareMembers->m_svgclass : "";
 }
 
 void Object::SetSVGClass(const std::string &classcontent)
 {
-    m_svgclass = classcontent;
+    GetRareMembers()->m_svgclass = classcontent;
 }
 
 void Object::AddSVGClass(const std::string &classname)
 {
-    if (HasSVGClass()) {
-        m_svgclass += " ";
+    ObjectRareMembers *rareMembers = GetRareMembers();
+    if (!rareMembers->m_svgclass.empty()) {
+        rareMembers->m_svgclass += " ";
     }
-    m_svgclass += classname;
+    rareMembers->m_svgclass += classname;
 }
 
-bool Object::HasSVGClass(void)
+bool Object::HasSVGClass(void) const
 {
-    return !m_svgclass.empty();
+    return (m_rareMembers && !m_rareMembers->m_svgclass.empty());
+}
+
+std::string Object::GetComment() const
+{
+    return (m_rareMembers) ? m_rareMembers->m_comment : "";
+}
+
+void Object::SetComment(std::string comment)
+{
+    GetRareMembers()->m_comment = comment;
+}
+
+bool Object::HasComment(void) const
+{
+    return (m_rareMembers && !m_rareMembers->m_comment.empty());
+}
+
+const ArrayOfPooledStrAttr *Object::GetUnsupported() const
+{
+    return (m_rareMembers) ? &m_rareMembers->m_unsupported : NULL;
+}
+
+void Object::AddUnsupported(const std::string *name, const std::string *value)
+{
+    assert(name && value);
+    this->GetRareMembers()->m_unsupported.push_back(std::make_pair(name, value));
 }
 
 void Object::ClearChildren()
 {
+    if (m_children.empty()) return;
+
+    Doc *doc = this->GetUuidIndexDoc();
+    // all the indexed objects are removed, so simply empty the index
+    if (doc == this) {
+        doc->ResetUuidIndex();
+        doc = NULL;
+    }
+
     ArrayOfObjects::iterator iter;
     for (iter = m_children.begin(); iter != m_children.end(); ++iter) {
         // we need to check if this is the parent
         // ownership might have been given up with Relinquish
         if ((*iter)->m_parent == this) {
+            if (doc) doc->RemoveFromUuidIndex(*iter);
+            // the child is detached so the index is not looked up again when deleting its own children
+            (*iter)->m_parent = NULL;
             delete *iter;
         }
     }
@@ -270,16 +492,18 @@ bool Object::HasAttribute(std::string attribute, std::string value) const
 Object *Object::GetFirst(const ClassId classId)
 {
     m_iteratorElementType = classId;
-    m_iteratorEnd = m_children.end();
-    m_iteratorCurrent = std::find_if(m_children.begin(), m_iteratorEnd, ObjectComparison(m_iteratorElementType));
-    return (m_iteratorCurrent == m_iteratorEnd) ? NULL : *m_iteratorCurrent;
+    m_iteratorIdx = -1;
+    return this->GetNext();
 }
 
 Object *Object::GetNext()
 {
-    m_iteratorCurrent++;
-    m_iteratorCurrent = std::find_if(m_iteratorCurrent, m_iteratorEnd, ObjectComparison(m_iteratorElementType));
-    return (m_iteratorCurrent == m_iteratorEnd) ? NULL : *m_iteratorCurrent;
+    ObjectComparison comparison(m_iteratorElementType);
+    const int count = (int)m_children.size();
+    for (m_iteratorIdx++; m_iteratorIdx < count; m_iteratorIdx++) {
+        if (comparison(m_children.at(m_iteratorIdx))) return m_children.at(m_iteratorIdx);
+    }
+    return NULL;
 }
 
 Object *Object::GetLast() const
@@ -295,6 +519,15 @@ int Object::GetIdx() const
     return m_parent->GetChildIndex(this);
 }
 
+void Object::UpdateChildIdxCache()
+{
+    int i;
+    for (i = 0; i < (int)m_children.size(); i++) {
+        Object *child = m_children.at(i);
+        if (child->m_parent == this) child->m_idxCache = i;
+    }
+}
+
 void Object::InsertChild(Object *element, int idx)
 {
     // With this method we require the parent to be set before
@@ -306,6 +539,7 @@ void Object::InsertChild(Object *element, int idx)
     }
     ArrayOfObjects::iterator iter = m_children.begin();
     m_children.insert(iter + (idx), element);
+    element->m_idxCache = idx;
 }
 
 Object *Object::DetachChild(int idx)
@@ -314,6 +548,8 @@ Object *Object::DetachChild(int idx)
         return NULL;
     }
     Object *child = m_children.at(idx);
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc) doc->RemoveFromUuidIndex(child);
     child->m_parent = NULL;
     ArrayOfObjects::iterator iter = m_children.begin();
     m_children.erase(iter + (idx));
@@ -326,6 +562,8 @@ Object *Object::Relinquish(int idx)
         return NULL;
     }
     Object *child = m_children.at(idx);
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc) doc->RemoveFromUuidIndex(child);
     child->m_parent = NULL;
     return child;
 }
@@ -342,8 +580,14 @@ void Object::ClearRelinquishedChildren()
     }
 }
 
-Object *Object::FindChildByUuid(std::string uuid, int deepness, bool direction)
+Object *Object::FindChildByUuid(const std::string &uuid, int deepness, bool direction)
 {
+    // With no depth limit, we can use the uuid index of the document
+    if (deepness == UNLIMITED_DEPTH) {
+        Doc *doc = this->GetUuidIndexDoc();
+        if (doc) return doc->FindInUuidIndex(uuid, this);
+    }
+
     Functor findByUuid(&Object::FindByUuid);
     FindByUuidParams findbyUuidParams;
     findbyUuidParams.m_uuid = uuid;
@@ -397,42 +641,72 @@ void Object::RemoveChildAt(int idx)
     if (idx >= (int)m_children.size()) {
         return;
     }
-    delete m_children.at(idx);
+    Object *child = m_children.at(idx);
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc) doc->RemoveFromUuidIndex(child);
+    child->m_parent = NULL;
+    delete child;
     ArrayOfObjects::iterator iter = m_children.begin();
     m_children.erase(iter + (idx));
 }
 
-void Object::GenerateUuid()
+void Object::GenerateUuid() const
 {
-    int nr = std::rand();
-    char str[17];
-    // I do not want to use a stream for doing this!
-    snprintf(str, 16, "%016d", nr);
+    Doc *doc = this->GetUuidIndexDoc();
+    uint64_t nr;
+    if (doc) {
+        nr = doc->GenerateUuidNumber();
+    }
+    else {
+        if (!s_uuidGeneratorSeeded) SeedUuid();
+        nr = s_uuidGenerator();
+    }
 
-    m_uuid = m_classid + std::string(str);
-    std::transform(m_uuid.begin(), m_uuid.end(), m_uuid.begin(), ::tolower);
+    // The lower case classid followed by 15 digits
+    char str[UUID_DIGITS];
+    nr %= 1000000000000000ULL;
+    for (int i = UUID_DIGITS - 1; i >= 0; --i) {
+        str[i] = '0' + (char)(nr % 10);
+        nr /= 10;
+    }
+    m_uuid.reserve(strlen(m_classid) + UUID_DIGITS);
+    for (const char *c = m_classid; *c; ++c) {
+        m_uuid.push_back((char)::tolower(*c));
+    }
+    m_uuid.append(str, UUID_DIGITS);
+
+    // The document itself is not in its index
+    if (doc && (doc != this)) doc->AddToUuidIndex(const_cast<Object *>(this), false);
 }
 
 void Object::ResetUuid()
 {
-    GenerateUuid();
+    // The new uuid will be generated when needed
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc) doc->RemoveFromUuidIndex(this, false);
+    m_uuid.clear();
 }
 
 void Object::SeedUuid(unsigned int seed)
 {
     // Init random number generator for uuids
     if (seed == 0) {
-        std::srand((unsigned int)std::time(0));
-    }
-    else {
-        std::srand(seed);
+        // Combine the time with the thread for threads starting at the same time
+        seed = (unsigned int)std::time(0) ^ (unsigned int)std::hash<std::thread::id>()(std::this_thread::get_id());
     }
+    s_uuidGenerator.seed(seed);
+    s_uuidGeneratorSeeded = true;
 }
 
 void Object::SetParent(Object *parent)
 {
     assert(!m_parent);
     m_parent = parent;
+    // The object is expected to be appended to the children - otherwise it will be updated
+    m_idxCache = (int)parent->m_children.size();
+
+    Doc *doc = this->GetUuidIndexDoc();
+    if (doc) doc->AddToUuidIndex(this);
 }
 
 void Object::AddChild(Object *child)
@@ -441,8 +715,33 @@ void Object::AddChild(Object *child)
     assert(false);
 }
 
+Doc *Object::GetUuidIndexDoc() const
+{
+    const Object *root = this;
+    while (root->m_parent) {
+        root = root->m_parent;
+    }
+    // We cannot use Is() because this is also called from the destructors
+    return dynamic_cast<Doc *>(const_cast<Object *>(root));
+}
+
 int Object::GetChildIndex(const Object *child)
 {
+    // First check the cached index - this is the case unless children were inserted or removed before the child
+    int idx = child->m_idxCache;
+    if ((idx >= 0) && (idx < (int)m_children.size()) && (m_children.at(idx) == child)) {
+        return idx;
+    }
+
+    // Otherwise update all the cached indexes in one go
+    if (child->m_parent == this) {
+        this->UpdateChildIdxCache();
+        idx = child->m_idxCache;
+        if ((idx >= 0) && (idx < (int)m_children.size()) && (m_children.at(idx) == child)) {
+            return idx;
+        }
+    }
+
     ArrayOfObjects::iterator iter;
     int i;
     for (iter = m_children.begin(), i = 0; iter != m_children.end(); ++iter, i++) {
@@ -500,83 +799,171 @@ Object *Object::GetLastParentNot(const ClassId classId, int maxDepth)
 void Object::Process(Functor *functor, FunctorParams *functorParams, Functor *endFunctor,
     ArrayOfAttComparisons *filters, int deepness, bool direction)
 {
-    if (functor->m_returnCode == FUNCTOR_STOP) {
-        return;
+    // The filters are looked up by ClassId - for each type only the first AttComparison is used
+    AttComparison *filterTable[UNSPECIFIED + 1];
+    bool hasFilters = (filters && !filters->empty());
+    if (hasFilters) {
+        std::fill(filterTable, filterTable + UNSPECIFIED + 1, (AttComparison *)NULL);
+        ArrayOfAttComparisons::iterator attComparisonIter;
+        for (attComparisonIter = filters->begin(); attComparisonIter != filters->end(); attComparisonIter++) {
+            ClassId classId = (*attComparisonIter)->GetType();
+            if (!filterTable[classId]) filterTable[classId] = *attComparisonIter;
+        }
     }
 
-    bool processChildren = true;
-    if (functor->m_visibleOnly && this->IsEditorialElement()) {
-        EditorialElement *editorialElement = dynamic_cast<EditorialElement *>(this);
-        assert(editorialElement);
-        if (editorialElement->m_visibility == Hidden) {
-            processChildren = false;
+    // The tree is processed depth-first with an explicit stack of the objects whose children are processed
+    ProcessStack stack;
+    Object *current = this;
+    while (true) {
+        if (current && (functor->m_returnCode != FUNCTOR_STOP)) {
+            bool isEditorialElement = current->IsEditorialElement();
+            bool processChildren = true;
+            if (functor->m_visibleOnly && isEditorialElement) {
+                EditorialElement *editorialElement = vrv_cast<EditorialElement *>(current);
+                assert(editorialElement);
+                if (editorialElement->m_visibility == Hidden) {
+                    processChildren = false;
+                }
+            }
+
+            functor->Call(current, functorParams);
+
+            // do not go any deeper in this case (and do not call the end functor)
+            if (functor->m_returnCode == FUNCTOR_SIBLINGS) {
+                functor->m_returnCode = FUNCTOR_CONTINUE;
+            }
+            else {
+                // since editorial object doesn't count, we increase the deepness limit
+                if (isEditorialElement) deepness++;
+                if (deepness != 0) {
+                    // objects without children to process do not need a frame
+                    if (!processChildren || current->m_children.empty()) {
+                        if (endFunctor) endFunctor->Call(current, functorParams);
+                    }
+                    else {
+                        int childIdx = (direction == BACKWARD) ? (int)current->m_children.size() : 0;
+                        stack.Push(current, deepness - 1, childIdx, processChildren);
+                    }
+                }
+            }
         }
-    }
 
-    functor->Call(this, functorParams);
+        if (stack.IsEmpty()) break;
+
+        // Look for the next child to process in the object on top of the stack
+        ProcessFrame &frame = stack.Top();
+        current = NULL;
+        if (frame.m_processChildren && (functor->m_returnCode != FUNCTOR_STOP)) {
+            ArrayOfObjects &children = frame.m_object->m_children;
+            while (true) {
+                Object *child = NULL;
+                if (direction == BACKWARD) {
+                    if (frame.m_childIdx <= 0) break;
+                    child = children[--frame.m_childIdx];
+                }
+                else {
+                    if (frame.m_childIdx >= (int)children.size()) break;
+                    child = children[frame.m_childIdx++];
+                }
+                if (hasFilters) {
+                    // use the AttComparison object for the child type (e.g., a Staff) to evaluate the attribute
+                    AttComparison *attComparison = filterTable[child->Is()];
+                    if (attComparison) {
+                        // the attribute value does not match, skip this child
+                        if (!(*attComparison)(child)) continue;
+                        // the attribute value matches, process the object but none of its following siblings
+                        frame.m_processChildren = false;
+                    }
+                }
+                current = child;
+                deepness = frame.m_deepness;
+                break;
+            }
+        }
+        if (current) continue;
 
-    // do not go any deeper in this case
-    if (functor->m_returnCode == FUNCTOR_SIBLINGS) {
-        functor->m_returnCode = FUNCTOR_CONTINUE;
-        return;
+        // We are done with the children of the object
+        Object *object = frame.m_object;
+        stack.Pop();
+        if (endFunctor) endFunctor->Call(object, functorParams);
     }
-    else if (this->IsEditorialElement()) {
-        // since editorial object doesn't count, we increase the deepness limit
-        deepness++;
+}
+
+void Object::Process(FunctorGroup *functorGroup, int deepness, bool direction)
+{
+    assert(functorGroup);
+
+    if (functorGroup->GetCount() == 0) return;
+
+    // All functors of the group are processing the object
+    unsigned int active = 0;
+    int i;
+    for (i = 0; i < functorGroup->GetCount(); ++i) active |= (1u << i);
+
+    this->ProcessGroup(functorGroup, active, deepness, direction);
+}
+
+void Object::ProcessGroup(FunctorGroup *functorGroup, unsigned int active, int deepness, bool direction)
+{
+    bool isHidden = false;
+    if (this->IsEditorialElement()) {
+        EditorialElement *editorialElement = vrv_cast<EditorialElement *>(this);
+        assert(editorialElement);
+        isHidden = (editorialElement->m_visibility == Hidden);
     }
-    if (deepness == 0) {
-        // any need to change the functor m_returnCode?
-        return;
+
+    // The functors that were called on the object (and for which the end functor will be called)
+    unsigned int called = 0;
+    // The functors that will process the children
+    unsigned int processChildren = 0;
+
+    int i;
+    int count = functorGroup->GetCount();
+    for (i = 0; i < count; ++i) {
+        unsigned int bit = (1u << i);
+        if (!(active & bit)) continue;
+        Functor *functor = functorGroup->m_functors.at(i);
+        if (functor->m_returnCode == FUNCTOR_STOP) continue;
+
+        functor->Call(this, functorGroup->m_functorParams.at(i));
+
+        // do not go any deeper for this functor
+        if (functor->m_returnCode == FUNCTOR_SIBLINGS) {
+            functor->m_returnCode = FUNCTOR_CONTINUE;
+            continue;
+        }
+        called |= bit;
+        if (functor->m_returnCode == FUNCTOR_STOP) continue;
+        if (functor->m_visibleOnly && isHidden) continue;
+        processChildren |= bit;
     }
+
+    if (!called) return;
+
+    // since editorial object doesn't count, we increase the deepness limit
+    if (this->IsEditorialElement()) deepness++;
+    if (deepness == 0) return;
     deepness--;
 
     if (processChildren) {
-        ArrayOfObjects::iterator iter;
-        // We need a pointer to the array for the option to work on a reversed copy
-        ArrayOfObjects *children = &this->m_children;
-        ArrayOfObjects reversed;
-        // For processing backwards, we operated on a copied reversed version
-        // Since we hold pointers, only addresses are copied
         if (direction == BACKWARD) {
-            reversed = (*children);
-            std::reverse(reversed.begin(), reversed.end());
-            children = &reversed;
+            ArrayOfObjects::reverse_iterator riter;
+            for (riter = m_children.rbegin(); riter != m_children.rend(); ++riter) {
+                (*riter)->ProcessGroup(functorGroup, processChildren, deepness, direction);
+            }
         }
-        for (iter = children->begin(); iter != children->end(); ++iter) {
-            if (filters && !filters->empty()) {
-                bool hasAttComparison = false;
-                // first we look if there is a comparison object for the object type (e.g., a Staff)
-                ArrayOfAttComparisons::iterator attComparisonIter;
-                for (attComparisonIter = filters->begin(); attComparisonIter != filters->end(); attComparisonIter++) {
-                    // if yes, we will use it (*attComparisonIter) for evaluating if the object matches
-                    // the attribute (see below)
-                    Object *o = *iter;
-                    if (o->Is() == (*attComparisonIter)->GetType()) {
-                        hasAttComparison = true;
-                        break;
-                    }
-                }
-                if (hasAttComparison) {
-                    // use the operator of the AttComparison object to evaluate the attribute
-                    if ((**attComparisonIter)(*iter)) {
-                        // the attribute value matches, process the object
-                        // LogDebug("%s ", (*iter)->GetClassName().c_str());
-                        (*iter)->Process(functor, functorParams, endFunctor, filters, deepness, direction);
-                        break;
-                    }
-                    else {
-                        // the attribute value does not match, skip this child
-                        continue;
-                    }
-                }
+        else {
+            ArrayOfObjects::iterator iter;
+            for (iter = m_children.begin(); iter != m_children.end(); ++iter) {
+                (*iter)->ProcessGroup(functorGroup, processChildren, deepness, direction);
             }
-            // we will end here if there is no filter at all or for the current child type
-            (*iter)->Process(functor, functorParams, endFunctor, filters, deepness, direction);
         }
     }
 
-    if (endFunctor) {
-        endFunctor->Call(this, functorParams);
+    for (i = 0; i < count; ++i) {
+        if (!(called & (1u << i))) continue;
+        Functor *endFunctor = functorGroup->m_endFunctors.at(i);
+        if (endFunctor) endFunctor->Call(this, functorGroup->m_functorParams.at(i));
     }
 }
 
@@ -708,7 +1095,7 @@ std::wstring TextListInterface::GetText(Object *node)
     std::wstring concatText;
     ListOfObjects *childList = this->GetList(node); // make sure it's initialized
     for (ListOfObjects::iterator it = childList->begin(); it != childList->end(); it++) {
-        Text *text = dynamic_cast<Text *>(*it);
+        Text *text = vrv_cast<Text *>(*it);
         assert(text);
         concatText += text->GetText();
     }
@@ -753,13 +1140,113 @@ void Functor::Call(Object *ptr, FunctorParams *functorParams)
     m_returnCode = (*ptr.*obj_fpt)(functorParams);
 }
 
+//----------------------------------------------------------------------------
+// FunctorGroup
+//----------------------------------------------------------------------------
+
+void FunctorGroup::Add(Functor *functor, FunctorParams *functorParams, Functor *endFunctor)
+{
+    assert(functor);
+    assert(m_functors.size() < MAX_FUNCTOR_GROUP_SIZE);
+
+    m_functors.push_back(functor);
+    m_functorParams.push_back(functorParams);
+    m_endFunctors.push_back(endFunctor);
+}
+
+//----------------------------------------------------------------------------
+// ObjectArena
+//----------------------------------------------------------------------------
+
+thread_local ObjectArena *ObjectArena::s_active = NULL;
+
+ObjectArena::ObjectArena()
+{
+    m_current = NULL;
+    m_remaining = 0;
+    m_allocationCount = 0;
+    m_allocatedSize = 0;
+}
+
+ObjectArena::~ObjectArena()
+{
+    if (s_active == this) ObjectArena::Deactivate();
+    Clear();
+}
+
+void *ObjectArena::Allocate(size_t size)
+{
+    // Keep the blocks aligned on the header size
+    size = (size + OBJECT_ALLOCATION_HEADER - 1) & ~((size_t)OBJECT_ALLOCATION_HEADER - 1);
+
+    if (size > m_remaining) {
+        // Objects larger than a quarter of a block get a block of their own so the current one is kept
+        if (size > OBJECT_ARENA_BLOCK_SIZE / 4) {
+            char *block = static_cast<char *>(::operator new(size));
+            m_blocks.push_back(block);
+            m_allocationCount++;
+            m_allocatedSize += size;
+            return block;
+        }
+        m_current = static_cast<char *>(::operator new(OBJECT_ARENA_BLOCK_SIZE));
+        m_blocks.push_back(m_current);
+        m_remaining = OBJECT_ARENA_BLOCK_SIZE;
+    }
+
+    char *memory = m_current;
+    m_current += size;
+    m_remaining -= size;
+    m_allocationCount++;
+    m_allocatedSize += size;
+    return memory;
+}
+
+void ObjectArena::Clear()
+{
+    std::vector<char *>::iterator iter;
+    for (iter = m_blocks.begin(); iter != m_blocks.end(); ++iter) {
+        ::operator delete(*iter);
+    }
+    m_blocks.clear();
+    m_current = NULL;
+    m_remaining = 0;
+    m_allocationCount = 0;
+    m_allocatedSize = 0;
+}
+
+void ObjectArena::Activate()
+{
+    assert(!s_active || (s_active == this));
+    s_active = this;
+}
+
+void ObjectArena::Deactivate()
+{
+    s_active = NULL;
+}
+
 //----------------------------------------------------------------------------
 // Object functor methods
 //----------------------------------------------------------------------------
 
+int Object::CalcMemoryFootprint(FunctorParams *functorParams)
+{
+    CalcMemoryFootprintParams *params = vrv_cast<CalcMemoryFootprintParams *>(functorParams);
+    assert(params);
+
+    const ClassId classId = this->Is();
+    if (params->m_counts.count(classId) == 0) {
+        params->m_classNames[classId] = this->GetClassName();
+    }
+    params->m_counts[classId]++;
+    params->m_sizes[classId] += this->GetAllocatedSize();
+
+    return FUNCTOR_CONTINUE;
+}
+
 int Object::AddLayerElementToFlatList(FunctorParams *functorParams)
 {
-    AddLayerElementToFlatListParams *params = dynamic_cast<AddLayerElementToFlatListParams *>(functorParams);
+    AddLayerElementToFlatListParams *params = vrv_cast<AddLayerElementToFlatListParams *>(functorParams);
     assert(params);
 
     params->m_flatList->push_back(this);
@@ -769,7 +1256,7 @@ int Object::AddLayerElementToFlatList(FunctorParams *functorParams)
 
 int Object::FindByUuid(FunctorParams *functorParams)
 {
-    FindByUuidParams *params = dynamic_cast<FindByUuidParams *>(functorParams);
+    FindByUuidParams *params = vrv_cast<FindByUuidParams *>(functorParams);
     assert(params);
 
     if (params->m_element) {
@@ -777,7 +1264,8 @@ int Object::FindByUuid(FunctorParams *functorParams)
         return FUNCTOR_STOP;
     }
 
-    if (params->m_uuid == this->GetUuid()) {
+    // Do not generate the uuid of the objects that do not have one yet since it cannot be the one we look for
+    if (this->HasUuid() && (params->m_uuid == this->GetUuid())) {
         params->m_element = this;
         // LogDebug("Found it!");
         return FUNCTOR_STOP;
@@ -788,7 +1276,7 @@ int Object::FindByUuid(FunctorParams *functorParams)
 
 int Object::FindByAttComparison(FunctorParams *functorParams)
 {
-    FindByAttComparisonParams *params = dynamic_cast<FindByAttComparisonParams *>(functorParams);
+    FindByAttComparisonParams *params = vrv_cast<FindByAttComparisonParams *>(functorParams);
     assert(params);
 
     if (params->m_element) {
@@ -808,7 +1296,7 @@ int Object::FindByAttComparison(FunctorParams *functorParams)
 
 int Object::FindExtremeByAttComparison(FunctorParams *functorParams)
 {
-    FindExtremeByAttComparisonParams *params = dynamic_cast<FindExtremeByAttComparisonParams *>(functorParams);
+    FindExtremeByAttComparisonParams *params = vrv_cast<FindExtremeByAttComparisonParams *>(functorParams);
     assert(params);
 
     // evaluate by applying the AttComparison operator()
@@ -821,7 +1309,7 @@ int Object::FindExtremeByAttComparison(FunctorParams *functorParams)
 
 int Object::FindAllByAttComparison(FunctorParams *functorParams)
 {
-    FindAllByAttComparisonParams *params = dynamic_cast<FindAllByAttComparisonParams *>(functorParams);
+    FindAllByAttComparisonParams *params = vrv_cast<FindAllByAttComparisonParams *>(functorParams);
     assert(params);
 
     // evaluate by applying the AttComparison operator()
@@ -834,14 +1322,14 @@ int Object::FindAllByAttComparison(FunctorParams *functorParams)
 
 int Object::SetCautionaryScoreDef(FunctorParams *functorParams)
 {
-    SetCautionaryScoreDefParams *params = dynamic_cast<SetCautionaryScoreDefParams *>(functorParams);
+    SetCautionaryScoreDefParams *params = vrv_cast<SetCautionaryScoreDefParams *>(functorParams);
     assert(params);
 
     assert(params->m_currentScoreDef);
 
     // starting a new staff
     if (this->Is() == STAFF) {
-        Staff *staff = dynamic_cast<Staff *>(this);
+        Staff *staff = vrv_cast<Staff *>(this);
         assert(staff);
         params->m_currentStaffDef = params->m_currentScoreDef->GetStaffDef(staff->GetN());
         return FUNCTOR_CONTINUE;
@@ -849,7 +1337,7 @@ int Object::SetCautionaryScoreDef(FunctorParams *functorParams)
 
     // starting a new layer
     if (this->Is() == LAYER) {
-        Layer *layer = dynamic_cast<Layer *>(this);
+        Layer *layer = vrv_cast<Layer *>(this);
         assert(layer);
         layer->SetDrawingCautionValues(params->m_currentStaffDef);
         return FUNCTOR_SIBLINGS;
@@ -860,14 +1348,14 @@ int Object::SetCautionaryScoreDef(FunctorParams *functorParams)
 
 int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 {
-    SetCurrentScoreDefParams *params = dynamic_cast<SetCurrentScoreDefParams *>(functorParams);
+    SetCurrentScoreDefParams *params = vrv_cast<SetCurrentScoreDefParams *>(functorParams);
     assert(params);
 
     assert(params->m_upcomingScoreDef);
 
     // starting a new page
     if (this->Is() == PAGE) {
-        Page *page = dynamic_cast<Page *>(this);
+        Page *page = vrv_cast<Page *>(this);
         assert(page);
         if (page->m_parent->GetChildIndex(page) == 0) {
             params->m_upcomingScoreDef->SetRedrawFlags(true, true, true, true, false);
@@ -879,7 +1367,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new system
     if (this->Is() == SYSTEM) {
-        System *system = dynamic_cast<System *>(this);
+        System *system = vrv_cast<System *>(this);
         assert(system);
         // This is the only thing we do for now - we need to wait until we reach the first measure
         params->m_currentSystem = system;
@@ -888,7 +1376,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new measure
     if (this->Is() == MEASURE) {
-        Measure *measure = dynamic_cast<Measure *>(this);
+        Measure *measure = vrv_cast<Measure *>(this);
         assert(measure);
         bool systemBreak = false;
         bool scoreDefInsert = false;
@@ -926,7 +1414,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new scoreDef
     if (this->Is() == SCOREDEF) {
-        ScoreDef *scoreDef = dynamic_cast<ScoreDef *>(this);
+        ScoreDef *scoreDef = vrv_cast<ScoreDef *>(this);
         assert(scoreDef);
         // Replace the current scoreDef with the new one, including its content (staffDef) - this also sets
         // m_setAsDrawing to true so it will then be taken into account at the next measure
@@ -936,14 +1424,14 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new staffDef
     if (this->Is() == STAFFDEF) {
-        StaffDef *staffDef = dynamic_cast<StaffDef *>(this);
+        StaffDef *staffDef = vrv_cast<StaffDef *>(this);
         assert(staffDef);
         params->m_upcomingScoreDef->ReplaceDrawingValues(staffDef);
     }
 
     // starting a new staff
     if (this->Is() == STAFF) {
-        Staff *staff = dynamic_cast<Staff *>(this);
+        Staff *staff = vrv_cast<Staff *>(this);
         assert(staff);
         params->m_currentStaffDef = params->m_currentScoreDef->GetStaffDef(staff->GetN());
         assert(staff->m_drawingStaffDef == NULL);
@@ -953,7 +1441,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new layer
     if (this->Is() == LAYER) {
-        Layer *layer = dynamic_cast<Layer *>(this);
+        Layer *layer = vrv_cast<Layer *>(this);
         assert(layer);
         // setting the layer stem direction. Alternatively, this could be done in
         // View::DrawLayer. If this (and other things) is kept here, renaming the method to something
@@ -972,7 +1460,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new clef
     if (this->Is() == CLEF) {
-        Clef *clef = dynamic_cast<Clef *>(this);
+        Clef *clef = vrv_cast<Clef *>(this);
         assert(clef);
         assert(params->m_currentStaffDef);
         StaffDef *upcomingStaffDef = params->m_upcomingScoreDef->GetStaffDef(params->m_currentStaffDef->GetN());
@@ -984,7 +1472,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new keysig
     if (this->Is() == KEYSIG) {
-        KeySig *keysig = dynamic_cast<KeySig *>(this);
+        KeySig *keysig = vrv_cast<KeySig *>(this);
         assert(keysig);
         assert(params->m_currentStaffDef);
         StaffDef *upcomingStaffDef = params->m_upcomingScoreDef->GetStaffDef(params->m_currentStaffDef->GetN());
@@ -999,7 +1487,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
 int Object::SetBoundingBoxGraceXShift(FunctorParams *functorParams)
 {
-    SetBoundingBoxGraceXShiftParams *params = dynamic_cast<SetBoundingBoxGraceXShiftParams *>(functorParams);
+    SetBoundingBoxGraceXShiftParams *params = vrv_cast<SetBoundingBoxGraceXShiftParams *>(functorParams);
     assert(params);
 
     // starting new layer
@@ -1012,7 +1500,7 @@ int Object::SetBoundingBoxGraceXShift(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
 
-    Note *note = dynamic_cast<Note *>(this);
+    Note *note = vrv_cast<Note *>(this);
     assert(note);
 
     if (!note->IsGraceNote() || note->IsChordTone()) {
@@ -1057,7 +1545,7 @@ int Object::SetBoundingBoxGraceXShift(FunctorParams *functorParams)
 
 int Object::SetBoundingBoxXShift(FunctorParams *functorParams)
 {
-    SetBoundingBoxXShiftParams *params = dynamic_cast<SetBoundingBoxXShiftParams *>(functorParams);
+    SetBoundingBoxXShiftParams *params = vrv_cast<SetBoundingBoxXShiftParams *>(functorParams);
     assert(params);
 
     // starting new layer
@@ -1070,7 +1558,7 @@ int Object::SetBoundingBoxXShift(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
 
-    LayerElement *current = dynamic_cast<LayerElement *>(this);
+    LayerElement *current = vrv_cast<LayerElement *>(this);
     assert(current);
 
     // we should have processed aligned before
@@ -1154,7 +1642,7 @@ int Object::SetBoundingBoxXShift(FunctorParams *functorParams)
 
 int Object::SetBoundingBoxXShiftEnd(FunctorParams *functorParams)
 {
-    SetBoundingBoxXShiftParams *params = dynamic_cast<SetBoundingBoxXShiftParams *>(functorParams);
+    SetBoundingBoxXShiftParams *params = vrv_cast<SetBoundingBoxXShiftParams *>(functorParams);
     assert(params);
 
     // ending a layer
@@ -1171,12 +1659,12 @@ int Object::SetBoundingBoxXShiftEnd(FunctorParams *functorParams)
 
 int Object::SetOverflowBBoxes(FunctorParams *functorParams)
 {
-    SetOverflowBBoxesParams *params = dynamic_cast<SetOverflowBBoxesParams *>(functorParams);
+    SetOverflowBBoxesParams *params = vrv_cast<SetOverflowBBoxesParams *>(functorParams);
     assert(params);
 
     // starting a new staff
     if (this->Is() == STAFF) {
-        Staff *currentStaff = dynamic_cast<Staff *>(this);
+        Staff *currentStaff = vrv_cast<Staff *>(this);
         assert(currentStaff);
         assert(currentStaff->GetAlignment());
 
@@ -1189,7 +1677,7 @@ int Object::SetOverflowBBoxes(FunctorParams *functorParams)
 
     // starting new layer
     if (this->Is() == LAYER) {
-        Layer *currentLayer = dynamic_cast<Layer *>(this);
+        Layer *currentLayer = vrv_cast<Layer *>(this);
         assert(currentLayer);
         // set scoreDef attr
         if (currentLayer->GetStaffDefClef()) {
@@ -1224,7 +1712,7 @@ int Object::SetOverflowBBoxes(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
 
-    LayerElement *current = dynamic_cast<LayerElement *>(this);
+    LayerElement *current = vrv_cast<LayerElement *>(this);
     assert(current);
 
     if (!current->HasToBeAligned()) {
@@ -1265,12 +1753,12 @@ int Object::SetOverflowBBoxes(FunctorParams *functorParams)
 
 int Object::SetOverflowBBoxesEnd(FunctorParams *functorParams)
 {
-    SetOverflowBBoxesParams *params = dynamic_cast<SetOverflowBBoxesParams *>(functorParams);
+    SetOverflowBBoxesParams *params = vrv_cast<SetOverflowBBoxesParams *>(functorParams);
     assert(params);
 
     // starting new layer
     if (this->Is() == LAYER) {
-        Layer *currentLayer = dynamic_cast<Layer *>(this);
+        Layer *currentLayer = vrv_cast<Layer *>(this);
         assert(currentLayer);
         // set scoreDef attr
         if (currentLayer->GetCautionStaffDefClef()) {
@@ -1291,7 +1779,7 @@ int Object::SetOverflowBBoxesEnd(FunctorParams *functorParams)
 
 int Object::Save(FunctorParams *functorParams)
 {
-    SaveParams *params = dynamic_cast<SaveParams *>(functorParams);
+    SaveParams *params = vrv_cast<SaveParams *>(functorParams);
     assert(params);
 
     if (!params->m_output->WriteObject(this)) {
@@ -1302,7 +1790,7 @@ int Object::Save(FunctorParams *functorParams)
 
 int Object::SaveEnd(FunctorParams *functorParams)
 {
-    SaveParams *params = dynamic_cast<SaveParams *>(functorParams);
+    SaveParams *params = vrv_cast<SaveParams *>(functorParams);
     assert(params);
 
     if (!params->m_output->WriteObjectEnd(this)) {
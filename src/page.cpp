@@ -15,6 +15,7 @@
 
 #include "attcomparison.h"
 #include "bboxdevicecontext.h"
+#include "displaylistdevicecontext.h"
 #include "doc.h"
 #include "functorparams.h"
 #include "system.h"
@@ -29,11 +30,14 @@ namespace vrv {
 
 Page::Page() : Object("page-")
 {
+    m_displayList = NULL;
+
     Reset();
 }
 
 Page::~Page()
 {
+    ResetDisplayList();
 }
 
 void Page::Reset()
@@ -43,6 +47,7 @@ void Page::Reset()
     m_drawingScoreDef.Reset();
     m_layoutDone = false;
     this->ResetUuid();
+    this->ResetDisplayList();
 
     // by default we have no values and use the document ones
     m_pageHeight = -1;
@@ -73,6 +78,9 @@ void Page::LayOut(bool force)
         return;
     }
 
+    // The drawing kept for the previous layout is not valid anymore
+    this->ResetDisplayList();
+
     this->LayOutHorizontally();
     this->JustifyHorizontally();
     this->LayOutVertically();
@@ -80,22 +88,38 @@ void Page::LayOut(bool force)
     m_layoutDone = true;
 }
 
+void Page::SetDisplayList(DisplayListDeviceContext *displayList)
+{
+    if (displayList == m_displayList) return;
+
+    ResetDisplayList();
+    m_displayList = displayList;
+}
+
+void Page::ResetDisplayList()
+{
+    if (m_displayList) {
+        delete m_displayList;
+        m_displayList = NULL;
+    }
+}
+
 void Page::LayOutHorizontally()
 {
-    Doc *doc = dynamic_cast<Doc *>(m_parent);
+    Doc *doc = vrv_cast<Doc *>(m_parent);
     assert(doc);
 
     // Doc::SetDrawingPage should have been called before
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
-    // Reset the horizontal alignment
+    // Reset the horizontal and the vertical alignment in a single traversal
+    FunctorGroup resetGroup;
     Functor resetHorizontalAlignment(&Object::ResetHorizontalAlignment);
-    this->Process(&resetHorizontalAlignment, NULL);
-
-    // Reset the vertical alignment
+    resetGroup.Add(&resetHorizontalAlignment, NULL);
     Functor resetVerticalAlignment(&Object::ResetVerticalAlignment);
-    this->Process(&resetVerticalAlignment, NULL);
+    resetGroup.Add(&resetVerticalAlignment, NULL);
+    this->Process(&resetGroup);
 
     // Align the content of the page using measure aligners
     // After this:
@@ -167,23 +191,24 @@ void Page::LayOutHorizontally()
 
 void Page::LayOutVertically()
 {
-    Doc *doc = dynamic_cast<Doc *>(m_parent);
+    Doc *doc = vrv_cast<Doc *>(m_parent);
     assert(doc);
 
     // Doc::SetDrawingPage should have been called before
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
-    // Reset the vertical alignment
-    Functor resetVerticalAlignment(&Object::ResetVerticalAlignment);
-    this->Process(&resetVerticalAlignment, NULL);
-
-    // Align the content of the page using system aligners
+    // Reset the vertical alignment and align the content of the page using system aligners in a single traversal
+    // This works because the system aligner is reset before the staves of the system are aligned
     // After this:
     // - each Staff object will then have its StaffAlignment pointer initialized
+    FunctorGroup alignGroup;
+    Functor resetVerticalAlignment(&Object::ResetVerticalAlignment);
+    alignGroup.Add(&resetVerticalAlignment, NULL);
     AlignVerticallyParams alignVerticallyParams(doc);
     Functor alignVertically(&Object::AlignVertically);
-    this->Process(&alignVertically, &alignVerticallyParams);
+    alignGroup.Add(&alignVertically, &alignVerticallyParams);
+    this->Process(&alignGroup);
 
     // Render it for filling the bounding box
     View view;
@@ -209,39 +234,45 @@ void Page::LayOutVertically()
     Functor setOverflowBBoxesEnd(&Object::SetOverflowBBoxesEnd);
     this->Process(&setOverflowBBoxes, &setOverflowBBoxesParams, &setOverflowBBoxesEnd);
 
+    // The following functors all process the system aligner of each system in turn - they can be processed
+    // in a single traversal because one system does not depend on the next ones
+    FunctorGroup systemGroup;
+
     // Adjust the positioners of floationg elements (slurs, hairpin, dynam, etc)
     Functor adjustFloatingPostioners(&Object::AdjustFloatingPostioners);
     AdjustFloatingPostionersParams adjustFloatingPostionersParams(doc, &adjustFloatingPostioners);
-    this->Process(&adjustFloatingPostioners, &adjustFloatingPostionersParams);
+    systemGroup.Add(&adjustFloatingPostioners, &adjustFloatingPostionersParams);
 
     // Calculate the overlap of the staff aligmnents by looking at the overflow bounding boxes params.clear();
     Functor calcStaffOverlap(&Object::CalcStaffOverlap);
     CalcStaffOverlapParams calcStaffOverlapParams(&calcStaffOverlap);
-    this->Process(&calcStaffOverlap, &calcStaffOverlapParams);
+    systemGroup.Add(&calcStaffOverlap, &calcStaffOverlapParams);
 
     // Set the Y position of each StaffAlignment
     // Adjust the Y shift to make sure there is a minimal space (staffMargin) between each staff
     Functor setAlignmentY(&Object::SetAligmentYPos);
     SetAligmentYPosParams setAligmentYPosParams(doc, &setAlignmentY);
-    this->Process(&setAlignmentY, &setAligmentYPosParams);
+    systemGroup.Add(&setAlignmentY, &setAligmentYPosParams);
 
     // Integrate the Y shift of the staves
     // Once the m_yShift have been calculated, move all positions accordingly
     Functor integrateBoundingBoxYShift(&Object::IntegrateBoundingBoxYShift);
     IntegrateBoundingBoxYShiftParams integrateBoundingBoxYShiftParams(&integrateBoundingBoxYShift);
-    this->Process(&integrateBoundingBoxYShift, &integrateBoundingBoxYShiftParams);
+    systemGroup.Add(&integrateBoundingBoxYShift, &integrateBoundingBoxYShiftParams);
 
     // Adjust system Y position
     AlignSystemsParams alignSystemsParams;
     alignSystemsParams.m_shift = doc->m_drawingPageHeight - doc->m_drawingPageTopMar;
     alignSystemsParams.m_systemMargin = (doc->GetSpacingSystem()) * doc->GetDrawingUnit(100);
     Functor alignSystems(&Object::AlignSystems);
-    this->Process(&alignSystems, &alignSystemsParams);
+    systemGroup.Add(&alignSystems, &alignSystemsParams);
+
+    this->Process(&systemGroup);
 }
 
 void Page::JustifyHorizontally()
 {
-    Doc *doc = dynamic_cast<Doc *>(m_parent);
+    Doc *doc = vrv_cast<Doc *>(m_parent);
     assert(doc);
 
     if (!doc->GetJustificationX()) {
@@ -261,21 +292,21 @@ void Page::JustifyHorizontally()
 
 int Page::GetContentHeight() const
 {
-    Doc *doc = dynamic_cast<Doc *>(m_parent);
+    Doc *doc = vrv_cast<Doc *>(m_parent);
     assert(doc);
 
     // Doc::SetDrawingPage should have been called before
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
-    System *last = dynamic_cast<System *>(m_children.back());
+    System *last = vrv_cast<System *>(m_children.back());
     assert(last);
     return doc->m_drawingPageHeight - doc->m_drawingPageTopMar - last->m_drawingYRel + last->GetHeight();
 }
 
 int Page::GetContentWidth() const
 {
-    Doc *doc = dynamic_cast<Doc *>(m_parent);
+    Doc *doc = vrv_cast<Doc *>(m_parent);
     assert(doc);
     // in non debug
     if (!doc) return 0;
@@ -284,7 +315,7 @@ int Page::GetContentWidth() const
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
-    System *first = dynamic_cast<System *>(m_children.front());
+    System *first = vrv_cast<System *>(m_children.front());
     assert(first);
 
     // For avoiding unused variable warning in non debug mode
@@ -64,7 +64,7 @@ void Staff::Reset()
 void Staff::AddChild(Object *child)
 {
     if (child->Is() == LAYER) {
-        Layer *layer = dynamic_cast<Layer *>(child);
+        Layer *layer = vrv_cast<Layer *>(child);
         assert(layer);
         if (layer && (layer->GetN() < 1)) {
             // This is not 100% safe if we have a <app> and <rdg> with more than
@@ -119,7 +119,7 @@ int Staff::ResetVerticalAlignment(FunctorParams *functorParams)
 
 int Staff::AlignVertically(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     params->m_staffN = this->GetN();
@@ -135,7 +135,7 @@ int Staff::AlignVertically(FunctorParams *functorParams)
     std::vector<Object *>::iterator it;
     it = std::find_if(m_timeSpanningElements.begin(), m_timeSpanningElements.end(), ObjectComparison(VERSE));
     if (it != m_timeSpanningElements.end()) {
-        Verse *v = dynamic_cast<Verse *>(*it);
+        Verse *v = vrv_cast<Verse *>(*it);
         assert(v);
         alignment->SetVerseCount(v->GetN());
     }
@@ -148,14 +148,14 @@ int Staff::AlignVertically(FunctorParams *functorParams)
 
 int Staff::FillStaffCurrentTimeSpanning(FunctorParams *functorParams)
 {
-    FillStaffCurrentTimeSpanningParams *params = dynamic_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
+    FillStaffCurrentTimeSpanningParams *params = vrv_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
     assert(params);
 
     std::vector<Object *>::iterator iter = params->m_timeSpanningElements.begin();
     while (iter != params->m_timeSpanningElements.end()) {
         TimeSpanningInterface *interface = (*iter)->GetTimeSpanningInterface();
         assert(interface);
-        Measure *currentMeasure = dynamic_cast<Measure *>(this->GetFirstParent(MEASURE));
+        Measure *currentMeasure = vrv_cast<Measure *>(this->GetFirstParent(MEASURE));
         assert(currentMeasure);
         // We need to make sure we are in the next measure (and not just a staff below because of some cross staff
         // notation
@@ -175,7 +175,7 @@ int Staff::ResetDrawing(FunctorParams *functorParams)
 
 int Staff::SetDrawingXY(FunctorParams *functorParams)
 {
-    SetDrawingXYParams *params = dynamic_cast<SetDrawingXYParams *>(functorParams);
+    SetDrawingXYParams *params = vrv_cast<SetDrawingXYParams *>(functorParams);
     assert(params);
 
     params->m_currentStaff = this;
@@ -207,27 +207,10 @@ int Staff::SetDrawingXY(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
-int Staff::PrepareRpt(FunctorParams *functorParams)
+int Staff::PrepareTimeSpanning(FunctorParams *functorParams)
 {
-    PrepareRptParams *params = dynamic_cast<PrepareRptParams *>(functorParams);
-    assert(params);
-
-    // If multiNumber is set, we already know that nothing needs to be done
-    // Futhermore, if @multi.number is false, the functor should have stopped (see below)
-    if (params->m_multiNumber != BOOLEAN_NONE) {
-        return FUNCTOR_CONTINUE;
-    }
-
-    // This is happening only for the first staff element of the staff @n
-    if (StaffDef *staffDef = params->m_currentScoreDef->GetStaffDef(this->GetN())) {
-        if ((staffDef->HasMultiNumber()) && (staffDef->GetMultiNumber() == BOOLEAN_false)) {
-            // Set it just in case, but stopping the functor should do it for this staff @n
-            params->m_multiNumber = BOOLEAN_false;
-            return FUNCTOR_STOP;
-        }
-    }
-    params->m_multiNumber = BOOLEAN_true;
-    return FUNCTOR_CONTINUE;
+    // Start and end elements are looked up in the uuid index, so there is no need to go through the layers
+    return FUNCTOR_SIBLINGS;
 }
 
 } // namespace vrv
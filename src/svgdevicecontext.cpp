@@ -15,6 +15,7 @@
 
 //----------------------------------------------------------------------------
 
+#include "builtinfont.h"
 #include "doc.h"
 #include "floatingobject.h"
 #include "glyph.h"
@@ -37,6 +38,14 @@ static inline double DegToRad(double deg)
 // static inline double RadToDeg(double deg) { return (deg * 180.0) / M_PI; } // unused
 }
 
+//----------------------------------------------------------------------------
+// Static members with some default values
+//----------------------------------------------------------------------------
+
+std::mutex SvgDeviceContext::s_defsMutex;
+std::map<const Glyph *, pugi::xml_document> SvgDeviceContext::s_glyphDefs;
+std::map<std::string, pugi::xml_document> SvgDeviceContext::s_woffs;
+
 //----------------------------------------------------------------------------
 // SvgDeviceContext
 //----------------------------------------------------------------------------
@@ -55,8 +64,14 @@ SvgDeviceContext::SvgDeviceContext(int width, int height) : DeviceContext()
     SetPen(AxBLACK, 1, AxSOLID);
 
     m_smufl_glyphs.clear();
+    m_smuflGlyphSet.clear();
+    m_sizedGlyphs.clear();
+    m_sizedGlyphSet.clear();
+    m_graphicNodes.clear();
 
     m_committed = false;
+    m_compact = false;
+    m_glyphSprite = "";
     m_vrvTextFont = false;
 
     // create the initial SVG element
@@ -86,6 +101,46 @@ bool SvgDeviceContext::CopyFileToStream(const std::string &filename, std::ostrea
     return true;
 }
 
+const pugi::xml_document *SvgDeviceContext::GetGlyphDefs(const Glyph *glyph)
+{
+    assert(glyph);
+
+    std::lock_guard<std::mutex> lock(s_defsMutex);
+
+    std::map<const Glyph *, pugi::xml_document>::iterator iter = s_glyphDefs.find(glyph);
+    if (iter != s_glyphDefs.end()) return &iter->second;
+
+    // load the XML of the glyph compiled in or the file that contains it
+    pugi::xml_document *glyphDefs = &s_glyphDefs[glyph];
+    if (glyph->GetXML()) {
+        glyphDefs->load_string(glyph->GetXML());
+    }
+    else {
+        std::ifstream source(glyph->GetPath().c_str());
+        glyphDefs->load(source);
+    }
+    return glyphDefs;
+}
+
+const pugi::xml_document *SvgDeviceContext::GetWoff(const std::string &path)
+{
+    std::lock_guard<std::mutex> lock(s_defsMutex);
+
+    std::map<std::string, pugi::xml_document>::iterator iter = s_woffs.find(path);
+    if (iter != s_woffs.end()) return &iter->second;
+
+    // an empty path is for the resources compiled in
+    pugi::xml_document *woffDoc = &s_woffs[path];
+    if (path.empty()) {
+        woffDoc->load_string(GetBuiltInWoff());
+    }
+    else {
+        std::string woff = path + "/woff.xml";
+        woffDoc->load_file(woff.c_str());
+    }
+    return woffDoc;
+}
+
 void SvgDeviceContext::Commit(bool xml_declaration)
 {
 
@@ -99,30 +154,36 @@ void SvgDeviceContext::Commit(bool xml_declaration)
 
     // add the woff VerovioText font if needed
     if (m_vrvTextFont) {
-        std::string woff = Resources::GetPath() + "/woff.xml";
-        pugi::xml_document woffDoc;
-        woffDoc.load_file(woff.c_str());
-        m_svgNode.prepend_copy(woffDoc.first_child());
+        m_svgNode.prepend_copy(GetWoff(this->GetResources()->GetPath())->first_child());
     }
 
-    // header
-    if (m_smufl_glyphs.size() > 0) {
+    // header - the glyphs are not needed when they are in an external sprite
+    bool glyphDefs = (m_smufl_glyphs.size() > 0) && m_glyphSprite.empty();
+    if (glyphDefs || (m_sizedGlyphs.size() > 0)) {
 
         pugi::xml_node defs = m_svgNode.prepend_child("defs");
-        pugi::xml_document sourceDoc;
 
         // for each needed glyph
-        std::vector<std::string>::const_iterator it;
-        for (it = m_smufl_glyphs.begin(); it != m_smufl_glyphs.end(); ++it) {
-            // load the XML file that contains it as a pugi::xml_document
-            std::ifstream source((*it).c_str());
-            sourceDoc.load(source);
-
-            // copy all the nodes inside into the master document
-            for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
+        std::vector<const Glyph *>::const_iterator it;
+        for (it = m_smufl_glyphs.begin(); glyphDefs && (it != m_smufl_glyphs.end()); ++it) {
+            // copy all the nodes of the parsed glyph into the master document
+            const pugi::xml_document *glyphDefs = GetGlyphDefs(*it);
+            for (pugi::xml_node child = glyphDefs->first_child(); child; child = child.next_sibling()) {
                 defs.append_copy(child);
             }
         }
+
+        // in compact mode, the size of each glyph is given once and the glyphs are drawn through it
+        std::vector<std::pair<const Glyph *, int> >::const_iterator sizedIt;
+        for (sizedIt = m_sizedGlyphs.begin(); sizedIt != m_sizedGlyphs.end(); ++sizedIt) {
+            const std::string code = sizedIt->first->GetCodeStr();
+            pugi::xml_node useChild = defs.append_child("use");
+            useChild.append_attribute("id") = StringFormat("%s-%d", code.c_str(), sizedIt->second).c_str();
+            useChild.append_attribute("xlink:href")
+                = StringFormat("%s#%s", m_glyphSprite.c_str(), code.c_str()).c_str();
+            useChild.append_attribute("height") = sizedIt->second;
+            useChild.append_attribute("width") = sizedIt->second;
+        }
     }
 
     unsigned int output_flags = pugi::format_default | pugi::format_no_declaration;
@@ -134,6 +195,8 @@ void SvgDeviceContext::Commit(bool xml_declaration)
         decl.append_attribute("encoding") = "UTF-8";
         decl.append_attribute("standalone") = "no";
     }
+    // no indentation and no line break in compact mode
+    if (m_compact) output_flags |= pugi::format_raw;
 
     // save the glyph data to m_outdata
     m_svgDoc.save(m_outdata, "\t", output_flags);
@@ -141,15 +204,15 @@ void SvgDeviceContext::Commit(bool xml_declaration)
     m_committed = true;
 }
 
-void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::string gId)
+void SvgDeviceContext::StartGraphic(Object *object, const std::string &gClass, const std::string &gId)
 {
     std::string baseClass = object->GetClassName();
     std::transform(baseClass.begin(), baseClass.begin() + 1, baseClass.begin(), ::tolower);
     if (gClass.length() > 0) {
-        baseClass.append(" " + gClass);
+        baseClass.append(" ").append(gClass);
     }
     if (object->HasSVGClass()) {
-        baseClass.append(" " + object->GetSVGClass());
+        baseClass.append(" ").append(object->GetSVGClass());
     }
 
     m_currentNode = m_currentNode.append_child("g");
@@ -157,6 +220,8 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
     m_currentNode.append_attribute("class") = baseClass.c_str();
     if (gId.length() > 0) {
         m_currentNode.append_attribute("id") = gId.c_str();
+        // Keep only the first one, which is the one the XPath query of ResumeGraphic would find
+        if (gId == object->GetUuid()) m_graphicNodes.insert(std::make_pair(&object->GetUuid(), m_currentNode));
     }
 
     if (object->HasAttClass(ATT_COLOR)) {
@@ -190,12 +255,12 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
     // currentBrush.GetOpacity()).c_str();
 }
 
-void SvgDeviceContext::StartTextGraphic(Object *object, std::string gClass, std::string gId)
+void SvgDeviceContext::StartTextGraphic(Object *object, const std::string &gClass, const std::string &gId)
 {
     std::string baseClass = object->GetClassName();
     std::transform(baseClass.begin(), baseClass.begin() + 1, baseClass.begin(), ::tolower);
     if (gClass.length() > 0) {
-        baseClass.append(" " + gClass);
+        baseClass.append(" ").append(gClass);
     }
 
     m_currentNode = AppendChild("tspan");
@@ -218,12 +283,20 @@ void SvgDeviceContext::StartTextGraphic(Object *object, std::string gClass, std:
     }
 }
 
-void SvgDeviceContext::ResumeGraphic(Object *object, std::string gId)
+void SvgDeviceContext::ResumeGraphic(Object *object, const std::string &gId)
 {
-    std::string xpath = "//g[@id=\"" + gId + "\"]";
-    pugi::xpath_node selection = m_currentNode.select_single_node(xpath.c_str());
-    if (selection) {
-        m_currentNode = selection.node();
+    std::unordered_map<const std::string *, pugi::xml_node, StrPtrHash, StrPtrEqual>::const_iterator iter
+        = m_graphicNodes.find(&gId);
+    if (iter != m_graphicNodes.end()) {
+        m_currentNode = iter->second;
+    }
+    else {
+        // A <g> started with another id than the uuid of its object
+        std::string xpath = "//g[@id=\"" + gId + "\"]";
+        pugi::xpath_node selection = m_currentNode.select_single_node(xpath.c_str());
+        if (selection) {
+            m_currentNode = selection.node();
+        }
     }
     m_svgNodeStack.push_back(m_currentNode);
 }
@@ -340,8 +413,11 @@ pugi::xml_node SvgDeviceContext::AppendChild(std::string name)
 void SvgDeviceContext::DrawComplexBezierPath(Point bezier1[4], Point bezier2[4])
 {
     pugi::xml_node pathChild = AppendChild("path");
+    // the space before the commands is not necessary
+    const char *format
+        = m_compact ? "M%d,%dC%d,%d %d,%d %d,%dC%d,%d %d,%d %d,%d" : "M%d,%d C%d,%d %d,%d %d,%d C%d,%d %d,%d %d,%d";
     pathChild.append_attribute("d")
-        = StringFormat("M%d,%d C%d,%d %d,%d %d,%d C%d,%d %d,%d %d,%d", bezier1[0].x, bezier1[0].y, // M command
+        = StringFormat(format, bezier1[0].x, bezier1[0].y, // M command
             bezier1[1].x, bezier1[1].y, bezier1[2].x, bezier1[2].y, bezier1[3].x, bezier1[3].y, // First bezier
             bezier2[2].x, bezier2[2].y, bezier2[1].x, bezier2[1].y, bezier2[0].x, bezier2[0].y // Second Bezier
             ).c_str();
@@ -459,7 +535,19 @@ void SvgDeviceContext::DrawEllipticArc(int x, int y, int width, int height, doub
 void SvgDeviceContext::DrawLine(int x1, int y1, int x2, int y2)
 {
     pugi::xml_node pathChild = AppendChild("path");
-    pathChild.append_attribute("d") = StringFormat("M%d %d L%d %d", x1, y1, x2, y2).c_str();
+    if (!m_compact) {
+        pathChild.append_attribute("d") = StringFormat("M%d %d L%d %d", x1, y1, x2, y2).c_str();
+    }
+    // use the horizontal and vertical commands when possible
+    else if (y1 == y2) {
+        pathChild.append_attribute("d") = StringFormat("M%d %dH%d", x1, y1, x2).c_str();
+    }
+    else if (x1 == x2) {
+        pathChild.append_attribute("d") = StringFormat("M%d %dV%d", x1, y1, y2).c_str();
+    }
+    else {
+        pathChild.append_attribute("d") = StringFormat("M%d %dL%d %d", x1, y1, x2, y2).c_str();
+    }
     pathChild.append_attribute("stroke") = StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()).c_str();
     if (m_penStack.top().GetDashLenght() > 0)
         pathChild.append_attribute("stroke-dasharray")
@@ -484,18 +572,21 @@ void SvgDeviceContext::DrawPolygon(int n, Point points[], int xoffset, int yoffs
             = StringFormat("#%s", GetColour(currentPen.GetColour()).c_str()).c_str();
     if (currentPen.GetWidth() > 1)
         polygonChild.append_attribute("stroke-width") = StringFormat("%d", currentPen.GetWidth()).c_str();
+    // %g gives the minimal number of digits for the compact mode
+    const char *opacityFormat = m_compact ? "%g" : "%f";
     if (currentPen.GetOpacity() != 1.0)
-        polygonChild.append_attribute("stroke-opacity") = StringFormat("%f", currentPen.GetOpacity()).c_str();
+        polygonChild.append_attribute("stroke-opacity") = StringFormat(opacityFormat, currentPen.GetOpacity()).c_str();
     if (currentBrush.GetColour() != AxBLACK)
         polygonChild.append_attribute("fill")
             = StringFormat("#%s", GetColour(currentBrush.GetColour()).c_str()).c_str();
     if (currentBrush.GetOpacity() != 1.0)
-        polygonChild.append_attribute("fill-opacity") = StringFormat("%f", currentBrush.GetOpacity()).c_str();
+        polygonChild.append_attribute("fill-opacity") = StringFormat(opacityFormat, currentBrush.GetOpacity()).c_str();
 
     std::string pointsString;
     for (int i = 0; i < n; i++) {
         pointsString += StringFormat("%d,%d ", points[i].x + xoffset, points[i].y + yoffset);
     }
+    if (m_compact && !pointsString.empty()) pointsString.resize(pointsString.size() - 1);
     polygonChild.append_attribute("points") = pointsString.c_str();
 }
 
@@ -557,7 +648,7 @@ void SvgDeviceContext::StartText(int x, int y, char alignment)
     }
     // font-size seems to be required in <text> in FireFox and also we set it to 0px so space
     // is not added between tspan elements
-    m_currentNode.append_attribute("font-size") = "0px";
+    m_currentNode.append_attribute("font-size") = m_compact ? "0" : "0px";
     //
     if (!m_fontStack.top()->GetFaceName().empty()) {
         m_currentNode.append_attribute("font-family") = m_fontStack.top()->GetFaceName().c_str();
@@ -610,7 +701,8 @@ void SvgDeviceContext::DrawText(const std::string &text, const std::wstring wtex
         if (m_fontStack.top()->GetFaceName() == "VerovioText") this->VrvTextFont();
     }
     if (m_fontStack.top()->GetPointSize() != 0) {
-        textChild.append_attribute("font-size") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
+        textChild.append_attribute("font-size")
+            = StringFormat(m_compact ? "%d" : "%dpx", m_fontStack.top()->GetPointSize()).c_str();
     }
     if (m_fontStack.top()->GetStyle() != FONTSTYLE_NONE) {
         if (m_fontStack.top()->GetStyle() == FONTSTYLE_italic) {
@@ -656,26 +748,37 @@ void SvgDeviceContext::DrawMusicText(const std::wstring &text, int x, int y)
     // print chars one by one
     for (unsigned int i = 0; i < text.length(); i++) {
         wchar_t c = text[i];
-        Glyph *glyph = Resources::GetGlyph(c);
+        const Glyph *glyph = this->GetResources()->GetGlyph(c);
         if (!glyph) {
             continue;
         }
 
-        std::string path = glyph->GetPath();
-
         // Add the glyph to the array for the <defs>
-        std::vector<std::string>::const_iterator it = std::find(m_smufl_glyphs.begin(), m_smufl_glyphs.end(), path);
-        if (it == m_smufl_glyphs.end()) {
-            m_smufl_glyphs.push_back(path);
+        if (m_smuflGlyphSet.insert(glyph).second) {
+            m_smufl_glyphs.push_back(glyph);
         }
 
         // Write the char in the SVG
         pugi::xml_node useChild = AppendChild("use");
-        useChild.append_attribute("xlink:href") = StringFormat("#%s", glyph->GetCodeStr().c_str()).c_str();
-        useChild.append_attribute("x") = x;
-        useChild.append_attribute("y") = y;
-        useChild.append_attribute("height") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
-        useChild.append_attribute("width") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
+        if (m_compact) {
+            // refer to the glyph with its size in the <defs>
+            std::pair<const Glyph *, int> sizedGlyph(glyph, m_fontStack.top()->GetPointSize());
+            if (m_sizedGlyphSet.insert(sizedGlyph).second) {
+                m_sizedGlyphs.push_back(sizedGlyph);
+            }
+            useChild.append_attribute("xlink:href")
+                = StringFormat("#%s-%d", glyph->GetCodeStr().c_str(), sizedGlyph.second).c_str();
+            useChild.append_attribute("x") = x;
+            useChild.append_attribute("y") = y;
+        }
+        else {
+            useChild.append_attribute("xlink:href")
+                = StringFormat("%s#%s", m_glyphSprite.c_str(), glyph->GetCodeStr().c_str()).c_str();
+            useChild.append_attribute("x") = x;
+            useChild.append_attribute("y") = y;
+            useChild.append_attribute("height") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
+            useChild.append_attribute("width") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
+        }
 
         // Get the bounds of the char
         if (glyph->GetHorizAdvX() > 0)
@@ -695,27 +798,93 @@ void SvgDeviceContext::DrawBackgroundImage(int x, int y)
 {
 }
 
+void SvgDeviceContext::DrawLines(int n, Point points[])
+{
+    if (!m_compact) {
+        DeviceContext::DrawLines(n, points);
+        return;
+    }
+
+    // all the lines in one path, with relative horizontal commands when possible
+    std::string d;
+    for (int i = 0; i < n; ++i) {
+        Point &p1 = points[2 * i];
+        Point &p2 = points[2 * i + 1];
+        if (p1.y == p2.y)
+            d += StringFormat("M%d %dh%d", p1.x, p1.y, p2.x - p1.x);
+        else
+            d += StringFormat("M%d %dL%d %d", p1.x, p1.y, p2.x, p2.y);
+    }
+
+    pugi::xml_node pathChild = AppendChild("path");
+    pathChild.append_attribute("d") = d.c_str();
+    pathChild.append_attribute("stroke") = StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()).c_str();
+    if (m_penStack.top().GetDashLenght() > 0)
+        pathChild.append_attribute("stroke-dasharray")
+            = StringFormat("%d, %d", m_penStack.top().GetDashLenght(), m_penStack.top().GetDashLenght()).c_str();
+    if (m_penStack.top().GetWidth() > 1) pathChild.append_attribute("stroke-width") = m_penStack.top().GetWidth();
+}
+
 std::string SvgDeviceContext::GetColour(int colour)
 {
     std::ostringstream ss;
     ss << std::hex;
 
+    std::string hex;
     switch (colour) {
-        case (AxBLACK): return "000000";
-        case (AxWHITE): return "FFFFFF";
-        case (AxRED): return "FF0000";
-        case (AxGREEN): return "00FF00";
-        case (AxBLUE): return "0000FF";
-        case (AxCYAN): return "00FFFF";
-        case (AxLIGHT_GREY): return "777777";
+        case (AxBLACK): hex = "000000"; break;
+        case (AxWHITE): hex = "FFFFFF"; break;
+        case (AxRED): hex = "FF0000"; break;
+        case (AxGREEN): hex = "00FF00"; break;
+        case (AxBLUE): hex = "0000FF"; break;
+        case (AxCYAN): hex = "00FFFF"; break;
+        case (AxLIGHT_GREY): hex = "777777"; break;
         default:
             int blue = (colour & 255);
             int green = (colour >> 8) & 255;
             int red = (colour >> 16) & 255;
             ss << red << green << blue;
             // std::strin = wxDecToHex(char(red)) + wxDecToHex(char(green)) + wxDecToHex(char(blue)) ;  // ax3
-            return ss.str();
+            hex = ss.str();
+    }
+
+    // #RRGGBB can be written #RGB when each component has two identical digits
+    if (m_compact && (hex.length() == 6) && (hex[0] == hex[1]) && (hex[2] == hex[3]) && (hex[4] == hex[5])) {
+        hex = std::string(1, hex[0]) + hex[2] + hex[4];
     }
+    return hex;
+}
+
+std::string SvgDeviceContext::GetStringGlyphSprite(const std::vector<const Glyph *> &glyphs, bool xml_declaration)
+{
+    pugi::xml_document spriteDoc;
+
+    unsigned int output_flags = pugi::format_default | pugi::format_no_declaration;
+    if (xml_declaration) {
+        output_flags = pugi::format_default;
+        pugi::xml_node decl = spriteDoc.append_child(pugi::node_declaration);
+        decl.append_attribute("version") = "1.0";
+        decl.append_attribute("encoding") = "UTF-8";
+        decl.append_attribute("standalone") = "no";
+    }
+
+    pugi::xml_node svgNode = spriteDoc.append_child("svg");
+    svgNode.append_attribute("version") = "1.1";
+    svgNode.append_attribute("xmlns") = "http://www.w3.org/2000/svg";
+    svgNode.append_attribute("xmlns:xlink") = "http://www.w3.org/1999/xlink";
+    pugi::xml_node defs = svgNode.append_child("defs");
+
+    std::vector<const Glyph *>::const_iterator it;
+    for (it = glyphs.begin(); it != glyphs.end(); ++it) {
+        const pugi::xml_document *glyphDefs = GetGlyphDefs(*it);
+        for (pugi::xml_node child = glyphDefs->first_child(); child; child = child.next_sibling()) {
+            defs.append_copy(child);
+        }
+    }
+
+    std::ostringstream sprite;
+    spriteDoc.save(sprite, "\t", output_flags);
+    return sprite.str();
 }
 
 std::string SvgDeviceContext::GetStringSVG(bool xml_declaration)
@@ -0,0 +1,961 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        svgstreamdevicecontext.cpp
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "svgstreamdevicecontext.h"
+
+//----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <assert.h>
+#define _USE_MATH_DEFINES // needed by Windows for math constants like "M_PI"
+#include <math.h>
+#include <sstream>
+#include <stdio.h>
+#include <string.h>
+
+//----------------------------------------------------------------------------
+
+#include "doc.h"
+#include "floatingobject.h"
+#include "glyph.h"
+#include "layerelement.h"
+#include "svgdevicecontext.h"
+#include "view.h"
+#include "vrv.h"
+
+//----------------------------------------------------------------------------
+
+#include "pugixml.hpp"
+
+/** The size of the buffer from which the SVG is written to the stream */
+#define SVG_STREAM_BUFFER_SIZE 65536
+
+namespace vrv {
+
+static inline double DegToRad(double deg)
+{
+    return (deg * M_PI) / 180.0;
+}
+
+//----------------------------------------------------------------------------
+// Serialization helpers - they write the values as pugixml does it
+//----------------------------------------------------------------------------
+
+static inline void AppendIndent(std::string &str, int depth)
+{
+    str.push_back('\n');
+    str.append(depth, '\t');
+}
+
+static void AppendInt(std::string &str, int value)
+{
+    char buffer[16];
+    char *end = buffer + sizeof(buffer);
+    char *begin = end;
+    unsigned int absValue = (value < 0) ? 0U - (unsigned int)value : (unsigned int)value;
+    do {
+        *--begin = (char)('0' + absValue % 10);
+        absValue /= 10;
+    } while (absValue);
+    if (value < 0) *--begin = '-';
+    str.append(begin, end);
+}
+
+static void AppendFormatted(std::string &str, const char *format, double value)
+{
+    char buffer[128];
+    snprintf(buffer, sizeof(buffer), format, value);
+    str.append(buffer);
+}
+
+/**
+ * Escape the text as pugixml does it for attribute values (attribute == true) or for pcdata.
+ */
+static void AppendEscaped(std::string &str, const char *text, bool attribute)
+{
+    for (const char *c = text; *c; ++c) {
+        unsigned char ch = (unsigned char)*c;
+        switch (ch) {
+            case '&': str.append("&amp;"); break;
+            case '<': str.append("&lt;"); break;
+            case '>': str.append("&gt;"); break;
+            case '"':
+                if (attribute)
+                    str.append("&quot;");
+                else
+                    str.push_back('"');
+                break;
+            default:
+                if ((ch < 32) && (ch != '\t') && (attribute || ((ch != '\n') && (ch != '\r')))) {
+                    str.append("&#");
+                    str.push_back((char)('0' + ch / 10));
+                    str.push_back((char)('0' + ch % 10));
+                    str.push_back(';');
+                }
+                else {
+                    str.push_back(*c);
+                }
+        }
+    }
+}
+
+static void AppendAttribute(std::string &str, const char *name, const char *value)
+{
+    str.push_back(' ');
+    str.append(name);
+    str.append("=\"");
+    AppendEscaped(str, value, true);
+    str.push_back('"');
+}
+
+static void AppendAttribute(std::string &str, const char *name, int value)
+{
+    str.push_back(' ');
+    str.append(name);
+    str.append("=\"");
+    AppendInt(str, value);
+    str.push_back('"');
+}
+
+static void AppendAttribute(std::string &str, const char *name, float value)
+{
+    str.push_back(' ');
+    str.append(name);
+    str.append("=\"");
+    AppendFormatted(str, "%.9g", value);
+    str.push_back('"');
+}
+
+static void AppendAttribute(std::string &str, const char *name, double value)
+{
+    str.push_back(' ');
+    str.append(name);
+    str.append("=\"");
+    AppendFormatted(str, "%.17g", value);
+    str.push_back('"');
+}
+
+//----------------------------------------------------------------------------
+// Static members with some default values
+//----------------------------------------------------------------------------
+
+std::mutex SvgStreamDeviceContext::s_defsMutex;
+std::map<const Glyph *, std::string> SvgStreamDeviceContext::s_glyphDefs;
+std::map<std::string, std::string> SvgStreamDeviceContext::s_woffs;
+
+//----------------------------------------------------------------------------
+// SvgStreamDeviceContext
+//----------------------------------------------------------------------------
+
+SvgStreamDeviceContext::SvgStreamDeviceContext(std::ostream *output, int width, int height, bool xml_declaration)
+    : DeviceContext()
+{
+    assert(output);
+
+    m_output = output;
+    m_buffer.reserve(SVG_STREAM_BUFFER_SIZE + 1024);
+
+    m_xmlDeclaration = xml_declaration;
+    m_svgStarted = false;
+    m_committed = false;
+    m_startTagOpen = false;
+
+    m_width = width;
+    m_height = height;
+
+    m_userScaleX = 1.0;
+    m_userScaleY = 1.0;
+
+    m_originX = 0;
+    m_originY = 0;
+
+    SetBrush(AxBLACK, AxSOLID);
+    SetPen(AxBLACK, 1, AxSOLID);
+
+    m_smufl_glyphs.clear();
+    m_smuflGlyphSet.clear();
+
+    m_vrvTextFont = false;
+}
+
+SvgStreamDeviceContext::~SvgStreamDeviceContext()
+{
+    if (!m_committed) Commit();
+}
+
+const std::string &SvgStreamDeviceContext::GetGlyphDefs(const Glyph *glyph)
+{
+    assert(glyph);
+
+    std::lock_guard<std::mutex> lock(s_defsMutex);
+
+    std::map<const Glyph *, std::string>::iterator iter = s_glyphDefs.find(glyph);
+    if (iter != s_glyphDefs.end()) return iter->second;
+
+    // serialize the nodes of the parsed glyph as they are written within the <defs>
+    std::string *glyphDefs = &s_glyphDefs[glyph];
+    const pugi::xml_document *glyphDoc = SvgDeviceContext::GetGlyphDefs(glyph);
+    for (pugi::xml_node child = glyphDoc->first_child(); child; child = child.next_sibling()) {
+        std::ostringstream node;
+        child.print(node, "\t", pugi::format_default, pugi::encoding_auto, 2);
+        std::string nodeStr = node.str();
+        // pugixml writes the new line after the node and not before
+        if (!nodeStr.empty() && (nodeStr[nodeStr.size() - 1] == '\n')) nodeStr.erase(nodeStr.size() - 1);
+        glyphDefs->append("\n").append(nodeStr);
+    }
+    return *glyphDefs;
+}
+
+const std::string &SvgStreamDeviceContext::GetWoff(const std::string &path)
+{
+    std::lock_guard<std::mutex> lock(s_defsMutex);
+
+    std::map<std::string, std::string>::iterator iter = s_woffs.find(path);
+    if (iter != s_woffs.end()) return iter->second;
+
+    std::string *woff = &s_woffs[path];
+    pugi::xml_node woffNode = SvgDeviceContext::GetWoff(path)->first_child();
+    if (woffNode) {
+        std::ostringstream node;
+        woffNode.print(node, "\t", pugi::format_default, pugi::encoding_auto, 1);
+        std::string nodeStr = node.str();
+        if (!nodeStr.empty() && (nodeStr[nodeStr.size() - 1] == '\n')) nodeStr.erase(nodeStr.size() - 1);
+        woff->append("\n").append(nodeStr);
+    }
+    return *woff;
+}
+
+void SvgStreamDeviceContext::StartSvg()
+{
+    if (m_svgStarted) return;
+    m_svgStarted = true;
+
+    if (m_xmlDeclaration) {
+        m_buffer.append("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n");
+    }
+
+    // the size is the one with the user scale when the first element is drawn
+    m_buffer.append("<svg width=\"");
+    AppendInt(m_buffer, (int)((double)m_width * m_userScaleX));
+    m_buffer.append("px\" height=\"");
+    AppendInt(m_buffer, (int)((double)m_height * m_userScaleY));
+    m_buffer.append("px\" version=\"1.1\" xmlns=\"http://www.w3.org/2000/svg\" "
+                    "xmlns:xlink=\"http://www.w3.org/1999/xlink\" overflow=\"visible\"");
+
+    m_elementStack.push_back("svg");
+    m_startTagOpen = true;
+}
+
+void SvgStreamDeviceContext::StartElement(const char *name)
+{
+    assert(!m_committed);
+
+    StartSvg();
+
+    if (m_startTagOpen) m_buffer.push_back('>');
+    AppendIndent(m_buffer, (int)m_elementStack.size());
+    m_buffer.push_back('<');
+    m_buffer.append(name);
+
+    m_elementStack.push_back(name);
+    m_startTagOpen = true;
+}
+
+void SvgStreamDeviceContext::EndElement()
+{
+    assert(!m_elementStack.empty());
+
+    const char *name = m_elementStack.back();
+    m_elementStack.pop_back();
+
+    if (m_startTagOpen) {
+        m_buffer.append(" />");
+        m_startTagOpen = false;
+    }
+    else {
+        AppendIndent(m_buffer, (int)m_elementStack.size());
+        m_buffer.append("</");
+        m_buffer.append(name);
+        m_buffer.push_back('>');
+    }
+
+    Flush();
+}
+
+void SvgStreamDeviceContext::StartObjectElement(
+    const char *name, Object *object, const std::string &gClass, bool svgClass)
+{
+    StartElement(name);
+
+    std::string className = object->GetClassName();
+    m_buffer.append(" class=\"");
+    if (!className.empty()) {
+        m_buffer.push_back((char)::tolower(className[0]));
+        AppendEscaped(m_buffer, className.c_str() + 1, true);
+    }
+    if (gClass.length() > 0) {
+        m_buffer.push_back(' ');
+        AppendEscaped(m_buffer, gClass.c_str(), true);
+    }
+    if (svgClass && object->HasSVGClass()) {
+        m_buffer.push_back(' ');
+        AppendEscaped(m_buffer, object->GetSVGClass().c_str(), true);
+    }
+    m_buffer.push_back('"');
+}
+
+void SvgStreamDeviceContext::Flush(bool force)
+{
+    if (!force && (m_buffer.size() < SVG_STREAM_BUFFER_SIZE)) return;
+
+    m_output->write(m_buffer.data(), m_buffer.size());
+    m_buffer.clear();
+}
+
+void SvgStreamDeviceContext::Commit()
+{
+    if (m_committed) return;
+
+    StartSvg();
+
+    // close the elements left open, but not the <svg>
+    while (m_elementStack.size() > 1) {
+        LogWarning("SVG element <%s> not closed when committing", m_elementStack.back());
+        EndElement();
+    }
+
+    // the <defs> go at the end because the glyphs are known only now
+    if (m_smufl_glyphs.size() > 0) {
+        StartElement("defs");
+        // for each needed glyph
+        std::vector<const Glyph *>::const_iterator it;
+        for (it = m_smufl_glyphs.begin(); it != m_smufl_glyphs.end(); ++it) {
+            const std::string &glyphDefs = GetGlyphDefs(*it);
+            if (glyphDefs.empty()) continue;
+            if (m_startTagOpen) {
+                m_buffer.push_back('>');
+                m_startTagOpen = false;
+            }
+            m_buffer.append(glyphDefs);
+            Flush();
+        }
+        EndElement();
+    }
+
+    // add the woff VerovioText font if needed
+    if (m_vrvTextFont) {
+        const std::string &woff = GetWoff(this->GetResources()->GetPath());
+        if (!woff.empty()) {
+            if (m_startTagOpen) {
+                m_buffer.push_back('>');
+                m_startTagOpen = false;
+            }
+            m_buffer.append(woff);
+        }
+    }
+
+    // end the <svg>
+    EndElement();
+    m_buffer.push_back('\n');
+
+    Flush(true);
+    m_output->flush();
+
+    m_committed = true;
+}
+
+void SvgStreamDeviceContext::StartGraphic(Object *object, const std::string &gClass, const std::string &gId)
+{
+    StartObjectElement("g", object, gClass, true);
+
+    if (gId.length() > 0) {
+        AppendAttribute(m_buffer, "id", gId.c_str());
+    }
+
+    if (object->HasAttClass(ATT_COLOR)) {
+        AttColor *att = dynamic_cast<AttColor *>(object);
+        assert(att);
+        if (att->HasColor()) {
+            AppendAttribute(m_buffer, "fill", att->GetColor().c_str());
+            AppendAttribute(m_buffer, "stroke", att->GetColor().c_str());
+        }
+    }
+
+    if (object->HasAttClass(ATT_LANG)) {
+        AttLang *att = dynamic_cast<AttLang *>(object);
+        assert(att);
+        if (att->HasLang()) {
+            AppendAttribute(m_buffer, "xml:lang", att->GetLang().c_str());
+        }
+    }
+
+    if (object->HasAttClass(ATT_VISIBILITY)) {
+        AttVisibility *att = dynamic_cast<AttVisibility *>(object);
+        assert(att);
+        if (att->GetVisible() == BOOLEAN_false) {
+            AppendAttribute(m_buffer, "visibility", "hidden");
+        }
+    }
+}
+
+void SvgStreamDeviceContext::StartTextGraphic(Object *object, const std::string &gClass, const std::string &gId)
+{
+    StartObjectElement("tspan", object, gClass, false);
+    AppendAttribute(m_buffer, "id", gId.c_str());
+
+    if (object->HasAttClass(ATT_COLOR)) {
+        AttColor *att = dynamic_cast<AttColor *>(object);
+        assert(att);
+        if (att->HasColor()) AppendAttribute(m_buffer, "fill", att->GetColor().c_str());
+    }
+
+    if (object->HasAttClass(ATT_LANG)) {
+        AttLang *att = dynamic_cast<AttLang *>(object);
+        assert(att);
+        if (att->HasLang()) {
+            AppendAttribute(m_buffer, "xml:lang", att->GetLang().c_str());
+        }
+    }
+}
+
+void SvgStreamDeviceContext::ResumeGraphic(Object *object, const std::string &gId)
+{
+    // The original <g> is already written - the content goes in a new one with the same class
+    StartObjectElement("g", object, "", true);
+}
+
+void SvgStreamDeviceContext::EndGraphic(Object *object, View *view)
+{
+    DrawSvgBoundingBox(object, view);
+    EndElement();
+}
+
+void SvgStreamDeviceContext::EndResumedGraphic(Object *object, View *view)
+{
+    DrawSvgBoundingBox(object, view);
+    EndElement();
+}
+
+void SvgStreamDeviceContext::EndTextGraphic(Object *object, View *view)
+{
+    EndElement();
+}
+
+void SvgStreamDeviceContext::StartPage()
+{
+    // Initialize the flag to false because we want to know if the font needs to be included in the SVG
+    m_vrvTextFont = false;
+
+    // default styles
+    StartElement("style");
+    m_buffer.append(" type=\"text/css\">g.page-margin{font-family:Times;} g.tempo{font-weight:bold;} g.dir, g.dynam "
+                    "{font-style:italic;}</style>");
+    m_elementStack.pop_back();
+    m_startTagOpen = false;
+
+    // a graphic for definition scaling
+    StartElement("svg");
+    AppendAttribute(m_buffer, "id", "definition-scale");
+    m_buffer.append(" viewBox=\"0 0 ");
+    AppendInt(m_buffer, m_width * DEFINITION_FACTOR);
+    m_buffer.push_back(' ');
+    AppendInt(m_buffer, m_height * DEFINITION_FACTOR);
+    m_buffer.push_back('"');
+
+    // a graphic for the origin
+    StartElement("g");
+    AppendAttribute(m_buffer, "class", "page-margin");
+    m_buffer.append(" transform=\"translate(");
+    AppendInt(m_buffer, m_originX);
+    m_buffer.append(", ");
+    AppendInt(m_buffer, m_originY);
+    m_buffer.append(")\"");
+}
+
+void SvgStreamDeviceContext::EndPage()
+{
+    // end page-margin
+    EndElement();
+    // end definition-scale
+    EndElement();
+}
+
+void SvgStreamDeviceContext::SetBackground(int colour, int style)
+{
+    // nothing to do, we do not handle Background
+}
+
+void SvgStreamDeviceContext::SetBackgroundImage(void *image, double opacity)
+{
+}
+
+void SvgStreamDeviceContext::SetBackgroundMode(int mode)
+{
+    // nothing to do, we do not handle Background Mode
+}
+
+void SvgStreamDeviceContext::SetTextForeground(int colour)
+{
+    m_brushStack.top().SetColour(colour); // we use the brush colour for text
+}
+
+void SvgStreamDeviceContext::SetTextBackground(int colour)
+{
+    // nothing to do, we do not handle Text Background Mode
+}
+
+void SvgStreamDeviceContext::SetLogicalOrigin(int x, int y)
+{
+    m_originX = -x;
+    m_originY = -y;
+}
+
+void SvgStreamDeviceContext::SetUserScale(double xScale, double yScale)
+{
+    if (m_svgStarted) LogWarning("The user scale cannot be changed once the SVG is started");
+    m_userScaleX = xScale;
+    m_userScaleY = yScale;
+}
+
+Point SvgStreamDeviceContext::GetLogicalOrigin()
+{
+    return Point(m_originX, m_originY);
+}
+
+// Drawing mething
+void SvgStreamDeviceContext::DrawComplexBezierPath(Point bezier1[4], Point bezier2[4])
+{
+    StartElement("path");
+    m_buffer.append(" d=\"M");
+    AppendInt(m_buffer, bezier1[0].x);
+    m_buffer.push_back(',');
+    AppendInt(m_buffer, bezier1[0].y);
+    // First bezier
+    m_buffer.append(" C");
+    for (int i = 1; i < 4; ++i) {
+        if (i > 1) m_buffer.push_back(' ');
+        AppendInt(m_buffer, bezier1[i].x);
+        m_buffer.push_back(',');
+        AppendInt(m_buffer, bezier1[i].y);
+    }
+    // Second Bezier
+    m_buffer.append(" C");
+    for (int i = 2; i >= 0; --i) {
+        if (i < 2) m_buffer.push_back(' ');
+        AppendInt(m_buffer, bezier2[i].x);
+        m_buffer.push_back(',');
+        AppendInt(m_buffer, bezier2[i].y);
+    }
+    m_buffer.append("\" stroke=\"#");
+    AppendColour(m_penStack.top().GetColour());
+    m_buffer.append("\" stroke-linecap=\"round\" stroke-linejoin=\"round\"");
+    AppendAttribute(m_buffer, "stroke-width", m_penStack.top().GetWidth());
+    EndElement();
+}
+
+void SvgStreamDeviceContext::DrawCircle(int x, int y, int radius)
+{
+    DrawEllipse(x - radius, y - radius, 2 * radius, 2 * radius);
+}
+
+void SvgStreamDeviceContext::DrawEllipse(int x, int y, int width, int height)
+{
+    assert(m_penStack.size());
+    assert(m_brushStack.size());
+
+    Pen currentPen = m_penStack.top();
+    Brush currentBrush = m_brushStack.top();
+
+    int rh = height / 2;
+    int rw = width / 2;
+
+    StartElement("ellipse");
+    AppendAttribute(m_buffer, "cx", x + rw);
+    AppendAttribute(m_buffer, "cy", y + rh);
+    AppendAttribute(m_buffer, "rx", rw);
+    AppendAttribute(m_buffer, "ry", rh);
+    if (currentBrush.GetOpacity() != 1.0) AppendAttribute(m_buffer, "fill-opacity", currentBrush.GetOpacity());
+    if (currentPen.GetOpacity() != 1.0) AppendAttribute(m_buffer, "stroke-opacity", currentPen.GetOpacity());
+    if (currentPen.GetWidth() > 0) {
+        AppendAttribute(m_buffer, "stroke-width", currentPen.GetWidth());
+        m_buffer.append(" stroke=\"#");
+        AppendColour(m_penStack.top().GetColour());
+        m_buffer.push_back('"');
+    }
+    EndElement();
+}
+
+void SvgStreamDeviceContext::DrawEllipticArc(int x, int y, int width, int height, double start, double end)
+{
+    // See SvgDeviceContext::DrawEllipticArc
+
+    assert(m_penStack.size());
+    assert(m_brushStack.size());
+
+    Pen currentPen = m_penStack.top();
+    Brush currentBrush = m_brushStack.top();
+
+    // radius
+    double rx = width / 2;
+    double ry = height / 2;
+    // center
+    double xc = x + rx;
+    double yc = y + ry;
+
+    double xs, ys, xe, ye;
+    xs = xc + rx * cos(DegToRad(start));
+    xe = xc + rx * cos(DegToRad(end));
+    ys = yc - ry * sin(DegToRad(start));
+    ye = yc - ry * sin(DegToRad(end));
+
+    /// now same as circle arc...
+    double theta1 = atan2(ys - yc, xs - xc);
+    double theta2 = atan2(ye - yc, xe - xc);
+
+    int fArc;
+    // flag for large or small arc 0 means less than 180 degrees
+    if ((theta2 - theta1) > 0)
+        fArc = 1;
+    else
+        fArc = 0;
+
+    int fSweep;
+    if (fabs(theta2 - theta1) > M_PI)
+        fSweep = 1;
+    else
+        fSweep = 0;
+
+    StartElement("path");
+    AppendAttribute(m_buffer, "d",
+        StringFormat("M%d %d A%d %d 0.0 %d %d %d %d", int(xs), int(ys), abs(int(rx)), abs(int(ry)), fArc, fSweep,
+            int(xe), int(ye))
+            .c_str());
+    if (currentBrush.GetOpacity() != 1.0) AppendAttribute(m_buffer, "fill-opacity", currentBrush.GetOpacity());
+    if (currentPen.GetOpacity() != 1.0) AppendAttribute(m_buffer, "stroke-opacity", currentPen.GetOpacity());
+    if (currentPen.GetWidth() > 0) {
+        AppendAttribute(m_buffer, "stroke-width", currentPen.GetWidth());
+        m_buffer.append(" stroke=\"#");
+        AppendColour(m_penStack.top().GetColour());
+        m_buffer.push_back('"');
+    }
+    EndElement();
+}
+
+void SvgStreamDeviceContext::DrawLine(int x1, int y1, int x2, int y2)
+{
+    StartElement("path");
+    m_buffer.append(" d=\"M");
+    AppendInt(m_buffer, x1);
+    m_buffer.push_back(' ');
+    AppendInt(m_buffer, y1);
+    m_buffer.append(" L");
+    AppendInt(m_buffer, x2);
+    m_buffer.push_back(' ');
+    AppendInt(m_buffer, y2);
+    m_buffer.append("\" stroke=\"#");
+    AppendColour(m_penStack.top().GetColour());
+    m_buffer.push_back('"');
+    if (m_penStack.top().GetDashLenght() > 0) {
+        m_buffer.append(" stroke-dasharray=\"");
+        AppendInt(m_buffer, m_penStack.top().GetDashLenght());
+        m_buffer.append(", ");
+        AppendInt(m_buffer, m_penStack.top().GetDashLenght());
+        m_buffer.push_back('"');
+    }
+    if (m_penStack.top().GetWidth() > 1) AppendAttribute(m_buffer, "stroke-width", m_penStack.top().GetWidth());
+    EndElement();
+}
+
+void SvgStreamDeviceContext::DrawPolygon(int n, Point points[], int xoffset, int yoffset, int fill_style)
+{
+    assert(m_penStack.size());
+    assert(m_brushStack.size());
+
+    Pen currentPen = m_penStack.top();
+    Brush currentBrush = m_brushStack.top();
+
+    StartElement("polygon");
+    if (currentPen.GetWidth() > 0) {
+        m_buffer.append(" stroke=\"#");
+        AppendColour(currentPen.GetColour());
+        m_buffer.push_back('"');
+    }
+    if (currentPen.GetWidth() > 1) AppendAttribute(m_buffer, "stroke-width", currentPen.GetWidth());
+    if (currentPen.GetOpacity() != 1.0) {
+        m_buffer.append(" stroke-opacity=\"");
+        AppendFormatted(m_buffer, "%f", currentPen.GetOpacity());
+        m_buffer.push_back('"');
+    }
+    if (currentBrush.GetColour() != AxBLACK) {
+        m_buffer.append(" fill=\"#");
+        AppendColour(currentBrush.GetColour());
+        m_buffer.push_back('"');
+    }
+    if (currentBrush.GetOpacity() != 1.0) {
+        m_buffer.append(" fill-opacity=\"");
+        AppendFormatted(m_buffer, "%f", currentBrush.GetOpacity());
+        m_buffer.push_back('"');
+    }
+
+    m_buffer.append(" points=\"");
+    for (int i = 0; i < n; i++) {
+        AppendInt(m_buffer, points[i].x + xoffset);
+        m_buffer.push_back(',');
+        AppendInt(m_buffer, points[i].y + yoffset);
+        m_buffer.push_back(' ');
+    }
+    m_buffer.push_back('"');
+    EndElement();
+}
+
+void SvgStreamDeviceContext::DrawRectangle(int x, int y, int width, int height)
+{
+    DrawRoundedRectangle(x, y, width, height, 0);
+}
+
+void SvgStreamDeviceContext::DrawRoundedRectangle(int x, int y, int width, int height, double radius)
+{
+    // negative heights or widths are not allowed in SVG
+    if (height < 0) {
+        height = -height;
+        y -= height;
+    }
+    if (width < 0) {
+        width = -width;
+        x -= width;
+    }
+
+    StartElement("rect");
+    AppendAttribute(m_buffer, "x", x);
+    AppendAttribute(m_buffer, "y", y);
+    AppendAttribute(m_buffer, "height", height);
+    AppendAttribute(m_buffer, "width", width);
+    if (radius != 0) AppendAttribute(m_buffer, "rx", radius);
+    EndElement();
+}
+
+void SvgStreamDeviceContext::StartText(int x, int y, char alignment)
+{
+    StartElement("text");
+    AppendAttribute(m_buffer, "x", x);
+    AppendAttribute(m_buffer, "y", y);
+    if (alignment == RIGHT) {
+        AppendAttribute(m_buffer, "text-anchor", "end");
+    }
+    if (alignment == CENTER) {
+        AppendAttribute(m_buffer, "text-anchor", "middle");
+    }
+    // font-size seems to be required in <text> in FireFox and also we set it to 0px so space
+    // is not added between tspan elements
+    m_buffer.append(" font-size=\"0px\"");
+
+    FontInfo *font = m_fontStack.top();
+    const std::string faceName = font->GetFaceName();
+    if (!faceName.empty()) {
+        AppendAttribute(m_buffer, "font-family", faceName.c_str());
+    }
+    if (font->GetStyle() == FONTSTYLE_italic) {
+        m_buffer.append(" font-style=\"italic\"");
+    }
+    else if (font->GetStyle() == FONTSTYLE_normal) {
+        m_buffer.append(" font-style=\"normal\"");
+    }
+    else if (font->GetStyle() == FONTSTYLE_oblique) {
+        m_buffer.append(" font-style=\"oblique\"");
+    }
+    if (font->GetWeight() == FONTWEIGHT_bold) {
+        m_buffer.append(" font-weight=\"bold\"");
+    }
+}
+
+void SvgStreamDeviceContext::MoveTextTo(int x, int y)
+{
+    // The attributes can only be added as long as the start tag of the <text> is not closed
+    if (!m_startTagOpen) {
+        LogWarning("The text cannot be moved once its content is written");
+        return;
+    }
+    AppendAttribute(m_buffer, "x", x);
+    AppendAttribute(m_buffer, "y", y);
+}
+
+void SvgStreamDeviceContext::EndText()
+{
+    EndElement();
+}
+
+void SvgStreamDeviceContext::DrawText(const std::string &text, const std::wstring wtext)
+{
+    assert(m_fontStack.top());
+
+    FontInfo *font = m_fontStack.top();
+
+    StartElement("tspan");
+    const std::string faceName = font->GetFaceName();
+    if (!faceName.empty()) {
+        AppendAttribute(m_buffer, "font-family", faceName.c_str());
+        // Special case where we want to specifiy if the VerovioText font (woff) needs to be included in the output
+        if (faceName == "VerovioText") this->VrvTextFont();
+    }
+    if (font->GetPointSize() != 0) {
+        m_buffer.append(" font-size=\"");
+        AppendInt(m_buffer, font->GetPointSize());
+        m_buffer.append("px\"");
+    }
+    if (font->GetStyle() == FONTSTYLE_italic) {
+        m_buffer.append(" font-style=\"italic\"");
+    }
+    else if (font->GetStyle() == FONTSTYLE_normal) {
+        m_buffer.append(" font-style=\"normal\"");
+    }
+    else if (font->GetStyle() == FONTSTYLE_oblique) {
+        m_buffer.append(" font-style=\"oblique\"");
+    }
+    if (font->GetWeight() == FONTWEIGHT_bold) {
+        m_buffer.append(" font-weight=\"bold\"");
+    }
+    else if (font->GetWeight() == FONTWEIGHT_normal) {
+        m_buffer.append(" font-weight=\"normal\"");
+    }
+    m_buffer.append(" class=\"text\" xml:space=\"preserve\">");
+    // Because IE does not support xml:space="preserve", we need to replace the initial
+    // space with a non breakable space
+    if ((text.length() > 0) && (text[0] == ' ')) {
+        m_buffer.append("\xC2\xA0");
+        AppendEscaped(m_buffer, text.c_str() + 1, false);
+    }
+    else {
+        AppendEscaped(m_buffer, text.c_str(), false);
+    }
+    // the text is written inline
+    m_buffer.append("</tspan>");
+    m_elementStack.pop_back();
+    m_startTagOpen = false;
+}
+
+void SvgStreamDeviceContext::DrawRotatedText(const std::string &text, int x, int y, double angle)
+{
+    // TODO
+}
+
+void SvgStreamDeviceContext::DrawMusicText(const std::wstring &text, int x, int y)
+{
+    assert(m_fontStack.top());
+
+    int w, h, gx, gy;
+    int pointSize = m_fontStack.top()->GetPointSize();
+
+    // print chars one by one
+    for (unsigned int i = 0; i < text.length(); i++) {
+        wchar_t c = text[i];
+        const Glyph *glyph = this->GetResources()->GetGlyph(c);
+        if (!glyph) {
+            continue;
+        }
+
+        // Add the glyph to the array for the <defs>
+        if (m_smuflGlyphSet.insert(glyph).second) {
+            m_smufl_glyphs.push_back(glyph);
+        }
+
+        // Write the char in the SVG
+        StartElement("use");
+        m_buffer.append(" xlink:href=\"#");
+        AppendEscaped(m_buffer, glyph->GetCodeStr().c_str(), true);
+        m_buffer.push_back('"');
+        AppendAttribute(m_buffer, "x", x);
+        AppendAttribute(m_buffer, "y", y);
+        m_buffer.append(" height=\"");
+        AppendInt(m_buffer, pointSize);
+        m_buffer.append("px\" width=\"");
+        AppendInt(m_buffer, pointSize);
+        m_buffer.append("px\"");
+        EndElement();
+
+        // Get the bounds of the char
+        if (glyph->GetHorizAdvX() > 0)
+            x += glyph->GetHorizAdvX() * pointSize / glyph->GetUnitsPerEm();
+        else {
+            glyph->GetBoundingBox(&gx, &gy, &w, &h);
+            x += w * pointSize / glyph->GetUnitsPerEm();
+        }
+    }
+}
+
+void SvgStreamDeviceContext::DrawSpline(int n, Point points[])
+{
+}
+
+void SvgStreamDeviceContext::DrawBackgroundImage(int x, int y)
+{
+}
+
+void SvgStreamDeviceContext::AppendColour(int colour)
+{
+    switch (colour) {
+        case (AxBLACK): m_buffer.append("000000"); break;
+        case (AxWHITE): m_buffer.append("FFFFFF"); break;
+        case (AxRED): m_buffer.append("FF0000"); break;
+        case (AxGREEN): m_buffer.append("00FF00"); break;
+        case (AxBLUE): m_buffer.append("0000FF"); break;
+        case (AxCYAN): m_buffer.append("00FFFF"); break;
+        case (AxLIGHT_GREY): m_buffer.append("777777"); break;
+        default:
+            char buffer[32];
+            int blue = (colour & 255);
+            int green = (colour >> 8) & 255;
+            int red = (colour >> 16) & 255;
+            snprintf(buffer, sizeof(buffer), "%x%x%x", red, green, blue);
+            m_buffer.append(buffer);
+    }
+}
+
+void SvgStreamDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
+{
+    bool drawBoundingBox = false;
+    if (drawBoundingBox && view) {
+        BoundingBox *box = object;
+        // For floating elements, get the current bounding box set by System::SetCurrentFloatingPositioner
+        if (object->IsFloatingObject()) {
+            FloatingObject *floatingObject = dynamic_cast<FloatingObject *>(object);
+            assert(floatingObject);
+            box = floatingObject->GetCurrentFloatingPositioner();
+            // No bounding box found, ignore the object - this happens when the @staff is missing because the element is
+            // never drawn but there is still a EndGraphic call.
+            if (!box) return;
+        }
+
+        SetPen(AxRED, 10, AxDOT_DASH);
+        StartGraphic(object, "self-bounding-box", "0");
+        if (object->HasSelfBB()) {
+            this->DrawRectangle(view->ToDeviceContextX(object->GetDrawingX() + box->m_selfBB_x1),
+                view->ToDeviceContextY(object->GetDrawingY() + box->m_selfBB_y1),
+                view->ToDeviceContextX(object->GetDrawingX() + box->m_selfBB_x2)
+                    - view->ToDeviceContextX(object->GetDrawingX() + box->m_selfBB_x1),
+                view->ToDeviceContextY(object->GetDrawingY() + box->m_selfBB_y2)
+                    - view->ToDeviceContextY(object->GetDrawingY() + box->m_selfBB_y1));
+        }
+        EndGraphic(object, NULL);
+
+        SetPen(AxBLUE, 10, AxDOT_DASH);
+        StartGraphic(object, "content-bounding-box", "0");
+        if (object->HasContentBB()) {
+            this->DrawRectangle(view->ToDeviceContextX(object->GetDrawingX() + box->m_contentBB_x1),
+                view->ToDeviceContextY(object->GetDrawingY() + box->m_contentBB_y1),
+                view->ToDeviceContextX(object->GetDrawingX() + box->m_contentBB_x2)
+                    - view->ToDeviceContextX(object->GetDrawingX() + box->m_contentBB_x1),
+                view->ToDeviceContextY(object->GetDrawingY() + box->m_contentBB_y2)
+                    - view->ToDeviceContextY(object->GetDrawingY() + box->m_contentBB_y1));
+        }
+        EndGraphic(object, NULL);
+
+        SetPen(AxBLACK, 1, AxSOLID);
+        SetBrush(AxBLACK, AxSOLID);
+    }
+}
+
+} // namespace vrv
@@ -144,6 +144,18 @@ void System::SetDrawingScoreDef(ScoreDef *drawingScoreDef)
 // System functor methods
 //----------------------------------------------------------------------------
 
+int System::CalcMemoryFootprint(FunctorParams *functorParams)
+{
+    CalcMemoryFootprintParams *params = vrv_cast<CalcMemoryFootprintParams *>(functorParams);
+    assert(params);
+
+    Object::CalcMemoryFootprint(params);
+
+    m_systemAligner.Process(params->m_functor, params);
+
+    return FUNCTOR_CONTINUE;
+}
+
 int System::UnsetCurrentScoreDef(FunctorParams *functorParams)
 {
     if (m_drawingScoreDef) {
@@ -176,7 +188,7 @@ int System::ResetVerticalAlignment(FunctorParams *functorParams)
 
 int System::AlignHorizontally(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     // since we are starting a new system its first scoreDef will need to be a SYSTEM_SCOREDEF
@@ -187,7 +199,7 @@ int System::AlignHorizontally(FunctorParams *functorParams)
 
 int System::AlignVertically(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     params->m_systemAligner = &m_systemAligner;
@@ -197,7 +209,7 @@ int System::AlignVertically(FunctorParams *functorParams)
 
 int System::SetAligmentYPos(FunctorParams *functorParams)
 {
-    SetAligmentYPosParams *params = dynamic_cast<SetAligmentYPosParams *>(functorParams);
+    SetAligmentYPosParams *params = vrv_cast<SetAligmentYPosParams *>(functorParams);
     assert(params);
 
     params->m_previousStaffHeight = 0;
@@ -211,7 +223,7 @@ int System::SetAligmentYPos(FunctorParams *functorParams)
 
 int System::IntegrateBoundingBoxYShift(FunctorParams *functorParams)
 {
-    IntegrateBoundingBoxYShiftParams *params = dynamic_cast<IntegrateBoundingBoxYShiftParams *>(functorParams);
+    IntegrateBoundingBoxYShiftParams *params = vrv_cast<IntegrateBoundingBoxYShiftParams *>(functorParams);
     assert(params);
 
     params->m_shift = 0;
@@ -222,7 +234,7 @@ int System::IntegrateBoundingBoxYShift(FunctorParams *functorParams)
 
 int System::AlignMeasures(FunctorParams *functorParams)
 {
-    AlignMeasuresParams *params = dynamic_cast<AlignMeasuresParams *>(functorParams);
+    AlignMeasuresParams *params = vrv_cast<AlignMeasuresParams *>(functorParams);
     assert(params);
 
     m_drawingXRel = this->m_systemLeftMar + this->GetDrawingLabelsWidth();
@@ -234,7 +246,7 @@ int System::AlignMeasures(FunctorParams *functorParams)
 
 int System::AlignMeasuresEnd(FunctorParams *functorParams)
 {
-    AlignMeasuresParams *params = dynamic_cast<AlignMeasuresParams *>(functorParams);
+    AlignMeasuresParams *params = vrv_cast<AlignMeasuresParams *>(functorParams);
     assert(params);
 
     m_drawingTotalWidth = params->m_shift + this->GetDrawingLabelsWidth();
@@ -245,7 +257,7 @@ int System::AlignMeasuresEnd(FunctorParams *functorParams)
 
 int System::AlignSystems(FunctorParams *functorParams)
 {
-    AlignSystemsParams *params = dynamic_cast<AlignSystemsParams *>(functorParams);
+    AlignSystemsParams *params = vrv_cast<AlignSystemsParams *>(functorParams);
     assert(params);
 
     this->m_drawingYRel = params->m_shift;
@@ -259,7 +271,7 @@ int System::AlignSystems(FunctorParams *functorParams)
 
 int System::JustifyX(FunctorParams *functorParams)
 {
-    JustifyXParams *params = dynamic_cast<JustifyXParams *>(functorParams);
+    JustifyXParams *params = vrv_cast<JustifyXParams *>(functorParams);
     assert(params);
 
     assert(m_parent);
@@ -292,7 +304,7 @@ int System::JustifyX(FunctorParams *functorParams)
 
 int System::CalcStaffOverlap(FunctorParams *functorParams)
 {
-    CalcStaffOverlapParams *params = dynamic_cast<CalcStaffOverlapParams *>(functorParams);
+    CalcStaffOverlapParams *params = vrv_cast<CalcStaffOverlapParams *>(functorParams);
     assert(params);
 
     params->m_previous = NULL;
@@ -303,7 +315,7 @@ int System::CalcStaffOverlap(FunctorParams *functorParams)
 
 int System::AdjustFloatingPostioners(FunctorParams *functorParams)
 {
-    AdjustFloatingPostionersParams *params = dynamic_cast<AdjustFloatingPostionersParams *>(functorParams);
+    AdjustFloatingPostionersParams *params = vrv_cast<AdjustFloatingPostionersParams *>(functorParams);
     assert(params);
 
     AdjustFloatingPostionerGrpsParams adjustFloatingPostionerGrpsParams(params->m_doc);
@@ -351,7 +363,7 @@ int System::AdjustFloatingPostioners(FunctorParams *functorParams)
 
 int System::CastOffPages(FunctorParams *functorParams)
 {
-    CastOffPagesParams *params = dynamic_cast<CastOffPagesParams *>(functorParams);
+    CastOffPagesParams *params = vrv_cast<CastOffPagesParams *>(functorParams);
     assert(params);
 
     if ((params->m_currentPage->GetChildCount() > 0)
@@ -365,7 +377,7 @@ int System::CastOffPages(FunctorParams *functorParams)
     // We want to move the system to the currentPage. However, we cannot use DetachChild
     // from the contentPage because this screws up the iterator. Relinquish gives up
     // the ownership of the system - the contentPage itself will be deleted afterwards.
-    System *system = dynamic_cast<System *>(params->m_contentPage->Relinquish(this->GetIdx()));
+    System *system = vrv_cast<System *>(params->m_contentPage->Relinquish(this->GetIdx()));
     assert(system);
     params->m_currentPage->AddChild(system);
 
@@ -374,7 +386,7 @@ int System::CastOffPages(FunctorParams *functorParams)
 
 int System::UnCastOff(FunctorParams *functorParams)
 {
-    UnCastOffParams *params = dynamic_cast<UnCastOffParams *>(functorParams);
+    UnCastOffParams *params = vrv_cast<UnCastOffParams *>(functorParams);
     assert(params);
 
     // Just move all the content of the system to the continous one (parameter)
@@ -387,7 +399,7 @@ int System::UnCastOff(FunctorParams *functorParams)
 
 int System::SetDrawingXY(FunctorParams *functorParams)
 {
-    SetDrawingXYParams *params = dynamic_cast<SetDrawingXYParams *>(functorParams);
+    SetDrawingXYParams *params = vrv_cast<SetDrawingXYParams *>(functorParams);
     assert(params);
 
     params->m_currentSystem = this;
@@ -414,7 +426,7 @@ int System::SetDrawingXY(FunctorParams *functorParams)
 
 int System::CastOffSystemsEnd(FunctorParams *functorParams)
 {
-    CastOffSystemsParams *params = dynamic_cast<CastOffSystemsParams *>(functorParams);
+    CastOffSystemsParams *params = vrv_cast<CastOffSystemsParams *>(functorParams);
     assert(params);
 
     if (params->m_pendingObjects.empty()) return FUNCTOR_STOP;
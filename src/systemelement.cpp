@@ -24,7 +24,7 @@ SystemElement::SystemElement() : FloatingObject("se")
     Reset();
 }
 
-SystemElement::SystemElement(std::string classid) : FloatingObject(classid)
+SystemElement::SystemElement(const char *classid) : FloatingObject(classid)
 {
     Reset();
 }
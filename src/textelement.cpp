@@ -24,7 +24,7 @@ TextElement::TextElement() : Object("te-")
     Reset();
 }
 
-TextElement::TextElement(std::string classid) : Object(classid)
+TextElement::TextElement(const char *classid) : Object(classid)
 {
     Reset();
 }
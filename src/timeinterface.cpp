@@ -14,6 +14,7 @@
 //----------------------------------------------------------------------------
 
 #include "attcomparison.h"
+#include "doc.h"
 #include "functorparams.h"
 #include "layerelement.h"
 #include "measure.h"
@@ -55,14 +56,13 @@ void TimePointInterface::SetStart(LayerElement *start)
     m_start = start;
 }
 
-bool TimePointInterface::SetStartOnly(LayerElement *element)
+bool TimePointInterface::SetStartOnly(Doc *doc, Measure *measure)
 {
-    // LogDebug("%s - %s - %s", element->GetUuid().c_str(), m_startUuid.c_str(), m_endUuid.c_str() );
-    if (!m_start && !m_startUuid.empty() && (element->GetUuid() == m_startUuid)) {
-        this->SetStart(element);
-        return true;
+    if (!m_start && !m_startUuid.empty()) {
+        LayerElement *start = this->FindLinkedElement(doc, m_startUuid, measure);
+        if (start) this->SetStart(start);
     }
-    return false;
+    return (m_start);
 }
 
 void TimePointInterface::AddStaff(int n)
@@ -90,6 +90,16 @@ std::string TimePointInterface::ExtractUuidFragment(std::string refUuid)
     return refUuid;
 }
 
+LayerElement *TimePointInterface::FindLinkedElement(Doc *doc, const std::string &uuid, Measure *measure)
+{
+    assert(doc);
+
+    Object *object = doc->FindInUuidIndex(uuid, doc);
+    if (!object || !object->IsLayerElement()) return NULL;
+    if (measure && (object->GetFirstParent(MEASURE) != measure)) return NULL;
+    return dynamic_cast<LayerElement *>(object);
+}
+
 Measure *TimePointInterface::GetStartMeasure()
 {
     if (!m_start) return NULL;
@@ -182,14 +192,12 @@ void TimeSpanningInterface::SetUuidStr()
     }
 }
 
-bool TimeSpanningInterface::SetStartAndEnd(LayerElement *element)
+bool TimeSpanningInterface::SetStartAndEnd(Doc *doc, Measure *measure)
 {
-    // LogDebug("%s - %s - %s", element->GetUuid().c_str(), m_startUuid.c_str(), m_endUuid.c_str() );
-    if (!m_start && !m_startUuid.empty() && (element->GetUuid() == m_startUuid)) {
-        this->SetStart(element);
-    }
-    else if (!m_end && !m_endUuid.empty() && (element->GetUuid() == m_endUuid)) {
-        this->SetEnd(element);
+    TimePointInterface::SetStartOnly(doc, measure);
+    if (!m_end && !m_endUuid.empty()) {
+        LayerElement *end = this->FindLinkedElement(doc, m_endUuid, measure);
+        if (end) this->SetEnd(end);
     }
     return (m_start && m_end);
 }
@@ -212,7 +220,7 @@ bool TimeSpanningInterface::IsSpanningMeasures()
 
 int TimePointInterface::InterfacePrepareTimestamps(FunctorParams *functorParams, Object *object)
 {
-    PrepareTimestampsParams *params = dynamic_cast<PrepareTimestampsParams *>(functorParams);
+    PrepareTimestampsParams *params = vrv_cast<PrepareTimestampsParams *>(functorParams);
     assert(params);
 
     // First we check if the object has already a mapped @startid (it should not)
@@ -241,39 +249,48 @@ int TimePointInterface::InterfaceResetDrawing(FunctorParams *functorParams, Obje
 
 int TimePointInterface::InterfacePrepareTimePointing(FunctorParams *functorParams, Object *object)
 {
-    PrepareTimePointingParams *params = dynamic_cast<PrepareTimePointingParams *>(functorParams);
+    PrepareTimeSpanningParams *params = vrv_cast<PrepareTimeSpanningParams *>(functorParams);
     assert(params);
 
     if (!this->HasStartid()) return FUNCTOR_CONTINUE;
 
     this->SetUuidStr();
-    params->m_timePointingInterfaces.push_back(std::make_pair(this, object->Is()));
+    // The start of time pointing elements is matched only within their measure
+    this->SetStartOnly(params->m_doc, dynamic_cast<Measure *>(object->GetFirstParent(MEASURE)));
 
     return FUNCTOR_CONTINUE;
 }
 
 int TimeSpanningInterface::InterfacePrepareTimeSpanning(FunctorParams *functorParams, Object *object)
 {
-    PrepareTimeSpanningParams *params = dynamic_cast<PrepareTimeSpanningParams *>(functorParams);
+    PrepareTimeSpanningParams *params = vrv_cast<PrepareTimeSpanningParams *>(functorParams);
     assert(params);
 
     if (!this->HasStartid() && !this->HasEndid()) {
         return FUNCTOR_CONTINUE;
     }
 
-    if (params->m_fillList == false) {
+    this->SetUuidStr();
+
+    // For elements for which we do not need to match the end (for now), we only look in the measure.
+    // Eventually, we could consider them, for example if we want to display their spanning or for improved
+    // midi output
+    if ((object->Is() == DIR) || (object->Is() == DYNAM) || (object->Is() == HARM)) {
+        this->SetStartAndEnd(params->m_doc, dynamic_cast<Measure *>(object->GetFirstParent(MEASURE)));
         return FUNCTOR_CONTINUE;
     }
 
-    this->SetUuidStr();
-    params->m_timeSpanningInterfaces.push_back(std::make_pair(this, object->Is()));
+    // Keep the ones that are not fully matched for PrepareTimestamps
+    if (!this->SetStartAndEnd(params->m_doc)) {
+        params->m_timeSpanningInterfaces.push_back(std::make_pair(this, object->Is()));
+    }
 
     return FUNCTOR_CONTINUE;
 }
 
 int TimeSpanningInterface::InterfacePrepareTimestamps(FunctorParams *functorParams, Object *object)
 {
-    PrepareTimestampsParams *params = dynamic_cast<PrepareTimestampsParams *>(functorParams);
+    PrepareTimestampsParams *params = vrv_cast<PrepareTimestampsParams *>(functorParams);
     assert(params);
 
     // First we check if the object has already a mapped @endid (it should not)
@@ -300,7 +317,7 @@ int TimeSpanningInterface::InterfacePrepareTimestamps(FunctorParams *functorPara
 
 int TimeSpanningInterface::InterfaceFillStaffCurrentTimeSpanning(FunctorParams *functorParams, Object *object)
 {
-    FillStaffCurrentTimeSpanningParams *params = dynamic_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
+    FillStaffCurrentTimeSpanningParams *params = vrv_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
     assert(params);
 
     if (this->IsSpanningMeasures()) {
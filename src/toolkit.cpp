@@ -9,11 +9,13 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
 
 //----------------------------------------------------------------------------
 
 #include "attcomparison.h"
+#include "displaylistdevicecontext.h"
 #include "iodarms.h"
 #include "iohumdrum.h"
 #include "iomei.h"
@@ -26,6 +28,8 @@
 #include "slur.h"
 #include "style.h"
 #include "svgdevicecontext.h"
+#include "svgstreamdevicecontext.h"
+#include "system.h"
 #include "vrv.h"
 
 //----------------------------------------------------------------------------
@@ -41,8 +45,6 @@ const char *UTF_16_LE_BOM = "\xFF\xFE";
 // Toolkit
 //----------------------------------------------------------------------------
 
-char *Toolkit::m_humdrumBuffer = NULL;
-
 Toolkit::Toolkit(bool initFont)
 {
     m_scale = DEFAULT_SCALE;
@@ -60,6 +62,11 @@ Toolkit::Toolkit(bool initFont)
     m_noLayout = false;
     m_ignoreLayout = false;
     m_adjustPageHeight = false;
+    m_compact = false;
+    m_glyphSpriteHref = "";
+    m_tileWidth = 0;
+    m_tileMeasures = false;
+    m_displayListCache = false;
     m_noJustification = false;
     m_evenNoteSpacing = false;
     m_showBoundingBoxes = false;
@@ -69,7 +76,7 @@ Toolkit::Toolkit(bool initFont)
     m_humdrumBuffer = NULL;
 
     if (initFont) {
-        Resources::InitFonts();
+        m_doc.GetResourcesForModification().InitFonts();
     }
 }
 
@@ -87,10 +94,21 @@ Toolkit::~Toolkit()
 
 bool Toolkit::SetResourcePath(const std::string &path)
 {
-    Resources::SetPath(path);
-    return Resources::InitFonts();
+    Resources &resources = m_doc.GetResourcesForModification();
+    resources.SetPath(path);
+    // the glyphs of the sprite are the ones of the previous font
+    m_spriteGlyphs.clear();
+    m_spriteGlyphSet.clear();
+    // the display lists use the previous font
+    ResetDisplayLists();
+    return resources.InitFonts();
 };
 
+std::string Toolkit::GetResourcePath() const
+{
+    return m_doc.GetResources().GetPath();
+}
+
 bool Toolkit::SetBorder(int border)
 {
     // We use left margin values because for now we cannot specify different values for each margin
@@ -322,9 +340,20 @@ FileFormat Toolkit::IdentifyInputFormat(const string &data)
 
 bool Toolkit::SetFont(std::string const &font)
 {
-    return Resources::SetFont(font);
+    // the glyphs of the sprite are the ones of the previous font
+    m_spriteGlyphs.clear();
+    m_spriteGlyphSet.clear();
+    ResetDisplayLists();
+    return m_doc.GetResourcesForModification().SetFont(font);
 };
 
+void Toolkit::SetXmlIdSeed(int seed)
+{
+    m_doc.SeedUuid(seed);
+    // Also for the objects not in the document tree
+    Object::SeedUuid(seed);
+}
+
 bool Toolkit::LoadFile(const std::string &filename)
 {
     if (IsUTF16(filename)) {
@@ -504,8 +533,16 @@ bool Toolkit::LoadData(const std::string &data)
         input->SetMdivXPathQuery(m_mdivXPathQuery);
     }
 
+    // objects created until the layout is done are allocated in the arena of the document (if any)
+    // the document is reset first because the arena is not cleared when it is reset by the input
+    if (m_doc.GetArena()) {
+        m_doc.Reset();
+        m_doc.GetArena()->Activate();
+    }
+
     // load the file
     if (!input->ImportString(newData.size() ? newData : data)) {
+        ObjectArena::Deactivate();
         LogError("Error importing data");
         delete input;
         return false;
@@ -546,6 +583,7 @@ bool Toolkit::LoadData(const std::string &data)
         m_doc.SetJustificationX(false);
     }
 
+    ObjectArena::Deactivate();
     delete input;
     m_view.SetDoc(&m_doc);
 
@@ -637,7 +675,7 @@ bool Toolkit::ParseOptions(const std::string &json_options)
 
     if (json.has<jsonxx::String>("mdivXPathQuery")) SetMdivXPathQuery(json.get<jsonxx::String>("mdivXPathQuery"));
 
-    if (json.has<jsonxx::Number>("xmlIdSeed")) Object::SeedUuid(json.get<jsonxx::Number>("xmlIdSeed"));
+    if (json.has<jsonxx::Number>("xmlIdSeed")) SetXmlIdSeed(json.get<jsonxx::Number>("xmlIdSeed"));
 
     // Parse the various flags
     // Note: it seems that there is a bug with jsonxx and emscripten
@@ -647,8 +685,22 @@ bool Toolkit::ParseOptions(const std::string &json_options)
 
     if (json.has<jsonxx::Number>("ignoreLayout")) SetIgnoreLayout(json.get<jsonxx::Number>("ignoreLayout"));
 
+    if (json.has<jsonxx::Number>("useArena")) SetUseArena(json.get<jsonxx::Number>("useArena"));
+
     if (json.has<jsonxx::Number>("adjustPageHeight")) SetAdjustPageHeight(json.get<jsonxx::Number>("adjustPageHeight"));
 
+    if (json.has<jsonxx::Number>("compact")) SetCompact(json.get<jsonxx::Number>("compact"));
+
+    if (json.has<jsonxx::String>("glyphSpriteHref"))
+        SetGlyphSpriteHref(json.get<jsonxx::String>("glyphSpriteHref"));
+
+    if (json.has<jsonxx::Number>("tileWidth")) SetTileWidth(json.get<jsonxx::Number>("tileWidth"));
+
+    if (json.has<jsonxx::Number>("tileMeasures")) SetTileMeasures(json.get<jsonxx::Number>("tileMeasures"));
+
+    if (json.has<jsonxx::Number>("displayListCache"))
+        SetDisplayListCache(json.get<jsonxx::Number>("displayListCache"));
+
     if (json.has<jsonxx::Number>("noJustification")) SetNoJustification(json.get<jsonxx::Number>("noJustification"));
 
     if (json.has<jsonxx::Number>("showBoundingBoxes"))
@@ -786,20 +838,192 @@ std::string Toolkit::RenderToSvg(int pageNo, bool xml_declaration)
     // Get the current system for the SVG clipping size
     m_view.SetPage(pageNo);
 
-    // Adjusting page width and height according to the options
-    int width = m_pageWidth;
-    if (m_noLayout) {
-        width = m_doc.GetAdjustedDrawingPageWidth();
+    return RenderCurrentPageToSvg(0, 0, GetCurrentPageWidth(), GetCurrentPageHeight(), xml_declaration);
+}
+
+std::string Toolkit::RenderRegionToSvg(int pageNo, int x, int y, int width, int height, bool xml_declaration)
+{
+    // Page number is one-based - correct it to 0-based first
+    pageNo--;
+
+    m_view.SetPage(pageNo);
+
+    // The region is given at the current scale
+    x = x * 100 / m_scale;
+    y = y * 100 / m_scale;
+    width = std::max(1, width * 100 / m_scale);
+    height = std::max(1, height * 100 / m_scale);
+
+    return RenderCurrentPageRegionToSvg(x, y, width, height, xml_declaration);
+}
+
+int Toolkit::GetTileCount(int pageNo)
+{
+    if (!m_doc.HasPage(pageNo - 1)) {
+        LogError("Page %d does not exist", pageNo);
+        return 0;
+    }
+
+    m_view.SetPage(pageNo - 1);
+
+    std::vector<int> boundaries;
+    CalcTileBoundaries(boundaries);
+    return (int)boundaries.size() - 1;
+}
+
+int Toolkit::GetTileOffset(int pageNo, int tileNo)
+{
+    if (tileNo < 1 || tileNo > GetTileCount(pageNo)) {
+        LogError("Tile %d does not exist", tileNo);
+        return 0;
+    }
+
+    std::vector<int> boundaries;
+    CalcTileBoundaries(boundaries);
+    return boundaries.at(tileNo - 1) * m_scale / 100;
+}
+
+std::string Toolkit::RenderTileToSvg(int pageNo, int tileNo, bool xml_declaration)
+{
+    // This also sets the page
+    if (tileNo < 1 || tileNo > GetTileCount(pageNo)) {
+        LogError("Tile %d does not exist", tileNo);
+        return "";
+    }
+
+    std::vector<int> boundaries;
+    CalcTileBoundaries(boundaries);
+    int x = boundaries.at(tileNo - 1);
+    return RenderCurrentPageRegionToSvg(x, 0, boundaries.at(tileNo) - x, GetCurrentPageHeight(), xml_declaration);
+}
+
+bool Toolkit::RenderTileToSvgFile(const std::string &filename, int pageNo, int tileNo)
+{
+    std::string output = RenderTileToSvg(pageNo, tileNo, true);
+    if (output.empty()) return false;
+
+    std::ofstream outfile;
+    outfile.open(filename.c_str());
+
+    if (!outfile.is_open()) {
+        return false;
+    }
+
+    outfile << output;
+    outfile.close();
+    return true;
+}
+
+int Toolkit::GetCurrentPageWidth()
+{
+    // Adjusting page width according to the options
+    if (m_noLayout) return m_doc.GetAdjustedDrawingPageWidth();
+    return m_pageWidth;
+}
+
+int Toolkit::GetCurrentPageHeight()
+{
+    // Adjusting page height according to the options
+    if (m_adjustPageHeight || m_noLayout) return m_doc.GetAdjustedDrawingPageHeight();
+    return m_pageHeight;
+}
+
+void Toolkit::SetDisplayListCache(bool cache)
+{
+    m_displayListCache = cache;
+    if (!m_displayListCache) ResetDisplayLists();
+}
+
+void Toolkit::DrawCurrentPage(DeviceContext *dc)
+{
+    Page *page = m_doc.GetDrawingPage();
+    // The bounding boxes are not kept in the copies of the objects made by the display list
+    if (!m_displayListCache || m_view.HasDrawingRegion() || m_showBoundingBoxes || !page) {
+        m_view.DrawCurrentPage(dc, false);
+        return;
+    }
+
+    if (!page->GetDisplayList()) {
+        DisplayListDeviceContext *displayList = new DisplayListDeviceContext();
+        m_view.DrawCurrentPage(displayList, false);
+        page->SetDisplayList(displayList);
+    }
+    page->GetDisplayList()->Replay(dc);
+}
+
+void Toolkit::ResetDisplayLists()
+{
+    ArrayOfObjects pages;
+    AttComparison matchType(PAGE);
+    m_doc.FindAllChildByAttComparison(&pages, &matchType, 1);
+    ArrayOfObjects::iterator iter;
+    for (iter = pages.begin(); iter != pages.end(); ++iter) {
+        Page *page = vrv_cast<Page *>(*iter);
+        assert(page);
+        page->ResetDisplayList();
+    }
+}
+
+void Toolkit::CalcTileBoundaries(std::vector<int> &boundaries)
+{
+    int width = GetCurrentPageWidth();
+    int tileWidth = m_tileWidth * 100 / m_scale;
+
+    boundaries.clear();
+    boundaries.push_back(0);
+
+    // The beginning of the measures of the first system
+    std::vector<int> measureX;
+    System *system = dynamic_cast<System *>(m_doc.GetDrawingPage()->FindChildByType(SYSTEM));
+    if ((tileWidth > 0) && m_tileMeasures && system && (system->m_xAbs == VRV_UNSET)) {
+        ArrayOfObjects measures;
+        AttComparison matchType(MEASURE);
+        system->FindAllChildByAttComparison(&measures, &matchType);
+        ArrayOfObjects::iterator iter;
+        for (iter = measures.begin(); iter != measures.end(); ++iter) {
+            Measure *measure = vrv_cast<Measure *>(*iter);
+            assert(measure);
+            int x = system->m_drawingXRel + measure->m_drawingXRel + m_doc.m_drawingPageLeftMar;
+            measureX.push_back(x / DEFINITION_FACTOR);
+        }
+        std::sort(measureX.begin(), measureX.end());
     }
 
-    int height = m_pageHeight;
-    if (m_adjustPageHeight || m_noLayout) {
-        height = m_doc.GetAdjustedDrawingPageHeight();
+    int x = 0;
+    while ((tileWidth > 0) && (x + tileWidth < width)) {
+        int next = x + tileWidth;
+        // Cut the tile at the last measure starting in it (but not at its beginning)
+        std::vector<int>::iterator iter = std::upper_bound(measureX.begin(), measureX.end(), next);
+        if ((iter != measureX.begin()) && (*(iter - 1) > x)) next = *(iter - 1);
+        boundaries.push_back(next);
+        x = next;
     }
+    boundaries.push_back(width);
+}
+
+std::string Toolkit::RenderCurrentPageRegionToSvg(int x, int y, int width, int height, bool xml_declaration)
+{
+    // The drawing region has no page margins
+    int x1 = x * DEFINITION_FACTOR - m_doc.m_drawingPageLeftMar;
+    int y1 = y * DEFINITION_FACTOR - m_doc.m_drawingPageTopMar;
+    m_view.SetDrawingRegion(x1, y1, x1 + width * DEFINITION_FACTOR, y1 + height * DEFINITION_FACTOR);
+
+    std::string out_str = RenderCurrentPageToSvg(x, y, width, height, xml_declaration);
+
+    m_view.ResetDrawingRegion();
+    return out_str;
+}
 
+std::string Toolkit::RenderCurrentPageToSvg(int x, int y, int width, int height, bool xml_declaration)
+{
     // Create the SVG object, h & w come from the system
     // We will need to set the size of the page after having drawn it depending on the options
     SvgDeviceContext svg(width, height);
+    svg.SetCompact(m_compact);
+    svg.SetGlyphSprite(m_glyphSpriteHref);
+
+    // The logical origin is negated by GetLogicalOrigin when the page margins are added in View::DrawCurrentPage
+    svg.SetLogicalOrigin(-x * DEFINITION_FACTOR, -y * DEFINITION_FACTOR);
 
     // set scale and border from user options
     svg.SetUserScale((double)m_scale / 100, (double)m_scale / 100);
@@ -808,12 +1032,62 @@ std::string Toolkit::RenderToSvg(int pageNo, bool xml_declaration)
     svg.SetDrawBoundingBoxes(m_showBoundingBoxes);
 
     // render the page
-    m_view.DrawCurrentPage(&svg, false);
+    DrawCurrentPage(&svg);
+
+    // keep the glyphs for the sprite
+    if (!m_glyphSpriteHref.empty()) {
+        std::vector<const Glyph *>::const_iterator it;
+        for (it = svg.GetGlyphs().begin(); it != svg.GetGlyphs().end(); ++it) {
+            if (m_spriteGlyphSet.insert(*it).second) m_spriteGlyphs.push_back(*it);
+        }
+    }
 
     std::string out_str = svg.GetStringSVG(xml_declaration);
     return out_str;
 }
 
+std::string Toolkit::GetGlyphSprite(bool xml_declaration)
+{
+    return SvgDeviceContext::GetStringGlyphSprite(m_spriteGlyphs, xml_declaration);
+}
+
+bool Toolkit::GetGlyphSpriteFile(const std::string &filename)
+{
+    std::ofstream outfile;
+    outfile.open(filename.c_str());
+
+    if (!outfile.is_open()) {
+        return false;
+    }
+
+    outfile << GetGlyphSprite(true);
+    outfile.close();
+    return true;
+}
+
+void Toolkit::RenderToSvgStream(std::ostream &output, int pageNo, bool xml_declaration)
+{
+    // Page number is one-based - correct it to 0-based first
+    pageNo--;
+
+    // Get the current system for the SVG clipping size
+    m_view.SetPage(pageNo);
+
+    // The SVG is written to the stream as the page is drawn
+    SvgStreamDeviceContext svg(&output, GetCurrentPageWidth(), GetCurrentPageHeight(), xml_declaration);
+
+    // set scale and border from user options
+    svg.SetUserScale((double)m_scale / 100, (double)m_scale / 100);
+
+    // debug BB?
+    svg.SetDrawBoundingBoxes(m_showBoundingBoxes);
+
+    // render the page
+    DrawCurrentPage(&svg);
+
+    svg.Commit();
+}
+
 bool Toolkit::RenderToSvgFile(const std::string &filename, int pageNo)
 {
     std::string output = RenderToSvg(pageNo, true);
@@ -1050,6 +1324,7 @@ bool Toolkit::Drag(std::string elementId, int x, int y)
             = (data_PITCHNAME)m_view.CalculatePitchCode(layer, m_view.ToLogicalY(y), note->GetDrawingX(), &oct);
         note->SetPname(pname);
         note->SetOct(oct);
+        ResetDisplayLists();
         return true;
     }
     return false;
@@ -1084,6 +1359,7 @@ bool Toolkit::Insert(std::string elementType, std::string startid, std::string e
         slur->SetEndid(endid);
         measure->AddChild(slur);
         m_doc.PrepareDrawing();
+        ResetDisplayLists();
         return true;
     }
     return false;
@@ -1093,14 +1369,13 @@ bool Toolkit::Set(std::string elementId, std::string attrType, std::string attrV
 {
     if (!m_doc.GetDrawingPage()) return false;
     Object *element = m_doc.GetDrawingPage()->FindChildByUuid(elementId);
-    if (Att::SetCmn(element, attrType, attrValue)) return true;
-    if (Att::SetCritapp(element, attrType, attrValue)) return true;
-    if (Att::SetExternalsymbols(element, attrType, attrValue)) return true;
-    if (Att::SetMei(element, attrType, attrValue)) return true;
-    if (Att::SetMensural(element, attrType, attrValue)) return true;
-    if (Att::SetMidi(element, attrType, attrValue)) return true;
-    if (Att::SetPagebased(element, attrType, attrValue)) return true;
-    if (Att::SetShared(element, attrType, attrValue)) return true;
+    if (Att::SetCmn(element, attrType, attrValue) || Att::SetCritapp(element, attrType, attrValue)
+        || Att::SetExternalsymbols(element, attrType, attrValue) || Att::SetMei(element, attrType, attrValue)
+        || Att::SetMensural(element, attrType, attrValue) || Att::SetMidi(element, attrType, attrValue)
+        || Att::SetPagebased(element, attrType, attrValue) || Att::SetShared(element, attrType, attrValue)) {
+        ResetDisplayLists();
+        return true;
+    }
     return false;
 }
 
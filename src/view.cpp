@@ -34,6 +34,12 @@ View::View()
     m_currentMeasure = NULL;
     m_currentStaff = NULL;
     m_currentSystem = NULL;
+
+    m_drawingLigX[0] = m_drawingLigX[1] = 0;
+    m_drawingLigY[0] = m_drawingLigY[1] = 0;
+    m_drawingLigObliqua = false;
+
+    ResetDrawingRegion();
 }
 
 View::~View()
@@ -27,9 +27,6 @@
 
 namespace vrv {
 
-int View::s_drawingLigX[2], View::s_drawingLigY[2]; // pour garder coord. des ligatures
-bool View::s_drawingLigObliqua = false; // marque le 1e passage pour une oblique
-
 //----------------------------------------------------------------------------
 // View - Mensural
 //----------------------------------------------------------------------------
@@ -603,7 +600,7 @@ void View::DrawLigatureNote(DeviceContext *dc, LayerElement *element, Layer *lay
     y3 = (int)(y1 + m_doc->GetDrawingUnit(staff->m_drawingStaffSize) / 2); // part of the frame that overflows
     y4 = (int)(y2 - m_doc->GetDrawingUnit(staff->m_drawingStaffSize) / 2);
 
-    // if (!note->m_ligObliqua && (!View::s_drawingLigObliqua))	// rectangular notes, incl. ligature
+    // if (!note->m_ligObliqua && (!m_drawingLigObliqua))	// rectangular notes, incl. ligature
     {
         if (note->GetColored() != BOOLEAN_true) { //	double the base of squares
             DrawObliquePolygon(dc, x1, y1, x2, y1, -epaisseur);
@@ -619,10 +616,10 @@ void View::DrawLigatureNote(DeviceContext *dc, LayerElement *element, Layer *lay
     /*
      else			// handle obliques
      {
-     if (!View::s_drawingLigObliqua)	// 1st pass: Initial flagStemHeighte
+     if (!m_drawingLigObliqua)	// 1st pass: Initial flagStemHeighte
      {
      DrawVerticalLine (dc,y3,y4,x1, m_doc->GetDrawingStemWidth(staff->m_drawingStaffSize));
-     View::s_drawingLigObliqua = true;
+     m_drawingLigObliqua = true;
      //oblique = false;
      //			if (val == DUR_1)	// left tail up if DUR_1
      //				queue_lig = true;
@@ -631,7 +628,7 @@ void View::DrawLigatureNote(DeviceContext *dc, LayerElement *element, Layer *lay
      {
      x1 -=  m_doc->m_drawingBrevisWidth[staff->m_drawingStaffSize] * 2;	// auto advance
 
-     y1 = *View::s_drawingLigY - m_doc->GetDrawingUnit(staff->m_drawingStaffSize);	// ligat_y contains original y
+     y1 = *m_drawingLigY - m_doc->GetDrawingUnit(staff->m_drawingStaffSize);	// ligat_y contains original y
      yy2 = y2;
      y5 = y1+ m_doc->GetDrawingDoubleUnit(staff->m_drawingStaffSize); y2 +=
      m_doc->GetDrawingDoubleUnit(staff->m_drawingStaffSize);            // go up a
@@ -646,7 +643,7 @@ void View::DrawLigatureNote(DeviceContext *dc, LayerElement *element, Layer *lay
      DrawVerticalLine (dc,y3,y4,x2,m_doc->GetDrawingStemWidth(staff->m_drawingStaffSize));	// enclosure
      flagStemHeighte
 
-     View::s_drawingLigObliqua = false;
+     m_drawingLigObliqua = false;
      //			queue_lig = false;	// ??defuses alg.queue DUR_BR??
 
      }
@@ -654,15 +651,15 @@ void View::DrawLigatureNote(DeviceContext *dc, LayerElement *element, Layer *lay
 
      if (note->m_lig)	// remember positions from one note to another; connect notes by bars
      {
-     *(View::s_drawingLigX+1) = x2; *(View::s_drawingLigY+1) = y;	// connect ligature beamed notes by bar
+     *(m_drawingLigX+1) = x2; *(m_drawingLigY+1) = y;	// connect ligature beamed notes by bar
      flagStemHeightes
-     //if (in(x1,(*View::s_drawingLigX)-2,(*View::s_drawingLigX)+2) || (this->fligat && this->lat && !Note1::marq_obl))
+     //if (in(x1,(*m_drawingLigX)-2,(*m_drawingLigX)+2) || (this->fligat && this->lat && !Note1::marq_obl))
      // the latest conditions to allow previous ligature flagStemHeighte
      //	DrawVerticalLine (dc, *ligat_y, y1, (this->fligat && this->lat) ? x2: x1, m_doc->m_parameters.m_stemWidth); //
      ax2 - drawing flagStemHeight
      lines missing
-     *View::s_drawingLigX = *(View::s_drawingLigX + 1);
-     *View::s_drawingLigY = *(View::s_drawingLigY + 1);
+     *m_drawingLigX = *(m_drawingLigX + 1);
+     *m_drawingLigY = *(m_drawingLigY + 1);
      }
 
 
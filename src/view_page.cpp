@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
 
 //----------------------------------------------------------------------------
@@ -49,17 +50,55 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
     assert(dc);
     assert(m_doc);
 
+    // The device context uses the fonts of the document
+    dc->SetResources(&m_doc->GetResources());
+
     m_currentPage = m_doc->SetDrawingPage(m_pageIdx);
 
     int i;
     Functor setDrawingXY(&Object::SetDrawingXY);
     SetDrawingXYParams setDrawingXYParams(m_doc, this, &setDrawingXY);
+
+    std::vector<System *> systems;
+    if (m_hasDrawingRegion) {
+        // Set the position of the systems only for selecting the ones intersecting the region
+        m_currentPage->Process(&setDrawingXY, &setDrawingXYParams, NULL, NULL, 1);
+        int systemCount = m_currentPage->GetSystemCount();
+        for (i = 0; i < systemCount; i++) {
+            System *system = vrv_cast<System *>(m_currentPage->GetChild(i));
+            assert(system);
+            // The content of a system can overflow up to the previous and the next system
+            int top = VRV_UNSET;
+            if (i > 0) {
+                System *previous = vrv_cast<System *>(m_currentPage->GetChild(i - 1));
+                top = previous->GetDrawingY() - previous->GetHeight();
+            }
+            int bottom = system->GetDrawingY() - system->GetHeight();
+            if (i < systemCount - 1) {
+                System *next = vrv_cast<System *>(m_currentPage->GetChild(i + 1));
+                bottom = next->GetDrawingY();
+            }
+            if (IsInDrawingRegion(top, bottom)) systems.push_back(system);
+        }
+    }
+    else {
+        for (i = 0; i < m_currentPage->GetSystemCount(); i++) {
+            // cast to System check in DrawSystem
+            systems.push_back(dynamic_cast<System *>(m_currentPage->GetChild(i)));
+        }
+    }
+
+    std::vector<System *>::iterator iter;
     // First pass without processing the LayerElements - we need this for cross-staff going down because
     // the elements will need the position of the staff below to have been set before
-    m_currentPage->Process(&setDrawingXY, &setDrawingXYParams);
+    for (iter = systems.begin(); iter != systems.end(); ++iter) {
+        if (*iter) (*iter)->Process(&setDrawingXY, &setDrawingXYParams);
+    }
     // Second pass that process the LayerElements (only)
     setDrawingXYParams.m_processLayerElements = true;
-    m_currentPage->Process(&setDrawingXY, &setDrawingXYParams);
+    for (iter = systems.begin(); iter != systems.end(); ++iter) {
+        if (*iter) (*iter)->Process(&setDrawingXY, &setDrawingXYParams);
+    }
 
     // Keep the width of the initial scoreDef
     SetScoreDefDrawingWidth(dc, &m_currentPage->m_drawingScoreDef);
@@ -77,15 +116,50 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
 
     dc->StartPage();
 
-    for (i = 0; i < m_currentPage->GetSystemCount(); i++) {
-        // cast to System check in DrawSystem
-        System *system = dynamic_cast<System *>(m_currentPage->GetChild(i));
-        DrawSystem(dc, system);
+    for (iter = systems.begin(); iter != systems.end(); ++iter) {
+        DrawSystem(dc, *iter);
     }
 
     dc->EndPage();
 }
 
+void View::SetDrawingRegion(int x1, int y1, int x2, int y2)
+{
+    m_hasDrawingRegion = true;
+    m_drawingRegionX1 = std::min(x1, x2);
+    m_drawingRegionY1 = std::min(y1, y2);
+    m_drawingRegionX2 = std::max(x1, x2);
+    m_drawingRegionY2 = std::max(y1, y2);
+}
+
+void View::ResetDrawingRegion()
+{
+    m_hasDrawingRegion = false;
+    m_drawingRegionX1 = m_drawingRegionY1 = m_drawingRegionX2 = m_drawingRegionY2 = 0;
+}
+
+bool View::IsInDrawingRegion(int top, int bottom)
+{
+    if (!m_hasDrawingRegion) return true;
+
+    if ((top != VRV_UNSET) && (ToDeviceContextY(top) > m_drawingRegionY2)) return false;
+    if ((bottom != VRV_UNSET) && (ToDeviceContextY(bottom) < m_drawingRegionY1)) return false;
+    return true;
+}
+
+bool View::IsInDrawingRegion(Measure *measure)
+{
+    assert(measure);
+
+    if (!m_hasDrawingRegion) return true;
+
+    // The measures close to the region are drawn too because their content can overflow into it
+    int margin = 2 * m_doc->GetDrawingStaffSize(100);
+    int left = ToDeviceContextX(measure->GetDrawingX()) - margin;
+    int right = ToDeviceContextX(measure->GetDrawingX() + measure->GetWidth()) + margin;
+    return ((right >= m_drawingRegionX1) && (left <= m_drawingRegionX2));
+}
+
 void View::SetScoreDefDrawingWidth(DeviceContext *dc, ScoreDef *scoreDef)
 {
     assert(dc);
@@ -142,7 +216,7 @@ void View::DrawSystem(DeviceContext *dc, System *system)
 
     // First get the first measure of the system
     Measure *measure = dynamic_cast<Measure *>(system->FindChildByType(MEASURE));
-    if (measure) {
+    if (measure && IsInDrawingRegion(measure)) {
         // NULL for the BarLine parameters indicates that we are drawing the scoreDef
         DrawScoreDef(dc, system->GetDrawingScoreDef(), measure, system->GetDrawingX(), NULL);
         // Draw mesure number if > 1
@@ -837,11 +911,15 @@ void View::DrawStaffLines(DeviceContext *dc, Staff *staff, Measure *measure, Sys
     // AxSOLID);
     dc->SetBrush(m_currentColour, AxSOLID);
 
+    // The lines are drawn at once so the device context can merge them
+    std::vector<Point> points(2 * staff->m_drawingLines);
     for (j = 0; j < staff->m_drawingLines; j++) {
-        dc->DrawLine(ToDeviceContextX(x1), ToDeviceContextY(yy), ToDeviceContextX(x2), ToDeviceContextY(yy));
+        points[2 * j] = Point(ToDeviceContextX(x1), ToDeviceContextY(yy));
+        points[2 * j + 1] = Point(ToDeviceContextX(x2), ToDeviceContextY(yy));
         // For drawing rectangles instead of lines
         yy -= m_doc->GetDrawingDoubleUnit(staff->m_drawingStaffSize);
     }
+    if (!points.empty()) dc->DrawLines(staff->m_drawingLines, &points[0]);
 
     staff->m_drawingHeight = staff->GetDrawingY() - yy;
 
@@ -1024,7 +1102,9 @@ void View::DrawSystemChildren(DeviceContext *dc, Object *parent, System *system)
     for (current = parent->GetFirst(); current; current = parent->GetNext()) {
         if (current->Is() == MEASURE) {
             // cast to Measure check in DrawMeasure
-            DrawMeasure(dc, dynamic_cast<Measure *>(current), system);
+            Measure *measure = dynamic_cast<Measure *>(current);
+            if (measure && !IsInDrawingRegion(measure)) continue;
+            DrawMeasure(dc, measure, system);
         }
         // scoreDef are not drawn directly, but anything else should not be possible
         else if (current->Is() == SCOREDEF) {
@@ -34,6 +34,7 @@
 #define GIT_COMMIT "[undefined]"
 #endif
 
+#include "builtinfont.h"
 #include "glyph.h"
 #include "smufl.h"
 #include "vrvdef.h"
@@ -56,28 +57,31 @@ namespace vrv {
 // Static members with some default values
 //----------------------------------------------------------------------------
 
-std::string Resources::m_path = "/usr/local/share/verovio";
-std::map<wchar_t, Glyph> Resources::m_font;
-std::map<wchar_t, Glyph> Resources::m_textFont;
+std::mutex Resources::s_fontsMutex;
+std::map<std::string, GlyphTable> Resources::s_fonts;
+std::map<std::string, GlyphTable> Resources::s_textFonts;
+std::set<std::string> Resources::s_missingFonts;
 
 //----------------------------------------------------------------------------
 // Font related methods
 //----------------------------------------------------------------------------
 
+Resources::Resources()
+{
+    // Use the fonts compiled into Verovio by default
+    m_path = "";
+    m_font = NULL;
+    m_textFont = NULL;
+}
+
 bool Resources::InitFonts()
 {
-    // We will need to rethink this for adding the option to add custom fonts
-    // Font Bravura first since it is expected to have always all symbols
-    if (!LoadFont("Bravura")) LogError("Bravura font could not be loaded.");
     // The Leipzig as the default font
-    if (!LoadFont("Leipzig")) LogError("Leipzig font could not be loaded.");
+    m_font = GetSharedFont(m_path, "Leipzig");
+    if (!m_font) return false;
 
-    if (m_font.size() < SMUFL_COUNT) {
-        LogError("Expected %d default SMUFL glyphs but could load only %d.", SMUFL_COUNT, m_font.size());
-        return false;
-    }
-
-    if (!InitTextFont()) {
+    m_textFont = GetSharedTextFont(m_path);
+    if (!m_textFont) {
         LogError("Text font could not be initialized.");
         return false;
     }
@@ -85,28 +89,105 @@ bool Resources::InitFonts()
     return true;
 }
 
-bool Resources::SetFont(std::string fontName)
+bool Resources::SetFont(const std::string &fontName)
 {
-    return LoadFont(fontName);
+    const GlyphTable *font = GetSharedFont(m_path, fontName);
+    if (!font) return false;
+    m_font = font;
+    return true;
 }
 
-Glyph *Resources::GetGlyph(wchar_t smuflCode)
+const Glyph *Resources::GetGlyph(wchar_t smuflCode) const
 {
-    if (!m_font.count(smuflCode)) return NULL;
-    return &m_font[smuflCode];
+    if (!m_font) return NULL;
+    return m_font->GetGlyph(smuflCode);
+}
+
+const Glyph *Resources::GetTextGlyph(wchar_t code) const
+{
+    if (!m_textFont) return NULL;
+    return m_textFont->GetGlyph(code);
+}
+
+const GlyphTable *Resources::GetSharedFont(const std::string &path, const std::string &fontName)
+{
+    std::lock_guard<std::mutex> lock(s_fontsMutex);
+
+    std::map<std::string, GlyphTable>::iterator iter = s_fonts.find(path + "/" + fontName);
+    if (iter != s_fonts.end()) return &iter->second;
+    // Do not look again for a font (or the default font) that could not be loaded
+    if (s_missingFonts.count(path + "/" + fontName) || s_missingFonts.count(path + "/Leipzig")) return NULL;
+
+    // The default font is loaded first and every other font is overlaid on top of it
+    GlyphTable font;
+    std::map<std::string, GlyphTable>::iterator defaultIter = s_fonts.find(path + "/Leipzig");
+    if (defaultIter == s_fonts.end()) {
+        // We will need to rethink this for adding the option to add custom fonts
+        // Font Bravura first since it is expected to have always all symbols
+        // The Leipzig as the default font - both are compiled into Verovio and used when no path is set
+        if (path.empty()) {
+            if (!LoadBuiltInFont("Bravura", &font)) LogError("Bravura font could not be loaded.");
+            if (!LoadBuiltInFont("Leipzig", &font)) LogError("Leipzig font could not be loaded.");
+        }
+        else {
+            if (!LoadFont(path, "Bravura", &font)) LogError("Bravura font could not be loaded.");
+            if (!LoadFont(path, "Leipzig", &font)) LogError("Leipzig font could not be loaded.");
+        }
+
+        if (font.GetCount() < SMUFL_COUNT) {
+            LogError("Expected %d default SMUFL glyphs but could load only %d.", SMUFL_COUNT, font.GetCount());
+            s_missingFonts.insert(path + "/Leipzig");
+            return NULL;
+        }
+        defaultIter = s_fonts.insert(std::make_pair(path + "/Leipzig", font)).first;
+        if (fontName == "Leipzig") return &defaultIter->second;
+    }
+    else {
+        font = defaultIter->second;
+    }
+
+    bool loaded = false;
+    if (path.empty()) {
+        loaded = (LoadBuiltInFont(fontName, &font) || LoadFont(GetDefaultPath(), fontName, &font));
+    }
+    else {
+        loaded = LoadFont(path, fontName, &font);
+    }
+    if (!loaded) {
+        s_missingFonts.insert(path + "/" + fontName);
+        return NULL;
+    }
+    iter = s_fonts.insert(std::make_pair(path + "/" + fontName, font)).first;
+    return &iter->second;
 }
 
-Glyph *Resources::GetTextGlyph(wchar_t code)
+const GlyphTable *Resources::GetSharedTextFont(const std::string &path)
 {
-    if (!m_textFont.count(code)) return NULL;
-    return &m_textFont[code];
+    std::lock_guard<std::mutex> lock(s_fontsMutex);
+
+    std::map<std::string, GlyphTable>::iterator iter = s_textFonts.find(path);
+    if (iter != s_textFonts.end()) return &iter->second;
+
+    GlyphTable textFont;
+    if (path.empty()) {
+        const BuiltInFont *builtInFont = GetBuiltInTextFont();
+        for (int i = 0; i < builtInFont->m_count; ++i) {
+            const BuiltInGlyph *builtInGlyph = &builtInFont->m_glyphs[i];
+            textFont.SetGlyph(builtInGlyph->m_code, Glyph(builtInGlyph));
+        }
+    }
+    else if (!LoadTextFont(path, &textFont)) {
+        return NULL;
+    }
+    iter = s_textFonts.insert(std::make_pair(path, textFont)).first;
+    return &iter->second;
 }
 
-bool Resources::LoadFont(std::string fontName)
+bool Resources::LoadFont(const std::string &path, const std::string &fontName, GlyphTable *font)
 {
     ::DIR *dir;
     dirent *pdir;
-    std::string dirname = Resources::GetPath() + "/" + fontName;
+    std::string dirname = path + "/" + fontName;
     dir = opendir(dirname.c_str());
 
     if (!dir) {
@@ -116,7 +197,7 @@ bool Resources::LoadFont(std::string fontName)
 
     // First loop through the fontName directory and load each glyph
     // Since the filename starts with the Unicode code, it is used
-    // to assign the glyph to the corresponding position in m_fonts
+    // to assign the glyph to the corresponding position in the font
     while ((pdir = readdir(dir))) {
         if (strstr(pdir->d_name, ".xml")) {
             // E.g, : E053-gClef8va.xml => strtol extracts E053 as hex
@@ -127,8 +208,8 @@ bool Resources::LoadFont(std::string fontName)
             }
             std::string codeStr = pdir->d_name;
             codeStr = codeStr.substr(0, 4);
-            Glyph glyph(Resources::GetPath() + "/" + fontName + "/" + pdir->d_name, codeStr);
-            m_font[smuflCode] = glyph;
+            Glyph glyph(path + "/" + fontName + "/" + pdir->d_name, codeStr);
+            font->SetGlyph(smuflCode, glyph);
         }
     }
 
@@ -136,7 +217,7 @@ bool Resources::LoadFont(std::string fontName)
 
     // Then load the bounding boxes (if bounding box file is provided)
     pugi::xml_document doc;
-    std::string filename = Resources::GetPath() + "/" + fontName + ".xml";
+    std::string filename = path + "/" + fontName + ".xml";
     pugi::xml_parse_result result = doc.load_file(filename.c_str());
     if (!result) {
         // File not found, default bounding boxes will be used
@@ -153,11 +234,11 @@ bool Resources::LoadFont(std::string fontName)
     for (current = root.child("g"); current; current = current.next_sibling("g")) {
         if (current.attribute("c")) {
             wchar_t smuflCode = (wchar_t)strtol(current.attribute("c").value(), NULL, 16);
-            if (!m_font.count(smuflCode)) {
+            Glyph *glyph = font->GetGlyphForModification(smuflCode);
+            if (!glyph) {
                 LogWarning("Glyph with code '%d' not found.", smuflCode);
                 continue;
             }
-            Glyph *glyph = &m_font[smuflCode];
             if (glyph->GetUnitsPerEm() != unitsPerEm * 10) {
                 LogWarning("Glyph and bounding box units-per-em for code '%d' miss-match (bounding box: %d)", smuflCode,
                     unitsPerEm);
@@ -177,13 +258,26 @@ bool Resources::LoadFont(std::string fontName)
     return true;
 }
 
-bool Resources::InitTextFont()
+bool Resources::LoadBuiltInFont(const std::string &fontName, GlyphTable *font)
+{
+    const BuiltInFont *builtInFont = GetBuiltInFont(fontName);
+    if (!builtInFont) return false;
+
+    // As with LoadFont, the glyphs replace the ones already in the font
+    for (int i = 0; i < builtInFont->m_count; ++i) {
+        const BuiltInGlyph *builtInGlyph = &builtInFont->m_glyphs[i];
+        font->SetGlyph(builtInGlyph->m_code, Glyph(builtInGlyph));
+    }
+    return true;
+}
+
+bool Resources::LoadTextFont(const std::string &path, GlyphTable *textFont)
 {
     // For the text font, we load the bounding boxes only
     pugi::xml_document doc;
     // For now, we have only Times bounding boxes for ASCII chars
     // For any other char, we currently use 'o' bounding box
-    std::string filename = Resources::GetPath() + "/text/Times.xml";
+    std::string filename = path + "/text/Times.xml";
     pugi::xml_parse_result result = doc.load_file(filename.c_str());
     if (!result) {
         // File not found, default bounding boxes will be used
@@ -211,7 +305,7 @@ bool Resources::InitTextFont()
             if (current.attribute("h")) height = atof(current.attribute("h").value());
             glyph.SetBoundingBox(x, y, width, height);
             if (current.attribute("h-a-x")) glyph.SetHorizAdvX(atof(current.attribute("h-a-x").value()));
-            m_textFont[code] = glyph;
+            textFont->SetGlyph(code, glyph);
         }
     }
     return true;
@@ -221,13 +315,13 @@ bool Resources::InitTextFont()
 // Logging related methods
 //----------------------------------------------------------------------------
 
-/** Global for LogElapsedTimeXXX functions (debugging purposes) */
-struct timeval start;
+/** Global for LogElapsedTimeXXX functions (debugging purposes), one per thread */
+thread_local struct timeval start;
 /** For disabling log */
 bool noLog = false;
 
 #ifdef EMSCRIPTEN
-std::vector<std::string> logBuffer;
+thread_local std::vector<std::string> logBuffer;
 #endif
 
 void LogElapsedTimeStart()
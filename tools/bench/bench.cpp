@@ -0,0 +1,73 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        bench.cpp
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "bench.h"
+
+//----------------------------------------------------------------------------
+
+#include <atomic>
+#include <new>
+#include <stdlib.h>
+
+//----------------------------------------------------------------------------
+// Heap accounting - each block is prefixed with its size
+//----------------------------------------------------------------------------
+
+static std::atomic<size_t> s_inUse(0);
+static std::atomic<size_t> s_peak(0);
+
+// keep the alignment of the block returned by malloc
+static const size_t s_header = 16;
+
+void *operator new(size_t size)
+{
+    char *block = (char *)malloc(size + s_header);
+    if (!block) throw std::bad_alloc();
+    *(size_t *)block = size;
+    size_t inUse = (s_inUse += size);
+    size_t peak = s_peak.load();
+    while ((inUse > peak) && !s_peak.compare_exchange_weak(peak, inUse)) {
+    }
+    return block + s_header;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    if (!ptr) return;
+    char *block = (char *)ptr - s_header;
+    s_inUse -= *(size_t *)block;
+    free(block);
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    operator delete(ptr);
+}
+
+namespace vrv {
+
+size_t GetMemoryInUse()
+{
+    return s_inUse.load();
+}
+
+size_t GetPeakMemory()
+{
+    return s_peak.load();
+}
+
+void ResetPeakMemory()
+{
+    s_peak.store(s_inUse.load());
+}
+
+} // namespace vrv
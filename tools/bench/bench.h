@@ -0,0 +1,48 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        bench.h
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_BENCH_H__
+#define __VRV_BENCH_H__
+
+#include <chrono>
+#include <stddef.h>
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// Benchmark helpers
+//----------------------------------------------------------------------------
+
+/**
+ * @name The heap allocations made through operator new, counted by bench.cpp.
+ * ResetPeakMemory sets the peak to the current number of bytes in use.
+ */
+///@{
+size_t GetMemoryInUse();
+size_t GetPeakMemory();
+void ResetPeakMemory();
+///@}
+
+/**
+ * A simple stopwatch returning the elapsed time in milliseconds.
+ */
+class BenchTimer {
+public:
+    BenchTimer() { Reset(); }
+    void Reset() { m_start = std::chrono::steady_clock::now(); }
+    double GetMs() const
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace vrv
+
+#endif // __VRV_BENCH_H__
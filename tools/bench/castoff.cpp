@@ -0,0 +1,98 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        castoff.cpp
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+#include "toolkit.h"
+
+using namespace vrv;
+
+//----------------------------------------------------------------------------
+// Measure how the loading (with the cast-off of the systems and the pages) and the lookup of the page of the last
+// measure scale with the number of measures of a single staff score
+//
+// Usage: bench-castoff resource-path [measures ...]
+// For example: bench-castoff data 1000 5000 20000
+//----------------------------------------------------------------------------
+
+/**
+ * Return an MEI file with one staff and the number of measures of four quarter notes
+ */
+static std::string GenerateScore(int measures)
+{
+    static const char *pnames[] = { "c", "d", "e", "f", "g", "a", "b" };
+
+    std::stringstream mei;
+    mei << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        << "<mei xmlns=\"http://www.music-encoding.org/ns/mei\" meiversion=\"3.0.0\"><meiHead><fileDesc><titleStmt>"
+        << "<title/></titleStmt><pubStmt/></fileDesc></meiHead><music><body><mdiv><score>\n"
+        << "<scoreDef meter.count=\"4\" meter.unit=\"4\"><staffGrp>"
+        << "<staffDef n=\"1\" lines=\"5\" clef.shape=\"G\" clef.line=\"2\"/></staffGrp></scoreDef><section>\n";
+    for (int m = 1; m <= measures; ++m) {
+        mei << "<measure n=\"" << m << "\" xml:id=\"m" << m << "\"><staff n=\"1\"><layer n=\"1\">";
+        for (int i = 0; i < 4; ++i) {
+            mei << "<note dur=\"4\" pname=\"" << pnames[(m + i) % 7] << "\" oct=\"4\"/>";
+        }
+        mei << "</layer></staff></measure>\n";
+    }
+    mei << "</section></score></mdiv></body></music></mei>\n";
+    return mei.str();
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        std::cerr << "Usage: bench-castoff resource-path [measures ...]" << std::endl;
+        return 1;
+    }
+
+    std::vector<int> sizes;
+    for (int i = 2; i < argc; ++i) {
+        if (atoi(argv[i]) > 0) sizes.push_back(atoi(argv[i]));
+    }
+    if (sizes.empty()) {
+        sizes.push_back(1000);
+        sizes.push_back(5000);
+        sizes.push_back(20000);
+    }
+
+    printf("%9s %7s %12s %16s %14s\n", "measures", "pages", "LoadData ms", "ms/1k measures", "last page ms");
+    for (std::vector<int>::iterator iter = sizes.begin(); iter != sizes.end(); ++iter) {
+        std::string data = GenerateScore(*iter);
+
+        Toolkit toolkit(false);
+        toolkit.SetResourcePath(argv[1]);
+        toolkit.SetXmlIdSeed(1);
+
+        BenchTimer timer;
+        if (!toolkit.LoadData(data)) return 1;
+        double loadMs = timer.GetMs();
+
+        std::stringstream lastId;
+        lastId << "m" << *iter;
+        timer.Reset();
+        int page = toolkit.GetPageWithElement(lastId.str());
+        double lookupMs = timer.GetMs();
+        if (page != toolkit.GetPageCount()) {
+            std::cerr << "The last measure is not on the last page" << std::endl;
+            return 1;
+        }
+
+        printf("%9d %7d %12.1f %16.1f %14.3f\n", *iter, toolkit.GetPageCount(), loadMs, loadMs * 1000.0 / *iter,
+            lookupMs);
+    }
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        displaylist.cpp
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <sstream>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+#include "pugixml.hpp"
+#include "toolkit.h"
+
+using namespace vrv;
+
+//----------------------------------------------------------------------------
+// Compare the rendering time of the pages drawn by the View with the one of the pages replayed from their display
+// list, at the scale of the recording and at another one, and check that the output is the same
+//
+// Usage: bench-displaylist resource-path file [file ...]
+//----------------------------------------------------------------------------
+
+/**
+ * Return the SVG without the ids, since the ones of the drawing copies of the staffDefs change with every rendering
+ */
+static std::string RemoveIds(const std::string &svg)
+{
+    pugi::xml_document doc;
+    if (!doc.load_string(svg.c_str())) return "";
+    pugi::xpath_node_set nodes = doc.select_nodes("//*[@id]");
+    for (pugi::xpath_node_set::const_iterator it = nodes.begin(); it != nodes.end(); ++it) {
+        pugi::xml_node node = it->node();
+        node.remove_attribute("id");
+    }
+    std::ostringstream output;
+    doc.save(output);
+    return output.str();
+}
+
+/**
+ * Render all the pages, adding the time to ms and the SVG to pages
+ */
+static void RenderAll(Toolkit &toolkit, double &ms, std::vector<std::string> &pages)
+{
+    pages.clear();
+    BenchTimer timer;
+    for (int page = 1; page <= toolkit.GetPageCount(); ++page) {
+        pages.push_back(toolkit.RenderToSvg(page));
+    }
+    ms += timer.GetMs();
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3) {
+        std::cerr << "Usage: bench-displaylist resource-path file [file ...]" << std::endl;
+        return 1;
+    }
+
+    double viewMs = 0.0, recordMs = 0.0, replayMs = 0.0, scaledViewMs = 0.0, scaledReplayMs = 0.0;
+    size_t svgBytes = 0, listBytes = 0;
+    int pages = 0;
+    bool same = true;
+
+    for (int i = 2; i < argc; ++i) {
+        Toolkit toolkit(false);
+        toolkit.SetResourcePath(argv[1]);
+        toolkit.SetXmlIdSeed(1);
+        if (!toolkit.LoadFile(argv[i])) continue;
+
+        std::vector<std::string> viewPages, replayPages;
+        // a first rendering for laying out the pages and loading the glyphs
+        double firstMs = 0.0;
+        RenderAll(toolkit, firstMs, viewPages);
+        RenderAll(toolkit, viewMs, viewPages);
+
+        size_t memory = GetMemoryInUse();
+        toolkit.SetDisplayListCache(true);
+        RenderAll(toolkit, recordMs, replayPages);
+        listBytes += GetMemoryInUse() - memory;
+        RenderAll(toolkit, replayMs, replayPages);
+
+        for (int page = 0; page < (int)viewPages.size(); ++page) {
+            svgBytes += viewPages.at(page).size();
+            if (RemoveIds(viewPages.at(page)) != RemoveIds(replayPages.at(page))) {
+                std::cerr << argv[i] << ": page " << page + 1 << " differs when replayed" << std::endl;
+                same = false;
+            }
+        }
+
+        // another scale does not change the drawing
+        toolkit.SetScale(60);
+        RenderAll(toolkit, scaledReplayMs, replayPages);
+        toolkit.SetDisplayListCache(false);
+        RenderAll(toolkit, scaledViewMs, viewPages);
+        for (int page = 0; page < (int)viewPages.size(); ++page) {
+            if (RemoveIds(viewPages.at(page)) != RemoveIds(replayPages.at(page))) {
+                std::cerr << argv[i] << ": page " << page + 1 << " differs when replayed at scale 60" << std::endl;
+                same = false;
+            }
+        }
+
+        pages += toolkit.GetPageCount();
+    }
+
+    if (!pages) return 1;
+
+    printf("%d pages\n", pages);
+    printf("View:                %.2f ms/page (%.2f ms/page at scale 60)\n", viewMs / pages, scaledViewMs / pages);
+    printf("Display list record: %.2f ms/page\n", recordMs / pages);
+    printf("Display list replay: %.2f ms/page (%.2f ms/page at scale 60)\n", replayMs / pages, scaledReplayMs / pages);
+    printf("Display lists: %zu bytes/page, SVG %zu bytes/page\n", listBytes / pages, svgBytes / pages);
+    printf("Output %s\n", same ? "the same" : "NOT the same");
+
+    return same ? 0 : 1;
+}
@@ -0,0 +1,77 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        glyphsprite.cpp
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <stdio.h>
+#include <string>
+
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+#include "toolkit.h"
+
+using namespace vrv;
+
+//----------------------------------------------------------------------------
+// Compare the total size and the rendering time of all the pages with the glyphs in each page and with an external
+// glyph sprite
+//
+// Usage: bench-glyphsprite resource-path file [file ...]
+//----------------------------------------------------------------------------
+
+/**
+ * Render all the pages (and the sprite if used) and return the total size, adding the time to ms
+ */
+static size_t RenderAll(Toolkit &toolkit, double &ms)
+{
+    size_t bytes = 0;
+    BenchTimer timer;
+    for (int page = 1; page <= toolkit.GetPageCount(); ++page) {
+        bytes += toolkit.RenderToSvg(page).size();
+    }
+    if (!toolkit.GetGlyphSpriteHref().empty()) bytes += toolkit.GetGlyphSprite().size();
+    ms += timer.GetMs();
+    return bytes;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3) {
+        std::cerr << "Usage: bench-glyphsprite resource-path file [file ...]" << std::endl;
+        return 1;
+    }
+
+    size_t defaultBytes = 0, spriteBytes = 0;
+    double defaultMs = 0.0, spriteMs = 0.0;
+    int pages = 0;
+
+    for (int i = 2; i < argc; ++i) {
+        Toolkit toolkit(false);
+        toolkit.SetResourcePath(argv[1]);
+        toolkit.SetXmlIdSeed(1);
+        if (!toolkit.LoadFile(argv[i])) continue;
+
+        // a first rendering for laying out the pages and loading the glyphs
+        for (int page = 1; page <= toolkit.GetPageCount(); ++page) toolkit.RenderToSvg(page);
+
+        toolkit.SetGlyphSpriteHref("");
+        defaultBytes += RenderAll(toolkit, defaultMs);
+        toolkit.SetGlyphSpriteHref("sprite.svg");
+        spriteBytes += RenderAll(toolkit, spriteMs);
+
+        pages += toolkit.GetPageCount();
+    }
+
+    if (!pages) return 1;
+
+    printf("%d pages\n", pages);
+    printf("glyphs in pages: %zu bytes, %.2f ms/page\n", defaultBytes, defaultMs / pages);
+    printf("glyph sprite:    %zu bytes (%.1f%%), %.2f ms/page\n", spriteBytes, 100.0 * spriteBytes / defaultBytes,
+        spriteMs / pages);
+
+    return 0;
+}
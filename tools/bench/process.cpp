@@ -0,0 +1,79 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        process.cpp
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <assert.h>
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+
+//----------------------------------------------------------------------------
+
+#include "attcomparison.h"
+#include "bench.h"
+#include "doc.h"
+#include "functorparams.h"
+#include "iomei.h"
+
+using namespace vrv;
+
+//----------------------------------------------------------------------------
+// Measure the time of Object::Process over the tree of a document with a functor doing nothing, forward, backward
+// and with a filter on the staves
+//
+// Usage: bench-process file [passes]
+//----------------------------------------------------------------------------
+
+static const int s_rounds = 10;
+
+/**
+ * Process the children of the document and return the best time of the rounds in ms
+ */
+static double ProcessAll(Doc &doc, int passes, bool direction, ArrayOfAttComparisons *filters)
+{
+    // Object::PrepareLyricsEnd does nothing but for the Doc
+    Functor noop(&Object::PrepareLyricsEnd);
+    FunctorParams params;
+
+    double best = 0.0;
+    for (int round = 0; round < s_rounds; ++round) {
+        BenchTimer timer;
+        for (int pass = 0; pass < passes; ++pass) {
+            for (int i = 0; i < doc.GetChildCount(); ++i) {
+                doc.GetChild(i)->Process(&noop, &params, NULL, filters, UNLIMITED_DEPTH, direction);
+            }
+        }
+        double ms = timer.GetMs();
+        if ((round == 0) || (ms < best)) best = ms;
+    }
+    return best;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        std::cerr << "Usage: bench-process file [passes]" << std::endl;
+        return 1;
+    }
+
+    int passes = (argc > 2) ? atoi(argv[2]) : 100;
+    if (passes < 1) passes = 1;
+
+    Doc doc;
+    MeiInput input(&doc, argv[1]);
+    if (!input.ImportFile()) return 1;
+
+    ArrayOfAttComparisons filters;
+    AttCommonNComparison matchStaff(STAFF, 1);
+    filters.push_back(&matchStaff);
+
+    printf("%s, best of %d rounds of %d passes\n", argv[1], s_rounds, passes);
+    printf("forward:  %.3f ms/pass\n", ProcessAll(doc, passes, FORWARD, NULL) / passes);
+    printf("backward: %.3f ms/pass\n", ProcessAll(doc, passes, BACKWARD, NULL) / passes);
+    printf("filtered: %.3f ms/pass\n", ProcessAll(doc, passes, FORWARD, &filters) / passes);
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        region.cpp
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+#include "pugixml.hpp"
+#include "toolkit.h"
+
+using namespace vrv;
+
+//----------------------------------------------------------------------------
+// Compare the rendering time of the full pages with the one of a viewport moved over them
+//
+// Usage: bench-region resource-path file [viewport-width viewport-height] [--no-layout]
+// For example: bench-region data score.mei 1200 600 --no-layout
+//----------------------------------------------------------------------------
+
+static const int s_steps = 8;
+
+/**
+ * Return the value in pixels of a "123px" attribute of the root of the SVG
+ */
+static int GetSvgSize(const std::string &svg, const char *name)
+{
+    pugi::xml_document doc;
+    if (!doc.load_string(svg.c_str())) return 0;
+    return atoi(doc.first_child().attribute(name).value());
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3) {
+        std::cerr << "Usage: bench-region resource-path file [viewport-width viewport-height] [--no-layout]"
+                  << std::endl;
+        return 1;
+    }
+
+    int viewportWidth = 1200;
+    int viewportHeight = 600;
+    bool noLayout = false;
+    for (int i = 3; i < argc; ++i) {
+        if (std::string(argv[i]) == "--no-layout") {
+            noLayout = true;
+        }
+        else if (i + 1 < argc) {
+            viewportWidth = atoi(argv[i]);
+            viewportHeight = atoi(argv[++i]);
+        }
+    }
+
+    Toolkit toolkit(false);
+    toolkit.SetResourcePath(argv[1]);
+    toolkit.SetXmlIdSeed(1);
+    toolkit.SetNoLayout(noLayout);
+    if (!toolkit.LoadFile(argv[2])) return 1;
+
+    int pageCount = toolkit.GetPageCount();
+    double pageMs = 0.0, regionMs = 0.0;
+    size_t pageBytes = 0, regionBytes = 0;
+    int regions = 0;
+    bool valid = true;
+
+    for (int page = 1; page <= pageCount; ++page) {
+        // a first rendering for laying out the page and loading the glyphs
+        std::string svg = toolkit.RenderToSvg(page);
+        int width = GetSvgSize(svg, "width");
+        int height = GetSvgSize(svg, "height");
+
+        BenchTimer timer;
+        pageBytes += toolkit.RenderToSvg(page).size();
+        pageMs += timer.GetMs();
+
+        // move the viewport diagonally over the page
+        for (int step = 0; step < s_steps; ++step) {
+            int x = std::max(0, width - viewportWidth) * step / (s_steps - 1);
+            int y = std::max(0, height - viewportHeight) * step / (s_steps - 1);
+            timer.Reset();
+            svg = toolkit.RenderRegionToSvg(page, x, y, viewportWidth, viewportHeight);
+            regionMs += timer.GetMs();
+            regionBytes += svg.size();
+            pugi::xml_document doc;
+            if (!doc.load_string(svg.c_str())) valid = false;
+            regions++;
+        }
+    }
+
+    printf("%d pages, %d regions of %dx%d px\n", pageCount, regions, viewportWidth, viewportHeight);
+    printf("RenderToSvg:       %.2f ms/page, %zu bytes/page\n", pageMs / pageCount, pageBytes / pageCount);
+    printf("RenderRegionToSvg: %.2f ms/region, %zu bytes/region\n", regionMs / regions, regionBytes / regions);
+    printf("Output %s\n", valid ? "valid" : "NOT valid");
+
+    return valid ? 0 : 1;
+}
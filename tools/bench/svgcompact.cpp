@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        svgcompact.cpp
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <stdio.h>
+#include <string>
+
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+#include "pugixml.hpp"
+#include "toolkit.h"
+
+using namespace vrv;
+
+//----------------------------------------------------------------------------
+// Compare the size and the rendering time of the default and of the compact SVG
+//
+// Usage: bench-svgcompact resource-path file [file ...]
+// For example: bench-svgcompact data $(find doc/tests -type f)
+//----------------------------------------------------------------------------
+
+/**
+ * Render all the pages and return the size of the SVG, adding the time to ms
+ */
+static size_t RenderAll(Toolkit &toolkit, double &ms, bool &valid)
+{
+    size_t bytes = 0;
+    for (int page = 1; page <= toolkit.GetPageCount(); ++page) {
+        BenchTimer timer;
+        std::string svg = toolkit.RenderToSvg(page);
+        ms += timer.GetMs();
+        bytes += svg.size();
+        pugi::xml_document doc;
+        if (!doc.load_string(svg.c_str())) valid = false;
+    }
+    return bytes;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3) {
+        std::cerr << "Usage: bench-svgcompact resource-path file [file ...]" << std::endl;
+        return 1;
+    }
+
+    size_t defaultBytes = 0, compactBytes = 0;
+    double defaultMs = 0.0, compactMs = 0.0;
+    int files = 0, pages = 0;
+    bool valid = true;
+
+    for (int i = 2; i < argc; ++i) {
+        Toolkit toolkit(false);
+        toolkit.SetResourcePath(argv[1]);
+        toolkit.SetXmlIdSeed(1);
+        if (!toolkit.LoadFile(argv[i])) continue;
+
+        // a first rendering for laying out the pages and loading the glyphs
+        for (int page = 1; page <= toolkit.GetPageCount(); ++page) toolkit.RenderToSvg(page);
+
+        toolkit.SetCompact(false);
+        defaultBytes += RenderAll(toolkit, defaultMs, valid);
+        toolkit.SetCompact(true);
+        compactBytes += RenderAll(toolkit, compactMs, valid);
+
+        files++;
+        pages += toolkit.GetPageCount();
+    }
+
+    if (!pages) return 1;
+
+    printf("%d files, %d pages\n", files, pages);
+    printf("default: %zu bytes, %.2f ms/page\n", defaultBytes, defaultMs / pages);
+    printf("compact: %zu bytes (%.1f%%), %.2f ms/page\n", compactBytes, 100.0 * compactBytes / defaultBytes,
+        compactMs / pages);
+    printf("Output %s\n", valid ? "valid" : "NOT valid");
+
+    return valid ? 0 : 1;
+}
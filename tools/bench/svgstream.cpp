@@ -0,0 +1,125 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        svgstream.cpp
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdio.h>
+#include <string>
+
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+#include "pugixml.hpp"
+#include "toolkit.h"
+
+using namespace vrv;
+
+//----------------------------------------------------------------------------
+// Compare the time and the peak memory per page of Toolkit::RenderToSvg and Toolkit::RenderToSvgStream
+//
+// Usage: bench-svgstream file [resource-path]
+//----------------------------------------------------------------------------
+
+/**
+ * A stream buffer discarding the output and counting the bytes
+ */
+class NullBuffer : public std::streambuf {
+public:
+    NullBuffer() { m_count = 0; }
+    size_t m_count;
+
+protected:
+    virtual std::streamsize xsputn(const char *, std::streamsize n)
+    {
+        m_count += n;
+        return n;
+    }
+    virtual int overflow(int c)
+    {
+        m_count++;
+        return c;
+    }
+};
+
+/**
+ * Count the elements by name, but the <g> because the resumed graphics are written in separate groups by the stream
+ */
+static void CountElements(pugi::xml_node node, std::map<std::string, int> &counts)
+{
+    for (pugi::xml_node child = node.first_child(); child; child = child.next_sibling()) {
+        if (child.type() != pugi::node_element) continue;
+        if (std::string(child.name()) != "g") counts[child.name()]++;
+        CountElements(child, counts);
+    }
+}
+
+static bool SameElements(const std::string &svg1, const std::string &svg2)
+{
+    pugi::xml_document doc1, doc2;
+    if (!doc1.load_string(svg1.c_str()) || !doc2.load_string(svg2.c_str())) return false;
+    std::map<std::string, int> counts1, counts2;
+    CountElements(doc1, counts1);
+    CountElements(doc2, counts2);
+    return (counts1 == counts2);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        std::cerr << "Usage: bench-svgstream file [resource-path]" << std::endl;
+        return 1;
+    }
+
+    Toolkit toolkit(false);
+    if (argc > 2) toolkit.SetResourcePath(argv[2]);
+    toolkit.SetXmlIdSeed(1);
+    if (!toolkit.LoadFile(argv[1])) return 1;
+
+    int pageCount = toolkit.GetPageCount();
+
+    // a first pass for loading the glyphs and checking the output
+    bool equivalent = true;
+    for (int page = 1; page <= pageCount; ++page) {
+        std::ostringstream stream;
+        toolkit.RenderToSvgStream(stream, page);
+        if (!SameElements(toolkit.RenderToSvg(page), stream.str())) {
+            std::cerr << "Page " << page << " is not equivalent" << std::endl;
+            equivalent = false;
+        }
+    }
+
+    double domMs = 0.0, streamMs = 0.0;
+    size_t domPeak = 0, streamPeak = 0, bytes = 0;
+    for (int page = 1; page <= pageCount; ++page) {
+        size_t base = GetMemoryInUse();
+        ResetPeakMemory();
+        BenchTimer timer;
+        std::string svg = toolkit.RenderToSvg(page);
+        domMs += timer.GetMs();
+        if (GetPeakMemory() - base > domPeak) domPeak = GetPeakMemory() - base;
+        svg.clear();
+        svg.shrink_to_fit();
+
+        NullBuffer nullBuffer;
+        std::ostream nullStream(&nullBuffer);
+        base = GetMemoryInUse();
+        ResetPeakMemory();
+        timer.Reset();
+        toolkit.RenderToSvgStream(nullStream, page);
+        streamMs += timer.GetMs();
+        if (GetPeakMemory() - base > streamPeak) streamPeak = GetPeakMemory() - base;
+        bytes += nullBuffer.m_count;
+    }
+
+    printf("%d pages, %zu bytes\n", pageCount, bytes);
+    printf("RenderToSvg:       %.2f ms/page, max peak %zu KB\n", domMs / pageCount, domPeak / 1024);
+    printf("RenderToSvgStream: %.2f ms/page, max peak %zu KB\n", streamMs / pageCount, streamPeak / 1024);
+    printf("Output %s\n", equivalent ? "equivalent" : "NOT equivalent");
+
+    return equivalent ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tiles.cpp
+// Author:      Laurent Pugin
+// Created:     2017
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <set>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+
+//----------------------------------------------------------------------------
+
+#include "bench.h"
+#include "pugixml.hpp"
+#include "toolkit.h"
+
+using namespace vrv;
+
+//----------------------------------------------------------------------------
+// Compare the rendering time of the single --no-layout page with the one of its tiles, and check that every element
+// of the page is in at least one tile
+//
+// Usage: bench-tiles resource-path file [tile-width] [--tile-measures]
+//----------------------------------------------------------------------------
+
+/**
+ * Collect the ids of the elements in the SVG, returning false if it cannot be parsed
+ */
+static bool CollectIds(const std::string &svg, std::set<std::string> &ids)
+{
+    pugi::xml_document doc;
+    if (!doc.load_string(svg.c_str())) return false;
+    pugi::xpath_node_set nodes = doc.select_nodes("//*[@id]");
+    for (pugi::xpath_node_set::const_iterator it = nodes.begin(); it != nodes.end(); ++it) {
+        ids.insert(it->node().attribute("id").value());
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3) {
+        std::cerr << "Usage: bench-tiles resource-path file [tile-width] [--tile-measures]" << std::endl;
+        return 1;
+    }
+
+    int tileWidth = 1200;
+    bool tileMeasures = false;
+    for (int i = 3; i < argc; ++i) {
+        if (std::string(argv[i]) == "--tile-measures") {
+            tileMeasures = true;
+        }
+        else {
+            tileWidth = atoi(argv[i]);
+        }
+    }
+
+    Toolkit toolkit(false);
+    toolkit.SetResourcePath(argv[1]);
+    toolkit.SetXmlIdSeed(1);
+    toolkit.SetNoLayout(true);
+    toolkit.SetTileWidth(tileWidth);
+    toolkit.SetTileMeasures(tileMeasures);
+    if (!toolkit.LoadFile(argv[2])) return 1;
+
+    // a first rendering for laying out the page and loading the glyphs
+    std::set<std::string> firstIds;
+    CollectIds(toolkit.RenderToSvg(), firstIds);
+
+    BenchTimer timer;
+    std::string svg = toolkit.RenderToSvg();
+    double pageMs = timer.GetMs();
+    size_t pageBytes = svg.size();
+    std::set<std::string> pageIds;
+    bool valid = CollectIds(svg, pageIds);
+
+    // the ids of the drawing copies of the staffDefs change with every rendering
+    std::set<std::string>::iterator iter;
+    for (iter = pageIds.begin(); iter != pageIds.end();) {
+        if (firstIds.find(*iter) == firstIds.end()) {
+            iter = pageIds.erase(iter);
+        }
+        else {
+            ++iter;
+        }
+    }
+
+    int tileCount = toolkit.GetTileCount();
+    double tilesMs = 0.0, maxTileMs = 0.0;
+    size_t tilesBytes = 0;
+    std::set<std::string> tileIds;
+    for (int tile = 1; tile <= tileCount; ++tile) {
+        timer.Reset();
+        svg = toolkit.RenderTileToSvg(1, tile);
+        double ms = timer.GetMs();
+        tilesMs += ms;
+        if (ms > maxTileMs) maxTileMs = ms;
+        tilesBytes += svg.size();
+        if (!CollectIds(svg, tileIds)) valid = false;
+    }
+
+    int missing = 0;
+    for (iter = pageIds.begin(); iter != pageIds.end(); ++iter) {
+        if (tileIds.find(*iter) == tileIds.end()) {
+            if (missing < 10) std::cerr << "Missing in the tiles: " << *iter << std::endl;
+            missing++;
+        }
+    }
+
+    if (!tileCount) return 1;
+
+    printf("%d tiles of %d px%s\n", tileCount, tileWidth, tileMeasures ? " (measure aligned)" : "");
+    printf("RenderToSvg:     %.2f ms, %zu bytes\n", pageMs, pageBytes);
+    printf("RenderTileToSvg: %.2f ms/tile (max %.2f ms), %zu bytes/tile\n", tilesMs / tileCount, maxTileMs,
+        tilesBytes / tileCount);
+    printf("Elements: %zu in the page, %d missing in the tiles\n", pageIds.size(), missing);
+    printf("Output %s\n", valid ? "valid" : "NOT valid");
+
+    return (valid && !missing) ? 0 : 1;
+}
@@ -85,8 +85,7 @@ void display_usage()
 
     cerr << " -o, --outfile=FILE_NAME    Output file name (use \"-\" for standard output)" << endl;
 
-    cerr << " -r, --resources=PATH       Path to SVG resources (default is " << vrv::Resources::GetPath() << ")"
-         << endl;
+    cerr << " -r, --resources=PATH       Path to SVG resources (default is the fonts built into Verovio)" << endl;
 
     cerr << " -s, --scale=FACTOR         Scale percent (default is " << DEFAULT_SCALE << ")" << endl;
 
@@ -110,11 +109,16 @@ void display_usage()
     cerr << " --choice-xpath-query=QR*   Set the xPath query for selecting <choice> child elements," << endl;
     cerr << "                            for example: \"./orig\"; by default the first child is selected" << endl;
 
+    cerr << " --compact                  Write compact SVG without indentation and with shorter markup" << endl;
+
     cerr << " --even-note-spacing        Space notes evenly and close together regardless of their durations" << endl;
 
     cerr << " --font=FONT                Select the music font to use (default is Leipzig;" << endl;
     cerr << "                            Bravura and Gootville are also available)" << endl;
 
+    cerr << " --glyph-sprite             Write the glyphs once to OUTFILE_sprite.svg and refer to it from the pages;" << endl;
+    cerr << "                            useful with --all-pages" << endl;
+
     cerr << " --help                     Display this message" << endl;
 
     cerr << " --ignore-layout            Ignore all encoded layout information (if any)" << endl;
@@ -134,15 +138,24 @@ void display_usage()
     cerr << " --spacing-non-linear=SP    Specify the non-linear spacing factor (default is "
          << DEFAULT_SPACING_NON_LINEAR << ")" << endl;
 
+    cerr << " --tile-measures            Cut the tiles at the beginning of measures (with --tile-width)" << endl;
+
+    cerr << " --tile-width=WIDTH         Output the page in tiles of WIDTH pixels with one output file per tile;" << endl;
+    cerr << "                            useful with --no-layout" << endl;
+
     cerr << " --spacing-staff=SP         Specify the spacing above each staff (in MEI vu)" << endl;
 
     cerr << " --spacing-system=SP        Specify the spacing above each system (in MEI vu)" << endl;
 
+    cerr << " --use-arena                Allocate the objects of the document in an arena" << endl;
+
     cerr << " --xml-id-seed=INT          Seed the random number generator for XML IDs" << endl;
 
     // Debugging options
     cerr << endl << "Debugging options" << endl;
 
+    cerr << " --memory-footprint         Print the memory taken by the objects of each class" << endl;
+
     cerr << " --no-justification         Do not justify the system" << endl;
 
     cerr << " --show-bounding-boxes      Show symbol bounding boxes" << endl;
@@ -156,6 +169,7 @@ int main(int argc, char **argv)
     string outfile;
     string outformat = "svg";
     string font = "";
+    string resourcePath = "";
     vector<string> appXPathQueries;
     vector<string> choiceXPathQueries;
     bool std_output = false;
@@ -163,18 +177,24 @@ int main(int argc, char **argv)
     int no_mei_hdr = 0;
     int adjust_page_height = 0;
     int all_pages = 0;
+    int compact = 0;
+    int glyph_sprite = 0;
     int no_layout = 0;
     int ignore_layout = 0;
     int no_justification = 0;
     int even_note_spacing = 0;
     int show_bounding_boxes = 0;
+    int use_arena = 0;
+    int memory_footprint = 0;
     int page = 1;
+    int tile_measures = 0;
+    int tile_width = 0;
     int show_help = 0;
     int show_version = 0;
 
     // Create the toolkit instance without loading the font because
     // the resource path might be specified in the parameters
-    // The fonts will be loaded later with Resources::InitFonts()
+    // The fonts will be loaded later with Toolkit::SetResourcePath()
     Toolkit toolkit(false);
 
     if (argc < 2) {
@@ -187,18 +207,20 @@ int main(int argc, char **argv)
     static struct option long_options[] = { { "adjust-page-height", no_argument, &adjust_page_height, 1 },
         { "all-pages", no_argument, &all_pages, 1 }, { "app-xpath-query", required_argument, 0, 0 },
         { "border", required_argument, 0, 'b' }, { "choice-xpath-query", required_argument, 0, 0 },
-        { "even-note-spacing", no_argument, &even_note_spacing, 1 }, { "font", required_argument, 0, 0 },
-        { "format", required_argument, 0, 'f' }, { "help", no_argument, &show_help, 1 },
+        { "compact", no_argument, &compact, 1 }, { "even-note-spacing", no_argument, &even_note_spacing, 1 },
+        { "font", required_argument, 0, 0 }, { "format", required_argument, 0, 'f' },
+        { "glyph-sprite", no_argument, &glyph_sprite, 1 }, { "help", no_argument, &show_help, 1 },
         { "ignore-layout", no_argument, &ignore_layout, 1 }, { "mdiv-xpath-query", required_argument, 0, 0 },
-        { "no-layout", no_argument, &no_layout, 1 }, { "no-mei-hdr", no_argument, &no_mei_hdr, 1 },
+        { "memory-footprint", no_argument, &memory_footprint, 1 }, { "no-layout", no_argument, &no_layout, 1 }, { "no-mei-hdr", no_argument, &no_mei_hdr, 1 },
         { "no-justification", no_argument, &no_justification, 1 }, { "outfile", required_argument, 0, 'o' },
         { "page", required_argument, 0, 0 }, { "page-height", required_argument, 0, 'h' },
         { "page-width", required_argument, 0, 'w' }, { "resources", required_argument, 0, 'r' },
         { "scale", required_argument, 0, 's' }, { "show-bounding-boxes", no_argument, &show_bounding_boxes, 1 },
         { "spacing-linear", required_argument, 0, 0 }, { "spacing-non-linear", required_argument, 0, 0 },
         { "spacing-staff", required_argument, 0, 0 }, { "spacing-system", required_argument, 0, 0 },
-        { "type", required_argument, 0, 't' }, { "version", no_argument, &show_version, 1 },
-        { "xml-id-seed", required_argument, 0, 0 }, { 0, 0, 0, 0 } };
+        { "tile-measures", no_argument, &tile_measures, 1 }, { "tile-width", required_argument, 0, 0 },
+        { "type", required_argument, 0, 't' }, { "use-arena", no_argument, &use_arena, 1 },
+        { "version", no_argument, &show_version, 1 }, { "xml-id-seed", required_argument, 0, 0 }, { 0, 0, 0, 0 } };
 
     int option_index = 0;
     while ((c = getopt_long(argc, argv, "b:f:h:o:p:r:s:t:w:v", long_options, &option_index)) != -1) {
@@ -244,8 +266,11 @@ int main(int argc, char **argv)
                         exit(1);
                     }
                 }
+                else if (strcmp(long_options[option_index].name, "tile-width") == 0) {
+                    tile_width = atoi(optarg);
+                }
                 else if (strcmp(long_options[option_index].name, "xml-id-seed") == 0) {
-                    Object::SeedUuid(atoi(optarg));
+                    toolkit.SetXmlIdSeed(atoi(optarg));
                 }
                 break;
 
@@ -269,7 +294,7 @@ int main(int argc, char **argv)
 
             case 'o': outfile = string(optarg); break;
 
-            case 'r': vrv::Resources::SetPath(optarg); break;
+            case 'r': resourcePath = string(optarg); break;
 
             case 't':
                 outformat = string(optarg);
@@ -318,11 +343,15 @@ int main(int argc, char **argv)
 
     // Set the various flags in accordance with the options given
     toolkit.SetAdjustPageHeight(adjust_page_height);
+    toolkit.SetCompact(compact);
+    toolkit.SetTileWidth(tile_width);
+    toolkit.SetTileMeasures(tile_measures);
     toolkit.SetNoLayout(no_layout);
     toolkit.SetIgnoreLayout(ignore_layout);
     toolkit.SetNoJustification(no_justification);
     toolkit.SetEvenNoteSpacing(even_note_spacing);
     toolkit.SetShowBoundingBoxes(show_bounding_boxes);
+    toolkit.SetUseArena(use_arena);
 
     if (optind <= argc - 1) {
         infile = string(argv[optind]);
@@ -333,16 +362,15 @@ int main(int argc, char **argv)
         exit(1);
     }
 
-    // Make sure the user uses a valid Resource path
+    // Make sure the user uses a valid Resource path when one is given
     // Save many headaches for empty SVGs
-    if (!dir_exists(vrv::Resources::GetPath())) {
-        cerr << "The resources path " << vrv::Resources::GetPath() << " could not be found; please use -r option."
-             << endl;
+    if (!resourcePath.empty() && !dir_exists(resourcePath)) {
+        cerr << "The resources path " << resourcePath << " could not be found; please use -r option." << endl;
         exit(1);
     }
 
-    // Load the music font from the resource directory
-    if (!Resources::InitFonts()) {
+    // Load the music font from the resource directory (or the built-in one)
+    if (!toolkit.SetResourcePath(resourcePath)) {
         cerr << "The music font could not be loaded; please check the contents of the resource directory." << endl;
         exit(1);
     }
@@ -394,6 +422,10 @@ int main(int argc, char **argv)
         }
     }
 
+    if (memory_footprint) {
+        cerr << toolkit.GetMemoryFootprint();
+    }
+
     if (toolkit.GetOutputFormat() != HUMDRUM) {
         // Check the page range
         if (page > toolkit.GetPageCount()) {
@@ -414,12 +446,35 @@ int main(int argc, char **argv)
     }
 
     if (outformat == "svg") {
+        // the pages refer to the sprite written next to them
+        std::string sprite_outfile;
+        if (glyph_sprite && !std_output) {
+            sprite_outfile = outfile + "_sprite.svg";
+            toolkit.SetGlyphSpriteHref(basename(sprite_outfile));
+        }
         int p;
         for (p = from; p < to; p++) {
             std::string cur_outfile = outfile;
             if (all_pages) {
                 cur_outfile += StringFormat("_%03d", p);
             }
+            if (tile_width > 0) {
+                if (std_output) {
+                    cerr << "Tiles cannot be written to standard output." << endl;
+                    exit(1);
+                }
+                int t;
+                for (t = 1; t <= toolkit.GetTileCount(p); t++) {
+                    std::string tile_outfile = cur_outfile + StringFormat("_tile_%03d.svg", t);
+                    if (!toolkit.RenderTileToSvgFile(tile_outfile, p, t)) {
+                        cerr << "Unable to write SVG to " << tile_outfile << "." << endl;
+                        exit(1);
+                    }
+                    cerr << "Output written to " << tile_outfile << " (x = " << toolkit.GetTileOffset(p, t) << ")."
+                         << endl;
+                }
+                continue;
+            }
             cur_outfile += ".svg";
             if (std_output) {
                 cout << toolkit.RenderToSvg(p);
@@ -432,6 +487,15 @@ int main(int argc, char **argv)
                 cerr << "Output written to " << cur_outfile << "." << endl;
             }
         }
+        if (!sprite_outfile.empty()) {
+            if (!toolkit.GetGlyphSpriteFile(sprite_outfile)) {
+                cerr << "Unable to write the glyph sprite to " << sprite_outfile << "." << endl;
+                exit(1);
+            }
+            else {
+                cerr << "Output written to " << sprite_outfile << "." << endl;
+            }
+        }
     }
     else if (outformat == "midi") {
         outfile += ".mid";